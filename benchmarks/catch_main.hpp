@@ -13,6 +13,10 @@
 #include <catch2/reporters/catch_reporter_registrars.hpp>
 #include <catch2/reporters/catch_reporter_streaming_base.hpp>
 
+#include "benchmarks/roofline.hpp"
+
+CATCH_REGISTER_REPORTER("roofline", NeoN::benchmark::RooflineReporter)
+
 int main(int argc, char* argv[])
 {
     // Initialize Catch2
@@ -23,7 +23,12 @@ TEST_CASE("Vector<scalar>::addition", "[bench]")
         NeoN::Vector<NeoN::scalar> cpuC(exec, size);
         NeoN::fill(cpuC, 0.0);
 
-        BENCHMARK(std::string(execName)) { return (cpuC = cpuA + cpuB); };
+        // reads a and b, writes c and one flop per entry
+        const auto bytes = 3.0 * sizeof(NeoN::scalar) * size;
+        BENCHMARK(NeoN::benchmark::declareTraffic(exec, execName, bytes, size))
+        {
+            return (cpuC = cpuA + cpuB);
+        };
     }
 }
 
@@ -42,6 +47,31 @@ TEST_CASE("Vector<scalar>::multiplication", "[bench]")
         NeoN::Vector<NeoN::scalar> cpuC(exec, size);
         NeoN::fill(cpuC, 0.0);
 
-        BENCHMARK(std::string(execName)) { return (cpuC = cpuA * cpuB); };
+        // reads a and b, writes c and one flop per entry
+        const auto bytes = 3.0 * sizeof(NeoN::scalar) * size;
+        BENCHMARK(NeoN::benchmark::declareTraffic(exec, execName, bytes, size))
+        {
+            return (cpuC = cpuA * cpuB);
+        };
+    }
+}
+
+TEST_CASE("Vector<scalar>::streamTriad", "[bench]")
+{
+    auto size = GENERATE(1 << 16, 1 << 18, 1 << 20, 1 << 22, 1 << 24);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoN::Vector<NeoN::scalar> a(exec, size, 0.0);
+        NeoN::Vector<NeoN::scalar> b(exec, size, 1.0);
+        NeoN::Vector<NeoN::scalar> c(exec, size, 2.0);
+
+        // reads b and c, writes a and two flops per entry
+        const auto bytes = 3.0 * sizeof(NeoN::scalar) * size;
+        BENCHMARK(NeoN::benchmark::declareTraffic(exec, execName, bytes, 2.0 * size))
+        {
+            NeoN::benchmark::streamTriad(exec, a, b, c, 3.0);
+        };
     }
 }
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <string>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+/* Measures the host overhead of launching many small kernels, eg. one per boundary patch. Every
+ * benchmark launches nKernels kernels of a few entries each, through the NeoN::Executor with a
+ * name held in a std::string, through the NeoN::Executor with a literal name, and through the
+ * concrete executor after visiting the NeoN::Executor once.
+ */
+namespace
+{
+
+using NeoN::localIdx;
+using NeoN::scalar;
+
+constexpr localIdx nKernels = 100;
+
+constexpr localIdx kernelSize = 16;
+
+/* @brief launches nKernels kernels on consecutive blocks of values, Executor is either the
+ * NeoN::Executor or a concrete executor
+ */
+template<typename Executor, typename Name>
+void launchKernels(const Executor& exec, NeoN::View<scalar> valuesV, const Name& name)
+{
+    for (localIdx k = 0; k < nKernels; k++)
+    {
+        NeoN::parallelFor(
+            exec,
+            {k * kernelSize, (k + 1) * kernelSize},
+            KOKKOS_LAMBDA(const localIdx i) { valuesV[i] += 1.0; },
+            name
+        );
+    }
+}
+
+}
+
+TEST_CASE("Launch overhead", "[bench]")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Vector<scalar> values(exec, nKernels * kernelSize, 0.0);
+    auto valuesV = values.view();
+    // longer than the small string buffer, as most kernel names
+    const std::string name = "boundaryPatchUpdateKernel";
+
+    // copies the name into a std::string per launch, as the former interface did
+    BENCHMARK("std::string name " + execName)
+    {
+        for (localIdx k = 0; k < nKernels; k++)
+        {
+            const std::string label(name);
+            NeoN::parallelFor(
+                exec,
+                {k * kernelSize, (k + 1) * kernelSize},
+                KOKKOS_LAMBDA(const localIdx i) { valuesV[i] += 1.0; },
+                label
+            );
+        }
+        NeoN::fence(exec);
+    };
+
+    BENCHMARK("literal name " + execName)
+    {
+        launchKernels(exec, valuesV, "boundaryPatchUpdateKernel");
+        NeoN::fence(exec);
+    };
+
+    BENCHMARK("concrete executor " + execName)
+    {
+        std::visit(
+            [&](const auto& e) { launchKernels(e, valuesV, "boundaryPatchUpdateKernel"); }, exec
+        );
+        NeoN::fence(exec);
+    };
+}
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+/* Scatters the values of the faces of a chain of cells into the owner and neighbour cells, as the
+ * atomic face reduction does, once with the generic atomic of Kokkos and once component by
+ * component with NeoN::atomicAdd.
+ */
+namespace
+{
+
+using NeoN::localIdx;
+using NeoN::scalar;
+
+template<typename ValueType, typename AtomicAdd>
+void scatterFaces(
+    const NeoN::Executor& exec,
+    const NeoN::Vector<ValueType>& faceValues,
+    NeoN::Vector<ValueType>& cellValues,
+    AtomicAdd add
+)
+{
+    const auto faceV = faceValues.view();
+    auto cellV = cellValues.view();
+    NeoN::parallelFor(
+        exec,
+        {0, faceValues.size()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            add(&cellV[facei], faceV[facei]);
+            add(&cellV[facei + 1], -1.0 * faceV[facei]);
+        }
+    );
+    NeoN::fence(exec);
+}
+
+template<typename ValueType>
+void benchmarkAtomics(
+    const std::string& type,
+    const std::string& execName,
+    NeoN::Executor exec,
+    localIdx size,
+    ValueType faceValue
+)
+{
+    NeoN::Vector<ValueType> faceValues(exec, size, faceValue);
+    NeoN::Vector<ValueType> cellValues(exec, size + 1, NeoN::zero<ValueType>());
+    // reads one value per face and updates two cells
+    const auto bytes = 5.0 * static_cast<double>(sizeof(ValueType)) * static_cast<double>(size);
+    const auto flops =
+        2.0 * static_cast<double>(sizeof(ValueType) / sizeof(scalar)) * static_cast<double>(size);
+
+    BENCHMARK(NeoN::benchmark::declareTraffic(
+        exec, "scatter " + type + " Kokkos::atomic_add " + execName, bytes, flops
+    ))
+    {
+        return scatterFaces(
+            exec,
+            faceValues,
+            cellValues,
+            KOKKOS_LAMBDA(ValueType * dst, const ValueType& value) {
+                Kokkos::atomic_add(dst, value);
+            }
+        );
+    };
+
+    BENCHMARK(NeoN::benchmark::declareTraffic(
+        exec, "scatter " + type + " NeoN::atomicAdd " + execName, bytes, flops
+    ))
+    {
+        return scatterFaces(
+            exec,
+            faceValues,
+            cellValues,
+            KOKKOS_LAMBDA(ValueType * dst, const ValueType& value) { NeoN::atomicAdd(dst, value); }
+        );
+    };
+}
+
+}
+
+TEST_CASE("Vec3 atomics", "[bench]")
+{
+    auto size = GENERATE(1 << 18, 1 << 20, 1 << 22);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    DYNAMIC_SECTION("" << size)
+    {
+        benchmarkAtomics("scalar", execName, exec, size, scalar(1.0));
+        benchmarkAtomics("Vec3", execName, exec, size, NeoN::Vec3(1.0, 2.0, 3.0));
+        benchmarkAtomics("Tensor", execName, exec, size, NeoN::one<NeoN::Tensor>());
+    }
+}
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+/* The compact layout stores three scalars per vector, the padded layout four of which the last
+ * is zero. Both are emulated with scalar vectors and a stride of Lanes, such that one build
+ * compares them, the Vec3 of the build follows NeoN_ENABLE_PADDED_VEC3.
+ */
+namespace
+{
+
+using NeoN::localIdx;
+using NeoN::scalar;
+
+/* @brief fills Lanes scalars per vector with the components (i, 1, 2) and zero padding */
+template<localIdx Lanes>
+NeoN::Vector<scalar> createLaneVectors(const NeoN::Executor& exec, localIdx size)
+{
+    NeoN::Vector<scalar> values(exec, Lanes * size, 0.0);
+    auto valuesV = values.view();
+    NeoN::parallelFor(
+        exec,
+        {0, size},
+        KOKKOS_LAMBDA(const localIdx i) {
+            valuesV[Lanes * i] = static_cast<scalar>(i) + 1.0;
+            valuesV[Lanes * i + 1] = 1.0;
+            valuesV[Lanes * i + 2] = 2.0;
+        }
+    );
+    return values;
+}
+
+/* @brief the delta coefficients |Sf|^2 / (Sf & d) of the faces of a chain of cells, where d is
+ * the distance between the neighbouring cell centres
+ */
+template<localIdx Lanes>
+void deltaCoeffs(
+    const NeoN::Executor& exec,
+    const NeoN::Vector<scalar>& faceAreas,
+    const NeoN::Vector<scalar>& cellCentres,
+    NeoN::Vector<scalar>& result
+)
+{
+    const auto [sfV, cV] = NeoN::views(faceAreas, cellCentres);
+    auto resultV = result.view();
+    NeoN::parallelFor(
+        exec,
+        {0, result.size()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            scalar sfSf = 0.0;
+            scalar sfD = 0.0;
+            for (localIdx d = 0; d < Lanes; d++)
+            {
+                const auto sf = sfV[Lanes * facei + d];
+                sfSf += sf * sf;
+                sfD += sf * (cV[Lanes * (facei + 1) + d] - cV[Lanes * facei + d]);
+            }
+            resultV[facei] = sfSf / sfD;
+        }
+    );
+    NeoN::fence(exec);
+}
+
+/* @brief the Gauss-Green gradient of the face values of a chain of cells, where the faces of
+ * cell i are i - 1 and i
+ */
+template<localIdx Lanes>
+void gaussGreenGrad(
+    const NeoN::Executor& exec,
+    const NeoN::Vector<scalar>& faceAreas,
+    const NeoN::Vector<scalar>& faceValues,
+    NeoN::Vector<scalar>& grad
+)
+{
+    const auto [sfV, phiV] = NeoN::views(faceAreas, faceValues);
+    auto gradV = grad.view();
+    NeoN::parallelFor(
+        exec,
+        {1, faceValues.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            for (localIdx d = 0; d < Lanes; d++)
+            {
+                gradV[Lanes * celli + d] = phiV[celli] * sfV[Lanes * celli + d]
+                                         - phiV[celli - 1] * sfV[Lanes * (celli - 1) + d];
+            }
+        }
+    );
+    NeoN::fence(exec);
+}
+
+template<localIdx Lanes>
+void benchmarkLayout(
+    const std::string& layout, const std::string& execName, NeoN::Executor exec, localIdx size
+)
+{
+    auto faceAreas = createLaneVectors<Lanes>(exec, size);
+    auto cellCentres = createLaneVectors<Lanes>(exec, size + 1);
+    NeoN::Vector<scalar> faceValues(exec, size, 1.0);
+    NeoN::Vector<scalar> coeffs(exec, size, 0.0);
+    NeoN::Vector<scalar> grad(exec, Lanes * size, 0.0);
+    const auto scalarBytes = static_cast<double>(sizeof(scalar)) * static_cast<double>(size);
+    const auto vecBytes = static_cast<double>(Lanes) * scalarBytes;
+
+    // reads the face areas and the cell centres and writes one scalar per face
+    BENCHMARK(NeoN::benchmark::declareTraffic(
+        exec, "deltaCoeffs " + layout + " " + execName, 2.0 * vecBytes + scalarBytes, 6.0 * size
+    ))
+    {
+        return deltaCoeffs<Lanes>(exec, faceAreas, cellCentres, coeffs);
+    };
+
+    // reads the face areas and values and writes one vector per cell
+    BENCHMARK(NeoN::benchmark::declareTraffic(
+        exec, "gaussGreenGrad " + layout + " " + execName, 2.0 * vecBytes + scalarBytes, 9.0 * size
+    ))
+    {
+        return gaussGreenGrad<Lanes>(exec, faceAreas, faceValues, grad);
+    };
+}
+
+}
+
+TEST_CASE("Vec3 layout", "[bench]")
+{
+    auto size = GENERATE(1 << 18, 1 << 20, 1 << 22);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    DYNAMIC_SECTION("" << size)
+    {
+        benchmarkLayout<3>("compact", execName, exec, size);
+        benchmarkLayout<4>("padded", execName, exec, size);
+
+        // the operations of the Vec3 of this build on the same kernel
+        NeoN::Vector<NeoN::Vec3> faceAreas(exec, size, NeoN::Vec3(1.0, 1.0, 2.0));
+        NeoN::Vector<NeoN::Vec3> cellCentres(exec, size + 1, NeoN::Vec3(0.0, 1.0, 2.0));
+        NeoN::Vector<scalar> coeffs(exec, size, 0.0);
+        const auto bytes = static_cast<double>(2 * sizeof(NeoN::Vec3) + sizeof(scalar))
+                         * static_cast<double>(size);
+        BENCHMARK(NeoN::benchmark::declareTraffic(
+            exec, "deltaCoeffs Vec3 " + execName, bytes, 6.0 * size
+        ))
+        {
+            const auto [sfV, cV] = NeoN::views(faceAreas, cellCentres);
+            auto coeffsV = coeffs.view();
+            NeoN::parallelFor(
+                exec,
+                {0, size},
+                KOKKOS_LAMBDA(const localIdx facei) {
+                    coeffsV[facei] =
+                        (sfV[facei] & sfV[facei]) / (sfV[facei] & (cV[facei + 1] - cV[facei]));
+                }
+            );
+            NeoN::fence(exec);
+        };
+    }
+}
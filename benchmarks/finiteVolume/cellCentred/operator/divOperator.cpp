@@ -35,3 +35,29 @@ TEST_CASE("DivOperator::div", "[bench]")
         BENCHMARK(std::string(execName)) { return (op.div(divPhi)); };
     }
 }
+
+TEST_CASE("DivOperator::div 3D", "[bench]")
+{
+    auto n = GENERATE(32, 64, 128, 216);
+    auto randomCellOrder = GENERATE(false, true);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::UnstructuredMesh mesh = NeoN::create3DUniformMesh(exec, n, n, n, randomCellOrder);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    fvcc::SurfaceField<NeoN::scalar> faceFlux(exec, "sf", mesh, surfaceBCs);
+    NeoN::fill(faceFlux.internalVector(), 1.0);
+
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "vf", mesh, volumeBCs);
+    fvcc::VolumeField<NeoN::scalar> divPhi(exec, "divPhi", mesh, volumeBCs);
+    NeoN::fill(phi.internalVector(), 1.0);
+
+    // capture the number of cells and the ordering as section name
+    DYNAMIC_SECTION("" << n * n * n << (randomCellOrder ? " random" : " ordered"))
+    {
+        NeoN::Input input = NeoN::TokenList({std::string("Gauss"), std::string("linear")});
+        auto op = fvcc::DivOperator(Operator::Type::Explicit, faceFlux, phi, input);
+
+        BENCHMARK(std::string(execName)) { return (op.div(divPhi)); };
+    }
+}
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <string>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+/* Measures the framework overhead around small kernels: the correction of the boundary
+ * conditions of a field on meshes with many small patches, ie. the launches and the host work per
+ * patch, and the lookup of the old time level of a field in a database holding many fields.
+ */
+namespace
+{
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::localIdx;
+using NeoN::scalar;
+
+/* @brief the mesh with its boundary faces split evenly into nPatches patches */
+NeoN::UnstructuredMesh splitPatches(const NeoN::UnstructuredMesh& mesh, localIdx nPatches)
+{
+    const auto& bMesh = mesh.boundaryMesh();
+    const auto nBoundaryFaces = mesh.nBoundaryFaces();
+    std::vector<localIdx> offsets(static_cast<std::size_t>(nPatches) + 1);
+    for (localIdx patchi = 0; patchi <= nPatches; patchi++)
+    {
+        offsets[static_cast<std::size_t>(patchi)] = patchi * nBoundaryFaces / nPatches;
+    }
+    NeoN::BoundaryMesh split(
+        mesh.exec(),
+        bMesh.faceCells(),
+        bMesh.cf(),
+        bMesh.cn(),
+        bMesh.sf(),
+        bMesh.magSf(),
+        bMesh.nf(),
+        bMesh.delta(),
+        bMesh.weights(),
+        bMesh.deltaCoeffs(),
+        offsets
+    );
+    return NeoN::UnstructuredMesh(
+        mesh.points(),
+        mesh.cellVolumes(),
+        mesh.cellCentres(),
+        mesh.faceAreas(),
+        mesh.faceCentres(),
+        mesh.magFaceAreas(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.nCells(),
+        mesh.nInternalFaces(),
+        nBoundaryFaces,
+        nPatches,
+        mesh.nFaces(),
+        split
+    );
+}
+
+/* @brief fixed value, fixed gradient and calculated conditions in turn on all patches */
+std::vector<fvcc::VolumeBoundary<scalar>> mixedBCs(const NeoN::UnstructuredMesh& mesh)
+{
+    std::vector<fvcc::VolumeBoundary<scalar>> bcs;
+    for (localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+    {
+        NeoN::Dictionary dict;
+        switch (patchi % 3)
+        {
+        case 0:
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", 1.0);
+            break;
+        case 1:
+            dict.insert("type", std::string("fixedGradient"));
+            dict.insert("fixedGradient", 0.0);
+            break;
+        default:
+            dict.insert("type", std::string("calculated"));
+        }
+        bcs.push_back(fvcc::VolumeBoundary<scalar>(mesh, dict, patchi));
+    }
+    return bcs;
+}
+
+}
+
+TEST_CASE("Boundary correction", "[bench]")
+{
+    // 6144 boundary faces, from the six patches of a box to patches of eight faces
+    auto nPatches = GENERATE(6, 96, 768);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = splitPatches(NeoN::create3DUniformMesh(exec, 32, 32, 32), nPatches);
+    fvcc::VolumeField<scalar> vf(exec, "T", mesh, mixedBCs(mesh));
+    NeoN::fill(vf.internalVector(), 1.0);
+
+    const auto name = execName + " " + std::to_string(nPatches) + " patches";
+    DYNAMIC_SECTION(name)
+    {
+        BENCHMARK("correctBoundaryConditions " + name)
+        {
+            vf.correctBoundaryConditions();
+            NeoN::fence(exec);
+        };
+
+        // the copy of the conditions returned by the accessor
+        BENCHMARK("boundaryConditions " + name) { return vf.boundaryConditions().size(); };
+
+        BENCHMARK("construct conditions " + name) { return mixedBCs(mesh).size(); };
+    }
+}
+
+TEST_CASE("Old time lookup", "[bench]")
+{
+    // the database of a solver holds fields of several equations
+    auto nVectors = GENERATE(1, 10, 100);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::create3DUniformMesh(exec, 8, 8, 8);
+    auto& fieldCollection = fvcc::VectorCollection::instance(db, "fieldCollection");
+    auto bcs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+    fvcc::VolumeField<scalar>* last = nullptr;
+    for (int vectori = 0; vectori < nVectors; vectori++)
+    {
+        fvcc::VolumeField<scalar> vf(exec, "T" + std::to_string(vectori), mesh, bcs);
+        last = &fieldCollection.registerVector<fvcc::VolumeField<scalar>>(
+            fvcc::CreateFromExistingVector<fvcc::VolumeField<scalar>> {
+                .name = vf.name,
+                .field = vf,
+                .timeIndex = 0,
+                .iterationIndex = 0,
+                .subCycleIndex = 0
+            }
+        );
+        fvcc::oldTime(*last);
+    }
+    auto& T = *last;
+
+    const auto name = execName + " " + std::to_string(nVectors) + " fields";
+    DYNAMIC_SECTION(name)
+    {
+        BENCHMARK("oldTime " + name) { return &fvcc::oldTime(T); };
+
+        BENCHMARK("oldTime().oldTime() " + name) { return &fvcc::oldTime(fvcc::oldTime(T)); };
+    }
+}
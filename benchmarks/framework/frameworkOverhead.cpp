@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <string>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+/* Measures the host work of the framework per equation and time step: reading the schemes and
+ * solver settings from dictionaries, selecting classes by name at run time, copying expressions
+ * and creating the linear system of an implicit equation.
+ */
+namespace
+{
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::scalar;
+
+/* @brief a schemes dictionary with nEntries entries per sub dictionary, as of a larger solver */
+NeoN::Dictionary fvSchemes(int nEntries)
+{
+    NeoN::Dictionary result;
+    for (const auto* group : {"ddtSchemes", "gradSchemes", "divSchemes", "laplacianSchemes"})
+    {
+        NeoN::Dictionary schemes;
+        schemes.insert("default", std::string("Gauss"));
+        for (int entryi = 0; entryi < nEntries; entryi++)
+        {
+            schemes.insert(
+                "div(phi,U" + std::to_string(entryi) + ")",
+                NeoN::TokenList({std::string("Gauss"), std::string("linear")})
+            );
+        }
+        result.insert(group, schemes);
+    }
+    return result;
+}
+
+NeoN::Dictionary fvSolution()
+{
+    return NeoN::Dictionary {
+        {{"solver", std::string {"Krylov"}},
+         {"method", std::string {"cg"}},
+         {"maxIters", 100},
+         {"relTol", 1e-6}}
+    };
+}
+
+}
+
+TEST_CASE("Dictionary access", "[bench]")
+{
+    auto nEntries = GENERATE(10, 100);
+
+    const auto dict = fvSchemes(nEntries);
+    const std::string key = "div(phi,U" + std::to_string(nEntries - 1) + ")";
+    const auto name = std::to_string(nEntries) + " entries";
+
+    BENCHMARK("subDict " + name) { return &dict.subDict("divSchemes"); };
+
+    BENCHMARK("contains " + name) { return dict.subDict("divSchemes").contains(key); };
+
+    BENCHMARK("get " + name)
+    {
+        return dict.subDict("divSchemes").get<NeoN::TokenList>(key).size();
+    };
+
+    BENCHMARK("copy " + name) { return NeoN::Dictionary(dict).keys().size(); };
+}
+
+TEST_CASE("Runtime selection", "[bench]")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const auto solverDict = fvSolution();
+
+    BENCHMARK("SolverFactory::create " + execName)
+    {
+        return NeoN::la::SolverFactory::create(exec, solverDict).get() != nullptr;
+    };
+
+    BENCHMARK("Solver " + execName) { return NeoN::la::Solver(exec, solverDict).memoryBytes(); };
+}
+
+TEST_CASE("Expression copies and linear systems", "[bench]")
+{
+    auto n = GENERATE(10, 50);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+    fvcc::VolumeField<scalar> T(exec, "T", mesh, volumeBCs);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+    fvcc::SurfaceField<scalar> phi(exec, "phi", mesh, surfaceBCs);
+    fvcc::SurfaceField<scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+
+    // the operators of a transport equation, the copies share the fields
+    const auto type = NeoN::dsl::Operator::Type::Implicit;
+    auto eqn = NeoN::dsl::Expression<scalar>(exec);
+    eqn.addOperator(NeoN::dsl::TemporalOperator<scalar>(fvcc::DdtOperator(type, T)));
+    eqn.addOperator(NeoN::dsl::SpatialOperator<scalar>(fvcc::DivOperator<scalar>(type, phi, T)));
+    eqn.addOperator(
+        NeoN::dsl::Coeff(-1.0)
+        * NeoN::dsl::SpatialOperator<scalar>(fvcc::LaplacianOperator<scalar>(type, gamma, T))
+    );
+
+    const auto name = execName + " " + std::to_string(n * n * n);
+    DYNAMIC_SECTION(name)
+    {
+        BENCHMARK("Expression copy " + name) { return NeoN::dsl::Expression<scalar>(eqn).size(); };
+
+        const auto& sparsity = NeoN::la::SparsityPattern::readOrCreate(mesh);
+        BENCHMARK("createEmptyLinearSystem " + name)
+        {
+            auto ls = NeoN::la::createEmptyLinearSystem<scalar, NeoN::localIdx>(mesh, sparsity);
+            NeoN::fence(exec);
+            return ls.rhs().size();
+        };
+
+        BENCHMARK("readOrCreateLinearSystem " + name)
+        {
+            auto& ls = NeoN::la::readOrCreateLinearSystem<scalar, NeoN::localIdx>(mesh);
+            NeoN::fence(exec);
+            return ls.rhs().size();
+        };
+    }
+}
@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <limits>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+struct CreateVector
+{
+    std::string name;
+    const NeoN::UnstructuredMesh& mesh;
+    std::int64_t timeIndex = 0;
+    std::int64_t iterationIndex = 0;
+    std::int64_t subCycleIndex = 0;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        // fixed values on all patches yield a non-singular laplacian
+        std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs {};
+        for (NeoN::localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            NeoN::Dictionary dict;
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", NeoN::scalar(1.0));
+            bcs.push_back(fvcc::VolumeBoundary<NeoN::scalar>(mesh, dict, patchi));
+        }
+        NeoN::Field<NeoN::scalar> domainVector(
+            mesh.exec(),
+            NeoN::Vector<NeoN::scalar>(mesh.exec(), mesh.nCells(), 0.0),
+            mesh.boundaryMesh().offset()
+        );
+        fvcc::VolumeField<NeoN::scalar> vf(
+            mesh.exec(), name, mesh, domainVector, bcs, db, "", ""
+        );
+        return NeoN::Document(
+            {{"name", vf.name},
+             {"timeIndex", timeIndex},
+             {"iterationIndex", iterationIndex},
+             {"subCycleIndex", subCycleIndex},
+             {"field", vf}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+TEST_CASE("LinearAlgebra::assembly", "[bench]")
+{
+    auto n = GENERATE(32, 64, 128);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    NeoN::UnstructuredMesh mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+    fvcc::VectorCollection& fieldCollection = fvcc::VectorCollection::instance(db, "fields");
+    auto& phi = fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+        CreateVector {.name = "phi", .mesh = mesh, .timeIndex = 1}
+    );
+    phi.correctBoundaryConditions();
+
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    fvcc::SurfaceField<NeoN::scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gamma.internalVector(), 1.0);
+
+    // capture the number of cells as section name
+    DYNAMIC_SECTION("" << n * n * n)
+    {
+        BENCHMARK(std::string(execName) + " SparsityPattern")
+        {
+            auto sp = NeoN::la::SparsityPattern(mesh);
+            NeoN::fence(exec);
+            return sp.nnz();
+        };
+
+        NeoN::la::SparsityPattern sp(mesh);
+
+        BENCHMARK(std::string(execName) + " createEmptyLinearSystem")
+        {
+            auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(mesh, sp);
+            NeoN::fence(exec);
+            return ls.rhs().size();
+        };
+
+        auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(mesh, sp);
+        NeoN::Input input = NeoN::TokenList(
+            {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+        );
+        NeoN::dsl::SpatialOperator lapOp = NeoN::dsl::imp::laplacian(gamma, phi);
+        lapOp.read(input);
+
+        BENCHMARK(std::string(execName) + " laplacian")
+        {
+            ls.resetValues();
+            lapOp.implicitOperation(ls);
+            NeoN::fence(exec);
+        };
+
+        auto ddtOp = NeoN::dsl::imp::ddt(phi);
+
+        BENCHMARK(std::string(execName) + " ddt")
+        {
+            ls.resetValues();
+            ddtOp.implicitOperation(ls, 1.0, 0.1);
+            NeoN::fence(exec);
+        };
+
+        NeoN::Vector<NeoN::scalar> res(exec, mesh.nCells());
+
+        BENCHMARK(std::string(execName) + " computeResidual")
+        {
+            NeoN::la::computeResidual(ls.matrix(), ls.rhs(), phi.internalVector(), res);
+            NeoN::fence(exec);
+        };
+    }
+}
+
+#if NF_WITH_GINKGO
+TEST_CASE("LinearAlgebra::solve", "[bench]")
+{
+    auto n = GENERATE(32, 64, 128);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto [configName, solverDict] = GENERATE(
+        std::pair<std::string, NeoN::Dictionary> {
+            "Cg",
+            NeoN::Dictionary {
+                {{"solver", std::string {"Ginkgo"}},
+                 {"type", "solver::Cg"},
+                 {"criteria",
+                  NeoN::Dictionary {{{"iteration", 1000}, {"relative_residual_norm", 1e-8}}}}}
+            }
+        },
+        std::pair<std::string, NeoN::Dictionary> {
+            "Cg + Jacobi",
+            NeoN::Dictionary {
+                {{"solver", std::string {"Ginkgo"}},
+                 {"type", "solver::Cg"},
+                 {"preconditioner", NeoN::Dictionary {{{"type", "preconditioner::Jacobi"}}}},
+                 {"criteria",
+                  NeoN::Dictionary {{{"iteration", 1000}, {"relative_residual_norm", 1e-8}}}}}
+            }
+        },
+        std::pair<std::string, NeoN::Dictionary> {
+            "Bicgstab + Jacobi",
+            NeoN::Dictionary {
+                {{"solver", std::string {"Ginkgo"}},
+                 {"type", "solver::Bicgstab"},
+                 {"preconditioner", NeoN::Dictionary {{{"type", "preconditioner::Jacobi"}}}},
+                 {"criteria",
+                  NeoN::Dictionary {{{"iteration", 1000}, {"relative_residual_norm", 1e-8}}}}}
+            }
+        }
+    );
+
+    NeoN::UnstructuredMesh mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+    NeoN::Database db;
+    fvcc::VectorCollection& fieldCollection = fvcc::VectorCollection::instance(db, "fields");
+    auto& phi = fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+        CreateVector {.name = "phi", .mesh = mesh, .timeIndex = 1}
+    );
+    phi.correctBoundaryConditions();
+
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    fvcc::SurfaceField<NeoN::scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gamma.internalVector(), 1.0);
+
+    NeoN::la::SparsityPattern sp(mesh);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(mesh, sp);
+    NeoN::Input input =
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+    NeoN::dsl::SpatialOperator lapOp = NeoN::dsl::imp::laplacian(gamma, phi);
+    lapOp.read(input);
+    lapOp.implicitOperation(ls);
+
+    // the iterations are reported in the name of the benchmark
+    NeoN::la::Solver solver(exec, solverDict);
+    NeoN::Vector<NeoN::scalar> x(exec, mesh.nCells(), 0.0);
+    const auto stats = solver.solve(ls, x);
+
+    DYNAMIC_SECTION("" << n * n * n << " " << configName)
+    {
+        const auto name = std::string(execName) + " iterations " + std::to_string(stats.numIter);
+
+        // the setup generates the solver and preconditioner from the matrix
+        BENCHMARK_ADVANCED(name + " setup + solve")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<NeoN::la::Solver> solvers;
+            std::vector<NeoN::Vector<NeoN::scalar>> xs;
+            solvers.reserve(static_cast<size_t>(meter.runs()));
+            for (int run = 0; run < meter.runs(); run++)
+            {
+                solvers.emplace_back(exec, solverDict);
+                xs.emplace_back(exec, mesh.nCells(), 0.0);
+            }
+            meter.measure(
+                [&](int run)
+                {
+                    const auto i = static_cast<size_t>(run);
+                    return solvers[i].solve(ls, xs[i]);
+                }
+            );
+        };
+
+        // the apply reuses the solver generated by the first solve
+        auto applyDict = solverDict;
+        applyDict.insert("rebuildPreconditionerEvery", std::numeric_limits<int>::max());
+        NeoN::la::Solver applySolver(exec, applyDict);
+        NeoN::Vector<NeoN::scalar> x0(exec, mesh.nCells(), 0.0);
+        applySolver.solve(ls, x0);
+
+        BENCHMARK_ADVANCED(name + " solve")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<NeoN::Vector<NeoN::scalar>> xs;
+            for (int run = 0; run < meter.runs(); run++)
+            {
+                xs.emplace_back(exec, mesh.nCells(), 0.0);
+            }
+            meter.measure(
+                [&](int run) { return applySolver.solve(ls, xs[static_cast<size_t>(run)]); }
+            );
+        };
+    }
+}
+#endif
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main_mpi.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+// The exchanges are collective, hence every configuration runs a fixed number of repetitions
+// on all ranks instead of the adaptive sampling of Catch2 BENCHMARK. Every rank exchanges size
+// values with each of its neighbours, the ranks at a distance of 1 to the number of neighbours.
+
+namespace
+{
+
+constexpr int nWarmup = 3;
+constexpr int nRepetitions = 20;
+
+/* @brief the mean durations of the phases of an exchange in seconds, maximum over the ranks */
+struct Latency
+{
+    double start;
+    double wait;
+    double finalise;
+};
+
+std::string typeName(NeoN::scalar) { return "scalar"; }
+
+std::string typeName(NeoN::Vec3) { return "Vec3"; }
+
+/* @brief the ranks this rank exchanges with at each distance, wrapping around the last rank */
+void addNeighbours(
+    const NeoN::mpi::MPIEnvironment& env,
+    std::size_t nNeighbours,
+    std::size_t size,
+    NeoN::CommMap& sendMap,
+    NeoN::CommMap& receiveMap
+)
+{
+    const auto nRanks = env.sizeRank();
+    const auto rank = env.rank();
+    for (std::size_t d = 1; d <= nNeighbours; d++)
+    {
+        auto& send = sendMap[(rank + d) % nRanks];
+        auto& receive = receiveMap[(rank + nRanks - d % nRanks) % nRanks];
+        for (std::size_t i = 0; i < size; i++)
+        {
+            send.push_back(NeoN::NodeCommMap {.local_idx = static_cast<NeoN::label>(i)});
+            const auto receiveIdx = static_cast<NeoN::label>(d * size + i);
+            receive.push_back(NeoN::NodeCommMap {.local_idx = receiveIdx});
+        }
+    }
+}
+
+std::vector<std::size_t> rankSizes(const NeoN::CommMap& commMap)
+{
+    std::vector<std::size_t> sizes;
+    for (const auto& rankMap : commMap)
+    {
+        sizes.push_back(rankMap.size());
+    }
+    return sizes;
+}
+
+/* @brief measures the phases of repeated exchanges, the ranks are synchronised before each */
+template<typename Start, typename Wait, typename Finalise>
+Latency measure(const NeoN::mpi::MPIEnvironment& env, Start start, Wait wait, Finalise finalise)
+{
+    using clock = std::chrono::steady_clock;
+    std::vector<double> total {0.0, 0.0, 0.0};
+    for (int i = 0; i < nWarmup + nRepetitions; i++)
+    {
+        MPI_Barrier(env.comm());
+        const auto t0 = clock::now();
+        start();
+        const auto t1 = clock::now();
+        wait();
+        const auto t2 = clock::now();
+        finalise();
+        const auto t3 = clock::now();
+        if (i >= nWarmup)
+        {
+            total[0] += std::chrono::duration<double>(t1 - t0).count();
+            total[1] += std::chrono::duration<double>(t2 - t1).count();
+            total[2] += std::chrono::duration<double>(t3 - t2).count();
+        }
+    }
+    std::vector<double> max(3);
+    MPI_Allreduce(total.data(), max.data(), 3, MPI_DOUBLE, MPI_MAX, env.comm());
+    return {max[0] / nRepetitions, max[1] / nRepetitions, max[2] / nRepetitions};
+}
+
+void report(
+    const NeoN::mpi::MPIEnvironment& env,
+    const std::string& kind,
+    const std::string& config,
+    double bytes,
+    const Latency& latency
+)
+{
+    if (env.rank() != 0)
+    {
+        return;
+    }
+    const auto seconds = latency.start + latency.wait + latency.finalise;
+    std::printf(
+        "%-22s %-40s %12.0f B  start %10.2f us  wait %10.2f us  finalise %10.2f us  %8.3f GB/s\n",
+        kind.c_str(),
+        config.c_str(),
+        bytes,
+        1e6 * latency.start,
+        1e6 * latency.wait,
+        1e6 * latency.finalise,
+        seconds > 0.0 ? 1e-9 * bytes / seconds : 0.0
+    );
+    std::fflush(stdout);
+}
+
+}
+
+TEMPLATE_TEST_CASE("bench_communicator", "[bench]", NeoN::scalar, NeoN::Vec3)
+{
+    NeoN::mpi::MPIEnvironment env;
+    const auto nRanks = env.sizeRank();
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto nNeighbours = GENERATE(std::size_t {1}, std::size_t {2}, std::size_t {4}, std::size_t {8});
+    auto size = GENERATE(
+        std::size_t {1},
+        std::size_t {64},
+        std::size_t {1024},
+        std::size_t {16384},
+        std::size_t {1 << 18}
+    );
+
+    // a single rank exchanges with itself
+    if (nNeighbours > std::max<std::size_t>(nRanks - 1, 1))
+    {
+        return;
+    }
+
+    NeoN::CommMap sendMap(nRanks);
+    NeoN::CommMap receiveMap(nRanks);
+    addNeighbours(env, nNeighbours, size, sendMap, receiveMap);
+    const auto bytes = static_cast<double>(nNeighbours * size * sizeof(TestType));
+    const auto bufferExec = NeoN::commBufferExecutor(exec);
+    const auto config = typeName(TestType {}) + " " + execName
+                      + (bufferExec == exec ? "" : " staged") + " neighbours "
+                      + std::to_string(nNeighbours) + " size " + std::to_string(size);
+
+    SECTION("Communicator")
+    {
+        NeoN::Vector<TestType> field(
+            exec, static_cast<NeoN::localIdx>((nNeighbours + 1) * size), TestType {}
+        );
+        NeoN::Communicator comm(env, sendMap, receiveMap);
+        comm.reserveComm<TestType>("bench", exec);
+        const auto latency = measure(
+            env,
+            [&]() { comm.startComm(field, "bench"); },
+            [&]()
+            {
+                while (!comm.isComplete("bench"))
+                {
+                }
+            },
+            [&]() { comm.finaliseComm(field, "bench"); }
+        );
+        report(env, "Communicator", config, bytes, latency);
+    }
+
+    SECTION("HalfDuplexCommBuffer")
+    {
+        NeoN::mpi::HalfDuplexCommBuffer send(env, rankSizes(sendMap));
+        NeoN::mpi::HalfDuplexCommBuffer receive(env, rankSizes(receiveMap));
+        send.setExecutor(bufferExec);
+        receive.setExecutor(bufferExec);
+        const auto latency = measure(
+            env,
+            [&]()
+            {
+                send.initComm<TestType>("bench");
+                receive.initComm<TestType>("bench");
+                send.send();
+                receive.receive();
+            },
+            [&]()
+            {
+                send.waitComplete();
+                receive.waitComplete();
+            },
+            [&]()
+            {
+                send.finaliseComm();
+                receive.finaliseComm();
+            }
+        );
+        report(env, "HalfDuplexCommBuffer", config, bytes, latency);
+    }
+
+    SECTION("FullDuplexCommBuffer")
+    {
+        NeoN::mpi::FullDuplexCommBuffer buffer(env, rankSizes(sendMap), rankSizes(receiveMap));
+        buffer.setExecutor(bufferExec);
+        const auto latency = measure(
+            env,
+            [&]()
+            {
+                buffer.initComm<TestType>("bench");
+                buffer.startComm();
+            },
+            [&]() { buffer.waitComplete(); },
+            [&]() { buffer.finaliseComm(); }
+        );
+        report(env, "FullDuplexCommBuffer", config, bytes, latency);
+    }
+}
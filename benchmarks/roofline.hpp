@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <string>
+
+#include <catch2/reporters/catch_reporter_xml.hpp>
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vector.hpp"
+
+namespace NeoN::benchmark
+{
+
+/* @brief the data moved and the work performed by a single run of a benchmark */
+struct Traffic
+{
+    double bytes;
+
+    double flops;
+
+    /* @brief the STREAM triad bandwidth of the executor in bytes per second */
+    double peakBandwidth;
+};
+
+/* @brief the traffic of the benchmarks by name, read by the RooflineReporter */
+inline std::map<std::string, Traffic>& declaredTraffic()
+{
+    static std::map<std::string, Traffic> traffic;
+    return traffic;
+}
+
+/* @brief the STREAM triad a[i] = b[i] + s * c[i] */
+inline void streamTriad(
+    const Executor& exec,
+    Vector<scalar>& a,
+    const Vector<scalar>& b,
+    const Vector<scalar>& c,
+    const scalar s
+)
+{
+    auto aV = a.view();
+    const auto [bV, cV] = views(b, c);
+    parallelFor(
+        exec,
+        {0, a.size()},
+        KOKKOS_LAMBDA(const localIdx i) { aV[i] = bV[i] + s * cV[i]; },
+        "streamTriad"
+    );
+    fence(exec);
+}
+
+/* @brief measures the bandwidth of the STREAM triad in bytes per second
+ *
+ * The best of several runs is taken, the arrays need to be large compared to the caches.
+ */
+inline double streamTriadBandwidth(const Executor& exec, localIdx size = 1 << 25, int nRuns = 10)
+{
+    Vector<scalar> a(exec, size, 0.0);
+    Vector<scalar> b(exec, size, 1.0);
+    Vector<scalar> c(exec, size, 2.0);
+
+    double bestTime = std::numeric_limits<double>::max();
+    for (int run = 0; run < nRuns; run++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        streamTriad(exec, a, b, c, 3.0);
+        const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        bestTime = std::min(bestTime, time.count());
+    }
+    return 3.0 * sizeof(scalar) * static_cast<double>(size) / bestTime;
+}
+
+/* @brief the STREAM triad bandwidth of the executor, measured once per executor type */
+inline double peakBandwidth(const Executor& exec)
+{
+    static std::map<std::string, double> peaks;
+    const auto name = std::visit([](const auto& e) { return e.name(); }, exec);
+    if (!peaks.contains(name))
+    {
+        peaks[name] = streamTriadBandwidth(exec);
+    }
+    return peaks[name];
+}
+
+/* @brief declares the bytes moved and the flops performed by one run of the benchmark name
+ *
+ * The RooflineReporter adds the achieved bandwidth and flop rate and the fraction of the STREAM
+ * bandwidth of the executor to the benchmark results. The name is returned for the use as
+ * BENCHMARK(declareTraffic(exec, name, bytes, flops)).
+ */
+inline std::string
+declareTraffic(const Executor& exec, const std::string& name, double bytes, double flops = 0.0)
+{
+    declaredTraffic()[name] = Traffic {bytes, flops, peakBandwidth(exec)};
+    return name;
+}
+
+/* @class RooflineReporter
+ * @brief the Catch2 xml reporter with the roofline metrics of the benchmarks
+ *
+ * A Roofline element follows the results of every benchmark with declared traffic.
+ */
+class RooflineReporter : public Catch::XmlReporter
+{
+public:
+
+    using Catch::XmlReporter::XmlReporter;
+
+    static std::string getDescription()
+    {
+        return "Reports the results as xml including the achieved bandwidth and flop rate";
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+    {
+        Catch::XmlReporter::benchmarkEnded(stats);
+        auto it = declaredTraffic().find(stats.info.name);
+        if (it == declaredTraffic().end())
+        {
+            return;
+        }
+        const auto& traffic = it->second;
+        const double seconds = stats.mean.point.count() * 1e-9;
+        const double bandwidth = traffic.bytes / seconds;
+        m_stream << "\n<Roofline bytes=\"" << traffic.bytes << "\" flops=\"" << traffic.flops
+                 << "\" GBps=\"" << bandwidth * 1e-9 << "\" GFLOPps=\""
+                 << traffic.flops / seconds * 1e-9 << "\" peakGBps=\""
+                 << traffic.peakBandwidth * 1e-9 << "\" fractionOfPeak=\""
+                 << bandwidth / traffic.peakBandwidth << "\"/>";
+    }
+};
+
+}
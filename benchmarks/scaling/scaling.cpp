@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main_mpi.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using Operator = NeoN::dsl::Operator;
+
+// Runs time steps of the scalar transport equation of bench_scalarTransport on a mesh decomposed
+// over all ranks, with a fixed number of cells per rank (weak) or a fixed total (strong). Every
+// case writes the timers merged over the ranks between a '# scaling' and a '# end' line, which
+// scripts/scalingEfficiency.py combines over the runs with different rank counts.
+
+namespace
+{
+
+constexpr int nWarmup = 2;
+constexpr int nSteps = 20;
+constexpr NeoN::localIdx weakCellsPerDirection = 48;    // ~10^5 cells per rank
+constexpr NeoN::localIdx strongCellsPerDirection = 100; // 10^6 cells in total
+
+/* @brief the number of cells per direction of the undecomposed mesh */
+NeoN::localIdx cellsPerDirection(const std::string& mode, std::size_t nRanks)
+{
+    if (mode == "strong")
+    {
+        return strongCellsPerDirection;
+    }
+    const auto n = std::cbrt(static_cast<double>(nRanks)) * weakCellsPerDirection;
+    return static_cast<NeoN::localIdx>(std::lround(n));
+}
+
+NeoN::Dictionary fvSchemes()
+{
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("forwardEuler"));
+    NeoN::Dictionary divSchemes;
+    divSchemes.insert("div(phi,T)", NeoN::TokenList({std::string("Gauss"), std::string("linear")}));
+    NeoN::Dictionary laplacianSchemes;
+    laplacianSchemes.insert(
+        "laplacian(gamma,T)",
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")})
+    );
+    NeoN::Dictionary result;
+    result.insert("ddtSchemes", ddtSchemes);
+    result.insert("divSchemes", divSchemes);
+    result.insert("laplacianSchemes", laplacianSchemes);
+    return result;
+}
+
+/* @brief the boundary conditions of the decomposed mesh, the last patch couples the ranks */
+std::vector<fvcc::VolumeBoundary<NeoN::scalar>> boundaries(const NeoN::UnstructuredMesh& mesh)
+{
+    std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs;
+    for (NeoN::localIdx patchi = 0; patchi + 1 < mesh.nBoundaries(); patchi++)
+    {
+        bcs.emplace_back(mesh, NeoN::Dictionary({{"type", std::string("calculated")}}), patchi);
+    }
+    bcs.emplace_back(
+        mesh, NeoN::Dictionary({{"type", std::string("processor")}}), mesh.nBoundaries() - 1
+    );
+    return bcs;
+}
+
+}
+
+TEST_CASE("Scaling::scalarTransport", "[bench]")
+{
+    NeoN::mpi::MPIEnvironment env;
+    const auto mode = GENERATE(std::string("weak"), std::string("strong"));
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const auto n = cellsPerDirection(mode, env.sizeRank());
+    const auto global = NeoN::create3DUniformMesh(exec, n, n, n);
+    const auto cellToPart =
+        NeoN::partitionCells(global, static_cast<NeoN::localIdx>(env.sizeRank()));
+    const auto part = static_cast<NeoN::label>(env.rank());
+    auto decomposed = NeoN::decomposeMesh(global, cellToPart, part);
+    const auto& mesh = decomposed.mesh;
+    auto comm = NeoN::createCommunicator(env, decomposed);
+    fvcc::setProcessorCommunicator(mesh, comm);
+
+    NeoN::Database db;
+    fvcc::VolumeField<NeoN::scalar> initialT(exec, "T", mesh, boundaries(mesh));
+    NeoN::fill(initialT.internalVector(), 1.0);
+    auto& fieldCollection = fvcc::VectorCollection::instance(db, "fieldCollection");
+    auto& T = fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+        fvcc::CreateFromExistingVector<fvcc::VolumeField<NeoN::scalar>> {
+            .name = "T", .field = initialT, .timeIndex = 0, .iterationIndex = 0, .subCycleIndex = 0
+        }
+    );
+
+    const auto h = 1.0 / static_cast<NeoN::scalar>(n);
+    const NeoN::scalar gamma = 1e-3;
+    const NeoN::scalar dt = 0.1 * h * h / (6.0 * gamma);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    fvcc::SurfaceField<NeoN::scalar> phi(exec, "phi", mesh, surfaceBCs);
+    NeoN::fill(phi.internalVector(), h * h);
+    fvcc::SurfaceField<NeoN::scalar> gammaf(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gammaf.internalVector(), gamma);
+
+    auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+    eqn.addOperator(NeoN::dsl::exp::ddt(T));
+    eqn.addOperator(
+        NeoN::dsl::SpatialOperator<NeoN::scalar>(
+            fvcc::DivOperator<NeoN::scalar>(Operator::Type::Explicit, phi, T)
+        )
+    );
+    eqn.addOperator(
+        NeoN::dsl::Coeff(-1.0)
+        * NeoN::dsl::SpatialOperator<NeoN::scalar>(
+            fvcc::LaplacianOperator<NeoN::scalar>(Operator::Type::Explicit, gammaf, T)
+        )
+    );
+    const auto schemesDict = fvSchemes();
+    const NeoN::Dictionary solutionDict;
+
+    auto& timers = NeoN::TimerRegistry::instance();
+    timers.setFenceEnabled(true);
+    NeoN::scalar time = 0.0;
+    for (int step = 0; step < nWarmup + nSteps; step++)
+    {
+        if (step == nWarmup)
+        {
+            MPI_Barrier(env.comm());
+            timers.reset();
+        }
+        NeoN::ScopedTimer stepTimer("timeStep", exec);
+        NeoN::dsl::solve(eqn, T, time, dt, schemesDict, solutionDict);
+        fvcc::rotateOldTimes(T);
+        time += dt;
+    }
+
+    std::stringstream report;
+    timers.report(report, env.comm());
+    if (env.rank() == 0)
+    {
+        std::cout << "# scaling mode=" << mode << " executor=" << execName
+                  << " ranks=" << env.sizeRank() << " cells=" << global.nCells()
+                  << " steps=" << nSteps << "\n"
+                  << report.str() << "# end" << std::endl;
+    }
+    timers.setFenceEnabled(false);
+    timers.reset();
+}
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using Operator = NeoN::dsl::Operator;
+
+namespace
+{
+
+/* @brief the time integration schemes of the benchmark, the implicit scheme requires Ginkgo */
+std::vector<std::string> schemes()
+{
+    std::vector<std::string> result {"forwardEuler", "Runge-Kutta"};
+#if NF_WITH_GINKGO
+    result.push_back("backwardEuler");
+#endif
+    return result;
+}
+
+/* @brief registers the transported field in the database, as required for its old time levels */
+fvcc::VolumeField<NeoN::scalar>& registerT(NeoN::Database& db, const NeoN::UnstructuredMesh& mesh)
+{
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+    fvcc::VolumeField<NeoN::scalar> T(mesh.exec(), "T", mesh, volumeBCs);
+    NeoN::fill(T.internalVector(), 1.0);
+    NeoN::fill(T.boundaryData().value(), 1.0);
+    auto& fieldCollection = fvcc::VectorCollection::instance(db, "fieldCollection");
+    return fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+        fvcc::CreateFromExistingVector<fvcc::VolumeField<NeoN::scalar>> {
+            .name = "T", .field = T, .timeIndex = 0, .iterationIndex = 0, .subCycleIndex = 0
+        }
+    );
+}
+
+NeoN::Dictionary fvSchemes(const std::string& scheme)
+{
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", scheme);
+    ddtSchemes.insert("Runge-Kutta-Method", std::string("Heun"));
+    NeoN::Dictionary divSchemes;
+    divSchemes.insert("div(phi,T)", NeoN::TokenList({std::string("Gauss"), std::string("linear")}));
+    NeoN::Dictionary laplacianSchemes;
+    laplacianSchemes.insert(
+        "laplacian(gamma,T)",
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")})
+    );
+    NeoN::Dictionary result;
+    result.insert("ddtSchemes", ddtSchemes);
+    result.insert("divSchemes", divSchemes);
+    result.insert("laplacianSchemes", laplacianSchemes);
+    return result;
+}
+
+NeoN::Dictionary fvSolution()
+{
+    return NeoN::Dictionary {
+        {{"solver", std::string {"Ginkgo"}},
+         {"type", "solver::Bicgstab"},
+         {"criteria", NeoN::Dictionary {{{"iteration", 20}, {"relative_residual_norm", 1e-8}}}}}
+    };
+}
+
+}
+
+// Full time steps of ddt(T) + div(phi, T) - laplacian(gamma, T) = 0 through dsl::solve, which
+// includes the setup of the time integrator and the assembly in every step, as in a solver. The
+// TimerRegistry breaks the step down by phase, its report is written to a file per case.
+TEST_CASE("ScalarTransport::timeStep", "[bench]")
+{
+    auto n = GENERATE(22, 47, 100, 216); // 10^4 to 10^7 cells
+    auto scheme = GENERATE(Catch::Generators::from_range(schemes()));
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+    auto& T = registerT(db, mesh);
+
+    // a unit flux velocity through every face and a diffusivity below the explicit stability limit
+    const auto h = 1.0 / static_cast<NeoN::scalar>(n);
+    const NeoN::scalar gamma = 1e-3;
+    const NeoN::scalar dt = 0.1 * h * h / (6.0 * gamma);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    fvcc::SurfaceField<NeoN::scalar> phi(exec, "phi", mesh, surfaceBCs);
+    NeoN::fill(phi.internalVector(), h * h);
+    fvcc::SurfaceField<NeoN::scalar> gammaf(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gammaf.internalVector(), gamma);
+
+    const auto type = scheme == "backwardEuler" ? Operator::Type::Implicit
+                                                : Operator::Type::Explicit;
+    auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+    eqn.addOperator(NeoN::dsl::TemporalOperator<NeoN::scalar>(fvcc::DdtOperator(type, T)));
+    eqn.addOperator(
+        NeoN::dsl::SpatialOperator<NeoN::scalar>(fvcc::DivOperator<NeoN::scalar>(type, phi, T))
+    );
+    eqn.addOperator(
+        NeoN::dsl::Coeff(-1.0)
+        * NeoN::dsl::SpatialOperator<NeoN::scalar>(
+            fvcc::LaplacianOperator<NeoN::scalar>(type, gammaf, T)
+        )
+    );
+    const auto schemesDict = fvSchemes(scheme);
+    const auto solutionDict = fvSolution();
+
+    auto& timers = NeoN::TimerRegistry::instance();
+    timers.reset();
+    timers.setFenceEnabled(true);
+    NeoN::scalar time = 0.0;
+
+    const auto name = scheme + " " + execName + " " + std::to_string(n * n * n);
+    DYNAMIC_SECTION(name)
+    {
+        BENCHMARK(name)
+        {
+            NeoN::ScopedTimer stepTimer("timeStep", exec);
+            NeoN::dsl::solve(eqn, T, time, dt, schemesDict, solutionDict);
+            fvcc::rotateOldTimes(T);
+            time += dt;
+        };
+    }
+
+    std::ofstream report(
+        "scalarTransport_" + scheme + "_" + execName + "_" + std::to_string(n) + ".txt"
+    );
+    timers.report(report);
+    timers.setFenceEnabled(false);
+    timers.reset();
+}
@@ -13,6 +13,23 @@ if(NeoN_ENABLE_MPI_SUPPORT)
     message(FATAL_ERROR "NeoN_ENABLE_MPI_SUPPORT not supported on Windows")
   endif()
   find_package(MPI 3.1 REQUIRED)
+  if(NeoN_ENABLE_NCCL)
+    # NCCL and RCCL ship no CMake package, NCCL_HOME points to a non-standard installation
+    find_path(
+      NCCL_INCLUDE_DIR
+      NAMES nccl.h rccl/rccl.h
+      HINTS $ENV{NCCL_HOME}/include $ENV{ROCM_PATH}/include)
+    find_library(
+      NCCL_LIBRARY
+      NAMES nccl rccl
+      HINTS $ENV{NCCL_HOME}/lib $ENV{NCCL_HOME}/lib64 $ENV{ROCM_PATH}/lib)
+    if(NOT NCCL_INCLUDE_DIR OR NOT NCCL_LIBRARY)
+      message(FATAL_ERROR "NeoN_ENABLE_NCCL is set, but NCCL was not found, set NCCL_HOME")
+    endif()
+    add_library(NCCL::NCCL INTERFACE IMPORTED)
+    target_include_directories(NCCL::NCCL INTERFACE ${NCCL_INCLUDE_DIR})
+    target_link_libraries(NCCL::NCCL INTERFACE ${NCCL_LIBRARY})
+  endif()
 endif()
 
 if(${NeoN_WITH_PETSC})
@@ -134,7 +151,7 @@ if(${NeoN_WITH_SUNDIALS})
       "BUILD_CVODES OFF"
       "BUILD_IDA OFF"
       "BUILD_IDAS OFF"
-      "BUILD_KINSOL OFF"
+      "BUILD_KINSOL ON"
       "BUILD_CPODES OFF")
 
   if(WIN32)
@@ -38,7 +38,8 @@ public:
      * @param exec  Executor associated to the field
      * @param size  size of the field
      */
-    Array(const Executor& exec, localIdx size) : size_(size), data_(nullptr), exec_(exec)
+    Array(const Executor& exec, localIdx size)
+        : size_(size), capacity_(size), data_(nullptr), exec_(exec)
     {
         void* ptr = nullptr;
         std::visit(
@@ -62,7 +63,7 @@ public:
         localIdx size,
         Executor hostExec = SerialExecutor()
     )
-        : size_(size), data_(nullptr), exec_(exec)
+        : size_(size), capacity_(size), data_(nullptr), exec_(exec)
     {
         void* ptr = nullptr;
         std::visit(
@@ -82,7 +83,7 @@ public:
      * @param value  the  default value
      */
     Array(const Executor& exec, localIdx size, ValueType value)
-        : size_(size), data_(nullptr), exec_(exec)
+        : size_(size), capacity_(size), data_(nullptr), exec_(exec)
     {
         void* ptr = nullptr;
         std::visit(
@@ -124,10 +125,12 @@ public:
      * @brief Move constructor, moves the data from the parsed field to the new field.
      * @param rhs The field to move from.
      */
-    Array(Array<ValueType>&& rhs) noexcept : size_(rhs.size_), data_(rhs.data_), exec_(rhs.exec_)
+    Array(Array<ValueType>&& rhs) noexcept
+        : size_(rhs.size_), capacity_(rhs.capacity_), data_(rhs.data_), exec_(rhs.exec_)
     {
         rhs.data_ = nullptr;
         rhs.size_ = 0;
+        rhs.capacity_ = 0;
     };
 
     /**
@@ -222,30 +225,47 @@ public:
     /**
      * @brief Resizes the field to a new size.
      * @param size The new size to set the field to.
+     *
+     * The allocation is never shrunk, the values up to the smaller of both sizes are kept.
      */
     void resize(const localIdx size)
     {
-        void* ptr = nullptr;
-        if (!empty())
+        if (size > capacity_)
         {
-            std::visit(
-                [this, &ptr, size](const auto& exec)
-                { ptr = exec.realloc(this->data_, static_cast<size_t>(size) * sizeof(ValueType)); },
-                exec_
-            );
+            reallocate(size);
         }
-        else
+        size_ = size;
+    }
+
+    /**
+     * @brief Allocates memory for at least the given number of values without changing the size.
+     * @param capacity The number of values the field can hold without reallocating.
+     */
+    void reserve(const localIdx capacity)
+    {
+        if (capacity > capacity_)
         {
-            std::visit(
-                [&ptr, size](const auto& exec)
-                { ptr = exec.alloc(static_cast<size_t>(size) * sizeof(ValueType)); },
-                exec_
-            );
+            reallocate(capacity);
+        }
+    }
+
+    /**
+     * @brief Releases the memory allocated beyond the size of the field.
+     */
+    void shrinkToFit()
+    {
+        if (capacity_ > size_)
+        {
+            reallocate(size_);
         }
-        data_ = static_cast<ValueType*>(ptr);
-        size_ = size;
     }
 
+    /**
+     * @brief Gets the number of values the field can hold without reallocating.
+     * @return The capacity of the field.
+     */
+    [[nodiscard]] inline localIdx capacity() const { return capacity_; }
+
     /**
      * @brief Direct access to the underlying field data
      * @return Pointer to the first cell data in the field.
@@ -276,6 +296,15 @@ public:
      */
     [[nodiscard]] inline label ssize() const { return static_cast<label>(size_); }
 
+    /**
+     * @brief Gets the bytes allocated by the field.
+     * @return The capacity of the field times the size of the value type.
+     */
+    [[nodiscard]] std::size_t memoryBytes() const
+    {
+        return static_cast<std::size_t>(capacity_) * sizeof(ValueType);
+    }
+
     /**
      * @brief Checks if the field is empty.
      * @return True if the field is empty, false otherwise.
@@ -343,9 +372,37 @@ public:
 private:
 
     localIdx size_ {0};         //!< Size of the field.
+    localIdx capacity_ {0};     //!< Number of values allocated for the field.
     ValueType* data_ {nullptr}; //!< Pointer to the field data.
     const Executor exec_;       //!< Executor associated with the field. (CPU, GPU, openMP, etc.)
 
+    /**
+     * @brief Reallocates the data to the given capacity keeping the values that fit.
+     * @param capacity The new capacity.
+     */
+    void reallocate(const localIdx capacity)
+    {
+        void* ptr = nullptr;
+        if (capacity > 0)
+        {
+            std::visit(
+                [this, &ptr, capacity](const auto& exec)
+                {
+                    ptr = exec.realloc(
+                        this->data_, static_cast<size_t>(capacity) * sizeof(ValueType)
+                    );
+                },
+                exec_
+            );
+        }
+        else
+        {
+            std::visit([this](const auto& exec) { exec.free(this->data_); }, exec_);
+        }
+        data_ = static_cast<ValueType*>(ptr);
+        capacity_ = capacity;
+    }
+
     /**
      * @brief Checks if two fields are the same size and have the same executor.
      * @param rhs The field to compare with.
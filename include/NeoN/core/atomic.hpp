@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+
+#include <Kokkos_Core.hpp> // IWYU pragma: keep
+
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/primitives/tensor.hpp"
+
+namespace NeoN
+{
+
+/* @brief atomically adds value to dst
+ *
+ * Scalars and integers map onto a native atomic add of the device, the value is converted to the
+ * type of dst as for Kokkos::atomic_add.
+ */
+template<typename ValueType>
+KOKKOS_INLINE_FUNCTION void atomicAdd(ValueType* dst, const std::type_identity_t<ValueType>& value)
+{
+    Kokkos::atomic_add(dst, value);
+}
+
+/* @brief atomically adds value to dst, component by component
+ *
+ * Kokkos handles a Vec3 as an opaque type of 24 or 32 bytes, which it updates in a compare and
+ * swap loop or under a lock. The components are added by three native scalar atomics instead,
+ * the padding lane is always zero and skipped. The vector as a whole is not updated atomically,
+ * which is sufficient since the face loops only accumulate into the cells.
+ */
+KOKKOS_INLINE_FUNCTION void atomicAdd(Vec3* dst, const Vec3& value)
+{
+    for (size_t i = 0; i < 3; i++)
+    {
+        Kokkos::atomic_add(&(*dst)[i], value[i]);
+    }
+}
+
+/* @brief atomically adds value to dst, component by component, see atomicAdd of Vec3 */
+KOKKOS_INLINE_FUNCTION void atomicAdd(Tensor* dst, const Tensor& value)
+{
+    for (size_t i = 0; i < 3; i++)
+    {
+        atomicAdd(&dst->row(i), value.row(i));
+    }
+}
+
+} // namespace NeoN
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace NeoN
+{
+
+/**
+ * @struct BackendStats
+ * @brief The initializations of one backend recorded by the BackendRegistry.
+ */
+struct BackendStats
+{
+    std::string name;   //!< The name of the backend, eg. SUNDIALS.
+    std::size_t calls;  //!< The number of initializations, eg. one per Ginkgo executor.
+    double total;       //!< The accumulated duration in seconds.
+};
+
+/**
+ * @class BackendRegistry
+ * @brief Initializes the third party backends of the process lazily and once.
+ *
+ * The contexts and executors of SUNDIALS, Ginkgo and PETSc are created on first use and shared
+ * by all solvers and time integrators of the process, eg. a single SUNContext serves all
+ * Runge-Kutta integrators. Every initialization is timed, so that the startup cost of a short
+ * run can be read from the report. The shared objects are released when Kokkos is finalized,
+ * before the device runtime is torn down.
+ *
+ * @ingroup Timing
+ */
+class BackendRegistry
+{
+public:
+
+    /**
+     * @brief Gets the process wide registry.
+     */
+    static BackendRegistry& instance();
+
+    BackendRegistry(const BackendRegistry&) = delete;
+
+    BackendRegistry& operator=(const BackendRegistry&) = delete;
+
+    /**
+     * @brief Runs an initialization of a backend and records its duration.
+     * @param name The name of the backend.
+     * @param init The initialization, its result is returned.
+     */
+    template<typename Init>
+    auto timed(const std::string& name, Init init)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        auto result = init();
+        record(name, std::chrono::duration<double>(std::chrono::steady_clock::now() - start));
+        return result;
+    }
+
+    /**
+     * @brief Runs the initialization of a backend unless it has been run before.
+     * @param name The name of the backend.
+     * @param init The initialization, must not use the registry.
+     */
+    template<typename Init>
+    void initializeOnce(const std::string& name, Init init)
+    {
+        std::lock_guard<std::mutex> lock(initMutex_);
+        if (!initialized(name))
+        {
+            timed(
+                name,
+                [&]()
+                {
+                    init();
+                    return true;
+                }
+            );
+        }
+    }
+
+    /**
+     * @brief Gets the object shared by all users of a backend, created on first use.
+     * @param name The name of the backend, identifies the object.
+     * @param create Returns the shared_ptr of the object, must not use the registry.
+     */
+    template<typename T, typename Create>
+    std::shared_ptr<T> shared(const std::string& name, Create create)
+    {
+        std::lock_guard<std::mutex> lock(initMutex_);
+        auto& object = objects_[name];
+        if (!object)
+        {
+            object = timed(name, [&]() { return std::shared_ptr<T>(create()); });
+        }
+        return std::static_pointer_cast<T>(object);
+    }
+
+    /**
+     * @brief Checks if a backend has been initialized.
+     * @param name The name of the backend.
+     */
+    bool initialized(const std::string& name) const;
+
+    /**
+     * @brief Returns the initializations of all backends in the order of their first use.
+     */
+    std::vector<BackendStats> stats() const;
+
+    /**
+     * @brief Returns the accumulated duration of all initializations in seconds.
+     */
+    double total() const;
+
+    /**
+     * @brief Writes the initializations and their durations.
+     * @param os The stream to write to.
+     */
+    void report(std::ostream& os) const;
+
+    /**
+     * @brief Releases the shared objects, the recorded durations are kept.
+     */
+    void release();
+
+private:
+
+    BackendRegistry();
+
+    void record(const std::string& name, std::chrono::duration<double> duration);
+
+    mutable std::mutex mutex_;  //!< Guards the stats.
+    std::mutex initMutex_;      //!< Serializes the initializations of initializeOnce and shared.
+    std::vector<BackendStats> stats_;
+    std::map<std::string, std::shared_ptr<void>> objects_;
+};
+
+} // namespace NeoN
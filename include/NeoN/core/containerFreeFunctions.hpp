@@ -59,7 +59,10 @@ void map(ContType<ValueType>& cont, const Inner inner, std::pair<localIdx, local
     }
     auto contView = cont.view();
     parallelFor(
-        cont.exec(), {start, end}, KOKKOS_LAMBDA(const localIdx i) { contView[i] = inner(i); }
+        cont.exec(),
+        {start, end},
+        KOKKOS_LAMBDA(const localIdx i) { contView[i] = inner(i); },
+        "map"
     );
 }
 
@@ -86,7 +89,7 @@ void fill(
     }
     auto viewA = cont.view();
     parallelFor(
-        cont.exec(), {start, end}, KOKKOS_LAMBDA(const localIdx i) { viewA[i] = value; }
+        cont.exec(), {start, end}, KOKKOS_LAMBDA(const localIdx i) { viewA[i] = value; }, "fill"
     );
 }
 
@@ -112,7 +115,10 @@ void setContainer(
     }
     auto contView = cont.view();
     parallelFor(
-        cont.exec(), {start, end}, KOKKOS_LAMBDA(const localIdx i) { contView[i] = view[i]; }
+        cont.exec(),
+        {start, end},
+        KOKKOS_LAMBDA(const localIdx i) { contView[i] = view[i]; },
+        "setContainer"
     );
 }
 
@@ -159,6 +165,30 @@ bool equal(const ContType<ValueType>& cont1, const ContType<ValueType>& cont2)
     return true;
 };
 
+/**
+ * @brief Starts the migration of the data of a container in managed memory to its executor.
+ *
+ * @param cont The container accessed by the next kernels, see NeoN::setManagedDeviceMemory.
+ */
+template<template<typename> class ContType, typename ValueType>
+void prefetch(const ContType<ValueType>& cont)
+{
+    prefetch(cont.exec(), cont.data(), static_cast<size_t>(cont.size()) * sizeof(ValueType));
+}
+
+/**
+ * @brief Advises that the data of a container in managed memory is mostly read.
+ *
+ * @param cont The container, eg. a geometric quantity of the mesh.
+ */
+template<template<typename> class ContType, typename ValueType>
+void adviseReadMostly(const ContType<ValueType>& cont)
+{
+    adviseReadMostly(
+        cont.exec(), cont.data(), static_cast<size_t>(cont.size()) * sizeof(ValueType)
+    );
+}
+
 template<template<typename> class ContType, typename ValueType>
 bool equal(const ContType<ValueType>& cont, View<ValueType> view2)
 {
@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <any>
 #include <algorithm> // for std::sort
 
 #include "NeoN/core/database/document.hpp"
@@ -18,6 +19,16 @@ namespace NeoN
 // forward declaration
 class Database;
 
+/**
+ * @brief Converts a document value to the key of a secondary index.
+ *
+ * Strings, character arrays, integers and booleans are supported.
+ *
+ * @param value The value of a document entry.
+ * @return std::string The key of the value in the index.
+ */
+std::string indexValue(const std::any& value);
+
 /**
  * @class Collection
  * @brief A type-erased interface collection types.
@@ -86,6 +97,18 @@ public:
      */
     std::vector<std::string> find(const std::function<bool(const Document&)>& predicate) const;
 
+    /**
+     * @brief Finds the documents whose entry key has the given value.
+     *
+     * This is a hash lookup if the collection has an index on the key, see
+     * CollectionMixin::createIndex, otherwise all documents are searched.
+     *
+     * @param key The key of the document entry.
+     * @param value The value to search for.
+     * @return std::vector<std::string> A vector of document IDs with the value.
+     */
+    std::vector<std::string> findBy(const std::string& key, const std::any& value) const;
+
     /**
      * @brief Returns the number of documents in the collection.
      *
@@ -167,6 +190,8 @@ private:
         virtual const Document& doc(const std::string& id) const = 0;
         virtual std::vector<std::string> find(const std::function<bool(const Document&)>& predicate
         ) const = 0;
+        virtual std::vector<std::string>
+        findBy(const std::string& key, const std::any& value) const = 0;
         virtual size_t size() const = 0;
         virtual std::string type() const = 0;
         virtual std::string name() const = 0;
@@ -189,6 +214,12 @@ private:
             return collection_.find(predicate);
         }
 
+        std::vector<std::string>
+        findBy(const std::string& key, const std::any& value) const override
+        {
+            return collection_.findBy(key, value);
+        }
+
         size_t size() const override { return collection_.size(); }
 
         std::string type() const override { return collection_.type(); }
@@ -280,6 +311,98 @@ public:
         return result;
     }
 
+    /**
+     * @brief Finds the documents whose entry key has the given value.
+     *
+     * This is a hash lookup if an index on the key was created, otherwise all documents are
+     * searched.
+     *
+     * @param key The key of the document entry.
+     * @param value The value to search for.
+     * @return std::vector<std::string> A vector of document IDs with the value.
+     */
+    std::vector<std::string> findBy(const std::string& key, const std::any& value) const
+    {
+        const auto searched = indexValue(value);
+        std::vector<std::string> result;
+        if (auto index = indexes_.find(key); index != indexes_.end())
+        {
+            auto [first, last] = index->second.ids.equal_range(searched);
+            for (auto it = first; it != last; ++it)
+            {
+                result.push_back(it->second);
+            }
+            return result;
+        }
+        for (const auto& [id, doc] : docs_)
+        {
+            if (doc.doc().contains(key) && indexValue(doc.doc()[key]) == searched)
+            {
+                result.push_back(id);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Creates a secondary index on a document entry, the existing documents are indexed.
+     *
+     * The index is maintained when documents are inserted or erased. If an indexed entry of a
+     * document is modified afterwards, reindex has to be called for the document.
+     *
+     * @param key The key of the document entry to index.
+     */
+    void createIndex(const std::string& key)
+    {
+        if (indexes_.contains(key))
+        {
+            return;
+        }
+        auto& index = indexes_[key];
+        for (const auto& [id, doc] : docs_)
+        {
+            addToIndex(index, key, id, doc.doc());
+        }
+    }
+
+    /**
+     * @brief Checks whether the collection has an index on the document entry.
+     *
+     * @param key The key of the document entry.
+     * @return bool True if the entry is indexed.
+     */
+    bool hasIndex(const std::string& key) const { return indexes_.contains(key); }
+
+    /**
+     * @brief Updates the indexes of a document after its indexed entries were modified.
+     *
+     * @param id The ID of the document.
+     */
+    void reindex(const std::string& id)
+    {
+        const auto& doc = docs_.at(id).doc();
+        for (auto& [key, index] : indexes_)
+        {
+            removeFromIndex(index, id);
+            addToIndex(index, key, id, doc);
+        }
+    }
+
+    /**
+     * @brief Removes a document from the collection and its indexes.
+     *
+     * @param id The ID of the document.
+     * @return bool True if the document was removed.
+     */
+    bool erase(const std::string& id)
+    {
+        for (auto& [key, index] : indexes_)
+        {
+            removeFromIndex(index, id);
+        }
+        return docs_.erase(id) > 0;
+    }
+
     /**
      * @brief Gets the number of documents in the collection.
      *
@@ -333,9 +456,74 @@ public:
 
 protected:
 
+    /**
+     * @brief Inserts a document and adds it to the indexes.
+     *
+     * @param id The ID of the document.
+     * @param doc The document to insert.
+     * @return bool True if the document was inserted, false if the ID already exists.
+     */
+    bool emplaceDoc(const std::string& id, const DocumentType& doc)
+    {
+        auto [it, inserted] = docs_.emplace(id, doc);
+        if (inserted)
+        {
+            for (auto& [key, index] : indexes_)
+            {
+                addToIndex(index, key, id, it->second.doc());
+            }
+        }
+        return inserted;
+    }
+
     std::unordered_map<std::string, DocumentType> docs_; ///< The map of document IDs to documents.
     NeoN::Database& db_;                                 ///< The reference to the database.
     std::string name_;                                   ///< The name of the collection.
+
+private:
+
+    /**
+     * @brief A secondary index from the values of a document entry to the document IDs.
+     */
+    struct SecondaryIndex
+    {
+        std::unordered_multimap<std::string, std::string> ids; ///< The IDs of every value.
+        std::unordered_map<std::string, std::string> values;   ///< The value of every ID.
+    };
+
+    static void addToIndex(
+        SecondaryIndex& index, const std::string& key, const std::string& id, const Document& doc
+    )
+    {
+        if (!doc.contains(key))
+        {
+            return;
+        }
+        auto value = indexValue(doc[key]);
+        index.ids.emplace(value, id);
+        index.values.emplace(id, std::move(value));
+    }
+
+    static void removeFromIndex(SecondaryIndex& index, const std::string& id)
+    {
+        auto value = index.values.find(id);
+        if (value == index.values.end())
+        {
+            return;
+        }
+        auto [first, last] = index.ids.equal_range(value->second);
+        for (auto it = first; it != last; ++it)
+        {
+            if (it->second == id)
+            {
+                index.ids.erase(it);
+                break;
+            }
+        }
+        index.values.erase(value);
+    }
+
+    std::unordered_map<std::string, SecondaryIndex> indexes_; ///< The secondary indexes by key.
 };
 
 } // namespace NeoN
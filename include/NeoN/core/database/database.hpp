@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "NeoN/core/database/collection.hpp"
 
@@ -96,6 +97,13 @@ public:
      */
     std::size_t size() const;
 
+    /**
+     * @brief Returns the names of all collections in the database.
+     *
+     * @return std::vector<std::string> The sorted names of the collections.
+     */
+    std::vector<std::string> names() const;
+
 
 private:
 
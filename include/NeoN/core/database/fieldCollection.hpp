@@ -5,11 +5,14 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 #include <string>
 #include <functional>
+#include <typeinfo>
 
 #include "NeoN/core/demangle.hpp"
 #include "NeoN/core/error.hpp"
+#include "NeoN/core/vector/hostMirror.hpp"
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/fields/field.hpp"
 #include "NeoN/core/database/database.hpp"
@@ -34,6 +37,11 @@ bool validateVectorDoc(const Document& doc);
  *
  * The VectorDocument class represents a field document in a database. It is a subclass of the
  * Document class and provides additional functionality for accessing field-specific data.
+ *
+ * Fields which are not accessed for a while, eg. old time levels between the steps, can be
+ * marked as offloadable. Their internal vector is then moved to host memory by offload, which
+ * frees the device memory, and restored by prefetch before the next access. The boundary data is
+ * small and stays resident.
  */
 class VectorDocument
 {
@@ -183,6 +191,75 @@ public:
      */
     std::int64_t& subCycleIndex();
 
+    /**
+     * @brief Checks whether the field may be moved to host memory, false unless it is set.
+     */
+    bool offloadable() const;
+
+    /**
+     * @brief Allows or forbids moving the field to host memory.
+     *
+     * @param offloadable Whether offload may move the field to host memory.
+     */
+    void setOffloadable(bool offloadable);
+
+    /**
+     * @brief Checks whether the internal vector of the field is in the memory of its executor.
+     */
+    bool resident() const;
+
+    /**
+     * @brief Moves the internal vector of an offloadable field to host memory.
+     *
+     * The copy is enqueued on the executor of the field and the device memory is released, the
+     * memory pool reuses it in stream order, see MemoryPool. Fields whose executor memory is
+     * accessible from the host are neither copied nor released. The field must not be accessed
+     * until it is prefetched.
+     *
+     * @tparam VectorType The type of the field.
+     */
+    template<class VectorType>
+    void offload()
+    {
+        using ValueType = typename VectorType::VectorValueType;
+        NF_ASSERT(offloadable(), "The field " + name() + " is not offloadable.");
+        auto& vec = field<VectorType>().internalVector();
+        if (!resident() || detail::hostAccessible(vec.exec()))
+        {
+            return;
+        }
+        if (!doc_.contains("hostMirror"))
+        {
+            doc_.insert("hostMirror", std::make_shared<HostMirror<ValueType>>());
+        }
+        auto& mirror = *doc_.get<std::shared_ptr<HostMirror<ValueType>>>("hostMirror");
+        mirror.syncToHostAsync(vec);
+        vec.resize(0);
+        vec.shrinkToFit();
+        doc_.insert("resident", false);
+    }
+
+    /**
+     * @brief Enqueues the copy of an offloaded field back to the memory of its executor.
+     *
+     * The kernels enqueued afterwards on the executor of the field find the data resident, the
+     * host memory is kept for the next offload.
+     *
+     * @tparam VectorType The type of the field.
+     */
+    template<class VectorType>
+    void prefetch()
+    {
+        using ValueType = typename VectorType::VectorValueType;
+        if (resident())
+        {
+            return;
+        }
+        auto& mirror = *doc_.get<std::shared_ptr<HostMirror<ValueType>>>("hostMirror");
+        mirror.syncToDeviceAsync(field<VectorType>().internalVector());
+        doc_.insert("resident", true);
+    }
+
 private:
 
     Document doc_; /**< The underlying Document. */
@@ -349,6 +426,55 @@ public:
         field.fieldCollectionName = name();
         return field;
     }
+
+    /**
+     * @brief Moves all offloadable and resident fields of VectorType to host memory.
+     *
+     * @tparam VectorType The type of the fields, eg. VolumeField<scalar>.
+     * @return The number of offloaded fields.
+     */
+    template<class VectorType>
+    localIdx offloadAll()
+    {
+        localIdx nOffloaded = 0;
+        for (const auto& id : find(
+                 [](const Document& doc)
+                 {
+                     return doc["field"].type() == typeid(VectorType) && doc.contains("offloadable")
+                         && doc.get<bool>("offloadable")
+                         && !(doc.contains("resident") && !doc.get<bool>("resident"));
+                 }
+             ))
+        {
+            fieldDoc(id).offload<VectorType>();
+            nOffloaded++;
+        }
+        return nOffloaded;
+    }
+
+    /**
+     * @brief Enqueues the copy of all offloaded fields of VectorType back to their executors.
+     *
+     * @tparam VectorType The type of the fields, eg. VolumeField<scalar>.
+     * @return The number of prefetched fields.
+     */
+    template<class VectorType>
+    localIdx prefetchAll()
+    {
+        localIdx nPrefetched = 0;
+        for (const auto& id : find(
+                 [](const Document& doc)
+                 {
+                     return doc["field"].type() == typeid(VectorType) && doc.contains("resident")
+                         && !doc.get<bool>("resident");
+                 }
+             ))
+        {
+            fieldDoc(id).prefetch<VectorType>();
+            nPrefetched++;
+        }
+        return nPrefetched;
+    }
 };
 
 
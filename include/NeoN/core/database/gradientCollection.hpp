@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "NeoN/core/database/database.hpp"
+#include "NeoN/core/database/collection.hpp"
+#include "NeoN/core/database/document.hpp"
+#include "NeoN/core/database/fieldCollection.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/**
+ * @class GradientDocument
+ * @brief A document holding the cached gradient of a registered field.
+ *
+ * The gradient is valid for the time, iteration and sub-cycle index of the field at the time
+ * it was computed and the versions of the internal and boundary values of the field and of the
+ * mesh geometry, see Vector::version and UnstructuredMesh::geometryVersion.
+ */
+class GradientDocument
+{
+public:
+
+    GradientDocument(const Document& doc);
+
+    /**
+     * @brief Constructs a GradientDocument with the given gradient and metadata.
+     *
+     * @tparam GradType The type of the gradient.
+     * @param fieldKey The key of the field in its VectorCollection.
+     * @param gradient The gradient of the field.
+     * @param fieldDoc The document of the field providing the indices.
+     * @param versions The versions of the internal and boundary values and of the geometry.
+     */
+    template<class GradType>
+    GradientDocument(
+        std::string fieldKey,
+        const GradType& gradient,
+        const VectorDocument& fieldDoc,
+        std::array<std::size_t, 3> versions
+    )
+        : doc_(Document(
+            {{"fieldKey", fieldKey},
+             {"timeIndex", fieldDoc.timeIndex()},
+             {"iterationIndex", fieldDoc.iterationIndex()},
+             {"subCycleIndex", fieldDoc.subCycleIndex()},
+             {"versions", versions},
+             {"gradient", gradient}}
+        ))
+    {}
+
+    const std::string& fieldKey() const;
+
+    std::int64_t& timeIndex();
+
+    std::int64_t& iterationIndex();
+
+    std::int64_t& subCycleIndex();
+
+    std::array<std::size_t, 3>& versions();
+
+    /**
+     * @brief Checks whether the gradient was computed for the current state of the field.
+     *
+     * @param fieldDoc The document of the field.
+     * @param versions The versions of the internal and boundary values and of the geometry.
+     * @return true if the indices and the versions agree, false otherwise.
+     */
+    bool current(const VectorDocument& fieldDoc, const std::array<std::size_t, 3>& versions) const;
+
+    template<class GradType>
+    GradType& gradient()
+    {
+        return doc_.get<GradType&>("gradient");
+    }
+
+    Document& doc();
+
+    const Document& doc() const;
+
+    std::string id() const;
+
+    static std::string typeName();
+
+private:
+
+    Document doc_;
+};
+
+/**
+ * @class GradientCollection
+ * @brief A collection of the cached gradients of the fields of a VectorCollection.
+ *
+ * Every field has at most one gradient, which is computed once per time, iteration and
+ * sub-cycle index and shared by all schemes requesting it, eg. limited interpolation schemes
+ * and face normal gradient corrections. A modification of the internal or boundary values of
+ * the field or a motion of the mesh in between also triggers a recomputation.
+ */
+class GradientCollection : public CollectionMixin<GradientDocument>
+{
+public:
+
+    GradientCollection(Database& db, std::string name, std::string fieldCollectionName);
+
+    bool contains(const std::string& id) const;
+
+    bool insert(const GradientDocument& gd);
+
+    /**
+     * @brief Finds the gradient document of a field.
+     *
+     * @param fieldKey The key of the field.
+     * @return The id of the gradient document or an empty string if it does not exist.
+     */
+    std::string findGradient(const std::string& fieldKey) const;
+
+    GradientDocument& gradientDoc(const std::string& id);
+
+    const GradientDocument& gradientDoc(const std::string& id) const;
+
+    /**
+     * @brief Returns the cached gradient of a registered field, computes it if it is outdated.
+     *
+     * @tparam VectorType The type of the field.
+     * @tparam Compute A callable returning the gradient of a const VectorType&.
+     * @param field The registered field.
+     * @param compute Computes the gradient of the field.
+     * @return A reference to the gradient, valid until the next recomputation.
+     */
+    template<typename VectorType, typename Compute>
+    auto& getOrCompute(const VectorType& field, Compute compute)
+    {
+        using GradType = std::decay_t<std::invoke_result_t<Compute, const VectorType&>>;
+        const VectorCollection& fieldCollection =
+            VectorCollection::instance(db(), fieldCollectionName_);
+        const VectorDocument& fieldDoc = fieldCollection.fieldDoc(field.key);
+        // the boundary values are part of the gradient, and the geometry changes with movePoints
+        const std::array<std::size_t, 3> versions {
+            field.internalVector().version(),
+            field.boundaryData().value().version(),
+            field.mesh().geometryVersion()
+        };
+
+        std::string id = findGradient(field.key);
+        if (id == "")
+        {
+            GradientDocument gradientDocument(field.key, compute(field), fieldDoc, versions);
+            id = gradientDocument.id();
+            insert(gradientDocument);
+            return gradientDoc(id).gradient<GradType>();
+        }
+        GradientDocument& gradientDocument = gradientDoc(id);
+        if (!gradientDocument.current(fieldDoc, versions))
+        {
+            // the gradient is replaced since fields are not assignable
+            gradientDocument.doc()["gradient"] = compute(field);
+            gradientDocument.timeIndex() = fieldDoc.timeIndex();
+            gradientDocument.iterationIndex() = fieldDoc.iterationIndex();
+            gradientDocument.subCycleIndex() = fieldDoc.subCycleIndex();
+            gradientDocument.versions() = versions;
+        }
+        return gradientDocument.gradient<GradType>();
+    }
+
+    static GradientCollection&
+    instance(Database& db, std::string name, std::string fieldCollectionName);
+
+    static GradientCollection& instance(VectorCollection& fieldCollection);
+
+private:
+
+    std::string fieldCollectionName_;
+};
+
+/**
+ * @brief Retrieves the cached gradient of a registered field.
+ *
+ * The gradient is computed by compute on the first request per time, iteration and sub-cycle
+ * index of the field and reused by all subsequent requests.
+ *
+ * @param field The registered field.
+ * @param compute Computes the gradient of the field.
+ * @return A reference to the gradient.
+ */
+template<typename VectorType, typename Compute>
+auto& cachedGradient(const VectorType& field, Compute compute)
+{
+    validateRegistration(field, "attempting to retrieve the gradient of an unregistered field");
+    // the cache does not modify the field, hence the gradient of a const field can be stored
+    Database& db = const_cast<Database&>(field.db());
+    VectorCollection& fieldCollection = VectorCollection::instance(db, field.fieldCollectionName);
+    GradientCollection& gradientCollection = GradientCollection::instance(fieldCollection);
+    return gradientCollection.getOrCompute(field, compute);
+}
+
+} // namespace NeoN
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "NeoN/core/database/database.hpp"
 #include "NeoN/core/database/collection.hpp"
@@ -120,6 +121,47 @@ public:
         }
     }
 
+    /**
+     * @brief Moves all registered time levels of a field one step back by rotating their data.
+     *
+     * The old levels are not copied, level k + 1 takes over the data of level k and the current
+     * field takes over the data of the oldest level. The names of the fields are kept and the
+     * timeIndex of every level is incremented, so the documents stay consistent.
+     *
+     * @param field The current field, nothing is done if it has no old time field.
+     * @param keepCurrent Copy the values of the new old time field into the current field, e.g.
+     * as initial guess. Without it the current field holds the values of the former oldest level
+     * and has to be overwritten completely.
+     */
+    template<typename VectorType>
+    void rotate(VectorType& field, bool keepCurrent = true)
+    {
+        VectorCollection& fieldCollection = VectorCollection::instance(db(), fieldCollectionName_);
+        std::vector<VectorType*> levels {&field};
+        for (auto id = findNextTime(field.key); id != ""; id = findNextTime(levels.back()->key))
+        {
+            auto& oldDoc = fieldCollection.fieldDoc(oldTimeDoc(id).previousTime());
+            levels.push_back(&oldDoc.field<VectorType>());
+        }
+        for (auto level = levels.size() - 1; level > 0; level--)
+        {
+            levels[level]->internalVector().swap(levels[level - 1]->internalVector());
+            levels[level]->boundaryData().value().swap(
+                levels[level - 1]->boundaryData().value()
+            );
+        }
+        if (keepCurrent && levels.size() > 1)
+        {
+            field.internalVector() = levels[1]->internalVector();
+            field.boundaryData().value() = levels[1]->boundaryData().value();
+        }
+        for (auto* level : levels)
+        {
+            fieldCollection.fieldDoc(level->key).timeIndex()++;
+            fieldCollection.reindex(level->key);
+        }
+    }
+
     static OldTimeCollection&
     instance(Database& db, std::string name, std::string fieldCollectionName);
 
@@ -169,4 +211,51 @@ const VectorType& oldTime(const VectorType& field)
     return oldTimeCollection.get<VectorType>(field.key);
 }
 
+/**
+ * @brief Advances the time levels of a field without copying the old time fields.
+ *
+ * @param field The current field.
+ * @param keepCurrent Whether the current field keeps its values, see OldTimeCollection::rotate.
+ */
+template<typename VectorType>
+void rotateOldTimes(VectorType& field, bool keepCurrent = true)
+{
+    VectorCollection& fieldCollection = VectorCollection::instance(field);
+    OldTimeCollection::instance(fieldCollection).rotate(field, keepCurrent);
+}
+
+/**
+ * @brief A cached reference to the old time field of a field.
+ *
+ * The old time field is looked up in the database on the first access and whenever a different
+ * field is passed, all further accesses are a pointer comparison. The registered fields are
+ * never removed from their collection, hence the cached reference stays valid.
+ */
+template<typename VectorType>
+class OldTimeHandle
+{
+public:
+
+    /**
+     * @brief Retrieves the old time field of the given field, it is registered if required.
+     *
+     * @param field The field to retrieve the old time field from.
+     * @return The old time field.
+     */
+    VectorType& get(VectorType& field)
+    {
+        if (field_ != &field)
+        {
+            oldField_ = &oldTime(field);
+            field_ = &field;
+        }
+        return *oldField_;
+    }
+
+private:
+
+    const VectorType* field_ {nullptr};
+    VectorType* oldField_ {nullptr};
+};
+
 } // namespace NeoN
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/database/database.hpp"
+#include "NeoN/core/database/collection.hpp"
+#include "NeoN/core/database/document.hpp"
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+
+namespace NeoN::la
+{
+
+/**
+ * @class SolverStatsDocument
+ * @brief A document holding the statistics of a single linear solve.
+ *
+ * The solve is identified by the name of the equation, the time and iteration index of the
+ * solution at the time of the solve and a running number, which orders the solves of the run.
+ */
+class SolverStatsDocument
+{
+public:
+
+    SolverStatsDocument(const Document& doc);
+
+    /**
+     * @brief Constructs a SolverStatsDocument from the statistics of a solve.
+     *
+     * @param equation The name of the equation, usually the name of the solution field.
+     * @param timeIndex The time index of the solution.
+     * @param iterationIndex The iteration index of the solution.
+     * @param solveIndex The running number of the solve.
+     * @param stats The statistics returned by the solver.
+     */
+    SolverStatsDocument(
+        std::string equation,
+        std::int64_t timeIndex,
+        std::int64_t iterationIndex,
+        std::size_t solveIndex,
+        const SolverStats& stats
+    );
+
+    const std::string& equation() const;
+
+    std::int64_t timeIndex() const;
+
+    std::int64_t iterationIndex() const;
+
+    std::size_t solveIndex() const;
+
+    /**
+     * @brief Retrieves the statistics of the solve.
+     *
+     * @return SolverStats The statistics including the timings of the phases.
+     */
+    SolverStats stats() const;
+
+    Document& doc();
+
+    const Document& doc() const;
+
+    std::string id() const;
+
+    static std::string typeName();
+
+private:
+
+    Document doc_;
+};
+
+/**
+ * @class SolverStatsCollection
+ * @brief A collection of the statistics of all linear solves of a run.
+ *
+ * The implicit time integrators record every solve of a registered solution, hence the
+ * iterations, residuals and timings can be queried per equation and time step, or written as a
+ * table at the end of the run.
+ */
+class SolverStatsCollection : public CollectionMixin<SolverStatsDocument>
+{
+public:
+
+    SolverStatsCollection(Database& db, std::string name);
+
+    bool contains(const std::string& id) const;
+
+    bool insert(const SolverStatsDocument& doc);
+
+    /**
+     * @brief Records the statistics of a solve.
+     *
+     * @param equation The name of the equation.
+     * @param timeIndex The time index of the solution.
+     * @param iterationIndex The iteration index of the solution.
+     * @param stats The statistics returned by the solver.
+     * @return The id of the inserted document.
+     */
+    std::string record(
+        const std::string& equation,
+        std::int64_t timeIndex,
+        std::int64_t iterationIndex,
+        const SolverStats& stats
+    );
+
+    SolverStatsDocument& statsDoc(const std::string& id);
+
+    const SolverStatsDocument& statsDoc(const std::string& id) const;
+
+    /**
+     * @brief Retrieves the solves of an equation.
+     *
+     * @param equation The name of the equation.
+     * @return The documents of the solves in the order of the solves.
+     */
+    std::vector<SolverStatsDocument> history(const std::string& equation) const;
+
+    /**
+     * @brief Retrieves the solves of an equation in a time step.
+     *
+     * @param equation The name of the equation.
+     * @param timeIndex The time index of the solution.
+     * @return The documents of the solves in the order of the solves.
+     */
+    std::vector<SolverStatsDocument>
+    history(const std::string& equation, std::int64_t timeIndex) const;
+
+    /**
+     * @brief Writes all solves as a comma separated table with a header line.
+     *
+     * @param os The stream to write to.
+     */
+    void write(std::ostream& os) const;
+
+    static SolverStatsCollection& instance(Database& db, std::string name);
+
+    /**
+     * @brief Retrieves the default collection of the database, named solverStats.
+     */
+    static SolverStatsCollection& instance(Database& db);
+
+private:
+
+    std::size_t nSolves_ {0};
+};
+
+/**
+ * @brief Records the statistics of a solve of a field in the solver statistics of its database.
+ *
+ * Solves of unregistered fields are not recorded.
+ *
+ * @param field The solution of the solve.
+ * @param stats The statistics returned by the solver.
+ */
+template<typename VectorType>
+void recordSolverStats(const VectorType& field, const SolverStats& stats)
+{
+    if (!field.registered())
+    {
+        return;
+    }
+    // recording does not modify the field, hence the stats of a const field can be stored
+    Database& db = const_cast<Database&>(field.db());
+    const auto& fieldDoc =
+        finiteVolume::cellCentred::VectorCollection::instance(db, field.fieldCollectionName)
+            .fieldDoc(field.key);
+    SolverStatsCollection::instance(db).record(
+        field.name, fieldDoc.timeIndex(), fieldDoc.iterationIndex(), stats
+    );
+}
+
+} // namespace NeoN
@@ -0,0 +1,363 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "NeoN/core/database/database.hpp"
+#include "NeoN/core/database/collection.hpp"
+#include "NeoN/core/database/document.hpp"
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+KOKKOS_INLINE_FUNCTION
+scalar cmptMin(const scalar& lhs, const scalar& rhs) { return lhs < rhs ? lhs : rhs; }
+
+KOKKOS_INLINE_FUNCTION
+Vec3 cmptMin(const Vec3& lhs, const Vec3& rhs)
+{
+    return {cmptMin(lhs[0], rhs[0]), cmptMin(lhs[1], rhs[1]), cmptMin(lhs[2], rhs[2])};
+}
+
+KOKKOS_INLINE_FUNCTION
+scalar cmptMax(const scalar& lhs, const scalar& rhs) { return lhs < rhs ? rhs : lhs; }
+
+KOKKOS_INLINE_FUNCTION
+Vec3 cmptMax(const Vec3& lhs, const Vec3& rhs)
+{
+    return {cmptMax(lhs[0], rhs[0]), cmptMax(lhs[1], rhs[1]), cmptMax(lhs[2], rhs[2])};
+}
+
+KOKKOS_INLINE_FUNCTION
+scalar cmptSqrt(const scalar& value) { return Kokkos::sqrt(value); }
+
+KOKKOS_INLINE_FUNCTION
+Vec3 cmptSqrt(const Vec3& value)
+{
+    return {Kokkos::sqrt(value[0]), Kokkos::sqrt(value[1]), Kokkos::sqrt(value[2])};
+}
+
+}
+
+/**
+ * @class FieldStatistics
+ * @brief The running mean, variance, minimum and maximum of the cell values of a field.
+ *
+ * The statistics are updated with the algorithm of Welford, ie. the mean and the sum of the
+ * squared deviations from it are updated per sample, which is numerically stable and needs a
+ * single pass over the cells per sample. All statistics are updated in one kernel and without
+ * temporary vectors. The statistics of vector values are computed per component.
+ *
+ * @tparam ValueType The value type of the field.
+ */
+template<typename ValueType>
+class FieldStatistics
+{
+public:
+
+    FieldStatistics(const Executor& exec, localIdx nCells)
+        : mean_(exec, nCells, zero<ValueType>()), m2_(exec, nCells, zero<ValueType>()),
+          min_(exec, nCells, ValueType(std::numeric_limits<scalar>::max())),
+          max_(exec, nCells, ValueType(std::numeric_limits<scalar>::lowest()))
+    {}
+
+    /**
+     * @brief Adds the values as the next sample.
+     *
+     * @param values The cell values of the field.
+     */
+    void add(const Vector<ValueType>& values)
+    {
+        NF_ASSERT_EQUAL(values.size(), mean_.size());
+        nSamples_++;
+        const scalar invN = 1.0 / static_cast<scalar>(nSamples_);
+        const auto valuesV = values.view();
+        auto [mean, m2, min, max] = views(mean_, m2_, min_, max_);
+        parallelFor(
+            values.exec(),
+            {0, values.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const ValueType value = valuesV[celli];
+                const ValueType delta = value - mean[celli];
+                mean[celli] += invN * delta;
+                m2[celli] += cmptMultiply(delta, value - mean[celli]);
+                min[celli] = detail::cmptMin(min[celli], value);
+                max[celli] = detail::cmptMax(max[celli], value);
+            },
+            "accumulateFieldStatistics"
+        );
+    }
+
+    /**
+     * @brief The number of samples.
+     */
+    std::int64_t nSamples() const { return nSamples_; }
+
+    const Vector<ValueType>& mean() const { return mean_; }
+
+    /**
+     * @brief The sum of the squared deviations from the mean, the variance is m2 / nSamples.
+     */
+    const Vector<ValueType>& m2() const { return m2_; }
+
+    const Vector<ValueType>& min() const { return min_; }
+
+    const Vector<ValueType>& max() const { return max_; }
+
+    /**
+     * @brief Computes the root mean square of the fluctuations, sqrt(m2 / nSamples).
+     *
+     * The result is stored in the statistics, hence it can be passed to deferred writers.
+     *
+     * @return The root mean square of the fluctuations.
+     */
+    const Vector<ValueType>& rms()
+    {
+        if (rms_.size() != m2_.size())
+        {
+            rms_ = Vector<ValueType>(m2_.exec(), m2_.size());
+        }
+        const scalar invN = nSamples_ > 0 ? 1.0 / static_cast<scalar>(nSamples_) : 0.0;
+        const auto m2 = m2_.view();
+        auto rms = rms_.view();
+        parallelFor(
+            m2_.exec(),
+            {0, m2_.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                rms[celli] = detail::cmptSqrt(invN * m2[celli]);
+            },
+            "fieldStatisticsRms"
+        );
+        return rms_;
+    }
+
+private:
+
+    std::int64_t nSamples_ {0};
+    Vector<ValueType> mean_;
+    Vector<ValueType> m2_;
+    Vector<ValueType> min_;
+    Vector<ValueType> max_;
+    Vector<ValueType> rms_ {SerialExecutor {}, 0};
+};
+
+/**
+ * @class StatisticsDocument
+ * @brief A document holding the running statistics of a registered field.
+ *
+ * A sample is taken every interval time steps, counted from the time index of the
+ * registration, and at most once per time step, ie. further calls in the iterations of the step
+ * are skipped.
+ */
+class StatisticsDocument
+{
+public:
+
+    StatisticsDocument(const Document& doc);
+
+    /**
+     * @brief Constructs a StatisticsDocument with empty statistics.
+     *
+     * @tparam ValueType The value type of the field.
+     * @param fieldKey The key of the field in its VectorCollection.
+     * @param statistics The empty statistics of the field.
+     * @param startTimeIndex The time index from which the samples are counted.
+     * @param interval The number of time steps between two samples.
+     */
+    template<typename ValueType>
+    StatisticsDocument(
+        std::string fieldKey,
+        const FieldStatistics<ValueType>& statistics,
+        std::int64_t startTimeIndex,
+        std::int64_t interval
+    )
+        : doc_(Document(
+            {{"fieldKey", fieldKey},
+             {"startTimeIndex", startTimeIndex},
+             {"interval", interval},
+             {"sampledTimeIndex", std::numeric_limits<std::int64_t>::min()},
+             {"statistics", statistics}}
+        ))
+    {}
+
+    const std::string& fieldKey() const;
+
+    std::int64_t startTimeIndex() const;
+
+    std::int64_t interval() const;
+
+    /**
+     * @brief The time index of the last sample.
+     */
+    std::int64_t& sampledTimeIndex();
+
+    /**
+     * @brief Checks whether a sample is due at the time index.
+     *
+     * @param timeIndex The time index of the field.
+     * @return true if the time index is on the sampling interval and was not sampled yet.
+     */
+    bool due(std::int64_t timeIndex) const;
+
+    template<typename ValueType>
+    FieldStatistics<ValueType>& statistics()
+    {
+        return doc_.get<FieldStatistics<ValueType>&>("statistics");
+    }
+
+    template<typename ValueType>
+    const FieldStatistics<ValueType>& statistics() const
+    {
+        return doc_.get<const FieldStatistics<ValueType>&>("statistics");
+    }
+
+    Document& doc();
+
+    const Document& doc() const;
+
+    std::string id() const;
+
+    static std::string typeName();
+
+private:
+
+    Document doc_;
+};
+
+/**
+ * @class StatisticsCollection
+ * @brief A collection of the running statistics of the fields of a VectorCollection.
+ *
+ * Every field has at most one document, the statistics are added once per sampled time step
+ * by accumulate and written only at output times, eg. by Adios2Writer::put.
+ */
+class StatisticsCollection : public CollectionMixin<StatisticsDocument>
+{
+public:
+
+    StatisticsCollection(Database& db, std::string name, std::string fieldCollectionName);
+
+    bool contains(const std::string& id) const;
+
+    bool insert(const StatisticsDocument& sd);
+
+    /**
+     * @brief Finds the statistics document of a field.
+     *
+     * @param fieldKey The key of the field.
+     * @return The id of the statistics document or an empty string if it does not exist.
+     */
+    std::string findStatistics(const std::string& fieldKey) const;
+
+    StatisticsDocument& statisticsDoc(const std::string& id);
+
+    const StatisticsDocument& statisticsDoc(const std::string& id) const;
+
+    const std::string& fieldCollectionName() const { return fieldCollectionName_; }
+
+    /**
+     * @brief Starts the statistics of a registered field, existing statistics are kept.
+     *
+     * @param field The registered field.
+     * @param interval The number of time steps between two samples.
+     * @return The id of the statistics document.
+     */
+    template<typename VectorType>
+    std::string registerStatistics(const VectorType& field, std::int64_t interval = 1)
+    {
+        NF_ASSERT(interval > 0, "The sampling interval has to be positive.");
+        using ValueType = typename VectorType::VectorValueType;
+        std::string id = findStatistics(field.key);
+        if (id != "")
+        {
+            return id;
+        }
+        const VectorDocument& fieldDoc =
+            VectorCollection::instance(db(), fieldCollectionName_).fieldDoc(field.key);
+        StatisticsDocument statisticsDocument(
+            field.key,
+            FieldStatistics<ValueType>(field.exec(), field.internalVector().size()),
+            fieldDoc.timeIndex(),
+            interval
+        );
+        id = statisticsDocument.id();
+        insert(statisticsDocument);
+        return id;
+    }
+
+    /**
+     * @brief Adds the current values of a field to its statistics if a sample is due.
+     *
+     * @param field The registered field with registered statistics.
+     * @return true if a sample was taken, false otherwise.
+     */
+    template<typename VectorType>
+    bool accumulate(const VectorType& field)
+    {
+        using ValueType = typename VectorType::VectorValueType;
+        const std::string id = findStatistics(field.key);
+        NF_ASSERT(id != "", "No statistics registered for the field " + field.name);
+        const VectorDocument& fieldDoc =
+            VectorCollection::instance(db(), fieldCollectionName_).fieldDoc(field.key);
+        StatisticsDocument& statisticsDocument = statisticsDoc(id);
+        if (!statisticsDocument.due(fieldDoc.timeIndex()))
+        {
+            return false;
+        }
+        statisticsDocument.statistics<ValueType>().add(field.internalVector());
+        statisticsDocument.sampledTimeIndex() = fieldDoc.timeIndex();
+        return true;
+    }
+
+    static StatisticsCollection&
+    instance(Database& db, std::string name, std::string fieldCollectionName);
+
+    static StatisticsCollection& instance(VectorCollection& fieldCollection);
+
+private:
+
+    std::string fieldCollectionName_;
+};
+
+/**
+ * @brief Retrieves the statistics collection of the field collection of a registered field.
+ */
+template<typename VectorType>
+StatisticsCollection& statisticsCollection(const VectorType& field)
+{
+    validateRegistration(field, "attempting to retrieve the statistics of an unregistered field");
+    // the statistics do not modify the field, hence the statistics of a const field can be stored
+    Database& db = const_cast<Database&>(field.db());
+    VectorCollection& fieldCollection = VectorCollection::instance(db, field.fieldCollectionName);
+    return StatisticsCollection::instance(fieldCollection);
+}
+
+/**
+ * @brief Adds the current values of a registered field to its statistics, which are registered
+ * with the given interval on the first call.
+ *
+ * @param field The registered field.
+ * @param interval The number of time steps between two samples.
+ * @return true if a sample was taken, false otherwise.
+ */
+template<typename VectorType>
+bool accumulateStatistics(const VectorType& field, std::int64_t interval = 1)
+{
+    auto& collection = statisticsCollection(field);
+    collection.registerStatistics(field, interval);
+    return collection.accumulate(field);
+}
+
+} // namespace NeoN
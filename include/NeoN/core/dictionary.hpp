@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <unordered_map>
 #include <any>
+#include <iosfwd>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -30,6 +33,12 @@ void logOutRange(
  * function. It also supports storing sub-dictionaries, which can be accessed
  * using the `subDict` function. The values are stored using `std::any`, which
  * allows storing values of any type.
+ *
+ * Every dictionary carries a version, which changes whenever the dictionary is accessed through
+ * a non-const member. Copies share the version of their source, thus two dictionaries with the
+ * same version hold the same contents and values parsed from one of them can be reused, see
+ * DictionaryBinding. Nested dictionaries modified through the non-const subDict of their parent
+ * change the version of the parent as well.
  */
 class Dictionary
 {
@@ -41,6 +50,14 @@ public:
 
     Dictionary(const std::initializer_list<std::pair<std::string, std::any>>& initList);
 
+    Dictionary(const Dictionary& other) = default;
+
+    Dictionary(Dictionary&& other) noexcept;
+
+    Dictionary& operator=(const Dictionary& other) = default;
+
+    Dictionary& operator=(Dictionary&& other) noexcept;
+
     /**
      * @brief Inserts a key-value pair into the dictionary.
      * @param key The key to insert.
@@ -168,11 +185,49 @@ public:
      */
     bool empty() const { return data_.empty(); }
 
+    /**
+     * @brief Retrieves the version of the contents of the dictionary.
+     *
+     * The version is unique to the contents, a new version is drawn whenever the dictionary is
+     * accessed through a non-const member, even if nothing is modified. References obtained from
+     * non-const members and modified later on are not tracked.
+     *
+     * @return The version, which is never zero.
+     */
+    std::uint64_t version() const { return version_; }
+
 private:
 
+    /** @brief Draws a new version, called by every non-const member. */
+    void touch();
+
     std::unordered_map<std::string, std::any> data_;
+
+    std::uint64_t version_ = nextVersion();
+
+    static std::uint64_t nextVersion();
 };
 
 std::ostream& operator<<(std::ostream& os, const Dictionary& in);
 
+/**
+ * @brief Writes a value of a dictionary or a token list together with its type to a stream.
+ *
+ * Strings, bools, integers, floating point values and dictionaries are written, the latter with
+ * sorted keys, such that equal contents give equal output irrespective of the insertion order.
+ *
+ * @param os The stream to write to.
+ * @param value The value to write.
+ * @return False if the value, or a value nested in it, is of a type which is not written.
+ */
+bool writeContentKey(std::ostream& os, const std::any& value);
+
+/**
+ * @brief Creates a key identifying the contents of a dictionary, eg. to cache objects created
+ * from it.
+ * @param dict The dictionary.
+ * @return The key or nullopt if a value cannot be written, see writeContentKey.
+ */
+std::optional<std::string> contentKey(const Dictionary& dict);
+
 } // namespace NeoN
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/error.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @class DictionaryBinding
+ * @brief A typed value parsed from a dictionary, which is parsed again only after the dictionary
+ * changed.
+ *
+ * Settings read in every time step, eg. schemes or solver settings, are parsed once into a typed
+ * struct and later reads of the same dictionary version return the stored value without any
+ * lookup or any_cast.
+ *
+ * @tparam T The type of the parsed value.
+ */
+template<typename T>
+class DictionaryBinding
+{
+public:
+
+    DictionaryBinding() : value_(), version_(0) {}
+
+    /**
+     * @brief Gets the value parsed from the dictionary, parse is only called if the value was not
+     * parsed from the current version of the dictionary.
+     * @param dict The dictionary.
+     * @param parse A callable creating the value from the dictionary.
+     * @return The parsed value.
+     */
+    template<typename Parse>
+    const T& bind(const Dictionary& dict, Parse&& parse)
+    {
+        if (!bound(dict))
+        {
+            value_.reset();
+            value_.emplace(std::forward<Parse>(parse)(dict));
+            version_ = dict.version();
+        }
+        return *value_;
+    }
+
+    /**
+     * @brief Checks whether the value was parsed from the current version of the dictionary.
+     * @param dict The dictionary.
+     */
+    bool bound(const Dictionary& dict) const { return value_ && version_ == dict.version(); }
+
+    /**
+     * @brief Gets the value parsed by the last call to bind.
+     */
+    const T& value() const
+    {
+        NF_ASSERT(value_, "The binding was not bound to a dictionary.");
+        return *value_;
+    }
+
+    /**
+     * @brief Drops the value, the next call to bind parses the dictionary again.
+     */
+    void reset()
+    {
+        value_.reset();
+        version_ = 0;
+    }
+
+private:
+
+    std::optional<T> value_; //!< The parsed value.
+
+    std::uint64_t version_; //!< The version of the dictionary the value was parsed from.
+};
+
+} // namespace NeoN
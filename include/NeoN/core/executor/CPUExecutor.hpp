@@ -6,6 +6,8 @@
 
 #include <Kokkos_Core.hpp> // IWYU pragma: keep
 
+#include "NeoN/core/executor/memoryPool.hpp"
+
 namespace NeoN
 {
 
@@ -13,6 +15,11 @@ namespace NeoN
  * @class CPUExecutor
  * @brief Executor for handling multicore CPU based parallelization.
  *
+ * The operating system places a page of memory on the NUMA node of the thread which writes it
+ * first. Hence, new allocations are touched in parallel with the static schedule of the kernels,
+ * such that each thread finds the data of its share of the iterations on its own socket. This
+ * requires the threads to be pinned, e.g. with OMP_PROC_BIND=spread and OMP_PLACES=cores for the
+ * OpenMP backend, see the documentation of the executors.
  *
  * @ingroup Executor
  */
@@ -22,26 +29,44 @@ public:
 
     using exec = Kokkos::DefaultHostExecutionSpace;
 
+    using pool = MemoryPool<exec::memory_space>; // shared by executors of the same memory space
+
     CPUExecutor();
+
+    /* @brief creates an executor enqueuing its work on the given execution space instance
+     *
+     * Work enqueued on different instances is not ordered.
+     * Use fence() to wait for the completion of the work of this executor.
+     */
+    explicit CPUExecutor(const exec& instance);
+
     ~CPUExecutor();
 
     template<typename T>
     T* alloc(size_t size) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<exec>("Vector", size * sizeof(T)));
+        return static_cast<T*>(alloc(size * sizeof(T)));
     }
 
     template<typename T>
     T* realloc(void* ptr, size_t newSize) const
     {
-        return static_cast<T*>(Kokkos::kokkos_realloc<exec>(ptr, newSize * sizeof(T)));
+        return static_cast<T*>(pool::instance().reallocate(ptr, newSize * sizeof(T)));
     }
 
-    void* alloc(size_t size) const { return Kokkos::kokkos_malloc<exec>("Vector", size); }
+    void* alloc(size_t size) const
+    {
+        void* ptr = pool::instance().allocate(size);
+        if (firstTouch())
+        {
+            touchPages(ptr, size);
+        }
+        return ptr;
+    }
 
     void* realloc(void* ptr, size_t newSize) const
     {
-        return Kokkos::kokkos_realloc<exec>(ptr, newSize);
+        return pool::instance().reallocate(ptr, newSize);
     }
 
     /** @brief create a Kokkos view for a given ptr
@@ -57,11 +82,34 @@ public:
         return Kokkos::View<ValueType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(ptr, size);
     }
 
-    void free(void* ptr) const noexcept { Kokkos::kokkos_free<exec>(ptr); };
+    void free(void* ptr) const noexcept { pool::instance().deallocate(ptr); };
 
     std::string name() const { return "CPUExecutor"; };
 
-    exec underlyingExec() const { return exec {}; }
+    /* @brief blocks until all work enqueued on the instance of this executor is completed */
+    void fence() const { instance_.fence("NeoN::CPUExecutor::fence"); }
+
+    exec underlyingExec() const { return instance_; }
+
+    /* @brief checks if new allocations are touched in parallel, enabled by default */
+    static bool firstTouch();
+
+    /* @brief enables or disables the parallel first touch of new allocations
+     *
+     * Disabling the first touch saves the page walk of every allocation on single socket
+     * machines. Reallocations keep the placement of the pages of the copied data.
+     */
+    static void setFirstTouch(bool enabled);
+
+    /* @brief writes one byte per page of the memory with the static schedule of the kernels
+     *
+     * The content of the touched bytes is undefined afterwards.
+     */
+    void touchPages(void* ptr, size_t size) const;
+
+private:
+
+    exec instance_;
 };
 
 } // namespace NeoN
@@ -6,6 +6,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "NeoN/core/executor/memoryPool.hpp"
+
 namespace NeoN
 {
 
@@ -21,19 +23,33 @@ public:
 
     using exec = Kokkos::DefaultExecutionSpace;
 
+    using pool = MemoryPool<exec::memory_space>; // shared by executors of the same memory space
+
     GPUExecutor();
+
+    /* @brief creates an executor enqueuing its work on the given execution space instance
+     *
+     * Every CUDA or HIP stream is an instance and the work enqueued on different instances is
+     * not ordered.
+     * Use fence() to wait for the completion of the work of this executor.
+     * Executors of several devices in one process require a Kokkos version which supports
+     * instances with streams of devices other than the device Kokkos was initialized on, see
+     * mpi::selectDevice to select the device of a rank instead.
+     */
+    explicit GPUExecutor(const exec& instance);
+
     ~GPUExecutor();
 
     template<typename T>
     T* alloc(size_t size) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<exec>("Vector", size * sizeof(T)));
+        return static_cast<T*>(pool::instance().allocate(size * sizeof(T)));
     }
 
     template<typename T>
     T* realloc(void* ptr, size_t newSize) const
     {
-        return static_cast<T*>(Kokkos::kokkos_realloc<exec>(ptr, newSize * sizeof(T)));
+        return static_cast<T*>(pool::instance().reallocate(ptr, newSize * sizeof(T)));
     }
 
     /** @brief create a Kokkos view for a given ptr
@@ -51,18 +67,40 @@ public:
         );
     }
 
-    void* alloc(size_t size) const { return Kokkos::kokkos_malloc<exec>("Vector", size); }
+    void* alloc(size_t size) const { return pool::instance().allocate(size); }
 
     void* realloc(void* ptr, size_t newSize) const
     {
-        return Kokkos::kokkos_realloc<exec>(ptr, newSize);
+        return pool::instance().reallocate(ptr, newSize);
     }
 
-    void free(void* ptr) const noexcept { Kokkos::kokkos_free<exec>(ptr); }
+    void free(void* ptr) const noexcept { pool::instance().deallocate(ptr); }
 
     std::string name() const { return "GPUExecutor"; };
 
-    exec underlyingExec() const { return exec {}; }
+    /* @brief enqueues the migration of managed memory to the device, see setManagedDeviceMemory
+     *
+     * Memory which is not managed is ignored.
+     */
+    void prefetch(const void* ptr, size_t bytes) const;
+
+    /* @brief advises that managed memory is mostly read, hence it is duplicated on access
+     *
+     * Memory which is not managed is ignored.
+     */
+    void adviseReadMostly(const void* ptr, size_t bytes) const;
+
+    /* @brief the id of the device of the instance, -1 for a build without a GPU backend */
+    int deviceId() const;
+
+    /* @brief blocks until all work enqueued on the instance of this executor is completed */
+    void fence() const { instance_.fence("NeoN::GPUExecutor::fence"); }
+
+    exec underlyingExec() const { return instance_; }
+
+private:
+
+    exec instance_;
 };
 
 } // namespace NeoN
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
 #include "NeoN/core/executor/serialExecutor.hpp"
 #include "NeoN/core/executor/GPUExecutor.hpp"
@@ -55,4 +58,225 @@ using Executor = std::variant<SerialExecutor, CPUExecutor, GPUExecutor>;
     return !(lhs == rhs);
 };
 
+/**
+ * @brief Blocks until all work enqueued on the execution space instance of the executor is
+ * completed, work enqueued on other instances is not waited for.
+ * @param exec The executor to wait for.
+ */
+inline void fence(const Executor& exec)
+{
+    std::visit([](const auto& e) { e.fence(); }, exec);
+}
+
+/**
+ * @brief Allocates the memory of the SerialExecutor and the CPUExecutor page locked.
+ *
+ * Transfers between page locked memory and a device run asynchronously to the host, see
+ * Vector::copyToExecutorAsync. The setting has no effect unless a device backend is enabled and
+ * it defaults to NeoN_ENABLE_PINNED_HOST_MEMORY. Existing allocations are not affected.
+ * @param pinned Whether new host allocations are page locked.
+ */
+inline void setPinnedHostMemory(bool pinned)
+{
+    // the SerialExecutor and the CPUExecutor share the pool of the host memory space
+    CPUExecutor::pool::instance().setPinned(pinned);
+}
+
+/**
+ * @brief Allocates the memory of the GPUExecutor as managed memory, eg. CUDA unified memory.
+ *
+ * Managed memory can exceed the device memory, its pages are migrated to the device when they
+ * are accessed, which allows to run meshes which do not fit into the device memory. The
+ * migration can be started ahead of the kernels with prefetch and reduced with
+ * adviseReadMostly. The setting has no effect unless a device backend is enabled and it defaults
+ * to NeoN_ENABLE_MANAGED_DEVICE_MEMORY. Existing allocations are not affected.
+ * @param managed Whether new device allocations are managed.
+ */
+inline void setManagedDeviceMemory(bool managed)
+{
+    GPUExecutor::pool::instance().setManaged(managed);
+}
+
+/**
+ * @brief Starts the migration of managed memory to the memory space of the executor.
+ *
+ * The migration is enqueued on the execution space instance of the executor, hence the kernels
+ * enqueued afterwards find the pages resident. It has no effect for host executors and for
+ * memory which is not managed.
+ * @param exec The executor which accesses the memory next.
+ * @param ptr The start of the memory.
+ * @param bytes The size of the memory in bytes.
+ */
+inline void prefetch(const Executor& exec, const void* ptr, std::size_t bytes)
+{
+    if (const auto* gpuExec = std::get_if<GPUExecutor>(&exec))
+    {
+        gpuExec->prefetch(ptr, bytes);
+    }
+}
+
+/**
+ * @brief Advises that managed memory is mostly read, eg. the mesh geometry.
+ *
+ * Read mostly pages are duplicated instead of migrated, hence the host and the device can read
+ * them without faults. It has no effect for host executors and for memory which is not managed.
+ * @param exec The executor of the memory.
+ * @param ptr The start of the memory.
+ * @param bytes The size of the memory in bytes.
+ */
+inline void adviseReadMostly(const Executor& exec, const void* ptr, std::size_t bytes)
+{
+    if (const auto* gpuExec = std::get_if<GPUExecutor>(&exec))
+    {
+        gpuExec->adviseReadMostly(ptr, bytes);
+    }
+}
+
+namespace detail
+{
+
+/**
+ * @brief Calls f with the memory pool of every executor type, pools shared by several executor
+ * types, ie. of the same memory space, are visited once.
+ */
+template<typename Function>
+void forEachMemoryPool(Function f)
+{
+    using SerialSpace = SerialExecutor::exec::memory_space;
+    using CPUSpace = CPUExecutor::exec::memory_space;
+    using GPUSpace = GPUExecutor::exec::memory_space;
+    f(MemoryPool<SerialSpace>::instance());
+    if constexpr (!std::is_same_v<CPUSpace, SerialSpace>)
+    {
+        f(MemoryPool<CPUSpace>::instance());
+    }
+    if constexpr (!std::is_same_v<GPUSpace, SerialSpace> && !std::is_same_v<GPUSpace, CPUSpace>)
+    {
+        f(MemoryPool<GPUSpace>::instance());
+    }
+}
+
+}
+
+/**
+ * @brief Returns the memory held by the live allocations of the executor.
+ *
+ * Executors sharing an execution space, eg. the SerialExecutor and the CPUExecutor of a build
+ * without a parallel host backend, share their usage.
+ * @param exec The executor.
+ */
+inline MemoryUsage memoryUsage(const Executor& exec)
+{
+    return std::visit([](const auto& e) { return memoryPool(e).usage(); }, exec);
+}
+
+/**
+ * @brief Enables or disables the accounting per AllocationLabel for all executors.
+ * @param track Whether new allocations are accounted per label.
+ */
+inline void setTrackAllocationLabels(bool track)
+{
+    detail::forEachMemoryPool([track](auto& pool) { pool.setTrackLabels(track); });
+}
+
+/**
+ * @brief Writes the memory usage of all executors when Kokkos is finalized.
+ * @param report Whether the usage is written.
+ */
+inline void setMemoryReportAtExit(bool report)
+{
+    detail::forEachMemoryPool([report](auto& pool) { pool.setReportAtExit(report); });
+}
+
+/**
+ * @brief Writes the current and peak memory usage of all executors.
+ * @param os The stream to write to.
+ */
+inline void reportMemoryUsage(std::ostream& os)
+{
+    detail::forEachMemoryPool([&os](const auto& pool) { pool.report(os); });
+}
+
+/**
+ * @class CompletionToken
+ * @brief Refers to asynchronous work enqueued on the execution space instance of an executor.
+ *
+ * The results of the work may only be accessed after wait returned. A default constructed token
+ * refers to no work.
+ */
+class CompletionToken
+{
+public:
+
+    CompletionToken() = default;
+
+    /**
+     * @brief Creates a token for the work enqueued on exec so far.
+     * @param exec The executor the work is enqueued on.
+     */
+    explicit CompletionToken(const Executor& exec) : exec_(exec), pending_(true) {}
+
+    /**
+     * @brief Blocks until the work of the token is completed.
+     */
+    void wait()
+    {
+        if (pending_)
+        {
+            fence(exec_);
+            pending_ = false;
+        }
+    }
+
+    /**
+     * @brief Checks if wait needs to be called before the results are accessed.
+     */
+    [[nodiscard]] bool pending() const { return pending_; }
+
+private:
+
+    Executor exec_ {SerialExecutor {}}; /**< The executor the work is enqueued on. */
+    bool pending_ {false};              /**< Whether the work may still be running. */
+};
+
+/**
+ * @brief Creates executors of the same type as exec with independent execution space instances.
+ *
+ * The work enqueued on the returned executors is not ordered with respect to each other, eg.
+ * every GPUExecutor enqueues on its own stream. Hence, independent work like the assembly of two
+ * equations can overlap on the device. Since all executors of the same type share the memory
+ * space, they compare equal and their containers can be mixed, but the work enqueued on one
+ * executor needs to be completed by fence before it is used on another one or destroyed.
+ * The SerialExecutor executes synchronously, thus copies of exec are returned.
+ * @param exec The executor to partition.
+ * @param nInstances The number of executors to create.
+ * @return nInstances executors with independent execution space instances.
+ */
+[[nodiscard]] inline std::vector<Executor> partition(const Executor& exec, size_t nInstances)
+{
+    return std::visit(
+        [nInstances]<typename ExecType>(const ExecType& e)
+        {
+            std::vector<Executor> execs;
+            execs.reserve(nInstances);
+            if constexpr (std::is_same_v<ExecType, SerialExecutor>)
+            {
+                execs.assign(nInstances, e);
+            }
+            else
+            {
+                auto instances = Kokkos::Experimental::partition_space(
+                    e.underlyingExec(), std::vector<int>(nInstances, 1)
+                );
+                for (const auto& instance : instances)
+                {
+                    execs.emplace_back(ExecType(instance));
+                }
+            }
+            return execs;
+        },
+        exec
+    );
+}
+
 } // namespace NeoN
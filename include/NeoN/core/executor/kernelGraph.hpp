@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "NeoN/core/executor/executor.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @class KernelGraph
+ * @brief Records the kernels enqueued by a callable once and replays them.
+ *
+ * On a GPUExecutor with CUDA the kernels enqueued on the instance of the executor are captured
+ * into a CUDA graph. A replay launches the whole sequence at once, which removes the launch
+ * latency of the individual kernels and the host overhead of the callable. All other executors
+ * call the recorded callable again on replay.
+ *
+ * Since the graph stores the kernel arguments, a replay is only valid as long as these do not
+ * change, ie. the addresses and sizes of all containers and scalar arguments such as the time
+ * step size. The temporaries released during the capture are retained by the graph until it is
+ * destroyed. The callable must not synchronize with the host, eg. by fences, by reductions into
+ * host values or by copies on the default instance.
+ *
+ * @ingroup Executor
+ */
+class KernelGraph
+{
+public:
+
+    /**
+     * @brief Create an empty graph for the given executor.
+     * @param exec The executor the kernels are enqueued on, a GPUExecutor needs its own stream,
+     * see partition.
+     */
+    KernelGraph(const Executor& exec);
+
+    KernelGraph(const KernelGraph&) = delete;
+
+    KernelGraph& operator=(const KernelGraph&) = delete;
+
+    ~KernelGraph();
+
+    /**
+     * @brief Record the kernels of work and execute them once.
+     * @param work The callable enqueuing the kernels, it is stored for executors without graph
+     * support.
+     */
+    void capture(std::function<void()> work);
+
+    /**
+     * @brief Execute the recorded kernels again.
+     */
+    void replay();
+
+    /**
+     * @brief Drop the recorded kernels and release the retained temporaries.
+     */
+    void reset();
+
+    /**
+     * @brief Check if kernels were recorded.
+     */
+    [[nodiscard]] bool captured() const { return captured_; }
+
+    /**
+     * @brief Check if the replay launches a device graph instead of calling the callable.
+     */
+    [[nodiscard]] bool isDeviceGraph() const;
+
+    [[nodiscard]] const Executor& exec() const { return exec_; }
+
+private:
+
+    Executor exec_;
+
+    std::function<void()> work_;
+
+    bool captured_ {false};
+
+    std::vector<void*> retained_; /**< Temporaries accessed by the recorded kernels. */
+
+#ifdef KOKKOS_ENABLE_CUDA
+    cudaGraph_t graph_ {nullptr};
+
+    cudaGraphExec_t graphExec_ {nullptr};
+#endif
+};
+
+} // namespace NeoN
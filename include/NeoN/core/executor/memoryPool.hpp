@@ -0,0 +1,723 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp> // IWYU pragma: keep
+
+namespace NeoN
+{
+
+namespace detail
+{
+
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+/** @brief Page locked host memory, which allows asynchronous transfers from and to devices. */
+using HostPinnedSpace = Kokkos::SharedHostPinnedSpace;
+#else
+using HostPinnedSpace = Kokkos::HostSpace;
+#endif
+
+#ifdef KOKKOS_HAS_SHARED_SPACE
+/** @brief Memory migrated between host and device on demand, eg. CUDA or HIP managed memory. */
+using DeviceManagedSpace = Kokkos::SharedSpace;
+#else
+using DeviceManagedSpace = Kokkos::HostSpace;
+#endif
+
+/** @brief The label of new allocations of the calling thread, see AllocationLabel. */
+inline thread_local std::string allocationLabel = "Vector";
+
+}
+
+/**
+ * @class AllocationLabel
+ * @brief Labels the allocations of the calling thread for the lifetime of the object.
+ *
+ * The label is passed to kokkos_malloc, hence it shows up in the memory tools of Kokkos, and the
+ * pools account the usage per label if setTrackLabels is enabled. Labels nest with the scopes,
+ * allocations outside of any scope are labelled "Vector". Blocks reused from the cache of a pool
+ * keep the label of their first allocation in the Kokkos tools.
+ */
+class AllocationLabel
+{
+public:
+
+    /**
+     * @brief Sets the label of new allocations.
+     * @param label The label, eg. the name of a field or of a temporary.
+     */
+    explicit AllocationLabel(std::string label)
+        : previous_(std::exchange(detail::allocationLabel, std::move(label)))
+    {}
+
+    AllocationLabel(const AllocationLabel&) = delete;
+
+    AllocationLabel& operator=(const AllocationLabel&) = delete;
+
+    /**
+     * @brief Restores the previous label.
+     */
+    ~AllocationLabel() { detail::allocationLabel = std::move(previous_); }
+
+private:
+
+    std::string previous_;
+};
+
+/**
+ * @brief The memory held by the live allocations of an execution space or of a label.
+ */
+struct MemoryUsage
+{
+    std::size_t bytes {0};       /**< Requested bytes of the live allocations. */
+    std::size_t peakBytes {0};   /**< Maximum of bytes since the last reset. */
+    std::size_t allocations {0}; /**< Number of live allocations. */
+};
+
+/**
+ * @brief Statistics of a memory pool.
+ */
+struct MemoryPoolStatistics
+{
+    std::size_t hits {0};           /**< Allocations served from a cached block. */
+    std::size_t misses {0};         /**< Allocations that required a new allocation. */
+    std::size_t bytesInUse {0};     /**< Bytes currently handed out by the pool. */
+    std::size_t peakBytesInUse {0}; /**< Maximum of bytesInUse since the last reset. */
+    std::size_t bytesCached {0};    /**< Bytes held in the free lists of the pool. */
+};
+
+/**
+ * @class MemoryPool
+ * @brief A caching allocator for a memory space.
+ *
+ * Allocations are rounded up to power of two size classes. Freed blocks are kept in a free list
+ * per size class and handed out again by later allocations of the same class, which avoids the
+ * cost of kokkos_malloc/kokkos_free for short lived temporaries. The executors sharing a memory
+ * space share its pool, eg. the SerialExecutor and the CPUExecutor share the pool of the
+ * HostSpace, thus blocks freed by one are reused by the other. Host kernels are completed when
+ * they return, on devices the reuse is stream ordered, if all kernels of an execution space are
+ * enqueued on its default instance. Executors created by partition enqueue on other instances,
+ * thus their work must be completed with fence before the containers used by it are destroyed.
+ *
+ * The pool is disabled unless NeoN is configured with NeoN_ENABLE_MEMORY_POOL, it can be toggled
+ * at runtime with setEnabled. Blocks allocated while the pool was enabled are returned to the
+ * pool, all other pointers are passed on to kokkos_free. The setting is read before the lock of
+ * the pool is taken, a disabled pool allocates and frees without holding the lock and only
+ * accounts the usage under it.
+ *
+ * The pools of host execution spaces can allocate page locked memory, see setPinned, if a device
+ * backend is enabled. Transfers between pinned memory and the device do not stage through a
+ * bounce buffer and can run asynchronously to the host. Pinned blocks are tracked by the pool,
+ * hence they are freed correctly regardless of the setting at deallocation.
+ *
+ * Likewise, the pools of device execution spaces can allocate managed memory, see setManaged,
+ * which can exceed the device memory, since its pages are migrated on demand.
+ *
+ * @tparam MemorySpace The Kokkos memory space, eg. the memory_space of an execution space.
+ */
+template<typename MemorySpace>
+class MemoryPool
+{
+public:
+
+    /** @brief The smallest block size handed out by the pool. */
+    static constexpr std::size_t minBlockSize = 256;
+
+    /**
+     * @brief Returns the pool of the memory space.
+     */
+    static MemoryPool& instance()
+    {
+        static MemoryPool pool;
+        return pool;
+    }
+
+    MemoryPool(const MemoryPool&) = delete;
+
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /**
+     * @brief Check if new allocations are served by the pool.
+     */
+    bool enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Enable or disable the pool, disabling releases all cached blocks.
+     * @param enabled Whether new allocations are served by the pool.
+     */
+    void setEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        enabled_.store(enabled, std::memory_order_release);
+        if (!enabled) releaseImpl();
+    }
+
+    /**
+     * @brief Check if pinned memory can be allocated, ie. the space is a host memory space and a
+     * device backend is enabled.
+     */
+    static constexpr bool supportsPinned()
+    {
+        return hostAccessible && !std::is_same_v<detail::HostPinnedSpace, Kokkos::HostSpace>;
+    }
+
+    /**
+     * @brief Check if new allocations are page locked.
+     */
+    bool pinned() const { return pinned_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Allocate new blocks in page locked memory, releases all cached blocks.
+     * @param pinned Whether new allocations are page locked, ignored if not supportsPinned.
+     */
+    void setPinned(bool pinned)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pinned_.store(pinned && supportsPinned(), std::memory_order_release);
+        releaseImpl();
+    }
+
+    /**
+     * @brief Check if managed memory can be allocated, ie. the space is a device memory space and
+     * a shared memory space is available.
+     */
+    static constexpr bool supportsManaged()
+    {
+        return !hostAccessible && !std::is_same_v<detail::DeviceManagedSpace, Kokkos::HostSpace>;
+    }
+
+    /**
+     * @brief Check if new allocations are managed.
+     */
+    bool managed() const { return managed_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Allocate new blocks in managed memory, releases all cached blocks.
+     * @param managed Whether new allocations are managed, ignored if not supportsManaged.
+     */
+    void setManaged(bool managed)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        managed_.store(managed && supportsManaged(), std::memory_order_release);
+        releaseImpl();
+    }
+
+    /**
+     * @brief Allocate a block of at least size bytes.
+     * @param size The requested size in bytes.
+     */
+    void* allocate(std::size_t size)
+    {
+        if (!enabled())
+        {
+            const auto kind = newBlockKind();
+            void* ptr = mallocBlock(size, kind);
+            std::lock_guard<std::mutex> lock(mutex_);
+            registerBlock(ptr, size, kind);
+            track(ptr, size);
+            return ptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        void* ptr = takeBlock(size);
+        track(ptr, size);
+        return ptr;
+    }
+
+    /**
+     * @brief Resize a block, the content is preserved up to the smaller of both sizes.
+     * @param ptr The block to resize, allocated by this pool or by kokkos_malloc.
+     * @param newSize The requested size in bytes.
+     */
+    void* reallocate(void* ptr, std::size_t newSize)
+    {
+        if (ptr == nullptr) return allocate(newSize);
+        std::size_t oldBlockSize = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = inUse_.find(ptr);
+            auto pinnedIt = pinnedBlocks_.find(ptr);
+            auto managedIt = managedBlocks_.find(ptr);
+            if (it != inUse_.end())
+            {
+                oldBlockSize = std::size_t(1) << it->second;
+                if (enabled() && newSize <= oldBlockSize)
+                {
+                    untrack(ptr);
+                    track(ptr, newSize);
+                    return ptr;
+                }
+            }
+            else if (pinnedIt != pinnedBlocks_.end())
+            {
+                oldBlockSize = pinnedIt->second;
+            }
+            else if (managedIt != managedBlocks_.end())
+            {
+                oldBlockSize = managedIt->second;
+            }
+            else
+            {
+                untrack(ptr);
+                void* newPtr = Kokkos::kokkos_realloc<MemorySpace>(ptr, newSize);
+                track(newPtr, newSize);
+                return newPtr;
+            }
+        }
+        void* newPtr = allocate(newSize);
+        using CharView = Kokkos::View<char*, MemorySpace, Kokkos::MemoryUnmanaged>;
+        const std::size_t copySize = std::min(oldBlockSize, newSize);
+        Kokkos::deep_copy(
+            CharView(static_cast<char*>(newPtr), copySize),
+            CharView(static_cast<char*>(ptr), copySize)
+        );
+        deallocate(ptr);
+        return newPtr;
+    }
+
+    /**
+     * @brief Return a block to the pool or free it, if it was not allocated by the pool.
+     * @param ptr The block to free.
+     */
+    void deallocate(void* ptr) noexcept
+    {
+        if (ptr == nullptr) return;
+        BlockKind kind = BlockKind::Default;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (retaining_)
+            {
+                retained_.push_back(ptr);
+                return;
+            }
+            untrack(ptr);
+            auto it = inUse_.find(ptr);
+            if (it != inUse_.end())
+            {
+                const std::size_t sizeClass = it->second;
+                const std::size_t blockSize = std::size_t(1) << sizeClass;
+                inUse_.erase(it);
+                stats_.bytesInUse -= blockSize;
+                // blocks allocated before the last setPinned or setManaged are not cached
+                if (enabled() && blockKind(ptr) == newBlockKind())
+                {
+                    freeLists_[sizeClass].push_back(ptr);
+                    stats_.bytesCached += blockSize;
+                    return;
+                }
+            }
+            kind = unregisterBlock(ptr);
+        }
+        freeBlock(ptr, kind);
+    }
+
+    /**
+     * @brief Keep all blocks deallocated from now on alive until endRetain is called.
+     *
+     * This is used while recording kernels for a later replay, eg. by a KernelGraph, since the
+     * recorded kernels still access the temporaries released during the recording.
+     */
+    void beginRetain()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        retaining_ = true;
+    }
+
+    /**
+     * @brief Stop retaining deallocated blocks.
+     * @return The blocks deallocated since beginRetain, they need to be passed to deallocate
+     * once they are no longer accessed.
+     */
+    std::vector<void*> endRetain()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        retaining_ = false;
+        return std::exchange(retained_, {});
+    }
+
+    /**
+     * @brief Free all cached blocks, blocks in use are not affected.
+     */
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        releaseImpl();
+    }
+
+    /**
+     * @brief Returns the statistics of the pool.
+     */
+    MemoryPoolStatistics statistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    /**
+     * @brief Reset the hit and miss counters and the peak usage.
+     */
+    void resetStatistics()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.hits = 0;
+        stats_.misses = 0;
+        stats_.peakBytesInUse = stats_.bytesInUse;
+        usage_.peakBytes = usage_.bytes;
+        for (auto& [label, usage] : labelUsage_)
+        {
+            usage.peakBytes = usage.bytes;
+        }
+    }
+
+    /**
+     * @brief Returns the memory held by the live allocations of the execution space.
+     *
+     * Unlike the statistics, the usage counts the requested bytes of all allocations, regardless
+     * of whether the pool is enabled, and excludes the cached blocks.
+     */
+    MemoryUsage usage() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return usage_;
+    }
+
+    /**
+     * @brief Returns the usage per allocation label, see AllocationLabel and setTrackLabels.
+     */
+    std::vector<std::pair<std::string, MemoryUsage>> usageByLabel() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::pair<std::string, MemoryUsage>> result(
+            labelUsage_.begin(), labelUsage_.end()
+        );
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](const auto& a, const auto& b) { return a.second.peakBytes > b.second.peakBytes; }
+        );
+        return result;
+    }
+
+    /**
+     * @brief Check if the usage is accounted per allocation label, disabled by default.
+     */
+    bool trackLabels() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return trackLabels_;
+    }
+
+    /**
+     * @brief Enable or disable the accounting per label, which costs a label lookup per call.
+     * @param track Whether new allocations are accounted per label.
+     */
+    void setTrackLabels(bool track)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        trackLabels_ = track;
+    }
+
+    /**
+     * @brief Write the usage to the standard output when Kokkos is finalized.
+     * @param report Whether the usage is written.
+     */
+    void setReportAtExit(bool report)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reportAtExit_ = report;
+    }
+
+    /**
+     * @brief Writes the current and peak usage of the execution space and of its labels.
+     */
+    void report(std::ostream& os) const
+    {
+        const auto total = usage();
+        const auto line = [&](const std::string& name, const MemoryUsage& u)
+        {
+            char buffer[128];
+            std::snprintf(
+                buffer,
+                sizeof(buffer),
+                "  %-32s %12.3f %12.3f %10zu\n",
+                name.c_str(),
+                static_cast<double>(u.bytes) / (1024.0 * 1024.0),
+                static_cast<double>(u.peakBytes) / (1024.0 * 1024.0),
+                u.allocations
+            );
+            os << buffer;
+        };
+        os << "Memory usage of " << MemorySpace::name() << " [MiB]: current, peak, allocations\n";
+        line("total", total);
+        for (const auto& [label, u] : usageByLabel())
+        {
+            line(label, u);
+        }
+    }
+
+private:
+
+    /** @brief A live allocation. */
+    struct Allocation
+    {
+        std::size_t bytes; /**< The requested size. */
+        std::string label; /**< The label, empty unless labels are tracked. */
+    };
+
+    /** @brief The memory a block is allocated in. */
+    enum class BlockKind
+    {
+        Default, /**< The memory space. */
+        Pinned,  /**< Page locked host memory. */
+        Managed  /**< Managed device memory. */
+    };
+
+    static constexpr bool hostAccessible =
+        Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible;
+
+    static constexpr std::size_t nSizeClasses = 8 * sizeof(std::size_t);
+
+    mutable std::mutex mutex_; /**< Guards all members except the atomic settings. */
+    std::atomic<bool> enabled_ {NF_WITH_MEMORY_POOL != 0};   /**< Whether the pool is active. */
+    std::array<std::vector<void*>, nSizeClasses> freeLists_; /**< Cached blocks per class. */
+    std::unordered_map<void*, std::size_t> inUse_; /**< Size class of blocks handed out. */
+    MemoryPoolStatistics stats_;                   /**< The usage statistics. */
+    bool retaining_ {false};                       /**< Whether deallocations are retained. */
+    std::vector<void*> retained_;                  /**< Blocks deallocated while retaining. */
+    /** @brief Whether new blocks are page locked. */
+    std::atomic<bool> pinned_ {NF_WITH_PINNED_HOST_MEMORY != 0 && supportsPinned()};
+    std::unordered_map<void*, std::size_t> pinnedBlocks_; /**< Size of the pinned blocks. */
+    /** @brief Whether new blocks are managed. */
+    std::atomic<bool> managed_ {NF_WITH_MANAGED_DEVICE_MEMORY != 0 && supportsManaged()};
+    std::unordered_map<void*, std::size_t> managedBlocks_; /**< Size of the managed blocks. */
+    std::unordered_map<void*, Allocation> live_;           /**< The live allocations. */
+    MemoryUsage usage_;                                    /**< Usage of all allocations. */
+    std::unordered_map<std::string, MemoryUsage> labelUsage_; /**< Usage per label. */
+    bool trackLabels_ {false};  /**< Whether the usage is accounted per label. */
+    bool reportAtExit_ {false}; /**< Whether the usage is written at finalize. */
+
+    MemoryPool()
+    {
+        // cached blocks must be returned before the memory spaces are torn down
+        Kokkos::push_finalize_hook(
+            []()
+            {
+                auto& pool = MemoryPool::instance();
+                if (pool.reportAtExit_)
+                {
+                    pool.report(std::cout);
+                }
+                pool.release();
+            }
+        );
+    }
+
+    /**
+     * @brief Hands out a cached block or allocates a new one, requires the lock.
+     */
+    void* takeBlock(std::size_t size)
+    {
+        const std::size_t sizeClass = sizeClassOf(size);
+        const std::size_t blockSize = std::size_t(1) << sizeClass;
+        void* ptr = nullptr;
+        auto& freeList = freeLists_[sizeClass];
+        if (!freeList.empty())
+        {
+            ptr = freeList.back();
+            freeList.pop_back();
+            stats_.bytesCached -= blockSize;
+            stats_.hits++;
+        }
+        else
+        {
+            const auto kind = newBlockKind();
+            ptr = mallocBlock(blockSize, kind);
+            registerBlock(ptr, blockSize, kind);
+            stats_.misses++;
+        }
+        inUse_.emplace(ptr, sizeClass);
+        stats_.bytesInUse += blockSize;
+        stats_.peakBytesInUse = std::max(stats_.peakBytesInUse, stats_.bytesInUse);
+        return ptr;
+    }
+
+    /**
+     * @brief Accounts a new allocation, requires the lock.
+     */
+    void track(void* ptr, std::size_t size)
+    {
+        const auto add = [size](MemoryUsage& u)
+        {
+            u.bytes += size;
+            u.peakBytes = std::max(u.peakBytes, u.bytes);
+            u.allocations++;
+        };
+        add(usage_);
+        if (trackLabels_)
+        {
+            add(labelUsage_[detail::allocationLabel]);
+            live_.insert_or_assign(ptr, Allocation {size, detail::allocationLabel});
+        }
+        else
+        {
+            live_.insert_or_assign(ptr, Allocation {size, std::string {}});
+        }
+    }
+
+    /**
+     * @brief Removes an allocation from the accounting, requires the lock.
+     */
+    void untrack(void* ptr) noexcept
+    {
+        auto it = live_.find(ptr);
+        if (it == live_.end()) return;
+        const auto remove = [bytes = it->second.bytes](MemoryUsage& u)
+        {
+            u.bytes -= bytes;
+            u.allocations--;
+        };
+        remove(usage_);
+        if (!it->second.label.empty())
+        {
+            auto labelIt = labelUsage_.find(it->second.label);
+            if (labelIt != labelUsage_.end()) remove(labelIt->second);
+        }
+        live_.erase(it);
+    }
+
+    /**
+     * @brief The memory of new blocks, see setPinned and setManaged.
+     */
+    BlockKind newBlockKind() const
+    {
+        if (managed()) return BlockKind::Managed;
+        if (pinned()) return BlockKind::Pinned;
+        return BlockKind::Default;
+    }
+
+    /**
+     * @brief The memory of a block allocated by this pool, requires the lock.
+     */
+    BlockKind blockKind(void* ptr) const
+    {
+        if (managedBlocks_.contains(ptr)) return BlockKind::Managed;
+        if (pinnedBlocks_.contains(ptr)) return BlockKind::Pinned;
+        return BlockKind::Default;
+    }
+
+    /**
+     * @brief Records the memory of a pinned or managed block, requires the lock.
+     */
+    void registerBlock(void* ptr, std::size_t size, BlockKind kind)
+    {
+        if (kind == BlockKind::Managed) managedBlocks_.emplace(ptr, size);
+        if (kind == BlockKind::Pinned) pinnedBlocks_.emplace(ptr, size);
+    }
+
+    /**
+     * @brief Removes the record of registerBlock, requires the lock.
+     * @return The memory of the block.
+     */
+    BlockKind unregisterBlock(void* ptr) noexcept
+    {
+        if (managedBlocks_.erase(ptr) != 0) return BlockKind::Managed;
+        if (pinnedBlocks_.erase(ptr) != 0) return BlockKind::Pinned;
+        return BlockKind::Default;
+    }
+
+    /**
+     * @brief Allocates a block in the memory space or in pinned or managed memory.
+     */
+    static void* mallocBlock(std::size_t size, BlockKind kind)
+    {
+        if constexpr (supportsManaged())
+        {
+            if (kind == BlockKind::Managed)
+            {
+                return Kokkos::kokkos_malloc<detail::DeviceManagedSpace>(
+                    detail::allocationLabel, size
+                );
+            }
+        }
+        if constexpr (supportsPinned())
+        {
+            if (kind == BlockKind::Pinned)
+            {
+                return Kokkos::kokkos_malloc<detail::HostPinnedSpace>(
+                    detail::allocationLabel, size
+                );
+            }
+        }
+        return Kokkos::kokkos_malloc<MemorySpace>(detail::allocationLabel, size);
+    }
+
+    /**
+     * @brief Frees a block allocated by mallocBlock or kokkos_malloc.
+     */
+    static void freeBlock(void* ptr, BlockKind kind) noexcept
+    {
+        if constexpr (supportsManaged())
+        {
+            if (kind == BlockKind::Managed)
+            {
+                Kokkos::kokkos_free<detail::DeviceManagedSpace>(ptr);
+                return;
+            }
+        }
+        if constexpr (supportsPinned())
+        {
+            if (kind == BlockKind::Pinned)
+            {
+                Kokkos::kokkos_free<detail::HostPinnedSpace>(ptr);
+                return;
+            }
+        }
+        Kokkos::kokkos_free<MemorySpace>(ptr);
+    }
+
+    static std::size_t sizeClassOf(std::size_t size)
+    {
+        return static_cast<std::size_t>(std::bit_width(std::max(size, minBlockSize) - 1));
+    }
+
+    void releaseImpl()
+    {
+        for (auto& freeList : freeLists_)
+        {
+            for (void* ptr : freeList)
+            {
+                freeBlock(ptr, unregisterBlock(ptr));
+            }
+            freeList.clear();
+        }
+        stats_.bytesCached = 0;
+    }
+};
+
+/**
+ * @brief Returns the memory pool of an executor, ie. of the memory space of its execution space.
+ * @tparam Exec The executor type, e.g. CPUExecutor.
+ */
+template<typename Exec>
+MemoryPool<typename Exec::exec::memory_space>& memoryPool(const Exec&)
+{
+    return MemoryPool<typename Exec::exec::memory_space>::instance();
+}
+
+} // namespace NeoN
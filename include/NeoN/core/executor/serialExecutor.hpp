@@ -6,6 +6,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "NeoN/core/executor/memoryPool.hpp"
+
 namespace NeoN
 {
 
@@ -21,19 +23,29 @@ public:
 
     using exec = Kokkos::Serial;
 
+    using pool = MemoryPool<exec::memory_space>; // shared by executors of the same memory space
+
     SerialExecutor();
+
+    /* @brief creates an executor enqueuing its work on the given execution space instance
+     *
+     * Work enqueued on different instances is not ordered.
+     * Use fence() to wait for the completion of the work of this executor.
+     */
+    explicit SerialExecutor(const exec& instance);
+
     ~SerialExecutor();
 
     template<typename T>
     T* alloc(size_t size) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<exec>("Vector", size * sizeof(T)));
+        return static_cast<T*>(pool::instance().allocate(size * sizeof(T)));
     }
 
     template<typename T>
     T* realloc(void* ptr, size_t newSize) const
     {
-        return static_cast<T*>(Kokkos::kokkos_realloc<exec>(ptr, newSize * sizeof(T)));
+        return static_cast<T*>(pool::instance().reallocate(ptr, newSize * sizeof(T)));
     }
 
     /** @brief create a Kokkos view for a given ptr
@@ -49,18 +61,25 @@ public:
         return Kokkos::View<ValueType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(ptr, size);
     }
 
-    void* alloc(size_t size) const { return Kokkos::kokkos_malloc<exec>("Vector", size); }
+    void* alloc(size_t size) const { return pool::instance().allocate(size); }
 
     void* realloc(void* ptr, size_t newSize) const
     {
-        return Kokkos::kokkos_realloc<exec>(ptr, newSize);
+        return pool::instance().reallocate(ptr, newSize);
     }
 
-    void free(void* ptr) const noexcept { Kokkos::kokkos_free<exec>(ptr); };
+    void free(void* ptr) const noexcept { pool::instance().deallocate(ptr); };
 
     std::string name() const { return "SerialExecutor"; };
 
-    exec underlyingExec() const { return exec {}; }
+    /* @brief blocks until all work enqueued on the instance of this executor is completed */
+    void fence() const { instance_.fence("NeoN::SerialExecutor::fence"); }
+
+    exec underlyingExec() const { return instance_; }
+
+private:
+
+    exec instance_;
 };
 
 } // namespace NeoN
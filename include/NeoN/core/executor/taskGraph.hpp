@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "NeoN/core/executor/executor.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @brief The containers a task reads and writes, identified by their address.
+ *
+ * Any object can be a resource, eg. a Vector, a field or an Expression, as long as all tasks
+ * refer to it through the same object.
+ */
+struct TaskAccess
+{
+    std::vector<const void*> reads;  /**< The resources read by the task. */
+    std::vector<const void*> writes; /**< The resources written by the task. */
+};
+
+/**
+ * @brief Collects the addresses of the given objects as a read or write set of a task.
+ * @param objects The objects accessed by the task.
+ * @return The addresses of the objects.
+ */
+template<typename... Resources>
+std::vector<const void*> resources(const Resources&... objects)
+{
+    return {static_cast<const void*>(&objects)...};
+}
+
+/**
+ * @class TaskGraph
+ * @brief Executes tasks with declared read and write sets concurrently on partitioned executors.
+ *
+ * A task depends on the previous tasks writing a resource it reads or writes and on the previous
+ * tasks reading a resource it writes, the resulting graph is executed level by level, where the
+ * tasks of a level are independent of each other. The tasks of a level are distributed round
+ * robin over the execution space instances of partition, unless a task requests an instance, and
+ * the instances are fenced before the next level starts.
+ *
+ * A task receives the executor of its instance, kernels enqueued on it overlap with the kernels
+ * of other instances, eg. on separate streams of a GPUExecutor. Kernels enqueued on containers
+ * of another executor, which includes the solution of dsl::solve, run on the instance of that
+ * executor, hence such containers should be created on the executor returned by instance. Since
+ * the kernels of a CPUExecutor run synchronously, the instances of a CPUExecutor are driven by
+ * one host thread each, and their tasks need to be thread safe apart from their declared
+ * resources. The tasks of a SerialExecutor run one after the other.
+ *
+ * @ingroup Executor
+ */
+class TaskGraph
+{
+public:
+
+    using TaskId = std::size_t;
+
+    using Work = std::function<void(const Executor&)>;
+
+    /**
+     * @brief Create an empty graph executing on nInstances partitions of exec.
+     * @param exec The executor to partition.
+     * @param nInstances The number of concurrent execution space instances.
+     */
+    TaskGraph(const Executor& exec, std::size_t nInstances);
+
+    /**
+     * @brief Add a task to the graph, the dependencies follow from the previously added tasks.
+     * @param name The name of the task, used for the timer of the task.
+     * @param access The resources read and written by the task.
+     * @param work The callable executed with the executor of the assigned instance.
+     * @return The id of the task.
+     */
+    TaskId submit(std::string name, TaskAccess access, Work work);
+
+    /**
+     * @brief Add a task to the graph running on the given instance.
+     * @param name The name of the task, used for the timer of the task.
+     * @param access The resources read and written by the task.
+     * @param instance The index of the instance, see instance.
+     * @param work The callable executed with the executor of the instance.
+     * @return The id of the task.
+     */
+    TaskId submit(std::string name, TaskAccess access, std::size_t instance, Work work);
+
+    /**
+     * @brief Execute all tasks and wait for their completion, the graph is cleared afterwards.
+     */
+    void run();
+
+    /**
+     * @brief Remove all tasks without executing them.
+     */
+    void clear();
+
+    /**
+     * @brief Get the tasks the given task depends on directly.
+     * @param task The id of the task.
+     * @return The ids of the dependencies in ascending order.
+     */
+    [[nodiscard]] const std::vector<TaskId>& dependencies(TaskId task) const;
+
+    /**
+     * @brief Get the level of the given task, ie. the length of the longest dependency chain.
+     * @param task The id of the task.
+     * @return The level, zero for tasks without dependencies.
+     */
+    [[nodiscard]] std::size_t level(TaskId task) const;
+
+    /**
+     * @brief Get the executor of an instance, containers accessed by the tasks of the instance
+     * should be allocated on it.
+     * @param i The index of the instance.
+     * @return The executor of the instance.
+     */
+    [[nodiscard]] const Executor& instance(std::size_t i) const;
+
+    [[nodiscard]] std::size_t nInstances() const { return instances_.size(); }
+
+    [[nodiscard]] std::size_t nTasks() const { return tasks_.size(); }
+
+private:
+
+    /**
+     * @brief A submitted task.
+     */
+    struct Task
+    {
+        std::string name;                 /**< The name of the task. */
+        Work work;                        /**< The callable of the task. */
+        std::size_t instance;             /**< The index of the instance. */
+        std::size_t level;                /**< The level of the task in the graph. */
+        std::vector<TaskId> dependencies; /**< The direct dependencies of the task. */
+    };
+
+    /**
+     * @brief The tasks accessing a resource since its last write.
+     */
+    struct ResourceState
+    {
+        bool written {false};        /**< Whether a task has written the resource. */
+        TaskId writer {0};           /**< The last task writing the resource. */
+        std::vector<TaskId> readers; /**< The tasks reading the resource after the last write. */
+    };
+
+    std::vector<Executor> instances_;    /**< The partitioned executors. */
+    std::vector<Task> tasks_;            /**< The tasks in submission order. */
+    std::vector<std::size_t> levelSize_; /**< The number of tasks per level. */
+    std::unordered_map<const void*, ResourceState>
+        resources_; /**< The accesses per resource. */
+
+    /**
+     * @brief Execute the tasks of one level.
+     * @param level The tasks of the level.
+     */
+    void runLevel(const std::vector<TaskId>& level);
+
+    /**
+     * @brief Execute the tasks of one instance in order.
+     * @param level The tasks of the level.
+     * @param instance The index of the instance.
+     */
+    void runInstance(const std::vector<TaskId>& level, std::size_t instance);
+};
+
+} // namespace NeoN
@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "NeoN/core/primitives/label.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @struct MemoryEntry
+ * @brief The bytes allocated by one object of a MemoryReport.
+ */
+struct MemoryEntry
+{
+    std::string category; //!< The category of the object, eg. "mesh geometry" or "fields".
+    std::string name;     //!< The name of the object within its category.
+    std::size_t bytes;    //!< The allocated bytes of the object.
+};
+
+/**
+ * @class MemoryReport
+ * @brief Collects the memory footprint of the objects of a simulation by category.
+ *
+ * The objects add the bytes of their containers, ie. the sizes of the allocations and not the
+ * capacity of host containers or the bookkeeping of the allocator. The report lists the bytes of
+ * every category, the bytes per cell and the share of the total, which shows how many cells fit
+ * into the memory of a device and which data dominates the footprint.
+ */
+class MemoryReport
+{
+public:
+
+    /**
+     * @brief Creates an empty report.
+     * @param nCells The number of cells the bytes per cell refer to.
+     */
+    explicit MemoryReport(localIdx nCells = 0) : nCells_(nCells) {}
+
+    /**
+     * @brief Adds the bytes of an object, the bytes of objects with the same category and name
+     * are accumulated.
+     * @param category The category of the object.
+     * @param name The name of the object.
+     * @param bytes The allocated bytes.
+     */
+    void add(const std::string& category, const std::string& name, std::size_t bytes);
+
+    /**
+     * @brief Gets the objects in the order they were added.
+     */
+    const std::vector<MemoryEntry>& entries() const { return entries_; }
+
+    /**
+     * @brief Gets the categories in the order they were first added.
+     */
+    std::vector<std::string> categories() const;
+
+    /**
+     * @brief Gets the bytes of all objects.
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Gets the bytes of the objects of a category.
+     * @param category The category.
+     */
+    std::size_t bytes(const std::string& category) const;
+
+    /**
+     * @brief Gets the number of cells the bytes per cell refer to.
+     */
+    localIdx nCells() const { return nCells_; }
+
+    /**
+     * @brief Writes the bytes per category, per cell and the share of the total.
+     * @param os The stream to write to.
+     * @param listEntries Whether the objects of every category are listed below it.
+     */
+    void print(std::ostream& os = std::cout, bool listEntries = false) const;
+
+private:
+
+    localIdx nCells_;                  //!< The number of cells.
+    std::vector<MemoryEntry> entries_; //!< The objects in insertion order.
+};
+
+/**
+ * @brief A type able to compute its own footprint.
+ */
+template<typename T>
+concept MeasuresMemory = requires(const T& value) {
+    { value.memoryBytes() } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief A type adding its parts to a report itself, eg. a cache with objects of different
+ * categories.
+ */
+template<typename T>
+concept ReportsMemory = requires(const T& value, MemoryReport& report, const std::string& name) {
+    value.reportMemory(report, name);
+};
+
+template<typename T>
+std::size_t memoryBytes(const T& value);
+
+template<typename T>
+std::size_t memoryBytes(const std::vector<T>& values);
+
+template<typename T>
+std::size_t memoryBytes(const std::optional<T>& value);
+
+template<typename T>
+std::size_t memoryBytes(const std::shared_ptr<T>& value);
+
+template<typename T>
+std::size_t memoryBytes(const std::unique_ptr<T>& value);
+
+/**
+ * @brief Gets the bytes allocated by an object.
+ *
+ * Types satisfying MeasuresMemory are asked for their footprint, other trivially copyable types
+ * account for their size and all remaining types for zero bytes.
+ */
+template<typename T>
+std::size_t memoryBytes(const T& value)
+{
+    if constexpr (MeasuresMemory<T>)
+    {
+        return static_cast<std::size_t>(value.memoryBytes());
+    }
+    else if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        return sizeof(T);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief Gets the bytes allocated by the elements of a host vector.
+ */
+template<typename T>
+std::size_t memoryBytes(const std::vector<T>& values)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        return values.size() * sizeof(T);
+    }
+    else
+    {
+        std::size_t bytes = 0;
+        for (const auto& value : values)
+        {
+            bytes += sizeof(T) + memoryBytes(value);
+        }
+        return bytes;
+    }
+}
+
+/**
+ * @brief Gets the bytes of the value if it is set.
+ */
+template<typename T>
+std::size_t memoryBytes(const std::optional<T>& value)
+{
+    return value ? memoryBytes(*value) : 0;
+}
+
+/**
+ * @brief Gets the bytes of the object pointed to, the object is accounted by every owner.
+ */
+template<typename T>
+std::size_t memoryBytes(const std::shared_ptr<T>& value)
+{
+    return value ? memoryBytes(*value) : 0;
+}
+
+/**
+ * @brief Gets the bytes of the object pointed to.
+ */
+template<typename T>
+std::size_t memoryBytes(const std::unique_ptr<T>& value)
+{
+    return value ? memoryBytes(*value) : 0;
+}
+
+/**
+ * @brief Adds an object to a report.
+ *
+ * Types satisfying ReportsMemory add their parts themselves, all other types are added as one
+ * object of the given category with their memoryBytes.
+ *
+ * @param report The report to add to.
+ * @param category The category of the object.
+ * @param name The name of the object.
+ * @param value The object.
+ */
+template<typename T>
+void reportMemory(
+    MemoryReport& report, const std::string& category, const std::string& name, const T& value
+)
+{
+    if constexpr (ReportsMemory<T>)
+    {
+        value.reportMemory(report, name);
+    }
+    else
+    {
+        report.add(category, name, memoryBytes(value));
+    }
+}
+
+} // namespace NeoN
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <iosfwd>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/mpi/environment.hpp"
+
+namespace NeoN
+{
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+namespace mpi
+{
+
+/**
+ * @enum DeviceMapping
+ * @brief How the ranks of a compute node are mapped onto its GPUs.
+ */
+enum class DeviceMapping
+{
+    roundRobin, /*< Node rank i uses device i modulo the number of devices. */
+    block       /*< Consecutive node ranks share a device, see deviceId. */
+};
+
+/**
+ * @struct DeviceAssignment
+ * @brief The GPU selected for this rank and the node topology it was selected from.
+ */
+struct DeviceAssignment
+{
+    int nodeRank {0}; /*< The rank of this rank on its node. */
+    int nodeSize {1}; /*< The number of ranks on the node. */
+    int nDevices {0}; /*< The number of GPUs visible to this rank. */
+    int deviceId {-1}; /*< The selected GPU, -1 if no GPU is visible. */
+};
+
+/**
+ * @brief Maps a node rank onto a device.
+ *
+ * The block mapping assigns the node ranks in contiguous blocks of nodeSize / nDevices ranks per
+ * device. Launchers place consecutive ranks on the same socket and the GPUs are enumerated by
+ * socket on common nodes, hence a rank is mapped onto a device attached to its NUMA domain.
+ *
+ * @param nodeRank The rank on the node.
+ * @param nodeSize The number of ranks on the node.
+ * @param nDevices The number of devices of the node.
+ * @param mapping The mapping.
+ * @return The device id, -1 if there are no devices.
+ */
+int deviceId(int nodeRank, int nodeSize, int nDevices, DeviceMapping mapping);
+
+/**
+ * @brief The number of GPUs visible to this process, 0 for a build without a GPU backend.
+ *
+ * The devices are queried from the runtime of the backend, hence the function can be called
+ * before Kokkos is initialized.
+ */
+int nVisibleDevices();
+
+/**
+ * @brief Selects the GPU of this rank from its rank on the compute node, this is a collective
+ * operation.
+ *
+ * The selection has to be passed to Kokkos::initialize, see initializationSettings, since the
+ * device of a process can not be changed afterwards.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param mapping How the node ranks are mapped onto the devices.
+ * @return The selected device and the node topology.
+ */
+DeviceAssignment
+selectDevice(const MPIEnvironment& mpiEnviron, DeviceMapping mapping = DeviceMapping::roundRobin);
+
+/**
+ * @brief The Kokkos settings which initialize Kokkos on the selected device.
+ *
+ * @param assignment The device assignment of this rank.
+ * @return The settings, without a device id if there is no device.
+ */
+Kokkos::InitializationSettings initializationSettings(const DeviceAssignment& assignment);
+
+/**
+ * @brief Writes the host, the node rank and the device of every rank to out on rank 0, this is
+ * a collective operation.
+ *
+ * Ranks sharing a device are marked, this is valid but the kernels of the ranks are serialised
+ * on the device unless a multi-process service is running.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param assignment The device assignment of this rank.
+ * @param out The stream written on rank 0.
+ */
+void reportDevices(
+    const MPIEnvironment& mpiEnviron, const DeviceAssignment& assignment, std::ostream& out
+);
+
+} // namespace mpi
+
+#endif
+
+} // namespace NeoN
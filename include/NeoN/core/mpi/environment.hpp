@@ -10,6 +10,7 @@
 
 #include "NeoN/core/error.hpp"
 #include "NeoN/core/info.hpp"
+#include "NeoN/core/timer.hpp"
 
 
 namespace NeoN
@@ -46,9 +47,15 @@ struct MPIInit
     }
 
     /**
-     * @brief Destroy the MPIInit object.
+     * @brief Destroy the MPIInit object, the timer report and trace are written before MPI is
+     * finalized.
      */
-    ~MPIInit() { MPI_Finalize(); }
+    ~MPIInit()
+    {
+        TimerRegistry::instance().finalize();
+        TraceRecorder::instance().finalize();
+        MPI_Finalize();
+    }
 };
 
 
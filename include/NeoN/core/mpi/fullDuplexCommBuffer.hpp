@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 
 #include "NeoN/core/mpi/environment.hpp"
 #include "NeoN/core/mpi/halfDuplexCommBuffer.hpp"
+#include "NeoN/core/mpi/neighbourhood.hpp"
+#include "NeoN/core/mpi/nccl.hpp"
+#include "NeoN/core/mpi/sharedMemory.hpp"
 #include "NeoN/core/view.hpp"
 
 namespace NeoN
@@ -26,6 +31,12 @@ namespace mpi
  * The FullDuplexCommBuffer class facilitates efficient, non-blocking, point-to-point data
  * exchange between MPI ranks, allowing for simultaneous send and receive operations. It
  * manages two HalfDuplexCommBuffer instances: one for sending data and one for receiving data.
+ * If a neighbourhood topology is set, the exchange is a single neighbourhood collective over the
+ * topology instead of point-to-point messages, persistent requests are not used in that case.
+ * Otherwise, if a shared memory node is set, the messages between the ranks of a node are
+ * exchanged through a SharedMemoryWindow, which is allocated on the first exchange. With an
+ * NCCL communicator and device resident buffers the exchange is enqueued on the stream of the GPU
+ * executor instead, it then completes in stream order and is not waited for on the host.
  */
 class FullDuplexCommBuffer
 {
@@ -49,12 +60,126 @@ public:
     )
         : send_(mpiEnviron, sendSize), receive_(mpiEnviron, receiveSize) {};
 
+    /**
+     * @brief Set the MPI environment of the send and receive buffers.
+     * @param mpiEnviron The MPI environment.
+     */
+    inline void setMPIEnvironment(MPIEnvironment mpiEnviron)
+    {
+        send_.setMPIEnvironment(mpiEnviron);
+        receive_.setMPIEnvironment(mpiEnviron);
+    }
+
+    /**
+     * @brief Size the send and receive buffers for the given value type.
+     * @tparam valueType The type of the data to be stored in the buffers.
+     * @param sendSize The number of nodes, per rank, that this rank sends to.
+     * @param receiveSize The number of nodes, per rank, that this rank receives from.
+     */
+    template<typename valueType>
+    void setCommRankSize(std::vector<std::size_t> sendSize, std::vector<std::size_t> receiveSize)
+    {
+        send_.setCommRankSize<valueType>(sendSize);
+        receive_.setCommRankSize<valueType>(receiveSize);
+    }
+
     /**
      * @brief Check if the communication buffers are initialized.
      * @return True if the buffers are initialized, false otherwise.
      */
     inline bool isCommInit() const { return send_.isCommInit() && receive_.isCommInit(); }
 
+    /**
+     * @brief Get the executor on which the buffers are allocated.
+     * @return The executor of the buffers.
+     */
+    inline const Executor& exec() const { return send_.exec(); }
+
+    /**
+     * @brief Get the send buffer, eg. to query its neighbours and message sizes.
+     * @return The send buffer.
+     */
+    inline const HalfDuplexCommBuffer& sendBuffer() const { return send_; }
+
+    /**
+     * @brief Get the receive buffer, eg. to query its neighbours and message sizes.
+     * @return The receive buffer.
+     */
+    inline const HalfDuplexCommBuffer& receiveBuffer() const { return receive_; }
+
+    /**
+     * @brief Move the send and receive buffer memory to the given executor.
+     * @param exec The executor on which the buffers are allocated.
+     */
+    inline void setExecutor(const Executor& exec)
+    {
+        send_.setExecutor(exec);
+        receive_.setExecutor(exec);
+    }
+
+    /**
+     * @brief Enable or disable persistent MPI requests for the send and receive buffers.
+     * @param persistent Whether persistent requests are used.
+     */
+    inline void setPersistent(bool persistent)
+    {
+        send_.setPersistent(persistent);
+        receive_.setPersistent(persistent);
+    }
+
+    /**
+     * @brief Set the neighbourhood topology used for the exchange.
+     * @param topology The topology, or nullptr for point-to-point messages.
+     */
+    inline void setTopology(const NeighbourhoodTopology* topology)
+    {
+        NF_DEBUG_ASSERT(!isCommInit(), "Communication buffer is initialised.");
+        topology_ = topology;
+    }
+
+    /**
+     * @brief Set the node whose ranks exchange their messages through shared memory.
+     * @param node The ranks of this node, or nullptr for MPI messages only.
+     * @param entryBytes The slot size per message entry, see SharedMemoryWindow.
+     */
+    inline void setSharedMemory(const SharedMemoryNode* node, std::size_t entryBytes)
+    {
+        NF_DEBUG_ASSERT(!isCommInit(), "Communication buffer is initialised.");
+        node_ = node;
+        entryBytes_ = entryBytes;
+    }
+
+#ifdef NF_WITH_NCCL
+    /**
+     * @brief Set the NCCL communicator used for the exchange of device resident buffers.
+     * @param nccl The NCCL communicator, or nullptr for MPI messages.
+     * @param exec The executor of the exchanged field, whose stream orders the exchange.
+     */
+    inline void setNccl(const NcclCommunicator* nccl, const Executor& exec)
+    {
+        NF_DEBUG_ASSERT(!isCommInit(), "Communication buffer is initialised.");
+        const bool device = std::holds_alternative<GPUExecutor>(exec)
+                         && std::holds_alternative<GPUExecutor>(this->exec());
+        nccl_ = device ? nccl : nullptr;
+        ncclExec_.reset();
+        if (nccl_) ncclExec_ = std::get<GPUExecutor>(exec);
+    }
+#endif
+
+    /**
+     * @brief Check if the exchange is ordered with the kernels of the exchanged field, in which
+     * case the send buffer needs no fence before startComm and the exchange is not waited for.
+     * @return True if the exchange is enqueued on the stream of the field, false otherwise.
+     */
+    inline bool isStreamOrdered() const
+    {
+#ifdef NF_WITH_NCCL
+        return nccl_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
     /**
      * @brief Initialize the communication buffer.
      * @tparam valueType The type of the data to be stored in the buffer.
@@ -67,6 +192,28 @@ public:
         receive_.initComm<valueType>(commName);
     }
 
+    /**
+     * @brief Gets a View of data for the send buffer of all ranks.
+     * @tparam valueType The type of the data.
+     * @return A view of data for the send buffer.
+     */
+    template<typename valueType>
+    View<valueType> getSend()
+    {
+        return send_.get<valueType>();
+    }
+
+    /**
+     * @brief Gets a View of data for the receive buffer of all ranks.
+     * @tparam valueType The type of the data.
+     * @return A view of data for the receive buffer.
+     */
+    template<typename valueType>
+    View<valueType> getReceive()
+    {
+        return receive_.get<valueType>();
+    }
+
     /**
      * @brief Gets a View of data for the send buffer for a specific rank.
      * @tparam valueType The type of the data.
@@ -120,6 +267,33 @@ public:
      */
     inline void startComm()
     {
+#ifdef NF_WITH_NCCL
+        if (nccl_)
+        {
+            nccl_->startExchange(send_, receive_, *ncclExec_);
+            return;
+        }
+#endif
+        if (topology_)
+        {
+            topology_->startExchange(send_, receive_, exchange_);
+            return;
+        }
+        if (node_)
+        {
+            // collective on the node, thus created by the first exchange of all node ranks
+            if (!window_)
+            {
+                window_ =
+                    std::make_unique<SharedMemoryWindow>(*node_, send_, receive_, entryBytes_);
+            }
+            window_->startExchange(send_, receive_);
+        }
+        else
+        {
+            send_.setSharedRanks({});
+            receive_.setSharedRanks({});
+        }
         send_.send();
         receive_.receive();
     }
@@ -128,15 +302,34 @@ public:
      * @brief Check if the communication is complete.
      * @return True if the communication is complete, false otherwise.
      */
-    inline bool isComplete() { return send_.isComplete() && receive_.isComplete(); }
+    inline bool isComplete()
+    {
+        if (isStreamOrdered()) return true; // completes before the following kernels
+        if (topology_) return test(&exchange_.request);
+        const bool shared = !node_ || window_->testExchange(receive_);
+        return send_.isComplete() && receive_.isComplete() && shared;
+    }
 
     /**
      * @brief Blocking wait for the communication to complete.
      */
     inline void waitComplete()
     {
+        if (isStreamOrdered()) return;
+        if (topology_)
+        {
+            while (!isComplete())
+            {
+                // wait for the communication to finish.
+            }
+            return;
+        }
         send_.waitComplete();
         receive_.waitComplete();
+        while (node_ && !window_->testExchange(receive_))
+        {
+            // wait for the node-local messages to arrive.
+        }
     }
 
     /**
@@ -152,6 +345,15 @@ private:
 
     HalfDuplexCommBuffer send_;    /**< The send buffer. */
     HalfDuplexCommBuffer receive_; /**< The receive buffer. */
+    const NeighbourhoodTopology* topology_ {nullptr}; /**< The topology of the collective. */
+    NeighbourhoodExchange exchange_; /**< The state of the neighbourhood collective. */
+    const SharedMemoryNode* node_ {nullptr}; /**< The ranks exchanging through shared memory. */
+    std::size_t entryBytes_ {0};              /**< The slot size per message entry. */
+    std::unique_ptr<SharedMemoryWindow> window_; /**< The window of the node-local messages. */
+#ifdef NF_WITH_NCCL
+    const NcclCommunicator* nccl_ {nullptr}; /**< The NCCL communicator of the exchange. */
+    std::optional<GPUExecutor> ncclExec_;    /**< The executor whose stream orders the exchange. */
+#endif
 };
 
 } // namespace mpi
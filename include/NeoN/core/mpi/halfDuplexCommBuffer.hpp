@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "NeoN/core/error.hpp"
+#include "NeoN/core/executor/executor.hpp"
 #include "NeoN/core/mpi/environment.hpp"
 #include "NeoN/core/mpi/operators.hpp"
 #include "NeoN/core/view.hpp"
@@ -45,7 +46,12 @@ inline int bufferHash(const std::string& str)
  * between MPI ranks in a distributed system. It maintains a buffer used for data communication,
  * capable of handling various data types. The buffer does not shrink once initialized, minimizing
  * memory reallocation and improving memory efficiency. The class operates in a half-duplex mode,
- * meaning it is either sending or receiving data at any given time.
+ * meaning it is either sending or receiving data at any given time. The buffer memory is allocated
+ * on an executor, which allows device resident buffers to be handed to a GPU-aware MPI. In
+ * persistent mode the MPI requests are created once and restarted for every exchange, they are
+ * only recreated if the tag, the buffer memory or the rank layout changes. Only the neighbour
+ * ranks, i.e. ranks with a non-empty message, are visited per exchange. Ranks marked as
+ * shared exchange their message through a SharedMemoryWindow instead and are skipped.
  */
 class HalfDuplexCommBuffer
 {
@@ -58,9 +64,17 @@ public:
     HalfDuplexCommBuffer() = default;
 
     /**
-     * @brief Default destructor
+     * @brief Destructor, releases the buffer memory.
      */
-    ~HalfDuplexCommBuffer() = default;
+    ~HalfDuplexCommBuffer();
+
+    HalfDuplexCommBuffer(const HalfDuplexCommBuffer&) = delete;
+
+    HalfDuplexCommBuffer& operator=(const HalfDuplexCommBuffer&) = delete;
+
+    HalfDuplexCommBuffer(HalfDuplexCommBuffer&& other) noexcept;
+
+    HalfDuplexCommBuffer& operator=(HalfDuplexCommBuffer&& other) noexcept;
 
     /**
      * @brief Construct a new Half Duplex Buffer object
@@ -81,6 +95,49 @@ public:
      */
     inline void setMPIEnvironment(MPIEnvironment mpiEnviron) { mpiEnviron_ = mpiEnviron; }
 
+    /**
+     * @brief Get the executor on which the buffer memory is allocated.
+     *
+     * @return const Executor& The executor of the buffer.
+     */
+    inline const Executor& exec() const { return exec_; }
+
+    /**
+     * @brief Move the buffer memory to the given executor, the content is not preserved.
+     *
+     * @param exec The executor on which the buffer is allocated.
+     */
+    void setExecutor(const Executor& exec);
+
+    /**
+     * @brief Check if persistent MPI requests are used.
+     *
+     * @return true if persistent requests are used else false.
+     */
+    inline bool isPersistent() const { return persistent_; }
+
+    /**
+     * @brief Enable or disable persistent MPI requests.
+     *
+     * @param persistent Whether persistent requests are used.
+     */
+    void setPersistent(bool persistent);
+
+    /**
+     * @brief Set the ranks whose message is exchanged through shared memory, which are skipped by
+     * send and receive.
+     *
+     * @param shared Per rank, whether the message is shared, or empty if no message is shared.
+     */
+    inline void setSharedRanks(const std::vector<bool>& shared) { shared_ = shared; }
+
+    /**
+     * @brief Get the size (in bytes) of the value type currently stored in the buffer.
+     *
+     * @return std::size_t The value type size.
+     */
+    inline std::size_t typeSize() const { return typeSize_; }
+
     /**
      * @brief Get the communication name.
      *
@@ -106,7 +163,6 @@ public:
         );
         typeSize_ = sizeof(valueType);
         rankOffset_.resize(rankCommSize.size() + 1);
-        request_.resize(rankCommSize.size(), MPI_REQUEST_NULL);
         updateDataSize([&](const size_t rank) { return rankCommSize[rank]; }, sizeof(valueType));
     }
 
@@ -161,6 +217,45 @@ public:
      */
     void finaliseComm();
 
+    /**
+     * @brief Get the ranks with a non-empty message in ascending order.
+     *
+     * @return const std::vector<std::size_t>& The neighbour ranks.
+     */
+    inline const std::vector<std::size_t>& neighbours() const { return neighbours_; }
+
+    /**
+     * @brief Get the offsets (in bytes) of the rank data in the buffer, the last entry is the
+     * total size.
+     *
+     * @return const std::vector<std::size_t>& The rank offsets.
+     */
+    inline const std::vector<std::size_t>& rankOffsets() const { return rankOffset_; }
+
+    /**
+     * @brief Get the raw buffer memory.
+     *
+     * @return char* The buffer memory of all ranks.
+     */
+    inline char* data() { return rankBuffer_; }
+
+    /**
+     * @brief Get a View of the buffer data of all ranks, the data of consecutive ranks is stored
+     * contiguously.
+     *
+     * @tparam valueType The type of the data to be stored in the buffer.
+     * @return View<valueType> A View of the data for all ranks.
+     */
+    template<typename valueType>
+    View<valueType> get()
+    {
+        NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
+        NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
+        return View<valueType>(
+            reinterpret_cast<valueType*>(rankBuffer_), rankOffset_.back() / sizeof(valueType)
+        );
+    }
+
     /**
      * @brief Get a View of the buffer data for a given rank.
      *
@@ -174,7 +269,7 @@ public:
         NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
         NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
         return View<valueType>(
-            reinterpret_cast<valueType*>(rankBuffer_.data() + rankOffset_[rank]),
+            reinterpret_cast<valueType*>(rankBuffer_ + rankOffset_[rank]),
             (rankOffset_[rank + 1] - rankOffset_[rank]) / sizeof(valueType)
         );
     }
@@ -192,7 +287,7 @@ public:
         NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
         NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
         return View<const valueType>(
-            reinterpret_cast<const valueType*>(rankBuffer_.data() + rankOffset_[rank]),
+            reinterpret_cast<const valueType*>(rankBuffer_ + rankOffset_[rank]),
             (rankOffset_[rank + 1] - rankOffset_[rank]) / sizeof(valueType)
         );
     }
@@ -203,10 +298,45 @@ private:
     std::string commName_ {"unassigned"}; /*< The name of the communication. */
     std::size_t typeSize_ {sizeof(char)}; /*< The data type currently stored in the buffer. */
     MPIEnvironment mpiEnviron_;           /*< The MPI environment. */
-    std::vector<MPI_Request> request_;    /*< The MPI request for communication with each rank. */
-    std::vector<char> rankBuffer_;        /*< The buffer data for all ranks. Never shrinks. */
+    std::vector<MPI_Request> request_;    /*< The MPI request for each neighbour rank. */
+    std::vector<std::size_t> neighbours_; /*< The ranks with a non-empty message. */
+    Executor exec_ {SerialExecutor {}};   /*< The executor owning the buffer memory. */
+    char* rankBuffer_ {nullptr};          /*< The buffer data for all ranks. Never shrinks. */
+    std::size_t capacity_ {0};            /*< The allocated size (in bytes) of the buffer. */
     std::vector<std::size_t>
         rankOffset_; /*< The offset (in bytes) for a rank data in the buffer. */
+    bool persistent_ {false}; /*< Whether persistent requests are used. */
+    std::vector<MPI_Request>
+        persistentRequest_; /*< The persistent requests of all ranks with data to exchange. */
+    std::vector<std::size_t>
+        persistentOffset_;           /*< The rank offsets the persistent requests were bound to. */
+    char* persistentBuffer_ {nullptr}; /*< The buffer the persistent requests were bound to. */
+    int persistentTag_ {-1};           /*< The tag the persistent requests were bound to. */
+    bool persistentSend_ {false};      /*< Whether the persistent requests send or receive. */
+    std::vector<bool> persistentShared_; /*< The shared ranks the requests were bound to. */
+    std::vector<bool> shared_; /*< Per rank, whether the message is exchanged in shared memory. */
+
+    /**
+     * @brief Check if the message of a rank is exchanged through shared memory.
+     */
+    bool isShared(std::size_t rank) const { return !shared_.empty() && shared_[rank]; }
+
+    /**
+     * @brief Get the requests of the current mode.
+     */
+    std::vector<MPI_Request>& requests() { return persistent_ ? persistentRequest_ : request_; }
+
+    /**
+     * @brief Start the persistent requests, recreating them if the buffer layout has changed.
+     *
+     * @param send Whether to send or to receive.
+     */
+    void startPersistent(bool send);
+
+    /**
+     * @brief Release all persistent requests.
+     */
+    void freePersistent();
 
     /**
      * @brief Set the data type for the buffer.
@@ -238,14 +368,24 @@ private:
     void updateDataSize(func rankSize, std::size_t newSize)
     {
         std::size_t dataSize = 0;
+        neighbours_.clear();
         for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
         {
             rankOffset_[rank] = dataSize;
             dataSize += rankSize(rank) * newSize;
+            if (dataSize != rankOffset_[rank]) neighbours_.push_back(rank);
         }
         rankOffset_.back() = dataSize;
-        if (rankBuffer_.size() < dataSize) rankBuffer_.resize(dataSize); // we never size down.
+        request_.assign(neighbours_.size(), MPI_REQUEST_NULL);
+        if (capacity_ < dataSize) reserve(dataSize); // we never size down.
     }
+
+    /**
+     * @brief Grow the buffer memory to the given size (in bytes), the content is preserved.
+     *
+     * @param dataSize The new size of the buffer.
+     */
+    void reserve(std::size_t dataSize);
 };
 
 } // namespace mpi
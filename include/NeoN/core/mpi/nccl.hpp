@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/executor/GPUExecutor.hpp"
+#include "NeoN/core/mpi/environment.hpp"
+#include "NeoN/core/mpi/halfDuplexCommBuffer.hpp"
+
+#if defined(NF_WITH_MPI_SUPPORT) && defined(NF_WITH_NCCL)
+
+struct ncclComm; // the communicator handle of NCCL, ncclComm_t
+
+namespace NeoN
+{
+
+namespace mpi
+{
+
+/**
+ * @class NcclCommunicator
+ * @brief An NCCL communicator spanning the ranks of an MPI environment, one device per rank.
+ *
+ * A halo exchange over NCCL is a group of ncclSend and ncclRecv calls, one per neighbour rank,
+ * that is enqueued on the stream of the GPU executor of the exchanged field. The exchange is
+ * thus ordered with the pack kernel before and the unpack kernel after it and requires no host
+ * synchronisation. The send and receive buffers have to be device resident. Since the groups
+ * of the ranks are matched in order, the exchanges have to be started in the same order on all
+ * ranks.
+ */
+class NcclCommunicator
+{
+public:
+
+    /**
+     * @brief Creates the NCCL communicator, this is a collective operation.
+     * @param mpiEnviron The MPI environment, whose rank 0 broadcasts the NCCL unique id.
+     */
+    NcclCommunicator(const MPIEnvironment& mpiEnviron);
+
+    /**
+     * @brief Destructor, releases the NCCL communicator.
+     */
+    ~NcclCommunicator();
+
+    NcclCommunicator(const NcclCommunicator&) = delete;
+
+    NcclCommunicator& operator=(const NcclCommunicator&) = delete;
+
+    /**
+     * @brief Enqueues the exchange of the rank data of send into receive.
+     * @param send The device resident send buffer.
+     * @param receive The device resident receive buffer.
+     * @param exec The executor whose stream orders the exchange.
+     */
+    void startExchange(
+        HalfDuplexCommBuffer& send, HalfDuplexCommBuffer& receive, const GPUExecutor& exec
+    ) const;
+
+private:
+
+    ncclComm* comm_ {nullptr}; /*< The NCCL communicator. */
+};
+
+} // namespace mpi
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/mpi/environment.hpp"
+#include "NeoN/core/mpi/halfDuplexCommBuffer.hpp"
+
+namespace NeoN
+{
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+namespace mpi
+{
+
+/**
+ * @brief The state of a neighbourhood collective, the counts and displacements must stay valid
+ * until the exchange is complete.
+ */
+struct NeighbourhoodExchange
+{
+    std::vector<int> sendCounts;            /*< The bytes sent to each destination. */
+    std::vector<int> sendDispls;            /*< The send buffer offsets of the destinations. */
+    std::vector<int> receiveCounts;         /*< The bytes received from each source. */
+    std::vector<int> receiveDispls;         /*< The receive buffer offsets of the sources. */
+    MPI_Request request {MPI_REQUEST_NULL}; /*< The request of the collective. */
+};
+
+/**
+ * @class NeighbourhoodTopology
+ * @brief An MPI distributed graph topology connecting a rank to its halo neighbours.
+ *
+ * The sources of the graph are the ranks this rank receives from and the destinations are the
+ * ranks it sends to. A halo exchange over the topology is a single neighbourhood collective,
+ * i.e. MPI_Ineighbor_alltoallv, instead of one point-to-point message per rank. Since the
+ * exchanges are collectives they have to be started in the same order on all ranks.
+ */
+class NeighbourhoodTopology
+{
+public:
+
+    /**
+     * @brief Creates the distributed graph, this is a collective operation.
+     * @param mpiEnviron The MPI environment.
+     * @param sendSize The number of nodes, per rank, that this rank sends to.
+     * @param receiveSize The number of nodes, per rank, that this rank receives from.
+     */
+    NeighbourhoodTopology(
+        const MPIEnvironment& mpiEnviron,
+        const std::vector<std::size_t>& sendSize,
+        const std::vector<std::size_t>& receiveSize
+    );
+
+    /**
+     * @brief Destructor, releases the graph communicator.
+     */
+    ~NeighbourhoodTopology();
+
+    NeighbourhoodTopology(const NeighbourhoodTopology&) = delete;
+
+    NeighbourhoodTopology& operator=(const NeighbourhoodTopology&) = delete;
+
+    /**
+     * @brief Get the graph communicator.
+     * @return The graph communicator.
+     */
+    MPI_Comm comm() const { return graphComm_; }
+
+    /**
+     * @brief Get the ranks this rank receives from, in ascending order.
+     * @return The source ranks.
+     */
+    const std::vector<int>& sources() const { return sources_; }
+
+    /**
+     * @brief Get the ranks this rank sends to, in ascending order.
+     * @return The destination ranks.
+     */
+    const std::vector<int>& destinations() const { return destinations_; }
+
+    /**
+     * @brief Starts the exchange of the rank data of send into receive.
+     * @param send The send buffer, whose neighbours match the destinations.
+     * @param receive The receive buffer, whose neighbours match the sources.
+     * @param exchange The state of the collective, is populated by the function.
+     */
+    void startExchange(
+        HalfDuplexCommBuffer& send, HalfDuplexCommBuffer& receive, NeighbourhoodExchange& exchange
+    ) const;
+
+private:
+
+    MPI_Comm graphComm_ {MPI_COMM_NULL}; /*< The distributed graph communicator. */
+    std::vector<int> sources_;           /*< The ranks this rank receives from. */
+    std::vector<int> destinations_;      /*< The ranks this rank sends to. */
+};
+
+} // namespace mpi
+
+#endif
+
+}
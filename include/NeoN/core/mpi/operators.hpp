@@ -160,6 +160,33 @@ inline void allReduce(Vec3& vector, const ReduceOp op, MPI_Comm comm)
     );
 }
 
+/**
+ * @brief Starts a non-blocking in place all-reduce operation on a set of values across all
+ * processes in the communicator.
+ *
+ * @tparam valueType The type of the values.
+ * @param values Pointer to the first value, the values must not be accessed until the request
+ * has completed.
+ * @param size The number of values.
+ * @param op The reduction operation to be performed.
+ * @param comm The communicator across which the reduction operation is performed.
+ * @param request Pointer to the MPI_Request object, is populated by the function.
+ * @note Non-blocking MPI operation, see wait.
+ */
+template<typename valueType>
+void iAllReduce(
+    valueType* values,
+    const mpi_label_t size,
+    const ReduceOp op,
+    MPI_Comm comm,
+    MPI_Request* request
+)
+{
+    mpi_label_t err =
+        MPI_Iallreduce(MPI_IN_PLACE, values, size, getType<valueType>(), getOp(op), comm, request);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Iallreduce failed.");
+}
+
 /**
  * @brief Non-blocking send of a set of scalar values to a remote rank.
  *
@@ -213,6 +240,60 @@ void irecv(
     NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Irecv failed.");
 }
 
+/**
+ * @brief Creates a persistent send request of a set of scalar values to a remote rank.
+ *
+ * @tparam valueType The type of the scalar value.
+ * @param buffer Pointer to first scalar value to be sent.
+ * @param size The size of the send buffer, i.e. number of components/elements.
+ * @param rankReceive The receiving rank index.
+ * @param tag The tag of the message, used to identify the communication.
+ * @param comm The MPI communicator across which the message is sent.
+ * @param request Pointer to the MPI_Request object, is populated by the function.
+ * @note The request is inactive until started and must be released with MPI_Request_free.
+ */
+template<typename valueType>
+void sendInit(
+    const valueType* buffer,
+    const mpi_label_t size,
+    mpi_label_t rankReceive,
+    mpi_label_t tag,
+    MPI_Comm comm,
+    MPI_Request* request
+)
+{
+    mpi_label_t err =
+        MPI_Send_init(buffer, size, getType<valueType>(), rankReceive, tag, comm, request);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Send_init failed.");
+}
+
+/**
+ * @brief Creates a persistent receive request of a set of scalar values from a remote rank.
+ *
+ * @tparam valueType The type of the scalar value.
+ * @param buffer Pointer to the buffer where the received scalar values will be stored.
+ * @param size The size of the receive buffer, i.e. number of components/elements.
+ * @param rankSend The rank index of the sender.
+ * @param tag The tag of the message, used to identify the communication.
+ * @param comm The MPI communicator across which the message is received.
+ * @param request Pointer to the MPI_Request object, is populated by the function.
+ * @note The request is inactive until started and must be released with MPI_Request_free.
+ */
+template<typename valueType>
+void recvInit(
+    valueType* buffer,
+    const mpi_label_t size,
+    mpi_label_t rankSend,
+    mpi_label_t tag,
+    MPI_Comm comm,
+    MPI_Request* request
+)
+{
+    mpi_label_t err =
+        MPI_Recv_init(buffer, size, getType<valueType>(), rankSend, tag, comm, request);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Recv_init failed.");
+}
+
 /**
  * @brief Tests if a non-blocking communication request has completed.
  *
@@ -228,6 +309,18 @@ inline bool test(MPI_Request* request)
     return static_cast<bool>(flag);
 }
 
+/**
+ * @brief Waits until a non-blocking communication request has completed.
+ *
+ * @param request Pointer to the MPI_Request object.
+ * @note Blocking MPI operation.
+ */
+inline void wait(MPI_Request* request)
+{
+    mpi_label_t err = MPI_Wait(request, MPI_STATUS_IGNORE);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Wait failed.");
+}
+
 } // namespace mpi
 
 #endif
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "NeoN/core/mpi/environment.hpp"
+
+namespace NeoN
+{
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+namespace mpi
+{
+
+/**
+ * @class ProgressThread
+ * @brief A thread driving the progress engine of MPI while the non-blocking exchanges are
+ * ongoing.
+ *
+ * Most MPI libraries move the data of a large message, e.g. the rendezvous protocol, only within
+ * MPI calls. Between startComm and finaliseComm no MPI call is made by the compute thread, hence
+ * the thread calls MPI_Iprobe on a duplicate of the communicator every interval. The probe does
+ * not receive any message, it only progresses the pending requests of all communicators. The
+ * thread requires an MPI library initialized with MPI_THREAD_MULTIPLE, see
+ * NeoN_ENABLE_MPI_WITH_THREAD_SUPPORT.
+ */
+class ProgressThread
+{
+public:
+
+    /**
+     * @brief Duplicates the communicator and starts the thread, this is a collective operation.
+     * @param mpiEnviron The MPI environment.
+     * @param interval The time between two probes of the thread.
+     */
+    ProgressThread(const MPIEnvironment& mpiEnviron, std::chrono::microseconds interval);
+
+    /**
+     * @brief Destructor, stops the thread and releases the communicator, this is a collective
+     * operation.
+     */
+    ~ProgressThread();
+
+    ProgressThread(const ProgressThread&) = delete;
+
+    ProgressThread& operator=(const ProgressThread&) = delete;
+
+    /**
+     * @brief Get the number of probes made by the thread.
+     * @return The number of probes.
+     */
+    std::size_t probes() const { return probes_.load(std::memory_order_relaxed); }
+
+private:
+
+    MPI_Comm comm_ {MPI_COMM_NULL};    /*< The communicator probed by the thread. */
+    std::atomic<bool> stop_ {false};    /*< Whether the thread has to stop. */
+    std::atomic<std::size_t> probes_ {0}; /*< The number of probes made by the thread. */
+    std::thread thread_;                /*< The progress thread. */
+};
+
+} // namespace mpi
+
+#endif
+
+}
@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/mpi/operators.hpp"
+
+namespace NeoN
+{
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+namespace mpi
+{
+
+/**
+ * @class ReductionBatch
+ * @brief Collects several values with their reduction operations and reduces them in a single
+ * all-reduce.
+ *
+ * Every all-reduce costs the latency of the network, which dominates for a few values on many
+ * ranks. The batch therefore reduces all values in one MPI_Allreduce, or one MPI_Iallreduce with
+ * start and wait. If all values share their operation the predefined MPI operation is used,
+ * otherwise a user defined operation applies the operation of every value, which is looked up
+ * from an attribute of the datatype of the batch. The datatype is rebuilt only if the sequence
+ * of operations changes, hence a batch reused every time step creates it once.
+ *
+ * The supported operations are Max, Min, Sum and Prod on scalars.
+ */
+class ReductionBatch
+{
+public:
+
+    /**
+     * @brief Creates an empty batch.
+     * @param comm The communicator across which the values are reduced.
+     */
+    explicit ReductionBatch(MPI_Comm comm);
+
+    /**
+     * @brief Destructor, waits for a pending reduction and frees the datatype and operation.
+     */
+    ~ReductionBatch();
+
+    ReductionBatch(const ReductionBatch&) = delete;
+
+    ReductionBatch& operator=(const ReductionBatch&) = delete;
+
+    /**
+     * @brief Adds a value to the batch.
+     * @param value The local value.
+     * @param op The reduction operation of the value.
+     * @return The index of the value, see value.
+     */
+    std::size_t add(scalar value, ReduceOp op);
+
+    /**
+     * @brief Adds the components of a vector to the batch.
+     * @param vector The local vector.
+     * @param op The reduction operation of all components.
+     * @return The index of the first component, see vec3.
+     */
+    std::size_t add(const Vec3& vector, ReduceOp op);
+
+    /**
+     * @brief Reduces all values across the communicator.
+     * @note Blocking MPI operation.
+     */
+    void reduce();
+
+    /**
+     * @brief Starts the reduction of all values, the batch must not be modified until wait.
+     * @note Non-blocking MPI operation.
+     */
+    void start();
+
+    /**
+     * @brief Waits for the reduction started by start.
+     * @note Blocking MPI operation.
+     */
+    void wait();
+
+    /**
+     * @brief Whether a reduction has been started and not waited for.
+     * @return True if a reduction is pending.
+     */
+    bool pending() const { return request_ != MPI_REQUEST_NULL; }
+
+    /**
+     * @brief Get a value, the reduced value after reduce or wait.
+     * @param i The index returned by add.
+     * @return The value.
+     */
+    scalar value(std::size_t i) const;
+
+    /**
+     * @brief Get a vector, the reduced vector after reduce or wait.
+     * @param i The index returned by add.
+     * @return The vector.
+     */
+    Vec3 vec3(std::size_t i) const;
+
+    /**
+     * @brief Removes all values, the datatype is kept for a batch of the same operations.
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of values.
+     * @return The number of values, a vector counts three.
+     */
+    std::size_t size() const { return values_.size(); }
+
+    /**
+     * @brief Get the number of all-reduce calls made by the batch.
+     * @return The number of reductions.
+     */
+    std::size_t nReductions() const { return nReductions_; }
+
+private:
+
+    /**
+     * @brief Returns the datatype, operation and count of the reduction, rebuilds the datatype
+     * if the operations have changed.
+     */
+    std::tuple<MPI_Datatype, MPI_Op, int> typeAndOp();
+
+    MPI_Comm comm_;                  /**< The communicator of the reduction. */
+    std::vector<scalar> values_;     /**< The values, reduced in place. */
+    std::vector<ReduceOp> ops_;      /**< The operation of every value. */
+    std::vector<ReduceOp> typeOps_;  /**< The operations of the datatype, its attribute. */
+    MPI_Datatype type_;              /**< All values as one element, or MPI_DATATYPE_NULL. */
+    MPI_Op op_;                      /**< The user defined operation, or MPI_OP_NULL. */
+    MPI_Request request_;            /**< The request of a started reduction. */
+    std::size_t nReductions_;        /**< The number of all-reduce calls. */
+};
+
+namespace detail
+{
+
+/**
+ * @brief The reduction operation of the result of a parallelReduce, a plain value is summed.
+ */
+template<typename Result>
+constexpr ReduceOp reduceOpOf()
+{
+    if constexpr (std::is_same_v<Result, Kokkos::Max<scalar>>)
+    {
+        return ReduceOp::Max;
+    }
+    else if constexpr (std::is_same_v<Result, Kokkos::Min<scalar>>)
+    {
+        return ReduceOp::Min;
+    }
+    else if constexpr (std::is_same_v<Result, Kokkos::Prod<scalar>>)
+    {
+        return ReduceOp::Prod;
+    }
+    else
+    {
+        static_assert(
+            std::is_same_v<Result, scalar> || std::is_same_v<Result, Kokkos::Sum<scalar>>,
+            "Only scalar results and Max, Min, Prod and Sum reducers can be batched."
+        );
+        return ReduceOp::Sum;
+    }
+}
+
+template<typename Result>
+scalar resultValue(const Result& result)
+{
+    if constexpr (std::is_same_v<Result, scalar>)
+    {
+        return result;
+    }
+    else
+    {
+        return result.reference();
+    }
+}
+
+}
+
+/**
+ * @brief Adds the local results of a fused parallelReduce to a batch.
+ *
+ * The results are the values and reducers passed to parallelReduce, eg. a Kokkos::Max reducer
+ * and a plain value for a maximum and a sum computed in a single pass over the cells. The
+ * operation follows from the reducer, plain values are summed like in parallelReduce.
+ *
+ * @param batch The batch the results are added to.
+ * @param results The results of the parallelReduce.
+ * @return The indices of the results in the batch.
+ */
+template<typename... Results>
+std::array<std::size_t, sizeof...(Results)>
+addReductions(ReductionBatch& batch, const Results&... results)
+{
+    return {batch.add(detail::resultValue(results), detail::reduceOpOf<Results>())...};
+}
+
+} // namespace mpi
+
+#endif
+
+}
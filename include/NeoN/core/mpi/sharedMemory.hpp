@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "NeoN/core/mpi/environment.hpp"
+#include "NeoN/core/mpi/halfDuplexCommBuffer.hpp"
+
+namespace NeoN
+{
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+namespace mpi
+{
+
+/**
+ * @class SharedMemoryNode
+ * @brief The ranks of an MPI environment that share the memory of a compute node with this rank.
+ *
+ * The node communicator is split from the communicator of the environment with
+ * MPI_Comm_split_type(MPI_COMM_TYPE_SHARED), hence the node ranks can map the memory of each
+ * other, see SharedMemoryWindow.
+ */
+class SharedMemoryNode
+{
+public:
+
+    /**
+     * @brief Creates the node communicator, this is a collective operation.
+     * @param mpiEnviron The MPI environment.
+     */
+    SharedMemoryNode(const MPIEnvironment& mpiEnviron);
+
+    /**
+     * @brief Destructor, releases the node communicator.
+     */
+    ~SharedMemoryNode();
+
+    SharedMemoryNode(const SharedMemoryNode&) = delete;
+
+    SharedMemoryNode& operator=(const SharedMemoryNode&) = delete;
+
+    /**
+     * @brief Get the node communicator.
+     * @return The node communicator.
+     */
+    MPI_Comm comm() const { return nodeComm_; }
+
+    /**
+     * @brief Get the node rank of every rank of the environment.
+     * @return The node ranks, MPI_UNDEFINED for the ranks on other nodes.
+     */
+    const std::vector<int>& nodeRanks() const { return nodeRanks_; }
+
+    /**
+     * @brief Get the rank of this rank in the node communicator.
+     * @return The node rank.
+     */
+    int rank() const;
+
+    /**
+     * @brief Get the number of ranks on this node.
+     * @return The size of the node communicator.
+     */
+    int size() const;
+
+private:
+
+    MPI_Comm nodeComm_ {MPI_COMM_NULL}; /*< The communicator of the ranks on this node. */
+    std::vector<int> nodeRanks_;        /*< The node rank of every rank of the environment. */
+};
+
+/**
+ * @class SharedMemoryWindow
+ * @brief An MPI-3 shared memory window holding the messages between the ranks of a node.
+ *
+ * Every rank allocates one slot per node-local destination in its segment of the window. A slot
+ * holds a ready and a consumed counter followed by the message data. The sender waits until the
+ * receiver consumed the previous message, copies the data into the slot and increments ready.
+ * The receiver polls ready, copies the data out of the slot of the sender and sets consumed. The
+ * node-local messages thus skip the matching and the protocol of MPI and the counters are the
+ * only synchronisation. Messages larger than the slot, eg. after a change of the value type of
+ * the buffers, are sent with MPI instead, both sides decide this from the slot capacity.
+ *
+ * Creating and freeing the window are collective operations on the node, thus the windows of
+ * all node ranks have to be created and freed in the same order.
+ */
+class SharedMemoryWindow
+{
+public:
+
+    /**
+     * @brief Allocates the window and exchanges the slot offsets, this is a collective operation
+     * on the node.
+     * @param node The ranks of this node.
+     * @param send The send buffer, its messages size the slots.
+     * @param receive The receive buffer.
+     * @param entryBytes The slot size per entry of a message, messages of a larger value type
+     * are sent with MPI.
+     */
+    SharedMemoryWindow(
+        const SharedMemoryNode& node,
+        const HalfDuplexCommBuffer& send,
+        const HalfDuplexCommBuffer& receive,
+        std::size_t entryBytes
+    );
+
+    /**
+     * @brief Destructor, frees the window, this is a collective operation on the node.
+     */
+    ~SharedMemoryWindow();
+
+    SharedMemoryWindow(const SharedMemoryWindow&) = delete;
+
+    SharedMemoryWindow& operator=(const SharedMemoryWindow&) = delete;
+
+    /**
+     * @brief Writes the node-local messages of send into the slots and marks the ranks exchanged
+     * through the window as shared in send and receive, which are then skipped by MPI.
+     * @param send The send buffer.
+     * @param receive The receive buffer.
+     */
+    void startExchange(HalfDuplexCommBuffer& send, HalfDuplexCommBuffer& receive);
+
+    /**
+     * @brief Copies the arrived node-local messages into receive.
+     * @param receive The receive buffer.
+     * @return True if all node-local messages arrived, false otherwise.
+     */
+    bool testExchange(HalfDuplexCommBuffer& receive);
+
+private:
+
+    /**
+     * @brief A slot of the window, the header is followed by capacity bytes of message data.
+     */
+    struct Slot
+    {
+        std::size_t rank;       /*< The rank of the environment sending or receiving. */
+        std::uint64_t* header;  /*< The ready and the consumed counter. */
+        std::size_t capacity;   /*< The capacity (in bytes) of the message data. */
+    };
+
+    MPI_Win win_ {MPI_WIN_NULL};      /*< The shared memory window. */
+    std::vector<Slot> sendSlots_;     /*< The slots of this rank, per node-local destination. */
+    std::vector<Slot> receiveSlots_;  /*< The slots of the node-local sources. */
+    std::vector<bool> pending_;       /*< Whether a receive slot is still awaited. */
+    std::vector<bool> sendShared_;    /*< Per rank, whether the message uses the window. */
+    std::vector<bool> receiveShared_; /*< Per rank, whether the message uses the window. */
+};
+
+} // namespace mpi
+
+#endif
+
+}
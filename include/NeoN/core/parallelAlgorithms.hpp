@@ -5,10 +5,18 @@
 #pragma once
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/view.hpp"
 
 namespace NeoN
 {
@@ -26,12 +34,19 @@ concept parallelForKernel = requires(Kernel t, size_t i) {
     } -> std::same_as<void>;
 };
 
+/* @brief runs kernel for every index of range on the given executor
+ *
+ * The overloads for a concrete executor are the low overhead entry point, they launch without a
+ * std::visit. Code launching several kernels, eg. one per boundary patch, should visit the
+ * NeoN::Executor once and call these overloads with the concrete executor. The name is passed as
+ * a view and only copied into the label of the Kokkos kernel, the serial executor ignores it.
+ */
 template<typename Executor, parallelForKernel Kernel>
 void parallelFor(
     [[maybe_unused]] const Executor& exec,
     std::pair<localIdx, localIdx> range,
     Kernel kernel,
-    std::string name = "parallelFor"
+    [[maybe_unused]] std::string_view name = "parallelFor"
 )
 {
     auto [start, end] = range;
@@ -46,8 +61,8 @@ void parallelFor(
     {
         using runOn = typename Executor::exec;
         Kokkos::parallel_for(
-            name,
-            Kokkos::RangePolicy<runOn>(start, end),
+            std::string(name),
+            Kokkos::RangePolicy<runOn>(exec.underlyingExec(), start, end),
             KOKKOS_LAMBDA(const localIdx i) { kernel(i); }
         );
     }
@@ -59,7 +74,7 @@ void parallelFor(
     const NeoN::Executor& exec,
     std::pair<localIdx, localIdx> range,
     Kernel kernel,
-    std::string name = "parallelFor"
+    std::string_view name = "parallelFor"
 )
 {
     std::visit([&](const auto& e) { parallelFor(e, range, kernel, name); }, exec);
@@ -83,7 +98,7 @@ void parallelFor(
     [[maybe_unused]] const Executor& exec,
     ContType<ValueType>& container,
     Kernel kernel,
-    std::string name = "parallelFor"
+    [[maybe_unused]] std::string_view name = "parallelFor"
 )
 {
     auto view = container.view();
@@ -98,8 +113,8 @@ void parallelFor(
     {
         using runOn = typename Executor::exec;
         Kokkos::parallel_for(
-            name,
-            Kokkos::RangePolicy<runOn>(0, view.size()),
+            std::string(name),
+            Kokkos::RangePolicy<runOn>(exec.underlyingExec(), 0, view.size()),
             KOKKOS_LAMBDA(const localIdx i) { view[i] = kernel(i); }
         );
     }
@@ -110,17 +125,50 @@ template<
     class ContType,
     typename ValueType,
     parallelForContainerKernel<ValueType> Kernel>
-void parallelFor(ContType<ValueType>& cont, Kernel kernel, std::string name = "parallelFor")
+void parallelFor(ContType<ValueType>& cont, Kernel kernel, std::string_view name = "parallelFor")
 {
     std::visit([&](const auto& e) { parallelFor(e, cont, kernel, name); }, cont.exec());
 }
 
-template<typename Executor, typename Kernel, typename T>
-void parallelReduce(
+namespace detail
+{
+
+/* @brief the value a serial reduction kernel accumulates into, ie. the reference of a reducer */
+template<typename T>
+auto& reductionReference(T& value)
+{
+    if constexpr (Kokkos::is_reducer<T>::value)
+    {
+        return value.reference();
+    }
+    else
+    {
+        return value;
+    }
+}
+
+/* @brief checks if the last of the trailing arguments of parallelReduce is the kernel name */
+template<typename... Args>
+constexpr bool endsWithName()
+{
+    if constexpr (sizeof...(Args) == 0)
+    {
+        return false;
+    }
+    else
+    {
+        using Last = std::tuple_element_t<sizeof...(Args) - 1, std::tuple<Args...>>;
+        return std::is_convertible_v<Last, std::string>;
+    }
+}
+
+template<typename Executor, typename Kernel, typename... Ts>
+void parallelReduceImpl(
     [[maybe_unused]] const Executor& exec,
     std::pair<localIdx, localIdx> range,
     Kernel kernel,
-    T& value
+    [[maybe_unused]] const std::string& name,
+    Ts&... values
 )
 {
     auto [start, end] = range;
@@ -128,37 +176,66 @@ void parallelReduce(
     {
         for (localIdx i = start; i < end; i++)
         {
-            if constexpr (Kokkos::is_reducer<T>::value)
-            {
-                kernel(i, value.reference());
-            }
-            else
-            {
-                kernel(i, value);
-            }
+            kernel(i, reductionReference(values)...);
         }
     }
     else
     {
         using runOn = typename Executor::exec;
         Kokkos::parallel_reduce(
-            "parallelReduce", Kokkos::RangePolicy<runOn>(start, end), kernel, value
+            name, Kokkos::RangePolicy<runOn>(exec.underlyingExec(), start, end), kernel, values...
         );
     }
 }
 
-template<typename Kernel, typename T>
+}
+
+/* @brief computes one or several reductions in a single pass over the range
+ *
+ * The kernel receives one accumulator per value, eg. kernel(i, lmax, lsum). Every value can be
+ * a scalar, which is summed, or a Kokkos reducer like Kokkos::Max. All results are available
+ * after a single kernel launch and device synchronization. The values can be followed by the
+ * name of the kernel, which is reported to Kokkos Tools, it defaults to "parallelReduce".
+ */
+template<typename Executor, typename Kernel, typename... Args>
+    requires(sizeof...(Args) > 0)
 void parallelReduce(
-    const NeoN::Executor& exec, std::pair<localIdx, localIdx> range, Kernel kernel, T& value
+    const Executor& exec, std::pair<localIdx, localIdx> range, Kernel kernel, Args&&... args
 )
 {
-    std::visit([&](const auto& e) { parallelReduce(e, range, kernel, value); }, exec);
+    if constexpr (detail::endsWithName<Args...>())
+    {
+        constexpr auto nValues = sizeof...(Args) - 1;
+        auto argTuple = std::forward_as_tuple(args...);
+        const std::string name(std::get<nValues>(argTuple));
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            detail::parallelReduceImpl(exec, range, kernel, name, std::get<Is>(argTuple)...);
+        }(std::make_index_sequence<nValues>());
+    }
+    else
+    {
+        detail::parallelReduceImpl(exec, range, kernel, "parallelReduce", args...);
+    }
+}
+
+template<typename Kernel, typename... Args>
+    requires(sizeof...(Args) > 0)
+void parallelReduce(
+    const NeoN::Executor& exec, std::pair<localIdx, localIdx> range, Kernel kernel, Args&&... args
+)
+{
+    std::visit([&](const auto& e) { parallelReduce(e, range, kernel, args...); }, exec);
 }
 
 
 template<typename Executor, typename ValueType, typename Kernel, typename T>
 void parallelReduce(
-    [[maybe_unused]] const Executor& exec, Vector<ValueType>& field, Kernel kernel, T& value
+    [[maybe_unused]] const Executor& exec,
+    Vector<ValueType>& field,
+    Kernel kernel,
+    T& value,
+    std::string name = "parallelReduce"
 )
 {
     if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
@@ -180,57 +257,411 @@ void parallelReduce(
     {
         using runOn = typename Executor::exec;
         Kokkos::parallel_reduce(
-            "parallelReduce", Kokkos::RangePolicy<runOn>(0, field.size()), kernel, value
+            name,
+            Kokkos::RangePolicy<runOn>(exec.underlyingExec(), 0, field.size()),
+            kernel,
+            value
         );
     }
 }
 
 template<typename ValueType, typename Kernel, typename T>
-void parallelReduce(Vector<ValueType>& field, Kernel kernel, T& value)
+void parallelReduce(
+    Vector<ValueType>& field, Kernel kernel, T& value, std::string name = "parallelReduce"
+)
 {
-    std::visit([&](const auto& e) { parallelReduce(e, field, kernel, value); }, field.exec());
+    std::visit(
+        [&](const auto& e) { parallelReduce(e, field, kernel, value, name); }, field.exec()
+    );
+}
+
+namespace detail
+{
+
+/* @brief the type of the update of a scan kernel kernel(i, update, final) */
+template<typename Operator>
+struct ScanValue;
+
+template<typename Class, typename Index, typename T, typename Final>
+struct ScanValue<void (Class::*)(Index, T&, Final) const>
+{
+    using type = T;
+};
+
 }
 
 template<typename Executor, typename Kernel>
 void parallelScan(
-    [[maybe_unused]] const Executor& exec, std::pair<localIdx, localIdx> range, Kernel kernel
+    [[maybe_unused]] const Executor& exec,
+    std::pair<localIdx, localIdx> range,
+    Kernel kernel,
+    std::string name = "parallelScan"
 )
 {
     auto [start, end] = range;
-    using runOn = typename Executor::exec;
-    Kokkos::parallel_scan("parallelScan", Kokkos::RangePolicy<runOn>(start, end), kernel);
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        // a single final pass, the update passed to the kernel holds the sum of all previous
+        // entries
+        typename detail::ScanValue<decltype(&Kernel::operator())>::type update {};
+        for (localIdx i = start; i < end; i++)
+        {
+            kernel(i, update, true);
+        }
+    }
+    else
+    {
+        using runOn = typename Executor::exec;
+        Kokkos::parallel_scan(
+            name, Kokkos::RangePolicy<runOn>(exec.underlyingExec(), start, end), kernel
+        );
+    }
 }
 
 template<typename Kernel>
-void parallelScan(const NeoN::Executor& exec, std::pair<localIdx, localIdx> range, Kernel kernel)
+void parallelScan(
+    const NeoN::Executor& exec,
+    std::pair<localIdx, localIdx> range,
+    Kernel kernel,
+    std::string name = "parallelScan"
+)
 {
-    std::visit([&](const auto& e) { parallelScan(e, range, kernel); }, exec);
+    std::visit([&](const auto& e) { parallelScan(e, range, kernel, name); }, exec);
 }
 
 template<typename Executor, typename Kernel, typename ReturnType>
+    requires(!std::is_convertible_v<ReturnType&, std::string>)
 void parallelScan(
     [[maybe_unused]] const Executor& exec,
     std::pair<localIdx, localIdx> range,
     Kernel kernel,
-    ReturnType& returnValue
+    ReturnType& returnValue,
+    std::string name = "parallelScan"
 )
 {
     auto [start, end] = range;
-    using runOn = typename Executor::exec;
-    Kokkos::parallel_scan(
-        "parallelScan", Kokkos::RangePolicy<runOn>(start, end), kernel, returnValue
-    );
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        ReturnType update {};
+        for (localIdx i = start; i < end; i++)
+        {
+            kernel(i, update, true);
+        }
+        returnValue = update;
+    }
+    else
+    {
+        using runOn = typename Executor::exec;
+        Kokkos::parallel_scan(
+            name,
+            Kokkos::RangePolicy<runOn>(exec.underlyingExec(), start, end),
+            kernel,
+            returnValue
+        );
+    }
 }
 
 template<typename Kernel, typename ReturnType>
+    requires(!std::is_convertible_v<ReturnType&, std::string>)
 void parallelScan(
     const NeoN::Executor& exec,
     std::pair<localIdx, localIdx> range,
     Kernel kernel,
-    ReturnType& returnValue
+    ReturnType& returnValue,
+    std::string name = "parallelScan"
+)
+{
+    std::visit(
+        [&](const auto& e) { parallelScan(e, range, kernel, returnValue, name); }, exec
+    );
+}
+
+/* @brief computes the exclusive prefix sum out[i] = in[0] + ... + in[i-1]
+ *
+ * in and out may be the same view.
+ *
+ * @return the sum of all entries of in
+ */
+template<typename Executor, typename ValueType>
+ValueType exclusiveScan(
+    const Executor& exec, View<const std::type_identity_t<ValueType>> in, View<ValueType> out
+)
+{
+    NF_ASSERT_EQUAL(in.size(), out.size());
+    ValueType total {};
+    parallelScan(
+        exec,
+        {0, in.size()},
+        KOKKOS_LAMBDA(const localIdx i, ValueType& update, const bool final) {
+            const ValueType value = in[i];
+            if (final)
+            {
+                out[i] = update;
+            }
+            update += value;
+        },
+        total,
+        "exclusiveScan"
+    );
+    return total;
+}
+
+template<typename ValueType>
+ValueType exclusiveScan(
+    const NeoN::Executor& exec,
+    View<const std::type_identity_t<ValueType>> in,
+    View<ValueType> out
+)
+{
+    return std::visit([&](const auto& e) { return exclusiveScan(e, in, out); }, exec);
+}
+
+/* @brief computes the inclusive prefix sum out[i] = in[0] + ... + in[i]
+ *
+ * in and out may be the same view.
+ *
+ * @return the sum of all entries of in
+ */
+template<typename Executor, typename ValueType>
+ValueType inclusiveScan(
+    const Executor& exec, View<const std::type_identity_t<ValueType>> in, View<ValueType> out
+)
+{
+    NF_ASSERT_EQUAL(in.size(), out.size());
+    ValueType total {};
+    parallelScan(
+        exec,
+        {0, in.size()},
+        KOKKOS_LAMBDA(const localIdx i, ValueType& update, const bool final) {
+            update += in[i];
+            if (final)
+            {
+                out[i] = update;
+            }
+        },
+        total,
+        "inclusiveScan"
+    );
+    return total;
+}
+
+template<typename ValueType>
+ValueType inclusiveScan(
+    const NeoN::Executor& exec,
+    View<const std::type_identity_t<ValueType>> in,
+    View<ValueType> out
+)
+{
+    return std::visit([&](const auto& e) { return inclusiveScan(e, in, out); }, exec);
+}
+
+namespace detail
+{
+
+/* @brief an unmanaged Kokkos view of the memory of a view on the executor */
+template<typename Executor, typename ValueType>
+auto kokkosView(const View<ValueType>& view)
+{
+    using memorySpace = typename Executor::exec::memory_space;
+    return Kokkos::View<ValueType*, memorySpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+        view.data(), static_cast<std::size_t>(view.size())
+    );
+}
+
+/* @brief orders pairs of a key and an index by key and index, ie. a stable order of the keys */
+struct KeyIndexLess
+{
+    template<typename Pair>
+    KOKKOS_INLINE_FUNCTION bool operator()(const Pair& lhs, const Pair& rhs) const
+    {
+        return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+    }
+};
+
+}
+
+/* @brief sorts the keys in ascending order */
+template<typename Executor, typename KeyType>
+void parallelSort([[maybe_unused]] const Executor& exec, View<KeyType> keys)
+{
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        std::sort(keys.begin(), keys.end());
+    }
+    else
+    {
+        if (keys.size() < 2)
+        {
+            return;
+        }
+        Kokkos::sort(exec.underlyingExec(), detail::kokkosView<Executor>(keys));
+    }
+}
+
+template<typename KeyType>
+void parallelSort(const NeoN::Executor& exec, View<KeyType> keys)
+{
+    std::visit([&](const auto& e) { parallelSort(e, keys); }, exec);
+}
+
+/* @brief sorts the keys in ascending order and applies the same permutation to the values
+ *
+ * The sort is stable, ie. values with equal keys keep their order, hence the result is
+ * deterministic on all executors.
+ */
+template<typename Executor, typename KeyType, typename ValueType>
+void parallelSort([[maybe_unused]] const Executor& exec, View<KeyType> keys, View<ValueType> values)
+{
+    NF_ASSERT_EQUAL(keys.size(), values.size());
+    const auto n = keys.size();
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        std::vector<localIdx> perm(static_cast<std::size_t>(n));
+        for (localIdx i = 0; i < n; i++)
+        {
+            perm[static_cast<std::size_t>(i)] = i;
+        }
+        std::stable_sort(
+            perm.begin(), perm.end(), [&](localIdx a, localIdx b) { return keys[a] < keys[b]; }
+        );
+        std::vector<KeyType> sortedKeys(keys.begin(), keys.end());
+        std::vector<ValueType> sortedValues(values.begin(), values.end());
+        for (localIdx i = 0; i < n; i++)
+        {
+            const auto j = static_cast<std::size_t>(perm[static_cast<std::size_t>(i)]);
+            keys[i] = sortedKeys[j];
+            values[i] = sortedValues[j];
+        }
+    }
+    else
+    {
+        if (n < 2)
+        {
+            return;
+        }
+        using runOn = typename Executor::exec;
+        using memorySpace = typename runOn::memory_space;
+        Kokkos::View<Kokkos::pair<KeyType, localIdx>*, memorySpace> perm(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, "parallelSortPermutation"),
+            static_cast<std::size_t>(n)
+        );
+        Kokkos::View<ValueType*, memorySpace> unsorted(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, "parallelSortValues"),
+            static_cast<std::size_t>(n)
+        );
+        Kokkos::parallel_for(
+            "parallelSortInit",
+            Kokkos::RangePolicy<runOn>(exec.underlyingExec(), 0, n),
+            KOKKOS_LAMBDA(const localIdx i) {
+                perm(i) = Kokkos::pair<KeyType, localIdx>(keys[i], i);
+                unsorted(i) = values[i];
+            }
+        );
+        Kokkos::sort(exec.underlyingExec(), perm, detail::KeyIndexLess {});
+        Kokkos::parallel_for(
+            "parallelSortGather",
+            Kokkos::RangePolicy<runOn>(exec.underlyingExec(), 0, n),
+            KOKKOS_LAMBDA(const localIdx i) {
+                keys[i] = perm(i).first;
+                values[i] = unsorted(perm(i).second);
+            }
+        );
+    }
+}
+
+template<typename KeyType, typename ValueType>
+void parallelSort(const NeoN::Executor& exec, View<KeyType> keys, View<ValueType> values)
+{
+    std::visit([&](const auto& e) { parallelSort(e, keys, values); }, exec);
+}
+
+/* @brief copies the first entry of every run of equal entries of sorted to out
+ *
+ * out needs to have at least the size of sorted.
+ *
+ * @return the number of unique entries, ie. the entries [0, n) of out are set
+ */
+template<typename Executor, typename ValueType>
+localIdx unique(
+    const Executor& exec, View<const std::type_identity_t<ValueType>> sorted, View<ValueType> out
+)
+{
+    NF_ASSERT(out.size() >= sorted.size(), "The output of unique is too small");
+    localIdx nUnique = 0;
+    parallelScan(
+        exec,
+        {0, sorted.size()},
+        KOKKOS_LAMBDA(const localIdx i, localIdx& update, const bool final) {
+            if (i == 0 || sorted[i] != sorted[i - 1])
+            {
+                if (final)
+                {
+                    out[update] = sorted[i];
+                }
+                update += 1;
+            }
+        },
+        nUnique,
+        "unique"
+    );
+    return nUnique;
+}
+
+template<typename ValueType>
+localIdx unique(
+    const NeoN::Executor& exec,
+    View<const std::type_identity_t<ValueType>> sorted,
+    View<ValueType> out
+)
+{
+    return std::visit([&](const auto& e) { return unique(e, sorted, out); }, exec);
+}
+
+/* @brief counts the occurrences of every bin, counts[b] is the number of keys equal to b
+ *
+ * All keys need to be in [0, counts.size()), the counts are overwritten.
+ */
+template<typename Executor, typename IndexType>
+void histogram(
+    const Executor& exec,
+    View<const std::type_identity_t<IndexType>> keys,
+    View<IndexType> counts
+)
+{
+    parallelFor(
+        exec,
+        {0, counts.size()},
+        KOKKOS_LAMBDA(const localIdx b) { counts[b] = 0; },
+        "histogramInit"
+    );
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        for (localIdx i = 0; i < keys.size(); i++)
+        {
+            counts[static_cast<localIdx>(keys[i])] += 1;
+        }
+    }
+    else
+    {
+        parallelFor(
+            exec,
+            {0, keys.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                Kokkos::atomic_add(&counts[static_cast<localIdx>(keys[i])], IndexType(1));
+            },
+            "histogram"
+        );
+    }
+}
+
+template<typename IndexType>
+void histogram(
+    const NeoN::Executor& exec,
+    View<const std::type_identity_t<IndexType>> keys,
+    View<IndexType> counts
 )
 {
-    std::visit([&](const auto& e) { parallelScan(e, range, kernel, returnValue); }, exec);
+    std::visit([&](const auto& e) { histogram(e, keys, counts); }, exec);
 }
 
 } // namespace NeoN
@@ -11,6 +11,15 @@
 
 namespace NeoN
 {
+/* The index types have different roles:
+ *  - label stores the rank local mesh connectivity, ie. faceOwner, faceNeighbour and faceCells
+ *  - localIdx counts and offsets rank local entities, eg. sizes, loop indices, CSR offsets
+ *  - globalIdx numbers entities across ranks
+ *  - columnIdx stores the rank local column indices of the CSR matrices, which index rows
+ * With NeoN_DP_LOCAL_IDX the connectivity and the column indices stay 32 bit, which halves the
+ * index traffic of the face loops and the matrix products, while sizes and offsets can exceed
+ * 2^31, eg. the number of non-zeros.
+ */
 #ifdef NeoN_DP_LABEL
 using label = int64_t;
 
@@ -21,6 +30,7 @@ using globalIdx = uint64_t;
 using localIdx = int64_t;
 using globalIdx = int64_t;
 #endif
+using columnIdx = localIdx;
 
 #else
 using label = int32_t;
@@ -28,9 +38,15 @@ using label = int32_t;
 #ifdef NeoN_US_IDX
 using localIdx = uint32_t;
 using globalIdx = uint64_t;
+using columnIdx = localIdx;
+#elif defined(NeoN_DP_LOCAL_IDX)
+using localIdx = int64_t;
+using globalIdx = int64_t;
+using columnIdx = int32_t;
 #else
 using localIdx = int32_t;
 using globalIdx = int64_t;
+using columnIdx = localIdx;
 #endif
 
 #endif
@@ -21,6 +21,10 @@ constexpr scalar ROOTVSMALL = 1e-18;
 KOKKOS_INLINE_FUNCTION
 scalar mag(const scalar& s) { return std::abs(s); }
 
+/* @brief the componentwise product, for scalars the plain product */
+KOKKOS_INLINE_FUNCTION
+scalar cmptMultiply(const scalar& lhs, const scalar& rhs) { return lhs * rhs; }
+
 // traits for scalar
 template<>
 KOKKOS_INLINE_FUNCTION scalar one<scalar>()
@@ -5,3 +5,124 @@
 #pragma once
 
 #include "scalar.hpp"
+#include "vec3.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @class Tensor
+ * @brief A class for the representation of a 3x3 tensor
+ *
+ * The tensor is stored as three Vec3 rows, thus with a padded Vec3, see vec3Lanes, every row is
+ * processed by packed instructions.
+ * @ingroup primitives
+ */
+class Tensor
+{
+public:
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor() : rows_ {Vec3(), Vec3(), Vec3()} {}
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor(const Vec3& x, const Vec3& y, const Vec3& z) : rows_ {x, y, z} {}
+
+    KOKKOS_INLINE_FUNCTION
+    Vec3& row(const size_t i) { return rows_[i]; }
+
+    KOKKOS_INLINE_FUNCTION
+    const Vec3& row(const size_t i) const { return rows_[i]; }
+
+    KOKKOS_INLINE_FUNCTION
+    scalar& operator()(const size_t i, const size_t j) { return rows_[i][j]; }
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator()(const size_t i, const size_t j) const { return rows_[i][j]; }
+
+    KOKKOS_INLINE_FUNCTION
+    bool operator==(const Tensor& rhs) const
+    {
+        return rows_[0] == rhs.rows_[0] && rows_[1] == rhs.rows_[1] && rows_[2] == rhs.rows_[2];
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor operator+(const Tensor& rhs) const
+    {
+        return Tensor(rows_[0] + rhs.rows_[0], rows_[1] + rhs.rows_[1], rows_[2] + rhs.rows_[2]);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor& operator+=(const Tensor& rhs)
+    {
+        rows_[0] += rhs.rows_[0];
+        rows_[1] += rhs.rows_[1];
+        rows_[2] += rhs.rows_[2];
+        return *this;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor operator-(const Tensor& rhs) const
+    {
+        return Tensor(rows_[0] - rhs.rows_[0], rows_[1] - rhs.rows_[1], rows_[2] - rhs.rows_[2]);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor operator*(const scalar& rhs) const
+    {
+        return Tensor(rows_[0] * rhs, rows_[1] * rhs, rows_[2] * rhs);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor& operator-=(const Tensor& rhs)
+    {
+        rows_[0] -= rhs.rows_[0];
+        rows_[1] -= rhs.rows_[1];
+        rows_[2] -= rhs.rows_[2];
+        return *this;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Tensor& operator*=(const scalar& rhs)
+    {
+        rows_[0] *= rhs;
+        rows_[1] *= rhs;
+        rows_[2] *= rhs;
+        return *this;
+    }
+
+private:
+
+    Vec3 rows_[3];
+};
+
+KOKKOS_INLINE_FUNCTION
+Tensor operator*(const scalar& sclr, const Tensor& rhs) { return rhs * sclr; }
+
+/* @brief the product of a tensor and a vector, ie. the dot products of the rows and the vector */
+KOKKOS_INLINE_FUNCTION
+Vec3 operator&(const Tensor& lhs, const Vec3& rhs)
+{
+    return Vec3(lhs.row(0) & rhs, lhs.row(1) & rhs, lhs.row(2) & rhs);
+}
+
+/* @brief the outer product of two vectors, row i is lhs[i] * rhs */
+KOKKOS_INLINE_FUNCTION
+Tensor outer(const Vec3& lhs, const Vec3& rhs)
+{
+    return Tensor(lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs);
+}
+
+template<>
+KOKKOS_INLINE_FUNCTION Tensor one<Tensor>()
+{
+    return Tensor(Vec3(1.0, 0.0, 0.0), Vec3(0.0, 1.0, 0.0), Vec3(0.0, 0.0, 1.0));
+}
+
+template<>
+KOKKOS_INLINE_FUNCTION Tensor zero<Tensor>()
+{
+    return Tensor();
+}
+
+} // namespace NeoN
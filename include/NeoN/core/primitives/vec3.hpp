@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <Kokkos_Core.hpp> // IWYU pragma: keep
 
 #include "NeoN/core/primitives/scalar.hpp"
@@ -15,21 +17,43 @@ namespace NeoN
 {
 
 
+/**
+ * @brief The number of scalars stored per Vec3.
+ *
+ * With the NeoN_ENABLE_PADDED_VEC3 option a Vec3 holds a fourth lane, which is always zero, and
+ * is aligned to its size. The operations then process all four lanes, which maps every operation
+ * onto a single packed instruction of 256 bit SIMD units at the cost of a third more memory
+ * traffic. Without the option a Vec3 holds three scalars.
+ * @ingroup primitives
+ */
+inline constexpr std::size_t vec3Lanes = NF_WITH_PADDED_VEC3 != 0 ? 4 : 3;
+
+/**
+ * @brief The alignment of a Vec3, the size of the padded vector or the alignment of a scalar.
+ * @ingroup primitives
+ */
+inline constexpr std::size_t vec3Alignment =
+    NF_WITH_PADDED_VEC3 != 0 ? vec3Lanes * sizeof(scalar) : alignof(scalar);
+
 /**
  * @class Vec3
  * @brief A class for the representation of a 3D Vec3
+ *
+ * The operations loop over all lanes, see vec3Lanes, such that the compiler can map them onto
+ * packed instructions.
  * @ingroup primitives
  */
-class Vec3
+class alignas(vec3Alignment) Vec3
 {
 public:
 
     KOKKOS_INLINE_FUNCTION
     Vec3()
     {
-        cmpts_[0] = 0.0;
-        cmpts_[1] = 0.0;
-        cmpts_[2] = 0.0;
+        for (std::size_t i = 0; i < vec3Lanes; i++)
+        {
+            cmpts_[i] = 0.0;
+        }
     }
 
     KOKKOS_INLINE_FUNCTION
@@ -38,6 +62,10 @@ public:
         cmpts_[0] = x;
         cmpts_[1] = y;
         cmpts_[2] = z;
+        for (std::size_t i = 3; i < vec3Lanes; i++)
+        {
+            cmpts_[i] = 0.0;
+        }
     }
 
     KOKKOS_INLINE_FUNCTION
@@ -46,6 +74,10 @@ public:
         cmpts_[0] = constValue;
         cmpts_[1] = constValue;
         cmpts_[2] = constValue;
+        for (std::size_t i = 3; i < vec3Lanes; i++)
+        {
+            cmpts_[i] = 0.0;
+        }
     }
 
     /**
@@ -90,59 +122,70 @@ public:
     KOKKOS_INLINE_FUNCTION
     Vec3 operator+(const Vec3& rhs) const
     {
-        return Vec3(cmpts_[0] + rhs(0), cmpts_[1] + rhs(1), cmpts_[2] + rhs(2));
+        Vec3 result(*this);
+        result += rhs;
+        return result;
     }
 
     KOKKOS_INLINE_FUNCTION
     Vec3& operator+=(const Vec3& rhs)
     {
-        cmpts_[0] += rhs(0);
-        cmpts_[1] += rhs(1);
-        cmpts_[2] += rhs(2);
+        for (std::size_t i = 0; i < vec3Lanes; i++)
+        {
+            cmpts_[i] += rhs.cmpts_[i];
+        }
         return *this;
     }
 
     KOKKOS_INLINE_FUNCTION
     Vec3 operator-(const Vec3& rhs) const
     {
-        return Vec3(cmpts_[0] - rhs(0), cmpts_[1] - rhs(1), cmpts_[2] - rhs(2));
+        Vec3 result(*this);
+        result -= rhs;
+        return result;
     }
 
     KOKKOS_INLINE_FUNCTION
     Vec3& operator-=(const Vec3& rhs)
     {
-        cmpts_[0] -= rhs(0);
-        cmpts_[1] -= rhs(1);
-        cmpts_[2] -= rhs(2);
+        for (std::size_t i = 0; i < vec3Lanes; i++)
+        {
+            cmpts_[i] -= rhs.cmpts_[i];
+        }
         return *this;
     }
 
     KOKKOS_INLINE_FUNCTION
     Vec3 operator*(const scalar& rhs) const
     {
-        return Vec3(cmpts_[0] * rhs, cmpts_[1] * rhs, cmpts_[2] * rhs);
+        Vec3 result(*this);
+        result *= rhs;
+        return result;
     }
 
 
     KOKKOS_INLINE_FUNCTION
     Vec3 operator*(const label& rhs) const
     {
-        return Vec3(cmpts_[0] * rhs, cmpts_[1] * rhs, cmpts_[2] * rhs);
+        Vec3 result(*this);
+        result *= static_cast<scalar>(rhs);
+        return result;
     }
 
 
     KOKKOS_INLINE_FUNCTION
     Vec3& operator*=(const scalar& rhs)
     {
-        cmpts_[0] *= rhs;
-        cmpts_[1] *= rhs;
-        cmpts_[2] *= rhs;
+        for (std::size_t i = 0; i < vec3Lanes; i++)
+        {
+            cmpts_[i] *= rhs;
+        }
         return *this;
     }
 
 private:
 
-    scalar cmpts_[3];
+    scalar cmpts_[vec3Lanes];
 };
 
 
@@ -153,14 +196,43 @@ Vec3 operator*(const scalar& sclr, Vec3 rhs)
     return rhs;
 }
 
+/* @brief the dot product, the padding lane is zero and does not contribute */
 KOKKOS_INLINE_FUNCTION
 scalar operator&(const Vec3& lhs, Vec3 rhs)
 {
-    return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+    scalar result = 0.0;
+    for (std::size_t i = 0; i < vec3Lanes; i++)
+    {
+        result += lhs[i] * rhs[i];
+    }
+    return result;
+}
+
+/* @brief the componentwise product of two vectors */
+KOKKOS_INLINE_FUNCTION
+Vec3 cmptMultiply(const Vec3& lhs, const Vec3& rhs)
+{
+    Vec3 result;
+    for (std::size_t i = 0; i < vec3Lanes; i++)
+    {
+        result[i] = lhs[i] * rhs[i];
+    }
+    return result;
+}
+
+/* @brief the cross product of two vectors */
+KOKKOS_INLINE_FUNCTION
+Vec3 cross(const Vec3& lhs, const Vec3& rhs)
+{
+    return Vec3(
+        lhs[1] * rhs[2] - lhs[2] * rhs[1],
+        lhs[2] * rhs[0] - lhs[0] * rhs[2],
+        lhs[0] * rhs[1] - lhs[1] * rhs[0]
+    );
 }
 
 KOKKOS_INLINE_FUNCTION
-scalar mag(const Vec3& vec) { return sqrt(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]); }
+scalar mag(const Vec3& vec) { return sqrt(vec & vec); }
 
 std::ostream& operator<<(std::ostream& out, const Vec3& vec);
 
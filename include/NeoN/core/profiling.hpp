@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+
+#include <Kokkos_Core.hpp> // IWYU pragma: keep
+
+namespace NeoN
+{
+
+/**
+ * @class ProfilingRegion
+ * @brief Marks the lifetime of the object as a named region for Kokkos Tools.
+ *
+ * The region is pushed on construction and popped on destruction, hence regions nest with the
+ * scopes. Tools like the space-time stack or nsys attribute the kernels launched inside to the
+ * region. Without a loaded tool, pushing and popping is a cheap no-op.
+ */
+class ProfilingRegion
+{
+public:
+
+    /**
+     * @brief Pushes the region.
+     * @param name The name of the region, by convention Class::phase.
+     */
+    explicit ProfilingRegion(const std::string& name) { Kokkos::Profiling::pushRegion(name); }
+
+    ProfilingRegion(const ProfilingRegion&) = delete;
+
+    ProfilingRegion& operator=(const ProfilingRegion&) = delete;
+
+    /**
+     * @brief Pops the region.
+     */
+    ~ProfilingRegion() { Kokkos::Profiling::popRegion(); }
+};
+
+} // namespace NeoN
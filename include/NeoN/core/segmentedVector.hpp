@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <variant>
+
 #include "NeoN/core/view.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/core/vector/vector.hpp"
@@ -27,28 +31,10 @@ namespace NeoN
 template<typename IndexType>
 IndexType segmentsFromIntervals(const Vector<IndexType>& intervals, Vector<IndexType>& offsets)
 {
-    IndexType finalValue = 0;
-    const auto inView = intervals.view();
     // skip the first element of the offsets
     // assumed to be zero
-    auto offsView = offsets.view().subview(1);
-    // NOTE avoid compiler warning by static_casting to localIdx since offsView
-    // is a View
-    NF_ASSERT_EQUAL(inView.size(), offsView.size());
-    NeoN::parallelScan(
-        intervals.exec(),
-        {0, offsView.size()},
-        KOKKOS_LAMBDA(const localIdx i, IndexType& update, const bool final) {
-            update += inView[i];
-            if (final)
-            {
-                // offView is a view, thus [] takes unsigned idx
-                offsView[i] = update;
-            }
-        },
-        finalValue
-    );
-    return finalValue;
+    NF_ASSERT_EQUAL(intervals.size() + 1, offsets.size());
+    return inclusiveScan(intervals.exec(), intervals.view(), offsets.view().subview(1));
 }
 
 /**
@@ -120,6 +106,231 @@ public:
     IndexType operator[](localIdx i) const { return segments[i]; }
 };
 
+// Concept to check if a callable is compatible with void(const localIdx, const localIdx)
+template<typename Kernel>
+concept parallelForSegmentKernel = requires(Kernel t, localIdx segI, localIdx j) {
+    {
+        t(segI, j)
+    } -> std::same_as<void>;
+};
+
+/* @brief the number of segments processed by one team of the hierarchical segment loops */
+inline constexpr int segmentsPerTeam = 64;
+
+/* @brief the number of vector lanes processing the entries of one segment
+ *
+ * Segments stem mostly from cell-face connectivity or matrix rows and hold only a few entries,
+ * thus a short vector length keeps most lanes busy.
+ */
+inline constexpr int segmentVectorLength = 4;
+
+/* @brief calls kernel(segI, j) for every entry j of every segment segI of the view
+ *
+ * The segments are mapped to the threads of a Kokkos team and the entries of a segment to the
+ * vector lanes of the thread. Hence, neighbouring lanes access neighbouring entries, which
+ * yields coalesced memory access on GPUs compared to a flat loop over the segments.
+ * The Serial fallback is a nested loop.
+ */
+template<
+    typename Executor,
+    typename ValueType,
+    typename IndexType,
+    parallelForSegmentKernel Kernel>
+void parallelFor(
+    [[maybe_unused]] const Executor& exec,
+    const SegmentedVectorView<ValueType, IndexType>& view,
+    Kernel kernel,
+    [[maybe_unused]] std::string_view name = "parallelForSegments"
+)
+{
+    if (view.segments.size() < 2)
+    {
+        return;
+    }
+    const auto nSegments = static_cast<localIdx>(view.segments.size() - 1);
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        for (localIdx segI = 0; segI < nSegments; segI++)
+        {
+            for (auto j = view.segments[segI]; j < view.segments[segI + 1]; j++)
+            {
+                kernel(segI, static_cast<localIdx>(j));
+            }
+        }
+    }
+    else
+    {
+        using runOn = typename Executor::exec;
+        using Policy = Kokkos::TeamPolicy<runOn>;
+        const auto segments = view.segments;
+        const auto nTeams = (nSegments + segmentsPerTeam - 1) / segmentsPerTeam;
+        Kokkos::parallel_for(
+            std::string(name),
+            Policy(
+                exec.underlyingExec(),
+                static_cast<int>(nTeams),
+                Kokkos::AUTO,
+                std::min(segmentVectorLength, Policy::vector_length_max())
+            ),
+            KOKKOS_LAMBDA(const typename Policy::member_type& team) {
+                const localIdx first = team.league_rank() * segmentsPerTeam;
+                const localIdx last =
+                    first + segmentsPerTeam < nSegments ? first + segmentsPerTeam : nSegments;
+                Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange(team, first, last),
+                    [&](const localIdx segI) {
+                        Kokkos::parallel_for(
+                            Kokkos::ThreadVectorRange(
+                                team,
+                                static_cast<localIdx>(segments[segI]),
+                                static_cast<localIdx>(segments[segI + 1])
+                            ),
+                            [&](const localIdx j) { kernel(segI, j); }
+                        );
+                    }
+                );
+            }
+        );
+    }
+}
+
+template<typename ValueType, typename IndexType, parallelForSegmentKernel Kernel>
+void parallelFor(
+    const NeoN::Executor& exec,
+    const SegmentedVectorView<ValueType, IndexType>& view,
+    Kernel kernel,
+    std::string_view name = "parallelForSegments"
+)
+{
+    std::visit([&](const auto& e) { parallelFor(e, view, kernel, name); }, exec);
+}
+
+/* @brief reduces the entries of every segment of the view
+ *
+ * The kernel(segI, j, sum) accumulates the entry j of the segment segI into sum, the result of
+ * every segment is passed once to finalize(segI, sum), eg. to store a matrix row sum.
+ * The work is distributed as for the segmented parallelFor, ie. one vector lane per entry.
+ *
+ * @tparam T the type of the reduction, needs to be given explicitly
+ */
+template<
+    typename T,
+    typename Executor,
+    typename ValueType,
+    typename IndexType,
+    typename Kernel,
+    typename Finalize>
+void parallelReduce(
+    [[maybe_unused]] const Executor& exec,
+    const SegmentedVectorView<ValueType, IndexType>& view,
+    Kernel kernel,
+    Finalize finalize,
+    std::string name = "parallelReduceSegments"
+)
+{
+    if (view.segments.size() < 2)
+    {
+        return;
+    }
+    const auto nSegments = static_cast<localIdx>(view.segments.size() - 1);
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        for (localIdx segI = 0; segI < nSegments; segI++)
+        {
+            T sum {};
+            for (auto j = view.segments[segI]; j < view.segments[segI + 1]; j++)
+            {
+                kernel(segI, static_cast<localIdx>(j), sum);
+            }
+            finalize(segI, sum);
+        }
+    }
+    else
+    {
+        using runOn = typename Executor::exec;
+        using Policy = Kokkos::TeamPolicy<runOn>;
+        const auto segments = view.segments;
+        const auto nTeams = (nSegments + segmentsPerTeam - 1) / segmentsPerTeam;
+        Kokkos::parallel_for(
+            name,
+            Policy(
+                exec.underlyingExec(),
+                static_cast<int>(nTeams),
+                Kokkos::AUTO,
+                std::min(segmentVectorLength, Policy::vector_length_max())
+            ),
+            KOKKOS_LAMBDA(const typename Policy::member_type& team) {
+                const localIdx first = team.league_rank() * segmentsPerTeam;
+                const localIdx last =
+                    first + segmentsPerTeam < nSegments ? first + segmentsPerTeam : nSegments;
+                Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange(team, first, last),
+                    [&](const localIdx segI) {
+                        T sum {};
+                        Kokkos::parallel_reduce(
+                            Kokkos::ThreadVectorRange(
+                                team,
+                                static_cast<localIdx>(segments[segI]),
+                                static_cast<localIdx>(segments[segI + 1])
+                            ),
+                            [&](const localIdx j, T& lsum) { kernel(segI, j, lsum); },
+                            sum
+                        );
+                        Kokkos::single(Kokkos::PerThread(team), [&]() { finalize(segI, sum); });
+                    }
+                );
+            }
+        );
+    }
+}
+
+template<typename T, typename ValueType, typename IndexType, typename Kernel, typename Finalize>
+void parallelReduce(
+    const NeoN::Executor& exec,
+    const SegmentedVectorView<ValueType, IndexType>& view,
+    Kernel kernel,
+    Finalize finalize,
+    std::string name = "parallelReduceSegments"
+)
+{
+    std::visit(
+        [&](const auto& e) { parallelReduce<T>(e, view, kernel, finalize, name); }, exec
+    );
+}
+
+/* @brief sums the values of every segment, result[segI] is the sum of the segment segI
+ *
+ * The result needs one entry per segment.
+ */
+template<typename Executor, typename ValueType, typename IndexType>
+void segmentedReduce(
+    const Executor& exec,
+    const SegmentedVectorView<ValueType, IndexType>& view,
+    View<std::remove_const_t<ValueType>> result
+)
+{
+    using T = std::remove_const_t<ValueType>;
+    NF_ASSERT_EQUAL(result.size() + 1, view.segments.size());
+    const auto values = view.values;
+    parallelReduce<T>(
+        exec,
+        view,
+        KOKKOS_LAMBDA(const localIdx, const localIdx j, T& sum) { sum += values[j]; },
+        KOKKOS_LAMBDA(const localIdx segI, const T sum) { result[segI] = sum; },
+        "segmentedReduce"
+    );
+}
+
+template<typename ValueType, typename IndexType>
+void segmentedReduce(
+    const NeoN::Executor& exec,
+    const SegmentedVectorView<ValueType, IndexType>& view,
+    View<std::remove_const_t<ValueType>> result
+)
+{
+    std::visit([&](const auto& e) { segmentedReduce(e, view, result); }, exec);
+}
+
 /**
  * @class SegmentedVector
  * @brief Data structure that stores a segmented fields or a vector of vectors
@@ -186,6 +397,12 @@ public:
      */
     localIdx numSegments() const { return segments_.size() - 1; }
 
+    /**
+     * @brief Get the bytes allocated by the values and the segments.
+     * @return The allocated bytes.
+     */
+    std::size_t memoryBytes() const { return values_.memoryBytes() + segments_.memoryBytes(); }
+
     /**
      * @brief Returns a copy of the segmentedVector on the host
      * @return copy of the segmentedVector on the host
@@ -226,10 +443,175 @@ public:
 
     const Vector<IndexType>& segments() const { return segments_; }
 
+    /**
+     * @brief Get the values, eg. to fill or resize them.
+     * @note Resizing the values requires the segments to be updated accordingly.
+     */
+    Vector<ValueType>& values() { return values_; }
+
+    /**
+     * @brief Get the segments, eg. to rebuild them, see SegmentedVectorBuilder.
+     */
+    Vector<IndexType>& segments() { return segments_; }
+
 private:
 
     Vector<ValueType> values_;
     Vector<IndexType> segments_; //!< stores the [start, end) of segment i at index i, i+1
 };
 
+namespace detail
+{
+
+/* @brief counts the entries of every segment and records the rank of every entry in its segment
+ *
+ * counts[s] is incremented for every entry of segment s and ranks[p] is set to the count of the
+ * segment of entry p before, ie. the ranks of a segment are [0, count).
+ */
+template<typename Executor, typename IndexType, typename SegmentOf>
+void countSegmentRanks(
+    const Executor& exec,
+    localIdx nEntries,
+    SegmentOf segmentOf,
+    View<IndexType> counts,
+    View<IndexType> ranks
+)
+{
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        for (localIdx p = 0; p < nEntries; p++)
+        {
+            ranks[p] = counts[static_cast<localIdx>(segmentOf(p))]++;
+        }
+    }
+    else
+    {
+        parallelFor(
+            exec,
+            {0, nEntries},
+            KOKKOS_LAMBDA(const localIdx p) {
+                ranks[p] = Kokkos::atomic_fetch_add(
+                    &counts[static_cast<localIdx>(segmentOf(p))], IndexType(1)
+                );
+            },
+            "countSegmentRanks"
+        );
+    }
+}
+
+}
+
+/**
+ * @class SegmentedVectorBuilder
+ * @brief Builds a segmented vector from entries which know their segment, eg. a stencil.
+ *
+ * The entries [0, nEntries) are given by two device callables, segmentOf(p) returns the segment
+ * of entry p and valueOf(p) its value. For a cell to face stencil the entries are the sides of
+ * the faces and the segments the cells. The build has two phases:
+ *  1. the entries of every segment are counted, which records the rank of every entry within its
+ *     segment, and the segments are computed by an exclusive scan of the counts,
+ *  2. every entry is written to the start of its segment plus its rank, which requires no
+ *     atomics.
+ * Only the counting uses atomics on parallel executors, hence the order of the entries of a
+ * segment is arbitrary on these unless the segments are sorted, which yields the same result on
+ * every executor.
+ *
+ * The builder keeps the counts and the ranks and the built vector keeps its values and
+ * segments, hence rebuilding, eg. after a change of the topology, reuses the memory.
+ *
+ * @tparam ValueType The type of the values.
+ * @tparam IndexType The type of the segments.
+ */
+template<typename ValueType, typename IndexType = NeoN::localIdx>
+class SegmentedVectorBuilder
+{
+public:
+
+    /**
+     * @brief Creates a builder with empty buffers.
+     * @param exec The executor of the built vectors.
+     */
+    explicit SegmentedVectorBuilder(const Executor& exec) : counts_(exec, 0), ranks_(exec, 0) {}
+
+    /**
+     * @brief Builds the segmented vector of the entries.
+     *
+     * @param result The built vector, its values and segments are resized.
+     * @param nSegments The number of segments, every segmentOf(p) is in [0, nSegments).
+     * @param nEntries The number of entries.
+     * @param segmentOf Returns the segment of an entry.
+     * @param valueOf Returns the value of an entry.
+     * @param sortSegments Whether the values of every segment are sorted in ascending order.
+     */
+    template<typename SegmentOf, typename ValueOf>
+    void build(
+        SegmentedVector<ValueType, IndexType>& result,
+        localIdx nSegments,
+        localIdx nEntries,
+        SegmentOf segmentOf,
+        ValueOf valueOf,
+        bool sortSegments = false
+    )
+    {
+        const auto& exec = counts_.exec();
+        NF_ASSERT(result.exec() == exec, "Executors are not the same.");
+
+        // count, the last count stays zero and yields the total of the scan
+        counts_.resize(nSegments + 1);
+        ranks_.resize(nEntries);
+        fill(counts_, IndexType(0));
+        std::visit(
+            [&](const auto& e)
+            { detail::countSegmentRanks(e, nEntries, segmentOf, counts_.view(), ranks_.view()); },
+            exec
+        );
+        auto& segments = result.segments();
+        segments.resize(nSegments + 1);
+        const IndexType total = exclusiveScan(exec, counts_.view(), segments.view());
+
+        // fill at the precomputed offsets
+        auto& values = result.values();
+        values.resize(static_cast<localIdx>(total));
+        const auto [start, ranks, out] = views(segments, ranks_, values);
+        parallelFor(
+            exec,
+            {0, nEntries},
+            KOKKOS_LAMBDA(const localIdx p) {
+                const auto segI = static_cast<localIdx>(segmentOf(p));
+                out[static_cast<localIdx>(start[segI] + ranks[p])] = valueOf(p);
+            },
+            "SegmentedVectorBuilder::fill"
+        );
+
+        if (sortSegments)
+        {
+            // segments are short, an insertion sort per segment is sufficient
+            parallelFor(
+                exec,
+                {0, nSegments},
+                KOKKOS_LAMBDA(const localIdx segI) {
+                    const auto first = static_cast<localIdx>(start[segI]);
+                    const auto last = static_cast<localIdx>(start[segI + 1]);
+                    for (localIdx i = first + 1; i < last; i++)
+                    {
+                        const ValueType value = out[i];
+                        localIdx j = i;
+                        for (; j > first && value < out[j - 1]; j--)
+                        {
+                            out[j] = out[j - 1];
+                        }
+                        out[j] = value;
+                    }
+                },
+                "SegmentedVectorBuilder::sort"
+            );
+        }
+    }
+
+private:
+
+    Vector<IndexType> counts_; //!< The entries per segment, followed by a zero.
+    Vector<IndexType> ranks_;  //!< The rank of every entry within its segment.
+};
+
 } // namespace NeoN
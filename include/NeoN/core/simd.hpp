@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+
+namespace NeoN
+{
+
+/* @brief whether the explicit SIMD kernels are used on the CPUExecutor
+ *
+ * Set by the NeoN_ENABLE_SIMD option, otherwise the kernels rely on auto vectorization.
+ */
+inline constexpr bool simdEnabled = NF_WITH_SIMD != 0;
+
+using SimdScalar = Kokkos::Experimental::native_simd<scalar>;
+
+using SimdMask = typename SimdScalar::mask_type;
+
+/* @brief the number of lanes of SimdScalar */
+inline constexpr localIdx simdWidth = static_cast<localIdx>(SimdScalar::size());
+
+/* @brief loads simdWidth consecutive values starting at values */
+inline SimdScalar simdLoad(const scalar* values)
+{
+    SimdScalar result;
+    result.copy_from(values, Kokkos::Experimental::element_aligned_tag());
+    return result;
+}
+
+/* @brief stores the lanes to simdWidth consecutive values starting at values */
+inline void simdStore(const SimdScalar& value, scalar* values)
+{
+    value.copy_to(values, Kokkos::Experimental::element_aligned_tag());
+}
+
+/* @brief gathers values[idxs[lane]] into the lanes */
+template<typename IndexType>
+inline SimdScalar simdGather(const scalar* values, const IndexType* idxs)
+{
+    return SimdScalar([&](std::size_t lane) { return values[idxs[lane]]; });
+}
+
+/* @brief parallelFor with an explicit SIMD kernel for the CPUExecutor
+ *
+ * If simdEnabled and exec is a CPUExecutor, simdKernel(start) processes the items
+ * [start, start + simdWidth) of the blocks covering the range and kernel(i) the remainder.
+ * Otherwise kernel is used for all items. The simdKernel is a host lambda, it is never
+ * executed on a device.
+ */
+template<typename SimdKernel, parallelForKernel Kernel>
+void simdParallelFor(
+    const Executor& exec,
+    std::pair<localIdx, localIdx> range,
+    [[maybe_unused]] SimdKernel simdKernel,
+    Kernel kernel,
+    std::string name = "simdParallelFor"
+)
+{
+    if constexpr (simdEnabled)
+    {
+        if (std::holds_alternative<CPUExecutor>(exec))
+        {
+            const auto [start, end] = range;
+            const localIdx nBlocks = (end - start) / simdWidth;
+            const localIdx simdEnd = start + nBlocks * simdWidth;
+            Kokkos::parallel_for(
+                name + "Simd",
+                Kokkos::RangePolicy<CPUExecutor::exec>(
+                    std::get<CPUExecutor>(exec).underlyingExec(), 0, nBlocks
+                ),
+                [=](const localIdx block) { simdKernel(start + block * simdWidth); }
+            );
+            parallelFor(exec, {simdEnd, end}, kernel, name);
+            return;
+        }
+    }
+    parallelFor(exec, range, kernel, name);
+}
+
+}
@@ -44,7 +44,8 @@ public:
         return 10.0 >= time_;
     };
 
-    std::ostream& printExecutionTime(std::ostream& os) const { return os; };
+    /* @brief writes the report of the TimerRegistry */
+    std::ostream& printExecutionTime(std::ostream& os) const;
 
 private:
 
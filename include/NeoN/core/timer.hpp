@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include <mpi.h>
+#endif
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/profiling.hpp"
+#include "NeoN/core/trace.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @struct TimerStats
+ * @brief The accumulated measurements of one timer of the TimerRegistry.
+ */
+struct TimerStats
+{
+    std::string path;  //!< The names of the enclosing timers and the timer, separated by '/'.
+    std::size_t depth; //!< The number of enclosing timers.
+    std::size_t calls; //!< The number of completed scopes.
+    double total;      //!< The accumulated duration in seconds.
+    double max;        //!< The longest duration of a single scope in seconds.
+    double fraction;   //!< The share of total in the total of the enclosing top level timer.
+    std::vector<std::pair<std::string, double>> counters; //!< The accumulated counts by name.
+};
+
+/**
+ * @class TimerRegistry
+ * @brief Accumulates the durations of nested ScopedTimers into a tree of timers.
+ *
+ * A timer is identified by its name and the timers which enclosed it when it was started, hence
+ * the same name inside different scopes yields different timers. Every thread keeps its own
+ * position in the tree, the accumulation is guarded by a mutex, so timers should cover host side
+ * phases like an operator evaluation or a solve and not be used inside of kernels.
+ *
+ * The report lists the calls, total, mean and maximum duration and the share of the enclosing top
+ * level timer, eg. of a time step if the time loop opens a timer for every step. Timers can
+ * additionally accumulate counts like the number of communicated bytes, which are listed below
+ * the timer.
+ *
+ * @ingroup Timing
+ */
+class TimerRegistry
+{
+public:
+
+    /**
+     * @brief Gets the process wide registry.
+     */
+    static TimerRegistry& instance();
+
+    TimerRegistry(const TimerRegistry&) = delete;
+
+    TimerRegistry& operator=(const TimerRegistry&) = delete;
+
+    /**
+     * @brief Checks if ScopedTimers record their durations, enabled by default.
+     */
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Enables or disables the recording, disabled timers only open their profiling region.
+     */
+    void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks if timers constructed with an executor fence it, disabled by default.
+     *
+     * Without the fence asynchronous executors only account for the launch of the kernels.
+     */
+    bool fenceEnabled() const { return fence_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Enables or disables the fences of timers constructed with an executor.
+     */
+    void setFenceEnabled(bool fence) { fence_.store(fence, std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks if finalize writes the report.
+     */
+    bool reportAtFinalize() const { return reportAtFinalize_; }
+
+    /**
+     * @brief Selects whether finalize writes the report to the standard output.
+     */
+    void setReportAtFinalize(bool report) { reportAtFinalize_ = report; }
+
+    /**
+     * @brief Enters the timer of the given name below the current timer of the calling thread.
+     * @param name The name of the timer, by convention Class::phase.
+     */
+    void start(const std::string& name);
+
+    /**
+     * @brief Leaves the current timer of the calling thread and accumulates the duration.
+     * @param seconds The duration of the scope.
+     */
+    void stop(double seconds);
+
+    /**
+     * @brief Adds a value to the named counter of the current timer of the calling thread.
+     * @param name The name of the counter.
+     * @param value The value to accumulate, eg. a number of bytes.
+     */
+    void count(const std::string& name, double value);
+
+    /**
+     * @brief Gets the measurements of all timers in depth-first order.
+     */
+    std::vector<TimerStats> stats() const;
+
+    /**
+     * @brief Removes all timers, there must not be any running timer.
+     */
+    void reset();
+
+    /**
+     * @brief Writes the tree of timers of this process to the stream.
+     */
+    void report(std::ostream& os) const;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /**
+     * @brief Writes the timers merged across the ranks to the stream of the first rank.
+     *
+     * The report lists the minimum, average and maximum total over the ranks for every timer and
+     * counter of the first rank. This is a collective operation on comm.
+     */
+    void report(std::ostream& os, MPI_Comm comm) const;
+#endif
+
+    /**
+     * @brief Writes the report to the standard output if reportAtFinalize is set.
+     *
+     * With MPI support it is called by MPIInit before MPI is finalized and merges the timers of
+     * all ranks.
+     */
+    void finalize() const;
+
+private:
+
+    struct Node
+    {
+        std::string name;
+        Node* parent;
+        std::size_t calls;
+        double total;
+        double max;
+        std::vector<std::pair<std::string, double>> counters;
+        std::vector<std::unique_ptr<Node>> children;
+    };
+
+    TimerRegistry();
+
+    static thread_local Node* current_; //!< The running timer of the thread, nullptr at the root.
+
+    mutable std::mutex mutex_;
+    Node root_;
+    std::atomic<bool> enabled_ {true};
+    std::atomic<bool> fence_ {false};
+    bool reportAtFinalize_ {false};
+};
+
+/**
+ * @class ScopedTimer
+ * @brief Records the lifetime of the object in the TimerRegistry.
+ *
+ * The scope is additionally marked as profiling region for Kokkos Tools. If an executor is given
+ * and fences are enabled in the registry, it is fenced on construction and destruction, so the
+ * duration covers the kernels launched inside of the scope. While the TraceRecorder is enabled,
+ * the scope is also added to the timeline.
+ *
+ * @ingroup Timing
+ */
+class ScopedTimer
+{
+public:
+
+    /**
+     * @brief Starts the timer.
+     * @param name The name of the timer, by convention Class::phase.
+     */
+    explicit ScopedTimer(const std::string& name)
+        : region_(name), active_(TimerRegistry::instance().enabled()), exec_(std::nullopt)
+    {
+        begin(name);
+    }
+
+    /**
+     * @brief Starts the timer after the executor completed its pending work.
+     * @param name The name of the timer, by convention Class::phase.
+     * @param exec The executor, which is fenced if fences are enabled in the registry.
+     */
+    ScopedTimer(const std::string& name, const Executor& exec)
+        : region_(name), active_(TimerRegistry::instance().enabled()), exec_(std::nullopt)
+    {
+        if (active_)
+        {
+            if (TimerRegistry::instance().fenceEnabled())
+            {
+                exec_.emplace(exec);
+                NeoN::fence(exec);
+            }
+        }
+        begin(name);
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    /**
+     * @brief Stops the timer and accumulates the duration.
+     */
+    ~ScopedTimer()
+    {
+        if (active_)
+        {
+            if (exec_)
+            {
+                NeoN::fence(*exec_);
+            }
+            TimerRegistry::instance().stop(elapsed());
+        }
+        if (traceBegin_ >= 0.0)
+        {
+            TraceRecorder::instance().record(traceName_, traceBegin_, TraceRecorder::now());
+        }
+    }
+
+    /**
+     * @brief Gets the seconds since the start, also if the registry is disabled.
+     */
+    double elapsed() const
+    {
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_;
+        return duration.count();
+    }
+
+private:
+
+    ProfilingRegion region_;
+    bool active_;
+    std::optional<Executor> exec_;
+    std::chrono::steady_clock::time_point start_ {};
+    std::string traceName_ {}; //!< The name of the trace event, only set while tracing.
+    double traceBegin_ {-1.0}; //!< The start of the trace event, negative if not traced.
+
+    void begin(const std::string& name)
+    {
+        if (active_)
+        {
+            TimerRegistry::instance().start(name);
+        }
+        if (TraceRecorder::instance().enabled())
+        {
+            traceName_ = name;
+            traceBegin_ = TraceRecorder::now();
+        }
+        start_ = std::chrono::steady_clock::now();
+    }
+};
+
+} // namespace NeoN
@@ -176,6 +176,20 @@ public:
 
     [[nodiscard]] std::vector<std::any>& tokens();
 
+    [[nodiscard]] const std::vector<std::any>& tokens() const;
+
+    /**
+     * @brief Retrieves the index of the value returned by the next call to next.
+     * @return The index of the next value.
+     */
+    [[nodiscard]] size_t nextIndex() const { return nextIndex_; }
+
+    /**
+     * @brief Skips values as if next was called the given number of times.
+     * @param n The number of values to skip.
+     */
+    void skip(size_t n) const { nextIndex_ += n; }
+
 
 private:
 
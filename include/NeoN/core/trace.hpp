@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include <mpi.h>
+#endif
+
+namespace NeoN
+{
+
+/**
+ * @struct TraceEvent
+ * @brief A completed scope of the TraceRecorder.
+ */
+struct TraceEvent
+{
+    std::string name;     //!< The name of the timer or kernel.
+    std::string category; //!< The class of the timer, eg. Communicator, or kernel.
+    double begin;         //!< The start in microseconds since the epoch of the system clock.
+    double duration;      //!< The duration in microseconds.
+    std::size_t thread;   //!< The index of the recording thread, in the order of first use.
+};
+
+/**
+ * @class TraceRecorder
+ * @brief Records the begin and end of ScopedTimers and kernels as a timeline.
+ *
+ * While enabled, every ScopedTimer adds an event, hence the timeline covers the expressions, the
+ * time integrators, the solver phases, the halo exchanges and the I/O. If kernels are recorded too,
+ * the recorder installs Kokkos Tools callbacks for parallel_for, parallel_reduce and parallel_scan,
+ * which replace the callbacks of a loaded tool. Kokkos fences the kernels while callbacks are set,
+ * so their events cover the device work of asynchronous executors.
+ *
+ * The events are written in the Chrome trace format, which is displayed by chrome://tracing and
+ * ui.perfetto.dev, with one process per rank and one track per thread. The timestamps are taken
+ * from the system clock so the ranks of a node share a time axis.
+ *
+ * @ingroup Timing
+ */
+class TraceRecorder
+{
+public:
+
+    /**
+     * @brief Gets the process wide recorder.
+     */
+    static TraceRecorder& instance();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    /**
+     * @brief Checks if events are recorded, disabled by default.
+     */
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Starts recording.
+     * @param kernels Whether the kernels are recorded through Kokkos Tools callbacks, requires an
+     * initialized Kokkos.
+     * @param fileName The file finalize writes the trace to, nothing is written if empty.
+     */
+    void enable(bool kernels = true, const std::string& fileName = "trace.json");
+
+    /**
+     * @brief Stops recording, the recorded events are kept.
+     */
+    void disable();
+
+    /**
+     * @brief Gets the current time in microseconds since the epoch of the system clock.
+     */
+    static double now();
+
+    /**
+     * @brief Adds a completed scope on the calling thread.
+     * @param name The name of the scope, by convention Class::phase.
+     * @param begin The start of the scope, as returned by now.
+     * @param end The end of the scope, as returned by now.
+     */
+    void record(const std::string& name, double begin, double end);
+
+    /**
+     * @brief Gets the recorded events in the order of their completion.
+     */
+    std::vector<TraceEvent> events() const;
+
+    /**
+     * @brief Removes all recorded events.
+     */
+    void clear();
+
+    /**
+     * @brief Writes the events of this process in the Chrome trace format.
+     * @param os The stream to write to.
+     */
+    void write(std::ostream& os) const;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /**
+     * @brief Writes the events of all ranks in the Chrome trace format to the stream of the first
+     * rank, the process id of an event is its rank. This is a collective operation on comm.
+     * @param os The stream to write to.
+     * @param comm The communicator of the ranks.
+     */
+    void write(std::ostream& os, MPI_Comm comm) const;
+#endif
+
+    /**
+     * @brief Writes the trace to the file given to enable, once.
+     *
+     * It is called when Kokkos is finalized and, with MPI support, by MPIInit before MPI is
+     * finalized, which merges the events of all ranks into the file of the first rank.
+     */
+    void finalize();
+
+private:
+
+    struct PendingKernel
+    {
+        std::string name;
+        double begin;
+        std::size_t thread;
+    };
+
+    TraceRecorder() = default;
+
+    static std::size_t threadIndex();
+
+    static void beginKernel(const char* name, std::uint32_t devId, std::uint64_t* kernelId);
+
+    static void endKernel(std::uint64_t kernelId);
+
+    void installKernelCallbacks();
+
+    mutable std::mutex mutex_;
+    std::vector<TraceEvent> events_;
+    std::unordered_map<std::uint64_t, PendingKernel> pending_;
+    std::atomic<bool> enabled_ {false};
+    std::atomic<std::uint64_t> nextKernelId_ {0};
+    std::string fileName_;
+    bool kernelCallbacks_ {false};
+    bool finalizeHook_ {false};
+    bool written_ {false};
+};
+
+} // namespace NeoN
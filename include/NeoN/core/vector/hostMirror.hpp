@@ -0,0 +1,310 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <variant>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/view.hpp"
+
+namespace NeoN
+{
+
+namespace detail
+{
+
+/**
+ * @brief Checks if the memory of the executor can be accessed from the host.
+ */
+inline bool hostAccessible(const Executor& exec)
+{
+    return std::visit(
+        [](const auto& e)
+        {
+            using MemorySpace =
+                typename decltype(e.createKokkosView(static_cast<int*>(nullptr), 0))::memory_space;
+            return Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible;
+        },
+        exec
+    );
+}
+
+}
+
+/**
+ * @class HostMirror
+ * @brief A persistent host copy of a Vector, which is reused by repeated transfers.
+ *
+ * The host buffer is allocated lazily in pinned memory on the first transfer and only grows
+ * afterwards. Transfers are skipped if the mirror already holds the data, ie. syncToHost copies
+ * only if the version of the vector changed since the last synchronization and syncToDevice
+ * copies only if the host data was modified through the mutable view() or the vector changed.
+ * If the memory of the executor is accessible from the host, the mirror aliases the data of the
+ * vector and neither allocates nor copies, writes through view() then modify the vector
+ * directly.
+ *
+ * The asynchronous transfers are enqueued on the execution space instance of the executor of the
+ * vector, the host data is accessed only after the mirror waited for their completion. The
+ * vector must not be destroyed or resized before an asynchronous transfer has completed.
+ *
+ * @tparam ValueType The value type of the vector.
+ *
+ * @ingroup Vectors
+ */
+template<typename ValueType>
+class HostMirror
+{
+public:
+
+    /**
+     * @brief Create an empty mirror, the host memory is allocated by the first transfer.
+     */
+    HostMirror() = default;
+
+    /**
+     * @brief Create a mirror holding the data of a vector.
+     * @param vec The vector to mirror.
+     */
+    explicit HostMirror(const Vector<ValueType>& vec) { syncToHost(vec); }
+
+    // copies would share the host buffer
+    HostMirror(const HostMirror&) = delete;
+
+    HostMirror& operator=(const HostMirror&) = delete;
+
+    HostMirror(HostMirror&&) = default;
+
+    HostMirror& operator=(HostMirror&&) = default;
+
+    ~HostMirror() { fence(); }
+
+    /**
+     * @brief Copies the data of the vector to the host unless the mirror holds it already.
+     * @param vec The vector to mirror.
+     */
+    void syncToHost(const Vector<ValueType>& vec)
+    {
+        syncToHostAsync(vec);
+        fence();
+    }
+
+    /**
+     * @brief Enqueues the copy of the data of the vector to the host on its executor.
+     * @param vec The vector to mirror.
+     *
+     * Host modifications which were not synchronized to a vector are overwritten.
+     */
+    void syncToHostAsync(const Vector<ValueType>& vec)
+    {
+        fence();
+        if (holds(vec) && !modified_)
+        {
+            return;
+        }
+        mirror(vec);
+        modified_ = false;
+        version_ = vec.version();
+        if (aliased_)
+        {
+            return;
+        }
+        enqueueCopyToHost(vec.exec(), vec.data());
+    }
+
+    /**
+     * @brief Copies the host data to the vector if it was modified or the vector changed.
+     * @param vec The vector to update, it is resized to the size of the mirror.
+     */
+    void syncToDevice(Vector<ValueType>& vec)
+    {
+        syncToDeviceAsync(vec);
+        fence();
+    }
+
+    /**
+     * @brief Enqueues the copy of the host data to the vector on its executor.
+     * @param vec The vector to update, it is resized to the size of the mirror.
+     */
+    void syncToDeviceAsync(Vector<ValueType>& vec)
+    {
+        fence();
+        if (holds(vec) && !modified_)
+        {
+            return;
+        }
+        if (vec.size() != size_)
+        {
+            vec.resize(size_);
+        }
+        // the mutable access marks the vector as modified
+        ValueType* dst = vec.data();
+        if (dst != data_)
+        {
+            enqueueCopyToDevice(vec.exec(), dst);
+        }
+        modified_ = false;
+        vec_ = dst;
+        aliased_ = dst == data_;
+        version_ = vec.version();
+    }
+
+    /**
+     * @brief Marks the host data as outdated, the next syncToHost copies but keeps the buffer.
+     *
+     * Needed if the vector was replaced by one which may reuse its memory and version.
+     */
+    void invalidate()
+    {
+        fence();
+        vec_ = nullptr;
+    }
+
+    /**
+     * @brief Blocks until the asynchronous transfers of this mirror are completed.
+     */
+    void fence() const
+    {
+        if (pending_)
+        {
+            NeoN::fence(exec_);
+            pending_ = false;
+        }
+    }
+
+    /**
+     * @brief Checks if the host data was modified since the last synchronization.
+     */
+    [[nodiscard]] bool modified() const { return modified_; }
+
+    /**
+     * @brief Checks if the mirror aliases the memory of the last synchronized vector.
+     */
+    [[nodiscard]] bool aliased() const { return aliased_; }
+
+    /**
+     * @brief Gets the number of mirrored elements.
+     */
+    [[nodiscard]] localIdx size() const { return size_; }
+
+    /**
+     * @brief Gets the host data as a view, the data is marked as modified.
+     * @return View of the host data.
+     */
+    [[nodiscard]] View<ValueType> view()
+    {
+        fence();
+        modified_ = true;
+        return View<ValueType>(data_, static_cast<size_t>(size_));
+    }
+
+    /**
+     * @brief Gets the host data as a view.
+     * @return View of the host data.
+     */
+    [[nodiscard]] View<const ValueType> view() const
+    {
+        fence();
+        return View<const ValueType>(data_, static_cast<size_t>(size_));
+    }
+
+    /**
+     * @brief Direct access to the host data.
+     * @return Pointer to the first element of the host data.
+     */
+    [[nodiscard]] const ValueType* data() const
+    {
+        fence();
+        return data_;
+    }
+
+private:
+
+    using HostView = Kokkos::View<ValueType*, detail::HostPinnedSpace>;
+
+    using UnmanagedHostView =
+        Kokkos::View<ValueType*, detail::HostPinnedSpace, Kokkos::MemoryUnmanaged>;
+
+    HostView buffer_ {};                //!< The host memory, allocated on first use.
+    ValueType* data_ {nullptr};         //!< The host data, the buffer or the aliased vector.
+    const ValueType* vec_ {nullptr};    //!< The data of the last synchronized vector.
+    localIdx size_ {0};                 //!< The number of mirrored elements.
+    std::size_t version_ {0};           //!< The version of the last synchronized vector.
+    bool modified_ {false};             //!< Whether the host data was modified.
+    bool aliased_ {false};              //!< Whether data_ is the memory of the vector.
+    Executor exec_ {SerialExecutor {}}; //!< The executor of the pending transfers.
+    mutable bool pending_ {false};      //!< Whether transfers need to be waited for.
+
+    /**
+     * @brief Checks if the mirror holds the current data of the vector.
+     */
+    bool holds(const Vector<ValueType>& vec) const
+    {
+        return vec_ == vec.data() && size_ == vec.size() && version_ == vec.version();
+    }
+
+    /**
+     * @brief Points the host data to the vector or to a buffer of sufficient size.
+     */
+    void mirror(const Vector<ValueType>& vec)
+    {
+        size_ = vec.size();
+        vec_ = vec.data();
+        aliased_ = detail::hostAccessible(vec.exec());
+        if (aliased_)
+        {
+            // the vector is only written through the mirror if it is synced with syncToDevice
+            data_ = const_cast<ValueType*>(vec.data());
+            return;
+        }
+        if (buffer_.extent(0) < static_cast<size_t>(size_))
+        {
+            buffer_ = HostView(
+                Kokkos::view_alloc(Kokkos::WithoutInitializing, "HostMirror"),
+                static_cast<size_t>(size_)
+            );
+        }
+        data_ = buffer_.data();
+    }
+
+    /**
+     * @brief Enqueues the copy from the memory of the executor to the host data.
+     */
+    void enqueueCopyToHost(const Executor& exec, const ValueType* src)
+    {
+        const auto size = static_cast<size_t>(size_);
+        const UnmanagedHostView dst(data_, size);
+        std::visit(
+            [&](const auto& e)
+            { Kokkos::deep_copy(e.underlyingExec(), dst, e.createKokkosView(src, size)); },
+            exec
+        );
+        exec_ = exec;
+        pending_ = true;
+    }
+
+    /**
+     * @brief Enqueues the copy from the host data to the memory of the executor.
+     */
+    void enqueueCopyToDevice(const Executor& exec, ValueType* dst)
+    {
+        const auto size = static_cast<size_t>(size_);
+        const UnmanagedHostView src(data_, size);
+        std::visit(
+            [&](const auto& e)
+            { Kokkos::deep_copy(e.underlyingExec(), e.createKokkosView(dst, size), src); },
+            exec
+        );
+        exec_ = exec;
+        pending_ = true;
+    }
+};
+
+} // namespace NeoN
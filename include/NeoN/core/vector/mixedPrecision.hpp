@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/vector/vector.hpp"
+
+namespace NeoN
+{
+
+/* @brief the type kernels compute in for values stored as StorageType
+ *
+ * Values stored in reduced precision are promoted to scalar after loading, so that sums and
+ * products are evaluated in the precision of the solver and only the memory traffic is reduced.
+ */
+template<typename StorageType>
+struct ComputeType
+{
+    using type = StorageType;
+};
+
+template<>
+struct ComputeType<float>
+{
+    using type = std::conditional_t<(sizeof(scalar) > sizeof(float)), scalar, float>;
+};
+
+template<typename StorageType>
+using computeType_t = typename ComputeType<StorageType>::type;
+
+/* @brief loads a stored value in the compute precision */
+template<typename StorageType>
+KOKKOS_INLINE_FUNCTION computeType_t<StorageType> load(const StorageType& value)
+{
+    return static_cast<computeType_t<StorageType>>(value);
+}
+
+/* @brief copies src into dst converting every value to the value type of dst
+ *
+ * @warning the vectors need to have the same size and executor
+ */
+template<typename DstType, typename SrcType>
+void convertPrecision(const Vector<SrcType>& src, Vector<DstType>& dst)
+{
+    NF_ASSERT(src.exec() == dst.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(src.size(), dst.size());
+    const auto srcView = src.view();
+    auto dstView = dst.view();
+    parallelFor(
+        src.exec(),
+        {0, src.size()},
+        KOKKOS_LAMBDA(const localIdx i) { dstView[i] = static_cast<DstType>(srcView[i]); },
+        "convertPrecision"
+    );
+}
+
+/* @brief returns a copy of src with the values stored as DstType, eg. the float storage variant
+ * of a geometry field like the magnitude of the face areas
+ */
+template<typename DstType, typename SrcType>
+Vector<DstType> withPrecision(const Vector<SrcType>& src)
+{
+    Vector<DstType> dst(src.exec(), src.size());
+    convertPrecision(src, dst);
+    return dst;
+}
+
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/view.hpp"
+
+namespace NeoN
+{
+
+/* @brief the memory layout of a field of Vec3 values */
+enum class VectorLayout
+{
+    AoS, // Vector<Vec3>, the components of a value are contiguous
+    SoA  // Vec3SoAVector, each component is stored in a contiguous array
+};
+
+/* @class Vec3SoAView
+ * @brief A view of Vec3 values stored as three contiguous component arrays
+ *
+ * The read access returns the assembled Vec3 by value, hence kernels templated on the view type
+ * work with View<const Vec3> and Vec3SoAView<const scalar>. Each component is loaded with unit
+ * stride, which allows CPU kernels to vectorize and GPU loads to coalesce.
+ *
+ * @tparam ScalarType scalar or const scalar
+ */
+template<typename ScalarType>
+class Vec3SoAView
+{
+public:
+
+    Vec3SoAView() = default;
+
+    Vec3SoAView(View<ScalarType> x, View<ScalarType> y, View<ScalarType> z) : cmpts_ {x, y, z} {}
+
+    /* @brief conversion of a mutable to a read only view */
+    template<typename OtherScalarType>
+        requires std::is_same_v<ScalarType, const OtherScalarType>
+    Vec3SoAView(const Vec3SoAView<OtherScalarType>& other)
+        : cmpts_ {other.component(0), other.component(1), other.component(2)}
+    {}
+
+    KOKKOS_INLINE_FUNCTION
+    Vec3 operator[](const localIdx i) const
+    {
+        return Vec3(cmpts_[0][i], cmpts_[1][i], cmpts_[2][i]);
+    }
+
+    /* @brief writes the value i, only available for mutable views */
+    KOKKOS_INLINE_FUNCTION
+    void set(const localIdx i, const Vec3& value) const
+        requires(!std::is_const_v<ScalarType>)
+    {
+        cmpts_[0][i] = value[0];
+        cmpts_[1][i] = value[1];
+        cmpts_[2][i] = value[2];
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    localIdx size() const { return cmpts_[0].size(); }
+
+    /* @brief the contiguous array of the component d */
+    KOKKOS_INLINE_FUNCTION
+    View<ScalarType> component(const size_t d) const { return cmpts_[d]; }
+
+private:
+
+    View<ScalarType> cmpts_[3];
+};
+
+/* @class Vec3SoAVector
+ * @brief A field of Vec3 values stored as three contiguous scalar arrays
+ *
+ * This is the structure of arrays alternative to Vector<Vec3>, eg. for the face areas, cell
+ * centres or gradients read by load bound kernels.
+ */
+class Vec3SoAVector
+{
+public:
+
+    Vec3SoAVector(const Executor& exec, localIdx size);
+
+    /* @brief creates the structure of arrays copy of a field of Vec3 values */
+    explicit Vec3SoAVector(const Vector<Vec3>& in);
+
+    /* @brief returns the array of structs copy of the field */
+    [[nodiscard]] Vector<Vec3> toAoS() const;
+
+    /* @brief copies the values of in into this field, the sizes have to match */
+    void assign(const Vector<Vec3>& in);
+
+    [[nodiscard]] Vec3SoAView<scalar> view();
+
+    [[nodiscard]] Vec3SoAView<const scalar> view() const;
+
+    [[nodiscard]] const Vector<scalar>& component(const size_t d) const { return cmpts_[d]; }
+
+    [[nodiscard]] Vector<scalar>& component(const size_t d) { return cmpts_[d]; }
+
+    [[nodiscard]] localIdx size() const { return cmpts_[0].size(); }
+
+    [[nodiscard]] const Executor& exec() const { return cmpts_[0].exec(); }
+
+private:
+
+    Vector<scalar> cmpts_[3];
+};
+
+}
@@ -8,17 +8,29 @@
 
 #include "NeoN/core/error.hpp"
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/vector/vectorExpression.hpp"
 #include "NeoN/core/vector/vectorFreeFunctions.hpp"
 #include "NeoN/core/view.hpp"
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 
 namespace NeoN
 {
 
+namespace detail
+{
+/**
+ * @brief Returns a new version number, the numbers are unique over all vectors.
+ */
+std::size_t nextVectorVersion();
+}
+
 /**
  * @class Vector
  * @brief A class to contain the data and executors for a field and define some basic operations.
@@ -54,6 +66,20 @@ public:
         Executor hostExec = SerialExecutor()
     );
 
+    /**
+     * @brief Create a Vector which refers to external memory without copying or owning it
+     * @param exec  Executor whose memory space holds the data
+     * @param data  Pointer to the external data, it has to outlive the Vector
+     * @param size  size of the field
+     *
+     * This allows to run the operators on the memory of a coupled application. The data is
+     * neither freed nor reallocated, hence the Vector can not grow beyond size. Copies of the
+     * Vector own their data. To run a field on external memory, swap its internal vector with the
+     * wrapped Vector, see swap.
+     */
+    [[nodiscard]] static Vector<ValueType>
+    wrap(const Executor& exec, ValueType* data, localIdx size);
+
     /**
      * @brief Create a Vector with a given size on an executor and uniform value
      * @param exec  Executor associated to the field
@@ -88,6 +114,16 @@ public:
      */
     Vector(Vector<ValueType>&& rhs) noexcept;
 
+    /**
+     * @brief Create a Vector by evaluating an arithmetic expression in a single kernel.
+     * @param expr The expression to evaluate.
+     */
+    template<typename Evaluator>
+    Vector(const VectorExpression<ValueType, Evaluator>& expr) : Vector(expr.exec(), expr.size())
+    {
+        assignExpression(expr);
+    }
+
     /**
      * @brief Destroy the Vector object.
      */
@@ -111,12 +147,33 @@ public:
      */
     [[nodiscard]] Vector<ValueType> copyToExecutor(Executor dstExec) const;
 
+    /**
+     * @brief Enqueues the copy of the data to a new field on a specific executor.
+     * @param dstExec The executor on which the data should be copied.
+     * @returns The copy and a token, the copy may only be accessed after the token was waited
+     * for.
+     *
+     * The copy is enqueued on the executor of the device, if any, else on dstExec, hence it is
+     * ordered after the kernels enqueued on it before. Copies between a device and the host run
+     * asynchronously to the host only if the host memory is page locked, see
+     * setPinnedHostMemory. This field must not be modified or destroyed before the copy is
+     * completed.
+     */
+    [[nodiscard]] std::pair<Vector<ValueType>, CompletionToken>
+    copyToExecutorAsync(Executor dstExec) const;
+
     /**
      * @brief Returns a copy of the field back to the host.
      * @returns A copy of the field on the host.
      */
     [[nodiscard]] Vector<ValueType> copyToHost() const;
 
+    /**
+     * @brief Enqueues the copy of the field to the host, see copyToExecutorAsync.
+     * @returns The copy on the host and a token, which needs to be waited for.
+     */
+    [[nodiscard]] std::pair<Vector<ValueType>, CompletionToken> copyToHostAsync() const;
+
     /**
      * @brief Copies the data (from anywhere) to a parsed host field.
      * @param result The field into which the data must be copied. Must be
@@ -147,6 +204,23 @@ public:
      */
     void operator=(const Vector<ValueType>& rhs);
 
+    /**
+     * @brief Assignment operator, evaluates an arithmetic expression in a single kernel.
+     * @param expr The expression to evaluate.
+     *
+     * @warning This field will be sized to the size of the expression.
+     */
+    template<typename Evaluator>
+    void operator=(const VectorExpression<ValueType, Evaluator>& expr)
+    {
+        NF_ASSERT(exec_ == expr.exec(), "Executors are not the same");
+        if (size_ != expr.size())
+        {
+            resize(expr.size());
+        }
+        assignExpression(expr);
+    }
+
     /**
      * @brief Arithmetic add operator, addition of a second field.
      * @param rhs The field to add with this field.
@@ -161,28 +235,6 @@ public:
      */
     Vector<ValueType>& operator-=(const Vector<ValueType>& rhs);
 
-    /**
-     * @brief Arithmetic multiply operator, multiply by a second field.
-     * @param rhs The field to subtract from this field.
-     * @returns The result of the multiply.
-     *
-     * @note We exclude types where the multiplication operator is ambiguous, e.g. vec3.
-     *       See notes regarding concepts https://eel.is/c++draft/expr.prim.req
-     */
-    [[nodiscard]] Vector<ValueType> operator*(const Vector<ValueType>& rhs)
-        requires requires(ValueType a, ValueType b) { a* b; };
-
-    /**
-     * @brief Arithmetic multiply operator, multiplies every cell in the field by a scalar.
-     * @param rhs The scalar to multiply with the field.
-     * @returns The result of the multiplication.
-     *
-     * @note We exclude types where the multiplication operator is ambiguous, e.g. vec3.
-     *       See notes regarding concepts https://eel.is/c++draft/expr.prim.req
-     */
-    [[nodiscard]] Vector<ValueType> operator*(const scalar rhs)
-        requires requires(ValueType a, scalar b) { a* b; };
-
     /**
      * @brief Assignment multiply operator, multiplies this field by another field element-wise.
      * @param rhs The field to multiply with this field.
@@ -207,14 +259,53 @@ public:
     /**
      * @brief Resizes the field to a new size.
      * @param size The new size to set the field to.
+     *
+     * The allocation is never shrunk, thus temporaries alternating between sizes only allocate
+     * once the largest size is reached. The values up to the smaller of both sizes are kept.
      */
     void resize(const localIdx size);
 
+    /**
+     * @brief Allocates memory for at least the given number of values without changing the size.
+     * @param capacity The number of values the field can hold without reallocating.
+     */
+    void reserve(const localIdx capacity);
+
+    /**
+     * @brief Releases the memory allocated beyond the size of the field.
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief Gets the number of values the field can hold without reallocating.
+     * @return The capacity of the field.
+     */
+    [[nodiscard]] localIdx capacity() const { return capacity_; }
+
+    /**
+     * @brief Exchanges the data with another field without copying it.
+     * @param other The field to swap with, it must have the same executor.
+     *
+     * The ownership is exchanged with the data, ie. a field swapped with a wrapped Vector refers
+     * to the external memory afterwards.
+     */
+    void swap(Vector<ValueType>& other);
+
+    /**
+     * @brief Checks whether the field owns its data, see wrap.
+     * @return False if the field refers to external memory.
+     */
+    [[nodiscard]] bool ownsData() const { return owning_; }
+
     /**
      * @brief Direct access to the underlying field data
      * @return Pointer to the first cell data in the field.
      */
-    [[nodiscard]] ValueType* data() { return data_; }
+    [[nodiscard]] ValueType* data()
+    {
+        version_ = detail::nextVectorVersion();
+        return data_;
+    }
 
     /**
      * @brief Direct access to the underlying field data
@@ -240,12 +331,32 @@ public:
      */
     [[nodiscard]] label ssize() const { return static_cast<label>(size_); }
 
+    /**
+     * @brief Gets the bytes allocated by the field.
+     * @return The capacity of the field times the size of the value type, zero for external
+     * memory.
+     */
+    [[nodiscard]] std::size_t memoryBytes() const
+    {
+        return owning_ ? static_cast<std::size_t>(capacity_) * sizeof(ValueType) : 0;
+    }
+
     /**
      * @brief Checks if the field is empty.
      * @return True if the field is empty, false otherwise.
      */
     [[nodiscard]] bool empty() const { return size() == 0; }
 
+    /**
+     * @brief Gets the version of the field data.
+     * @return A number which changes whenever the data might have been modified.
+     *
+     * Every mutable access, ie. the non-const view() and data(), is counted as a modification,
+     * the const accessors leave the version unchanged. The versions are unique over all vectors,
+     * hence equal versions imply the same data, which allows to skip recomputations.
+     */
+    [[nodiscard]] std::size_t version() const { return version_; }
+
     // return of a temporary --> invalid memory access
     View<ValueType> view() && = delete;
 
@@ -258,6 +369,7 @@ public:
      */
     [[nodiscard]] View<ValueType> view() &
     {
+        version_ = detail::nextVectorVersion();
         return View<ValueType>(data_, static_cast<size_t>(size_));
     }
 
@@ -282,6 +394,7 @@ public:
      */
     [[nodiscard]] View<ValueType> view(std::pair<localIdx, localIdx> range) &
     {
+        version_ = detail::nextVectorVersion();
         return View<ValueType>(
             data_ + range.first, static_cast<size_t>(range.second - range.first)
         );
@@ -307,32 +420,40 @@ public:
 private:
 
     localIdx size_ {0};         //!< Size of the field.
+    localIdx capacity_ {0};     //!< Number of values allocated for the field.
     ValueType* data_ {nullptr}; //!< Pointer to the field data.
     const Executor exec_;       //!< Executor associated with the field. (CPU, GPU, openMP, etc.)
+    std::size_t version_ {detail::nextVectorVersion()}; //!< Version of the field data.
+    bool owning_ {true}; //!< Whether the data is allocated by the field, see wrap.
+
+    /**
+     * @brief Reallocates the data to the given capacity keeping the values that fit.
+     * @param capacity The new capacity.
+     */
+    void reallocate(const localIdx capacity);
 
     /**
      * @brief Checks if two fields are the same size and have the same executor.
      * @param rhs The field to compare with.
      */
     void validateOtherVector(const Vector<ValueType>& rhs) const;
-};
 
-/**
- * @brief Arithmetic add operator, addition of two fields.
- * @param lhs The field to add with this field.
- * @param rhs The field to add with this field.
- * @returns The result of the addition.
- */
-template<typename ValueType>
-[[nodiscard]] Vector<ValueType> operator+(Vector<ValueType> lhs, const Vector<ValueType>& rhs);
-
-/**
- * @brief Arithmetic subtraction operator, subtraction one field from another.
- * @param lhs The field to subtract from.
- * @param rhs The field to subtract by.
- * @returns The result of the subtraction.
- */
-template<typename ValueType>
-[[nodiscard]] Vector<ValueType> operator-(Vector<ValueType> lhs, const Vector<ValueType>& rhs);
+    /**
+     * @brief Evaluates an expression into this field, which must be sized accordingly.
+     * @param expr The expression to evaluate.
+     */
+    template<typename Evaluator>
+    void assignExpression(const VectorExpression<ValueType, Evaluator>& expr)
+    {
+        auto dst = view();
+        const auto eval = expr.evaluator();
+        parallelFor(
+            exec_,
+            {0, size_},
+            KOKKOS_LAMBDA(const localIdx i) { dst[i] = eval(i); },
+            "assignVectorExpression"
+        );
+    }
+};
 
 } // namespace NeoN
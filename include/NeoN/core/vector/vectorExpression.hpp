@@ -0,0 +1,366 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/view.hpp"
+
+namespace NeoN
+{
+
+template<typename ValueType>
+class Vector;
+
+/**
+ * @class VectorExpression
+ * @brief A lazily evaluated, element-wise arithmetic expression of Vectors.
+ *
+ * The arithmetic operators of Vector return expressions instead of new Vectors. The whole
+ * expression is evaluated in a single kernel once it is assigned to a Vector, so that
+ * `a = b + c * d` neither allocates temporaries nor launches more than one kernel.
+ *
+ * @tparam ValueType The value type of the resulting Vector.
+ * @tparam Evaluator A device copyable functor returning the value at a given index.
+ *
+ * Temporary Vector operands are moved into the expression and kept alive by it, hence
+ * `auto e = a + b * createVector();` can be evaluated later. Named Vector operands are referenced
+ * by views, they must neither be destroyed nor resized before the expression is evaluated.
+ *
+ * @ingroup Vectors
+ */
+template<typename ValueType, typename Evaluator>
+class VectorExpression
+{
+public:
+
+    using ExpressionValueType = ValueType;
+
+    /** @brief The temporary operands owned by an expression. */
+    using Operands = std::vector<std::shared_ptr<const void>>;
+
+    VectorExpression(
+        const Executor& exec, localIdx size, Evaluator evaluator, Operands operands = {}
+    )
+        : exec_(exec), size_(size), evaluator_(evaluator), operands_(std::move(operands))
+    {}
+
+    /**
+     * @brief Gets the executor on which the expression is evaluated.
+     */
+    [[nodiscard]] const Executor& exec() const { return exec_; }
+
+    /**
+     * @brief Gets the size of the resulting Vector.
+     */
+    [[nodiscard]] localIdx size() const { return size_; }
+
+    /**
+     * @brief Gets the functor evaluating the expression at a given index.
+     */
+    [[nodiscard]] const Evaluator& evaluator() const { return evaluator_; }
+
+    /**
+     * @brief Gets the temporary operands the views of the evaluator point into.
+     */
+    [[nodiscard]] const Operands& operands() const { return operands_; }
+
+private:
+
+    Executor exec_;        //!< Executor the operands reside on.
+    localIdx size_;        //!< Size of the operands.
+    Evaluator evaluator_; //!< Functor evaluating the expression.
+    Operands operands_;    //!< Temporary operands kept alive by the expression.
+};
+
+namespace detail
+{
+
+template<typename ValueType>
+struct VectorLeaf
+{
+    View<const ValueType> view;
+
+    KOKKOS_INLINE_FUNCTION
+    ValueType operator()(const localIdx i) const { return view[i]; }
+};
+
+template<typename Lhs, typename Rhs>
+struct AddEvaluator
+{
+    Lhs lhs;
+    Rhs rhs;
+
+    KOKKOS_INLINE_FUNCTION
+    auto operator()(const localIdx i) const { return lhs(i) + rhs(i); }
+};
+
+template<typename Lhs, typename Rhs>
+struct SubEvaluator
+{
+    Lhs lhs;
+    Rhs rhs;
+
+    KOKKOS_INLINE_FUNCTION
+    auto operator()(const localIdx i) const { return lhs(i) - rhs(i); }
+};
+
+template<typename Lhs, typename Rhs>
+struct MulEvaluator
+{
+    Lhs lhs;
+    Rhs rhs;
+
+    KOKKOS_INLINE_FUNCTION
+    auto operator()(const localIdx i) const { return lhs(i) * rhs(i); }
+};
+
+template<typename Inner>
+struct ScaleEvaluator
+{
+    Inner inner;
+    scalar value;
+
+    KOKKOS_INLINE_FUNCTION
+    auto operator()(const localIdx i) const { return inner(i) * value; }
+};
+
+template<typename ValueType>
+VectorExpression<ValueType, VectorLeaf<ValueType>> toExpression(const Vector<ValueType>& vec)
+{
+    return {vec.exec(), vec.size(), VectorLeaf<ValueType> {vec.view()}};
+}
+
+/* @brief moves a temporary Vector into the expression, which owns it */
+template<typename ValueType>
+VectorExpression<ValueType, VectorLeaf<ValueType>> toExpression(Vector<ValueType>&& vec)
+{
+    auto owned = std::make_shared<const Vector<ValueType>>(std::move(vec));
+    return {owned->exec(), owned->size(), VectorLeaf<ValueType> {owned->view()}, {owned}};
+}
+
+template<typename ValueType, typename Evaluator>
+const VectorExpression<ValueType, Evaluator>&
+toExpression(const VectorExpression<ValueType, Evaluator>& expr)
+{
+    return expr;
+}
+
+template<typename LhsExpr, typename RhsExpr>
+auto joinOperands(const LhsExpr& lhs, const RhsExpr& rhs)
+{
+    auto operands = lhs.operands();
+    operands.insert(operands.end(), rhs.operands().begin(), rhs.operands().end());
+    return operands;
+}
+
+template<template<typename, typename> class BinaryEvaluator, typename LhsExpr, typename RhsExpr>
+auto binaryExpression(const LhsExpr& lhs, const RhsExpr& rhs)
+{
+    NF_DEBUG_ASSERT(lhs.size() == rhs.size(), "Vectors are not the same size.");
+    NF_DEBUG_ASSERT(lhs.exec() == rhs.exec(), "Executors are not the same.");
+    using ValueType = typename LhsExpr::ExpressionValueType;
+    using Evaluator = BinaryEvaluator<
+        std::decay_t<decltype(lhs.evaluator())>,
+        std::decay_t<decltype(rhs.evaluator())>>;
+    return VectorExpression<ValueType, Evaluator>(
+        lhs.exec(),
+        lhs.size(),
+        Evaluator {lhs.evaluator(), rhs.evaluator()},
+        joinOperands(lhs, rhs)
+    );
+}
+
+template<typename InnerExpr>
+auto scaleExpression(const InnerExpr& inner, const scalar value)
+{
+    using ValueType = typename InnerExpr::ExpressionValueType;
+    using Evaluator = ScaleEvaluator<std::decay_t<decltype(inner.evaluator())>>;
+    return VectorExpression<ValueType, Evaluator>(
+        inner.exec(), inner.size(), Evaluator {inner.evaluator(), value}, inner.operands()
+    );
+}
+
+}
+
+template<typename ValueType>
+concept VectorAddable = requires(ValueType a, ValueType b) { a + b; };
+
+template<typename ValueType>
+concept VectorMultipliable = requires(ValueType a, ValueType b) { a* b; };
+
+template<typename ValueType>
+concept VectorScalable = requires(ValueType a, scalar b) { a* b; };
+
+/* @brief defines the binary operator for all combinations of Vector and VectorExpression
+ * operands, the overloads are more specialised than the generic dsl operators. Temporary Vectors
+ * are moved into the expression.
+ */
+#define NN_VECTOR_EXPRESSION_BINARY_OPERATOR(_op, _evaluator, _constraint)                         \
+    template<typename ValueType>                                                                   \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(const Vector<ValueType>& lhs, const Vector<ValueType>& rhs)    \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(                                       \
+            detail::toExpression(lhs), detail::toExpression(rhs)                                   \
+        );                                                                                         \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType, typename Evaluator>                                               \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(                                                               \
+        const VectorExpression<ValueType, Evaluator>& lhs, const Vector<ValueType>& rhs            \
+    )                                                                                              \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(lhs, detail::toExpression(rhs));       \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType, typename Evaluator>                                               \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(                                                               \
+        const Vector<ValueType>& lhs, const VectorExpression<ValueType, Evaluator>& rhs            \
+    )                                                                                              \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(detail::toExpression(lhs), rhs);       \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType, typename LhsEvaluator, typename RhsEvaluator>                     \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(                                                               \
+        const VectorExpression<ValueType, LhsEvaluator>& lhs,                                      \
+        const VectorExpression<ValueType, RhsEvaluator>& rhs                                       \
+    )                                                                                              \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(lhs, rhs);                             \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType>                                                                   \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(Vector<ValueType>&& lhs, const Vector<ValueType>& rhs)         \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(                                       \
+            detail::toExpression(std::move(lhs)), detail::toExpression(rhs)                        \
+        );                                                                                         \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType>                                                                   \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(const Vector<ValueType>& lhs, Vector<ValueType>&& rhs)         \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(                                       \
+            detail::toExpression(lhs), detail::toExpression(std::move(rhs))                        \
+        );                                                                                         \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType>                                                                   \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(Vector<ValueType>&& lhs, Vector<ValueType>&& rhs)              \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(                                       \
+            detail::toExpression(std::move(lhs)), detail::toExpression(std::move(rhs))             \
+        );                                                                                         \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType, typename Evaluator>                                               \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(                                                               \
+        const VectorExpression<ValueType, Evaluator>& lhs, Vector<ValueType>&& rhs                 \
+    )                                                                                              \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(                                       \
+            lhs, detail::toExpression(std::move(rhs))                                              \
+        );                                                                                         \
+    }                                                                                              \
+                                                                                                   \
+    template<typename ValueType, typename Evaluator>                                               \
+        requires _constraint<ValueType>                                                            \
+    [[nodiscard]] auto operator _op(                                                               \
+        Vector<ValueType>&& lhs, const VectorExpression<ValueType, Evaluator>& rhs                 \
+    )                                                                                              \
+    {                                                                                              \
+        return detail::binaryExpression<detail::_evaluator>(                                       \
+            detail::toExpression(std::move(lhs)), rhs                                              \
+        );                                                                                         \
+    }
+
+NN_VECTOR_EXPRESSION_BINARY_OPERATOR(+, AddEvaluator, VectorAddable)
+NN_VECTOR_EXPRESSION_BINARY_OPERATOR(-, SubEvaluator, VectorAddable)
+NN_VECTOR_EXPRESSION_BINARY_OPERATOR(*, MulEvaluator, VectorMultipliable)
+
+#undef NN_VECTOR_EXPRESSION_BINARY_OPERATOR
+
+/**
+ * @brief Multiplies every element of a Vector by a scalar.
+ * @note We exclude types where the multiplication operator is ambiguous.
+ */
+template<typename ValueType>
+    requires VectorScalable<ValueType>
+[[nodiscard]] auto operator*(const Vector<ValueType>& lhs, const scalar rhs)
+{
+    return detail::scaleExpression(detail::toExpression(lhs), rhs);
+}
+
+/**
+ * @brief Multiplies every element of a temporary Vector, which is owned by the expression, by a
+ * scalar.
+ */
+template<typename ValueType>
+    requires VectorScalable<ValueType>
+[[nodiscard]] auto operator*(Vector<ValueType>&& lhs, const scalar rhs)
+{
+    return detail::scaleExpression(detail::toExpression(std::move(lhs)), rhs);
+}
+
+/**
+ * @brief Multiplies every element of a VectorExpression by a scalar.
+ */
+template<typename ValueType, typename Evaluator>
+    requires VectorScalable<ValueType>
+[[nodiscard]] auto operator*(const VectorExpression<ValueType, Evaluator>& lhs, const scalar rhs)
+{
+    return detail::scaleExpression(lhs, rhs);
+}
+
+/**
+ * @brief Multiplies every element of a Vector by a scalar.
+ */
+template<typename ValueType>
+    requires VectorScalable<ValueType>
+[[nodiscard]] auto operator*(const scalar lhs, const Vector<ValueType>& rhs)
+{
+    return detail::scaleExpression(detail::toExpression(rhs), lhs);
+}
+
+/**
+ * @brief Multiplies every element of a temporary Vector, which is owned by the expression, by a
+ * scalar.
+ */
+template<typename ValueType>
+    requires VectorScalable<ValueType>
+[[nodiscard]] auto operator*(const scalar lhs, Vector<ValueType>&& rhs)
+{
+    return detail::scaleExpression(detail::toExpression(std::move(rhs)), lhs);
+}
+
+/**
+ * @brief Multiplies every element of a VectorExpression by a scalar.
+ */
+template<typename ValueType, typename Evaluator>
+    requires VectorScalable<ValueType>
+[[nodiscard]] auto operator*(const scalar lhs, const VectorExpression<ValueType, Evaluator>& rhs)
+{
+    return detail::scaleExpression(rhs, lhs);
+}
+
+} // namespace NeoN
@@ -48,4 +48,54 @@ template<typename ValueType>
 void mul(Vector<ValueType>& vect1, const Vector<std::type_identity_t<ValueType>>& vect2)
     requires requires(ValueType a, ValueType b) { a* b; };
 
+/* @brief computes y = alpha x + beta y in a single pass */
+template<typename ValueType>
+void axpby(
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    Vector<ValueType>& y
+);
+
+/* @brief computes w = alpha x + beta y in a single pass, w may be x or y */
+template<typename ValueType>
+void waxpby(
+    Vector<ValueType>& w,
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    const Vector<std::type_identity_t<ValueType>>& y
+);
+
+/* @brief computes z = alpha x + beta y + gamma z in a single pass */
+template<typename ValueType>
+void axpbypcz(
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    const Vector<std::type_identity_t<ValueType>>& y,
+    const scalar gamma,
+    Vector<ValueType>& z
+);
+
+/* @brief returns the inner product of x and y, the sum of the dot products for Vec3 */
+template<typename ValueType>
+scalar dot(const Vector<ValueType>& x, const Vector<std::type_identity_t<ValueType>>& y);
+
+/* @brief returns the Euclidean norm of x */
+template<typename ValueType>
+scalar norm2(const Vector<ValueType>& x);
+
+/* @brief computes y = alpha x + beta y and returns the inner product of the updated y and z in a
+ * single pass, z may be y for its squared norm
+ */
+template<typename ValueType>
+scalar axpbyDot(
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    Vector<ValueType>& y,
+    const Vector<std::type_identity_t<ValueType>>& z
+);
+
 } // namespace NeoN
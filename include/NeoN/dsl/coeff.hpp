@@ -10,6 +10,33 @@
 namespace NeoN::dsl
 {
 
+/**
+ * @class UniformCoeff
+ * @brief A statically typed coefficient with the same value for all indices, see Coeff::visit.
+ */
+struct UniformCoeff
+{
+    scalar coeff;
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const localIdx) const { return coeff; }
+};
+
+/**
+ * @class FieldCoeff
+ * @brief A statically typed coefficient given by a view scaled by a single value, see
+ * Coeff::visit.
+ */
+struct FieldCoeff
+{
+    scalar coeff;
+
+    View<const scalar> view;
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const localIdx i) const { return view[i] * coeff; }
+};
+
 /**
  * @class Coeff
  * @brief A class that represents a coefficient for the NeoN dsl.
@@ -40,11 +67,31 @@ public:
 
     View<const scalar> view();
 
+    /**
+     * @brief Calls the function with the statically typed coefficient, ie. a UniformCoeff or a
+     * FieldCoeff.
+     *
+     * Kernels instantiated for the static types do not branch on the existence of the view for
+     * every element. The function has to return the same type for both coefficient types.
+     */
+    template<typename Function>
+    decltype(auto) visit(Function&& function) const
+    {
+        if (hasView_)
+        {
+            return function(FieldCoeff {coeff_, view_});
+        }
+        return function(UniformCoeff {coeff_});
+    }
+
     Coeff& operator*=(scalar rhs);
 
 
     Coeff& operator*=(const Coeff& rhs);
 
+    /* @brief whether both coefficients have the same value and refer to the same values */
+    bool operator==(const Coeff& rhs) const;
+
 
 private:
 
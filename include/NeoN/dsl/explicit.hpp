@@ -31,6 +31,14 @@ TemporalOperator<ValueType> ddt(fvcc::VolumeField<ValueType>& phi)
     return fvcc::DdtOperator(dsl::Operator::Type::Explicit, phi);
 }
 
+/* @brief a ddt operator with a pseudo time step per cell, see computeLocalTimeStep */
+template<typename ValueType>
+TemporalOperator<ValueType>
+ddt(fvcc::VolumeField<ValueType>& phi, const Vector<scalar>& localDt)
+{
+    return fvcc::DdtOperator(dsl::Operator::Type::Explicit, phi, localDt);
+}
+
 SpatialOperator<scalar>
 div(const fvcc::SurfaceField<scalar>& faceFlux, fvcc::VolumeField<scalar>& phi);
 
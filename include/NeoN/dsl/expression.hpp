@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "NeoN/core/error.hpp"
+#include "NeoN/core/timer.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/fields/field.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
@@ -26,16 +28,29 @@ class Expression
 {
 public:
 
-    Expression(const Executor& exec) : exec_(exec), temporalOperators_(), spatialOperators_() {}
+    Expression(const Executor& exec)
+        : exec_(exec), temporalOperators_(), spatialOperators_(), readVersion_(0)
+    {}
 
     Expression(const Expression& exp)
         : exec_(exp.exec_), temporalOperators_(exp.temporalOperators_),
-          spatialOperators_(exp.spatialOperators_)
+          spatialOperators_(exp.spatialOperators_), readVersion_(exp.readVersion_)
     {}
 
-    /* @brief dispatch read call to operator */
+    Expression(Expression&& exp) = default;
+
+    /* @brief dispatch read call to operator
+     *
+     * The operators are only read if the dictionary changed since the last read, see
+     * Dictionary::version, thus reading the schemes in every time step does not parse them again.
+     */
     void read(const Dictionary& input)
     {
+        if (readVersion_ == input.version())
+        {
+            return;
+        }
+        readVersion_ = input.version();
         for (auto& op : temporalOperators_)
         {
             op.read(input);
@@ -50,12 +65,16 @@ public:
     Vector<ValueType> explicitOperation(localIdx nCells) const
     {
         Vector<ValueType> source(exec_, nCells, zero<ValueType>());
-        return explicitOperation(source);
+        explicitOperation(source);
+        return source;
     }
 
-    /* @brief perform all explicit operation and accumulate the result */
-    Vector<ValueType> explicitOperation(Vector<ValueType>& source) const
+    /* @brief perform all explicit operation and accumulate the result in place
+     * @note the source is not copied, so a preallocated workspace can be reused between calls
+     */
+    void explicitOperation(Vector<ValueType>& source) const
     {
+        ScopedTimer timer("Expression::explicitOperation", exec_);
         for (auto& op : spatialOperators_)
         {
             if (op.getType() == Operator::Type::Explicit)
@@ -63,11 +82,11 @@ public:
                 op.explicitOperation(source);
             }
         }
-        return source;
     }
 
-    Vector<ValueType> explicitOperation(Vector<ValueType>& source, scalar t, scalar dt) const
+    void explicitOperation(Vector<ValueType>& source, scalar t, scalar dt) const
     {
+        ScopedTimer timer("Expression::explicitTemporalOperation", exec_);
         for (auto& op : temporalOperators_)
         {
             if (op.getType() == Operator::Type::Explicit)
@@ -75,13 +94,13 @@ public:
                 op.explicitOperation(source, t, dt);
             }
         }
-        return source;
     }
 
     // TODO: rename to assembleMatrixCoefficients ?
     /* @brief perform all implicit operation and accumulate the result */
     void implicitOperation(la::LinearSystem<ValueType, localIdx>& ls)
     {
+        ScopedTimer timer("Expression::implicitOperation", exec_);
         for (auto& op : spatialOperators_)
         {
             if (op.getType() == Operator::Type::Implicit)
@@ -93,6 +112,7 @@ public:
 
     void implicitOperation(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt)
     {
+        ScopedTimer timer("Expression::implicitTemporalOperation", exec_);
         for (auto& op : temporalOperators_)
         {
             if (op.getType() == Operator::Type::Implicit)
@@ -103,11 +123,16 @@ public:
     }
 
 
-    void addOperator(const SpatialOperator<ValueType>& oper) { spatialOperators_.push_back(oper); }
+    void addOperator(const SpatialOperator<ValueType>& oper)
+    {
+        spatialOperators_.push_back(oper);
+        readVersion_ = 0;
+    }
 
     void addOperator(const TemporalOperator<ValueType>& oper)
     {
         temporalOperators_.push_back(oper);
+        readVersion_ = 0;
     }
 
     void addExpression(const Expression& equation)
@@ -120,6 +145,7 @@ public:
         {
             spatialOperators_.push_back(oper);
         }
+        readVersion_ = 0;
     }
 
 
@@ -153,6 +179,12 @@ private:
     std::vector<TemporalOperator<ValueType>> temporalOperators_;
 
     std::vector<SpatialOperator<ValueType>> spatialOperators_;
+
+    /* @brief the version of the dictionary the operators were read from, zero if not read
+     * @note operators added through the non-const getters are only read once the dictionary
+     * changed
+     */
+    std::uint64_t readVersion_;
 };
 
 template<typename ValueType>
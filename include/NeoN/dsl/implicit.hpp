@@ -28,6 +28,14 @@ TemporalOperator<ValueType> ddt(fvcc::VolumeField<ValueType>& phi)
     return fvcc::DdtOperator(dsl::Operator::Type::Implicit, phi);
 }
 
+/* @brief a ddt operator with a pseudo time step per cell, see computeLocalTimeStep */
+template<typename ValueType>
+TemporalOperator<ValueType>
+ddt(fvcc::VolumeField<ValueType>& phi, const Vector<scalar>& localDt)
+{
+    return fvcc::DdtOperator(dsl::Operator::Type::Implicit, phi, localDt);
+}
+
 template<typename ValueType>
 SpatialOperator<ValueType>
 source(fvcc::VolumeField<scalar>& coeff, fvcc::VolumeField<ValueType>& phi)
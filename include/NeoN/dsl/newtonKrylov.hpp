@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <functional>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/dsl/expression.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::dsl
+{
+
+/* @brief The statistics of a Newton-Krylov solve */
+struct NewtonKrylovStats
+{
+    long numNonlinearIter; // the Newton iterations
+
+    long numLinearIter; // the Krylov iterations over all Newton iterations
+
+    long numResidualEvals; // including the evaluations of the Jacobian vector products
+
+    scalar finalResNorm; // the l2 norm of the residual
+};
+
+/* @brief updates the coefficients of an expression which depend on the solution, eg. a
+ * temperature dependent diffusivity, after the solution field was set to a new iterate
+ */
+template<typename VectorType>
+using NewtonKrylovUpdate = std::function<void(VectorType&)>;
+
+/* @brief solves the nonlinear equation of an expression with the Jacobian free Newton-Krylov
+ * method of KINSOL
+ *
+ * The residual at an iterate u is F(u) = A(u) u - b(u), where A(u) and b(u) are the linear system
+ * assembled from the expression at u including its explicit operators, see dsl::solve. Temporal
+ * operators are assembled for the implicit step from t to t + dt. The Jacobian vector products
+ * are approximated by finite differences of F, hence the derivatives of the coefficients with
+ * respect to the solution are included without assembling them. The Krylov iterations are right
+ * preconditioned by the linear solver of the Picard matrix A(u).
+ *
+ * The following optional keys of the Newton dictionary control the solve:
+ *  - tolerance: the maximum norm of the residual at which the iteration stops (default 1e-8)
+ *  - maxIter: the maximum number of Newton iterations (default 50)
+ *  - maxKrylovDim: the dimension of the Krylov subspace of GMRES (default 10)
+ *  - rebuildPreconditionerEvery: assemble and set up the Picard matrix every N Newton iterations
+ *    (default 1)
+ *  - lineSearch: globalize the Newton step by a line search (default false)
+ * The required preconditioner subdictionary is the linear solver dictionary of the Picard systems.
+ *
+ * @param exp, the expression, its operators have to be built on the solution field
+ * @param solution, the initial guess, which is overwritten by the solution
+ * @param t, the time at the start of the time step
+ * @param dt, the time step of the temporal operators
+ * @param fvSchemes, the dictionary of the spatial operators
+ * @param newtonDict, the dictionary of the Newton-Krylov solve
+ * @param update, called whenever the solution field was set to a new iterate
+ */
+template<typename VectorType>
+NewtonKrylovStats solveNewtonKrylov(
+    Expression<typename VectorType::ElementType>& exp,
+    VectorType& solution,
+    scalar t,
+    scalar dt,
+    const Dictionary& fvSchemes,
+    const Dictionary& newtonDict,
+    const NewtonKrylovUpdate<VectorType>& update = {}
+);
+
+}
+
+#endif
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <type_traits>
@@ -13,7 +15,9 @@
 #include "NeoN/fields/field.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/core/input.hpp"
+#include "NeoN/core/database/solverStatsCollection.hpp"
 #include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/timer.hpp"
 #include "NeoN/dsl/expression.hpp"
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 
@@ -25,6 +29,58 @@
 namespace NeoN::dsl
 {
 
+namespace detail
+{
+
+/* @brief the workspace of the explicit source of an assembly, which is owned like the linear
+ * system by the equation
+ *
+ * @param name, the name of the equation, usually the name of the solution field
+ */
+template<typename ValueType>
+Vector<ValueType>& explicitSourceWorkspace(const UnstructuredMesh& mesh, const std::string& name)
+{
+    auto& source = mesh.stencilDB().getOrCreate<Vector<ValueType>>(
+        "dsl::explicitSource<" + demangle(typeid(ValueType).name()) + ">::" + name,
+        [&]() { return Vector<ValueType>(mesh.exec(), mesh.nCells()); }
+    );
+    source.resize(mesh.nCells());
+    fill(source, zero<ValueType>());
+    return source;
+}
+
+/* @brief assembles the linear system of an expression without temporal operators
+ *
+ * The structure is allocated on the first solve of the equation, afterwards only the values are
+ * reset. Every solution field owns its system, thus concurrent equations on the mesh only need
+ * to serialise the assembly, see StencilDataBase::lock.
+ */
+template<typename VectorType>
+la::LinearSystem<typename VectorType::ElementType, localIdx>&
+assemble(Expression<typename VectorType::ElementType>& exp, VectorType& solution)
+{
+    using ValueType = typename VectorType::ElementType;
+    auto& ls = la::readOrCreateLinearSystem<ValueType, localIdx>(solution.mesh(), solution.name);
+
+    exp.implicitOperation(ls);
+    auto& expTmp = explicitSourceWorkspace<ValueType>(solution.mesh(), solution.name);
+    exp.explicitOperation(expTmp);
+
+    auto [vol, expSource, rhs] = views(solution.mesh().cellVolumes(), expTmp, ls.rhs());
+
+    // subtract the explicit source term from the rhs
+    parallelFor(
+        solution.exec(),
+        {0, rhs.size()},
+        KOKKOS_LAMBDA(const localIdx i) { rhs[i] -= expSource[i] * vol[i]; },
+        "dsl::solve::explicitSource"
+    );
+    la::freezeInactiveRows(ls, solution.mesh(), solution.internalVector());
+    return ls;
+}
+
+}
+
 /* @brief solve an expression
  *
  * @param exp - Expression which is to be solved/updated.
@@ -44,11 +100,15 @@ void solve(
     const Dictionary& fvSolution
 )
 {
+    ScopedTimer timer("dsl::solve", solution.exec());
     // TODO:
     if (exp.temporalOperators().size() == 0 && exp.spatialOperators().size() == 0)
     {
         NF_ERROR_EXIT("No temporal or implicit terms to solve.");
     }
+    // the schemes and the assembly share the entries of the mesh with concurrent solves, the
+    // linear solve of the owned system runs unlocked
+    auto lock = solution.mesh().stencilDB().lock();
     exp.read(fvSchemes);
     if (exp.temporalOperators().size() > 0)
     {
@@ -56,31 +116,136 @@ void solve(
         timeIntegration::TimeIntegration<VectorType> timeIntegrator(
             fvSchemes.subDict("ddtSchemes"), fvSolution
         );
+        lock.unlock();
         timeIntegrator.solve(exp, solution, t, dt);
     }
     else
     {
-        // solve sparse matrix system
-        using ValueType = typename VectorType::ElementType;
+        auto& ls = detail::assemble(exp, solution);
+
+        // the solver is kept in the mesh between calls to avoid parsing the dictionary again
+        auto solver =
+            la::solverCache(solution.mesh()).get(solution.name, solution.exec(), fvSolution);
+        lock.unlock();
+        auto stats = solver->solve(ls, solution.internalVector());
+        lock.lock();
+        la::recordSolverStats(solution, stats);
+    }
+}
+
+/* @brief the completion of a solve started by solveAsync
+ *
+ * Waits in the destructor, thus the solution is always complete once the object is gone.
+ */
+template<typename VectorType>
+class PendingSolve
+{
+public:
 
-        auto sparsity = la::SparsityPattern(solution.mesh());
-        auto ls = la::createEmptyLinearSystem<ValueType, localIdx>(solution.mesh(), sparsity);
+    using ValueType = typename VectorType::ElementType;
 
-        exp.implicitOperation(ls);
-        auto expTmp = exp.explicitOperation(solution.mesh().nCells());
+    /* @brief a solve whose kernels are enqueued on the executor of the solution */
+    PendingSolve(VectorType& solution, CompletionToken token)
+        : solution_(&solution), token_(std::move(token)), ls_(), solver_(), stats_()
+    {}
 
-        auto [vol, expSource, rhs] = views(solution.mesh().cellVolumes(), expTmp, ls.rhs());
+    /* @brief a solve running on a host thread, which owns the solved system */
+    PendingSolve(
+        VectorType& solution,
+        std::unique_ptr<la::LinearSystem<ValueType, localIdx>> ls,
+        std::shared_ptr<la::Solver> solver
+    )
+        : solution_(&solution), token_(), ls_(std::move(ls)), solver_(std::move(solver)),
+          stats_(solver_->solveAsync(*ls_, solution.internalVector()))
+    {}
 
-        // subtract the explicit source term from the rhs
-        parallelFor(
-            solution.exec(),
-            {0, rhs.size()},
-            KOKKOS_LAMBDA(const localIdx i) { rhs[i] -= expSource[i] * vol[i]; }
-        );
+    PendingSolve(PendingSolve&& other)
+        : solution_(std::exchange(other.solution_, nullptr)), token_(std::move(other.token_)),
+          ls_(std::move(other.ls_)), solver_(std::move(other.solver_)),
+          stats_(std::move(other.stats_))
+    {}
+
+    PendingSolve& operator=(PendingSolve&& other) = delete;
+
+    ~PendingSolve() { wait(); }
 
-        auto solver = la::Solver(solution.exec(), fvSolution);
-        solver.solve(ls, solution.internalVector());
+    /* @brief blocks until the solution is complete and records the solver statistics */
+    void wait()
+    {
+        if (!solution_)
+        {
+            return;
+        }
+        if (stats_.valid())
+        {
+            const auto stats = stats_.get();
+            auto lock = solution_->mesh().stencilDB().lock();
+            la::recordSolverStats(*solution_, stats);
+            ls_.reset();
+        }
+        token_.wait();
+        NeoN::fence(solution_->exec());
+        solution_ = nullptr;
+    }
+
+    /* @brief checks if wait would return without blocking on the linear solver */
+    [[nodiscard]] bool ready() const
+    {
+        return !solution_ || !stats_.valid()
+            || stats_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+private:
+
+    VectorType* solution_;
+    CompletionToken token_;
+    std::unique_ptr<la::LinearSystem<ValueType, localIdx>> ls_;
+    std::shared_ptr<la::Solver> solver_;
+    std::future<la::SolverStats> stats_;
+};
+
+/* @brief starts to solve an expression and returns before the solution is complete
+ *
+ * An expression without temporal operators is assembled on the calling thread and its linear
+ * system is copied, such that the next equation on the mesh can be assembled while the copy is
+ * solved on a host thread, see la::Solver::solveAsync. The kernels of expressions with temporal
+ * operators are enqueued as in solve, an implicit time integrator solves its system before the
+ * call returns. The solution must not be accessed and the same equation must not be solved
+ * again before the returned PendingSolve is waited for.
+ *
+ * @param exp - Expression which is to be solved/updated.
+ * @param solution - Solution field, where the solution will be 'written to'.
+ * @param t - the time at the start of the time step.
+ * @param dt - time step for the temporal integration
+ * @param fvSchemes - Dictionary containing spatial operator and time  integration properties
+ * @param fvSolution - Dictionary containing linear solver properties
+ */
+template<typename VectorType>
+[[nodiscard]] PendingSolve<VectorType> solveAsync(
+    Expression<typename VectorType::ElementType>& exp,
+    VectorType& solution,
+    scalar t,
+    scalar dt,
+    const Dictionary& fvSchemes,
+    const Dictionary& fvSolution
+)
+{
+    ScopedTimer timer("dsl::solveAsync", solution.exec());
+    if (exp.temporalOperators().size() > 0 || exp.spatialOperators().size() == 0)
+    {
+        solve(exp, solution, t, dt, fvSchemes, fvSolution);
+        return PendingSolve<VectorType>(solution, CompletionToken(solution.exec()));
     }
+    using ValueType = typename VectorType::ElementType;
+    auto lock = solution.mesh().stencilDB().lock();
+    exp.read(fvSchemes);
+    // the system of the equation is reused by its next assembly, hence a copy is solved
+    auto ls =
+        std::make_unique<la::LinearSystem<ValueType, localIdx>>(detail::assemble(exp, solution));
+    auto solver =
+        la::solverCache(solution.mesh()).get(solution.name, solution.exec(), fvSolution);
+    lock.unlock();
+    return PendingSolve<VectorType>(solution, std::move(ls), std::move(solver));
 }
 
 } // namespace dsl
@@ -48,6 +48,10 @@ concept IsSpatialOperator = HasExplicitOperator<T> || HasImplicitOperator<T>;
  * of Operators e.g Divergence, Laplacian, etc can be stored in a vector of
  * Operators
  *
+ * Copies share the concrete operator, which is only cloned before a copy is modified through
+ * getCoefficient or read. Hence copying an expression does not allocate per operator. The
+ * evaluation of a concrete operator is const and thus does not affect the other copies.
+ *
  * @ingroup dsl
  */
 template<typename ValueType>
@@ -58,16 +62,16 @@ public:
     using VectorValueType = ValueType;
 
     template<IsSpatialOperator T>
-    SpatialOperator(T cls) : model_(std::make_unique<OperatorModel<T>>(std::move(cls)))
+    SpatialOperator(T cls) : model_(std::make_shared<OperatorModel<T>>(std::move(cls)))
     {}
 
-    SpatialOperator(const SpatialOperator& eqnOperator) : model_(eqnOperator.model_->clone()) {}
+    SpatialOperator(const SpatialOperator& eqnOperator) : model_(eqnOperator.model_) {}
 
     SpatialOperator(SpatialOperator&& eqnOperator) : model_(std::move(eqnOperator.model_)) {}
 
     SpatialOperator& operator=(const SpatialOperator& eqnOperator)
     {
-        model_ = eqnOperator.model_->clone();
+        model_ = eqnOperator.model_;
         return *this;
     }
 
@@ -84,16 +88,24 @@ public:
     std::string getName() const { return model_->getName(); }
 
 
-    Coeff& getCoefficient() { return model_->getCoefficient(); }
+    Coeff& getCoefficient() { return mutableModel().getCoefficient(); }
 
     Coeff getCoefficient() const { return model_->getCoefficient(); }
 
     /* @brief Given an input this function reads required properties */
-    void read(const Input& input) { model_->read(input); }
+    void read(const Input& input) { mutableModel().read(input); }
 
     /* @brief Get the executor */
     const Executor& exec() const { return model_->exec(); }
 
+    /* @brief returns the concrete operator if it is of type T and nullptr otherwise */
+    template<typename T>
+    const T* as() const
+    {
+        const auto* model = dynamic_cast<const OperatorModel<T>*>(model_.get());
+        return model ? &model->concreteOp_ : nullptr;
+    }
+
 
 private:
 
@@ -180,7 +192,17 @@ private:
         ConcreteOperatorType concreteOp_;
     };
 
-    std::unique_ptr<OperatorConcept> model_;
+    /* @brief returns the model for a modification, a model shared with other copies is cloned */
+    OperatorConcept& mutableModel()
+    {
+        if (model_.use_count() > 1)
+        {
+            model_ = model_->clone();
+        }
+        return *model_;
+    }
+
+    std::shared_ptr<OperatorConcept> model_;
 };
 
 
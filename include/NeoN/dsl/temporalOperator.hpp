@@ -52,6 +52,9 @@ concept HasTemporalOperator = HasTemporalExplicitOperator<T> || HasTemporalImpli
  * of TemporalOperator e.g Divergence, Laplacian, etc can be stored in a vector of
  * TemporalOperator
  *
+ * As for the SpatialOperator copies share the concrete operator until a copy is modified through
+ * getCoefficient or read.
+ *
  * @ingroup dsl
  */
 template<typename ValueType>
@@ -62,10 +65,10 @@ public:
     using VectorValueType = ValueType;
 
     template<HasTemporalOperator T>
-    TemporalOperator(T cls) : model_(std::make_unique<TemporalOperatorModel<T>>(std::move(cls)))
+    TemporalOperator(T cls) : model_(std::make_shared<TemporalOperatorModel<T>>(std::move(cls)))
     {}
 
-    TemporalOperator(const TemporalOperator& eqnOperator) : model_ {eqnOperator.model_->clone()} {}
+    TemporalOperator(const TemporalOperator& eqnOperator) : model_ {eqnOperator.model_} {}
 
     TemporalOperator(TemporalOperator&& eqnOperator) : model_ {std::move(eqnOperator.model_)} {}
 
@@ -84,16 +87,24 @@ public:
 
     std::string getName() const { return model_->getName(); }
 
-    Coeff& getCoefficient() { return model_->getCoefficient(); }
+    Coeff& getCoefficient() { return mutableModel().getCoefficient(); }
 
     Coeff getCoefficient() const { return model_->getCoefficient(); }
 
     /* @brief Given an input this function reads required properties */
-    void read(const Input& input) { model_->read(input); }
+    void read(const Input& input) { mutableModel().read(input); }
 
     /* @brief Get the executor */
     const Executor& exec() const { return model_->exec(); }
 
+    /* @brief returns the concrete operator if it is of type T and nullptr otherwise */
+    template<typename T>
+    const T* as() const
+    {
+        const auto* model = dynamic_cast<const TemporalOperatorModel<T>*>(model_.get());
+        return model ? &model->concreteOp_ : nullptr;
+    }
+
 
 private:
 
@@ -184,7 +195,17 @@ private:
         ConcreteTemporalOperatorType concreteOp_;
     };
 
-    std::unique_ptr<TemporalOperatorConcept> model_;
+    /* @brief returns the model for a modification, a model shared with other copies is cloned */
+    TemporalOperatorConcept& mutableModel()
+    {
+        if (model_.use_count() > 1)
+        {
+            model_ = model_->clone();
+        }
+        return *model_;
+    }
+
+    std::shared_ptr<TemporalOperatorConcept> model_;
 };
 
 
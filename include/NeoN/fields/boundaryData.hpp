@@ -9,9 +9,12 @@
 
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/primitives/traits.hpp"
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/vector/vector.hpp"
 
+#include <functional>
 #include <vector>
 #include <utility>
 
@@ -28,6 +31,14 @@ namespace NeoN
  * values, reference values, value fractions, reference gradients, boundary
  * types, offsets, and the number of boundaries and boundary faces.
  *
+ * The reference values, value fractions and reference gradients are only read by boundary
+ * conditions with a Dirichlet or Neumann part and by the implicit operators. Hence they are
+ * allocated and zero initialized on their first access, fields which only use the computed
+ * values never allocate them.
+ *
+ * Updates of the values can be deferred, eg. by the non-blocking halo exchange of a processor
+ * boundary. They are completed on the next access of any of the values.
+ *
  * @tparam ValueType The type of the underlying field values
  */
 template<typename T>
@@ -41,7 +52,7 @@ public:
      * @param rhs The boundaryVectors object to be copied.
      */
     BoundaryData(const BoundaryData<T>& rhs)
-        : exec_(rhs.exec_), value_(rhs.value_), refValue_(rhs.refValue_),
+        : exec_(rhs.exec_), value_(rhs.value()), refValue_(rhs.refValue_),
           valueFraction_(rhs.valueFraction_), refGrad_(rhs.refGrad_),
           boundaryTypes_(rhs.boundaryTypes_), offset_(rhs.offset_), nBoundaries_(rhs.nBoundaries_),
           nBoundaryFaces_(rhs.nBoundaryFaces_)
@@ -53,7 +64,7 @@ public:
      * @param rhs The boundaryVectors object to be copied.
      */
     BoundaryData(const Executor& exec, const BoundaryData<T>& rhs)
-        : exec_(rhs.exec_), value_(exec, rhs.value_), refValue_(exec, rhs.refValue_),
+        : exec_(rhs.exec_), value_(exec, rhs.value()), refValue_(exec, rhs.refValue_),
           valueFraction_(exec, rhs.valueFraction_), refGrad_(exec, rhs.refGrad_),
           boundaryTypes_(exec, rhs.boundaryTypes_), offset_(SerialExecutor {}, rhs.offset_),
           nBoundaries_(rhs.nBoundaries_), nBoundaryFaces_(rhs.nBoundaryFaces_)
@@ -67,8 +78,8 @@ public:
      * @param nBoundaryType - The total number of boundary patches
      */
     BoundaryData(const Executor& exec, localIdx nBoundaryFaces, localIdx nBoundaryTypes)
-        : exec_(exec), value_(exec, nBoundaryFaces), refValue_(exec, nBoundaryFaces),
-          valueFraction_(exec, nBoundaryFaces), refGrad_(exec, nBoundaryFaces),
+        : exec_(exec), value_(exec, nBoundaryFaces), refValue_(exec, 0), valueFraction_(exec, 0),
+          refGrad_(exec, 0),
           boundaryTypes_(exec, nBoundaryTypes), offset_(SerialExecutor {}, nBoundaryTypes + 1),
           nBoundaries_(nBoundaryTypes), nBoundaryFaces_(nBoundaryFaces)
     {}
@@ -87,41 +98,49 @@ public:
 
 
     /** @copydoc BoundaryData::value()*/
-    const Vector<T>& value() const { return value_; }
+    const Vector<T>& value() const
+    {
+        completeUpdates();
+        return value_;
+    }
 
     /**
      * @brief Get the view storing the computed values from the boundary
      * condition.
      * @return The view storing the computed values.
      */
-    Vector<T>& value() { return value_; }
+    Vector<T>& value()
+    {
+        completeUpdates();
+        return value_;
+    }
 
     /** @copydoc BoundaryData::refValue()*/
-    const Vector<T>& refValue() const { return refValue_; }
+    const Vector<T>& refValue() const { return allocated(refValue_); }
 
     /**
      * @brief Get the view storing the Dirichlet boundary values.
      * @return The view storing the Dirichlet boundary values.
      */
-    Vector<T>& refValue() { return refValue_; }
+    Vector<T>& refValue() { return allocated(refValue_); }
 
     /** @copydoc BoundaryData::valueFraction()*/
-    const Vector<scalar>& valueFraction() const { return valueFraction_; }
+    const Vector<scalar>& valueFraction() const { return allocated(valueFraction_); }
 
     /**
      * @brief Get the view storing the fraction of the boundary value.
      * @return The view storing the fraction of the boundary value.
      */
-    Vector<scalar>& valueFraction() { return valueFraction_; }
+    Vector<scalar>& valueFraction() { return allocated(valueFraction_); }
 
     /** @copydoc BoundaryData::refGrad()*/
-    const Vector<T>& refGrad() const { return refGrad_; }
+    const Vector<T>& refGrad() const { return allocated(refGrad_); }
 
     /**
      * @brief Get the view storing the Neumann boundary values.
      * @return The view storing the Neumann boundary values.
      */
-    Vector<T>& refGrad() { return refGrad_; }
+    Vector<T>& refGrad() { return allocated(refGrad_); }
 
     /**
      * @brief Get the view storing the boundary types.
@@ -135,6 +154,18 @@ public:
      */
     const Vector<localIdx>& offset() const { return offset_; }
 
+    /**
+     * @brief Get the bytes allocated by the boundary data.
+     *
+     * The components allocated on first access are only accounted once they are allocated.
+     * @return The allocated bytes.
+     */
+    std::size_t memoryBytes() const
+    {
+        return value_.memoryBytes() + refValue_.memoryBytes() + valueFraction_.memoryBytes()
+             + refGrad_.memoryBytes() + boundaryTypes_.memoryBytes() + offset_.memoryBytes();
+    }
+
     /**
      * @brief Get the number of boundaries.
      * @return The number of boundaries.
@@ -158,8 +189,40 @@ public:
 
     const Executor& exec() { return exec_; }
 
+    /**
+     * @brief Defers an update of the values until they are accessed the next time.
+     * @param update The update, it must not access other deferred values.
+     */
+    void deferUpdate(std::function<void()> update) { pendingUpdates_.push_back(std::move(update)); }
+
+    /**
+     * @brief Whether updates are deferred until the next access of the values, eg. a halo
+     * exchange in flight, see deferUpdate.
+     */
+    bool hasPendingUpdates() const { return !pendingUpdates_.empty(); }
+
+    /**
+     * @brief Executes the deferred updates, this is done by every access of the values.
+     */
+    void completeUpdates() const
+    {
+        if (pendingUpdates_.empty())
+        {
+            return;
+        }
+        // the updates access the values, hence they are removed before they are executed
+        auto updates = std::move(pendingUpdates_);
+        pendingUpdates_.clear();
+        for (auto& update : updates)
+        {
+            update();
+        }
+    }
+
     BoundaryData<T>& operator=(const BoundaryData<T>& rhs)
     {
+        completeUpdates();
+        rhs.completeUpdates();
 
         // TODO maybe dont overwrite nBoundaries and nBoundaryFaces
         // but use them for a sanity check
@@ -177,6 +240,8 @@ public:
 
     BoundaryData<T>& operator=(const BoundaryData<T>&& rhs)
     {
+        completeUpdates();
+        rhs.completeUpdates();
 
         // TODO maybe dont overwrite nBoundaries and nBoundaryFaces
         // but use them for a sanity check
@@ -203,17 +268,31 @@ public:
 
 private:
 
-    Executor exec_;                ///< The executor on which the field is stored
-    Vector<T> value_;              ///< The Vector storing the computed values from the
-                                   ///< boundary condition.
-    Vector<T> refValue_;           ///< The Vector storing the Dirichlet boundary values.
-    Vector<scalar> valueFraction_; ///< The Vector storing the fraction of
-                                   ///< the boundary value.
-    Vector<T> refGrad_;            ///< The Vector storing the Neumann boundary values.
-    Vector<int> boundaryTypes_;    ///< The Vector storing the boundary types.
-    Vector<localIdx> offset_;      ///< The Vector storing the offsets of each boundary.
-    localIdx nBoundaries_;         ///< The number of boundaries.
-    localIdx nBoundaryFaces_;      ///< The number of boundary faces.
+    /* @brief allocates and zero initializes a lazily allocated component on its first access */
+    template<typename ValueType>
+    Vector<ValueType>& allocated(Vector<ValueType>& component) const
+    {
+        completeUpdates();
+        if (component.size() != nBoundaryFaces_)
+        {
+            component.resize(nBoundaryFaces_);
+            fill(component, zero<ValueType>());
+        }
+        return component;
+    }
+
+    Executor exec_;                        ///< The executor on which the field is stored
+    Vector<T> value_;                      ///< The Vector storing the computed values from the
+                                           ///< boundary condition.
+    mutable Vector<T> refValue_;           ///< The Vector storing the Dirichlet boundary values.
+    mutable Vector<scalar> valueFraction_; ///< The Vector storing the fraction of
+                                           ///< the boundary value.
+    mutable Vector<T> refGrad_;            ///< The Vector storing the Neumann boundary values.
+    Vector<int> boundaryTypes_;            ///< The Vector storing the boundary types.
+    Vector<localIdx> offset_;              ///< The Vector storing the offsets of each boundary.
+    localIdx nBoundaries_;                 ///< The number of boundaries.
+    localIdx nBoundaryFaces_;              ///< The number of boundary faces.
+    mutable std::vector<std::function<void()>> pendingUpdates_; ///< The deferred updates.
 };
 
 }
@@ -100,6 +100,11 @@ public:
 
     BoundaryData<ValueType>& boundaryData() { return boundaryData_; }
 
+    std::size_t memoryBytes() const
+    {
+        return internalVector_.memoryBytes() + boundaryData_.memoryBytes();
+    }
+
     const Executor& exec() const { return exec_; }
 
 private:
@@ -6,14 +6,82 @@
 
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
 
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/environment.hpp"
+#endif
+
 namespace NeoN::finiteVolume::cellCentred
 {
 
-/* @brief Calculates courant number from the face fluxes.
+/* @brief The mean and maximum courant number of a time step. */
+struct CourantNumber
+{
+    scalar mean;
+    scalar max;
+};
+
+/* @brief Calculates the mean and maximum courant number from the face fluxes.
+ *
+ * Both values are computed in a single reduction over the cells, nothing is printed.
+ * @param faceFlux Scalar surface field with the flux values of all faces.
+ * @param dt Size of the time step.
+ */
+CourantNumber computeCourantNumber(const SurfaceField<scalar>& faceFlux, const scalar dt);
+
+#ifdef NF_WITH_MPI_SUPPORT
+/* @brief Calculates the mean and maximum courant number of a decomposed mesh.
+ *
+ * The local maximum, flux sum and volume are reduced across the ranks in a single all-reduce,
+ * see mpi::ReductionBatch.
+ * @param mpiEnviron The MPI environment, every rank holds a part of the mesh.
+ * @param faceFlux Scalar surface field with the flux values of all local faces.
+ * @param dt Size of the time step.
+ */
+CourantNumber computeCourantNumber(
+    const mpi::MPIEnvironment& mpiEnviron, const SurfaceField<scalar>& faceFlux, const scalar dt
+);
+#endif
+
+/* @brief Calculates courant number from the face fluxes and prints the mean and maximum.
  * @param faceFlux Scalar surface field with the flux values of all faces.
  * @param dt Size of the time step.
  * @return Maximum courant number.
  */
 scalar computeCoNum(const SurfaceField<scalar>& faceFlux, const scalar dt);
 
+/* @brief The limits of the pseudo time steps of local time stepping. */
+struct LocalTimeStepLimits
+{
+    scalar maxCo;              // the courant number of every cell
+    scalar maxDiffusionNumber; // the diffusion number of every cell
+    scalar maxDt;              // the time step of cells without convection and diffusion
+};
+
+/* @brief Calculates a pseudo time step per cell from the local courant and diffusion numbers.
+ *
+ * The courant numbers of the faces and the diffusion numbers gamma |S_f| / |d_f| are summed in a
+ * single pass over the faces, like computeCourantNumber. The time step of a cell is
+ * the harmonic combination of both limits, 1 / dt = 1 / dt_Co + 1 / dt_D, bounded by maxDt. It
+ * can be passed to the ddt operators, see dsl::imp::ddt, to converge steady cases in pseudo time.
+ * @param faceFlux Scalar surface field with the flux values of all faces.
+ * @param gamma Scalar surface field with the diffusivity of all faces.
+ * @param limits The target courant and diffusion numbers.
+ * @param localDt The time step of every cell.
+ */
+void computeLocalTimeStep(
+    const SurfaceField<scalar>& faceFlux,
+    const SurfaceField<scalar>& gamma,
+    const LocalTimeStepLimits& limits,
+    Vector<scalar>& localDt
+);
+
+/* @brief Calculates a pseudo time step per cell from the local courant numbers only.
+ * @param faceFlux Scalar surface field with the flux values of all faces.
+ * @param limits The target courant number, the diffusion number is not used.
+ * @param localDt The time step of every cell.
+ */
+void computeLocalTimeStep(
+    const SurfaceField<scalar>& faceFlux, const LocalTimeStepLimits& limits, Vector<scalar>& localDt
+);
+
 } // namespace NeoN
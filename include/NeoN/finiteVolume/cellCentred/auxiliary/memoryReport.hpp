@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/database/database.hpp"
+#include "NeoN/core/memoryReport.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief Adds the fields registered in a database to a memory report.
+ *
+ * The volume and surface fields of scalar and Vec3 values of all field collections are added by
+ * name, the old time levels, see OldTimeCollection, to the old-time fields category and all
+ * other fields to the fields category.
+ * @param report The report to add to.
+ * @param db The database holding the field collections.
+ */
+void reportMemory(MemoryReport& report, const Database& db);
+
+/* @brief Collects the memory footprint of a mesh and of the fields of a database.
+ *
+ * The report holds the mesh geometry and connectivity, the entries of the stencil data base of
+ * the mesh, ie. the sparsity patterns, stencils, weights, linear systems and the data the cached
+ * solvers keep between solves, and the fields and old time levels of the database. Since these
+ * are allocated on first use, the report is meaningful after the first time step.
+ * @param mesh The mesh.
+ * @param db The database holding the fields on the mesh.
+ * @return The report with the bytes per cell of the mesh.
+ */
+MemoryReport memoryReport(const UnstructuredMesh& mesh, const Database& db);
+
+} // namespace NeoN
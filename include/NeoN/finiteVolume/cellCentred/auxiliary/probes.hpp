@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "NeoN/core/vector/hostMirror.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @class ProbeLocations
+ * @brief the interpolation stencils of a set of probe points, computed once on construction
+ *
+ * Every point is assigned to the cell with the nearest cell centre, found on the host with a
+ * uniform grid of bins over the cell centres. The value at the point is interpolated from this
+ * cell and its face neighbours with inverse distance weights, a point at a cell centre takes the
+ * value of the cell. The stencils are stored on the executor of the mesh as segments of cells
+ * and weights.
+ */
+class ProbeLocations
+{
+public:
+
+    ProbeLocations(const UnstructuredMesh& mesh, const std::vector<Vec3>& points);
+
+    /* @brief the number of probe points */
+    localIdx size() const { return static_cast<localIdx>(cells_.size()); }
+
+    /* @brief the cell of every probe point */
+    const std::vector<localIdx>& cells() const { return cells_; }
+
+    /* @brief the stencil of probe point i spans [offsets[i], offsets[i + 1]) */
+    const Vector<localIdx>& offsets() const { return offsets_; }
+
+    /* @brief the cells of the stencils */
+    const Vector<localIdx>& stencilCells() const { return stencilCells_; }
+
+    /* @brief the interpolation weights of the stencil cells, they sum to one per point */
+    const Vector<scalar>& weights() const { return weights_; }
+
+private:
+
+    std::vector<localIdx> cells_;
+    Vector<localIdx> offsets_;
+    Vector<localIdx> stencilCells_;
+    Vector<scalar> weights_;
+};
+
+/* @brief the buffered samples of the probes, on the host */
+template<typename ValueType>
+struct ProbeSamples
+{
+    const std::vector<scalar>& times; // the time of every sampled step
+    localIdx nFields;                 // the number of sampled fields per step
+    localIdx nProbes;                 // the number of probe points
+    View<const ValueType> values;     // the values ordered by step, field and probe
+
+    ValueType operator()(const localIdx step, const localIdx fieldi, const localIdx probei) const
+    {
+        return values[(step * nFields + fieldi) * nProbes + probei];
+    }
+};
+
+/* @brief receives the samples of a flushed probe buffer, eg. to write them to a file */
+template<typename ValueType>
+using ProbeWriter = std::function<void(const ProbeSamples<ValueType>&)>;
+
+/* @class Probes
+ * @brief samples fields at probe points on the device and buffers the samples over many steps
+ *
+ * A call to sample interpolates all fields at all points in one kernel per batch of
+ * maxBatchSize fields and stores the values in a device buffer, hence no field is copied to the
+ * host. A full buffer is transferred to the host asynchronously, while the sampling continues
+ * in a second buffer, and the samples are handed to the writer once the transfer completed,
+ * which is checked at the next flush. Thus the step time only includes the sample kernels.
+ *
+ * @tparam ValueType The value type of the sampled fields.
+ */
+template<typename ValueType>
+class Probes
+{
+public:
+
+    /* @param mesh the mesh of the sampled fields
+     * @param points the probe points
+     * @param nFields the number of fields passed to every call of sample
+     * @param bufferSteps the number of steps buffered before a flush
+     * @param writer receives the samples of every flushed buffer
+     */
+    Probes(
+        const UnstructuredMesh& mesh,
+        const std::vector<Vec3>& points,
+        localIdx nFields,
+        localIdx bufferSteps,
+        ProbeWriter<ValueType> writer
+    );
+
+    Probes(const Probes&) = delete;
+
+    Probes& operator=(const Probes&) = delete;
+
+    /* @brief writes the remaining samples */
+    ~Probes() { finish(); }
+
+    const ProbeLocations& locations() const { return locations_; }
+
+    /* @brief samples the fields at the probe points, flushes the buffer if it is full */
+    void sample(const std::vector<const VolumeField<ValueType>*>& fields, scalar time);
+
+    /* @brief enqueues the transfer of the buffered samples to the host and continues in the
+     * other buffer, the samples of the previous flush are written first
+     */
+    void flush();
+
+    /* @brief flushes the buffered samples and waits for all transfers to write them */
+    void finish();
+
+private:
+
+    /* @brief waits for the transfer of buffer b and passes its samples to the writer */
+    void write(std::size_t b);
+
+    ProbeLocations locations_;
+    localIdx nFields_;
+    localIdx bufferSteps_;
+    ProbeWriter<ValueType> writer_;
+
+    std::array<Vector<ValueType>, 2> buffers_;         // the device buffers
+    std::array<HostMirror<ValueType>, 2> mirrors_;     // the host copies of the buffers
+    std::array<std::vector<scalar>, 2> times_;         // the sampled times per buffer
+    std::array<bool, 2> pending_ {false, false};       // whether a transfer is not written
+    std::size_t active_ {0};                           // the buffer that is sampled into
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "NeoN/core/demangle.hpp"
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/input.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/stencilDataBase.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief creates a key identifying the remaining tokens of a scheme, ie. from the next token on
+ *
+ * @return the key or nullopt if a token is of a type which is not written, see writeContentKey
+ */
+std::optional<std::string> schemeCacheKey(const TokenList& tokens);
+
+/* @brief the scheme objects of one runtime selection factory constructed on a mesh
+ *
+ * The factories of the schemes only hold references to the mesh and to data shared through the
+ * stencil database, eg. the GeometryScheme, hence a cached scheme can be cloned instead of being
+ * selected and constructed again whenever an expression is rebuilt.
+ */
+template<typename Factory>
+class SchemeCache
+{
+public:
+
+    /* @brief returns a clone of the cached scheme and skips the tokens it consumed on
+     * construction, or nullptr if no scheme is cached
+     *
+     * @param key, the key of the scheme, see schemeCacheKey
+     * @param exec, the executor of the scheme
+     * @param mesh, the mesh of the scheme
+     * @param tokens, the tokens the scheme would be constructed from
+     */
+    std::unique_ptr<Factory> find(
+        const std::string& key,
+        const Executor& exec,
+        const UnstructuredMesh& mesh,
+        const TokenList& tokens
+    ) const
+    {
+        auto [begin, end] = schemes_.equal_range(key);
+        for (auto it = begin; it != end; ++it)
+        {
+            if (it->second.exec == exec && it->second.mesh == &mesh)
+            {
+                tokens.skip(it->second.nTokens);
+                return it->second.prototype->clone();
+            }
+        }
+        return nullptr;
+    }
+
+    /* @brief caches a clone of a constructed scheme
+     *
+     * @param key, the key of the scheme, see schemeCacheKey
+     * @param exec, the executor of the scheme
+     * @param mesh, the mesh of the scheme
+     * @param scheme, the constructed scheme
+     * @param nTokens, the number of tokens consumed by the construction
+     */
+    void insert(
+        const std::string& key,
+        const Executor& exec,
+        const UnstructuredMesh& mesh,
+        const Factory& scheme,
+        std::size_t nTokens
+    )
+    {
+        schemes_.emplace(key, Entry {exec, &mesh, scheme.clone(), nTokens});
+    }
+
+    /* @brief the number of cached schemes */
+    std::size_t size() const { return schemes_.size(); }
+
+private:
+
+    struct Entry
+    {
+        Executor exec;
+        // the cache is copied together with the stencil database of a mesh, the clones of the
+        // copy must not be returned for the new mesh
+        const UnstructuredMesh* mesh;
+        std::shared_ptr<const Factory> prototype;
+        std::size_t nTokens;
+    };
+
+    std::unordered_multimap<std::string, Entry> schemes_;
+};
+
+/* @brief returns the scheme cache of a factory on the mesh, which is stored in its stencil
+ * database
+ */
+template<typename Factory>
+SchemeCache<Factory>& schemeCache(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<SchemeCache<Factory>> key(
+        "SchemeCache<" + demangle(typeid(Factory).name()) + ">"
+    );
+    return mesh.stencilDB().getOrCreate(key, []() { return SchemeCache<Factory>(); });
+}
+
+/* @brief creates a scheme of a runtime selection factory or clones the scheme cached on the mesh
+ *
+ * Schemes read from a token list are cached by the remaining tokens and the executor, the tokens
+ * are consumed as if the scheme was constructed. Schemes read from a dictionary are always
+ * constructed.
+ *
+ * @param exec, the executor of the scheme
+ * @param mesh, the mesh of the scheme
+ * @param input, the input the scheme is constructed from
+ * @param create, constructs the scheme from the input if it is not cached
+ */
+template<typename Factory, typename Create>
+std::unique_ptr<Factory>
+createCached(const Executor& exec, const UnstructuredMesh& mesh, const Input& input, Create create)
+{
+    if (!std::holds_alternative<TokenList>(input))
+    {
+        return create();
+    }
+    const auto& tokens = std::get<TokenList>(input);
+    const auto key = schemeCacheKey(tokens);
+    if (!key)
+    {
+        return create();
+    }
+    auto& cache = schemeCache<Factory>(mesh);
+    if (auto scheme = cache.find(*key, exec, mesh, tokens))
+    {
+        return scheme;
+    }
+    const auto first = tokens.nextIndex();
+    auto scheme = create();
+    cache.insert(*key, exec, mesh, *scheme, tokens.nextIndex() - first);
+    return scheme;
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
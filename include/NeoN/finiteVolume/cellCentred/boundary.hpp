@@ -4,38 +4,57 @@
 
 #pragma once
 
+#include <string>
+#include <typeinfo>
+#include <vector>
+
 #include "NeoN/core/dictionary.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/stencilDataBase.hpp"
 
 #include "boundary/volume/empty.hpp"
 #include "boundary/volume/calculated.hpp"
 #include "boundary/volume/extrapolated.hpp"
 #include "boundary/volume/fixedValue.hpp"
 #include "boundary/volume/fixedGradient.hpp"
+#include "boundary/volume/processor.hpp"
 
 #include "boundary/surface/empty.hpp"
 #include "boundary/surface/calculated.hpp"
 #include "boundary/surface/fixedValue.hpp"
+#include "boundary/surface/processor.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
 
 /* @brief creates a vector of boundary conditions of type calculated for every boundary
+ *
+ * The conditions are created through the runtime selection once per mesh and stored in the
+ * stencil database of the mesh, the returned copies share the stateless conditions, hence the
+ * boundaries of temporary fields cost a vector of pointers.
  *
  * @tparam Type of the Boundary ie SurfaceBoundary<scalar>
  */
 template<typename BoundaryType>
 std::vector<BoundaryType> createCalculatedBCs(const UnstructuredMesh& mesh)
 {
-    std::vector<BoundaryType> bcs;
-    bcs.reserve(static_cast<std::size_t>(mesh.nBoundaries()));
-
-    for (localIdx patchID = 0; patchID < mesh.nBoundaries(); patchID++)
-    {
-        Dictionary patchDict({{"type", std::string("calculated")}});
-        bcs.emplace_back(mesh, patchDict, patchID);
-    }
-    return bcs;
+    static const StencilKey<std::vector<BoundaryType>> key(
+        std::string("CalculatedBCs_") + typeid(BoundaryType).name()
+    );
+    return mesh.stencilDB().getOrCreate(
+        key,
+        [&mesh]()
+        {
+            std::vector<BoundaryType> bcs;
+            bcs.reserve(static_cast<std::size_t>(mesh.nBoundaries()));
+            for (localIdx patchID = 0; patchID < mesh.nBoundaries(); patchID++)
+            {
+                Dictionary patchDict({{"type", std::string("calculated")}});
+                bcs.emplace_back(mesh, patchDict, patchID);
+            }
+            return bcs;
+        }
+    );
 };
 
 template<typename BoundaryType>
@@ -76,6 +95,11 @@ template class fvcc::volumeBoundary::Extrapolated<Vec3>;
 template class fvcc::volumeBoundary::Empty<scalar>;
 template class fvcc::volumeBoundary::Empty<Vec3>;
 
+#ifdef NF_WITH_MPI_SUPPORT
+template class fvcc::volumeBoundary::Processor<scalar>;
+template class fvcc::volumeBoundary::Processor<Vec3>;
+#endif
+
 template class fvcc::SurfaceBoundaryFactory<scalar>;
 template class fvcc::SurfaceBoundaryFactory<Vec3>;
 
@@ -88,4 +112,7 @@ template class fvcc::surfaceBoundary::Calculated<Vec3>;
 template class fvcc::surfaceBoundary::Empty<scalar>;
 template class fvcc::surfaceBoundary::Empty<Vec3>;
 
+template class fvcc::surfaceBoundary::Processor<scalar>;
+template class fvcc::surfaceBoundary::Processor<Vec3>;
+
 }
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @class BatchedVolumeBoundary
+ * @brief corrects the boundary conditions of all patches of a volume field in a single kernel
+ *
+ * The kinds and parameters of the patches are stored in a table on the executor, which is
+ * indexed by the patch of each boundary face, see BoundaryMesh::facePatch. Hence a mesh with
+ * many small patches requires a single kernel launch instead of one launch per patch. Patches
+ * of a Custom kind are corrected afterwards by their own correctBoundaryCondition.
+ */
+template<typename ValueType>
+class BatchedVolumeBoundary
+{
+public:
+
+    BatchedVolumeBoundary(
+        const UnstructuredMesh& mesh, const std::vector<VolumeBoundary<ValueType>>& bcs
+    );
+
+    /* @brief corrects all patches, bcs have to be the conditions the table was created from */
+    void correctBoundaryConditions(
+        Field<ValueType>& domainVector, std::vector<VolumeBoundary<ValueType>>& bcs
+    ) const;
+
+private:
+
+    const UnstructuredMesh& mesh_;
+    Vector<int> patchKinds_;          ///< The BatchedBoundaryKind of every patch
+    Vector<ValueType> patchValues_;   ///< The parameter of every patch
+    std::vector<std::size_t> custom_; ///< The patches with their own correction
+    bool batched_;                    ///< Whether any patch is corrected by the batched kernel
+    bool writesRefValue_;             ///< Whether any batched patch writes the reference value
+    bool writesRefGrad_;              ///< Whether any batched patch writes the reference gradient
+};
+
+}
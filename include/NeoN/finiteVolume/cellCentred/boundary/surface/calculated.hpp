@@ -39,5 +39,7 @@ public:
     {
         return std::make_unique<Calculated>(*this);
     }
+
+    virtual bool stateless() const override { return true; }
 };
 }
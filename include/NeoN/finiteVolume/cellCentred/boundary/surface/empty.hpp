@@ -36,6 +36,8 @@ public:
     {
         return std::make_unique<Empty>(*this);
     }
+
+    virtual bool stateless() const override { return true; }
 };
 
 }
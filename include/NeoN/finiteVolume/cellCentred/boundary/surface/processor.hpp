@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/finiteVolume/cellCentred/boundary/surfaceBoundaryFactory.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred::surfaceBoundary
+{
+
+/* @brief the surface values of a processor patch are computed from the coupled volume fields,
+ * eg. by interpolation, which completes the halo exchange of the volume processor patch
+ */
+template<typename ValueType>
+class Processor :
+    public SurfaceBoundaryFactory<ValueType>::template Register<Processor<ValueType>>
+{
+    using Base = SurfaceBoundaryFactory<ValueType>::template Register<Processor<ValueType>>;
+
+public:
+
+    Processor(const UnstructuredMesh& mesh, const Dictionary& dict, localIdx patchID)
+        : Base(mesh, dict, patchID)
+    {}
+
+    virtual void correctBoundaryCondition([[maybe_unused]] Field<ValueType>& domainVector) override
+    {}
+
+    static std::string name() { return "processor"; }
+
+    static std::string doc() { return "The values are computed from coupled volume fields."; }
+
+    static std::string schema() { return "none"; }
+
+    virtual std::unique_ptr<SurfaceBoundaryFactory<ValueType>> clone() const override
+    {
+        return std::make_unique<Processor>(*this);
+    }
+};
+
+}
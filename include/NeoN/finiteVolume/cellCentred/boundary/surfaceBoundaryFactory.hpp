@@ -33,6 +33,11 @@ public:
     virtual void correctBoundaryCondition(Field<ValueType>& field) = 0;
 
     virtual std::unique_ptr<SurfaceBoundaryFactory> clone() const = 0;
+
+    /* @brief conditions without state, which is modified by correctBoundaryCondition or per
+     * field, override this to share one instance between all copies of the boundary
+     */
+    virtual bool stateless() const { return false; }
 };
 
 
@@ -57,11 +62,22 @@ public:
           ))
     {}
 
+    /* @brief copies the boundary, a stateless condition is shared instead of cloned, hence the
+     * copies of the calculated boundaries of temporary fields do not allocate
+     */
     SurfaceBoundary(const SurfaceBoundary& other)
         : BoundaryPatchMixin(other),
-          boundaryCorrectionStrategy_(other.boundaryCorrectionStrategy_->clone())
+          boundaryCorrectionStrategy_(
+              other.boundaryCorrectionStrategy_->stateless()
+                  ? other.boundaryCorrectionStrategy_
+                  : std::shared_ptr<SurfaceBoundaryFactory<ValueType>>(
+                      other.boundaryCorrectionStrategy_->clone()
+                  )
+          )
     {}
 
+    SurfaceBoundary& operator=(const SurfaceBoundary&) = delete;
+
     virtual void correctBoundaryCondition(Field<ValueType>& domainVector)
     {
         boundaryCorrectionStrategy_->correctBoundaryCondition(domainVector);
@@ -71,7 +87,7 @@ public:
 private:
 
     // NOTE needs full namespace to be not ambiguous
-    std::unique_ptr<NeoN::finiteVolume::cellCentred::SurfaceBoundaryFactory<ValueType>>
+    std::shared_ptr<NeoN::finiteVolume::cellCentred::SurfaceBoundaryFactory<ValueType>>
         boundaryCorrectionStrategy_;
 };
 
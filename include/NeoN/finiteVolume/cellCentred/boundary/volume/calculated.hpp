@@ -37,5 +37,12 @@ public:
     {
         return std::make_unique<Calculated>(*this);
     }
+
+    virtual bool stateless() const final { return true; }
+
+    virtual BatchedBoundaryParameters<ValueType> batchedParameters() const final
+    {
+        return {BatchedBoundaryKind::None, zero<ValueType>()};
+    }
 };
 }
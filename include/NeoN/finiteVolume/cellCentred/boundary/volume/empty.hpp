@@ -35,6 +35,13 @@ public:
     {
         return std::make_unique<Empty>(*this);
     }
+
+    virtual bool stateless() const final { return true; }
+
+    virtual BatchedBoundaryParameters<ValueType> batchedParameters() const final
+    {
+        return {BatchedBoundaryKind::None, zero<ValueType>()};
+    }
 };
 
 }
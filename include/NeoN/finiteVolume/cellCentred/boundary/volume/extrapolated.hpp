@@ -29,8 +29,8 @@ void extrapolateValue(
 {
     const auto iVector = domainVector.internalVector().view();
 
-    auto [refGradient, value, valueFraction, refValue, faceCells] = views(
-        domainVector.boundaryData().refGrad(),
+    // the reference gradient is not read for a value fraction of one, hence it is not touched
+    auto [value, valueFraction, refValue, faceCells] = views(
         domainVector.boundaryData().value(),
         domainVector.boundaryData().valueFraction(),
         domainVector.boundaryData().refValue(),
@@ -45,9 +45,8 @@ void extrapolateValue(
             // operator / is not defined for all ValueTypes
             ValueType internalCellValue = iVector[faceCells[i]];
             value[i] = internalCellValue;
-            valueFraction[i] = 1.0;          // only use refValue
-            refValue[i] = internalCellValue; // not used
-            refGradient[i] = zero<ValueType>();
+            valueFraction[i] = 1.0; // only use refValue
+            refValue[i] = internalCellValue;
         },
         "extrapolateValue"
     );
@@ -84,6 +83,13 @@ public:
         return std::make_unique<Extrapolated>(*this);
     }
 
+    virtual bool stateless() const final { return true; }
+
+    virtual BatchedBoundaryParameters<ValueType> batchedParameters() const final
+    {
+        return {BatchedBoundaryKind::Extrapolated, zero<ValueType>()};
+    }
+
 private:
 
     const UnstructuredMesh& mesh_;
@@ -30,11 +30,11 @@ void setGradientValue(
 {
     const auto iVector = domainVector.internalVector().view();
 
-    auto [refGradient, value, valueFraction, refValue, faceCells, deltaCoeffs] = views(
+    // the reference value is not read for a value fraction of zero, hence it is not touched
+    auto [refGradient, value, valueFraction, faceCells, deltaCoeffs] = views(
         domainVector.boundaryData().refGrad(),
         domainVector.boundaryData().value(),
         domainVector.boundaryData().valueFraction(),
-        domainVector.boundaryData().refValue(),
         mesh.boundaryMesh().faceCells(),
         mesh.boundaryMesh().deltaCoeffs()
     );
@@ -47,8 +47,7 @@ void setGradientValue(
             refGradient[i] = fixedGradient;
             // operator / is not defined for all ValueTypes
             value[i] = iVector[faceCells[i]] + fixedGradient * (1 / deltaCoeffs[i]);
-            valueFraction[i] = 0.0;          // only use refGrad
-            refValue[i] = zero<ValueType>(); // not used
+            valueFraction[i] = 0.0; // only use refGrad
         },
         "setGradientValue"
     );
@@ -86,6 +85,11 @@ public:
         return std::make_unique<FixedGradient>(*this);
     }
 
+    virtual BatchedBoundaryParameters<ValueType> batchedParameters() const final
+    {
+        return {BatchedBoundaryKind::FixedGradient, fixedGradient_};
+    }
+
 private:
 
     const UnstructuredMesh& mesh_;
@@ -24,8 +24,8 @@ void setFixedValue(
     Field<ValueType>& domainVector, std::pair<size_t, size_t> range, ValueType fixedValue
 )
 {
-    auto [refGradient, value, valueFraction, refValue] = views(
-        domainVector.boundaryData().refGrad(),
+    // the reference gradient is not read for a value fraction of one, hence it is not touched
+    auto [value, valueFraction, refValue] = views(
         domainVector.boundaryData().value(),
         domainVector.boundaryData().valueFraction(),
         domainVector.boundaryData().refValue()
@@ -37,9 +37,9 @@ void setFixedValue(
         KOKKOS_LAMBDA(const localIdx i) {
             refValue[i] = fixedValue;
             value[i] = fixedValue;
-            valueFraction[i] = 1.0;      // only used refValue
-            refGradient[i] = fixedValue; // not used
-        }
+            valueFraction[i] = 1.0; // only used refValue
+        },
+        "VolumeFixedValue::setFixedValue"
     );
 }
 
@@ -73,6 +73,11 @@ public:
         return std::make_unique<FixedValue>(*this);
     }
 
+    virtual BatchedBoundaryParameters<ValueType> batchedParameters() const final
+    {
+        return {BatchedBoundaryKind::FixedValue, fixedValue_};
+    }
+
 private:
 
     ValueType fixedValue_;
@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
+#include "NeoN/mesh/unstructured/communicator.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief registers the communicator exchanging the halo of the processor patch of a decomposed
+ * mesh, see createCommunicator, the communicator has to outlive the fields of the mesh
+ */
+void setProcessorCommunicator(const UnstructuredMesh& mesh, Communicator& comm);
+
+/* @brief the communicator registered with setProcessorCommunicator */
+Communicator& processorCommunicator(const UnstructuredMesh& mesh);
+
+/* @brief the couplings across a processor patch as interface coefficients
+ *
+ * Returns the local row, ie. the face cell, and the global column, ie. the global index of the
+ * remote cell, of every face of the patch, which are the interface rows and columns of a
+ * DistributedLinearSystem. This is a collective operation.
+ */
+std::pair<Vector<localIdx>, Vector<globalIdx>> processorInterface(
+    const UnstructuredMesh& mesh, localIdx patchID, const la::GlobalRowNumbering& numbering
+);
+
+namespace volumeBoundary
+{
+
+namespace detail
+{
+
+/* @brief returns a communication name, the names agree on all ranks if the processor patches
+ *  are created and destroyed in the same order
+ *
+ * The released names are reused, smallest first, hence copies of the fields do not grow the
+ * maps and timers of the communicator.
+ */
+std::string nextProcessorCommName();
+
+/* @brief returns a name of nextProcessorCommName for reuse */
+void releaseProcessorCommName(const std::string& name);
+
+/* @brief the state of the halo exchange of a processor patch
+ *
+ * The halo holds the internal values followed by the received values of the remote cells of
+ * the patch faces, see DecomposedMesh. The state is shared by the patch and the deferred update
+ * of the boundary data, hence an ongoing exchange is completed by the last of them, which also
+ * releases the communication name if it was taken from nextProcessorCommName.
+ */
+template<typename ValueType>
+struct ProcessorExchange
+{
+    ProcessorExchange(
+        Communicator& communicator,
+        const Executor& exec,
+        localIdx haloSize,
+        std::string name,
+        bool ownsName
+    )
+        : comm(communicator), halo(exec, haloSize), commName(std::move(name)), pending(false),
+          ownsName(ownsName)
+    {}
+
+    ~ProcessorExchange()
+    {
+        wait();
+        if (ownsName)
+        {
+            comm.releaseComm(commName);
+            releaseProcessorCommName(commName);
+        }
+    }
+
+    /* @brief completes an ongoing exchange */
+    void wait()
+    {
+        if (pending)
+        {
+            comm.finaliseComm(halo, commName);
+            pending = false;
+        }
+    }
+
+    Communicator& comm;
+    Vector<ValueType> halo;
+    std::string commName;
+    bool pending;
+    bool ownsName;
+};
+
+/* @brief completes the exchange and sets the boundary values of the processor patch
+ *
+ * The value is the interpolated face value, explicit operators use it directly. The reference
+ * value is the value of the remote cell with a value fraction of one, hence implicit operators
+ * couple the remote cell explicitly, an implicit coupling is assembled into the interface
+ * coefficients, see processorInterface.
+ */
+template<typename ValueType>
+void finaliseProcessorExchange(
+    ProcessorExchange<ValueType>& exchange,
+    BoundaryData<ValueType>& boundaryData,
+    const UnstructuredMesh& mesh,
+    std::pair<localIdx, localIdx> range
+)
+{
+    exchange.wait();
+
+    auto [value, refValue, valueFraction] =
+        views(boundaryData.value(), boundaryData.refValue(), boundaryData.valueFraction());
+    const auto [halo, faceCells, weights] = views(
+        std::as_const(exchange.halo), mesh.boundaryMesh().faceCells(), mesh.boundaryMesh().weights()
+    );
+    const auto nCells = mesh.nCells();
+    const auto start = range.first;
+
+    NeoN::parallelFor(
+        boundaryData.value().exec(),
+        range,
+        KOKKOS_LAMBDA(const localIdx i) {
+            const ValueType remote = halo[nCells + (i - start)];
+            value[i] = weights[i] * halo[faceCells[i]] + (1.0 - weights[i]) * remote;
+            refValue[i] = remote;
+            valueFraction[i] = 1.0;
+        },
+        "finaliseProcessorExchange"
+    );
+}
+
+/* @brief the precision of the halo exchange, the optional precision entry is full or single */
+CommPrecision processorPrecision(const Dictionary& dict);
+
+}
+
+template<typename ValueType>
+class Processor : public VolumeBoundaryFactory<ValueType>::template Register<Processor<ValueType>>
+{
+    using Base = VolumeBoundaryFactory<ValueType>::template Register<Processor<ValueType>>;
+
+public:
+
+    Processor(const UnstructuredMesh& mesh, const Dictionary& dict, localIdx patchID)
+        : Base(mesh, dict, patchID, {.assignable = false}), mesh_(mesh),
+          ownsName_(!dict.contains("commName")),
+          commName_(
+              ownsName_ ? detail::nextProcessorCommName() : dict.get<std::string>("commName")
+          ),
+          precision_(detail::processorPrecision(dict)), exchange_(createExchange())
+    {}
+
+    // the copy exchanges independently, its name is released with its exchange state
+    Processor(const Processor& other)
+        : Base(other), mesh_(other.mesh_), ownsName_(true),
+          commName_(detail::nextProcessorCommName()), precision_(other.precision_),
+          exchange_(createExchange())
+    {}
+
+    /* @brief starts the exchange of the internal values, the boundary values are set by a
+     * deferred update, ie. the exchange is finalised when the boundary values are read
+     *
+     * This is the split-phase exchange of splitPhaseComm, the interpolation schemes read the
+     * boundary values only after the internal faces, hence the messages are in flight while the
+     * internal faces are computed.
+     */
+    virtual void correctBoundaryCondition(Field<ValueType>& domainVector) final
+    {
+        auto& boundaryData = domainVector.boundaryData();
+        // an exchange which was never read is completed first
+        boundaryData.completeUpdates();
+        auto& exchange = *exchange_;
+        exchange.wait();
+
+        const auto internal = domainVector.internalVector().view();
+        auto halo = exchange.halo.view();
+        NeoN::parallelFor(
+            domainVector.exec(),
+            {0, mesh_.nCells()},
+            KOKKOS_LAMBDA(const localIdx i) { halo[i] = internal[i]; },
+            "startProcessorExchange"
+        );
+        exchange.comm.startComm(exchange.halo, exchange.commName);
+        exchange.pending = true;
+
+        boundaryData.deferUpdate(
+            [state = exchange_, data = &boundaryData, mesh = &mesh_, range = this->range()]()
+            { detail::finaliseProcessorExchange(*state, *data, *mesh, range); }
+        );
+    }
+
+    static std::string name() { return "processor"; }
+
+    static std::string doc()
+    {
+        return "Couples the patch to the cells of other ranks with a non-blocking halo exchange, "
+               "optionally in single precision.";
+    }
+
+    static std::string schema() { return "none"; }
+
+    virtual std::unique_ptr<VolumeBoundaryFactory<ValueType>> clone() const final
+    {
+        return std::make_unique<Processor>(*this);
+    }
+
+private:
+
+    std::shared_ptr<detail::ProcessorExchange<ValueType>> createExchange() const
+    {
+        // the halo of the remote cells is appended to the cells in the order of the last patch
+        NF_ASSERT(
+            this->patchID() == mesh_.nBoundaries() - 1,
+            "The processor patch has to be the last patch of a decomposed mesh."
+        );
+        auto& comm = processorCommunicator(mesh_);
+        comm.setPrecision(commName_, precision_);
+        return std::make_shared<detail::ProcessorExchange<ValueType>>(
+            comm,
+            mesh_.exec(),
+            mesh_.nCells() + this->patchSize(),
+            commName_,
+            ownsName_
+        );
+    }
+
+    const UnstructuredMesh& mesh_;
+    bool ownsName_;
+    std::string commName_;
+    CommPrecision precision_;
+    std::shared_ptr<detail::ProcessorExchange<ValueType>> exchange_;
+};
+
+}
+
+}
+
+#endif
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/traits.hpp"
 #include "NeoN/core/dictionary.hpp"
 #include "NeoN/core/runtimeSelectionFactory.hpp"
 #include "NeoN/fields/field.hpp"
@@ -23,6 +24,26 @@ struct BoundaryAttributes
     // bool fixesValue;
 };
 
+/* @brief the boundary conditions which are updated by the batched boundary kernel, see
+ * BatchedVolumeBoundary, Custom conditions are corrected by their own kernel
+ */
+enum class BatchedBoundaryKind : int
+{
+    Custom = 0,
+    None = 1,
+    FixedValue = 2,
+    FixedGradient = 3,
+    Extrapolated = 4
+};
+
+/* @brief the kind and the parameter, ie. the fixed value or gradient, of a boundary condition */
+template<typename ValueType>
+struct BatchedBoundaryParameters
+{
+    BatchedBoundaryKind kind;
+    ValueType value;
+};
+
 template<typename ValueType>
 class VolumeBoundaryFactory :
     public NeoN::RuntimeSelectionFactory<
@@ -48,6 +69,19 @@ public:
 
     virtual std::unique_ptr<VolumeBoundaryFactory> clone() const = 0;
 
+    /* @brief conditions without state, which is modified by correctBoundaryCondition or per
+     * field, override this to share one instance between all copies of the boundary
+     */
+    virtual bool stateless() const { return false; }
+
+    /* @brief conditions which can be expressed by a BatchedBoundaryKind override this to be
+     * corrected together with all other patches in a single kernel
+     */
+    virtual BatchedBoundaryParameters<ValueType> batchedParameters() const
+    {
+        return {BatchedBoundaryKind::Custom, zero<ValueType>()};
+    }
+
     BoundaryAttributes attributes() const { return attributes_; }
 
 protected:
@@ -77,11 +111,22 @@ public:
           ))
     {}
 
+    /* @brief copies the boundary, a stateless condition is shared instead of cloned, hence the
+     * copies of the calculated boundaries of temporary fields do not allocate
+     */
     VolumeBoundary(const VolumeBoundary& other)
         : BoundaryPatchMixin(other),
-          boundaryCorrectionStrategy_(other.boundaryCorrectionStrategy_->clone())
+          boundaryCorrectionStrategy_(
+              other.boundaryCorrectionStrategy_->stateless()
+                  ? other.boundaryCorrectionStrategy_
+                  : std::shared_ptr<VolumeBoundaryFactory<ValueType>>(
+                      other.boundaryCorrectionStrategy_->clone()
+                  )
+          )
     {}
 
+    VolumeBoundary& operator=(const VolumeBoundary&) = delete;
+
     virtual void correctBoundaryCondition(Field<ValueType>& domainVector)
     {
         boundaryCorrectionStrategy_->correctBoundaryCondition(domainVector);
@@ -92,10 +137,15 @@ public:
         return boundaryCorrectionStrategy_->attributes();
     }
 
+    BatchedBoundaryParameters<ValueType> batchedParameters() const
+    {
+        return boundaryCorrectionStrategy_->batchedParameters();
+    }
+
 private:
 
     // NOTE needs full namespace to be not ambiguous
-    std::unique_ptr<NeoN::finiteVolume::cellCentred::VolumeBoundaryFactory<ValueType>>
+    std::shared_ptr<NeoN::finiteVolume::cellCentred::VolumeBoundaryFactory<ValueType>>
         boundaryCorrectionStrategy_;
 };
 
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/finiteVolume/cellCentred/faceNormalGradient/faceNormalGradient.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <memory>
+#include <type_traits>
+
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief computes the face normal gradient with an explicit non-orthogonal correction
+ *
+ * Computes nonOrthDeltaCoeffs_f (s_N - s_O) + k_f & (grad s)_f on internal faces, where the
+ * cell gradient is linearly interpolated to the faces. The boundary faces are not corrected.
+ */
+void computeCorrectedFaceNormalGrad(
+    const VolumeField<scalar>& volVector,
+    const std::shared_ptr<GeometryScheme> geometryScheme,
+    SurfaceField<scalar>& surfaceVector
+);
+
+/* @class Corrected
+ * @brief the face normal gradient with an explicit non-orthogonal correction
+ *
+ * The correction vectors and delta coefficients are computed once per mesh geometry by the
+ * GeometryScheme. The gradient of a registered field is taken from its GradientCollection and
+ * is thus shared with all other schemes requesting it in the same iteration, the gradient of an
+ * unregistered field is computed on every call. Only scalar fields are supported since the
+ * correction of a vector field requires a tensor gradient.
+ */
+template<typename ValueType>
+class Corrected :
+    public FaceNormalGradientFactory<ValueType>::template Register<Corrected<ValueType>>
+{
+    using Base = FaceNormalGradientFactory<ValueType>::template Register<Corrected<ValueType>>;
+
+    static_assert(std::is_same_v<ValueType, scalar>, "Only scalar fields can be corrected.");
+
+public:
+
+    Corrected(const Executor& exec, const UnstructuredMesh& mesh, Input)
+        : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+
+    Corrected(const Executor& exec, const UnstructuredMesh& mesh)
+        : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+
+    static std::string name() { return "corrected"; }
+
+    static std::string doc() { return "Non-orthogonal corrected face normal gradient"; }
+
+    static std::string schema() { return "none"; }
+
+    virtual void faceNormalGrad(
+        const VolumeField<ValueType>& volVector, SurfaceField<ValueType>& surfaceVector
+    ) const override
+    {
+        computeCorrectedFaceNormalGrad(volVector, geometryScheme_, surfaceVector);
+    }
+
+    virtual const SurfaceField<scalar>& deltaCoeffs() const override
+    {
+        return geometryScheme_->nonOrthDeltaCoeffs();
+    }
+
+    std::unique_ptr<FaceNormalGradientFactory<ValueType>> clone() const override
+    {
+        return std::make_unique<Corrected>(*this);
+    }
+
+private:
+
+    const std::shared_ptr<GeometryScheme> geometryScheme_;
+};
+
+// instantiate the template class
+template class Corrected<scalar>;
+
+} // namespace NeoN
@@ -12,6 +12,7 @@
 #include "NeoN/core/input.hpp"
 #include "NeoN/core/runtimeSelectionFactory.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/schemeCache.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/boundary.hpp"
@@ -31,14 +32,19 @@ public:
     static std::unique_ptr<FaceNormalGradientFactory>
     create(const Executor& exec, const UnstructuredMesh& uMesh, const Input& inputs)
     {
-        // input is dictionary the key is "interpolation"
-        std::string key =
-            (std::holds_alternative<NeoN::Dictionary>(inputs))
-                ? std::get<NeoN::Dictionary>(inputs).get<std::string>("faceNormalGradient")
-                : std::get<NeoN::TokenList>(inputs).next<std::string>();
-
-        FaceNormalGradientFactory<ValueType>::keyExistsOrError(key);
-        return FaceNormalGradientFactory<ValueType>::table().at(key)(exec, uMesh, inputs);
+        auto construct = [&]()
+        {
+            // input is dictionary the key is "interpolation"
+            std::string key =
+                (std::holds_alternative<NeoN::Dictionary>(inputs))
+                    ? std::get<NeoN::Dictionary>(inputs).get<std::string>("faceNormalGradient")
+                    : std::get<NeoN::TokenList>(inputs).next<std::string>();
+
+            FaceNormalGradientFactory<ValueType>::keyExistsOrError(key);
+            return FaceNormalGradientFactory<ValueType>::table().at(key)(exec, uMesh, inputs);
+        };
+        // the constructed schemes are kept in the mesh and cloned when an expression is rebuilt
+        return createCached<FaceNormalGradientFactory<ValueType>>(exec, uMesh, inputs, construct);
     }
 
     static std::string name() { return "FaceNormalGradientFactory"; }
@@ -54,6 +60,11 @@ public:
 
     virtual const SurfaceField<scalar>& deltaCoeffs() const = 0;
 
+    /* @brief whether the scheme computes deltaCoeffs_f (s_N - s_O) on internal faces and
+     * deltaCoeffs_f (s_B - s_O) on boundary faces, ie. whether it can be evaluated inline
+     */
+    virtual bool inlineFaceNormalGrad() const { return false; }
+
     // Pure virtual function for cloning
     virtual std::unique_ptr<FaceNormalGradientFactory<ValueType>> clone() const = 0;
 
@@ -98,6 +109,8 @@ public:
 
     const SurfaceField<scalar>& deltaCoeffs() const { return faceNormalGradKernel_->deltaCoeffs(); }
 
+    bool inlineFaceNormalGrad() const { return faceNormalGradKernel_->inlineFaceNormalGrad(); }
+
 
     SurfaceField<ValueType> faceNormalGrad(const VolumeField<ValueType>& volVector) const
     {
@@ -58,6 +58,8 @@ public:
         return geometryScheme_->nonOrthDeltaCoeffs();
     }
 
+    bool inlineFaceNormalGrad() const override { return true; }
+
     std::unique_ptr<FaceNormalGradientFactory<ValueType>> clone() const override
     {
         return std::make_unique<Uncorrected>(*this);
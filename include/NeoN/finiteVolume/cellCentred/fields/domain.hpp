@@ -107,6 +107,13 @@ public:
      */
     BoundaryData<ValueType>& boundaryData() { return field_.boundaryData(); }
 
+    /**
+     * @brief Returns the bytes allocated by the internal and the boundary field.
+     *
+     * @return The allocated bytes.
+     */
+    std::size_t memoryBytes() const { return field_.memoryBytes(); }
+
     /**
      * @brief Returns a const reference to the executor object.
      *
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/mesh/unstructured/loadBalancing.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief moves a volume field and its old time levels to a new decomposition
+ *
+ * The target field lives on the mesh of the new decomposition, its internal values are
+ * redistributed and its boundary conditions, including the processor boundary, are corrected.
+ * If both fields are registered, the old time levels of from are redistributed into the old time
+ * levels of to, which are created if required. This is a collective operation.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param redistribution The cells moved from the mesh of from to the mesh of to.
+ * @param from The field on the old decomposition.
+ * @param to The field on the new decomposition.
+ */
+template<typename ValueType>
+void redistribute(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const Redistribution& redistribution,
+    const VolumeField<ValueType>& from,
+    VolumeField<ValueType>& to
+)
+{
+    to.internalVector() = NeoN::redistribute(mpiEnviron, redistribution, from.internalVector());
+    to.correctBoundaryConditions();
+    if (!from.registered() || !to.registered())
+    {
+        return;
+    }
+    const auto& oldTimes = OldTimeCollection::instance(VectorCollection::instance(from));
+    const VolumeField<ValueType>* fromLevel = &from;
+    VolumeField<ValueType>* toLevel = &to;
+    while (oldTimes.findNextTime(fromLevel->key) != "")
+    {
+        fromLevel = &oldTime(*fromLevel);
+        toLevel = &oldTime(*toLevel);
+        toLevel->internalVector() =
+            NeoN::redistribute(mpiEnviron, redistribution, fromLevel->internalVector());
+        toLevel->correctBoundaryConditions();
+    }
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
+
+#endif
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+#include <string>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/mesh/unstructured/communicator.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief starts the synchronisation of the processor face values of a surface field
+ *
+ * The communicator is created by createFaceCommunicator, thus the part of lower index sends
+ * the boundary values of its processor faces and the part of higher index receives them.
+ */
+template<typename ValueType>
+void startComm(Communicator& comm, SurfaceField<ValueType>& field, const std::string& commName)
+{
+    comm.startComm(field.boundaryData(), commName);
+}
+
+/* @brief completes the synchronisation of the processor face values of a surface field
+ *
+ * The received values are stored in the boundary values and the boundary faces of the internal
+ * vector. Oriented values, eg. face fluxes, are negated since the processor faces point out of
+ * the local cells on both parts.
+ */
+template<typename ValueType>
+void finaliseComm(
+    Communicator& comm,
+    SurfaceField<ValueType>& field,
+    const std::string& commName,
+    bool oriented = false
+)
+{
+    comm.finaliseComm(field.boundaryData(), commName);
+    const auto& received = comm.receiveIndices(field.exec());
+    auto [value, internal] = views(field.boundaryData().value(), field.internalVector());
+    const auto receivedV = received.view();
+    const auto nInternalFaces = field.mesh().nInternalFaces();
+    const scalar sign = oriented ? -1.0 : 1.0;
+    parallelFor(
+        field.exec(),
+        {0, received.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            const auto bfacei = receivedV[i];
+            value[bfacei] = sign * value[bfacei];
+            internal[nInternalFaces + bfacei] = value[bfacei];
+        },
+        "finaliseSurfaceFieldComm"
+    );
+}
+
+}
+
+#endif
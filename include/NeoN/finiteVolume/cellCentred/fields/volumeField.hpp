@@ -7,7 +7,9 @@
 #include "NeoN/core/database/database.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/domain.hpp"
 #include "NeoN/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
+#include "NeoN/finiteVolume/cellCentred/boundary/batchedVolumeBoundary.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace NeoN::finiteVolume::cellCentred
@@ -116,7 +118,8 @@ public:
      * @brief Corrects the boundary conditions of the surface field.
      *
      * This function applies the correctBoundaryConditions() method to each boundary condition in
-     * the field.
+     * the field. The standard conditions of all patches are corrected in a single kernel, see
+     * BatchedVolumeBoundary.
      */
     void correctBoundaryConditions();
 
@@ -178,6 +181,9 @@ private:
 
     std::vector<VolumeBoundary<ValueType>> boundaryConditions_; // The vector of boundary conditions
     std::optional<Database*> db_; // The optional pointer to the database
+
+    // The batched correction, created on the first correction and shared by copies
+    std::shared_ptr<const BatchedVolumeBoundary<ValueType>> batchedBoundary_;
 };
 
 } // namespace NeoN
@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/**
+ * @class BlockView
+ * @brief A view of the cell values of several components stored in one contiguous array.
+ *
+ * The values of component k are stored in [k * nCells, (k + 1) * nCells), hence a kernel over
+ * the cells that loops over the components loads each component with unit stride.
+ *
+ * @tparam ValueType The value type of the components, possibly const.
+ */
+template<typename ValueType>
+class BlockView
+{
+public:
+
+    BlockView() = default;
+
+    BlockView(View<ValueType> values, localIdx nCells) : values_(values), nCells_(nCells) {}
+
+    /**
+     * @brief Access the value of the cell celli of component k.
+     */
+    KOKKOS_INLINE_FUNCTION
+    ValueType& operator()(const localIdx k, const localIdx celli) const
+    {
+        return values_[k * nCells_ + celli];
+    }
+
+    /**
+     * @brief The contiguous values of component k.
+     */
+    KOKKOS_INLINE_FUNCTION
+    View<ValueType> component(const localIdx k) const
+    {
+        return View<ValueType>(values_.data() + k * nCells_, static_cast<size_t>(nCells_));
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    localIdx nCells() const { return nCells_; }
+
+    KOKKOS_INLINE_FUNCTION
+    localIdx nComponents() const
+    {
+        return nCells_ == 0 ? 0 : static_cast<localIdx>(values_.size()) / nCells_;
+    }
+
+private:
+
+    View<ValueType> values_;
+    localIdx nCells_ {0};
+};
+
+/**
+ * @class VolumeFieldBlock
+ * @brief A block of volume fields, eg. the mass fractions of the species, whose cell values
+ * share one allocation.
+ *
+ * The cell values of all components are stored component by component in a single vector, see
+ * BlockView. Kernels over all components thus read one array, and the block can be handed to
+ * vector based algorithms, eg. ODE integrators or reductions, as a single vector of size
+ * nComponents * nCells. Each component keeps its own name, boundary conditions and boundary
+ * data. The components can be converted from and to the per component VolumeField.
+ *
+ * @tparam ValueType The value type of the components.
+ */
+template<typename ValueType>
+class VolumeFieldBlock
+{
+public:
+
+    /**
+     * @brief Creates a block with uninitialized cell values of nComponents components, all with
+     * the same boundary conditions.
+     *
+     * @param exec The executor
+     * @param name The name of the block
+     * @param mesh The underlying mesh
+     * @param componentNames The names of the components
+     * @param boundaryConditions The boundary conditions of every component
+     */
+    VolumeFieldBlock(
+        const Executor& exec,
+        std::string name,
+        const UnstructuredMesh& mesh,
+        const std::vector<std::string>& componentNames,
+        const std::vector<VolumeBoundary<ValueType>>& boundaryConditions
+    );
+
+    /**
+     * @brief Creates a block by copying the cell values and the boundary data of the fields.
+     *
+     * @param name The name of the block
+     * @param fields The fields, which have to share the executor and the mesh
+     */
+    VolumeFieldBlock(std::string name, const std::vector<const VolumeField<ValueType>*>& fields);
+
+    /**
+     * @brief Returns the number of components.
+     */
+    localIdx nComponents() const { return static_cast<localIdx>(componentNames_.size()); }
+
+    /**
+     * @brief Returns the number of cells of each component.
+     */
+    localIdx nCells() const { return mesh_.nCells(); }
+
+    /**
+     * @brief Returns the cell values of all components as one vector.
+     */
+    const Vector<ValueType>& internalVector() const { return internalVector_; }
+
+    /** @copydoc VolumeFieldBlock::internalVector() */
+    Vector<ValueType>& internalVector() { return internalVector_; }
+
+    /**
+     * @brief Returns the view of the cell values of all components.
+     */
+    BlockView<const ValueType> view() const { return {internalVector_.view(), nCells()}; }
+
+    /** @copydoc VolumeFieldBlock::view() */
+    BlockView<ValueType> view() { return {internalVector_.view(), nCells()}; }
+
+    /**
+     * @brief Returns the range of the cell values of component k in the internal vector.
+     */
+    std::pair<localIdx, localIdx> range(const localIdx k) const
+    {
+        return {k * nCells(), (k + 1) * nCells()};
+    }
+
+    /**
+     * @brief Returns the name of component k.
+     */
+    const std::string& componentName(const localIdx k) const
+    {
+        return componentNames_[static_cast<size_t>(k)];
+    }
+
+    /**
+     * @brief Returns the boundary data of component k.
+     */
+    const BoundaryData<ValueType>& boundaryData(const localIdx k) const
+    {
+        return boundaryData_[static_cast<size_t>(k)];
+    }
+
+    /** @copydoc VolumeFieldBlock::boundaryData() */
+    BoundaryData<ValueType>& boundaryData(const localIdx k)
+    {
+        return boundaryData_[static_cast<size_t>(k)];
+    }
+
+    /**
+     * @brief Returns the boundary conditions of component k.
+     */
+    const std::vector<VolumeBoundary<ValueType>>& boundaryConditions(const localIdx k) const
+    {
+        return boundaryConditions_[static_cast<size_t>(k)];
+    }
+
+    /**
+     * @brief Returns a copy of component k as a volume field.
+     */
+    VolumeField<ValueType> component(const localIdx k) const;
+
+    /**
+     * @brief Copies the cell values and the boundary data of field into component k.
+     */
+    void assign(const localIdx k, const VolumeField<ValueType>& field);
+
+    /**
+     * @brief Corrects the boundary conditions of all components.
+     *
+     * The boundary conditions act on volume fields, hence every component is corrected on a
+     * temporary copy whose boundary data is copied back.
+     */
+    void correctBoundaryConditions();
+
+    /**
+     * @brief Returns the bytes allocated by the cell values and the boundary data.
+     */
+    std::size_t memoryBytes() const;
+
+    const Executor& exec() const { return internalVector_.exec(); }
+
+    const UnstructuredMesh& mesh() const { return mesh_; }
+
+    std::string name; // The name of the block
+
+private:
+
+    const UnstructuredMesh& mesh_;             // The unstructured mesh object
+    Vector<ValueType> internalVector_;         // The cell values of all components
+    std::vector<std::string> componentNames_;  // The names of the components
+    std::vector<BoundaryData<ValueType>> boundaryData_; // The boundary data per component
+    std::vector<std::vector<VolumeBoundary<ValueType>>> boundaryConditions_; // Per component
+};
+
+}
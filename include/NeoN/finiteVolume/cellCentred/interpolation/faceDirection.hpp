@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the number of faces whose direction is packed into one word */
+inline constexpr localIdx facesPerDirectionWord = 32;
+
+/* @brief returns whether the flux of the internal face facei is non-negative, ie. the owner is
+ * the upwind cell
+ */
+KOKKOS_INLINE_FUNCTION
+bool ownerUpwind(View<const std::uint32_t> directions, const localIdx facei)
+{
+    const auto word = directions[facei / facesPerDirectionWord];
+    return ((word >> (facei % facesPerDirectionWord)) & 1u) != 0;
+}
+
+/* @class FaceDirection
+ * @brief the sign of a face flux packed into one bit per internal face
+ *
+ * The upwind schemes only need the sign of the flux, hence reading a bit instead of the scalar
+ * flux reduces the traffic of the upwind branch by a factor of 64. The bits are computed once
+ * per flux update and shared by all fields transported by the flux, see readOrCreate.
+ */
+class FaceDirection
+{
+public:
+
+    /* @brief computes the directions of the internal faces of flux */
+    explicit FaceDirection(const SurfaceField<scalar>& flux);
+
+    /* @brief the packed directions, bit facei % 32 of word facei / 32 is set if the flux of
+     * the face facei is non-negative, see ownerUpwind
+     */
+    const Vector<std::uint32_t>& directions() const { return directions_; }
+
+    /* @brief whether the directions were computed from the current values of flux */
+    bool upToDate(const SurfaceField<scalar>& flux) const;
+
+    std::size_t memoryBytes() const { return directions_.memoryBytes(); }
+
+    /* @brief returns the directions of flux, computed if flux changed since the last call
+     *
+     * The directions of the last few fluxes of a mesh are kept in its stencil database. A flux
+     * is identified by the data of its internal vector and its changes by the version of it,
+     * see Vector::version.
+     */
+    static const FaceDirection& readOrCreate(const SurfaceField<scalar>& flux);
+
+private:
+
+    const scalar* flux_;           // the data of the flux the directions were computed from
+    std::size_t fluxVersion_;      // the version of the flux data
+    Vector<std::uint32_t> directions_;
+};
+
+/* @brief the directions of the recently used fluxes of a mesh, see FaceDirection::readOrCreate
+ */
+struct FaceDirectionCache
+{
+    /* @brief the number of fluxes whose directions are kept */
+    static constexpr std::size_t maxEntries = 4;
+
+    std::vector<FaceDirection> entries; // ordered from the least to the most recently used
+
+    std::size_t memoryBytes() const;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
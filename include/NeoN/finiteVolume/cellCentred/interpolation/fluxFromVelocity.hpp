@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief computes the face flux phi_f = U_f & S_f of a velocity field
+ *
+ * For a linear interpolation the velocity is interpolated and multiplied with the face area
+ * vectors in a single pass over the faces, without a temporary surface field. The boundary faces
+ * use the boundary values of the velocity like the interpolation. Other schemes interpolate into
+ * a temporary surface field first.
+ *
+ * @param interpolation - the interpolation scheme of the velocity
+ * @param u - the velocity field
+ * @param phi - the face flux of all faces
+ */
+void fluxFromVelocity(
+    const SurfaceInterpolation<Vec3>& interpolation,
+    const VolumeField<Vec3>& u,
+    SurfaceField<scalar>& phi
+);
+
+} // namespace NeoN
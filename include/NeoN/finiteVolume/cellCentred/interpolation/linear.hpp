@@ -5,6 +5,7 @@
 #pragma once
 
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/vector/mixedPrecision.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
@@ -35,6 +36,20 @@ void computeLinearInterpolation(
     SurfaceField<ValueType>& dst
 );
 
+/* @brief linear interpolation with the weights stored in single precision
+**
+** The weights are promoted to scalar after loading, hence only the memory traffic of the
+** weights is reduced and the interpolation is evaluated in the precision of the solver.
+**
+**@param src the input field
+**@param weights weights of all faces for the interpolation
+**@param dst the target field
+*/
+template<typename ValueType>
+void computeLinearInterpolation(
+    const VolumeField<ValueType>& src, const Vector<float>& weights, SurfaceField<ValueType>& dst
+);
+
 template<typename ValueType>
 class Linear : public SurfaceInterpolationFactory<ValueType>::template Register<Linear<ValueType>>
 {
@@ -83,6 +98,10 @@ public:
         weight.boundaryData() = linearWeight.boundaryData();
     }
 
+    InlineInterpolation inlineInterpolation() const override
+    {
+        return InlineInterpolation::Linear;
+    }
 
     std::unique_ptr<SurfaceInterpolationFactory<ValueType>> clone() const override
     {
@@ -94,6 +113,76 @@ private:
     const std::shared_ptr<GeometryScheme> geometryScheme_;
 };
 
+/* @class LinearFloatWeights
+** @brief linear interpolation reading float storage of the weights, see GeometryScheme
+** floatWeights
+*/
+template<typename ValueType>
+class LinearFloatWeights :
+    public SurfaceInterpolationFactory<ValueType>::template Register<LinearFloatWeights<ValueType>>
+{
+    using Base =
+        SurfaceInterpolationFactory<ValueType>::template Register<LinearFloatWeights<ValueType>>;
+
+public:
+
+    LinearFloatWeights(
+        const Executor& exec, const UnstructuredMesh& mesh, [[maybe_unused]] Input input
+    )
+        : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+
+    LinearFloatWeights(const Executor& exec, const UnstructuredMesh& mesh)
+        : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+
+    static std::string name() { return "linearFloatWeights"; }
+
+    static std::string doc() { return "linear interpolation with float storage of the weights"; }
+
+    static std::string schema() { return "none"; }
+
+    void interpolate(const VolumeField<ValueType>& src, SurfaceField<ValueType>& dst) const override
+    {
+        computeLinearInterpolation(src, geometryScheme_->floatWeights(), dst);
+    }
+
+    void interpolate(
+        const SurfaceField<scalar>&, const VolumeField<ValueType>& src, SurfaceField<ValueType>& dst
+    ) const override
+    {
+        interpolate(src, dst);
+    }
+
+    void weight(const VolumeField<ValueType>&, SurfaceField<scalar>& weight) const override
+    {
+        floatWeight(weight);
+    }
+
+    void weight(
+        const SurfaceField<scalar>&, const VolumeField<ValueType>&, SurfaceField<scalar>& weight
+    ) const override
+    {
+        floatWeight(weight);
+    }
+
+    std::unique_ptr<SurfaceInterpolationFactory<ValueType>> clone() const override
+    {
+        return std::make_unique<LinearFloatWeights>(*this);
+    }
+
+private:
+
+    /* @brief the promoted float weights, so that weight and interpolate are consistent */
+    void floatWeight(SurfaceField<scalar>& weight) const
+    {
+        const auto& floatWeights = geometryScheme_->floatWeights();
+        weight.internalVector().resize(floatWeights.size());
+        convertPrecision(floatWeights, weight.internalVector());
+        weight.boundaryData() = geometryScheme_->weights().boundaryData();
+    }
+
+    const std::shared_ptr<GeometryScheme> geometryScheme_;
+};
+
 } // namespace NeoN
 
 namespace NeoN
@@ -107,4 +196,7 @@ template class fvcc::SurfaceInterpolationFactory<Vec3>;
 template class fvcc::Linear<scalar>;
 template class fvcc::Linear<Vec3>;
 
+template class fvcc::LinearFloatWeights<scalar>;
+template class fvcc::LinearFloatWeights<Vec3>;
+
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
 
@@ -12,6 +13,7 @@
 #include "NeoN/core/input.hpp"
 #include "NeoN/core/runtimeSelectionFactory.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/schemeCache.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/boundary.hpp"
@@ -19,6 +21,56 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+/* @brief identifies interpolation schemes that fused operator kernels can evaluate inline
+ *
+ * Both schemes compute d_f = w_f * s_O + ( 1 - w_f ) * s_N on internal faces and
+ * d_f = w_f * s_B on boundary faces, where w_f are the geometric weights for Linear and
+ * 1 or 0 depending on the flux direction for Upwind.
+ */
+enum class InlineInterpolation
+{
+    None,
+    Linear,
+    Upwind
+};
+
+/* @brief maximum number of fields processed in one pass of the batched kernels
+ *
+ * Larger batches are split, the views of a batch are captured by value in the kernels.
+ */
+inline constexpr localIdx maxBatchSize = 16;
+
+/* @brief views of a batch of fields */
+template<typename ValueType>
+using ViewBatch = Kokkos::Array<View<ValueType>, maxBatchSize>;
+
+/* @brief returns the owner weight w_f of an inline interpolation scheme */
+KOKKOS_INLINE_FUNCTION scalar inlineOwnerWeight(bool upwind, scalar flux, scalar weight)
+{
+    if (upwind)
+    {
+        return flux >= 0 ? 1.0 : 0.0;
+    }
+    return weight;
+}
+
+/* @brief interpolates several fields with the same flux in a single pass over the faces
+ *
+ * The face connectivity, the flux and the weights are read once per face for all fields.
+ *
+ * @param kind - the inline interpolation scheme, must not be None
+ * @param flux - the face flux shared by all fields
+ * @param srcs - the fields to interpolate
+ * @param dsts - the interpolated fields, one per source field
+ */
+template<typename ValueType>
+void computeBatchedInterpolation(
+    InlineInterpolation kind,
+    const SurfaceField<scalar>& flux,
+    const std::vector<const VolumeField<ValueType>*>& srcs,
+    const std::vector<SurfaceField<ValueType>*>& dsts
+);
+
 /* @class SurfaceInterpolationFactory
 **
 */
@@ -35,14 +87,19 @@ public:
     static std::unique_ptr<SurfaceInterpolationFactory<ValueType>>
     create(const Executor& exec, const UnstructuredMesh& uMesh, const Input& inputs)
     {
-        // input is dictionary the key is "interpolation"
-        std::string key =
-            (std::holds_alternative<NeoN::Dictionary>(inputs))
-                ? std::get<NeoN::Dictionary>(inputs).get<std::string>("surfaceInterpolation")
-                : std::get<NeoN::TokenList>(inputs).next<std::string>();
-
-        SurfaceInterpolationFactory<ValueType>::keyExistsOrError(key);
-        return SurfaceInterpolationFactory<ValueType>::table().at(key)(exec, uMesh, inputs);
+        auto construct = [&]()
+        {
+            // input is dictionary the key is "interpolation"
+            std::string key =
+                (std::holds_alternative<NeoN::Dictionary>(inputs))
+                    ? std::get<NeoN::Dictionary>(inputs).get<std::string>("surfaceInterpolation")
+                    : std::get<NeoN::TokenList>(inputs).next<std::string>();
+
+            SurfaceInterpolationFactory<ValueType>::keyExistsOrError(key);
+            return SurfaceInterpolationFactory<ValueType>::table().at(key)(exec, uMesh, inputs);
+        };
+        // the constructed schemes are kept in the mesh and cloned when an expression is rebuilt
+        return createCached<SurfaceInterpolationFactory<ValueType>>(exec, uMesh, inputs, construct);
     }
 
     static std::string name() { return "SurfaceInterpolationFactory"; }
@@ -69,6 +126,25 @@ public:
         SurfaceField<scalar>& weight
     ) const = 0;
 
+    /* @brief computes the weights and the interpolated values of src together
+     *
+     * Schemes which derive both from the same face data override this to compute them in a
+     * single pass over the faces, the default computes them one after another.
+     */
+    virtual void weightAndInterpolate(
+        const SurfaceField<scalar>& flux,
+        const VolumeField<ValueType>& src,
+        SurfaceField<scalar>& weight,
+        SurfaceField<ValueType>& dst
+    ) const
+    {
+        this->weight(flux, src, weight);
+        interpolate(flux, src, dst);
+    }
+
+    /* @brief returns whether the scheme can be evaluated inline, defaults to None */
+    virtual InlineInterpolation inlineInterpolation() const { return InlineInterpolation::None; }
+
     // Pure virtual function for cloning
     virtual std::unique_ptr<SurfaceInterpolationFactory<ValueType>> clone() const = 0;
 
@@ -121,6 +197,30 @@ public:
         interpolationKernel_->interpolate(flux, src, dst);
     }
 
+    /* @brief interpolates several fields transported by the same flux
+     *
+     * Schemes that can be evaluated inline process all fields in one pass over the faces, all
+     * other schemes interpolate the fields one after another.
+     */
+    void interpolate(
+        const SurfaceField<scalar>& flux,
+        const std::vector<const VolumeField<ValueType>*>& srcs,
+        const std::vector<SurfaceField<ValueType>*>& dsts
+    ) const
+    {
+        NF_ASSERT(srcs.size() == dsts.size(), "Number of source and destination fields differ.");
+        const auto kind = inlineInterpolation();
+        if (kind != InlineInterpolation::None)
+        {
+            computeBatchedInterpolation(kind, flux, srcs, dsts);
+            return;
+        }
+        for (std::size_t k = 0; k < srcs.size(); k++)
+        {
+            interpolate(flux, *srcs[k], *dsts[k]);
+        }
+    }
+
     void weight(const VolumeField<ValueType>& src, SurfaceField<scalar>& weight) const
     {
         interpolationKernel_->weight(src, weight);
@@ -135,6 +235,24 @@ public:
         interpolationKernel_->weight(flux, src, weight);
     }
 
+    /* @brief computes the weights and the interpolated values of src, see
+     * SurfaceInterpolationFactory::weightAndInterpolate
+     */
+    void weightAndInterpolate(
+        const SurfaceField<scalar>& flux,
+        const VolumeField<ValueType>& src,
+        SurfaceField<scalar>& weight,
+        SurfaceField<ValueType>& dst
+    ) const
+    {
+        interpolationKernel_->weightAndInterpolate(flux, src, weight, dst);
+    }
+
+    InlineInterpolation inlineInterpolation() const
+    {
+        return interpolationKernel_->inlineInterpolation();
+    }
+
 
     SurfaceField<ValueType> interpolate(const VolumeField<ValueType>& src) const
     {
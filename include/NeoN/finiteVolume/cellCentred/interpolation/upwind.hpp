@@ -45,6 +45,26 @@ void computeUpwindInterpolationWeights(
 );
 
 
+/* @brief computes the upwind weights and the upwind interpolation in one pass over the faces
+**
+** The internal and the boundary faces are processed in separate loops, the results agree with
+** computeUpwindInterpolationWeights and computeUpwindInterpolation.
+**
+**@param src the input field
+**@param flux the face flux determining the upwind direction
+**@param geometryWeights weights of the boundary values, see GeometryScheme
+**@param weights the target weights
+**@param dst the target field
+*/
+template<typename ValueType>
+void computeUpwindInterpolationAndWeights(
+    const VolumeField<ValueType>& src,
+    const SurfaceField<scalar>& flux,
+    const SurfaceField<scalar>& geometryWeights,
+    SurfaceField<scalar>& weights,
+    SurfaceField<ValueType>& dst
+);
+
 template<typename ValueType>
 class Upwind : public SurfaceInterpolationFactory<ValueType>::template Register<Upwind<ValueType>>
 {
@@ -95,6 +115,21 @@ public:
         computeUpwindInterpolationWeights(faceFlux, src, weights);
     }
 
+    void weightAndInterpolate(
+        const SurfaceField<scalar>& flux,
+        const VolumeField<ValueType>& src,
+        SurfaceField<scalar>& weights,
+        SurfaceField<ValueType>& dst
+    ) const override
+    {
+        computeUpwindInterpolationAndWeights(src, flux, geometryScheme_->weights(), weights, dst);
+    }
+
+    InlineInterpolation inlineInterpolation() const override
+    {
+        return InlineInterpolation::Upwind;
+    }
+
     std::unique_ptr<SurfaceInterpolationFactory<ValueType>> clone() const override
     {
         return std::make_unique<Upwind>(*this);
@@ -7,6 +7,7 @@
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/core/executor/executor.hpp"
 #include "NeoN/core/input.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
 #include "NeoN/dsl/operator.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
@@ -15,6 +16,24 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+/* @brief the inverse time step of a cell, either the global or the local time step of the cell
+ *
+ * The device copyable form of the time step of a ddt operator, see DdtOperator::timeStep.
+ */
+struct DdtTimeStep
+{
+    scalar dtInver;
+
+    bool local;
+
+    View<const scalar> localDt;
+
+    KOKKOS_INLINE_FUNCTION scalar inverse(const localIdx celli) const
+    {
+        return local ? scalar(1.0) / localDt[celli] : dtInver;
+    }
+};
+
 template<typename ValueType>
 class DdtOperator : public dsl::OperatorMixin<VolumeField<ValueType>>
 {
@@ -25,6 +44,16 @@ public:
 
     DdtOperator(dsl::Operator::Type termType, VolumeField<ValueType>& field);
 
+    /* @brief a ddt operator with a pseudo time step per cell, eg. for local time stepping
+     *
+     * The time step passed to the operations is ignored and the cell values of localDt are used
+     * instead. localDt is referenced, hence it can be updated between iterations, eg. by
+     * computeLocalTimeStep, and has to outlive the operator.
+     */
+    DdtOperator(
+        dsl::Operator::Type termType, VolumeField<ValueType>& field, const Vector<scalar>& localDt
+    );
+
     ~DdtOperator();
 
     void explicitOperation(Vector<ValueType>& source, scalar, scalar dt) const;
@@ -37,10 +66,31 @@ public:
 
     std::string getName() const { return "DdtOperator"; }
 
+    /* @brief the per cell time step or nullptr if the global time step is used */
+    const Vector<scalar>* localTimeStep() const { return localDt_; }
+
+    /* @brief the inverse time steps of the cells for the global time step dt */
+    DdtTimeStep timeStep(scalar dt) const
+    {
+        if (localDt_)
+        {
+            return {0.0, true, localDt_->view()};
+        }
+        return {scalar(1.0) / dt, false, {}};
+    }
+
+    /* @brief the old time field of the operator field */
+    const VolumeField<ValueType>& oldField() const { return oldTime_.get(this->field_); }
+
 private:
 
     // NOTE ddtOperator does not have a FactoryClass
     const la::SparsityPattern& sparsityPattern_;
+
+    const Vector<scalar>* localDt_ {nullptr};
+
+    // resolved on the first evaluation, afterwards the old time field is accessed in O(1)
+    mutable OldTimeHandle<VolumeField<ValueType>> oldTime_;
 };
 
 
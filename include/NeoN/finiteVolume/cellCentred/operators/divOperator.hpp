@@ -10,6 +10,7 @@
 #include "NeoN/core/input.hpp"
 #include "NeoN/dsl/spatialOperator.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/schemeCache.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
@@ -30,11 +31,16 @@ public:
     static std::unique_ptr<DivOperatorFactory<ValueType>>
     create(const Executor& exec, const UnstructuredMesh& uMesh, const Input& inputs)
     {
-        std::string key = (std::holds_alternative<Dictionary>(inputs))
-                            ? std::get<Dictionary>(inputs).get<std::string>("DivOperator")
-                            : std::get<TokenList>(inputs).next<std::string>();
-        DivOperatorFactory<ValueType>::keyExistsOrError(key);
-        return DivOperatorFactory<ValueType>::table().at(key)(exec, uMesh, inputs);
+        auto construct = [&]()
+        {
+            std::string key = (std::holds_alternative<Dictionary>(inputs))
+                                ? std::get<Dictionary>(inputs).get<std::string>("DivOperator")
+                                : std::get<TokenList>(inputs).next<std::string>();
+            DivOperatorFactory<ValueType>::keyExistsOrError(key);
+            return DivOperatorFactory<ValueType>::table().at(key)(exec, uMesh, inputs);
+        };
+        // the constructed schemes are kept in the mesh and cloned when an expression is rebuilt
+        return createCached<DivOperatorFactory<ValueType>>(exec, uMesh, inputs, construct);
     }
 
     static std::string name() { return "DivOperatorFactory"; }
@@ -70,6 +76,31 @@ public:
         const VolumeField<ValueType>& phi,
         const dsl::Coeff operatorScaling) const = 0;
 
+    /* @brief computes the divergence of several fields transported by the same flux
+     *
+     * The results are accumulated as in the single field overloads. The default computes the fields one after another,
+     * strategies may override it to process all fields in a single pass over the faces.
+     */
+    virtual void
+    div(const std::vector<Vector<ValueType>*>& divPhis,
+        const SurfaceField<scalar>& faceFlux,
+        const std::vector<const VolumeField<ValueType>*>& phis,
+        const dsl::Coeff operatorScaling) const
+    {
+        NF_ASSERT(phis.size() == divPhis.size(), "Number of fields and results differ.");
+        for (std::size_t k = 0; k < phis.size(); k++)
+        {
+            div(*divPhis[k], faceFlux, *phis[k], operatorScaling);
+        }
+    }
+
+    /* @brief the scheme of the face values if the divergence can be evaluated inline
+     *
+     * Strategies returning a scheme other than None compute 1/V \sum_f F_f phi_f, where phi_f
+     * follows from the inline interpolation, and can be fused with other terms.
+     */
+    virtual InlineInterpolation inlineInterpolation() const { return InlineInterpolation::None; }
+
     const la::SparsityPattern& getSparsityPattern() const { return sparsityPattern_; }
 
     // Pure virtual function for cloning
@@ -192,6 +223,15 @@ public:
 
     std::string getName() const { return "DivOperator"; }
 
+    const SurfaceField<scalar>& faceFlux() const { return faceFlux_; }
+
+    /* @brief the inline scheme of the strategy, None if the strategy is not initialized */
+    InlineInterpolation inlineInterpolation() const
+    {
+        return divOperatorStrategy_ ? divOperatorStrategy_->inlineInterpolation()
+                                    : InlineInterpolation::None;
+    }
+
 private:
 
     const SurfaceField<NeoN::scalar>& faceFlux_;
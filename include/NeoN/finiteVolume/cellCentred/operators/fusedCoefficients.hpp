@@ -0,0 +1,319 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/view.hpp"
+#include "NeoN/dsl/coeff.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceColoring.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the coefficients of the owner row, ie. the diagonal and the upper entry, and of the
+ * neighbour row, ie. the lower entry and the diagonal, of an internal face
+ */
+struct InternalFaceCoefficients
+{
+    scalar ownDiag;
+    scalar upper;
+    scalar lower;
+    scalar neiDiag;
+};
+
+/* @brief the contributions of an internal face with a ghost cell as neighbour to the diagonal and
+ * the rhs of its owner
+ */
+template<typename ValueType>
+struct GhostFaceCoefficients
+{
+    scalar ownDiag;
+    ValueType source;
+};
+
+/* @brief the contributions of a boundary face to the diagonal and the rhs of its owner and the
+ * sums of the matrix and rhs boundary coefficients of the terms
+ */
+template<typename ValueType>
+struct BoundaryFaceCoefficients
+{
+    ValueType diag;
+    ValueType source;
+    ValueType boundMat;
+    ValueType boundRhs;
+};
+
+/* @brief the matrix coefficients of at most maxFusedTerms implicit face terms
+ *
+ * The coefficients are identical to the ones of computeDivImp and computeLaplacianImpl and are
+ * summed over the terms. They are shared by the fused assembly, which writes them to a linear
+ * system, and by the matrix free operator, which applies them directly.
+ */
+template<typename ValueType>
+struct FusedFaceCoefficients
+{
+    /* @brief captures the views of the terms, all terms have to live on the same mesh */
+    FusedFaceCoefficients(const FusedTerm<ValueType>* terms, localIdx n) : nTerms(n)
+    {
+        const UnstructuredMesh& mesh = terms[0].phi->mesh();
+        const auto geometryScheme = GeometryScheme::readOrCreate(mesh);
+        weights = geometryScheme->weights().internalVector().view();
+        boundaryWeights = geometryScheme->weights().boundaryData().value().view();
+        deltaCoeffs = geometryScheme->nonOrthDeltaCoeffs().internalVector().view();
+        boundaryDeltaCoeffs = mesh.boundaryMesh().deltaCoeffs().view();
+        magFaceArea = mesh.magFaceAreas().view();
+        nInternalFaces = mesh.nInternalFaces();
+        for (localIdx k = 0; k < nTerms; k++)
+        {
+            const auto& bc = terms[k].phi->boundaryData();
+            kinds[k] = terms[k].kind;
+            faceCoeffs[k] = terms[k].faceCoeff->internalVector().view();
+            coeffs[k] = terms[k].coeff;
+            phiValues[k] = terms[k].phi->internalVector().view();
+            refValues[k] = bc.refValue().view();
+            refGrads[k] = bc.refGrad().view();
+            valueFractions[k] = bc.valueFraction().view();
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION InternalFaceCoefficients
+    internalFace(localIdx facei, localIdx own, localIdx nei) const
+    {
+        scalar ownDiag = 0.0;
+        scalar upper = 0.0;
+        scalar lower = 0.0;
+        scalar neiDiag = 0.0;
+        for (localIdx k = 0; k < nTerms; k++)
+        {
+            const scalar scalingOwn = coeffs[k][own];
+            const scalar scalingNei = coeffs[k][nei];
+            const scalar faceCoeff = faceCoeffs[k][facei];
+            if (kinds[k] == FusedTermKind::Laplacian)
+            {
+                const scalar flux = deltaCoeffs[facei] * faceCoeff * magFaceArea[facei];
+                ownDiag -= flux * scalingOwn;
+                upper += flux * scalingOwn;
+                lower += flux * scalingNei;
+                neiDiag -= flux * scalingNei;
+            }
+            else
+            {
+                const bool upwind = kinds[k] == FusedTermKind::UpwindDiv;
+                const scalar w = inlineOwnerWeight(upwind, faceCoeff, weights[facei]);
+                ownDiag += w * faceCoeff * scalingOwn;
+                upper += (1 - w) * faceCoeff * scalingOwn;
+                lower -= w * faceCoeff * scalingNei;
+                neiDiag -= (1 - w) * faceCoeff * scalingNei;
+            }
+        }
+        return {ownDiag, upper, lower, neiDiag};
+    }
+
+    /* @brief the owner coefficients of an internal face whose neighbour is a ghost cell
+     *
+     * The ghost cell has no row, hence the upper entry of internalFace couples the owner with the
+     * current ghost values of the terms through the rhs.
+     */
+    KOKKOS_INLINE_FUNCTION GhostFaceCoefficients<ValueType>
+    ghostFace(localIdx facei, localIdx own, localIdx nei) const
+    {
+        scalar ownDiag = 0.0;
+        ValueType source = zero<ValueType>();
+        for (localIdx k = 0; k < nTerms; k++)
+        {
+            const scalar scalingOwn = coeffs[k][own];
+            const scalar faceCoeff = faceCoeffs[k][facei];
+            scalar upper;
+            if (kinds[k] == FusedTermKind::Laplacian)
+            {
+                const scalar flux = deltaCoeffs[facei] * faceCoeff * magFaceArea[facei];
+                ownDiag -= flux * scalingOwn;
+                upper = flux * scalingOwn;
+            }
+            else
+            {
+                const bool upwind = kinds[k] == FusedTermKind::UpwindDiv;
+                const scalar w = inlineOwnerWeight(upwind, faceCoeff, weights[facei]);
+                ownDiag += w * faceCoeff * scalingOwn;
+                upper = (1 - w) * faceCoeff * scalingOwn;
+            }
+            source -= upper * phiValues[k][nei];
+        }
+        return {ownDiag, source};
+    }
+
+    KOKKOS_INLINE_FUNCTION BoundaryFaceCoefficients<ValueType>
+    boundaryFace(localIdx facei, localIdx own) const
+    {
+        const auto bfacei = facei - nInternalFaces;
+        ValueType diag = zero<ValueType>();
+        ValueType source = zero<ValueType>();
+        ValueType boundMat = zero<ValueType>();
+        ValueType boundRhs = zero<ValueType>();
+        for (localIdx k = 0; k < nTerms; k++)
+        {
+            const scalar scalingOwn = coeffs[k][own];
+            const scalar valueFraction = valueFractions[k][bfacei];
+            const scalar faceCoeff = faceCoeffs[k][facei];
+            ValueType valueMat;
+            ValueType valueRhs;
+            if (kinds[k] == FusedTermKind::Laplacian)
+            {
+                const scalar flux = faceCoeff * magFaceArea[facei] * scalingOwn;
+                valueMat = flux * valueFraction * deltaCoeffs[facei] * one<ValueType>();
+                valueRhs = flux
+                         * (valueFraction * deltaCoeffs[facei] * refValues[k][bfacei]
+                            + (1.0 - valueFraction) * refGrads[k][bfacei]);
+                diag -= valueMat;
+            }
+            else
+            {
+                const scalar w =
+                    kinds[k] == FusedTermKind::UpwindDiv ? scalar(1.0) : boundaryWeights[bfacei];
+                const scalar flux = w * faceCoeff * scalingOwn;
+                valueMat = flux * (1.0 - valueFraction) * one<ValueType>();
+                valueRhs = flux * valueFraction * refValues[k][bfacei]
+                         + (1.0 - valueFraction) * refGrads[k][bfacei]
+                               * (1 / boundaryDeltaCoeffs[bfacei]);
+                diag += valueMat;
+            }
+            source -= valueRhs;
+            boundMat += valueMat;
+            boundRhs += valueRhs;
+        }
+        return {diag, source, boundMat, boundRhs};
+    }
+
+    localIdx nTerms;
+    localIdx nInternalFaces;
+    Kokkos::Array<FusedTermKind, maxFusedTerms> kinds;
+    Kokkos::Array<View<const scalar>, maxFusedTerms> faceCoeffs;
+    Kokkos::Array<dsl::Coeff, maxFusedTerms> coeffs;
+    Kokkos::Array<View<const ValueType>, maxFusedTerms> phiValues;
+    Kokkos::Array<View<const ValueType>, maxFusedTerms> refValues;
+    Kokkos::Array<View<const ValueType>, maxFusedTerms> refGrads;
+    Kokkos::Array<View<const scalar>, maxFusedTerms> valueFractions;
+    View<const scalar> weights;
+    View<const scalar> boundaryWeights;
+    View<const scalar> deltaCoeffs;
+    View<const scalar> boundaryDeltaCoeffs;
+    View<const scalar> magFaceArea;
+};
+
+/* @brief the diagonal and rhs coefficients of at most maxFusedTerms source terms and ddt
+ * operators, the ddt operators are skipped if dt is zero
+ */
+template<typename ValueType>
+struct FusedCellCoefficients
+{
+    FusedCellCoefficients(
+        const std::vector<const SourceTerm<ValueType>*>& sources,
+        const std::vector<const DdtOperator<ValueType>*>& ddts,
+        scalar dt,
+        const UnstructuredMesh& mesh
+    )
+        : nSources(static_cast<localIdx>(sources.size())),
+          nDdts(dt != 0.0 ? static_cast<localIdx>(ddts.size()) : localIdx(0)),
+          vol(mesh.cellVolumes().view()), oldVol(mesh.oldCellVolumes().view())
+    {
+        for (localIdx k = 0; k < nSources; k++)
+        {
+            const auto* source = sources[static_cast<std::size_t>(k)];
+            sourceScalings[k] = source->getCoefficient();
+            sourceCoeffs[k] = source->coefficients().internalVector().view();
+        }
+        for (localIdx k = 0; k < nDdts; k++)
+        {
+            const auto* ddt = ddts[static_cast<std::size_t>(k)];
+            ddtScalings[k] = ddt->getCoefficient();
+            ddtSteps[k] = ddt->timeStep(dt);
+            oldValues[k] = ddt->oldField().internalVector().view();
+        }
+    }
+
+    bool empty() const { return nSources + nDdts == 0; }
+
+    /* @brief the contribution to the diagonal of a cell */
+    KOKKOS_INLINE_FUNCTION scalar diag(localIdx celli) const
+    {
+        scalar diag = 0.0;
+        for (localIdx k = 0; k < nSources; k++)
+        {
+            diag += sourceScalings[k][celli] * sourceCoeffs[k][celli] * vol[celli];
+        }
+        for (localIdx k = 0; k < nDdts; k++)
+        {
+            diag += ddtScalings[k][celli] * vol[celli] * ddtSteps[k].inverse(celli);
+        }
+        return diag;
+    }
+
+    /* @brief the contribution to the rhs of a cell */
+    KOKKOS_INLINE_FUNCTION ValueType source(localIdx celli) const
+    {
+        ValueType source = zero<ValueType>();
+        for (localIdx k = 0; k < nDdts; k++)
+        {
+            source += ddtScalings[k][celli] * oldVol[celli] * ddtSteps[k].inverse(celli)
+                    * oldValues[k][celli];
+        }
+        return source;
+    }
+
+    localIdx nSources;
+    localIdx nDdts;
+    View<const scalar> vol;
+    View<const scalar> oldVol; // the cell volumes before the last mesh motion
+    Kokkos::Array<dsl::Coeff, maxFusedTerms> sourceScalings;
+    Kokkos::Array<View<const scalar>, maxFusedTerms> sourceCoeffs;
+    Kokkos::Array<dsl::Coeff, maxFusedTerms> ddtScalings;
+    Kokkos::Array<DdtTimeStep, maxFusedTerms> ddtSteps;
+    Kokkos::Array<View<const ValueType>, maxFusedTerms> oldValues;
+};
+
+/* @brief runs a kernel over the internal and a kernel over the boundary faces
+ *
+ * If raceFree is set the faces are visited by color, hence the kernels can update the values of
+ * the adjacent cells without atomics.
+ */
+template<typename InternalKernel, typename BoundaryKernel>
+void fusedFaceLoops(
+    const UnstructuredMesh& mesh,
+    bool raceFree,
+    InternalKernel internalKernel,
+    BoundaryKernel boundaryKernel,
+    const std::string& name
+)
+{
+    const auto exec = mesh.exec();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    if (raceFree)
+    {
+        const auto& coloring = FaceColoring::readOrCreate(mesh);
+        coloredParallelFor(exec, coloring.internalFaces(), internalKernel, name + "Internal");
+        coloredParallelFor(exec, coloring.boundaryFaces(), boundaryKernel, name + "Boundary");
+    }
+    else
+    {
+        parallelFor(exec, {0, nInternalFaces}, internalKernel, name + "Internal");
+        parallelFor(
+            exec,
+            {nInternalFaces, nInternalFaces + mesh.nBoundaryFaces()},
+            boundaryKernel,
+            name + "Boundary"
+        );
+    }
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
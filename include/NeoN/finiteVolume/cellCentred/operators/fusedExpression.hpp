@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/dsl/expression.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/ddtOperator.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/sourceTerm.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief maximum number of terms evaluated in one face sweep or one cell pass
+ *
+ * Larger sets of face terms are split, the views of the terms are captured by value in the
+ * kernels. Cell terms beyond the maximum are evaluated separately.
+ */
+inline constexpr localIdx maxFusedTerms = 8;
+
+/* @brief the face contribution of a fused term */
+enum class FusedTermKind
+{
+    LinearDiv, // F_f phi_f with linear interpolation, faceCoeff is the flux F
+    UpwindDiv, // F_f phi_f with upwind interpolation, faceCoeff is the flux F
+    Laplacian  // gamma_f |S_f| deltaCoeffs_f (phi_N - phi_O), faceCoeff is gamma
+};
+
+/* @brief a term of the form c / V \sum_f s_f faceValue(f) */
+template<typename ValueType>
+struct FusedTerm
+{
+    FusedTermKind kind;
+    const SurfaceField<scalar>* faceCoeff;
+    const VolumeField<ValueType>* phi;
+    dsl::Coeff coeff;
+};
+
+/* @brief the operators of an expression with compatible finite volume terms merged
+ *
+ * Divergence terms with an inline interpolation and laplacian terms with an inline face normal
+ * gradient are collected on construction.
+ *
+ * The explicit terms with a uniform coefficient share a single kernel over the faces followed by
+ * a single scaling by the inverse cell volumes, instead of a face sweep, a temporary and a
+ * normalization per term.
+ *
+ * The implicit terms are assembled in a single pass over the internal and one over the boundary
+ * faces, which writes the owner, neighbour and diagonal coefficients of all terms at once using
+ * the offsets of the sparsity pattern. The implicit source terms and the ddt operators only
+ * contribute to the diagonal and the rhs and are assembled in a single pass over the cells. In
+ * contrast to the single operators, the boundary coefficients of the linear system hold the sum
+ * of the contributions of all fused terms.
+ *
+ * All other operators are evaluated one after another as by the corresponding functions of the
+ * expression. The operators are referenced, hence the expression has to outlive the fused
+ * expression and must not be modified.
+ */
+template<typename ValueType>
+class FusedExpression
+{
+public:
+
+    explicit FusedExpression(dsl::Expression<ValueType>& expr);
+
+    /* @brief accumulates all explicit spatial operators into the source, see
+     * Expression::explicitOperation
+     */
+    void explicitOperation(Vector<ValueType>& source) const;
+
+    /* @brief advances x by an explicit euler step of the explicit spatial operators
+     *
+     * Computes x = xOld - dt * source, where source is the result of explicitOperation and the
+     * time step of cell c is localDt[c] if localDt is given. If all explicit operators are
+     * fused terms of a single face sweep, the update is applied by the sweep, hence neither a
+     * source temporary nor a separate pass over the cells is required. If x is the vector of a
+     * fused term, the result is computed into a workspace which is swapped with x, thus views
+     * of x taken before refer to the workspace afterwards.
+     */
+    void explicitEulerUpdate(
+        Vector<ValueType>& x,
+        const Vector<ValueType>& xOld,
+        scalar dt,
+        const Vector<scalar>* localDt = nullptr
+    ) const;
+
+    /* @brief assembles all implicit spatial operators, see Expression::implicitOperation */
+    void implicitOperation(la::LinearSystem<ValueType, localIdx>& ls);
+
+    /* @brief assembles all implicit temporal operators, see Expression::implicitOperation */
+    void implicitOperation(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt);
+
+    /* @brief assembles all implicit spatial and temporal operators
+     *
+     * Equivalent to the spatial followed by the temporal assembly, but the ddt operators share
+     * the pass over the cells with the source terms.
+     */
+    void assemble(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt);
+
+    /* @brief the explicit terms evaluated in the fused face sweep */
+    const std::vector<FusedTerm<ValueType>>& fusedTerms() const { return fusedTerms_; }
+
+    /* @brief the implicit terms assembled in the fused face sweep */
+    const std::vector<FusedTerm<ValueType>>& fusedImplicitTerms() const
+    {
+        return fusedImplicitTerms_;
+    }
+
+    /* @brief the implicit source terms assembled in the fused pass over the cells */
+    const std::vector<const SourceTerm<ValueType>*>& fusedSources() const
+    {
+        return fusedSources_;
+    }
+
+    /* @brief the implicit ddt operators assembled in the fused pass over the cells */
+    const std::vector<const DdtOperator<ValueType>*>& fusedDdts() const { return fusedDdts_; }
+
+    /* @brief whether all implicit spatial and temporal operators are fused */
+    bool implicitFullyFused() const
+    {
+        return remainingImplicitOperators_.empty() && remainingTemporalOperators_.empty();
+    }
+
+    /* @brief whether the implicit operators only contribute to the diagonal and the rhs, ie. all
+     * of them are fused source terms or ddt operators
+     */
+    bool implicitDiagonal() const
+    {
+        return implicitFullyFused() && fusedImplicitTerms_.empty()
+            && !(fusedSources_.empty() && fusedDdts_.empty());
+    }
+
+    /* @brief solves the system of the implicit spatial and temporal operators pointwise
+     *
+     * The system has to be diagonal, see implicitDiagonal, hence x = rhs / diag is computed in a
+     * single pass over the cells without a sparsity pattern, a matrix or a linear solver. The
+     * result equals the solution of the system assembled by assemble.
+     */
+    void solveDiagonal(Vector<ValueType>& x, scalar dt) const;
+
+private:
+
+    void assembleFused(la::LinearSystem<ValueType, localIdx>& ls, bool spatial, scalar dt);
+
+    std::vector<FusedTerm<ValueType>> fusedTerms_;
+
+    std::vector<const dsl::SpatialOperator<ValueType>*> remainingOperators_;
+
+    std::vector<FusedTerm<ValueType>> fusedImplicitTerms_;
+
+    std::vector<const SourceTerm<ValueType>*> fusedSources_;
+
+    std::vector<dsl::SpatialOperator<ValueType>*> remainingImplicitOperators_;
+
+    std::vector<const DdtOperator<ValueType>*> fusedDdts_;
+
+    std::vector<dsl::TemporalOperator<ValueType>*> remainingTemporalOperators_;
+
+    /* @brief the face sums of the fused terms, reused between calls */
+    mutable std::optional<Vector<ValueType>> workspace_;
+
+    /* @brief the updated cells of explicitEulerUpdate, swapped with the updated vector */
+    mutable std::optional<Vector<ValueType>> updateWorkspace_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -8,6 +8,7 @@
 #include "NeoN/core/executor/executor.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeFieldBlock.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/divOperator.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
 
@@ -23,6 +24,36 @@ void computeDivExp(
     const dsl::Coeff operatorScaling
 );
 
+/* @brief computes the explicit divergence of several fields transported by the same flux
+ *
+ * For schemes that can be evaluated inline all fields are processed in one pass over the face
+ * connectivity, otherwise the divergence is computed field by field.
+ */
+template<typename ValueType>
+void computeBatchedDivExp(
+    const SurfaceField<scalar>& faceFlux,
+    const std::vector<const VolumeField<ValueType>*>& phis,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    const std::vector<Vector<ValueType>*>& divPhis,
+    const dsl::Coeff operatorScaling
+);
+
+/* @brief computes the explicit divergence of all components of a block transported by the
+ * same flux
+ *
+ * The result divPhi holds the components in the layout of the block, see BlockView. For schemes
+ * that can be evaluated inline the components are processed in batches of maxBatchSize per pass
+ * over the faces, reading the cell values of the components with unit stride.
+ */
+template<typename ValueType>
+void computeBlockDivExp(
+    const SurfaceField<scalar>& faceFlux,
+    const VolumeFieldBlock<ValueType>& phi,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    Vector<ValueType>& divPhi,
+    const dsl::Coeff operatorScaling
+);
+
 template<typename ValueType>
 void computeDivImp(
     la::LinearSystem<ValueType, localIdx>& ls,
@@ -81,6 +112,17 @@ public:
         computeDivExp<ValueType>(faceFlux, phi, surfaceInterpolation_, divPhi, operatorScaling);
     };
 
+    virtual void
+    div(const std::vector<Vector<ValueType>*>& divPhis,
+        const SurfaceField<scalar>& faceFlux,
+        const std::vector<const VolumeField<ValueType>*>& phis,
+        const dsl::Coeff operatorScaling) const override
+    {
+        computeBatchedDivExp<ValueType>(
+            faceFlux, phis, surfaceInterpolation_, divPhis, operatorScaling
+        );
+    };
+
     virtual VolumeField<ValueType>
     div(const SurfaceField<scalar>& faceFlux,
         const VolumeField<ValueType>& phi,
@@ -101,6 +143,11 @@ public:
         return divPhi;
     };
 
+    InlineInterpolation inlineInterpolation() const override
+    {
+        return surfaceInterpolation_.inlineInterpolation();
+    }
+
     std::unique_ptr<DivOperatorFactory<ValueType>> clone() const override
     {
         return std::make_unique<GaussGreenDiv<ValueType>>(*this);
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/primitives/tensor.hpp"
+#include "NeoN/core/vector/vec3SoAVector.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
@@ -12,11 +17,28 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+/* @class GaussGreenGrad
+ * @brief the explicit Gauss Green gradient with linear interpolation
+ *
+ * With the SoA layout the face areas are read from a structure of arrays copy, which is created
+ * on the first evaluation and updated after mesh motion.
+ *
+ * The gradient returned by grad(phi) is cached, it is only recomputed if the versions of the
+ * values of phi or the mesh geometry changed since the last evaluation.
+ *
+ * The gradient of a vector field U is the cell tensor \sum_f S_f U_f / V, ie. the component
+ * (i, j) is the derivative of U_j in direction i. U is interpolated once and the nine components
+ * are accumulated in a single face reduction instead of one per component.
+ */
 class GaussGreenGrad
 {
 public:
 
-    GaussGreenGrad(const Executor& exec, const UnstructuredMesh& mesh);
+    GaussGreenGrad(
+        const Executor& exec,
+        const UnstructuredMesh& mesh,
+        VectorLayout layout = VectorLayout::AoS
+    );
 
     // fvcc::VolumeField<Vec3> grad(const fvcc::VolumeField<scalar>& phi);
 
@@ -24,10 +46,38 @@ public:
 
     VolumeField<Vec3> grad(const VolumeField<scalar>& phi);
 
+    /* @brief the gradient of a vector field
+     *
+     * @param u, the vector field
+     * @param gradU, the cell gradients, resized to the cells and overwritten
+     */
+    void grad(const VolumeField<Vec3>& u, Vector<Tensor>& gradU);
+
+    /* @brief the gradient of a vector field, cached as the gradient of a scalar field */
+    Vector<Tensor> grad(const VolumeField<Vec3>& u);
+
 private:
 
+    /* @brief updates the structure of arrays copy of the face areas */
+    void updateFaceAreasSoA();
+
     const UnstructuredMesh& mesh_;
     SurfaceInterpolation<scalar> surfaceInterpolation_;
+    SurfaceInterpolation<Vec3> vectorInterpolation_;
+    VectorLayout layout_;
+    std::optional<Vec3SoAVector> faceAreasSoA_;
+    std::size_t geometryVersion_;
+    std::optional<VolumeField<Vec3>> cachedGrad_;
+    std::array<std::size_t, 3> cachedVersions_;
+    std::optional<Vector<Tensor>> cachedTensorGrad_;
+    std::array<std::size_t, 3> cachedTensorVersions_;
 };
 
+/* @brief the Gauss Green gradient of a registered field shared through the database
+ *
+ * The gradient is computed once per time and iteration index of phi and reused by all callers,
+ * see GradientCollection.
+ */
+const VolumeField<Vec3>& cachedGrad(const VolumeField<scalar>& phi);
+
 } // namespace NeoN
@@ -108,6 +108,11 @@ public:
         );
     };
 
+    bool inlineFaceNormalGrad() const override
+    {
+        return faceNormalGradient_.inlineFaceNormalGrad();
+    }
+
     std::unique_ptr<LaplacianOperatorFactory<ValueType>> clone() const override
     {
         return std::make_unique<GaussGreenLaplacian<ValueType>>(*this);
@@ -13,6 +13,7 @@
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/schemeCache.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -32,11 +33,16 @@ public:
     static std::unique_ptr<LaplacianOperatorFactory<ValueType>>
     create(const Executor& exec, const UnstructuredMesh& mesh, const Input& inputs)
     {
-        std::string key = (std::holds_alternative<Dictionary>(inputs))
-                            ? std::get<Dictionary>(inputs).get<std::string>("LaplacianOperator")
-                            : std::get<TokenList>(inputs).next<std::string>();
-        LaplacianOperatorFactory<ValueType>::keyExistsOrError(key);
-        return LaplacianOperatorFactory<ValueType>::table().at(key)(exec, mesh, inputs);
+        auto construct = [&]()
+        {
+            std::string key = (std::holds_alternative<Dictionary>(inputs))
+                                ? std::get<Dictionary>(inputs).get<std::string>("LaplacianOperator")
+                                : std::get<TokenList>(inputs).next<std::string>();
+            LaplacianOperatorFactory<ValueType>::keyExistsOrError(key);
+            return LaplacianOperatorFactory<ValueType>::table().at(key)(exec, mesh, inputs);
+        };
+        // the constructed schemes are kept in the mesh and cloned when an expression is rebuilt
+        return createCached<LaplacianOperatorFactory<ValueType>>(exec, mesh, inputs, construct);
     }
 
     static std::string name() { return "LaplacianOperatorFactory"; }
@@ -73,6 +79,14 @@ public:
         const dsl::Coeff operatorScaling
     ) = 0;
 
+    /* @brief whether the laplacian can be evaluated inline
+     *
+     * Strategies returning true compute 1/V \sum_f gamma_f |S_f| snGrad_f with an inline face
+     * normal gradient, see FaceNormalGradientFactory::inlineFaceNormalGrad, and can be fused
+     * with other terms.
+     */
+    virtual bool inlineFaceNormalGrad() const { return false; }
+
     // Pure virtual function for cloning
     virtual std::unique_ptr<LaplacianOperatorFactory<ValueType>> clone() const = 0;
 
@@ -200,6 +214,14 @@ public:
 
     std::string getName() const { return "LaplacianOperator"; }
 
+    const SurfaceField<scalar>& gamma() const { return gamma_; }
+
+    /* @brief whether the strategy can be evaluated inline, false if it is not initialized */
+    bool inlineFaceNormalGrad() const
+    {
+        return laplacianOperatorStrategy_ && laplacianOperatorStrategy_->inlineFaceNormalGrad();
+    }
+
 private:
 
     const SurfaceField<scalar>& gamma_;
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the number of stored entries of a symmetric 3x3 matrix, ie. xx, xy, xz, yy, yz, zz */
+constexpr localIdx nPackedSymmEntries = 6;
+
+/* @class LeastSquaresMatrices
+ * @brief the inverse least squares matrices of all cells of a mesh
+ *
+ * The matrix of cell c is M_c = \sum_f w_f d_f d_f^T with the distance d_f from the centre of c
+ * to the centre of the neighbour cell, or to the face centre for boundary faces, and the weight
+ * w_f = 1 / |d_f|^2. The inverse matrices are symmetric, hence only the six entries xx, xy, xz,
+ * yy, yz, zz of each cell are stored, the entries of cell c start at nPackedSymmEntries * c.
+ */
+struct LeastSquaresMatrices
+{
+    Vector<scalar> invMatrices;
+    std::size_t geometryVersion;
+
+    std::size_t memoryBytes() const { return invMatrices.memoryBytes(); }
+
+    /* @brief returns the matrices of the mesh
+     *
+     * The matrices are computed on first access and stored in the stencil database of the mesh,
+     * they are recomputed if the mesh geometry changed.
+     */
+    static const LeastSquaresMatrices& readOrCreate(const UnstructuredMesh& mesh);
+};
+
+/* @brief computes the inverse least squares matrices with a gather over the cell faces */
+LeastSquaresMatrices computeLeastSquaresMatrices(const UnstructuredMesh& mesh);
+
+/* @class LeastSquaresGrad
+ * @brief the explicit weighted least squares gradient
+ *
+ * The gradient of cell c is M_c^{-1} \sum_f w_f d_f (\phi_f - \phi_c), where \phi_f is the value
+ * of the neighbour cell or the boundary value, see LeastSquaresMatrices. In contrast to the
+ * Gauss Green gradient it is exact for linear fields on arbitrary meshes and thus retains its
+ * accuracy on skewed meshes. Since the inverse matrices are precomputed per mesh, an evaluation
+ * is a single gather over the faces of each cell, see CellToFaceStencil.
+ */
+class LeastSquaresGrad
+{
+public:
+
+    LeastSquaresGrad(const Executor& exec, const UnstructuredMesh& mesh);
+
+    /* @brief computes the gradient into the internal values of gradPhi, which are overwritten */
+    void grad(const VolumeField<scalar>& phi, VolumeField<Vec3>& gradPhi);
+
+    VolumeField<Vec3> grad(const VolumeField<scalar>& phi);
+
+private:
+
+    const UnstructuredMesh& mesh_;
+};
+
+} // namespace NeoN
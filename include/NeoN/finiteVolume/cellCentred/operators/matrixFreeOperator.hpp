@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/dsl/expression.hpp"
+#include "NeoN/linearAlgebra/linearOperator.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief applies the implicit operators of an expression without assembling a matrix
+ *
+ * Computes y = A x with the matrix A of FusedExpression::assemble, but the coefficients are
+ * recomputed from the face connectivity on every application instead of being stored. Hence
+ * neither the matrix values nor the column indices are read, which saves the memory of the
+ * matrix and a large part of the memory traffic of a sparse matrix vector product.
+ *
+ * All implicit operators of the expression have to be fusable, ie. Gauss divergence terms with
+ * an inline interpolation, laplacian terms with an inline face normal gradient, source terms and
+ * ddt operators. The operators are referenced, hence the expression has to outlive the operator.
+ */
+template<typename ValueType>
+class MatrixFreeOperator : public la::LinearOperator<ValueType>
+{
+public:
+
+    /* @brief a time step of zero skips the temporal operators */
+    MatrixFreeOperator(dsl::Expression<ValueType>& expr, scalar dt);
+
+    Executor exec() const override { return mesh_->exec(); }
+
+    localIdx nRows() const override { return mesh_->nCells(); }
+
+    using la::LinearOperator<ValueType>::apply;
+
+    void apply(View<const ValueType> x, View<ValueType> y) const override;
+
+    /* @brief computes the rhs b of A x = b, ie. the boundary and old time contributions */
+    void rhs(Vector<ValueType>& b) const;
+
+private:
+
+    FusedExpression<ValueType> fused_;
+
+    const UnstructuredMesh* mesh_;
+
+    scalar dt_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -42,6 +42,8 @@ public:
 
     const la::SparsityPattern& getSparsityPattern() const { return sparsityPattern_; }
 
+    const VolumeField<scalar>& coefficients() const { return coefficients_; }
+
 private:
 
     const VolumeField<scalar>& coefficients_;
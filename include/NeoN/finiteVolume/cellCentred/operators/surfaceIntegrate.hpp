@@ -14,6 +14,10 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+/* @brief sums the face fluxes into the cells and scales the result by the inverse volume
+ *
+ * @param invVol the inverse cell volumes, see UnstructuredMesh::invCellVolumes
+ */
 template<typename ValueType>
 void surfaceIntegrate(
     const Executor& exec,
@@ -22,7 +26,7 @@ void surfaceIntegrate(
     View<const int> owner,
     View<const int> faceCells,
     View<const ValueType> flux,
-    View<const scalar> v,
+    View<const scalar> invVol,
     View<ValueType> res,
     const dsl::Coeff operatorScaling
 );
@@ -61,7 +65,7 @@ public:
             mesh.faceOwner().view(),
             mesh.boundaryMesh().faceCells().view(),
             this->flux_.internalVector().view(),
-            mesh.cellVolumes().view(),
+            mesh.invCellVolumes().view(),
             tmpsource.view(),
             operatorScaling
         );
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/core/segmentedVector.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief sorts values[begin, end) in place and removes duplicates
+ *
+ * Uses an insertion sort, which is efficient for the small segments of a stencil.
+ *
+ * @return the end of the unique values, ie. values[begin, result) are sorted and unique
+ */
+KOKKOS_INLINE_FUNCTION
+localIdx sortUniqueSegment(View<localIdx> values, const localIdx begin, const localIdx end)
+{
+    for (auto i = begin + 1; i < end; i++)
+    {
+        const auto value = values[i];
+        auto j = i;
+        for (; j > begin && values[j - 1] > value; j--)
+        {
+            values[j] = values[j - 1];
+        }
+        values[j] = value;
+    }
+    if (begin == end)
+    {
+        return end;
+    }
+    auto last = begin;
+    for (auto i = begin + 1; i < end; i++)
+    {
+        if (values[i] != values[last])
+        {
+            values[++last] = values[i];
+        }
+    }
+    return last + 1;
+}
+
+/* @class CellToCellStencil
+ * @brief builds the cell to cell stencils of a mesh on the device
+ *
+ * The stencils are built in parallel without atomics: the upper bound of the stencil size of
+ * every cell is counted, the segments are computed by a scan, the candidates are filled per
+ * cell and finally every segment is sorted and compressed. The neighbours of each cell are
+ * stored in ascending order and exclude the cell itself.
+ */
+class CellToCellStencil
+{
+public:
+
+    CellToCellStencil(const UnstructuredMesh& mesh);
+
+    /* @brief the cells sharing a face with each cell */
+    SegmentedVector<localIdx, localIdx> computeStencil() const;
+
+    /* @brief the face neighbours and their face neighbours, ie. the first two rings of cells */
+    SegmentedVector<localIdx, localIdx> computeExtendedStencil() const;
+
+    /* @brief returns the face neighbour stencil of the mesh, computed on first access and stored
+     * in the stencil database of the mesh
+     */
+    static const SegmentedVector<localIdx, localIdx>& readOrCreate(const UnstructuredMesh& mesh);
+
+    /* @brief returns the extended stencil of the mesh, computed on first access and stored in
+     * the stencil database of the mesh
+     */
+    static const SegmentedVector<localIdx, localIdx>&
+    readOrCreateExtended(const UnstructuredMesh& mesh);
+
+private:
+
+    const UnstructuredMesh& mesh_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
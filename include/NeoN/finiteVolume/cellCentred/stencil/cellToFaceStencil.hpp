@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoN/core/segmentedVector.hpp"
 
@@ -19,9 +21,244 @@ public:
 
     SegmentedVector<localIdx, localIdx> computeStencil() const;
 
+    /* @brief returns the cell to face stencil of the mesh
+     *
+     * The stencil is computed on first access and stored in the stencil database of the mesh.
+     * Each segment holds the internal and boundary faces of a cell, boundary faces are stored
+     * with an offset of nInternalFaces.
+     */
+    static const SegmentedVector<localIdx, localIdx>& readOrCreate(const UnstructuredMesh& mesh);
+
+    /* @brief returns the number of faces of every cell if it is the same for all cells, eg. six
+     * for a pure hex mesh and four for a pure tet mesh, and zero otherwise
+     *
+     * The result is computed on first access and stored in the stencil database of the mesh.
+     */
+    static localIdx uniformSegmentSize(const UnstructuredMesh& mesh);
+
 private:
 
     const UnstructuredMesh& mesh_;
 };
 
+namespace detail
+{
+
+/* @brief gatherAndUpdateFaceValues for a mesh with NFaces faces per cell
+ *
+ * The segment of a cell starts at celli * NFaces, hence the segment offsets are not read and
+ * the loops over the faces have a compile time trip count, which the compiler unrolls and keeps
+ * the face indices and the sum in registers.
+ */
+template<localIdx NFaces, typename ValueType, typename FaceValue, typename CellUpdate>
+void gatherUniformFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellUpdate cellUpdate
+)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    const auto [cellFaces, neighbour] = views(stencil.values(), mesh.faceNeighbour());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            localIdx faces[NFaces];
+            for (localIdx i = 0; i < NFaces; i++)
+            {
+                faces[i] = cellFaces[celli * NFaces + i];
+            }
+            ValueType sum = zero<ValueType>();
+            for (localIdx i = 0; i < NFaces; i++)
+            {
+                const auto facei = faces[i];
+                const bool isNeighbour = facei < nInternalFaces && neighbour[facei] == celli;
+                sum += (isNeighbour ? neiSign : 1.0) * faceValue(facei);
+            }
+            res[celli] = cellUpdate(celli, res[celli], sum);
+        },
+        "gatherUniformFaceValues"
+    );
+}
+
+/* @brief gatherAndUpdateFaceValues for the active cells of the mesh, see ActiveRegion
+ *
+ * The inactive cells keep their result and the faces between inactive cells are not evaluated.
+ */
+template<typename ValueType, typename FaceValue, typename CellUpdate>
+void gatherActiveFaceValues(
+    const UnstructuredMesh& mesh,
+    const ActiveRegion& region,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellUpdate cellUpdate
+)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    const auto [cellFaces, segments, neighbour, activeCells] = views(
+        stencil.values(), stencil.segments(), mesh.faceNeighbour(), region.activeCells()
+    );
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    parallelFor(
+        mesh.exec(),
+        {0, activeCells.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            const auto celli = activeCells[i];
+            ValueType sum = zero<ValueType>();
+            for (auto j = segments[celli]; j < segments[celli + 1]; j++)
+            {
+                const auto facei = cellFaces[j];
+                const bool isNeighbour = facei < nInternalFaces && neighbour[facei] == celli;
+                sum += (isNeighbour ? neiSign : 1.0) * faceValue(facei);
+            }
+            res[celli] = cellUpdate(celli, res[celli], sum);
+        },
+        "gatherActiveFaceValues"
+    );
+}
+
+}
+
+/* @brief sums face values into the adjacent cells without atomics and updates the cell result
+ *
+ * Computes res[celli] = cellUpdate(celli, res[celli], \sum_f s_f faceValue(f)) for all faces
+ * of a cell, where s_f is 1 for owner and boundary faces. For neighbour faces s_f is -1 if
+ * antisymmetric is set and 1 otherwise. Meshes of only hexahedra or only tetrahedra use a
+ * kernel specialised on the number of faces per cell, see uniformSegmentSize. On a mesh with an
+ * active region only the active cells are updated.
+ *
+ * @param mesh The mesh providing the cell to face stencil
+ * @param res View holding the cell result
+ * @param faceValue Device callable returning the contribution of face f in owner direction
+ * @param antisymmetric Whether the contribution changes sign for the neighbour cell
+ * @param cellUpdate Device callable returning the result of cell c from its previous result and
+ * the sum of its faces, eg. an explicit time step
+ */
+template<typename ValueType, typename FaceValue, typename CellUpdate>
+void gatherAndUpdateFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellUpdate cellUpdate
+)
+{
+    if (const auto* region = mesh.activeRegion())
+    {
+        detail::gatherActiveFaceValues(mesh, *region, res, faceValue, antisymmetric, cellUpdate);
+        return;
+    }
+    switch (CellToFaceStencil::uniformSegmentSize(mesh))
+    {
+    case 6:
+        detail::gatherUniformFaceValues<6>(mesh, res, faceValue, antisymmetric, cellUpdate);
+        return;
+    case 4:
+        detail::gatherUniformFaceValues<4>(mesh, res, faceValue, antisymmetric, cellUpdate);
+        return;
+    default:
+        break;
+    }
+
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    const auto [cellFaces, segments, neighbour] =
+        views(stencil.values(), stencil.segments(), mesh.faceNeighbour());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            ValueType sum = zero<ValueType>();
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                const auto facei = cellFaces[i];
+                if (facei < nInternalFaces && neighbour[facei] == celli)
+                {
+                    sum += neiSign * faceValue(facei);
+                }
+                else
+                {
+                    sum += faceValue(facei);
+                }
+            }
+            res[celli] = cellUpdate(celli, res[celli], sum);
+        },
+        "gatherFaceValues"
+    );
+}
+
+/* @brief the cell update scaling the sum of the previous result and the face sum */
+template<typename CellScale>
+struct ScaledCellUpdate
+{
+    CellScale cellScale;
+
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION ValueType
+    operator()(const localIdx celli, const ValueType& res, const ValueType& sum) const
+    {
+        return cellScale(celli) * (res + sum);
+    }
+};
+
+/* @brief sums face values into the adjacent cells without atomics and scales the cell result
+ *
+ * Computes res[celli] = cellScale(celli) * (res[celli] + \sum_f s_f faceValue(f)), see
+ * gatherAndUpdateFaceValues.
+ *
+ * @param mesh The mesh providing the cell to face stencil
+ * @param res View holding the cell result
+ * @param faceValue Device callable returning the contribution of face f in owner direction
+ * @param antisymmetric Whether the contribution changes sign for the neighbour cell
+ * @param cellScale Device callable returning the scaling of cell c, eg. the inverse volume
+ */
+template<typename ValueType, typename FaceValue, typename CellScale>
+void gatherFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellScale cellScale
+)
+{
+    gatherAndUpdateFaceValues(
+        mesh, res, faceValue, antisymmetric, ScaledCellUpdate<CellScale> {cellScale}
+    );
+}
+
+/* @brief the cell scaling of gatherFaceValues without scaling */
+struct UnitCellScale
+{
+    KOKKOS_INLINE_FUNCTION scalar operator()(const localIdx) const { return 1.0; }
+};
+
+/* @brief sums face values into the adjacent cells without atomics
+ *
+ * Computes res[celli] += \sum_f s_f faceValue(f) for all faces of a cell, where s_f is 1 for
+ * owner and boundary faces. For neighbour faces s_f is -1 if antisymmetric is set and 1
+ * otherwise.
+ *
+ * @param mesh The mesh providing the cell to face stencil
+ * @param res View holding the cell result
+ * @param faceValue Device callable returning the contribution of face f in owner direction
+ * @param antisymmetric Whether the contribution changes sign for the neighbour cell
+ */
+template<typename ValueType, typename FaceValue>
+void gatherFaceValues(
+    const UnstructuredMesh& mesh, View<ValueType> res, FaceValue faceValue, bool antisymmetric
+)
+{
+    gatherFaceValues(mesh, res, faceValue, antisymmetric, UnitCellScale {});
+}
+
 } // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the width of the stored neighbour offsets of CompressedConnectivity */
+enum class DeltaWidth
+{
+    Bits16,
+    Bits32
+};
+
+/* @brief decodes the owner and neighbour of an internal face in a kernel
+ *
+ * @tparam Width, the width of the stored neighbour offsets, with DeltaWidth::Bits16 two offsets
+ * are packed into a word, the offset of face f is the low half of word f / 2 for an even f
+ */
+template<DeltaWidth Width>
+struct CompressedConnectivityView
+{
+    View<const localIdx> ownerOffsets; //! cell c owns [ownerOffsets[c], ownerOffsets[c + 1])
+    View<const std::uint32_t> deltas;  //! neighbour - owner of every internal face
+
+    /* @brief the owner of a face by a binary search in the offsets */
+    KOKKOS_INLINE_FUNCTION localIdx owner(const localIdx facei) const
+    {
+        // the last cell whose first face is not after facei, cells without faces are skipped
+        localIdx lower = 0;
+        localIdx upper = static_cast<localIdx>(ownerOffsets.size()) - 1;
+        while (upper - lower > 1)
+        {
+            const localIdx mid = lower + (upper - lower) / 2;
+            if (ownerOffsets[mid] <= facei)
+            {
+                lower = mid;
+            }
+            else
+            {
+                upper = mid;
+            }
+        }
+        return lower;
+    }
+
+    KOKKOS_INLINE_FUNCTION std::int32_t delta(const localIdx facei) const
+    {
+        if constexpr (Width == DeltaWidth::Bits16)
+        {
+            const auto shift = 16 * static_cast<std::uint32_t>(facei % 2);
+            const auto bits = static_cast<std::uint16_t>(deltas[facei / 2] >> shift);
+            return static_cast<std::int16_t>(bits);
+        }
+        else
+        {
+            return static_cast<std::int32_t>(deltas[facei]);
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION localIdx neighbour(const localIdx facei, const localIdx own) const
+    {
+        return static_cast<localIdx>(static_cast<std::int64_t>(own) + delta(facei));
+    }
+};
+
+/* @class CompressedConnectivity
+ * @brief a compressed copy of the owner and neighbour of the internal faces
+ *
+ * If the internal faces are sorted by owner, as after renumberMesh, the owners are stored as
+ * the offsets of the faces of every cell, ie. nCells + 1 instead of nInternalFaces entries, and
+ * the neighbours as the difference to the owner in 16 bits if all differences fit and 32 bits
+ * otherwise. Both widths are stored in 32 bit words, two 16 bit differences share a word. With
+ * about three internal faces per cell and 64 bit labels the connectivity thus needs a third or
+ * less of the memory and the bandwidth of the face owner and neighbour. The owner and the
+ * neighbour are decoded in the kernels, see compressedParallelFor and
+ * CompressedConnectivityView.
+ *
+ * The boundary faces are not compressed, their cells are the face cells of the boundary mesh.
+ */
+class CompressedConnectivity
+{
+public:
+
+    /* @brief compresses the internal faces of the mesh
+     *
+     * The internal faces need to be sorted by owner, see compressible.
+     */
+    CompressedConnectivity(const UnstructuredMesh& mesh);
+
+    /* @brief whether the internal faces of the mesh are sorted by owner and the differences of
+     * neighbour and owner fit in 32 bits
+     */
+    static bool compressible(const UnstructuredMesh& mesh);
+
+    localIdx nCells() const { return ownerOffsets_.size() - 1; }
+
+    localIdx nInternalFaces() const { return nInternalFaces_; }
+
+    DeltaWidth width() const { return width_; }
+
+    /* @brief the first internal face owned by every cell, of size nCells + 1 */
+    const Vector<localIdx>& ownerOffsets() const { return ownerOffsets_; }
+
+    /* @brief the kernel view of the connectivity
+     *
+     * @tparam Width, the width of the connectivity, see width
+     */
+    template<DeltaWidth Width>
+    CompressedConnectivityView<Width> view() const
+    {
+        NF_ASSERT(Width == width_, "The neighbour offsets are stored with another width.");
+        return {ownerOffsets_.view(), deltas_.view()};
+    }
+
+    /* @brief decompresses the owner and the neighbour of every internal face
+     *
+     * @param owners, resized to the internal faces, the owner of every face
+     * @param neighbours, resized to the internal faces, the neighbour of every face
+     */
+    void decompress(Vector<localIdx>& owners, Vector<localIdx>& neighbours) const;
+
+    std::size_t memoryBytes() const
+    {
+        return ownerOffsets_.memoryBytes() + deltas_.memoryBytes();
+    }
+
+    /* @brief returns the compressed connectivity of the mesh, computed on first access and
+     * stored in the stencil database of the mesh
+     */
+    static const CompressedConnectivity& readOrCreate(const UnstructuredMesh& mesh);
+
+private:
+
+    localIdx nInternalFaces_;
+
+    DeltaWidth width_;
+
+    Vector<localIdx> ownerOffsets_;
+
+    Vector<std::uint32_t> deltas_; //! the packed neighbour offsets, see CompressedConnectivityView
+};
+
+namespace detail
+{
+
+template<DeltaWidth Width, typename Kernel>
+void compressedParallelFor(
+    const Executor& exec,
+    const CompressedConnectivityView<Width> conn,
+    const localIdx nCells,
+    Kernel kernel,
+    const std::string& name
+)
+{
+    parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            for (localIdx facei = conn.ownerOffsets[celli]; facei < conn.ownerOffsets[celli + 1];
+                 facei++)
+            {
+                kernel(facei, celli, conn.neighbour(facei, celli));
+            }
+        },
+        name
+    );
+}
+
+}
+
+/* @brief runs kernel(facei, owner, neighbour) for all internal faces
+ *
+ * The faces are processed by their owner, the owner thus needs no decoding and the faces of a
+ * cell are read contiguously. As in a face loop, the faces of different cells run concurrently
+ * and a cell is the neighbour of faces of other cells, hence updates of the cells need atomics.
+ */
+template<typename Kernel>
+void compressedParallelFor(
+    const Executor& exec,
+    const CompressedConnectivity& conn,
+    Kernel kernel,
+    const std::string& name = "compressedParallelFor"
+)
+{
+    if (conn.width() == DeltaWidth::Bits16)
+    {
+        detail::compressedParallelFor(
+            exec, conn.view<DeltaWidth::Bits16>(), conn.nCells(), kernel, name
+        );
+    }
+    else
+    {
+        detail::compressedParallelFor(
+            exec, conn.view<DeltaWidth::Bits32>(), conn.nCells(), kernel, name
+        );
+    }
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
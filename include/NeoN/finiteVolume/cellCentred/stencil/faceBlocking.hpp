@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/atomic.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+struct BlockedFaces;
+}
+
+/* @class FaceBlocking
+ * @brief partitions the faces of a mesh into blocks of consecutive cells sized for the L2 cache
+ *
+ * Block b holds the cells [b * cellsPerBlock, (b + 1) * cellsPerBlock). The faces of a block are
+ * the internal faces with owner and neighbour in the block and the boundary faces of its cells,
+ * in face order. The internal faces between blocks follow the faces of all blocks. Boundary face
+ * ids are stored with an offset of nInternalFaces, see FaceColoring.
+ *
+ * A loop over a block touches only the cells of the block, which stay cache resident while its
+ * faces are processed and can be updated without atomics. The blocks follow the cell order,
+ * thus a bandwidth reducing renumbering of the mesh, see renumberMesh, keeps most faces within
+ * a block.
+ */
+class FaceBlocking
+{
+public:
+
+    /* @brief the default block size, about the cells whose face loop data fits into 512 KiB */
+    static constexpr localIdx defaultCellsPerBlock = 4096;
+
+    FaceBlocking(const UnstructuredMesh& mesh, localIdx cellsPerBlock = defaultCellsPerBlock);
+
+    localIdx nBlocks() const { return static_cast<localIdx>(blockOffsets_.size()) - 1; }
+
+    /* @brief the faces of all blocks followed by the faces between blocks */
+    const Vector<localIdx>& faces() const { return faces_; }
+
+    /* @brief block b spans [blockOffsets[b], blockOffsets[b + 1]) of faces */
+    const Vector<localIdx>& blockOffsets() const { return blockOffsets_; }
+
+    /* @brief the number of faces of all blocks, the offset of the faces between blocks */
+    localIdx nBlockFaces() const { return nBlockFaces_; }
+
+    std::size_t memoryBytes() const { return faces_.memoryBytes() + blockOffsets_.memoryBytes(); }
+
+    /* @brief returns the face blocking of the mesh with the default block size, computed on
+     * first access and stored in the stencil database of the mesh
+     */
+    static const FaceBlocking& readOrCreate(const UnstructuredMesh& mesh);
+
+private:
+
+    FaceBlocking(const Executor& exec, detail::BlockedFaces blocked);
+
+    Vector<localIdx> faces_;
+
+    Vector<localIdx> blockOffsets_;
+
+    localIdx nBlockFaces_;
+};
+
+/* @brief sums face values into the adjacent cells block by block
+ *
+ * Same semantics as gatherFaceValues, ie. res[celli] += \sum_f s_f faceValue(f). One thread
+ * processes the faces of a block without atomics, the faces between blocks are added with
+ * atomics afterwards. Meant for the CPU executors, a GPU lacks the parallelism over the blocks.
+ */
+template<typename ValueType, typename FaceValue>
+void blockedFaceValues(
+    const UnstructuredMesh& mesh, View<ValueType> res, FaceValue faceValue, bool antisymmetric
+)
+{
+    const auto& blocking = FaceBlocking::readOrCreate(mesh);
+    const auto exec = mesh.exec();
+    const auto [owner, neighbour, faceCells, faces, offsets] = views(
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.boundaryMesh().faceCells(),
+        blocking.faces(),
+        blocking.blockOffsets()
+    );
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    parallelFor(
+        exec,
+        {0, blocking.nBlocks()},
+        KOKKOS_LAMBDA(const localIdx blocki) {
+            for (auto i = offsets[blocki]; i < offsets[blocki + 1]; i++)
+            {
+                const auto facei = faces[i];
+                if (facei < nInternalFaces)
+                {
+                    auto value = faceValue(facei);
+                    res[owner[facei]] += value;
+                    res[neighbour[facei]] += neiSign * value;
+                }
+                else
+                {
+                    res[faceCells[facei - nInternalFaces]] += faceValue(facei);
+                }
+            }
+        },
+        "blockedFaceValuesBlocks"
+    );
+
+    parallelFor(
+        exec,
+        {blocking.nBlockFaces(), faces.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            const auto facei = faces[i];
+            auto value = faceValue(facei);
+            atomicAdd(&res[owner[facei]], value);
+            atomicAdd(&res[neighbour[facei]], neiSign * value);
+        },
+        "blockedFaceValuesBetweenBlocks"
+    );
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
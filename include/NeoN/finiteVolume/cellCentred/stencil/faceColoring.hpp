@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "NeoN/core/atomic.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/memoryReport.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief a set of faces grouped into colors
+ *
+ * Faces of the same color do not share a cell, thus a face loop restricted to a single color
+ * can write to the adjacent cells without atomics.
+ */
+struct ColoredFaces
+{
+    Vector<localIdx> faces;        //! face ids grouped by color
+    std::vector<localIdx> offsets; //! host offsets, color c spans [offsets[c], offsets[c+1])
+
+    /* @brief the number of colors up to which the colored face loops are used, every color is
+     * a kernel launch, hence meshes needing more colors scatter with atomics instead
+     */
+    static constexpr localIdx maxColors = 64;
+
+    localIdx nColors() const { return static_cast<localIdx>(offsets.size()) - 1; }
+
+    /* @brief whether the colored face loops are used, see maxColors */
+    bool efficient() const { return nColors() <= maxColors; }
+
+    std::size_t memoryBytes() const { return faces.memoryBytes() + NeoN::memoryBytes(offsets); }
+};
+
+/* @class FaceColoring
+ * @brief partitions the faces of a mesh into colors without shared owner or neighbour
+ *
+ * The internal faces and the boundary faces are colored independently, since they are
+ * processed in separate loops. Boundary face ids are stored with an offset of nInternalFaces.
+ * The coloring is computed greedily on the host in face order and is thus deterministic. The
+ * number of colors is not limited, but the operators check efficient and fall back to the
+ * atomic scatter for colorings with more than ColoredFaces::maxColors colors.
+ */
+class FaceColoring
+{
+public:
+
+    FaceColoring(const UnstructuredMesh& mesh);
+
+    const ColoredFaces& internalFaces() const { return internalFaces_; }
+
+    const ColoredFaces& boundaryFaces() const { return boundaryFaces_; }
+
+    /* @brief whether the internal and the boundary faces have efficient colorings */
+    bool efficient() const { return internalFaces_.efficient() && boundaryFaces_.efficient(); }
+
+    std::size_t memoryBytes() const
+    {
+        return internalFaces_.memoryBytes() + boundaryFaces_.memoryBytes();
+    }
+
+    /* @brief returns the face coloring of the mesh, computed on first access and stored in
+     * the stencil database of the mesh
+     */
+    static const FaceColoring& readOrCreate(const UnstructuredMesh& mesh);
+
+private:
+
+    ColoredFaces internalFaces_;
+
+    ColoredFaces boundaryFaces_;
+};
+
+/* @brief runs kernel(facei) for all faces, color by color
+ *
+ * Within a color the kernel is executed in parallel and can update owner and neighbour
+ * values without atomics.
+ */
+template<typename Kernel>
+void coloredParallelFor(
+    const Executor& exec,
+    const ColoredFaces& colored,
+    Kernel kernel,
+    std::string name = "coloredParallelFor"
+)
+{
+    const auto faces = colored.faces.view();
+    for (localIdx color = 0; color < colored.nColors(); color++)
+    {
+        parallelFor(
+            exec,
+            {colored.offsets[color], colored.offsets[color + 1]},
+            KOKKOS_LAMBDA(const localIdx i) { kernel(faces[i]); },
+            name
+        );
+    }
+}
+
+/* @brief adds value to dst, uses an atomic unless the enclosing face loop is race free */
+template<typename ValueType>
+KOKKOS_INLINE_FUNCTION void scatterAdd(ValueType& dst, const ValueType& value, bool raceFree)
+{
+    if (raceFree)
+    {
+        dst += value;
+    }
+    else
+    {
+        atomicAdd(&dst, value);
+    }
+}
+
+/* @brief sums face values into the adjacent cells using the face coloring
+ *
+ * Same semantics as gatherFaceValues, ie. res[celli] += \sum_f s_f faceValue(f).
+ */
+template<typename ValueType, typename FaceValue>
+void coloredFaceValues(
+    const UnstructuredMesh& mesh, View<ValueType> res, FaceValue faceValue, bool antisymmetric
+)
+{
+    const auto& coloring = FaceColoring::readOrCreate(mesh);
+    const auto exec = mesh.exec();
+    const auto [owner, neighbour, faceCells] =
+        views(mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    coloredParallelFor(
+        exec,
+        coloring.internalFaces(),
+        KOKKOS_LAMBDA(const localIdx facei) {
+            auto value = faceValue(facei);
+            res[owner[facei]] += value;
+            res[neighbour[facei]] += neiSign * value;
+        },
+        "coloredFaceValuesInternal"
+    );
+
+    coloredParallelFor(
+        exec,
+        coloring.boundaryFaces(),
+        KOKKOS_LAMBDA(const localIdx facei) {
+            res[faceCells[facei - nInternalFaces]] += faceValue(facei);
+        },
+        "coloredFaceValuesBoundary"
+    );
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief runs a kernel on the boundary faces of the boundary face range [start, end)
+ *
+ * The kernel is called as kernel(facei, bfacei) with the face index facei and the boundary face
+ * index bfacei = facei - nInternalFaces, ie. the index of the boundary values and face cells,
+ * hence the kernel neither branches on the face type nor computes the indirection.
+ *
+ * @param exec, the executor
+ * @param mesh, the mesh
+ * @param range, the range of boundary face indices
+ * @param kernel, the kernel of a boundary face
+ * @param name, the name of the kernel
+ */
+template<typename Kernel>
+void parallelForBoundaryFaces(
+    const Executor& exec,
+    const UnstructuredMesh& mesh,
+    std::pair<localIdx, localIdx> range,
+    Kernel kernel,
+    std::string_view name = "parallelForBoundaryFaces"
+)
+{
+    const auto nInternalFaces = mesh.nInternalFaces();
+    parallelFor(
+        exec,
+        range,
+        KOKKOS_LAMBDA(const localIdx bfacei) { kernel(nInternalFaces + bfacei, bfacei); },
+        name
+    );
+}
+
+/* @brief runs a kernel on all boundary faces, see parallelForBoundaryFaces above */
+template<typename Kernel>
+void parallelForBoundaryFaces(
+    const Executor& exec,
+    const UnstructuredMesh& mesh,
+    Kernel kernel,
+    std::string_view name = "parallelForBoundaryFaces"
+)
+{
+    parallelForBoundaryFaces(exec, mesh, {0, mesh.nBoundaryFaces()}, kernel, name);
+}
+
+/* @brief runs a kernel on the faces of a single boundary patch
+ *
+ * The range of the patch is given by BoundaryMesh::offset, thus a kernel which depends on the
+ * type of the patch runs without a per face branch.
+ *
+ * @param patchi, the index of the patch
+ * @see parallelForBoundaryFaces
+ */
+template<typename Kernel>
+void parallelForPatchFaces(
+    const Executor& exec,
+    const UnstructuredMesh& mesh,
+    localIdx patchi,
+    Kernel kernel,
+    std::string_view name = "parallelForPatchFaces"
+)
+{
+    const auto& offset = mesh.boundaryMesh().offset();
+    NF_ASSERT(
+        patchi >= 0 && static_cast<size_t>(patchi) + 1 < offset.size(),
+        "The patch " << patchi << " does not exist."
+    );
+    const auto pi = static_cast<size_t>(patchi);
+    parallelForBoundaryFaces(exec, mesh, {offset[pi], offset[pi + 1]}, kernel, name);
+}
+
+/* @brief runs separate kernels on the internal and on the boundary faces
+ *
+ * The internal kernel is called as internalKernel(facei) on [0, nInternalFaces), the boundary
+ * kernel as boundaryKernel(facei, bfacei) on the boundary faces. Both loops are free of face
+ * type branches, thus the internal loop vectorizes on CPUs and the threads of a warp follow the
+ * same control flow on GPUs. The kernels are launched as name + "Internal" and
+ * name + "Boundary".
+ *
+ * @param exec, the executor
+ * @param mesh, the mesh
+ * @param internalKernel, the kernel of an internal face
+ * @param boundaryKernel, the kernel of a boundary face
+ * @param name, the prefix of the kernel names
+ */
+template<typename InternalKernel, typename BoundaryKernel>
+void parallelForFaces(
+    const Executor& exec,
+    const UnstructuredMesh& mesh,
+    InternalKernel internalKernel,
+    BoundaryKernel boundaryKernel,
+    const std::string& name = "parallelForFaces"
+)
+{
+    parallelFor(exec, {0, mesh.nInternalFaces()}, internalKernel, name + "Internal");
+    parallelForBoundaryFaces(exec, mesh, boundaryKernel, name + "Boundary");
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
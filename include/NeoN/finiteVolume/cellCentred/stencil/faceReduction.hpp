@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceBlocking.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceColoring.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief strategy to reduce face contributions into the owner and neighbour cells */
+enum class FaceReduction
+{
+    Atomic,    // loop over faces and scatter with atomics
+    Gather,    // loop over cells and gather the faces of the cell from the cell to face stencil
+    Coloring,   // loop over faces color by color without atomics
+    Structured, // loop over cells and address the faces of the cell by its i, j, k index
+    Blocked     // loop over cache sized blocks of cells, atomics only between blocks
+};
+
+/* @brief selects the face reduction strategy for the given executor
+ *
+ * On the SerialExecutor the atomics are uncontended and the scatter is used. On the
+ * CPUExecutor the face coloring avoids atomics without the indirection of the gather, which
+ * is used on the GPUExecutor. Within a call tuned by the FaceReductionTuner the strategy of the
+ * tuner is returned instead.
+ */
+FaceReduction faceReduction(const Executor& exec);
+
+/* @brief selects the face reduction strategy for the given mesh
+ *
+ * A block structured mesh, see UnstructuredMesh::structured, uses the structured gather on the
+ * parallel executors, otherwise the strategy of the executor is used. A mesh with ghost cells,
+ * see UnstructuredMesh::nGhostCells, always uses the gather, which writes the local cells only.
+ * So does a mesh with an active region, the gather then loops over the active cells only.
+ */
+FaceReduction faceReduction(const UnstructuredMesh& mesh);
+
+/* @brief whether the face loops of the operators on the mesh use its face coloring
+ *
+ * This is the case if the executor selects the coloring, see faceReduction, and the coloring of
+ * the mesh is efficient, see FaceColoring::efficient, otherwise the loops scatter with atomics.
+ */
+bool coloredFaceLoops(const UnstructuredMesh& mesh);
+
+/* @brief sums face values into the adjacent cells of a block structured mesh and updates the
+ * cell result
+ *
+ * Same semantics as gatherAndUpdateFaceValues, but the six faces of a cell follow from its
+ * index, hence neither the cell to face stencil nor the face neighbour is read.
+ */
+template<typename ValueType, typename FaceValue, typename CellUpdate>
+void structuredUpdateFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellUpdate cellUpdate
+)
+{
+    NF_ASSERT(mesh.structured(), "The structured face reduction requires a structured mesh.");
+    const StructuredBlock block = *mesh.structured();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            ValueType sum = zero<ValueType>();
+            for (localIdx d = 0; d < 3; d++)
+            {
+                const auto lower = block.face(celli, d, false);
+                const auto upper = block.face(celli, d, true);
+                sum += (lower.owner ? 1.0 : neiSign) * faceValue(lower.facei);
+                sum += faceValue(upper.facei);
+            }
+            res[celli] = cellUpdate(celli, res[celli], sum);
+        },
+        "structuredFaceValues"
+    );
+}
+
+/* @brief sums face values into the adjacent cells of a block structured mesh and scales the
+ * cell result
+ *
+ * Same semantics as gatherFaceValues, see structuredUpdateFaceValues.
+ */
+template<typename ValueType, typename FaceValue, typename CellScale>
+void structuredFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellScale cellScale
+)
+{
+    structuredUpdateFaceValues(
+        mesh, res, faceValue, antisymmetric, ScaledCellUpdate<CellScale> {cellScale}
+    );
+}
+
+/* @brief sums face values into the adjacent cells using atomics
+ *
+ * Same semantics as gatherFaceValues, ie. res[celli] += \sum_f s_f faceValue(f).
+ */
+template<typename ValueType, typename FaceValue>
+void atomicFaceValues(
+    const UnstructuredMesh& mesh, View<ValueType> res, FaceValue faceValue, bool antisymmetric
+)
+{
+    const auto exec = mesh.exec();
+    const auto [owner, neighbour, faceCells] =
+        views(mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const scalar neiSign = antisymmetric ? -1.0 : 1.0;
+
+    parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            auto value = faceValue(facei);
+            atomicAdd(&res[owner[facei]], value);
+            atomicAdd(&res[neighbour[facei]], neiSign * value);
+        },
+        "atomicFaceValuesInternal"
+    );
+
+    parallelFor(
+        exec,
+        {nInternalFaces, nInternalFaces + mesh.nBoundaryFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            atomicAdd(&res[faceCells[facei - nInternalFaces]], faceValue(facei));
+        },
+        "atomicFaceValuesBoundary"
+    );
+}
+
+/* @brief sums face values into the adjacent cells with the strategy selected for the executor
+ *
+ * Computes res[celli] += \sum_f s_f faceValue(f) for all faces of a cell, where s_f is 1 for
+ * owner and boundary faces. For neighbour faces s_f is -1 if antisymmetric is set and 1
+ * otherwise.
+ */
+template<typename ValueType, typename FaceValue>
+void reduceFaceValues(
+    const UnstructuredMesh& mesh, View<ValueType> res, FaceValue faceValue, bool antisymmetric
+)
+{
+    switch (faceReduction(mesh))
+    {
+    case FaceReduction::Structured:
+        structuredFaceValues(mesh, res, faceValue, antisymmetric, UnitCellScale {});
+        break;
+    case FaceReduction::Gather:
+        gatherFaceValues(mesh, res, faceValue, antisymmetric);
+        break;
+    case FaceReduction::Coloring:
+        coloredFaceValues(mesh, res, faceValue, antisymmetric);
+        break;
+    case FaceReduction::Blocked:
+        blockedFaceValues(mesh, res, faceValue, antisymmetric);
+        break;
+    default:
+        atomicFaceValues(mesh, res, faceValue, antisymmetric);
+    }
+}
+
+/* @brief sums face values into the adjacent cells and scales the cell result
+ *
+ * Computes res[celli] = cellScale(celli) * (res[celli] + \sum_f s_f faceValue(f)), see
+ * reduceFaceValues. The gathers apply the scaling in the reduction kernel, the other strategies
+ * need a separate pass over the cells.
+ */
+template<typename ValueType, typename FaceValue, typename CellScale>
+void reduceAndScaleFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellScale cellScale
+)
+{
+    const auto strategy = faceReduction(mesh);
+    if (strategy == FaceReduction::Structured)
+    {
+        structuredFaceValues(mesh, res, faceValue, antisymmetric, cellScale);
+        return;
+    }
+    if (strategy == FaceReduction::Gather)
+    {
+        gatherFaceValues(mesh, res, faceValue, antisymmetric, cellScale);
+        return;
+    }
+    reduceFaceValues(mesh, res, faceValue, antisymmetric);
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) { res[celli] *= cellScale(celli); },
+        "scaleFaceValues"
+    );
+}
+
+/* @brief sums face values into the adjacent cells and updates the cell result
+ *
+ * Computes res[celli] = cellUpdate(celli, res[celli], \sum_f s_f faceValue(f)), see
+ * reduceFaceValues. The gathers apply the update in the reduction kernel, the other strategies
+ * reduce into sums, which is overwritten, and need a separate pass over the cells.
+ *
+ * @param sums View of the size of res holding the face sums of the scattering strategies
+ */
+template<typename ValueType, typename FaceValue, typename CellUpdate>
+void reduceAndUpdateFaceValues(
+    const UnstructuredMesh& mesh,
+    View<ValueType> res,
+    FaceValue faceValue,
+    bool antisymmetric,
+    CellUpdate cellUpdate,
+    View<ValueType> sums
+)
+{
+    const auto strategy = faceReduction(mesh);
+    if (strategy == FaceReduction::Structured)
+    {
+        structuredUpdateFaceValues(mesh, res, faceValue, antisymmetric, cellUpdate);
+        return;
+    }
+    if (strategy == FaceReduction::Gather)
+    {
+        gatherAndUpdateFaceValues(mesh, res, faceValue, antisymmetric, cellUpdate);
+        return;
+    }
+    NF_ASSERT_EQUAL(sums.size(), res.size());
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) { sums[celli] = zero<ValueType>(); },
+        "resetFaceValues"
+    );
+    reduceFaceValues(mesh, sums, faceValue, antisymmetric);
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            res[celli] = cellUpdate(celli, res[celli], sums[celli]);
+        },
+        "updateFaceValues"
+    );
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
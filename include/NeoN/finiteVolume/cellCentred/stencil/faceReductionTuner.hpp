@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the strategies an explicit face reduction of the mesh can use, the structured gather
+ * only for a block structured mesh and the blocked loop only on the host executors
+ */
+std::vector<FaceReduction> faceReductionCandidates(const UnstructuredMesh& mesh);
+
+/* @brief selects the face reduction strategy of an operator by timing the candidates
+ *
+ * While enabled, the first calls of an operator, see FaceReductionTuning, run with one candidate
+ * after the other, each candidate for trials calls. The candidate with the shortest call is then
+ * used for all further calls with the same operator, value type, executor and mesh size. Taking
+ * the shortest call excludes the setup on first use, eg. of the face coloring, thus at least two
+ * trials should be used. All candidates compute the same result, hence the tuning calls are
+ * regular calls.
+ *
+ * The choices are read from the cache file when the tuner is enabled and the file is rewritten
+ * after every new choice, thus later runs skip the tuning. Disabled by default, then
+ * faceReduction selects the strategy of the executor. The tuner is not thread safe.
+ */
+class FaceReductionTuner
+{
+public:
+
+    /* @brief the process wide tuner */
+    static FaceReductionTuner& instance();
+
+    FaceReductionTuner(const FaceReductionTuner&) = delete;
+
+    FaceReductionTuner& operator=(const FaceReductionTuner&) = delete;
+
+    /* @brief starts tuning, reads the choices of cacheFile unless it is empty
+     *
+     * @param trials the number of timed calls per candidate
+     * @param cacheFile the file the choices are read from and written to
+     */
+    void enable(int trials = 2, const std::string& cacheFile = "");
+
+    /* @brief stops tuning, faceReduction uses the strategy of the executor again */
+    void disable();
+
+    /* @brief removes all timings and choices */
+    void clear();
+
+    bool enabled() const { return enabled_; }
+
+    /* @brief the strategy of the running operator call, which overrides faceReduction */
+    std::optional<FaceReduction> active() const { return active_; }
+
+    /* @brief the chosen strategy of an operator, empty while the operator is tuned */
+    std::optional<FaceReduction> selected(
+        const UnstructuredMesh& mesh, const std::string& kernel, const std::type_info& valueType
+    ) const;
+
+private:
+
+    friend class FaceReductionTuning;
+
+    struct Entry
+    {
+        std::vector<FaceReduction> candidates;
+        std::vector<double> seconds; // the shortest call per candidate
+        std::size_t calls {0};
+        std::optional<FaceReduction> selected;
+    };
+
+    FaceReductionTuner() = default;
+
+    static std::string
+    key(const UnstructuredMesh& mesh, const std::string& kernel, const std::type_info& valueType);
+
+    void read();
+
+    void write() const;
+
+    bool enabled_ {false};
+    std::size_t trials_ {2};
+    std::string cacheFile_;
+    std::map<std::string, Entry> entries_;
+    std::optional<FaceReduction> active_;
+};
+
+/* @brief the scope of an operator call tuned by the FaceReductionTuner
+ *
+ * Sets the strategy faceReduction returns within the scope and times the call while the operator
+ * is tuned. Only the outermost scope is tuned, nested operators use its strategy. Without an
+ * enabled tuner the scope does nothing.
+ */
+class FaceReductionTuning
+{
+public:
+
+    /* @brief tunes the explicit face reduction strategies of the mesh */
+    FaceReductionTuning(
+        const UnstructuredMesh& mesh, const char* kernel, const std::type_info& valueType
+    );
+
+    /* @brief tunes the given candidates, eg. the atomic and colored matrix assembly */
+    FaceReductionTuning(
+        const UnstructuredMesh& mesh,
+        const char* kernel,
+        const std::type_info& valueType,
+        const std::vector<FaceReduction>& candidates
+    );
+
+    ~FaceReductionTuning();
+
+    FaceReductionTuning(const FaceReductionTuning&) = delete;
+
+    FaceReductionTuning& operator=(const FaceReductionTuning&) = delete;
+
+private:
+
+    void start(
+        const char* kernel,
+        const std::type_info& valueType,
+        const std::vector<FaceReduction>& candidates
+    );
+
+    const UnstructuredMesh& mesh_;
+    FaceReductionTuner::Entry* entry_ {nullptr}; // set if this call is timed
+    std::size_t candidate_ {0};
+    bool owner_ {false}; // whether this scope set the active strategy
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <limits>
 
 #include "NeoN/core/primitives/vec3.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
@@ -30,12 +31,18 @@ public:
     virtual void
     updateNonOrthDeltaCoeffs(const Executor& exec, SurfaceField<scalar>& nonOrthDeltaCoeffs) = 0;
 
+    /* @brief computes the non-orthogonal correction vectors k_f, see nonOrthCorrectionVec3s */
     virtual void
     updateNonOrthDeltaCoeffs(const Executor& exec, SurfaceField<Vec3>& nonOrthDeltaCoeffs) = 0;
 };
 
 /* @class GeometryScheme
  * @brief Implements a method to compute deltaCoeffs
+ *
+ * The weights and delta coefficients are computed lazily on first access and are recomputed
+ * only if the geometry version of the mesh has changed, eg. after mesh motion. The instance
+ * returned by readOrCreate is shared by all interpolation and face normal gradient schemes of
+ * the mesh.
  */
 class GeometryScheme
 {
@@ -63,14 +70,36 @@ public:
 
     const SurfaceField<scalar>& weights() const;
 
+    /* @brief the weights of all faces stored in single precision
+     *
+     * The float storage is converted from weights on first access and after changes of the mesh
+     * geometry, the kernels using it promote the loaded values to scalar.
+     */
+    const Vector<float>& floatWeights() const;
+
     const SurfaceField<scalar>& deltaCoeffs() const;
 
     const SurfaceField<scalar>& nonOrthDeltaCoeffs() const;
 
+    /* @brief the non-orthogonal correction vectors k_f = n_f - nonOrthDeltaCoeffs_f d_f, which
+     * are zero on boundary faces
+     */
     const SurfaceField<Vec3>& nonOrthCorrectionVec3s() const;
 
+    /* @brief recomputes the weights and delta coefficients from the current mesh geometry */
     void update();
 
+    /* @brief whether the cached fields are computed from the current mesh geometry */
+    bool upToDate() const;
+
+    /* @brief the bytes of the weights, delta coefficients and correction vectors */
+    std::size_t memoryBytes() const
+    {
+        return weights_.memoryBytes() + deltaCoeffs_.memoryBytes()
+             + nonOrthDeltaCoeffs_.memoryBytes() + nonOrthCorrectionVec3s_.memoryBytes()
+             + floatWeights_.memoryBytes();
+    }
+
     std::string name() const;
 
     // add selection mechanism via dictionary later
@@ -78,14 +107,28 @@ public:
 
 private:
 
+    /* @brief the geometry version of fields that are not computed yet */
+    static constexpr std::size_t notComputed = std::numeric_limits<std::size_t>::max();
+
+    void compute() const;
+
+    void updateIfOutdated() const;
+
     const Executor exec_;
     const UnstructuredMesh& mesh_;
     std::unique_ptr<GeometrySchemeFactory> kernel_;
 
-    SurfaceField<scalar> weights_;
-    SurfaceField<scalar> deltaCoeffs_;
-    SurfaceField<scalar> nonOrthDeltaCoeffs_;
-    SurfaceField<Vec3> nonOrthCorrectionVec3s_;
+    mutable SurfaceField<scalar> weights_;
+    mutable SurfaceField<scalar> deltaCoeffs_;
+    mutable SurfaceField<scalar> nonOrthDeltaCoeffs_;
+    mutable SurfaceField<Vec3> nonOrthCorrectionVec3s_;
+    mutable Vector<float> floatWeights_;
+
+    /* @brief the mesh geometry version the fields are computed from */
+    mutable std::size_t geometryVersion_;
+
+    /* @brief the mesh geometry version floatWeights_ is converted from */
+    mutable std::size_t floatWeightsVersion_ {notComputed};
 };
 
 } // namespace NeoN
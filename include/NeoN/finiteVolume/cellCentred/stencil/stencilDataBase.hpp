@@ -6,17 +6,85 @@
 
 #include <unordered_map>
 #include <any>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/memoryReport.hpp"
 
 namespace NeoN
 {
 
+namespace detail
+{
+
+/**
+ * @brief Returns a new slot index for a StencilKey, unique within the program.
+ */
+inline std::size_t nextStencilSlot()
+{
+    static std::atomic<std::size_t> counter {0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+/**
+ * @class StencilKey
+ * @brief A typed key of an entry in the StencilDataBase.
+ *
+ * Every key gets a slot index on construction, which the StencilDataBase uses to
+ * cache a pointer to the entry. Keys are meant to be long lived, typically a
+ * static object next to the readOrCreate function of the stored type.
+ *
+ * @tparam T The type of the value stored under this key.
+ */
+template<typename T>
+class StencilKey
+{
+public:
+
+    /**
+     * @brief Constructs a key with the given name and a new slot index.
+     *
+     * @param name The name of the entry, also used by the string based interface.
+     */
+    explicit StencilKey(std::string name) : name_(std::move(name)), slot_(detail::nextStencilSlot())
+    {}
+
+    /**
+     * @brief Returns the name of the entry.
+     */
+    const std::string& name() const { return name_; }
+
+    /**
+     * @brief Returns the slot index of the key.
+     */
+    std::size_t slot() const { return slot_; }
+
+private:
+
+    std::string name_;
+
+    std::size_t slot_;
+};
+
 /**
  * @class StencilDataBase
  * @brief A class that represents a stencil database.
  *
  * The StencilDataBase class provides a container for storing stencil data. It
  * allows insertion, retrieval, and checking of stencil data using string keys.
+ * Frequently accessed data should be retrieved with getOrCreate and a StencilKey,
+ * which only performs a lookup by name on the first call.
+ *
+ * The access to the database is thread safe, an entry is created by one thread only. The stored
+ * data itself is not protected, eg. the linear system of an equation or the caches of the
+ * schemes, hence concurrent tasks on the mesh hold the lock while they use shared entries.
  */
 class StencilDataBase
 {
@@ -27,6 +95,33 @@ public:
      */
     StencilDataBase() = default;
 
+    /**
+     * @brief Copies the stored data, the cached entries are not copied since they
+     * point into the data of other.
+     */
+    StencilDataBase(const StencilDataBase& other);
+
+    StencilDataBase(StencilDataBase&& other);
+
+    StencilDataBase& operator=(const StencilDataBase& other);
+
+    StencilDataBase& operator=(StencilDataBase&& other);
+
+    /**
+     * @brief Locks the database for the calling thread.
+     *
+     * The lock is recursive, ie. the accessors can be called while it is held. The equations
+     * solved by dsl::solve hold it while they read their schemes, assemble and access the
+     * database of their fields, only the linear solve of the system owned by the equation runs
+     * concurrently to other equations on the mesh.
+     *
+     * @return The lock, which is released on destruction.
+     */
+    [[nodiscard]] std::unique_lock<std::recursive_mutex> lock() const
+    {
+        return std::unique_lock<std::recursive_mutex>(mutex_);
+    }
+
     /**
      * @brief Inserts a value into the stencil database.
      *
@@ -37,7 +132,11 @@ public:
     template<typename T>
     void insert(const std::string& key, T value)
     {
-        stencilDB_.emplace(key, value);
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        if (stencilDB_.emplace(key, value).second)
+        {
+            reporters_[key] = &reportEntry<T>;
+        }
     }
 
     /**
@@ -68,6 +167,7 @@ public:
     template<typename T>
     T& get(const std::string& key)
     {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
         return std::any_cast<T&>(stencilDB_.at(key));
     }
 
@@ -83,6 +183,7 @@ public:
     template<typename T>
     const T& get(const std::string& key) const
     {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
         return std::any_cast<const T&>(stencilDB_.at(key));
     }
 
@@ -95,12 +196,141 @@ public:
      */
     bool contains(const std::string& key) const;
 
+    /**
+     * @brief Adds the stored data to a memory report, ordered by key.
+     *
+     * The entries are added with their memoryBytes to the given category, unless their type
+     * reports its parts itself, see ReportsMemory. Entries replaced through operator[] are
+     * added with zero bytes since their type is unknown.
+     *
+     * @param report The report to add to.
+     * @param category The category of the entries.
+     */
+    void reportMemory(MemoryReport& report, const std::string& category) const;
+
+    /**
+     * @brief Retrieves the value associated with the given key and creates it on
+     * the first call.
+     *
+     * The first call looks the entry up by name and inserts the result of builder
+     * if it does not exist yet. Subsequent calls with the same key return the
+     * cached entry without any lookup by name or any_cast. The cached entry is not
+     * updated if the value is replaced through operator[]. The builder is called with the
+     * database locked, hence it can retrieve other entries but concurrent calls wait for it.
+     *
+     * @tparam T The type of the value.
+     * @tparam Builder A callable without arguments returning a T.
+     * @param key The typed key associated with the value.
+     * @param builder Creates the value if it does not exist yet.
+     * @return A reference to the value associated with the key.
+     */
+    template<typename T, typename Builder>
+    T& getOrCreate(const StencilKey<T>& key, Builder&& builder)
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        if (key.slot() < slots_.size() && slots_[key.slot()] != nullptr)
+        {
+            return *static_cast<T*>(slots_[key.slot()]);
+        }
+        auto it = stencilDB_.find(key.name());
+        if (it == stencilDB_.end())
+        {
+            it = stencilDB_.emplace(key.name(), T(builder())).first;
+            reporters_[key.name()] = &reportEntry<T>;
+        }
+        T* value = std::any_cast<T>(&it->second);
+        if (value == nullptr)
+        {
+            NF_ERROR_EXIT(
+                "Stencil data " << key.name() << " is stored with type " << it->second.type().name()
+            );
+        }
+        if (key.slot() >= slots_.size())
+        {
+            slots_.resize(key.slot() + 1, nullptr);
+        }
+        slots_[key.slot()] = value;
+        return *value;
+    }
+
+    /**
+     * @brief Retrieves the value associated with the given name and creates it on
+     * the first call.
+     *
+     * For entries whose name is only known at runtime, eg. one entry per equation, every
+     * call looks the entry up by name.
+     *
+     * @tparam T The type of the value.
+     * @tparam Builder A callable without arguments returning a T.
+     * @param name The name of the entry.
+     * @param builder Creates the value if it does not exist yet.
+     * @return A reference to the value associated with the name.
+     */
+    template<typename T, typename Builder>
+    T& getOrCreate(const std::string& name, Builder&& builder)
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        auto it = stencilDB_.find(name);
+        if (it == stencilDB_.end())
+        {
+            it = stencilDB_.emplace(name, T(builder())).first;
+            reporters_[name] = &reportEntry<T>;
+        }
+        T* value = std::any_cast<T>(&it->second);
+        if (value == nullptr)
+        {
+            NF_ERROR_EXIT(
+                "Stencil data " << name << " is stored with type " << it->second.type().name()
+            );
+        }
+        return *value;
+    }
+
 private:
 
+    /**
+     * @brief Adds an entry to a memory report, returns false if the entry has another type.
+     */
+    using Reporter =
+        bool (*)(MemoryReport&, const std::string&, const std::string&, const std::any&);
+
+    template<typename T>
+    static bool reportEntry(
+        MemoryReport& report,
+        const std::string& category,
+        const std::string& name,
+        const std::any& value
+    )
+    {
+        const T* entry = std::any_cast<T>(&value);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+        NeoN::reportMemory(report, category, name, *entry);
+        return true;
+    }
+
     /**
      * @brief The stencil database to register stencil data.
      */
     std::unordered_map<std::string, std::any> stencilDB_;
+
+    /**
+     * @brief The entries of stencilDB_ retrieved by getOrCreate, indexed by the
+     * slot of their StencilKey.
+     */
+    std::vector<void*> slots_;
+
+    /**
+     * @brief The memory reporters of the entries with a known type, by key.
+     */
+    std::unordered_map<std::string, Reporter> reporters_;
+
+    /**
+     * @brief Protects the containers of the database, see lock.
+     */
+    mutable std::recursive_mutex mutex_;
 };
 
 } // namespace NeoN
@@ -0,0 +1,308 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NF_WITH_ADIOS2
+
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <adios2.h>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/statisticsCollection.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/environment.hpp"
+#endif
+
+namespace NeoN::io
+{
+
+/* @brief the engine settings of the ADIOS2 writer */
+struct Adios2Options
+{
+    /* @brief the ADIOS2 engine, BP5 buffers the data of a step and writes it in the background */
+    std::string engine {"BP5"};
+
+    /* @brief whether the data is written asynchronously while the computation continues */
+    bool asyncWrite {true};
+
+    /* @brief the number of ranks writing to the file system, 0 lets ADIOS2 choose */
+    int nAggregators {0};
+
+    /* @brief a node-local directory, eg. on NVMe, where the BP5 files are written first
+     *
+     * The aggregators write to the node-local storage, which is fast and does not stall the
+     * other nodes, and a background thread of ADIOS2 copies the files to the file name on the
+     * parallel file system. An output waits for the staging of the previous one, the copies are
+     * completed on close. An empty path writes to the parallel file system directly.
+     */
+    std::string burstBufferPath {};
+
+    /* @brief whether the staged files are copied to the parallel file system, otherwise they are
+     * kept on the node-local storage only, eg. if they are collected by a job epilogue
+     */
+    bool burstBufferDrain {true};
+
+    /* @brief the codec of the lossless compression of the vectors, eg. "zstd" or "lz4"
+     *
+     * The vectors are byte shuffled and compressed by the blosc operator of ADIOS2, which has to
+     * be built with Blosc2. An empty codec disables the compression.
+     */
+    std::string compression {};
+
+    /* @brief the compression level from 1, the fastest, to 9 */
+    int compressionLevel {1};
+};
+
+/* @brief the ADIOS2 primitive type and number of components of a vector value type */
+template<typename ValueType>
+struct Adios2Type
+{
+    using type = ValueType;
+    static constexpr std::size_t nCmpts = 1;
+};
+
+// the zero padding lane of a padded Vec3 is stored as a fourth component, see vec3Lanes
+template<>
+struct Adios2Type<Vec3>
+{
+    using type = scalar;
+    static constexpr std::size_t nCmpts = vec3Lanes;
+};
+
+/* @brief the ADIOS2 memory space of the given executor */
+adios2::MemorySpace memorySpace(const Executor& exec);
+
+/* @class Adios2Writer
+ * @brief writes vectors, field collections and meshes to an ADIOS2 file
+ *
+ * Every rank writes its data as a local block, ie. the block id is the rank. The vectors are
+ * passed to ADIOS2 with their device pointer and are collected at the end of a step, hence they
+ * must neither be modified nor destroyed between put and endStep. With asynchronous BP5 output the
+ * data is copied into the engine buffers in endStep and written while the computation continues.
+ */
+class Adios2Writer
+{
+public:
+
+#ifdef NF_WITH_MPI_SUPPORT
+    Adios2Writer(
+        const std::string& fileName,
+        const mpi::MPIEnvironment& mpiEnviron,
+        const Adios2Options& options = {}
+    );
+#else
+    Adios2Writer(const std::string& fileName, const Adios2Options& options = {});
+#endif
+
+    /* @brief closes the file if it is still open */
+    ~Adios2Writer();
+
+    Adios2Writer(const Adios2Writer&) = delete;
+
+    Adios2Writer& operator=(const Adios2Writer&) = delete;
+
+    void beginStep();
+
+    /* @brief completes the step, the put vectors can be modified afterwards */
+    void endStep();
+
+    /* @brief waits for the outstanding writes and closes the file */
+    void close();
+
+    /* @brief writes a vector of the executor memory space */
+    template<typename ValueType>
+    void put(const std::string& name, const Vector<ValueType>& vector)
+    {
+        using Type = typename Adios2Type<ValueType>::type;
+        constexpr auto nCmpts = Adios2Type<ValueType>::nCmpts;
+        const auto count = static_cast<std::size_t>(vector.size());
+        const adios2::Dims dims =
+            nCmpts == 1 ? adios2::Dims {count} : adios2::Dims {count, nCmpts};
+        auto variable = io_.InquireVariable<Type>(name);
+        if (!variable)
+        {
+            variable = io_.DefineVariable<Type>(name, {}, {}, dims);
+            if (compressor_)
+            {
+                variable.AddOperation(compressor_, compressionParams_);
+            }
+        }
+        else
+        {
+            variable.SetSelection({{}, dims});
+        }
+        variable.SetMemorySpace(memorySpace(vector.exec()));
+        const auto* data = reinterpret_cast<const Type*>(vector.data());
+        engine_.Put(variable, data, adios2::Mode::Deferred);
+    }
+
+    /* @brief writes host data, which is copied immediately */
+    template<typename ValueType>
+    void put(const std::string& name, const std::vector<ValueType>& values)
+    {
+        const adios2::Dims dims {values.size()};
+        auto variable = io_.InquireVariable<ValueType>(name);
+        if (!variable)
+        {
+            variable = io_.DefineVariable<ValueType>(name, {}, {}, dims);
+        }
+        else
+        {
+            variable.SetSelection({{}, dims});
+        }
+        engine_.Put(variable, values.data(), adios2::Mode::Sync);
+    }
+
+    /* @brief writes the internal vector of every field of FieldType in the collection
+     *
+     * The fields are stored as <collection name>/<field name>.
+     */
+    template<typename FieldType>
+    void put(const finiteVolume::cellCentred::VectorCollection& collection)
+    {
+        for (const auto& id : collection.find(
+                 [](const Document& doc) { return doc["field"].type() == typeid(FieldType); }
+             ))
+        {
+            const auto& fieldDoc = collection.fieldDoc(id);
+            put(collection.name() + "/" + fieldDoc.name(),
+                fieldDoc.field<FieldType>().internalVector());
+        }
+    }
+
+    /* @brief writes the running statistics of every field of ValueType in the collection
+     *
+     * The statistics are stored as <collection name>/<field name>/{mean,rms,min,max,nSamples}.
+     * The rms is computed here, hence the statistics cost nothing but the update between outputs.
+     */
+    template<typename ValueType>
+    void put(finiteVolume::cellCentred::StatisticsCollection& collection)
+    {
+        using Statistics = finiteVolume::cellCentred::FieldStatistics<ValueType>;
+        const auto& fieldCollection = finiteVolume::cellCentred::VectorCollection::instance(
+            collection.db(), collection.fieldCollectionName()
+        );
+        for (const auto& id : collection.find(
+                 [](const Document& doc) { return doc["statistics"].type() == typeid(Statistics); }
+             ))
+        {
+            auto& statisticsDoc = collection.statisticsDoc(id);
+            auto& statistics = statisticsDoc.statistics<ValueType>();
+            const auto prefix =
+                collection.name() + "/" + fieldCollection.fieldDoc(statisticsDoc.fieldKey()).name();
+            put(prefix + "/mean", statistics.mean());
+            put(prefix + "/rms", statistics.rms());
+            put(prefix + "/min", statistics.min());
+            put(prefix + "/max", statistics.max());
+            put(prefix + "/nSamples", std::vector<std::int64_t> {statistics.nSamples()});
+        }
+    }
+
+    /* @brief writes the geometry and connectivity of the mesh, under the prefix mesh/ */
+    void put(const UnstructuredMesh& mesh);
+
+private:
+
+    adios2::ADIOS adios_;
+    adios2::IO io_;
+    adios2::Engine engine_;
+    adios2::Operator compressor_;      // the compression of the vectors, if enabled
+    adios2::Params compressionParams_;
+
+    void configure(const std::string& fileName, const Adios2Options& options);
+};
+
+/* @class Adios2Reader
+ * @brief reads vectors and meshes written by the Adios2Writer
+ *
+ * Every rank reads the block with its rank as block id. The data is read straight into the
+ * memory space of the executor of the target vector.
+ */
+class Adios2Reader
+{
+public:
+
+#ifdef NF_WITH_MPI_SUPPORT
+    Adios2Reader(
+        const std::string& fileName,
+        const mpi::MPIEnvironment& mpiEnviron,
+        const std::string& engine = "BP5"
+    );
+#else
+    Adios2Reader(const std::string& fileName, const std::string& engine = "BP5");
+#endif
+
+    ~Adios2Reader();
+
+    Adios2Reader(const Adios2Reader&) = delete;
+
+    Adios2Reader& operator=(const Adios2Reader&) = delete;
+
+    /* @brief advances to the next step
+     * @return false if there is no further step
+     */
+    bool beginStep();
+
+    /* @brief completes the outstanding reads of the step */
+    void endStep();
+
+    void close();
+
+    /* @brief whether the variable is stored in the current step */
+    bool contains(const std::string& name) const { return !io_.VariableType(name).empty(); }
+
+    /* @brief reads a vector, it is resized to the size of the stored block
+     *
+     * The data is only available after endStep, as the reads of a step are performed together.
+     */
+    template<typename ValueType>
+    void get(const std::string& name, Vector<ValueType>& vector)
+    {
+        using Type = typename Adios2Type<ValueType>::type;
+        auto variable = io_.InquireVariable<Type>(name);
+        NF_ASSERT(variable, "The variable " + name + " is not stored in the current step.");
+        const auto blocks = engine_.BlocksInfo(variable, engine_.CurrentStep());
+        NF_ASSERT(block_ < blocks.size(), "The variable " + name + " has no block of this rank.");
+        variable.SetBlockSelection(block_);
+        vector.resize(static_cast<localIdx>(blocks[block_].Count[0]));
+        variable.SetMemorySpace(memorySpace(vector.exec()));
+        engine_.Get(variable, reinterpret_cast<Type*>(vector.data()), adios2::Mode::Deferred);
+    }
+
+    /* @brief reads host data, which is available immediately */
+    template<typename ValueType>
+    std::vector<ValueType> get(const std::string& name)
+    {
+        auto variable = io_.InquireVariable<ValueType>(name);
+        NF_ASSERT(variable, "The variable " + name + " is not stored in the current step.");
+        const auto blocks = engine_.BlocksInfo(variable, engine_.CurrentStep());
+        NF_ASSERT(block_ < blocks.size(), "The variable " + name + " has no block of this rank.");
+        variable.SetBlockSelection(block_);
+        std::vector<ValueType> values(blocks[block_].Count[0]);
+        engine_.Get(variable, values.data(), adios2::Mode::Sync);
+        return values;
+    }
+
+    /* @brief reads a mesh written by Adios2Writer::put, this performs the reads of the step */
+    UnstructuredMesh getMesh(const Executor& exec);
+
+private:
+
+    adios2::ADIOS adios_;
+    adios2::IO io_;
+    adios2::Engine engine_;
+    std::size_t block_;
+};
+
+}
+
+#endif
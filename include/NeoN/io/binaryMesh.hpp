@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::io
+{
+
+/* @brief the version of the binary mesh format, files of other versions are rejected */
+inline constexpr std::uint32_t binaryMeshVersion = 1;
+
+/* @brief the alignment of every array in a binary mesh file */
+inline constexpr std::uint64_t binaryMeshAlignment = 64;
+
+/* @brief the file name of the binary mesh of a rank, ie. <baseName>.<rank>.nmesh */
+std::string binaryMeshFileName(const std::string& baseName, std::size_t rank);
+
+/* @brief writes the mesh including its precomputed geometry to a binary file
+ *
+ * The file starts with a header holding a magic number, the format version, the sizes of label
+ * and scalar, the mesh sizes and a table with the offset and size of every array. The arrays
+ * follow in the native byte order, each aligned to binaryMeshAlignment bytes, so that they can
+ * be copied from the mapped file without any conversion. A decomposed mesh is stored as one
+ * file per rank, see binaryMeshFileName.
+ */
+void writeBinaryMesh(const std::string& fileName, const UnstructuredMesh& mesh);
+
+/* @brief reads a mesh written by writeBinaryMesh
+ *
+ * The file is memory mapped and every array is copied directly from the mapped pages into the
+ * memory space of the executor, there is no parsing or conversion of the individual entries.
+ */
+UnstructuredMesh readBinaryMesh(const Executor& exec, const std::string& fileName);
+
+}
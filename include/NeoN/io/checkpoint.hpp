@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NF_WITH_ADIOS2
+
+#include <optional>
+#include <string>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/io/adios2.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::io
+{
+
+/* @brief the settings of the checkpoints */
+struct CheckpointOptions
+{
+    /* @brief the engine settings, the vectors are compressed losslessly by default */
+    Adios2Options io {.compression = "zstd"};
+
+    /* @brief the number of old time levels required for a restart, eg. one for a two level
+     * time scheme, the older levels are not written, a negative number writes all levels
+     */
+    int nOldTimeLevels {-1};
+};
+
+/* @brief the file of the static data, ie. the mesh, of the checkpoints with the prefix */
+std::string checkpointMeshFile(const std::string& prefix);
+
+/* @brief the file of checkpoint slot i of the checkpoints with the prefix */
+std::string checkpointFile(const std::string& prefix, int slot);
+
+/* @class CheckpointWriter
+ * @brief writes the volume fields of a field collection as restart data
+ *
+ * The mesh does not change between checkpoints, hence it is written once on construction.
+ * Stencils and other derived data are not written, they are recomputed from the mesh on demand.
+ * The fields are written alternately to two slots, every checkpoint replaces the older slot and
+ * the write of the previous checkpoint is completed before, thus one complete checkpoint exists
+ * at any time. The writes are asynchronous, see Adios2Options::asyncWrite.
+ *
+ * Every scalar and vector volume field of the collection is written as
+ * <field name>/internal, <field name>/boundary and <field name>/indices, the latter holding the
+ * time index, the iteration index and the old time level, which is zero for a current field.
+ */
+class CheckpointWriter
+{
+public:
+
+#ifdef NF_WITH_MPI_SUPPORT
+    CheckpointWriter(
+        const std::string& prefix,
+        const UnstructuredMesh& mesh,
+        const mpi::MPIEnvironment& mpiEnviron,
+        const CheckpointOptions& options = {}
+    );
+#else
+    CheckpointWriter(
+        const std::string& prefix,
+        const UnstructuredMesh& mesh,
+        const CheckpointOptions& options = {}
+    );
+#endif
+
+    /* @brief writes a checkpoint of the fields of the collection at the given time
+     *
+     * The fields must not be modified until the function returns, afterwards they are copied.
+     */
+    void write(const finiteVolume::cellCentred::VectorCollection& collection, scalar time);
+
+    /* @brief the number of written checkpoints */
+    std::int64_t nCheckpoints() const { return nCheckpoints_; }
+
+private:
+
+    void open(const std::string& fileName, const Adios2Options& options);
+
+    std::string prefix_;
+    CheckpointOptions options_;
+#ifdef NF_WITH_MPI_SUPPORT
+    const mpi::MPIEnvironment& mpiEnviron_;
+#endif
+    std::optional<Adios2Writer> writer_; // the writer of the last checkpoint
+    std::int64_t nCheckpoints_ {0};
+};
+
+/* @class CheckpointReader
+ * @brief restores the fields written by a CheckpointWriter
+ *
+ * The reader selects the latest complete checkpoint of the two slots.
+ */
+class CheckpointReader
+{
+public:
+
+#ifdef NF_WITH_MPI_SUPPORT
+    CheckpointReader(const std::string& prefix, const mpi::MPIEnvironment& mpiEnviron);
+#else
+    explicit CheckpointReader(const std::string& prefix);
+#endif
+
+    /* @brief the time of the selected checkpoint */
+    scalar time() const { return time_; }
+
+    /* @brief reads the mesh of the checkpoints */
+    UnstructuredMesh readMesh(const Executor& exec) const;
+
+    /* @brief restores the registered fields of the collection stored in the checkpoint
+     *
+     * The values are read straight into the memory space of the executor of the fields, the
+     * time and iteration indices of the fields are restored. Fields which are not stored, eg.
+     * old time levels which are not required, keep their values.
+     *
+     * @return the number of restored fields
+     */
+    localIdx restore(finiteVolume::cellCentred::VectorCollection& collection);
+
+private:
+
+    std::string prefix_;
+#ifdef NF_WITH_MPI_SUPPORT
+    const mpi::MPIEnvironment& mpiEnviron_;
+#endif
+    std::optional<Adios2Reader> reader_; // the reader of the selected slot, in its step
+    scalar time_ {0};
+};
+
+}
+
+#endif
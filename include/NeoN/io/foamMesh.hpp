@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/environment.hpp"
+#endif
+
+namespace NeoN::io
+{
+
+/* @brief a boundary patch of an OpenFOAM polyMesh */
+struct FoamPatch
+{
+    std::string name;
+    std::string type;
+    localIdx startFace;
+    localIdx nFaces;
+    /* @brief the neighbouring processor of a processor patch, -1 for all other patches */
+    int neighbProcNo;
+};
+
+/* @brief a mesh read from an OpenFOAM polyMesh and the description of its patches */
+struct FoamMesh
+{
+    UnstructuredMesh mesh;
+    std::vector<FoamPatch> patches;
+};
+
+/* @brief creates a mesh from its faces and computes the geometry on the executor of the points
+ *
+ * The geometry is computed by computeMeshGeometry and computeBoundaryMesh, the same face to
+ * point connectivity moves the points of the mesh later on, see movePoints. The boundary faces
+ * follow the internal faces and are grouped by patch.
+ *
+ * @param points The mesh points.
+ * @param faceOffsets The start of the points of every face in facePoints, of size nFaces + 1.
+ * @param facePoints The points of all faces, ordered such that the area points out of the owner.
+ * @param faceOwner The owner cell of every face.
+ * @param faceNeighbour The neighbour cell of every internal face.
+ * @param nCells The number of cells.
+ * @param boundaryOffsets The first boundary face of every patch and the number of boundary faces.
+ */
+UnstructuredMesh createMeshFromFaces(
+    vectorVector points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    labelVector faceOwner,
+    labelVector faceNeighbour,
+    localIdx nCells,
+    std::vector<localIdx> boundaryOffsets
+);
+
+/* @brief reads the points, faces, owner, neighbour and boundary files of a polyMesh directory
+ *
+ * ASCII and binary files are supported, including labels and scalars of a different width than
+ * label and scalar, compressed files are not. Only the mesh topology and points are read from
+ * the files, the geometry is computed on the executor by createMeshFromFaces.
+ */
+FoamMesh readFoamMesh(const Executor& exec, const std::string& polyMeshDir);
+
+#ifdef NF_WITH_MPI_SUPPORT
+/* @brief reads the mesh of an OpenFOAM case, every rank reads its processor directory
+ *
+ * With more than one rank, rank i reads caseDir/processor<i>/constant/polyMesh, ie. the case
+ * has to be decomposed into as many processors as there are ranks. A single rank reads the
+ * undecomposed mesh from caseDir/constant/polyMesh.
+ */
+FoamMesh readFoamCase(
+    const Executor& exec, const std::string& caseDir, const mpi::MPIEnvironment& mpiEnviron
+);
+#else
+/* @brief reads the undecomposed mesh of an OpenFOAM case from caseDir/constant/polyMesh */
+FoamMesh readFoamCase(const Executor& exec, const std::string& caseDir);
+#endif
+
+}
@@ -11,12 +11,25 @@
 namespace NeoN::la
 {
 
+/**
+ * @brief The index type of the columns of a CSR matrix with row offsets of IndexType.
+ *
+ * The columns of the rank local matrices index rows and are stored as columnIdx, which stays 32 bit
+ * with NeoN_DP_LOCAL_IDX, ie. only the row offsets are 64 bit. Other index types store the
+ * columns as IndexType. The const qualification of IndexType is kept for the const views.
+ */
+template<typename IndexType>
+using CSRColumnIdx = std::conditional_t<
+    std::is_same_v<std::remove_const_t<IndexType>, localIdx>,
+    std::conditional_t<std::is_const_v<IndexType>, const columnIdx, columnIdx>,
+    IndexType>;
+
 /**
  * @struct CSRMatrixView
  * @brief A view struct to allow easy read/write on all executors.
  *
  * @tparam ValueType The value type of the non-zero entries.
- * @tparam IndexType The index type of the rows and columns.
+ * @tparam IndexType The index type of the row offsets, see CSRColumnIdx for the columns.
  */
 template<typename ValueType, typename IndexType>
 struct CSRMatrixView
@@ -29,7 +42,7 @@ struct CSRMatrixView
      */
     CSRMatrixView(
         const View<ValueType>& valueView,
-        const View<IndexType>& colIdxsView,
+        const View<CSRColumnIdx<IndexType>>& colIdxsView,
         const View<IndexType>& rowOffsView
     )
         : values(valueView), colIdxs(colIdxsView), rowOffs(rowOffsView) {};
@@ -70,16 +83,16 @@ struct CSRMatrixView
     KOKKOS_INLINE_FUNCTION
     ValueType& entry(const IndexType offset) const { return values[offset]; }
 
-    View<ValueType> values;  //!< View to the values of the CSR matrix.
-    View<IndexType> colIdxs; //!< View to the column indices of the CSR matrix.
-    View<IndexType> rowOffs; //!< View to the row offsets for the CSR matrix.
+    View<ValueType> values;                //!< View to the values of the CSR matrix.
+    View<CSRColumnIdx<IndexType>> colIdxs; //!< View to the column indices of the CSR matrix.
+    View<IndexType> rowOffs;               //!< View to the row offsets for the CSR matrix.
 };
 
 /**
  * @class CSRMatrix
  * @brief Sparse matrix class with compact storage by row (CSR) format.
  * @tparam ValueType The value type of the non-zero entries.
- * @tparam IndexType The index type of the rows and columns.
+ * @tparam IndexType The index type of the row offsets, see CSRColumnIdx for the columns.
  */
 template<typename ValueType, typename IndexType>
 class CSRMatrix
@@ -87,6 +100,8 @@ class CSRMatrix
 
 public:
 
+    using ColumnIdxType = CSRColumnIdx<IndexType>;
+
     /**
      * @brief Constructor for CSRMatrix.
      * @param values The non-zero values of the matrix.
@@ -95,7 +110,7 @@ public:
      */
     CSRMatrix(
         const Vector<ValueType>& values,
-        const Vector<IndexType>& colIdxs,
+        const Vector<ColumnIdxType>& colIdxs,
         const Vector<IndexType>& rowOffs
     )
         : values_(values), colIdxs_(colIdxs), rowOffs_(rowOffs)
@@ -143,7 +158,7 @@ public:
      * @brief Get a reference to column indices vector.
      * @return Vector containing the column indices.
      */
-    [[nodiscard]] Vector<IndexType>& colIdxs() { return colIdxs_; }
+    [[nodiscard]] Vector<ColumnIdxType>& colIdxs() { return colIdxs_; }
 
     /**
      * @brief Get a reference to row offset vector.
@@ -161,7 +176,7 @@ public:
      * @brief Get a const reference to column indices vector.
      * @return Const vector containing the column indices.
      */
-    [[nodiscard]] const Vector<IndexType>& colIdxs() const { return colIdxs_; }
+    [[nodiscard]] const Vector<ColumnIdxType>& colIdxs() const { return colIdxs_; }
 
     /**
      * @brief Get a const reference to row offset vector.
@@ -169,6 +184,15 @@ public:
      */
     [[nodiscard]] const Vector<IndexType>& rowOffs() const { return rowOffs_; }
 
+    /**
+     * @brief Get the bytes allocated by the values, column indices and row offsets.
+     * @return The allocated bytes.
+     */
+    [[nodiscard]] std::size_t memoryBytes() const
+    {
+        return values_.memoryBytes() + colIdxs_.memoryBytes() + rowOffs_.memoryBytes();
+    }
+
     /**
      * @brief Copy the matrix to another executor.
      * @param dstExec The destination executor.
@@ -215,9 +239,9 @@ public:
 
 private:
 
-    Vector<ValueType> values_;  //!< The (non-zero) values of the CSR matrix.
-    Vector<IndexType> colIdxs_; //!< The column indices of the CSR matrix.
-    Vector<IndexType> rowOffs_; //!< The row offsets for the CSR matrix.
+    Vector<ValueType> values_;      //!< The (non-zero) values of the CSR matrix.
+    Vector<ColumnIdxType> colIdxs_; //!< The column indices of the CSR matrix.
+    Vector<IndexType> rowOffs_;     //!< The row offsets for the CSR matrix.
 };
 
 // /* @brief given a csr matrix this function copies the matrix and converts to requested target
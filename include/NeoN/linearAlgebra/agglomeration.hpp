@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/memoryReport.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::la
+{
+
+/* @brief pairs every row with its unpaired neighbour of the largest weight
+ *
+ * The rows are visited in order. A row without unpaired neighbours joins the aggregate of its
+ * neighbour with the largest weight and only isolated rows form an aggregate on their own.
+ * Runs on the host.
+ *
+ * @param rowOffs, the row offsets of the graph
+ * @param colIdxs, the neighbours of every row, the row itself is ignored
+ * @param weights, the weight of every edge
+ * @return the aggregate of every row, the aggregates are numbered consecutively
+ */
+std::vector<localIdx> pairwiseAggregation(
+    const std::vector<localIdx>& rowOffs,
+    const std::vector<localIdx>& colIdxs,
+    const std::vector<scalar>& weights
+);
+
+/* @class FaceAgglomeration
+ * @brief the cell aggregates of the levels of a geometric multigrid
+ *
+ * The first level pairs every cell with the neighbour across its largest internal face. Every
+ * further level pairs the aggregates of the previous level, where the faces between two
+ * aggregates are weighted by the sum of their areas, similar to the pair agglomeration of
+ * OpenFOAM's GAMG. The agglomeration only depends on the mesh and is built once on the host.
+ */
+class FaceAgglomeration
+{
+public:
+
+    FaceAgglomeration(const UnstructuredMesh& mesh);
+
+    /* @brief the number of agglomeration levels, ie. coarse levels */
+    localIdx nLevels() const { return static_cast<localIdx>(aggregates_.size()); }
+
+    /* @brief the aggregate of every cell for the first level, or of every aggregate of the
+     * previous level otherwise
+     */
+    const std::vector<localIdx>& aggregates(localIdx leveli) const
+    {
+        return aggregates_[static_cast<std::size_t>(leveli)];
+    }
+
+    /* @brief returns the agglomeration of the mesh, computed on first access and stored in the
+     * stencil database of the mesh
+     */
+    static const FaceAgglomeration& readOrCreate(const UnstructuredMesh& mesh);
+
+    /* @brief the bytes of the aggregates of all levels */
+    std::size_t memoryBytes() const { return NeoN::memoryBytes(aggregates_); }
+
+private:
+
+    std::vector<std::vector<localIdx>> aggregates_;
+};
+
+}
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/core/vector/vector.hpp"
+
+namespace NeoN::la
+{
+
+/* @class BatchedDenseSystems
+ * @brief a batch of small independent dense systems A_i x_i = b_i, eg. one system per cell
+ *
+ * The matrices and right hand sides are stored as segmented vectors with one segment per
+ * system. The matrix of system i with n_i unknowns occupies n_i * n_i consecutive values in row
+ * major order, its right hand side n_i values. All systems live on the executor of the sizes, so
+ * models can assemble them with a single kernel over the cells.
+ */
+class BatchedDenseSystems
+{
+public:
+
+    /* @brief allocates the systems with the given number of unknowns, initialised to zero
+     *
+     * @param sizes, the number of unknowns of every system
+     */
+    BatchedDenseSystems(const Vector<localIdx>& sizes);
+
+    /* @brief allocates nSystems systems with size unknowns each, initialised to zero */
+    BatchedDenseSystems(const Executor& exec, localIdx nSystems, localIdx size);
+
+    const Executor& exec() const { return sizes_.exec(); }
+
+    localIdx nSystems() const { return sizes_.size(); }
+
+    const Vector<localIdx>& sizes() const { return sizes_; }
+
+    /* @brief the row major matrices, one segment per system */
+    SegmentedVector<scalar, localIdx>& matrices() { return matrices_; }
+
+    const SegmentedVector<scalar, localIdx>& matrices() const { return matrices_; }
+
+    /* @brief the right hand sides, one segment per system */
+    SegmentedVector<scalar, localIdx>& rhs() { return rhs_; }
+
+    const SegmentedVector<scalar, localIdx>& rhs() const { return rhs_; }
+
+    /* @brief creates a solution vector with the segments of the right hand sides */
+    SegmentedVector<scalar, localIdx> createSolution() const;
+
+private:
+
+    Vector<localIdx> sizes_;
+
+    SegmentedVector<scalar, localIdx> matrices_;
+
+    SegmentedVector<scalar, localIdx> rhs_;
+};
+
+/* @brief solves all systems of the batch with a single kernel launch
+ *
+ * Every system is solved by Gaussian elimination with partial pivoting by one thread, which
+ * keeps the whole elimination of the small system in the registers and caches of the thread
+ * and requires no synchronisation. The right hand side is eliminated together with the matrix,
+ * hence the matrices are overwritten by their upper triangular factors while the right hand
+ * sides are kept.
+ *
+ * @param systems, the batch, the matrices are overwritten
+ * @param x, the solutions with the segments of the right hand sides, see createSolution
+ * @param pivotTol, pivots with an absolute value below pivotTol times the largest entry of the
+ * matrix mark the system as singular, its solution is set to zero
+ * @return the number of singular systems
+ */
+localIdx
+solveBatchedLU(BatchedDenseSystems& systems, SegmentedVector<scalar, localIdx>& x, scalar pivotTol);
+
+/* @brief solves all systems with the default pivot tolerance of 1e-14 */
+localIdx solveBatchedLU(BatchedDenseSystems& systems, SegmentedVector<scalar, localIdx>& x);
+
+/* @brief factorises a small dense matrix in place by Gaussian elimination with partial pivoting
+ *
+ * The function is called by a single thread inside a kernel, eg. one thread per system of a
+ * batch, the matrix is typically held in the local memory of the thread. The factors are used by
+ * solveDenseLU, hence one factorisation serves several right hand sides.
+ *
+ * @param n, the number of unknowns
+ * @param a, the row major n x n matrix, overwritten by its L and U factors
+ * @param perm, the n row swaps of the elimination
+ * @param pivotTol, pivots with an absolute value below pivotTol times the largest entry of the
+ * matrix mark the matrix as singular
+ * @return false if the matrix is singular
+ */
+KOKKOS_INLINE_FUNCTION
+bool factorizeDenseLU(const localIdx n, scalar* a, localIdx* perm, const scalar pivotTol)
+{
+    scalar maxEntry = 0.0;
+    for (localIdx i = 0; i < n * n; i++)
+    {
+        const scalar entry = Kokkos::abs(a[i]);
+        maxEntry = entry > maxEntry ? entry : maxEntry;
+    }
+    for (localIdx k = 0; k < n; k++)
+    {
+        localIdx pivot = k;
+        for (localIdx row = k + 1; row < n; row++)
+        {
+            if (Kokkos::abs(a[row * n + k]) > Kokkos::abs(a[pivot * n + k]))
+            {
+                pivot = row;
+            }
+        }
+        perm[k] = pivot;
+        if (Kokkos::abs(a[pivot * n + k]) <= pivotTol * maxEntry)
+        {
+            return false;
+        }
+        if (pivot != k)
+        {
+            for (localIdx col = 0; col < n; col++)
+            {
+                const scalar tmp = a[k * n + col];
+                a[k * n + col] = a[pivot * n + col];
+                a[pivot * n + col] = tmp;
+            }
+        }
+        const scalar invPivot = 1.0 / a[k * n + k];
+        for (localIdx row = k + 1; row < n; row++)
+        {
+            const scalar factor = a[row * n + k] * invPivot;
+            a[row * n + k] = factor;
+            for (localIdx col = k + 1; col < n; col++)
+            {
+                a[row * n + col] -= factor * a[k * n + col];
+            }
+        }
+    }
+    return true;
+}
+
+/* @brief solves with the factors of factorizeDenseLU, b is overwritten by the solution */
+KOKKOS_INLINE_FUNCTION
+void solveDenseLU(const localIdx n, const scalar* a, const localIdx* perm, scalar* b)
+{
+    // the rows of the factors are swapped by all later steps, hence all swaps come first
+    for (localIdx k = 0; k < n; k++)
+    {
+        const scalar tmp = b[k];
+        b[k] = b[perm[k]];
+        b[perm[k]] = tmp;
+    }
+    for (localIdx k = 0; k < n; k++)
+    {
+        for (localIdx row = k + 1; row < n; row++)
+        {
+            b[row] -= a[row * n + k] * b[k];
+        }
+    }
+    for (localIdx row = n; row-- > 0;)
+    {
+        scalar sum = b[row];
+        for (localIdx col = row + 1; col < n; col++)
+        {
+            sum -= a[row * n + col] * b[col];
+        }
+        b[row] = sum / a[row * n + row];
+    }
+}
+
+}
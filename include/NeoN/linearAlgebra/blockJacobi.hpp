@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/CSRMatrix.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+
+namespace NeoN::la
+{
+
+/* @brief the offsets of blocks of blockSize consecutive rows, the last block may be smaller
+ *
+ * For the system of a mesh block b holds the cells [b * blockSize, (b + 1) * blockSize), the
+ * blocks of consecutive cells of FaceBlocking with a size suited for a dense factorization. A
+ * bandwidth reducing renumbering of the mesh, see renumberMesh, keeps the cells of a block close.
+ *
+ * @param exec, the executor of the offsets
+ * @param nRows, the number of rows
+ * @param blockSize, the number of rows per block
+ * @return the offsets, block b spans [offsets[b], offsets[b + 1])
+ */
+Vector<localIdx> uniformBlockOffsets(const Executor& exec, localIdx nRows, localIdx blockSize);
+
+/* @class BlockJacobiPreconditioner
+ * @brief the inverse of the diagonal blocks of a matrix as dense LU factors
+ *
+ * Every block is factored with partial pivoting by one thread, the entries coupling different
+ * blocks are ignored. A zero pivot is replaced by one, as a zero diagonal by the Jacobi
+ * preconditioner of Krylov. The factors are stored with a stride of blockSize^2 per block. The
+ * blocks are a middle ground between the Jacobi preconditioner, which is a block size of one,
+ * and the incomplete factorizations, which are sequential.
+ */
+class BlockJacobiPreconditioner
+{
+public:
+
+    /* @brief the largest supported block size, which is also the limit of Ginkgo's Jacobi */
+    static constexpr localIdx maxBlockSize = 32;
+
+    /* @param exec, the executor of the factors
+     * @param nRows, the number of rows of the matrix
+     * @param blockSize, the number of rows per block, see uniformBlockOffsets
+     */
+    BlockJacobiPreconditioner(const Executor& exec, localIdx nRows, localIdx blockSize);
+
+    /* @brief factors the diagonal blocks of the matrix, ie. once per refresh of its values */
+    void factorize(const CSRMatrix<scalar, localIdx>& mtx);
+
+    /* @brief computes y = M^-1 x, all blocks are solved in parallel */
+    void apply(const Vector<scalar>& x, Vector<scalar>& y) const;
+
+    localIdx nRows() const { return nRows_; }
+
+    localIdx blockSize() const { return blockSize_; }
+
+    localIdx nBlocks() const { return blockOffsets_.size() - 1; }
+
+    const Vector<localIdx>& blockOffsets() const { return blockOffsets_; }
+
+    std::size_t memoryBytes() const
+    {
+        return blockOffsets_.memoryBytes() + factors_.memoryBytes() + pivots_.memoryBytes();
+    }
+
+private:
+
+    localIdx nRows_;
+
+    localIdx blockSize_;
+
+    Vector<localIdx> blockOffsets_;
+
+    Vector<scalar> factors_; // the row major LU factors of block b start at b * blockSize^2
+
+    Vector<localIdx> pivots_; // the row swapped with row i of a block during the factorization
+};
+
+/* @class BlockJacobi
+ * @brief a native block Jacobi solver and preconditioned conjugate gradient method
+ *
+ * The diagonal blocks are factored on every solve, since the matrix values are expected to
+ * change between solves, the storage is kept as long as the matrix has the same size. The
+ * solver dictionary understands:
+ *  - blockSize: the number of consecutive rows per block, at most 32 (default 16)
+ *  - krylov: cg to precondition a conjugate gradient method, or none to iterate
+ *    x += M^-1 (b - A x) (default cg). The conjugate gradient method requires a symmetric
+ *    matrix, for which the blocks and their inverses are symmetric too.
+ *  - maxIters: the maximum number of iterations (default 1000)
+ *  - relTol: the residual norm reduction at which the solve stops (default 1e-6)
+ *  - absTol: the residual norm at which the solve stops (default 0)
+ *
+ * The same blocks can be used by the Jacobi preconditioner of Ginkgo, see the blockJacobi key
+ * of GinkgoSolver.
+ */
+class BlockJacobi : public SolverFactory::template Register<BlockJacobi>
+{
+    using Base = SolverFactory::template Register<BlockJacobi>;
+
+public:
+
+    BlockJacobi(const Executor& exec, const Dictionary& solverConfig);
+
+    static std::string name() { return "BlockJacobi"; }
+
+    static std::string doc() { return "Block Jacobi with dense blocks of consecutive rows"; }
+
+    static std::string schema() { return "none"; }
+
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final;
+
+    using Base::solve;
+
+    virtual std::unique_ptr<SolverFactory> clone() const final
+    {
+        return std::make_unique<BlockJacobi>(*this);
+    }
+
+    /* @brief the preconditioner of the last solve, nullptr before the first solve */
+    const BlockJacobiPreconditioner* preconditioner() const
+    {
+        return preconditioner_ ? &*preconditioner_ : nullptr;
+    }
+
+    virtual std::size_t memoryBytes() const final
+    {
+        return preconditioner_ ? preconditioner_->memoryBytes() : 0;
+    }
+
+private:
+
+    localIdx blockSize_;
+    bool useCG_;
+    int maxIters_;
+    scalar relTol_;
+    scalar absTol_;
+
+    mutable std::optional<BlockJacobiPreconditioner> preconditioner_ {std::nullopt};
+};
+
+}
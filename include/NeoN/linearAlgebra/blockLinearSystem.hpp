@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+
+namespace NeoN::la
+{
+
+/* @brief creates a zero initialised scalar linear system with the sparsity of a Vec3 system
+ *
+ * A LinearSystem<Vec3, localIdx> stores a diagonal 3x3 block per matrix entry, hence every
+ * component forms a scalar system with the same sparsity. The returned system can be reused for
+ * all components via extractComponent.
+ */
+LinearSystem<scalar, localIdx> createComponentSystem(const LinearSystem<Vec3, localIdx>& ls);
+
+/* @brief copies the matrix values and rhs of one component into a scalar system
+ *
+ * @param[in] ls, the Vec3 linear system
+ * @param[in] cmpt, the component to copy
+ * @param[out] cmptLs, a system with the sparsity of ls, eg. created by createComponentSystem
+ */
+void extractComponent(
+    const LinearSystem<Vec3, localIdx>& ls, localIdx cmpt, LinearSystem<scalar, localIdx>& cmptLs
+);
+
+/* @brief copies one component of a Vec3 vector into a scalar vector */
+void extractComponent(const Vector<Vec3>& in, localIdx cmpt, Vector<scalar>& out);
+
+/* @brief copies a scalar vector into one component of a Vec3 vector */
+void insertComponent(const Vector<scalar>& in, localIdx cmpt, Vector<Vec3>& out);
+
+/* @brief creates the coupled scalar system of a Vec3 system
+ *
+ * Every row of the Vec3 system is expanded into three rows with interleaved unknowns, ie. the
+ * component d of cell i becomes the unknown 3 * i + d, which matches the memory layout of a
+ * Vector<Vec3>. Since the blocks are diagonal, row 3 * i + d only couples to the columns
+ * 3 * j + d of the neighbours j.
+ */
+LinearSystem<scalar, localIdx> createCoupledSystem(const LinearSystem<Vec3, localIdx>& ls);
+
+/* @brief copies a Vec3 vector into a scalar vector with interleaved components */
+void interleave(const Vector<Vec3>& in, Vector<scalar>& out);
+
+/* @brief copies a scalar vector with interleaved components into a Vec3 vector */
+void deinterleave(const Vector<scalar>& in, Vector<Vec3>& out);
+
+}
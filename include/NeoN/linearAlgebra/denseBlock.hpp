@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/vector/vector.hpp"
+
+namespace NeoN::la
+{
+
+/* @class DenseBlock
+ * @brief a dense block of nRows x nCols values, eg. several right hand sides of one matrix
+ *
+ * The values are stored row major, ie. the columns of a row are consecutive, which is the layout
+ * of gko::matrix::Dense. A product of the matrix with the block thus reads every matrix entry
+ * once for all columns.
+ */
+class DenseBlock
+{
+public:
+
+    DenseBlock(const Executor& exec, localIdx nRows, localIdx nCols, scalar value = 0.0)
+        : nRows_(nRows), nCols_(nCols), values_(exec, nRows * nCols, value)
+    {}
+
+    [[nodiscard]] const Executor& exec() const { return values_.exec(); }
+
+    [[nodiscard]] localIdx nRows() const { return nRows_; }
+
+    [[nodiscard]] localIdx nCols() const { return nCols_; }
+
+    /* @brief the values, the value of row i and column j is stored at i * nCols + j */
+    [[nodiscard]] Vector<scalar>& values() { return values_; }
+
+    [[nodiscard]] const Vector<scalar>& values() const { return values_; }
+
+    /* @brief copies the values of column j into column, which is resized to nRows */
+    void getColumn(localIdx j, Vector<scalar>& column) const;
+
+    /* @brief sets the values of column j from column, which must have nRows values */
+    void setColumn(localIdx j, const Vector<scalar>& column);
+
+private:
+
+    localIdx nRows_;
+
+    localIdx nCols_;
+
+    Vector<scalar> values_;
+};
+
+} // namespace NeoN::la
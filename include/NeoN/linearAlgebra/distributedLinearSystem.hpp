@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+#include <vector>
+
+#include "NeoN/core/mpi/environment.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/mesh/unstructured/communicator.hpp"
+
+namespace NeoN::la
+{
+
+/* @class GlobalRowNumbering
+ * @brief contiguous global numbering of the rows of a distributed linear system
+ *
+ * The ranks own consecutive blocks of rows in rank order, ie. rank r owns the global rows
+ * [rankOffsets()[r], rankOffsets()[r + 1]) and the local row i is the global row
+ * rowOffset() + i.
+ */
+class GlobalRowNumbering
+{
+public:
+
+    /* @brief gathers the number of local rows of all ranks, this is a collective operation */
+    GlobalRowNumbering(const mpi::MPIEnvironment& mpiEnviron, localIdx nLocalRows);
+
+    /* @brief the first global row of this rank */
+    [[nodiscard]] globalIdx rowOffset() const { return rankOffsets_[rank_]; }
+
+    [[nodiscard]] localIdx nLocalRows() const
+    {
+        return static_cast<localIdx>(rankOffsets_[rank_ + 1] - rankOffsets_[rank_]);
+    }
+
+    [[nodiscard]] globalIdx nGlobalRows() const { return rankOffsets_.back(); }
+
+    /* @brief the first global row of every rank and the total number of rows */
+    [[nodiscard]] const std::vector<globalIdx>& rankOffsets() const { return rankOffsets_; }
+
+private:
+
+    size_t rank_;
+
+    std::vector<globalIdx> rankOffsets_;
+};
+
+/* @brief computes the global index of the off-process cells of the halo
+ *
+ * The global row index of every local cell is sent with the communicator, hence the value
+ * received at the halo position haloIdxs[i] is the global index of the coupled cell on the
+ * neighbouring rank.
+ *
+ * @param comm, the communicator whose receive map contains the halo positions
+ * @param numbering, the global numbering of the local cells
+ * @param haloIdxs, the halo positions to return the global index of
+ * @param haloSize, the size of the communicated field, ie. the local cells and the halo
+ * @return the global index of every halo position of haloIdxs
+ */
+Vector<globalIdx> exchangeGlobalIdxs(
+    Communicator& comm,
+    const GlobalRowNumbering& numbering,
+    const Vector<localIdx>& haloIdxs,
+    localIdx haloSize
+);
+
+/* @class DistributedLinearSystem
+ * @brief the rank-local part of a linear system distributed over several ranks
+ *
+ * The local system couples the locally owned rows with local numbering. Couplings to rows owned
+ * by other ranks, eg. across processor boundaries, are stored as interface coefficients, ie. the
+ * coefficient interfaceValues[i] of the local row interfaceRows[i] and the global column
+ * interfaceCols[i]. The interface values are set by the assembly of the processor boundaries.
+ */
+template<typename ValueType, typename IndexType>
+class DistributedLinearSystem
+{
+public:
+
+    DistributedLinearSystem(
+        const LinearSystem<ValueType, IndexType>& localSystem,
+        const GlobalRowNumbering& numbering,
+        const Vector<IndexType>& interfaceRows,
+        const Vector<globalIdx>& interfaceCols,
+        const mpi::MPIEnvironment& mpiEnviron
+    )
+        : localSystem_(localSystem), numbering_(numbering), interfaceRows_(interfaceRows),
+          interfaceCols_(interfaceCols),
+          interfaceValues_(localSystem.exec(), interfaceRows.size(), zero<ValueType>()),
+          mpiEnviron_(mpiEnviron)
+    {
+        NF_ASSERT(localSystem.exec() == interfaceRows.exec(), "Executors are not the same");
+        NF_ASSERT(localSystem.exec() == interfaceCols.exec(), "Executors are not the same");
+        NF_ASSERT_EQUAL(interfaceRows.size(), interfaceCols.size());
+        NF_ASSERT_EQUAL(localSystem.rhs().size(), numbering.nLocalRows());
+    }
+
+    [[nodiscard]] LinearSystem<ValueType, IndexType>& localSystem() { return localSystem_; }
+
+    [[nodiscard]] const LinearSystem<ValueType, IndexType>& localSystem() const
+    {
+        return localSystem_;
+    }
+
+    [[nodiscard]] const GlobalRowNumbering& numbering() const { return numbering_; }
+
+    [[nodiscard]] const Vector<IndexType>& interfaceRows() const { return interfaceRows_; }
+
+    [[nodiscard]] const Vector<globalIdx>& interfaceCols() const { return interfaceCols_; }
+
+    [[nodiscard]] Vector<ValueType>& interfaceValues() { return interfaceValues_; }
+
+    [[nodiscard]] const Vector<ValueType>& interfaceValues() const { return interfaceValues_; }
+
+    [[nodiscard]] const mpi::MPIEnvironment& mpiEnvironment() const { return mpiEnviron_; }
+
+    [[nodiscard]] const Executor& exec() const { return localSystem_.exec(); }
+
+    /* @brief the number of stored local and interface coefficients */
+    [[nodiscard]] localIdx nCOOEntries() const
+    {
+        return localSystem_.matrix().values().size() + interfaceRows_.size();
+    }
+
+    /* @brief zeros the local and interface values, the structure is kept */
+    void resetValues()
+    {
+        localSystem_.resetValues();
+        fill(interfaceValues_, zero<ValueType>());
+    }
+
+    /* @brief computes the global row and column index of every local and interface coefficient
+     *
+     * The local coefficients come first in CSR order, followed by the interface coefficients,
+     * which is the order of cooValues.
+     */
+    void globalCOOIdxs(Vector<globalIdx>& rows, Vector<globalIdx>& cols) const
+    {
+        const auto nLocal = localSystem_.matrix().values().size();
+        rows.resize(nCOOEntries());
+        cols.resize(nCOOEntries());
+        const auto offset = numbering_.rowOffset();
+        const auto [colIdxs, rowOffs] =
+            views(localSystem_.matrix().colIdxs(), localSystem_.matrix().rowOffs());
+        const auto [ifRows, ifCols] = views(interfaceRows_, interfaceCols_);
+        auto [cooRows, cooCols] = views(rows, cols);
+
+        parallelFor(
+            exec(),
+            {0, localSystem_.rhs().size()},
+            KOKKOS_LAMBDA(const localIdx rowi) {
+                for (auto j = rowOffs[rowi]; j < rowOffs[rowi + 1]; j++)
+                {
+                    cooRows[j] = offset + static_cast<globalIdx>(rowi);
+                    cooCols[j] = offset + static_cast<globalIdx>(colIdxs[j]);
+                }
+            },
+            "globalCOOLocalIdxs"
+        );
+        parallelFor(
+            exec(),
+            {0, interfaceRows_.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                cooRows[nLocal + i] = offset + static_cast<globalIdx>(ifRows[i]);
+                cooCols[nLocal + i] = ifCols[i];
+            },
+            "globalCOOInterfaceIdxs"
+        );
+    }
+
+    /* @brief copies the local and interface values in the order of globalCOOIdxs */
+    void cooValues(Vector<ValueType>& values) const
+    {
+        const auto nLocal = localSystem_.matrix().values().size();
+        values.resize(nCOOEntries());
+        const auto [localValues, ifValues] =
+            views(localSystem_.matrix().values(), interfaceValues_);
+        auto cooValues = values.view();
+
+        parallelFor(
+            exec(),
+            {0, values.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                cooValues[i] = i < nLocal ? localValues[i] : ifValues[i - nLocal];
+            },
+            "cooValues"
+        );
+    }
+
+private:
+
+    LinearSystem<ValueType, IndexType> localSystem_;
+    GlobalRowNumbering numbering_;
+    Vector<IndexType> interfaceRows_;
+    Vector<globalIdx> interfaceCols_;
+    Vector<ValueType> interfaceValues_;
+    mpi::MPIEnvironment mpiEnviron_;
+};
+
+}
+
+#endif
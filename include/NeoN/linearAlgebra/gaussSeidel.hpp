@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/memoryReport.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/CSRMatrix.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+
+namespace NeoN::la
+{
+
+/* @struct MatrixColoring
+ * @brief the rows of a matrix grouped by colors, rows of the same color are not coupled
+ *
+ * The rows of a color can be updated in parallel by a Gauss-Seidel sweep, hence a sweep
+ * requires one kernel launch per color.
+ */
+struct MatrixColoring
+{
+    Vector<localIdx> rows; // the rows grouped by color
+
+    std::vector<localIdx> offsets; // host offsets, color c spans [offsets[c], offsets[c+1])
+
+    localIdx nColors() const { return static_cast<localIdx>(offsets.size()) - 1; }
+
+    std::size_t memoryBytes() const { return rows.memoryBytes() + NeoN::memoryBytes(offsets); }
+
+    /* @brief colors the sparsity pattern of the mesh once and stores it in its stencil database
+     */
+    static const MatrixColoring& readOrCreate(const UnstructuredMesh& mesh);
+};
+
+/* @brief greedy coloring of the rows, each row gets the lowest color not used by a neighbour
+ *
+ * The coloring is computed on the host, the rows reside on the executor of rowOffs.
+ *
+ * @param rowOffs, the row offsets of the matrix graph
+ * @param colIdxs, the column indices of the matrix graph
+ */
+MatrixColoring createColoring(const Vector<localIdx>& rowOffs, const Vector<columnIdx>& colIdxs);
+
+/* @brief colors the graph of a sparsity pattern */
+MatrixColoring createColoring(const SparsityPattern& sparsity);
+
+/* @brief colors the graph of a matrix */
+MatrixColoring createColoring(const CSRMatrix<scalar, localIdx>& mtx);
+
+/* @brief returns the position of the diagonal entry of every row in the values of mtx
+ *
+ * Every row needs to have a diagonal entry.
+ */
+Vector<localIdx> diagonalIndices(const CSRMatrix<scalar, localIdx>& mtx);
+
+/* @brief the order in which a Gauss-Seidel sweep runs through the colors */
+enum class SweepDirection
+{
+    Forward,  /**< From the first to the last color. */
+    Backward, /**< From the last to the first color. */
+    Symmetric /**< A forward followed by a backward pass. */
+};
+
+/* @brief applies multicolor Gauss-Seidel or SOR sweeps to mtx x = rhs
+ *
+ * Every row of a color is updated to x_i = (1 - w) x_i + w (rhs_i - sum_j!=i a_ij x_j) / a_ii
+ * with the relaxation factor w, w = 1 yields Gauss-Seidel. A symmetric sweep with zero initial
+ * guess is a symmetric operator for symmetric matrices and can precondition a conjugate gradient
+ * method.
+ *
+ * @param diagIdxs, the positions of the diagonal entries, see diagonalIndices
+ * @param coloring, a coloring of the graph of mtx
+ * @param sweeps, the number of sweeps, a symmetric sweep counts as one sweep
+ */
+void gaussSeidelSweeps(
+    const CSRMatrix<scalar, localIdx>& mtx,
+    const Vector<localIdx>& diagIdxs,
+    const MatrixColoring& coloring,
+    const Vector<scalar>& rhs,
+    Vector<scalar>& x,
+    int sweeps,
+    SweepDirection direction,
+    scalar relaxation
+);
+
+/* @class GaussSeidel
+ * @brief a native multicolor Gauss-Seidel and SOR solver
+ *
+ * The coloring is computed on the first solve and kept as long as the matrix has the same size
+ * and number of entries. If the mesh is given in the auxiliary coefficients of the system, see
+ * createEmptyLinearSystem, the coloring of MatrixColoring::readOrCreate is used. The solver
+ * dictionary understands:
+ *  - sweep: forward, backward or symmetric (default symmetric)
+ *  - relaxation: the relaxation factor, values larger than one yield SOR (default 1)
+ *  - krylov: cg to precondition a conjugate gradient method with one symmetric sweep, or none
+ *    to iterate the sweeps (default none). The conjugate gradient method requires a symmetric
+ *    matrix and a symmetric sweep.
+ *  - maxIters: the maximum number of iterations (default 100)
+ *  - relTol: the residual norm reduction at which the solve stops (default 1e-6)
+ *  - absTol: the residual norm at which the solve stops (default 0)
+ */
+class GaussSeidel : public SolverFactory::template Register<GaussSeidel>
+{
+    using Base = SolverFactory::template Register<GaussSeidel>;
+
+public:
+
+    GaussSeidel(const Executor& exec, const Dictionary& solverConfig);
+
+    static std::string name() { return "GaussSeidel"; }
+
+    static std::string doc() { return "Multicolor Gauss-Seidel and SOR"; }
+
+    static std::string schema() { return "none"; }
+
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final;
+
+    using Base::solve;
+
+    virtual std::unique_ptr<SolverFactory> clone() const final
+    {
+        return std::make_unique<GaussSeidel>(*this);
+    }
+
+    /* @brief the coloring of the last solve, nullptr before the first solve */
+    const MatrixColoring* coloring() const { return coloring_ ? &*coloring_ : nullptr; }
+
+    virtual std::size_t memoryBytes() const final
+    {
+        return NeoN::memoryBytes(coloring_) + diagIdxs_.memoryBytes();
+    }
+
+private:
+
+    /* @brief colors the matrix of the system unless the coloring matches its size */
+    void updateColoring(const LinearSystem<scalar, localIdx>& sys) const;
+
+    SweepDirection direction_;
+    scalar relaxation_;
+    bool useCG_;
+    int maxIters_;
+    scalar relTol_;
+    scalar absTol_;
+
+    mutable std::optional<MatrixColoring> coloring_ {std::nullopt};
+    mutable Vector<localIdx> diagIdxs_;
+    mutable localIdx nNonZeros_ {0};
+};
+
+}
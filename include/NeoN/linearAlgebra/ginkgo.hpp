@@ -6,7 +6,9 @@
 
 #if NF_WITH_GINKGO
 
-#include <chrono>
+
+#include <algorithm>
+#include <cmath>
 
 #include <ginkgo/ginkgo.hpp>
 #include <ginkgo/extensions/kokkos.hpp>
@@ -15,14 +17,26 @@
 #include "NeoN/fields/field.hpp"
 #include "NeoN/core/dictionary.hpp"
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/linearAlgebra/blockJacobi.hpp"
 #include "NeoN/linearAlgebra/solver.hpp"
+#include "NeoN/linearAlgebra/linearOperator.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/linearAlgebra/utilities.hpp"
 
+#if defined(NF_WITH_MPI_SUPPORT) && GINKGO_BUILD_MPI
+#define NF_WITH_GINKGO_MPI 1
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
+#endif
+
 
 namespace NeoN::la::ginkgo
 {
 
+/* @brief returns the Ginkgo executor of the executor
+ *
+ * The Ginkgo executors are shared by all callers and created on first use. On GPUs the Ginkgo
+ * executor enqueues its work on the stream of the Kokkos instance of the executor.
+ */
 std::shared_ptr<gko::Executor> getGkoExecutor(Executor exec);
 
 namespace detail
@@ -56,11 +70,22 @@ std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>> createGkoMtx(
         const_cast<ValueType*>(mtx.values.data())
     );
     // auto col = createGkoArray(exec, mtx.colIdxs);
-    auto col = gko::array<IndexType>::view(
-        exec,
-        static_cast<gko::size_type>(mtx.colIdxs.size()),
-        const_cast<IndexType*>(mtx.colIdxs.data())
+    using ColumnIdxType = CSRColumnIdx<IndexType>;
+    auto nnz = static_cast<gko::size_type>(mtx.colIdxs.size());
+    auto colView = gko::array<ColumnIdxType>::view(
+        exec, nnz, const_cast<ColumnIdxType*>(mtx.colIdxs.data())
     );
+    gko::array<IndexType> col(exec);
+    if constexpr (std::is_same_v<ColumnIdxType, IndexType>)
+    {
+        col = std::move(colView);
+    }
+    else
+    {
+        // Ginkgo requires the index type of the row offsets, hence the narrow columns are
+        // widened into a copy owned by the matrix
+        col = colView;
+    }
     // auto row = createGkoArray(exec, mtx.rowOffs);
     auto row = gko::array<IndexType>::view(
         exec,
@@ -72,6 +97,7 @@ std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>> createGkoMtx(
     ));
 }
 
+/* @brief wraps memory as a dense vector without copying it, eg. the solution of a solve */
 template<typename ValueType>
 std::shared_ptr<gko::matrix::Dense<ValueType>>
 createGkoDense(std::shared_ptr<const gko::Executor> exec, ValueType* ptr, localIdx s)
@@ -82,20 +108,162 @@ createGkoDense(std::shared_ptr<const gko::Executor> exec, ValueType* ptr, localI
     ));
 }
 
+/* @brief wraps const memory as a constant dense vector without copying it, eg. the rhs of a
+ * solve, a modifiable copy has to be created with clone
+ */
 template<typename ValueType>
-std::shared_ptr<gko::matrix::Dense<ValueType>>
+std::shared_ptr<const gko::matrix::Dense<ValueType>>
 createGkoDense(std::shared_ptr<const gko::Executor> exec, const ValueType* ptr, localIdx s)
 {
     auto size = static_cast<std::size_t>(s);
-    auto const_array_view = gko::array<ValueType>::const_view(exec, size, ptr);
-    return gko::share(gko::matrix::Dense<ValueType>::create(
-        exec, gko::dim<2> {size, 1}, const_array_view.copy_to_array(), 1
+    return gko::share(gko::matrix::Dense<ValueType>::create_const(
+        exec, gko::dim<2> {size, 1}, gko::array<ValueType>::const_view(exec, size, ptr), 1
     ));
 }
 
+/* @brief wraps a sliced ELLPACK matrix with a single slice as gko::matrix::Ell without copying
+ *
+ * A single slice stores the entries column major with a stride of nRows, which is the layout of
+ * gko::matrix::Ell.
+ */
+template<typename ValueType, typename IndexType>
+std::shared_ptr<gko::matrix::Ell<ValueType, IndexType>>
+createGkoEll(std::shared_ptr<const gko::Executor> exec, SlicedEllMatrix<ValueType, IndexType>& mtx)
+{
+    NF_ASSERT(mtx.nSlices() <= 1, "Only matrices with a single slice can be wrapped as Ell");
+    auto nrows = static_cast<gko::dim<2>::dimension_type>(mtx.nRows());
+    auto nStoredPerRow = mtx.nRows() > 0 ? mtx.nStored() / mtx.sliceSize() : 0;
+    auto vals = gko::array<ValueType>::view(
+        exec, static_cast<gko::size_type>(mtx.nStored()), mtx.values().data()
+    );
+    auto col = gko::array<IndexType>::view(
+        exec,
+        static_cast<gko::size_type>(mtx.nStored()),
+        const_cast<IndexType*>(mtx.colIdxs().data())
+    );
+    return gko::share(gko::matrix::Ell<ValueType, IndexType>::create(
+        exec,
+        gko::dim<2> {nrows, nrows},
+        vals,
+        col,
+        static_cast<gko::size_type>(nStoredPerRow),
+        static_cast<gko::size_type>(mtx.sliceSize())
+    ));
+}
+
+}
+
+/* @class GkoLinearOperator
+ * @brief exposes a matrix free linear operator as gko::LinOp
+ *
+ * Only single column dense vectors with unit stride are supported. Since no matrix is available
+ * Ginkgo solvers can only be combined with preconditioners which do not read matrix entries.
+ */
+class GkoLinearOperator : public gko::EnableLinOp<GkoLinearOperator>
+{
+    friend class gko::EnablePolymorphicObject<GkoLinearOperator, gko::LinOp>;
+
+public:
+
+    static std::unique_ptr<GkoLinearOperator> create(
+        std::shared_ptr<const gko::Executor> exec, std::shared_ptr<const LinearOperator<scalar>> op
+    )
+    {
+        return std::unique_ptr<GkoLinearOperator>(new GkoLinearOperator(exec, op));
+    }
+
+protected:
+
+    explicit GkoLinearOperator(std::shared_ptr<const gko::Executor> exec)
+        : gko::EnableLinOp<GkoLinearOperator>(exec)
+    {}
+
+    GkoLinearOperator(
+        std::shared_ptr<const gko::Executor> exec, std::shared_ptr<const LinearOperator<scalar>> op
+    )
+        : gko::EnableLinOp<GkoLinearOperator>(
+            exec,
+            gko::dim<2> {
+                static_cast<gko::size_type>(op->nRows()), static_cast<gko::size_type>(op->nRows())
+            }
+        ),
+          op_(op)
+    {}
+
+    void apply_impl(const gko::LinOp* b, gko::LinOp* x) const override
+    {
+        using vec = gko::matrix::Dense<scalar>;
+        const auto* denseB = gko::as<vec>(b);
+        auto* denseX = gko::as<vec>(x);
+        NF_ASSERT(
+            denseB->get_size()[1] == 1 && denseB->get_stride() == 1 && denseX->get_stride() == 1,
+            "Only single column vectors can be applied to a linear operator"
+        );
+        const auto nRows = op_->nRows();
+        op_->apply(
+            View<const scalar>(denseB->get_const_values(), static_cast<std::size_t>(nRows)),
+            View<scalar>(denseX->get_values(), static_cast<std::size_t>(nRows))
+        );
+    }
+
+    void apply_impl(
+        const gko::LinOp* alpha, const gko::LinOp* b, const gko::LinOp* beta, gko::LinOp* x
+    ) const override
+    {
+        using vec = gko::matrix::Dense<scalar>;
+        auto* denseX = gko::as<vec>(x);
+        auto ax = gko::clone(denseX);
+        apply_impl(b, ax.get());
+        denseX->scale(beta);
+        denseX->add_scaled(alpha, ax);
+    }
+
+private:
+
+    std::shared_ptr<const LinearOperator<scalar>> op_;
+};
+
+/* @brief wraps a matrix free linear operator as gko::LinOp, see GkoLinearOperator */
+inline std::shared_ptr<gko::LinOp> createGkoLinOp(
+    std::shared_ptr<const gko::Executor> exec, std::shared_ptr<const LinearOperator<scalar>> op
+)
+{
+    return gko::share(GkoLinearOperator::create(exec, op));
 }
+
 gko::config::pnode parse(const Dictionary& dict);
 
+/* @class GinkgoSolver
+ * @brief linear solver interface to the Ginkgo library
+ *
+ * The generated Ginkgo solver, including its preconditioner, is kept between solves as long as
+ * the matrix of the linear system lives at the same memory location and has the same size.
+ * In this case only the matrix values are expected to have changed. The following optional keys
+ * of the solver dictionary control the reuse and are not forwarded to Ginkgo:
+ *  - rebuildPreconditionerEvery: regenerate the solver every N solves (default 1)
+ *  - computeInitialResidual: compute the initial residual norm (default true), if
+ *    disabled the reported initial residual norm is zero
+ *  - mixedPrecision: solve with a single precision matrix, solver and preconditioner inside a
+ *    double precision iterative refinement (default false)
+ *  - maxRefinements: maximum number of refinement steps of the mixed precision solve (default 10)
+ *  - refinementTolerance: reduction of the double precision residual norm relative to the
+ *    initial residual norm at which the refinement stops (default 1e-6)
+ *  - blockJacobi: replace the preconditioner by Ginkgo's Jacobi with blocks of the given number
+ *    of consecutive rows, see uniformBlockOffsets, or zero to keep the configured one
+ *    (default 0). The solver has to accept a preconditioner, the block size is at most 32.
+ *
+ * Gauss-Seidel and SOR preconditioners and smoothers are provided by Ginkgo as
+ * preconditioner::GaussSeidel and preconditioner::Sor, with the symmetric key for the symmetric
+ * variants. For the native multicolor variant see GaussSeidel.
+ *
+ * Segregated Vec3 systems generate the solver for the first component only, the second and
+ * third component are solved with the preconditioner of the first component. Several right hand
+ * sides of one matrix, see DenseBlock, are solved together by a single solver application.
+ *
+ * If Ginkgo is built with MPI, distributed linear systems are solved with the distributed
+ * matrix and vector of Ginkgo. The preconditioner has to support distributed matrices, eg. a
+ * preconditioner::Schwarz with a local solver.
+ */
 class GinkgoSolver : public SolverFactory::template Register<GinkgoSolver>
 {
 
@@ -104,11 +272,34 @@ class GinkgoSolver : public SolverFactory::template Register<GinkgoSolver>
 public:
 
     GinkgoSolver(Executor exec, const Dictionary& solverConfig)
-        : Base(exec), gkoExec_(getGkoExecutor(exec)), config_(parse(solverConfig)),
-          factory_(gko::config::parse(
-                       config_, gko::config::registry(), gko::config::make_type_descriptor<scalar>()
-          )
-                       .on(gkoExec_))
+        : Base(exec), gkoExec_(getGkoExecutor(exec)),
+          rebuildEvery_(readOption<int>(solverConfig, "rebuildPreconditionerEvery", 1)),
+          computeInitResidual_(readOption<bool>(solverConfig, "computeInitialResidual", true)),
+          mixedPrecision_(readOption<bool>(solverConfig, "mixedPrecision", false)),
+          maxRefinements_(readOption<int>(solverConfig, "maxRefinements", 10)),
+          refinementTol_(readOption<scalar>(solverConfig, "refinementTolerance", 1e-6)),
+          blockJacobi_(static_cast<localIdx>(readOption<int>(solverConfig, "blockJacobi", 0))),
+          config_(parse(stripOptions(solverConfig))),
+          factory_(createFactory(config_, gkoExec_, mixedPrecision_))
+    {
+        NF_ASSERT(rebuildEvery_ > 0, "rebuildPreconditionerEvery needs to be larger than zero");
+        NF_ASSERT(maxRefinements_ > 0, "maxRefinements needs to be larger than zero");
+        NF_ASSERT(
+            blockJacobi_ >= 0 && blockJacobi_ <= BlockJacobiPreconditioner::maxBlockSize,
+            "blockJacobi needs to be in [0, 32]"
+        );
+        NF_ASSERT(
+            blockJacobi_ == 0 || !mixedPrecision_,
+            "blockJacobi is not supported for mixed precision solves"
+        );
+    }
+
+    /* @brief copy constructor, the generated solver is not shared between copies */
+    GinkgoSolver(const GinkgoSolver& other)
+        : Base(other.exec_), gkoExec_(other.gkoExec_), rebuildEvery_(other.rebuildEvery_),
+          computeInitResidual_(other.computeInitResidual_), mixedPrecision_(other.mixedPrecision_),
+          maxRefinements_(other.maxRefinements_), refinementTol_(other.refinementTol_),
+          blockJacobi_(other.blockJacobi_), config_(other.config_), factory_(other.factory_)
     {}
 
     static std::string name() { return "Ginkgo"; }
@@ -117,68 +308,573 @@ public:
 
     static std::string schema() { return "none"; }
 
+    /* @brief the bytes of the reduced precision copy of the matrix of mixed precision solves
+     *
+     * The matrix of the system is wrapped without a copy, the generated solver and its
+     * preconditioner are held by Ginkgo and are not accounted.
+     */
+    virtual std::size_t memoryBytes() const final
+    {
+        if (!innerMtx_)
+        {
+            return 0;
+        }
+        return innerMtx_->get_num_stored_elements() * (sizeof(InnerScalar) + sizeof(localIdx))
+             + (innerMtx_->get_size()[0] + 1) * sizeof(localIdx);
+    }
+
     virtual SolverStats
     solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final
     {
-        auto startEval = std::chrono::steady_clock::now();
+        return solveImpl(sys, x, false);
+    }
+
+    virtual SolverStats solve(const LinearSystem<Vec3, localIdx>& sys, Vector<Vec3>& x) const final
+    {
+        // the component systems share one memory location, hence the solver generated for the
+        // first component can be applied to the others
+        return solveSegregated(
+            sys,
+            x,
+            [this](const auto& cmptSys, auto& cmptX, localIdx cmpt)
+            { return solveImpl(cmptSys, cmptX, cmpt > 0); }
+        );
+    }
+
+    /* @brief solves all columns of b with a single application of the solver
+     *
+     * The blocks are wrapped as dense matrices with one column per right hand side, thus every
+     * matrix and preconditioner application reads the entries once for all columns. Mixed
+     * precision solves fall back to solving the columns one after another.
+     */
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& sys, const DenseBlock& b, DenseBlock& x) const final
+    {
+        if (mixedPrecision_)
+        {
+            return SolverFactory::solve(sys, b, x);
+        }
+        NF_ASSERT_EQUAL(b.nRows(), sys.rhs().size());
+        NF_ASSERT_EQUAL(b.nRows(), x.nRows());
+        NF_ASSERT_EQUAL(b.nCols(), x.nCols());
+        PhaseTimer timer;
+        SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+        auto lap = [&]()
+        {
+            gkoExec_->synchronize();
+            return timer.lap();
+        };
         using vec = gko::matrix::Dense<scalar>;
 
+        auto nCols = static_cast<gko::size_type>(b.nCols());
+        // the norm over all columns from the 1 x nCols column norms
+        auto retrieve = [&](const auto& in)
+        {
+            auto host = vec::create(gkoExec_->get_master(), gko::dim<2> {1, nCols});
+            host->copy_from(in);
+            scalar sum = 0.0;
+            for (gko::size_type j = 0; j < nCols; j++)
+            {
+                sum += host->at(0, j) * host->at(0, j);
+            }
+            return std::sqrt(sum);
+        };
+
+        updateSolver(sys, timings, lap);
+
+        auto size = gko::dim<2> {static_cast<gko::size_type>(b.nRows()), nCols};
+        auto nValues = static_cast<gko::size_type>(b.values().size());
+        auto gkoB = vec::create_const(
+            gkoExec_,
+            size,
+            gko::array<scalar>::const_view(gkoExec_, nValues, b.values().data()),
+            nCols
+        );
+        auto gkoX = vec::create(
+            gkoExec_, size, gko::array<scalar>::view(gkoExec_, nValues, x.values().data()), nCols
+        );
+        timings.setupTime += lap();
+
+        scalar initResNorm = 0.0;
+        if (computeInitResidual_)
+        {
+            auto one = gko::initialize<vec>({1.0}, gkoExec_);
+            auto negOne = gko::initialize<vec>({-1.0}, gkoExec_);
+            auto norm = vec::create(gkoExec_, gko::dim<2> {1, nCols});
+            auto res = gko::clone(gkoB);
+            gkoMtx_->apply(negOne, gkoX, one, res);
+            res->compute_norm2(norm);
+            timings.applyTime += lap();
+            initResNorm = retrieve(norm);
+            timings.transferTime += lap();
+        }
+
+        solver_->apply(gkoB, gkoX);
+        timings.applyTime += lap();
+
+        scalar finalResNorm = retrieve(gko::as<vec>(logger_->get_residual_norm()));
+        auto numIter = label(logger_->get_num_iterations());
+        timings.transferTime += lap();
+
+        return {numIter, initResNorm, finalResNorm, timer.total(), timings};
+    }
+
+#ifdef NF_WITH_GINKGO_MPI
+    virtual SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final
+    {
+        NF_ASSERT(!mixedPrecision_, "Mixed precision is not supported for distributed systems");
+        PhaseTimer timer;
+        SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+        auto lap = [&]()
+        {
+            gkoExec_->synchronize();
+            return timer.lap();
+        };
+        namespace dist = gko::experimental::distributed;
+        using vec = gko::matrix::Dense<scalar>;
+        using distMtx = dist::Matrix<scalar, localIdx, globalIdx>;
+        using distVec = dist::Vector<scalar>;
+
+        const auto& numbering = sys.numbering();
+        auto comm = gko::experimental::mpi::communicator(sys.mpiEnvironment().comm());
+        const auto& rankOffsets = numbering.rankOffsets();
+        auto ranges = gko::array<globalIdx>(gkoExec_->get_master(), rankOffsets.size());
+        std::copy(rankOffsets.begin(), rankOffsets.end(), ranges.get_data());
+        ranges.set_executor(gkoExec_);
+        auto partition = gko::share(
+            dist::Partition<localIdx, globalIdx>::build_from_contiguous(gkoExec_, ranges)
+        );
+
+        // the distributed matrix is assembled from the global COO representation
+        Vector<globalIdx> cooRows(sys.exec(), 0);
+        Vector<globalIdx> cooCols(sys.exec(), 0);
+        Vector<scalar> cooValues(sys.exec(), 0);
+        sys.globalCOOIdxs(cooRows, cooCols);
+        sys.cooValues(cooValues);
+        auto nnz = static_cast<gko::size_type>(sys.nCOOEntries());
+        auto nGlobal = static_cast<gko::size_type>(numbering.nGlobalRows());
+        auto nLocal = static_cast<gko::size_type>(numbering.nLocalRows());
+        auto data = gko::device_matrix_data<scalar, globalIdx>(
+            gkoExec_,
+            gko::dim<2> {nGlobal, nGlobal},
+            gko::array<globalIdx>::view(gkoExec_, nnz, cooRows.data()),
+            gko::array<globalIdx>::view(gkoExec_, nnz, cooCols.data()),
+            gko::array<scalar>::view(gkoExec_, nnz, cooValues.data())
+        );
+        data.sort_row_major();
+        auto gkoMtx = gko::share(distMtx::create(gkoExec_, comm));
+        gkoMtx->read_distributed(data, partition);
+
+        auto localVec = [&](scalar* ptr)
+        {
+            return vec::create(
+                gkoExec_,
+                gko::dim<2> {nLocal, 1},
+                gko::array<scalar>::view(gkoExec_, nLocal, ptr),
+                1
+            );
+        };
+        auto globalSize = gko::dim<2> {nGlobal, 1};
+        auto rhs = distVec::create(
+            gkoExec_,
+            comm,
+            globalSize,
+            localVec(const_cast<scalar*>(sys.localSystem().rhs().data()))
+        );
+        auto gkoX = distVec::create(gkoExec_, comm, globalSize, localVec(x.data()));
+
+        auto one = gko::initialize<vec>({1.0}, gkoExec_);
+        auto negOne = gko::initialize<vec>({-1.0}, gkoExec_);
+        auto norm = gko::initialize<vec>({0.0}, gkoExec_);
         auto retrieve = [](const auto& in)
         {
             auto host = vec::create(in->get_executor()->get_master(), gko::dim<2> {1});
-            scalar res = host->copy_from(in)->at(0);
-            return res;
+            return host->copy_from(in)->at(0);
         };
+        timings.setupTime += lap();
 
-        auto nrows = sys.rhs().size();
+        scalar initResNorm = 0.0;
+        if (computeInitResidual_)
+        {
+            auto res = gko::clone(rhs);
+            gkoMtx->apply(negOne, gkoX, one, res);
+            res->compute_norm2(norm);
+            timings.applyTime += lap();
+            initResNorm = retrieve(norm);
+            timings.transferTime += lap();
+        }
 
-        auto gkoMtx = detail::createGkoMtx(gkoExec_, sys);
         auto solver = factory_->generate(gkoMtx);
-
-        std::shared_ptr<const gko::log::Convergence<scalar>> logger =
-            gko::log::Convergence<scalar>::create();
+        auto logger = gko::share(gko::log::Convergence<scalar>::create());
         solver->add_logger(logger);
+        timings.preconditionerTime += lap();
+        solver->apply(rhs, gkoX);
 
-        auto rhs = detail::createGkoDense(gkoExec_, sys.rhs().data(), nrows);
-        auto rhs2 = detail::createGkoDense(gkoExec_, sys.rhs().data(), nrows);
-        auto gkoX = detail::createGkoDense(gkoExec_, x.data(), nrows);
+        auto res = gko::clone(rhs);
+        gkoMtx->apply(negOne, gkoX, one, res);
+        res->compute_norm2(norm);
+        timings.applyTime += lap();
+        scalar finalResNorm = retrieve(norm);
+        auto numIter = label(logger->get_num_iterations());
+        timings.transferTime += lap();
+
+        return {numIter, initResNorm, finalResNorm, timer.total(), timings};
+    }
+#else
+    using Base::solve;
+#endif
 
+    /* @brief solves op x = rhs with a matrix free linear operator
+     *
+     * The solver is generated on every call, the configured preconditioner must not require the
+     * matrix entries. Mixed precision is not supported.
+     */
+    SolverStats solve(
+        std::shared_ptr<const LinearOperator<scalar>> op,
+        const Vector<scalar>& rhs,
+        Vector<scalar>& x
+    ) const
+    {
+        NF_ASSERT(!mixedPrecision_, "Mixed precision is not supported for linear operators");
+        PhaseTimer timer;
+        SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+        auto lap = [&]()
+        {
+            gkoExec_->synchronize();
+            return timer.lap();
+        };
+        using vec = gko::matrix::Dense<scalar>;
+        auto retrieve = [](const auto& in)
+        {
+            auto host = vec::create(in->get_executor()->get_master(), gko::dim<2> {1});
+            scalar res = host->copy_from(in)->at(0);
+            return res;
+        };
+
+        auto nrows = rhs.size();
+        auto gkoOp = createGkoLinOp(gkoExec_, op);
+        auto gkoRhs = detail::createGkoDense(gkoExec_, rhs.data(), nrows);
+        auto gkoX = detail::createGkoDense(gkoExec_, x.data(), nrows);
         auto one = gko::initialize<vec>({1.0}, gkoExec_);
-        auto neg_one = gko::initialize<vec>({-1.0}, gkoExec_);
-        auto init = gko::initialize<vec>({0.0}, gkoExec_);
-        gkoMtx->apply(one, gkoX, neg_one, rhs2);
-        rhs->compute_norm2(init);
-        scalar initResNorm = retrieve(init);
+        auto negOne = gko::initialize<vec>({-1.0}, gkoExec_);
+        auto norm = gko::initialize<vec>({0.0}, gkoExec_);
+        timings.setupTime += lap();
 
-        solver->apply(rhs, gkoX);
+        scalar initResNorm = 0.0;
+        if (computeInitResidual_)
+        {
+            auto res = gko::clone(gkoRhs);
+            gkoOp->apply(one, gkoX, negOne, res);
+            res->compute_norm2(norm);
+            timings.applyTime += lap();
+            initResNorm = retrieve(norm);
+            timings.transferTime += lap();
+        }
+
+        auto solver = factory_->generate(gkoOp);
+        auto logger = gko::share(gko::log::Convergence<scalar>::create());
+        solver->add_logger(logger);
+        timings.preconditionerTime += lap();
+        solver->apply(gkoRhs, gkoX);
+        timings.applyTime += lap();
 
         scalar finalResNorm = retrieve(gko::as<vec>(logger->get_residual_norm()));
-
         auto numIter = label(logger->get_num_iterations());
+        timings.transferTime += lap();
 
-        auto endEval = std::chrono::steady_clock::now();
-        auto duration =
-            static_cast<float>(
-                std::chrono::duration_cast<std::chrono::microseconds>(endEval - startEval).count()
-            )
-            / 1000.0;
-        return {numIter, initResNorm, finalResNorm, duration};
+        return {numIter, initResNorm, finalResNorm, timer.total(), timings};
     }
 
     // TODO why use a smart pointer here?
     virtual std::unique_ptr<SolverFactory> clone() const final
     {
-        NF_ERROR_EXIT("Not implemented");
-        return {};
+        return std::make_unique<GinkgoSolver>(*this);
     }
 
 private:
 
+    /* @brief value type of the matrix, solver and preconditioner of the mixed precision solve */
+    using InnerScalar = float;
+
+    /* @brief solves the system, if reuseSolver is set the cached solver is applied without
+     * checking whether it has to be regenerated
+     */
+    SolverStats
+    solveImpl(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x, bool reuseSolver) const
+    {
+        if (mixedPrecision_)
+        {
+            return solveMixedPrecision(sys, x, reuseSolver);
+        }
+        PhaseTimer timer;
+        SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+        auto lap = [&]()
+        {
+            gkoExec_->synchronize();
+            return timer.lap();
+        };
+        using vec = gko::matrix::Dense<scalar>;
+
+        auto retrieve = [](const auto& in)
+        {
+            auto host = vec::create(in->get_executor()->get_master(), gko::dim<2> {1});
+            scalar res = host->copy_from(in)->at(0);
+            return res;
+        };
+
+        auto nrows = sys.rhs().size();
+
+        if (!(reuseSolver && solver_))
+        {
+            updateSolver(sys, timings, lap);
+        }
+
+        auto rhs = detail::createGkoDense(gkoExec_, sys.rhs().data(), nrows);
+        auto gkoX = detail::createGkoDense(gkoExec_, x.data(), nrows);
+        timings.setupTime += lap();
+
+        scalar initResNorm = 0.0;
+        if (computeInitResidual_)
+        {
+            // the residual and its norm are computed by a single kernel
+            Vector<scalar> res(x.exec(), nrows);
+            timings.setupTime += lap();
+            initResNorm = computeResidualNorms(sys.matrix(), sys.rhs(), x, res).l2;
+            timings.applyTime += lap();
+        }
+
+        solver_->apply(rhs, gkoX);
+        timings.applyTime += lap();
+
+        scalar finalResNorm = retrieve(gko::as<vec>(logger_->get_residual_norm()));
+        timings.transferTime += lap();
+
+        auto numIter = label(logger_->get_num_iterations());
+
+        return {numIter, initResNorm, finalResNorm, timer.total(), timings};
+    }
+
+    /* @brief regenerates the solver if required, see requiresRebuild, and counts the solve */
+    template<typename Lap>
+    void
+    updateSolver(const LinearSystem<scalar, localIdx>& sys, SolverTimings& timings, Lap& lap) const
+    {
+        if (requiresRebuild(sys))
+        {
+            gkoMtx_ = detail::createGkoMtx(gkoExec_, sys);
+            colIdxs_ = sys.matrix().colIdxs().data();
+            timings.setupTime += lap();
+            solver_ = gko::share(factory_->generate(gkoMtx_));
+            if (blockJacobi_ > 0)
+            {
+                setBlockJacobi();
+            }
+            logger_ = gko::log::Convergence<scalar>::create();
+            solver_->add_logger(logger_);
+            solvesSinceRebuild_ = 0;
+            timings.preconditionerTime += lap();
+        }
+        solvesSinceRebuild_++;
+    }
+
+    /* @brief replaces the preconditioner of the generated solver by Ginkgo's Jacobi with the
+     * blocks of consecutive rows of uniformBlockOffsets
+     */
+    void setBlockJacobi() const
+    {
+        auto nRows = static_cast<localIdx>(gkoMtx_->get_size()[0]);
+        auto hostOffsets = uniformBlockOffsets(SerialExecutor {}, nRows, blockJacobi_);
+        auto nOffsets = static_cast<gko::size_type>(hostOffsets.size());
+        auto blockPointers = gko::array<localIdx>(gkoExec_->get_master(), nOffsets);
+        std::copy(hostOffsets.data(), hostOffsets.data() + nOffsets, blockPointers.get_data());
+        blockPointers.set_executor(gkoExec_);
+        auto precond = gko::preconditioner::Jacobi<scalar, localIdx>::build()
+                           .with_max_block_size(static_cast<gko::uint32>(blockJacobi_))
+                           .with_block_pointers(blockPointers)
+                           .on(gkoExec_)
+                           ->generate(gkoMtx_);
+        auto preconditionable = std::dynamic_pointer_cast<gko::Preconditionable>(solver_);
+        NF_ASSERT(preconditionable, "The Ginkgo solver does not accept a preconditioner");
+        preconditionable->set_preconditioner(gko::share(std::move(precond)));
+    }
+
+    static std::shared_ptr<const gko::LinOpFactory> createFactory(
+        const gko::config::pnode& config,
+        std::shared_ptr<const gko::Executor> gkoExec,
+        bool mixedPrecision
+    )
+    {
+        if (mixedPrecision)
+        {
+            return gko::config::parse(
+                       config,
+                       gko::config::registry(),
+                       gko::config::make_type_descriptor<InnerScalar>()
+            )
+                .on(gkoExec);
+        }
+        return gko::config::parse(
+                   config, gko::config::registry(), gko::config::make_type_descriptor<scalar>()
+        )
+            .on(gkoExec);
+    }
+
+    /* @brief iterative refinement with a double precision residual and single precision solves
+     *
+     * Every refinement step computes r = Ax - b and its norm in double precision with a single
+     * kernel, solves A d = r with the single precision solver and updates x -= d. The matrix
+     * values are converted to single precision once per solve, which halves the memory traffic
+     * of the inner iterations.
+     */
+    SolverStats solveMixedPrecision(
+        const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x, bool reuseSolver
+    ) const
+    {
+        PhaseTimer timer;
+        SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+        auto lap = [&]()
+        {
+            gkoExec_->synchronize();
+            return timer.lap();
+        };
+        using vec = gko::matrix::Dense<scalar>;
+        using innerVec = gko::matrix::Dense<InnerScalar>;
+
+        auto nrows = sys.rhs().size();
+        const bool rebuild = !(reuseSolver && solver_) && requiresRebuild(sys);
+        if (rebuild)
+        {
+            gkoMtx_ = detail::createGkoMtx(gkoExec_, sys);
+            colIdxs_ = sys.matrix().colIdxs().data();
+            innerMtx_ = gko::share(gko::matrix::Csr<InnerScalar, localIdx>::create(gkoExec_));
+        }
+        // the values of the single precision copy are refreshed on every solve
+        gkoMtx_->convert_to(innerMtx_);
+        timings.setupTime += lap();
+        if (rebuild)
+        {
+            solver_ = gko::share(factory_->generate(innerMtx_));
+            innerLogger_ = gko::log::Convergence<InnerScalar>::create();
+            solver_->add_logger(innerLogger_);
+            solvesSinceRebuild_ = 0;
+            timings.preconditionerTime += lap();
+        }
+        if (!reuseSolver)
+        {
+            solvesSinceRebuild_++;
+        }
+
+        auto gkoX = detail::createGkoDense(gkoExec_, x.data(), nrows);
+        auto size = gko::dim<2> {static_cast<std::size_t>(nrows), 1};
+        // holds Ax - b, the correction is subtracted from x
+        Vector<scalar> resV(x.exec(), nrows);
+        auto res = detail::createGkoDense(gkoExec_, resV.data(), nrows);
+        auto innerRes = gko::share(innerVec::create(gkoExec_, size));
+        auto innerCorr = gko::share(innerVec::create(gkoExec_, size));
+        auto corr = gko::share(vec::create(gkoExec_, size));
+        auto negOne = gko::initialize<vec>({-1.0}, gkoExec_);
+        timings.setupTime += lap();
+
+        scalar initResNorm = 0.0;
+        scalar resNorm = 0.0;
+        int numIter = 0;
+        for (int refinement = 0; refinement <= maxRefinements_; refinement++)
+        {
+            resNorm = computeResidualNorms(sys.matrix(), sys.rhs(), x, resV).l2;
+            timings.applyTime += lap();
+            if (refinement == 0)
+            {
+                initResNorm = resNorm;
+            }
+            if (refinement == maxRefinements_ || resNorm <= refinementTol_ * initResNorm)
+            {
+                break;
+            }
+
+            res->convert_to(innerRes);
+            innerCorr->fill(0.0);
+            solver_->apply(innerRes, innerCorr);
+            numIter += static_cast<int>(innerLogger_->get_num_iterations());
+            innerCorr->convert_to(corr);
+            gkoX->add_scaled(negOne, corr);
+            timings.applyTime += lap();
+        }
+
+        return {
+            numIter,
+            computeInitResidual_ ? initResNorm : scalar(0),
+            resNorm,
+            timer.total(),
+            timings
+        };
+    }
+
+    template<typename T>
+    static T readOption(const Dictionary& dict, const std::string& key, T defaultValue)
+    {
+        return dict.contains(key) ? dict.get<T>(key) : defaultValue;
+    }
+
+    /* @brief removes the NeoN specific keys which are not understood by Ginkgo */
+    static Dictionary stripOptions(const Dictionary& solverConfig)
+    {
+        Dictionary ret = solverConfig;
+        for (const auto& key :
+             {"rebuildPreconditionerEvery",
+              "computeInitialResidual",
+              "mixedPrecision",
+              "maxRefinements",
+              "refinementTolerance",
+              "blockJacobi",
+              "vectorSolve",
+              "initialGuess",
+              "initialGuessLevels"})
+        {
+            if (ret.contains(key))
+            {
+                ret.remove(key);
+            }
+        }
+        return ret;
+    }
+
+    /* @brief checks whether the cached solver can be applied to the given system */
+    bool requiresRebuild(const LinearSystem<scalar, localIdx>& sys) const
+    {
+        if (!solver_ || solvesSinceRebuild_ >= rebuildEvery_)
+        {
+            return true;
+        }
+        const auto& mtx = sys.matrix();
+        return gkoMtx_->get_size()[0] != static_cast<gko::size_type>(sys.rhs().size())
+            || gkoMtx_->get_num_stored_elements()
+                   != static_cast<gko::size_type>(mtx.values().size())
+            || gkoMtx_->get_const_values() != mtx.values().data()
+            || colIdxs_ != mtx.colIdxs().data()
+            || gkoMtx_->get_const_row_ptrs() != mtx.rowOffs().data();
+    }
+
     std::shared_ptr<const gko::Executor> gkoExec_;
+    int rebuildEvery_;
+    bool computeInitResidual_;
+    bool mixedPrecision_;
+    int maxRefinements_;
+    scalar refinementTol_;
+    localIdx blockJacobi_;
     gko::config::pnode config_;
     std::shared_ptr<const gko::LinOpFactory> factory_;
-};
 
+    // cached state from the last solver generation
+    mutable std::shared_ptr<gko::matrix::Csr<scalar, localIdx>> gkoMtx_ {nullptr};
+    // the wrapped column indices, gkoMtx_ holds a widened copy of them with NeoN_DP_LOCAL_IDX
+    mutable const columnIdx* colIdxs_ {nullptr};
+    mutable std::shared_ptr<gko::LinOp> solver_ {nullptr};
+    mutable std::shared_ptr<gko::log::Convergence<scalar>> logger_ {nullptr};
+    mutable std::shared_ptr<gko::matrix::Csr<InnerScalar, localIdx>> innerMtx_ {nullptr};
+    mutable std::shared_ptr<gko::log::Convergence<InnerScalar>> innerLogger_ {nullptr};
+    mutable int solvesSinceRebuild_ {0};
+};
 
 }
 
@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/operators.hpp"
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
+#endif
+
+namespace NeoN::la
+{
+
+#ifdef NF_WITH_MPI_SUPPORT
+/* @class InterfaceExchange
+ * @brief adds the interface coefficients of a distributed system times the values of their
+ * global columns
+ *
+ * The owners of the interface columns are found once from the global row numbering. Afterwards
+ * every exchange sends the locally owned values requested by the other ranks with non-blocking
+ * point to point messages, so the local product can be computed while the messages are in
+ * flight.
+ */
+class InterfaceExchange
+{
+public:
+
+    /* @brief sets up the messages of the system, this is a collective operation */
+    InterfaceExchange(const DistributedLinearSystem<scalar, localIdx>& sys);
+
+    ~InterfaceExchange();
+
+    InterfaceExchange(const InterfaceExchange&) = delete;
+
+    InterfaceExchange& operator=(const InterfaceExchange&) = delete;
+
+    /* @brief posts the messages of the values of x requested by the other ranks */
+    void start(const Vector<scalar>& x);
+
+    /* @brief waits for the messages and adds the interface contributions to y */
+    void finish(Vector<scalar>& y);
+
+private:
+
+    MPI_Comm comm_; // a duplicate of the communicator of the system, which isolates the messages
+
+    const Vector<scalar>& interfaceValues_;
+
+    Vector<localIdx> sendRows_; // the local rows to send, grouped by the receiving rank
+
+    std::vector<mpi_label_t> sendOffsets_; // host offsets of the values sent to every rank
+
+    std::vector<mpi_label_t> recvOffsets_; // host offsets of the values received from every rank
+
+    Vector<localIdx> entries_; // the interface coefficients sorted by their row
+
+    Vector<localIdx> entryRowOffs_; // the sorted coefficients of row i start at entryRowOffs[i]
+
+    Vector<localIdx> recvIdxs_; // the position of the column of every coefficient in recv
+
+    Vector<scalar> send_;
+
+    Vector<scalar> recv_;
+
+    Vector<scalar> sendHost_;
+
+    Vector<scalar> recvHost_;
+
+    std::vector<MPI_Request> requests_;
+};
+#endif
+
+/* @class KrylovOperator
+ * @brief the matrix, the preconditioner and the global sums of the native Krylov solvers
+ *
+ * For a distributed system the product with the matrix exchanges the interface values while the
+ * local product is computed, and the sums over all ranks are non-blocking, so they can be
+ * overlapped with the local work. For a local system the sums are complete once started.
+ */
+class KrylovOperator
+{
+public:
+
+    /* @param jacobi, use the inverse diagonal as preconditioner, otherwise the identity */
+    KrylovOperator(const LinearSystem<scalar, localIdx>& sys, bool jacobi);
+
+#ifdef NF_WITH_MPI_SUPPORT
+    KrylovOperator(const DistributedLinearSystem<scalar, localIdx>& sys, bool jacobi);
+#endif
+
+    const LinearSystem<scalar, localIdx>& localSystem() const { return sys_; }
+
+    /* @brief the inverse diagonal of the Jacobi preconditioner, or ones without preconditioner */
+    const Vector<scalar>& invDiag() const { return invDiag_; }
+
+    /* @brief computes y = A x */
+    void apply(const Vector<scalar>& x, Vector<scalar>& y);
+
+    /* @brief computes y = M^-1 x */
+    void precondition(const Vector<scalar>& x, Vector<scalar>& y) const;
+
+    /* @brief starts summing the values over all ranks in place
+     *
+     * The values must not be accessed before finishReduce, at most one sum can be pending.
+     */
+    void startReduce(std::span<scalar> values);
+
+    /* @brief waits for the pending sum */
+    void finishReduce();
+
+private:
+
+    const LinearSystem<scalar, localIdx>& sys_;
+
+    Vector<scalar> invDiag_;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    std::unique_ptr<InterfaceExchange> exchange_ {nullptr};
+
+    MPI_Comm comm_ {MPI_COMM_NULL};
+
+    MPI_Request request_ {MPI_REQUEST_NULL};
+#endif
+};
+
+/* @brief the methods of the native Krylov solver */
+enum class KrylovMethod
+{
+    CG,               /**< Preconditioned conjugate gradients, selected by cg. */
+    BiCGStab,         /**< Right preconditioned BiCGStab, selected by biCGStab. */
+    GMRES,            /**< Restarted and right preconditioned GMRES, selected by gmres. */
+    PipelinedCG,      /**< Ghysels and Vanroose's method, selected by pipelinedCG. */
+    PipelinedBiCGStab /**< Cools and Vanroose's method, selected by pipelinedBiCGStab. */
+};
+
+/* @class Krylov
+ * @brief native Krylov solvers on CSRMatrix without the setup cost of an external library
+ *
+ * All methods fuse the vector updates with the preconditioner and the inner products of their
+ * results, eg. CG computes x += alpha p, r -= alpha A p, z = M^-1 r, (r, z) and (r, r) in a single
+ * kernel. The pipelined methods in addition start the sum of the inner products over the ranks
+ * before the product with the matrix and the preconditioner, which are independent of the
+ * result. Thus every iteration has a single global synchronisation point for CG and two for
+ * BiCGStab, each overlapped with local work. The solver dictionary understands:
+ *  - method: cg or pipelinedCG for symmetric positive definite matrices, biCGStab,
+ *    pipelinedBiCGStab or gmres (default pipelinedCG)
+ *  - preconditioner: jacobi or none (default jacobi), applied from the right for BiCGStab and
+ *    GMRES
+ *  - maxIters: the maximum number of iterations (default 1000)
+ *  - restart: the number of GMRES iterations between restarts (default 30)
+ *  - relTol: the residual norm reduction at which the solve stops (default 1e-6)
+ *  - absTol: the residual norm at which the solve stops (default 0)
+ *
+ * The recurrences of the pipelined methods accumulate larger rounding errors than the classic
+ * methods, hence very tight tolerances might not be reached.
+ */
+class Krylov : public SolverFactory::template Register<Krylov>
+{
+    using Base = SolverFactory::template Register<Krylov>;
+
+public:
+
+    Krylov(const Executor& exec, const Dictionary& solverConfig);
+
+    static std::string name() { return "Krylov"; }
+
+    static std::string doc() { return "Native Krylov solvers with fused vector kernels"; }
+
+    static std::string schema() { return "none"; }
+
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    virtual SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final;
+#endif
+
+    using Base::solve;
+
+    virtual std::unique_ptr<SolverFactory> clone() const final
+    {
+        return std::make_unique<Krylov>(*this);
+    }
+
+    KrylovMethod method() const { return method_; }
+
+private:
+
+    /* @brief runs the method, the timer is started before the construction of the operator */
+    SolverStats iterate(KrylovOperator& op, Vector<scalar>& x, PhaseTimer& timer) const;
+
+    KrylovMethod method_;
+    bool jacobi_;
+    int maxIters_;
+    int restart_;
+    scalar relTol_;
+    scalar absTol_;
+};
+
+}
@@ -0,0 +1,355 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/CSRMatrix.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::la
+{
+
+/**
+ * @struct LduMatrixView
+ * @brief A view struct to allow easy read/write on all executors.
+ *
+ * For a symmetric matrix the lower view refers to the upper coefficients.
+ *
+ * @tparam ValueType The value type of the coefficients.
+ * @tparam IndexType The index type of the face addressing.
+ */
+template<typename ValueType, typename IndexType>
+struct LduMatrixView
+{
+    View<ValueType> diag;      //!< View to the diagonal coefficient of every row.
+    View<ValueType> upper;     //!< View to the coefficient of the owner row and neighbour column.
+    View<ValueType> lower;     //!< View to the coefficient of the neighbour row and owner column.
+    View<IndexType> owner;     //!< View to the owner cell of every internal face.
+    View<IndexType> neighbour; //!< View to the neighbour cell of every internal face.
+};
+
+/**
+ * @class LduMatrix
+ * @brief Sparse matrix class with one coefficient per cell and internal face.
+ *
+ * Finite volume matrices couple the owner and neighbour cell of every internal face, hence the
+ * matrix is stored as the diagonal, the upper coefficient A[owner][neighbour] and the lower
+ * coefficient A[neighbour][owner] of every internal face. The addressing is the face owner and
+ * neighbour of the mesh, so compared to the CSRMatrix neither column indices nor row offsets
+ * are stored and the coefficients are assembled face by face without the offsets of the
+ * SparsityPattern. Symmetric matrices, eg. Laplacians, store only the upper coefficients.
+ *
+ * The products with the matrix scatter the face contributions into the rows with atomics. The
+ * conversion to a CSRMatrix, eg. for the external solver backends, uses the SparsityPattern of
+ * the mesh.
+ *
+ * @tparam ValueType The value type of the coefficients.
+ * @tparam IndexType The index type of the face addressing.
+ */
+template<typename ValueType, typename IndexType>
+class LduMatrix
+{
+
+public:
+
+    /**
+     * @brief Constructor for LduMatrix.
+     * @param diag The diagonal coefficients.
+     * @param upper The upper coefficients of the internal faces.
+     * @param lower The lower coefficients of the internal faces.
+     * @param owner The owner cells of the internal faces.
+     * @param neighbour The neighbour cells of the internal faces.
+     */
+    LduMatrix(
+        const Vector<ValueType>& diag,
+        const Vector<ValueType>& upper,
+        const Vector<ValueType>& lower,
+        const Vector<IndexType>& owner,
+        const Vector<IndexType>& neighbour
+    )
+        : diag_(diag), upper_(upper), lower_(lower), owner_(owner), neighbour_(neighbour),
+          symmetric_(false)
+    {
+        checkSizes();
+        NF_ASSERT(diag_.exec() == lower_.exec(), "Executors are not the same");
+        NF_ASSERT_EQUAL(upper_.size(), lower_.size());
+    }
+
+    /**
+     * @brief Constructor for a symmetric LduMatrix.
+     * @param diag The diagonal coefficients.
+     * @param upper The upper and lower coefficients of the internal faces.
+     * @param owner The owner cells of the internal faces.
+     * @param neighbour The neighbour cells of the internal faces.
+     */
+    LduMatrix(
+        const Vector<ValueType>& diag,
+        const Vector<ValueType>& upper,
+        const Vector<IndexType>& owner,
+        const Vector<IndexType>& neighbour
+    )
+        : diag_(diag), upper_(upper), lower_(diag.exec(), 0), owner_(owner),
+          neighbour_(neighbour), symmetric_(true)
+    {
+        checkSizes();
+    }
+
+    /**
+     * @brief Creates a zero matrix with the addressing of the internal faces of a mesh.
+     * @param mesh The mesh providing the face owner and neighbour.
+     * @param symmetric Store only the upper coefficients.
+     */
+    LduMatrix(const UnstructuredMesh& mesh, bool symmetric = false)
+        : diag_(mesh.exec(), mesh.nCells(), zero<ValueType>()),
+          upper_(mesh.exec(), mesh.nInternalFaces(), zero<ValueType>()),
+          lower_(mesh.exec(), symmetric ? 0 : mesh.nInternalFaces(), zero<ValueType>()),
+          owner_(mesh.exec(), mesh.nInternalFaces()),
+          neighbour_(mesh.exec(), mesh.nInternalFaces()), symmetric_(symmetric)
+    {
+        // the faces of ghost cells have no entries in the sparsity pattern
+        NF_ASSERT(mesh.nGhostCells() == 0, "The LDU addressing does not support ghost cells.");
+        const auto [faceOwner, faceNeighbour] = views(mesh.faceOwner(), mesh.faceNeighbour());
+        auto [own, nei] = views(owner_, neighbour_);
+        parallelFor(
+            mesh.exec(),
+            {0, mesh.nInternalFaces()},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                own[facei] = static_cast<IndexType>(faceOwner[facei]);
+                nei[facei] = static_cast<IndexType>(faceNeighbour[facei]);
+            },
+            "copyLduAddressing"
+        );
+    }
+
+    /**
+     * @brief Extracts the coefficients of a CSRMatrix assembled with the SparsityPattern.
+     * @param csr The matrix to convert, its structure has to match the sparsity pattern.
+     * @param sparsity The sparsity pattern of the mesh.
+     * @param mesh The mesh providing the face owner and neighbour.
+     * @param symmetric Store only the upper coefficients, the lower ones are dropped.
+     */
+    LduMatrix(
+        const CSRMatrix<ValueType, IndexType>& csr,
+        const SparsityPattern& sparsity,
+        const UnstructuredMesh& mesh,
+        bool symmetric = false
+    )
+        : LduMatrix(mesh, symmetric)
+    {
+        NF_ASSERT(csr.exec() == mesh.exec(), "Executors are not the same");
+        NF_ASSERT_EQUAL(csr.nNonZeros(), static_cast<IndexType>(sparsity.nnz()));
+        const auto [csrValues, colIdxs, rowOffs] = csr.view();
+        const auto [diagOffs, ownOffs, neiOffs] =
+            views(sparsity.diagOffset(), sparsity.ownerOffset(), sparsity.neighbourOffset());
+        auto mtx = view();
+        const bool storeLower = !symmetric_;
+
+        parallelFor(
+            exec(),
+            {0, diag_.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                mtx.diag[celli] = csrValues[rowOffs[celli] + diagOffs[celli]];
+            },
+            "extractLduDiagonal"
+        );
+        parallelFor(
+            exec(),
+            {0, upper_.size()},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto own = mtx.owner[facei];
+                const auto nei = mtx.neighbour[facei];
+                mtx.upper[facei] = csrValues[rowOffs[own] + ownOffs[facei]];
+                if (storeLower)
+                {
+                    mtx.lower[facei] = csrValues[rowOffs[nei] + neiOffs[facei]];
+                }
+            },
+            "extractLduFaces"
+        );
+    }
+
+    /**
+     * @brief Default destructor.
+     */
+    ~LduMatrix() = default;
+
+    /**
+     * @brief Get the executor associated with this matrix.
+     * @return Reference to the executor.
+     */
+    [[nodiscard]] const Executor& exec() const { return diag_.exec(); }
+
+    /**
+     * @brief Get the number of rows in the matrix.
+     * @return Number of rows.
+     */
+    [[nodiscard]] IndexType nRows() const { return static_cast<IndexType>(diag_.size()); }
+
+    /**
+     * @brief Get the number of internal faces, ie. off diagonal coefficient pairs.
+     * @return Number of internal faces.
+     */
+    [[nodiscard]] IndexType nFaces() const { return static_cast<IndexType>(upper_.size()); }
+
+    /**
+     * @brief Get the number of non-zero entries of the equivalent CSRMatrix.
+     * @return Number of non-zero entries.
+     */
+    [[nodiscard]] IndexType nNonZeros() const { return nRows() + 2 * nFaces(); }
+
+    /**
+     * @brief Whether only the upper coefficients are stored.
+     * @return True for a symmetric matrix.
+     */
+    [[nodiscard]] bool symmetric() const { return symmetric_; }
+
+    /**
+     * @brief Get a const reference to the diagonal coefficients.
+     * @return Const vector containing the diagonal coefficients.
+     */
+    [[nodiscard]] const Vector<ValueType>& diag() const { return diag_; }
+
+    /**
+     * @brief Get a const reference to the upper coefficients.
+     * @return Const vector containing the upper coefficients.
+     */
+    [[nodiscard]] const Vector<ValueType>& upper() const { return upper_; }
+
+    /**
+     * @brief Get a const reference to the lower coefficients, the upper ones if symmetric.
+     * @return Const vector containing the lower coefficients.
+     */
+    [[nodiscard]] const Vector<ValueType>& lower() const { return symmetric_ ? upper_ : lower_; }
+
+    /**
+     * @brief Get a reference to the diagonal coefficients.
+     * @return Vector containing the diagonal coefficients.
+     */
+    [[nodiscard]] Vector<ValueType>& diag() { return diag_; }
+
+    /**
+     * @brief Get a reference to the upper coefficients.
+     * @return Vector containing the upper coefficients.
+     */
+    [[nodiscard]] Vector<ValueType>& upper() { return upper_; }
+
+    /**
+     * @brief Get a reference to the lower coefficients, the upper ones if symmetric.
+     * @return Vector containing the lower coefficients.
+     */
+    [[nodiscard]] Vector<ValueType>& lower() { return symmetric_ ? upper_ : lower_; }
+
+    /**
+     * @brief Get a const reference to the owner cells of the internal faces.
+     * @return Const vector containing the owner cells.
+     */
+    [[nodiscard]] const Vector<IndexType>& owner() const { return owner_; }
+
+    /**
+     * @brief Get a const reference to the neighbour cells of the internal faces.
+     * @return Const vector containing the neighbour cells.
+     */
+    [[nodiscard]] const Vector<IndexType>& neighbour() const { return neighbour_; }
+
+    /**
+     * @brief Get a view representation of the matrix's data.
+     * @return LduMatrixView for easy access to matrix elements.
+     */
+    [[nodiscard]] LduMatrixView<ValueType, IndexType> view()
+    {
+        return {diag_.view(), upper_.view(), lower().view(), owner_.view(), neighbour_.view()};
+    }
+
+    /**
+     * @brief Get a const view representation of the matrix's data.
+     * @return Const LduMatrixView for read-only access to matrix elements.
+     */
+    [[nodiscard]] LduMatrixView<const ValueType, const IndexType> view() const
+    {
+        return {diag_.view(), upper_.view(), lower().view(), owner_.view(), neighbour_.view()};
+    }
+
+    /**
+     * @brief Converts the matrix to a CSRMatrix with the structure of the sparsity pattern.
+     * @param sparsity The sparsity pattern of the mesh the addressing is taken from.
+     * @return The CSRMatrix on the executor of this matrix.
+     */
+    [[nodiscard]] CSRMatrix<ValueType, IndexType> toCSR(const SparsityPattern& sparsity) const
+    {
+        NF_ASSERT(sparsity.exec() == exec(), "Executors are not the same");
+        NF_ASSERT_EQUAL(static_cast<IndexType>(sparsity.nnz()), nNonZeros());
+        Vector<ValueType> values(exec(), sparsity.nnz());
+        using ColumnIdxType = typename CSRMatrix<ValueType, IndexType>::ColumnIdxType;
+        Vector<ColumnIdxType> colIdxs(exec(), sparsity.nnz());
+        Vector<IndexType> rowOffs(exec(), sparsity.rowOffs().size());
+        auto [valuesV, colIdxsV, rowOffsV] = views(values, colIdxs, rowOffs);
+        const auto [spColIdxs, spRowOffs, diagOffs, ownOffs, neiOffs] = views(
+            sparsity.colIdxs(),
+            sparsity.rowOffs(),
+            sparsity.diagOffset(),
+            sparsity.ownerOffset(),
+            sparsity.neighbourOffset()
+        );
+        const auto mtx = view();
+
+        parallelFor(
+            exec(),
+            {0, sparsity.nnz()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                colIdxsV[i] = static_cast<ColumnIdxType>(spColIdxs[i]);
+            },
+            "copyCSRColIdxs"
+        );
+        parallelFor(
+            exec(),
+            {0, rowOffs.size()},
+            KOKKOS_LAMBDA(const localIdx i) { rowOffsV[i] = static_cast<IndexType>(spRowOffs[i]); },
+            "copyCSRRowOffs"
+        );
+        parallelFor(
+            exec(),
+            {0, diag_.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                valuesV[spRowOffs[celli] + diagOffs[celli]] = mtx.diag[celli];
+            },
+            "convertLduDiagonalToCSR"
+        );
+        parallelFor(
+            exec(),
+            {0, upper_.size()},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto own = static_cast<localIdx>(mtx.owner[facei]);
+                const auto nei = static_cast<localIdx>(mtx.neighbour[facei]);
+                valuesV[spRowOffs[own] + ownOffs[facei]] = mtx.upper[facei];
+                valuesV[spRowOffs[nei] + neiOffs[facei]] = mtx.lower[facei];
+            },
+            "convertLduFacesToCSR"
+        );
+        return CSRMatrix<ValueType, IndexType>(values, colIdxs, rowOffs);
+    }
+
+private:
+
+    Vector<ValueType> diag_;      //!< The diagonal coefficients.
+    Vector<ValueType> upper_;     //!< The upper coefficients of the internal faces.
+    Vector<ValueType> lower_;     //!< The lower coefficients, empty if symmetric.
+    Vector<IndexType> owner_;     //!< The owner cells of the internal faces.
+    Vector<IndexType> neighbour_; //!< The neighbour cells of the internal faces.
+    bool symmetric_;              //!< Whether the lower coefficients are the upper ones.
+
+    void checkSizes() const
+    {
+        NF_ASSERT(diag_.exec() == upper_.exec(), "Executors are not the same");
+        NF_ASSERT(diag_.exec() == owner_.exec(), "Executors are not the same");
+        NF_ASSERT(diag_.exec() == neighbour_.exec(), "Executors are not the same");
+        NF_ASSERT_EQUAL(upper_.size(), owner_.size());
+        NF_ASSERT_EQUAL(upper_.size(), neighbour_.size());
+    }
+};
+
+} // namespace NeoN::la
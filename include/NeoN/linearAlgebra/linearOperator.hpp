@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/view.hpp"
+
+
+namespace NeoN::la
+{
+
+/* @class LinearOperator
+ * @brief a square linear operator which is only known by its application y = A x
+ *
+ * In contrast to a LinearSystem no matrix is stored, the operator computes its coefficients on
+ * the fly. It can be applied by the native residual computation and by the Krylov solvers of
+ * Ginkgo, see ginkgo::createGkoLinOp.
+ */
+template<typename ValueType>
+class LinearOperator
+{
+public:
+
+    virtual ~LinearOperator() = default;
+
+    /* @brief the executor on which the operator is applied */
+    virtual Executor exec() const = 0;
+
+    /* @brief the number of rows and columns */
+    virtual localIdx nRows() const = 0;
+
+    /* @brief computes y = A x, the views have to hold nRows values on the executor */
+    virtual void apply(View<const ValueType> x, View<ValueType> y) const = 0;
+
+    /* @brief computes y = A x */
+    void apply(const Vector<ValueType>& x, Vector<ValueType>& y) const
+    {
+        NF_ASSERT(
+            x.size() == nRows() && y.size() == nRows(),
+            "The vectors do not match the size of the linear operator"
+        );
+        apply(x.view(), y.view());
+    }
+};
+
+}
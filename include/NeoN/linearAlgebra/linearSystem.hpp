@@ -5,11 +5,15 @@
 #pragma once
 
 #include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/demangle.hpp"
 #include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/memoryReport.hpp"
 #include "NeoN/linearAlgebra/CSRMatrix.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
 
+#include <optional>
 #include <string>
+#include <typeinfo>
 
 namespace NeoN::la
 {
@@ -35,6 +39,11 @@ struct LinearSystemView
 };
 
 // TODO move to fvcc
+/* @struct BoundaryCoefficients
+ * @brief the boundary face contributions to the matrix diagonal and the rhs
+ *
+ * The indices are fixed by the sparsity pattern, only the values change between assemblies.
+ */
 template<typename ValueType, typename IndexType>
 struct BoundaryCoefficients
 {
@@ -42,6 +51,22 @@ struct BoundaryCoefficients
     Vector<IndexType> matrixIdxs;
     Vector<ValueType> rhsValues;
     Vector<IndexType> rhsIdxs;
+
+    [[nodiscard]] BoundaryCoefficients copyToHost() const
+    {
+        return {
+            matrixValues.copyToHost(),
+            matrixIdxs.copyToHost(),
+            rhsValues.copyToHost(),
+            rhsIdxs.copyToHost()
+        };
+    }
+
+    [[nodiscard]] std::size_t memoryBytes() const
+    {
+        return matrixValues.memoryBytes() + matrixIdxs.memoryBytes() + rhsValues.memoryBytes()
+             + rhsIdxs.memoryBytes();
+    }
 };
 
 /**
@@ -51,6 +76,10 @@ struct BoundaryCoefficients
  * The LinearSystem class provides functionality to store and manipulate a linear system of
  * equations. It supports the storage of the coefficient matrix and the right-hand side vector, as
  * well as the solution vector.
+ *
+ * The structure, ie. the sparsity of the matrix and the indices of the boundary coefficients, is
+ * set up once on construction. Repeated assemblies on the same mesh only need to zero the values
+ * with resetValues.
  */
 template<typename ValueType, typename IndexType>
 class LinearSystem
@@ -62,16 +91,32 @@ public:
         const Vector<ValueType>& rhs,
         const Dictionary& aux = {}
     )
-        : matrix_(matrix), rhs_(rhs), auxiliaryCoefficients_(aux)
+        : matrix_(matrix), rhs_(rhs), boundaryCoefficients_(), auxiliaryCoefficients_(aux)
+    {
+        NF_ASSERT(matrix.exec() == rhs.exec(), "Executors are not the same");
+        NF_ASSERT(matrix.nRows() == rhs.size(), "Matrix and RHS size mismatch");
+    };
+
+    LinearSystem(
+        const CSRMatrix<ValueType, IndexType>& matrix,
+        const Vector<ValueType>& rhs,
+        const BoundaryCoefficients<ValueType, IndexType>& bcCoeffs,
+        const Dictionary& aux = {}
+    )
+        : matrix_(matrix), rhs_(rhs), boundaryCoefficients_(bcCoeffs), auxiliaryCoefficients_(aux)
     {
         NF_ASSERT(matrix.exec() == rhs.exec(), "Executors are not the same");
+        NF_ASSERT(matrix.exec() == bcCoeffs.matrixValues.exec(), "Executors are not the same");
         NF_ASSERT(matrix.nRows() == rhs.size(), "Matrix and RHS size mismatch");
     };
 
     LinearSystem(const LinearSystem& ls)
-        : matrix_(ls.matrix_), rhs_(ls.rhs_), auxiliaryCoefficients_(ls.auxiliaryCoefficients_) {};
+        : matrix_(ls.matrix_), rhs_(ls.rhs_), boundaryCoefficients_(ls.boundaryCoefficients_),
+          auxiliaryCoefficients_(ls.auxiliaryCoefficients_) {};
 
-    LinearSystem(const Executor exec) : matrix_(exec), rhs_(exec, 0), auxiliaryCoefficients_() {}
+    LinearSystem(const Executor exec)
+        : matrix_(exec), rhs_(exec, 0), boundaryCoefficients_(), auxiliaryCoefficients_()
+    {}
 
     ~LinearSystem() = default;
 
@@ -85,13 +130,29 @@ public:
 
     [[nodiscard]] LinearSystem copyToHost() const
     {
+        if (boundaryCoefficients_)
+        {
+            return LinearSystem(
+                matrix_.copyToHost(), rhs_.copyToHost(), boundaryCoefficients_->copyToHost()
+            );
+        }
         return LinearSystem(matrix_.copyToHost(), rhs_.copyToHost());
     }
 
-    void reset()
+    /* @brief zeros the matrix, rhs and boundary coefficient values on the executor
+     *
+     * The sparsity and the boundary coefficient indices are kept, hence the linear system can be
+     * reassembled without any allocation.
+     */
+    void resetValues()
     {
         fill(matrix_.values(), zero<ValueType>());
         fill(rhs_, zero<ValueType>());
+        if (boundaryCoefficients_)
+        {
+            fill(boundaryCoefficients_->matrixValues, zero<ValueType>());
+            fill(boundaryCoefficients_->rhsValues, zero<ValueType>());
+        }
     }
 
     [[nodiscard]] LinearSystemView<ValueType, IndexType> view() && = delete;
@@ -110,15 +171,44 @@ public:
 
     const Executor& exec() const { return matrix_.exec(); }
 
+    [[nodiscard]] bool hasBoundaryCoefficients() const { return boundaryCoefficients_.has_value(); }
+
+    // TODO move to fvcc
+    [[nodiscard]] const BoundaryCoefficients<ValueType, IndexType>& boundaryCoefficients() const
+    {
+        NF_DEBUG_ASSERT(boundaryCoefficients_, "Linear system has no boundary coefficients");
+        return *boundaryCoefficients_;
+    }
+
+    [[nodiscard]] BoundaryCoefficients<ValueType, IndexType>& boundaryCoefficients()
+    {
+        NF_DEBUG_ASSERT(boundaryCoefficients_, "Linear system has no boundary coefficients");
+        return *boundaryCoefficients_;
+    }
+
     // TODO move to fvcc
     [[nodiscard]] const Dictionary& auxiliaryCoefficients() const { return auxiliaryCoefficients_; }
 
     [[nodiscard]] Dictionary& auxiliaryCoefficients() { return auxiliaryCoefficients_; }
 
+    /* @brief the bytes allocated by the matrix, the rhs and the boundary coefficients */
+    [[nodiscard]] std::size_t memoryBytes() const
+    {
+        return matrix_.memoryBytes() + rhs_.memoryBytes()
+             + NeoN::memoryBytes(boundaryCoefficients_);
+    }
+
+    /* @brief adds the linear system to the linear systems of a memory report */
+    void reportMemory(MemoryReport& report, const std::string& name) const
+    {
+        report.add("linear systems", name, memoryBytes());
+    }
+
 private:
 
     CSRMatrix<ValueType, IndexType> matrix_;
     Vector<ValueType> rhs_;
+    std::optional<BoundaryCoefficients<ValueType, IndexType>> boundaryCoefficients_;
     Dictionary auxiliaryCoefficients_;
 };
 
@@ -138,6 +228,9 @@ convertLinearSystem(const LinearSystem<ValueTypeIn, IndexTypeIn>& ls)
 
 /*@brief helper function that creates a zero initialised linear system based on given sparsity
  * pattern
+ *
+ * The auxiliary coefficients hold a pointer to the mesh under the key mesh, eg. for solvers
+ * agglomerating the cells, thus the mesh has to outlive the linear system.
  */
 template<typename ValueType, typename IndexType>
 LinearSystem<ValueType, IndexType>
@@ -153,14 +246,13 @@ createEmptyLinearSystem(const UnstructuredMesh& mesh, const SparsityPattern& spa
         views(sparsity.diagOffset(), sparsity.rowOffs(), mesh.boundaryMesh().faceCells());
 
     BoundaryCoefficients<ValueType, IndexType> bcCoeffs {
-        Vector<ValueType>(exec, nBoundaryFaces),
+        Vector<ValueType>(exec, nBoundaryFaces, zero<ValueType>()),
         Vector<IndexType>(exec, nBoundaryFaces),
-        Vector<ValueType>(exec, nBoundaryFaces),
+        Vector<ValueType>(exec, nBoundaryFaces, zero<ValueType>()),
         Vector<IndexType>(exec, nBoundaryFaces)
     };
 
-    auto [mValue, mColIdx, rhsValue, rhsIdx] =
-        views(bcCoeffs.matrixValues, bcCoeffs.matrixIdxs, bcCoeffs.rhsValues, bcCoeffs.rhsIdxs);
+    auto [mColIdx, rhsIdx] = views(bcCoeffs.matrixIdxs, bcCoeffs.rhsIdxs);
 
     parallelFor(
         exec,
@@ -168,24 +260,124 @@ createEmptyLinearSystem(const UnstructuredMesh& mesh, const SparsityPattern& spa
         KOKKOS_LAMBDA(const localIdx bfacei) {
             localIdx celli = faceCells[bfacei];
 
-            mValue[bfacei] = zero<ValueType>();
             mColIdx[bfacei] = celli + diagOffset[celli];
-            rhsValue[bfacei] = zero<ValueType>();
             rhsIdx[bfacei] = celli;
-        }
+        },
+        "setBoundaryCoefficientIdxs"
     );
 
-    Dictionary aux;
-    aux.insert("boundaryCoefficients", bcCoeffs);
-
     return {
         CSRMatrix<ValueType, IndexType> {
             Vector<ValueType>(exec, nnzs, zero<ValueType>()), sparsity.colIdxs(), sparsity.rowOffs()
         },
         Vector<ValueType> {exec, rows, zero<ValueType>()},
-        aux
+        bcCoeffs,
+        Dictionary {{"mesh", &mesh}}
     };
 }
 
+/*@brief returns the linear system of the given mesh stored in the stencil database
+ *
+ * The linear system is created from the sparsity pattern of the mesh on the first call only.
+ * Subsequent calls reset the values to zero and return the stored linear system, hence the
+ * structure is allocated once per mesh and value type.
+ */
+template<typename ValueType, typename IndexType>
+LinearSystem<ValueType, IndexType>& readOrCreateLinearSystem(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<LinearSystem<ValueType, IndexType>> key(
+        "LinearSystem<" + demangle(typeid(ValueType).name()) + ","
+        + demangle(typeid(IndexType).name()) + ">"
+    );
+    bool created = false;
+    auto& ls = mesh.stencilDB().getOrCreate(
+        key,
+        [&]()
+        {
+            created = true;
+            const auto& sparsity = SparsityPattern::readOrCreate(mesh);
+            return createEmptyLinearSystem<ValueType, IndexType>(mesh, sparsity);
+        }
+    );
+    if (!created)
+    {
+        ls.resetValues();
+    }
+    return ls;
+}
+
+/*@brief returns the linear system of an equation on the given mesh stored in the stencil database
+ *
+ * Like readOrCreateLinearSystem of the mesh, but every equation owns its linear system, hence the
+ * system stays valid while other equations on the mesh are assembled, eg. by concurrent tasks.
+ *
+ * @param mesh, the mesh of the linear system
+ * @param name, the name of the equation, usually the name of the solution field
+ */
+template<typename ValueType, typename IndexType>
+LinearSystem<ValueType, IndexType>&
+readOrCreateLinearSystem(const UnstructuredMesh& mesh, const std::string& name)
+{
+    bool created = false;
+    auto& ls = mesh.stencilDB().getOrCreate<LinearSystem<ValueType, IndexType>>(
+        "LinearSystem<" + demangle(typeid(ValueType).name()) + ","
+            + demangle(typeid(IndexType).name()) + ">::" + name,
+        [&]()
+        {
+            created = true;
+            const auto& sparsity = SparsityPattern::readOrCreate(mesh);
+            return createEmptyLinearSystem<ValueType, IndexType>(mesh, sparsity);
+        }
+    );
+    if (!created)
+    {
+        ls.resetValues();
+    }
+    return ls;
+}
+
+/*@brief replaces the rows of the inactive cells by the identity with the current values as rhs
+ *
+ * Does nothing for a mesh without an active region, see ActiveRegion. The inactive cells keep
+ * their values in the solve, whereas the active cells still read them through their
+ * coefficients. Called after the assembly, since the operators add to the rows of all cells.
+ *
+ * @param ls, the assembled linear system
+ * @param mesh, the mesh of the linear system
+ * @param values, the current values of all cells
+ */
+template<typename ValueType, typename IndexType>
+void freezeInactiveRows(
+    LinearSystem<ValueType, IndexType>& ls,
+    const UnstructuredMesh& mesh,
+    const Vector<ValueType>& values
+)
+{
+    const auto* region = mesh.activeRegion();
+    if (!region)
+    {
+        return;
+    }
+    NF_ASSERT(values.size() >= ls.rhs().size(), "The values need to cover all rows.");
+    const auto [rows, x, colIdxs, rowOffs] = views(
+        region->inactiveCells(), values, ls.matrix().colIdxs(), ls.matrix().rowOffs()
+    );
+    auto [matValues, rhs] = views(ls.matrix().values(), ls.rhs());
+    parallelFor(
+        ls.exec(),
+        {0, rows.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            const auto rowi = rows[i];
+            for (auto j = rowOffs[rowi]; j < rowOffs[rowi + 1]; j++)
+            {
+                matValues[j] = static_cast<localIdx>(colIdxs[j]) == rowi ? one<ValueType>()
+                                                                        : zero<ValueType>();
+            }
+            rhs[rowi] = x[rowi];
+        },
+        "freezeInactiveRows"
+    );
+}
+
 
 } // namespace NeoN::la
@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/CSRMatrix.hpp"
+#include "NeoN/linearAlgebra/agglomeration.hpp"
+#include "NeoN/linearAlgebra/gaussSeidel.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+
+namespace NeoN::la
+{
+
+/* @brief the smoothers of the multigrid cycle */
+enum class MultigridSmoother
+{
+    Jacobi,              /**< Damped Jacobi, selected by jacobi. */
+    GaussSeidel,         /**< Multicolor Gauss-Seidel, forward before and backward after the
+                              coarse grid correction, selected by gaussSeidel. */
+    SymmetricGaussSeidel /**< Multicolor Gauss-Seidel with a forward and a backward pass in
+                              every sweep, selected by symmetricGaussSeidel. */
+};
+
+/* @brief the parameters of the multigrid hierarchy and cycle
+ *
+ * The keys of the solver dictionary with their defaults are given in brackets.
+ */
+struct MultigridSettings
+{
+    localIdx maxLevels {25};     // maxLevels, including the finest level
+    localIdx maxCoarseRows {16}; // maxCoarseRows, stop coarsening below this size
+    int preSweeps {1};           // preSweeps, smoother sweeps before the coarse grid correction
+    int postSweeps {1};          // postSweeps, smoother sweeps after the coarse grid correction
+    int coarsestSweeps {20};     // coarsestSweeps, smoother sweeps on the coarsest level
+    scalar relaxation {0.7};     // relaxation, damping factor of the Jacobi smoother
+
+    // smoother, jacobi, gaussSeidel or symmetricGaussSeidel (jacobi)
+    MultigridSmoother smoother {MultigridSmoother::Jacobi};
+
+    /* @brief reads the settings from a solver dictionary, missing keys keep their defaults */
+    static MultigridSettings read(const Dictionary& dict);
+};
+
+/* @struct MultigridLevel
+ * @brief the operator of one level and its restriction to the next coarser level
+ *
+ * The prolongation is piecewise constant over the aggregates, thus the restriction is its
+ * transpose and the Galerkin coarse operator R A P reduces to summing the entries of A coupling
+ * two aggregates. These sums are stored as segments of the entries of A per coarse entry, so
+ * refreshing the coarse operator is an atomic free gather.
+ */
+struct MultigridLevel
+{
+    CSRMatrix<scalar, localIdx> matrix;
+
+    Vector<localIdx> diagIdxs; // position of the diagonal entry of every row in the matrix
+
+    Vector<scalar> invDiag; // the inverse diagonal used by the smoother
+
+    Vector<localIdx> aggregates; // the coarse row of every row, empty on the coarsest level
+
+    SegmentedVector<localIdx, localIdx> aggregateRows; // the rows of every coarse row
+
+    SegmentedVector<localIdx, localIdx> coarseEntries; // the entries summed per coarse entry
+
+    Vector<scalar> rhs; // the restricted residual, unused on the finest level
+
+    Vector<scalar> x; // the coarse grid correction, unused on the finest level
+
+    Vector<scalar> res; // the residual of the level
+
+    MatrixColoring coloring; // the coloring of the rows, only used by Gauss-Seidel
+
+    std::size_t memoryBytes() const
+    {
+        return matrix.memoryBytes() + diagIdxs.memoryBytes() + invDiag.memoryBytes()
+             + aggregates.memoryBytes() + aggregateRows.memoryBytes() + coarseEntries.memoryBytes()
+             + rhs.memoryBytes() + x.memoryBytes() + res.memoryBytes() + coloring.memoryBytes();
+    }
+};
+
+/* @class MultigridHierarchy
+ * @brief an aggregation multigrid hierarchy whose coarse operators can be refreshed
+ *
+ * The aggregates and the sparsity patterns of all levels are set up once on the host. For a
+ * matrix with the same sparsity pattern but new values, eg. the matrix of the next time step,
+ * refresh recomputes only the values of the coarse operators on the executor.
+ */
+class MultigridHierarchy
+{
+public:
+
+    /* @brief builds the hierarchy by repeated pairwise aggregation along the strongest couplings,
+     * ie. the largest absolute off diagonal entries
+     */
+    MultigridHierarchy(const CSRMatrix<scalar, localIdx>& mtx, const MultigridSettings& settings);
+
+    /* @brief builds the hierarchy from the aggregates of a geometric agglomeration
+     *
+     * The rows of mtx have to be the cells of the agglomerated mesh.
+     */
+    MultigridHierarchy(
+        const CSRMatrix<scalar, localIdx>& mtx,
+        const FaceAgglomeration& agglomeration,
+        const MultigridSettings& settings
+    );
+
+    /* @brief checks whether mtx has the sparsity pattern of the finest level
+     *
+     * The pattern is identified by the versions of the column indices and row offsets of the
+     * matrix last matched, for other versions it is compared entry by entry on the executor.
+     */
+    bool matches(const CSRMatrix<scalar, localIdx>& mtx) const;
+
+    /* @brief copies the values of mtx to the finest level and recomputes the coarse operators
+     *
+     * mtx has to have the sparsity pattern the hierarchy was built for.
+     */
+    void refresh(const CSRMatrix<scalar, localIdx>& mtx);
+
+    /* @brief applies one V-cycle to A x = rhs with zero initial guess, ie. x = M^-1 rhs */
+    void apply(const Vector<scalar>& rhs, Vector<scalar>& x);
+
+    localIdx nLevels() const { return static_cast<localIdx>(levels_.size()); }
+
+    const MultigridLevel& level(localIdx leveli) const
+    {
+        return levels_[static_cast<std::size_t>(leveli)];
+    }
+
+    /* @brief the bytes of all levels, including the copy of the finest matrix */
+    std::size_t memoryBytes() const { return NeoN::memoryBytes(levels_); }
+
+private:
+
+    /* @brief returns the aggregates of the rows of a level given on the host, an empty vector
+     * stops the coarsening
+     */
+    using Aggregation =
+        std::function<std::vector<localIdx>(std::size_t, const CSRMatrix<scalar, localIdx>&)>;
+
+    /* @brief sets up the levels until the aggregation stops or the limits of the settings are
+     * reached and computes the coarse operators
+     */
+    void build(const CSRMatrix<scalar, localIdx>& mtx, const Aggregation& aggregation);
+
+    /* @brief applies the smoother of the settings, the direction is used by Gauss-Seidel */
+    void smooth(
+        MultigridLevel& level,
+        const Vector<scalar>& rhs,
+        Vector<scalar>& x,
+        int sweeps,
+        SweepDirection direction
+    ) const;
+
+    /* @brief applies the V-cycle starting at leveli recursively */
+    void cycle(std::size_t leveli, const Vector<scalar>& rhs, Vector<scalar>& x);
+
+    MultigridSettings settings_;
+    std::vector<MultigridLevel> levels_;
+    mutable std::size_t colIdxsVersion_ {0}; // versions of the pattern of the last matched matrix
+    mutable std::size_t rowOffsVersion_ {0};
+};
+
+/* @class Multigrid
+ * @brief a native aggregation multigrid solver which keeps its hierarchy between solves
+ *
+ * The hierarchy is built on the first solve and reused as long as the sparsity pattern of the
+ * matrix is unchanged, only the coarse operators are refreshed by a Galerkin product on every
+ * solve. Besides the keys of MultigridSettings the solver dictionary understands:
+ *  - krylov: cg to precondition a conjugate gradient method with one V-cycle, or none to
+ *    iterate V-cycles (default cg)
+ *  - maxIters: the maximum number of iterations (default 100)
+ *  - relTol: the residual norm reduction at which the solve stops (default 1e-6)
+ *  - absTol: the residual norm at which the solve stops (default 0)
+ *  - rebuildHierarchyEvery: rebuild the hierarchy every N solves, zero keeps it as long as the
+ *    sparsity pattern is unchanged (default 0)
+ *  - agglomeration: algebraic to pair rows along the strongest matrix couplings, or faceArea
+ *    to pair cells across their largest faces, see FaceAgglomeration (default algebraic). The
+ *    latter requires the mesh in the auxiliary coefficients of the system, see
+ *    createEmptyLinearSystem.
+ *
+ * The conjugate gradient method requires a symmetric matrix, eg. a pressure equation, and for
+ * the gaussSeidel smoother the same number of pre and post sweeps.
+ */
+class Multigrid : public SolverFactory::template Register<Multigrid>
+{
+    using Base = SolverFactory::template Register<Multigrid>;
+
+public:
+
+    Multigrid(const Executor& exec, const Dictionary& solverConfig);
+
+    /* @brief copy constructor, the hierarchy is not shared between copies */
+    Multigrid(const Multigrid& other);
+
+    static std::string name() { return "Multigrid"; }
+
+    static std::string doc() { return "Aggregation multigrid with hierarchy reuse"; }
+
+    static std::string schema() { return "none"; }
+
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final;
+
+    using Base::solve;
+
+    virtual std::unique_ptr<SolverFactory> clone() const final
+    {
+        return std::make_unique<Multigrid>(*this);
+    }
+
+    /* @brief the hierarchy of the last solve, nullptr before the first solve */
+    const MultigridHierarchy* hierarchy() const { return hierarchy_.get(); }
+
+    virtual std::size_t memoryBytes() const final { return NeoN::memoryBytes(hierarchy_); }
+
+private:
+
+    /* @brief builds or refreshes the hierarchy for the matrix of the system */
+    void updateHierarchy(const LinearSystem<scalar, localIdx>& sys) const;
+
+    MultigridSettings settings_;
+    bool useCG_;
+    int maxIters_;
+    scalar relTol_;
+    scalar absTol_;
+    int rebuildEvery_;
+    bool faceAgglomeration_;
+
+    mutable std::unique_ptr<MultigridHierarchy> hierarchy_ {nullptr};
+    mutable int solvesSinceRebuild_ {0};
+};
+
+}
@@ -6,6 +6,8 @@
 
 #if NF_WITH_PETSC
 
+#include <vector>
+
 #include <Kokkos_Core.hpp>
 #include <petscvec_kokkos.hpp>
 #include <petscmat.h>
@@ -34,6 +36,28 @@ class petscSolver : public SolverFactory::template Register<petscSolver>
 private:
 
     Dictionary solverDict_;
+
+    NeoN::la::petscSolverContext::PreconditionerReuse reuse_;
+
+    // NOTE the context is not shared between copies
+    mutable std::unique_ptr<NeoN::la::petscSolverContext::petscSolverContext<scalar>> petsctx_ {
+        nullptr
+    };
+
+    /* @brief creates the context on the first solve or a structural change and sets the values
+     */
+    void prepareContext(const LinearSystem<scalar, localIdx>& sys) const
+    {
+        if (!petsctx_ || !petsctx_->matches(sys))
+        {
+            petsctx_ = std::make_unique<NeoN::la::petscSolverContext::petscSolverContext<scalar>>(
+                exec_, reuse_
+            );
+            petsctx_->initialize(sys);
+        }
+        petsctx_->update(sys);
+    }
+
     // Mat Amat_;
     // KSP ksp_;
 
@@ -48,7 +72,9 @@ private:
 
 public:
 
-    petscSolver(Executor exec, Dictionary solverDict) : Base(exec), solverDict_(solverDict)
+    petscSolver(Executor exec, Dictionary solverDict)
+        : Base(exec), solverDict_(solverDict),
+          reuse_(NeoN::la::petscSolverContext::PreconditionerReuse::read(solverDict))
     //, Amat_(nullptr), ksp_(nullptr), sol_(nullptr),
     //  rhs_(nullptr),petsctx_(exec_)
     //, db_(db), eqnName_(eqnName)
@@ -65,67 +91,236 @@ public:
 
     static std::string name() { return "Petsc"; }
 
-    static std::string doc() { return "TBD"; }
+    static std::string doc()
+    {
+        return "Solves with a PETSc KSP configured from the PETSc options, the KSP and its "
+               "preconditioner are kept between the solves of an equation, see "
+               "PreconditionerReuse for the optional keys";
+    }
+
+    /* @brief the number of setups of the preconditioner since the last structural change
+     *
+     * Zero before the first solve.
+     */
+    std::size_t nPreconditionerSetups() const { return petsctx_ ? petsctx_->nSetups() : 0; }
 
     static std::string schema() { return "none"; }
 
     // TODO why use a smart pointer here?
     virtual std::unique_ptr<SolverFactory> clone() const final
     {
-        NF_ERROR_EXIT("Not implemented");
-        return {};
+        return std::make_unique<petscSolver>(exec_, solverDict_);
     }
 
 
+    // Vec3 systems are solved segregated by the default of the SolverFactory
+    using Base::solve;
+
+    /* @brief solves the system, the COO preallocation is kept between solves
+     *
+     * The PETSc objects are created on the first solve and whenever the structure of the matrix
+     * changes. All other solves only set the values of the matrix and the rhs, the
+     * preconditioner is set up again as controlled by the reuse policy of the dictionary. With
+     * initialGuessNonzero x is the initial guess.
+     */
     virtual SolverStats
     solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final
     {
-
-        Mat Amat;
-        KSP ksp;
-
-        Vec sol, rhs;
-
-        NeoN::la::petscSolverContext::petscSolverContext<scalar> petsctx(exec_);
-
+        PhaseTimer timer;
         std::size_t nrows = sys.rhs().size();
 
-        petsctx.initialize(sys);
-
-        Amat = petsctx.AMat();
-        rhs = petsctx.rhs();
-        sol = petsctx.sol();
-        ksp = petsctx.ksp();
+        prepareContext(sys);
+        petsctx_->setInitialGuess(x);
 
-        VecSetValuesCOO(rhs, sys.rhs().data(), ADD_VALUES);
-        MatSetValuesCOO(Amat, sys.matrix().values().data(), ADD_VALUES);
+        KSP& ksp = petsctx_->ksp();
+        Vec& rhs = petsctx_->rhs();
+        Vec& sol = petsctx_->sol();
+        SolverTimings timings {timer.lap(), 0.0, 0.0, 0.0};
 
-        // MatView(Amat_, PETSC_VIEWER_STDOUT_WORLD);
-        // VecView(rhs_, PETSC_VIEWER_STDOUT_WORLD);
+        PetscCallAbort(PETSC_COMM_WORLD, KSPSolve(ksp, rhs, sol));
+        timings.applyTime = timer.lap();
 
+        auto numIter = 0;
+        KSPGetIterationNumber(ksp, &numIter);
+        petsctx_->recordSolve(numIter);
 
-        // KSPCreate(PETSC_COMM_WORLD, &ksp_);
-        KSPSetOperators(ksp, Amat, Amat);
-        // KSPSetTolerances(ksp, 1.e-9, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);
-        // KSPSetFromOptions(ksp_);
-        // KSPSetUp(ksp);
+        // the solution of a VECKOKKOS is copied device to device, without a sync to the host
+        const PetscScalar* solData;
+        PetscMemType memType;
+        VecGetArrayReadAndMemType(sol, &solData, &memType);
+        const Executor solExec = PetscMemTypeHost(memType) ? Executor(SerialExecutor {}) : exec_;
+        x = Vector<scalar>(x.exec(), static_cast<const scalar*>(solData), nrows, solExec);
+        VecRestoreArrayReadAndMemType(sol, &solData);
+        timings.transferTime = timer.lap();
 
+        // TODO residual norms are missing
+        return {numIter, 0.0, 0.0, timer.total(), timings};
+    }
 
-        PetscCallVoid(KSPSolve(ksp, rhs, sol));
+    /* @brief solves all columns of b with KSPMatSolve, which shares the operators and the
+     * preconditioner between the columns
+     *
+     * PETSc stores dense matrices column major on the host, thus the blocks are transposed on the
+     * host. The residual norms are not reported.
+     */
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& sys, const DenseBlock& b, DenseBlock& x) const final
+    {
+        NF_ASSERT_EQUAL(b.nRows(), sys.rhs().size());
+        NF_ASSERT_EQUAL(b.nRows(), x.nRows());
+        NF_ASSERT_EQUAL(b.nCols(), x.nCols());
+        PhaseTimer timer;
+        const auto nRows = b.nRows();
+        const auto nCols = b.nCols();
+
+        prepareContext(sys);
+        KSP& ksp = petsctx_->ksp();
+
+        // the column major copies of the blocks
+        auto hostB = b.values().copyToHost();
+        auto hostX = x.values().copyToHost();
+        std::vector<PetscScalar> bValues(static_cast<std::size_t>(nRows * nCols));
+        std::vector<PetscScalar> xValues(bValues.size());
+        auto [hostBV, hostXV] = views(hostB, hostX);
+        for (localIdx i = 0; i < nRows; i++)
+        {
+            for (localIdx j = 0; j < nCols; j++)
+            {
+                const auto idx = static_cast<std::size_t>(j * nRows + i);
+                bValues[idx] = hostBV[i * nCols + j];
+                xValues[idx] = hostXV[i * nCols + j];
+            }
+        }
+        Mat B;
+        Mat X;
+        const auto m = static_cast<PetscInt>(nRows);
+        const auto n = static_cast<PetscInt>(nCols);
+        MatCreateSeqDense(PETSC_COMM_SELF, m, n, bValues.data(), &B);
+        MatCreateSeqDense(PETSC_COMM_SELF, m, n, xValues.data(), &X);
+        SolverTimings timings {timer.lap(), 0.0, 0.0, 0.0};
+
+        PetscCallAbort(PETSC_COMM_WORLD, KSPMatSolve(ksp, B, X));
+        timings.applyTime = timer.lap();
 
         auto numIter = 0;
         KSPGetIterationNumber(ksp, &numIter);
+        petsctx_->recordSolve(numIter);
+
+        const PetscScalar* xHost;
+        MatDenseGetArrayRead(X, &xHost);
+        for (localIdx i = 0; i < nRows; i++)
+        {
+            for (localIdx j = 0; j < nCols; j++)
+            {
+                hostXV[i * nCols + j] = xHost[j * nRows + i];
+            }
+        }
+        MatDenseRestoreArrayRead(X, &xHost);
+        MatDestroy(&B);
+        MatDestroy(&X);
+        x.values() = Vector<scalar>(x.exec(), hostX.data(), hostX.size(), SerialExecutor {});
+        timings.transferTime = timer.lap();
+
+        return {numIter, 0.0, 0.0, timer.total(), timings};
+    }
 
+#ifdef NF_WITH_MPI_SUPPORT
+    /* @brief solves a distributed system with a parallel AIJ matrix on its MPI communicator
+     *
+     * The matrix is preallocated from the global COO representation, PETSc communicates the
+     * interface coefficients to the owning ranks.
+     */
+    virtual SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final
+    {
+        const auto& numbering = sys.numbering();
+        MPI_Comm comm = sys.mpiEnvironment().comm();
+        PetscInt nLocal = static_cast<PetscInt>(numbering.nLocalRows());
+        PetscInt nGlobal = static_cast<PetscInt>(numbering.nGlobalRows());
+
+        Vector<globalIdx> cooRows(sys.exec(), 0);
+        Vector<globalIdx> cooCols(sys.exec(), 0);
+        Vector<scalar> cooValues(sys.exec(), 0);
+        sys.globalCOOIdxs(cooRows, cooCols);
+        sys.cooValues(cooValues);
+        // the global indices are converted on the executor, PETSc copies device indices itself
+        const auto nnz = cooRows.size();
+        Vector<PetscInt> rowIdxs(sys.exec(), nnz);
+        Vector<PetscInt> colIdxs(sys.exec(), nnz);
+        Vector<PetscInt> rhsIdxs(sys.exec(), static_cast<localIdx>(nLocal));
+        {
+            const auto [rowsV, colsV] = views(cooRows, cooCols);
+            auto [rowIdxsV, colIdxsV, rhsIdxsV] = views(rowIdxs, colIdxs, rhsIdxs);
+            const auto rowOffset = static_cast<PetscInt>(numbering.rowOffset());
+            parallelFor(
+                sys.exec(),
+                {0, nnz},
+                KOKKOS_LAMBDA(const localIdx i) {
+                    rowIdxsV[i] = static_cast<PetscInt>(rowsV[i]);
+                    colIdxsV[i] = static_cast<PetscInt>(colsV[i]);
+                },
+                "petscGlobalCOOIdxs"
+            );
+            parallelFor(
+                sys.exec(),
+                {0, static_cast<localIdx>(nLocal)},
+                KOKKOS_LAMBDA(const localIdx i) {
+                    rhsIdxsV[i] = rowOffset + static_cast<PetscInt>(i);
+                },
+                "petscGlobalRhsIdxs"
+            );
+            NeoN::fence(sys.exec());
+        }
+
+        const bool gpu = std::holds_alternative<GPUExecutor>(exec_);
+        Mat Amat;
+        Vec rhs, sol;
+        KSP ksp;
+        MatCreate(comm, &Amat);
+        MatSetSizes(Amat, nLocal, nLocal, nGlobal, nGlobal);
+        MatSetType(Amat, gpu ? MATAIJKOKKOS : MATAIJ);
+        MatSetPreallocationCOO(Amat, static_cast<PetscCount>(nnz), rowIdxs.data(), colIdxs.data());
+        MatSetValuesCOO(Amat, cooValues.data(), INSERT_VALUES);
+
+        VecCreate(comm, &rhs);
+        VecSetSizes(rhs, nLocal, nGlobal);
+        VecSetType(rhs, gpu ? VECKOKKOS : VECSTANDARD);
+        VecSetPreallocationCOO(rhs, static_cast<PetscCount>(nLocal), rhsIdxs.data());
+        VecSetValuesCOO(rhs, sys.localSystem().rhs().data(), INSERT_VALUES);
+        VecDuplicate(rhs, &sol);
+
+        KSPCreate(comm, &ksp);
+        KSPSetOperators(ksp, Amat, Amat);
+        KSPSetFromOptions(ksp);
+        PetscCallAbort(comm, KSPSolve(ksp, rhs, sol));
 
-        PetscScalar* x_help = static_cast<PetscScalar*>(x.data());
-        VecGetArray(sol, &x_help);
-
-        Vector<scalar> x2(x.exec(), static_cast<scalar*>(x_help), nrows, x.exec());
-        x = x2;
-
-        // TODO residual norms are missing
-        return {numIter, 0.0, 0.0, 0.0};
+        PetscInt numIter = 0;
+        PetscReal finalResNorm = 0.0;
+        KSPGetIterationNumber(ksp, &numIter);
+        KSPGetResidualNorm(ksp, &finalResNorm);
+
+        const PetscScalar* solData;
+        PetscMemType memType;
+        VecGetArrayReadAndMemType(sol, &solData, &memType);
+        const Executor solExec = PetscMemTypeHost(memType) ? Executor(SerialExecutor {}) : exec_;
+        x = Vector<scalar>(
+            x.exec(), static_cast<const scalar*>(solData), static_cast<localIdx>(nLocal), solExec
+        );
+        VecRestoreArrayReadAndMemType(sol, &solData);
+
+        KSPDestroy(&ksp);
+        VecDestroy(&sol);
+        VecDestroy(&rhs);
+        MatDestroy(&Amat);
+        return {
+            static_cast<int>(numIter),
+            0.0,
+            static_cast<scalar>(finalResNorm),
+            0.0,
+            {0.0, 0.0, 0.0, 0.0}
+        };
     }
+#endif
 };
 
 }
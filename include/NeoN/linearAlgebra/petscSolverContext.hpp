@@ -9,12 +9,15 @@
 
 #if NF_WITH_PETSC
 
+#include <algorithm>
+
 #include <Kokkos_Core.hpp>
 #include <petscvec_kokkos.hpp>
 #include <petscmat.h>
 #include <petscksp.h>
 
 #include "NeoN/fields/field.hpp"
+#include "NeoN/core/backendRegistry.hpp"
 #include "NeoN/core/dictionary.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/linearAlgebra/utilities.hpp"
@@ -24,6 +27,40 @@
 namespace NeoN::la::petscSolverContext
 {
 
+//- Controls how long the KSP keeps its preconditioner and the initial guess of the solves
+//
+//  Read from the solver dictionary:
+//  - reusePreconditioner, the number of solves sharing a preconditioner setup, 1 sets up the
+//    preconditioner on every solve (default)
+//  - reuseIterationGrowth, the preconditioner is set up again once the iterations of a solve
+//    exceed this factor times the iterations of the solve after the last setup, 0 disables it
+//  - initialGuessNonzero, start from the given solution instead of zero
+struct PreconditionerReuse
+{
+    int maxSolves = 1;
+    scalar iterationGrowth = 0.0;
+    bool initialGuessNonzero = false;
+
+    static PreconditionerReuse read(const Dictionary& dict)
+    {
+        PreconditionerReuse reuse;
+        if (dict.contains("reusePreconditioner"))
+        {
+            reuse.maxSolves = dict.get<int>("reusePreconditioner");
+        }
+        if (dict.contains("reuseIterationGrowth"))
+        {
+            reuse.iterationGrowth = dict.get<scalar>("reuseIterationGrowth");
+        }
+        if (dict.contains("initialGuessNonzero"))
+        {
+            reuse.initialGuessNonzero = dict.get<bool>("initialGuessNonzero");
+        }
+        NF_ASSERT(reuse.maxSolves >= 1, "reusePreconditioner has to be at least one");
+        return reuse;
+    }
+};
+
 template<typename ValueType>
 class petscSolverContext
 {
@@ -31,20 +68,65 @@ class petscSolverContext
 
     bool init_, updated_;
     Executor exec_;
+    PreconditionerReuse reuse_;
+
+    // solves since the last setup of the preconditioner and the iterations of the first of them
+    int solvesSinceSetup_;
+    int setupIters_;
+    bool forceSetup_;
+    std::size_t nSetups_;
     Mat Amat_;
     KSP ksp_;
 
     Vec sol_, rhs_;
 
+    // COO indices of the matrix and the rhs, built once per matrix structure
+    Vector<PetscInt> cooRowIdxs_;
+    Vector<PetscInt> cooColIdxs_;
+    Vector<PetscInt> cooRhsIdxs_;
+
+    // column indices of the preallocated system, used to detect structural changes
+    const columnIdx* colIdxs_;
+
+    //- Build the COO indices of the matrix and the rhs on the executor
+    void createCOOIdxs(const LinearSystem<scalar, localIdx>& sys)
+    {
+        const auto nnz = sys.matrix().values().size();
+        const auto nrows = sys.rhs().size();
+        cooRowIdxs_.resize(nnz);
+        cooColIdxs_.resize(nnz);
+        cooRhsIdxs_.resize(nrows);
+        colIdxs_ = sys.matrix().colIdxs().data();
+
+        const auto [colIdxs, rowOffs] = views(sys.matrix().colIdxs(), sys.matrix().rowOffs());
+        auto [cooRowIdxs, cooColIdxs, cooRhsIdxs] = views(cooRowIdxs_, cooColIdxs_, cooRhsIdxs_);
+
+        parallelFor(
+            exec_,
+            {0, nrows},
+            KOKKOS_LAMBDA(const localIdx rowi) {
+                for (localIdx j = rowOffs[rowi]; j < rowOffs[rowi + 1]; j++)
+                {
+                    cooRowIdxs[j] = static_cast<PetscInt>(rowi);
+                    cooColIdxs[j] = static_cast<PetscInt>(colIdxs[j]);
+                }
+                cooRhsIdxs[rowi] = static_cast<PetscInt>(rowi);
+            },
+            "createPetscCOOIdxs"
+        );
+    }
+
 public:
 
 
     // Constructors
 
     //- Default construct
-    petscSolverContext(Executor exec)
-        : init_(false), updated_(false), exec_(exec), Amat_(nullptr), sol_(nullptr), rhs_(nullptr),
-          ksp_(nullptr)
+    petscSolverContext(Executor exec, PreconditionerReuse reuse = {})
+        : init_(false), updated_(false), exec_(exec), reuse_(reuse), solvesSinceSetup_(0),
+          setupIters_(0), forceSetup_(true), nSetups_(0), Amat_(nullptr), ksp_(nullptr),
+          sol_(nullptr), rhs_(nullptr), cooRowIdxs_(exec, 0), cooColIdxs_(exec, 0),
+          cooRhsIdxs_(exec, 0), colIdxs_(nullptr)
     {}
 
 
@@ -67,54 +149,41 @@ public:
     //- Return value of initialized
     bool updated() const noexcept { return updated_; }
 
-    //- Create auxiliary rows for calculation purposes
+    //- Return whether the preallocation matches the structure of the given system
+    bool matches(const LinearSystem<scalar, localIdx>& sys) const
+    {
+        return init_ && cooRowIdxs_.size() == sys.matrix().values().size()
+            && cooRhsIdxs_.size() == sys.rhs().size() && colIdxs_ == sys.matrix().colIdxs().data();
+    }
+
+    //- Create the PETSc objects and the COO preallocation of the system
     void initialize(const LinearSystem<scalar, localIdx>& sys)
     {
+        MatDestroy(&Amat_);
+        KSPDestroy(&ksp_);
+        VecDestroy(&sol_);
+        VecDestroy(&rhs_);
+
         std::size_t size = sys.matrix().values().size();
         std::size_t nrows = sys.rhs().size();
-        PetscInt colIdx[size];
-        PetscInt rowIdx[size];
-        PetscInt rhsIdx[nrows];
-
-        // colIdx = sys.matrix().colIdxs().data();
-
-        auto hostLS = sys.copyToHost();
 
-        // auto fieldS = field.view();
+        // the indices stay in the memory of the executor, PETSc detects device memory and
+        // copies the indices itself, thus the system is not copied to the host
+        createCOOIdxs(sys);
 
-        auto rowPtrHost = hostLS.matrix().rowOffs().view();
-        auto colIdxHost = hostLS.matrix().colIdxs().view();
-        auto rhsHost = sys.rhs().copyToHost();
-
-        for (size_t index = 0; index < nrows; ++index)
-        {
-            rhsIdx[index] = static_cast<PetscInt>(index);
-        }
-        // copy colidx
-        // TODO: (this should be done only once when the matrix
-        //  topology changes
-        for (size_t index = 0; index < size; ++index)
-        {
-            colIdx[index] = static_cast<PetscInt>(colIdxHost[index]);
-        }
-        // convert rowPtr to rowIdx
-        // TODO: (this should be done only once when the matrix
-        //  topology changes
-        size_t rowI = 0;
-        size_t rowOffset = rowPtrHost[rowI + 1];
-        for (size_t index = 0; index < size; ++index)
-        {
-            if (index == rowOffset)
+        // PETSc is initialized once per process, its initialization is timed by the registry
+        BackendRegistry::instance().initializeOnce(
+            "PETSc",
+            []()
             {
-                rowI++;
-                rowOffset = rowPtrHost[rowI + 1];
+                PetscBool petscInitialized;
+                PetscInitialized(&petscInitialized);
+                if (!petscInitialized)
+                {
+                    PetscInitialize(NULL, NULL, 0, NULL);
+                }
             }
-            rowIdx[index] = rowI;
-        }
-
-        // move all not necessary staff to outer most scope since matrix  has
-        // to be preallocated only once every time the mesh changes
-        PetscInitialize(NULL, NULL, 0, NULL);
+        );
 
         MatCreate(PETSC_COMM_WORLD, &Amat_);
         MatSetSizes(Amat_, sys.matrix().nRows(), sys.rhs().size(), PETSC_DECIDE, PETSC_DECIDE);
@@ -136,19 +205,79 @@ public:
         }
         VecDuplicate(rhs_, &sol_);
 
-        VecSetPreallocationCOO(rhs_, nrows, rhsIdx);
-        MatSetPreallocationCOO(Amat_, size, colIdx, rowIdx);
+        // the kernels building the indices have to be complete, PETSc reads them from its own
+        // stream or the host
+        NeoN::fence(exec_);
+        VecSetPreallocationCOO(rhs_, nrows, cooRhsIdxs_.data());
+        VecSetPreallocationCOO(sol_, nrows, cooRhsIdxs_.data());
+        MatSetPreallocationCOO(Amat_, size, cooRowIdxs_.data(), cooColIdxs_.data());
 
         KSPCreate(PETSC_COMM_WORLD, &ksp_);
         KSPSetFromOptions(ksp_);
         KSPSetOperators(ksp_, Amat_, Amat_);
-
+        KSPSetInitialGuessNonzero(ksp_, reuse_.initialGuessNonzero ? PETSC_TRUE : PETSC_FALSE);
 
         init_ = true;
+        updated_ = false;
+        forceSetup_ = true;
+    }
+
+    //- Set the values of the matrix and the rhs, requires a matching preallocation
+    void update(const LinearSystem<scalar, localIdx>& sys)
+    {
+        NF_ASSERT(matches(sys), "The PETSc preallocation does not match the linear system");
+        // the values are copied device to device for the Kokkos types, after the assembly
+        NeoN::fence(exec_);
+        VecSetValuesCOO(rhs_, sys.rhs().data(), INSERT_VALUES);
+        MatSetValuesCOO(Amat_, sys.matrix().values().data(), INSERT_VALUES);
+        // the operators are set again, which triggers the setup of the preconditioner unless
+        // it is reused
+        const bool setup = needsSetup();
+        KSPSetReusePreconditioner(ksp_, setup ? PETSC_FALSE : PETSC_TRUE);
+        KSPSetOperators(ksp_, Amat_, Amat_);
+        if (setup)
+        {
+            solvesSinceSetup_ = 0;
+            forceSetup_ = false;
+            nSetups_++;
+        }
+        updated_ = true;
+    }
+
+    //- Set the initial guess of the next solve, only used with initialGuessNonzero
+    void setInitialGuess(const Vector<scalar>& x)
+    {
+        if (reuse_.initialGuessNonzero)
+        {
+            NeoN::fence(exec_);
+            VecSetValuesCOO(sol_, x.data(), INSERT_VALUES);
+        }
+    }
+
+    //- Record the iterations of a solve, a growth beyond the threshold forces the next setup
+    void recordSolve(int numIter)
+    {
+        if (solvesSinceSetup_ == 0)
+        {
+            setupIters_ = numIter;
+        }
+        solvesSinceSetup_++;
+        if (reuse_.iterationGrowth > 0.0
+            && static_cast<scalar>(numIter)
+                   > reuse_.iterationGrowth * static_cast<scalar>(std::max(setupIters_, 1)))
+        {
+            forceSetup_ = true;
+        }
+    }
+
+    //- Return whether the next update sets up the preconditioner
+    bool needsSetup() const noexcept
+    {
+        return forceSetup_ || solvesSinceSetup_ >= reuse_.maxSolves;
     }
 
-    //- Create auxiliary rows for calculation purposes
-    void update() { NF_ERROR_EXIT("Mesh changes not supported"); }
+    //- Return the number of setups of the preconditioner
+    std::size_t nSetups() const noexcept { return nSetups_; }
 
     [[nodiscard]] Mat& AMat() { return Amat_; }
 
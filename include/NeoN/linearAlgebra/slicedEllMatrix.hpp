@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/CSRMatrix.hpp"
+
+namespace NeoN::la
+{
+
+/**
+ * @struct SlicedEllMatrixView
+ * @brief A view struct to allow easy read/write on all executors.
+ *
+ * @tparam ValueType The value type of the stored entries.
+ * @tparam IndexType The index type of the rows and columns.
+ */
+template<typename ValueType, typename IndexType>
+struct SlicedEllMatrixView
+{
+    /**
+     * @brief Offset of the j-th stored entry of a row.
+     * @param row The row index.
+     * @param j The index of the entry within the row.
+     */
+    KOKKOS_INLINE_FUNCTION
+    std::remove_const_t<IndexType> offset(const IndexType row, const IndexType j) const
+    {
+        const IndexType slice = row / sliceSize;
+        return (sliceSets[slice] + j) * sliceSize + row % sliceSize;
+    }
+
+    /**
+     * @brief Number of stored entries of a row, including padding.
+     * @param row The row index.
+     */
+    KOKKOS_INLINE_FUNCTION
+    std::remove_const_t<IndexType> rowLength(const IndexType row) const
+    {
+        return sliceLengths[row / sliceSize];
+    }
+
+    View<ValueType> values;                   //!< View to the values, column major per slice.
+    View<IndexType> colIdxs;                  //!< View to the column indices of the values.
+    View<IndexType> sliceLengths;             //!< View to the stored entries per row of a slice.
+    View<IndexType> sliceSets;                //!< View to the first column of each slice.
+    std::remove_const_t<IndexType> sliceSize; //!< The number of rows per slice.
+};
+
+/**
+ * @class SlicedEllMatrix
+ * @brief Sparse matrix class with sliced ELLPACK storage.
+ *
+ * The rows are grouped into slices of sliceSize consecutive rows. Every row of a slice stores as
+ * many entries as the longest row of the slice, padded with zeros in column zero. Within a slice
+ * the entries are stored column major, so that threads working on consecutive rows access
+ * consecutive memory. The layout is identical to gko::matrix::Sellp with a stride factor of one,
+ * and a matrix with a single slice is identical to gko::matrix::Ell with a stride of nRows.
+ *
+ * Finite volume matrices have nearly uniform row lengths, hence the rows are not sorted by length
+ * before slicing, ie. sigma is one, which keeps the row order of the CSRMatrix.
+ *
+ * @tparam ValueType The value type of the stored entries.
+ * @tparam IndexType The index type of the rows and columns.
+ */
+template<typename ValueType, typename IndexType>
+class SlicedEllMatrix
+{
+
+public:
+
+    /** @brief The default number of rows per slice, matches the default of Ginkgo. */
+    static constexpr IndexType defaultSliceSize = 64;
+
+    /**
+     * @brief Constructor for SlicedEllMatrix.
+     * @param values The stored values of the matrix.
+     * @param colIdxs The column indices for each stored value.
+     * @param sliceLengths The number of stored entries per row of each slice.
+     * @param sliceSets The first column of each slice and the total number of columns.
+     * @param sliceSize The number of rows per slice.
+     * @param nRows The number of rows.
+     */
+    SlicedEllMatrix(
+        const Vector<ValueType>& values,
+        const Vector<IndexType>& colIdxs,
+        const Vector<IndexType>& sliceLengths,
+        const Vector<IndexType>& sliceSets,
+        IndexType sliceSize,
+        IndexType nRows
+    )
+        : values_(values), colIdxs_(colIdxs), sliceLengths_(sliceLengths), sliceSets_(sliceSets),
+          sliceSize_(sliceSize), nRows_(nRows)
+    {
+        NF_ASSERT(values.exec() == colIdxs_.exec(), "Executors are not the same");
+        NF_ASSERT(values.exec() == sliceLengths_.exec(), "Executors are not the same");
+        NF_ASSERT(values.exec() == sliceSets_.exec(), "Executors are not the same");
+        NF_ASSERT(sliceSize_ > 0, "Slice size needs to be larger than zero");
+        NF_ASSERT_EQUAL(sliceLengths_.size() + 1, sliceSets_.size());
+    }
+
+    /**
+     * @brief Converts a CSRMatrix, the result resides on the executor of the CSRMatrix.
+     * @param csr The matrix to convert.
+     * @param sliceSize The number of rows per slice.
+     */
+    explicit SlicedEllMatrix(
+        const CSRMatrix<ValueType, IndexType>& csr, IndexType sliceSize = defaultSliceSize
+    )
+        : values_(csr.exec(), 0), colIdxs_(csr.exec(), 0),
+          sliceLengths_(csr.exec(), sliceCount(csr.nRows(), sliceSize), IndexType(0)),
+          sliceSets_(csr.exec(), sliceCount(csr.nRows(), sliceSize) + 1, IndexType(0)),
+          sliceSize_(sliceSize), nRows_(csr.nRows())
+    {
+        NF_ASSERT(sliceSize_ > 0, "Slice size needs to be larger than zero");
+        const auto exec = csr.exec();
+        const auto [csrValues, csrColIdxs, rowOffs] = csr.view();
+        const auto nRows = nRows_;
+
+        auto lengths = sliceLengths_.view();
+        parallelFor(
+            exec,
+            {0, sliceLengths_.size()},
+            KOKKOS_LAMBDA(const localIdx slice) {
+                const IndexType first = static_cast<IndexType>(slice) * sliceSize;
+                const IndexType last = first + sliceSize < nRows ? first + sliceSize : nRows;
+                IndexType length = 0;
+                for (IndexType row = first; row < last; row++)
+                {
+                    const IndexType rowLength = rowOffs[row + 1] - rowOffs[row];
+                    length = rowLength > length ? rowLength : length;
+                }
+                lengths[slice] = length;
+            },
+            "computeSliceLengths"
+        );
+        const IndexType totalCols = segmentsFromIntervals(sliceLengths_, sliceSets_);
+
+        values_.resize(static_cast<localIdx>(totalCols * sliceSize_));
+        colIdxs_.resize(static_cast<localIdx>(totalCols * sliceSize_));
+        NeoN::fill(values_, zero<ValueType>());
+        NeoN::fill(colIdxs_, IndexType(0));
+
+        auto mtx = view();
+        parallelFor(
+            exec,
+            {0, static_cast<localIdx>(nRows)},
+            KOKKOS_LAMBDA(const localIdx i) {
+                const auto row = static_cast<IndexType>(i);
+                const IndexType rowStart = rowOffs[row];
+                const IndexType rowLength = rowOffs[row + 1] - rowStart;
+                for (IndexType j = 0; j < rowLength; j++)
+                {
+                    const auto offset = mtx.offset(row, j);
+                    mtx.values[offset] = csrValues[rowStart + j];
+                    mtx.colIdxs[offset] = csrColIdxs[rowStart + j];
+                }
+            },
+            "convertCSRToSlicedEll"
+        );
+    }
+
+    /**
+     * @brief Default destructor.
+     */
+    ~SlicedEllMatrix() = default;
+
+    /**
+     * @brief Get the executor associated with this matrix.
+     * @return Reference to the executor.
+     */
+    [[nodiscard]] const Executor& exec() const { return values_.exec(); }
+
+    /**
+     * @brief Get the number of rows in the matrix.
+     * @return Number of rows.
+     */
+    [[nodiscard]] IndexType nRows() const { return nRows_; }
+
+    /**
+     * @brief Get the number of rows per slice.
+     * @return Number of rows per slice.
+     */
+    [[nodiscard]] IndexType sliceSize() const { return sliceSize_; }
+
+    /**
+     * @brief Get the number of slices.
+     * @return Number of slices.
+     */
+    [[nodiscard]] IndexType nSlices() const
+    {
+        return static_cast<IndexType>(sliceLengths_.size());
+    }
+
+    /**
+     * @brief Get the number of stored values, including padding.
+     * @return Number of stored values.
+     */
+    [[nodiscard]] IndexType nStored() const { return static_cast<IndexType>(values_.size()); }
+
+    /**
+     * @brief Get a const reference to values vector.
+     * @return Const vector containing the matrix values.
+     */
+    [[nodiscard]] const Vector<ValueType>& values() const { return values_; }
+
+    /**
+     * @brief Get a const reference to column indices vector.
+     * @return Const vector containing the column indices.
+     */
+    [[nodiscard]] const Vector<IndexType>& colIdxs() const { return colIdxs_; }
+
+    /**
+     * @brief Get a const reference to slice length vector.
+     * @return Const vector containing the slice lengths.
+     */
+    [[nodiscard]] const Vector<IndexType>& sliceLengths() const { return sliceLengths_; }
+
+    /**
+     * @brief Get a const reference to slice set vector.
+     * @return Const vector containing the first column of each slice.
+     */
+    [[nodiscard]] const Vector<IndexType>& sliceSets() const { return sliceSets_; }
+
+    /**
+     * @brief Get a reference to values vector.
+     * @return Vector containing the matrix values.
+     */
+    [[nodiscard]] Vector<ValueType>& values() { return values_; }
+
+    /**
+     * @brief Get a view representation of the matrix's data.
+     * @return SlicedEllMatrixView for easy access to matrix elements.
+     */
+    [[nodiscard]] SlicedEllMatrixView<ValueType, IndexType> view()
+    {
+        return {
+            values_.view(), colIdxs_.view(), sliceLengths_.view(), sliceSets_.view(), sliceSize_
+        };
+    }
+
+    /**
+     * @brief Get a const view representation of the matrix's data.
+     * @return Const SlicedEllMatrixView for read-only access to matrix elements.
+     */
+    [[nodiscard]] SlicedEllMatrixView<const ValueType, const IndexType> view() const
+    {
+        return {
+            values_.view(), colIdxs_.view(), sliceLengths_.view(), sliceSets_.view(), sliceSize_
+        };
+    }
+
+private:
+
+    Vector<ValueType> values_;       //!< The stored values of the matrix.
+    Vector<IndexType> colIdxs_;      //!< The column indices of the stored values.
+    Vector<IndexType> sliceLengths_; //!< The number of stored entries per row of each slice.
+    Vector<IndexType> sliceSets_;    //!< The first column of each slice.
+    IndexType sliceSize_;            //!< The number of rows per slice.
+    IndexType nRows_;                //!< The number of rows.
+
+    static localIdx sliceCount(IndexType nRows, IndexType sliceSize)
+    {
+        return static_cast<localIdx>((nRows + sliceSize - 1) / sliceSize);
+    }
+};
+
+} // namespace NeoN::la
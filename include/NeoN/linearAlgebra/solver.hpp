@@ -4,14 +4,41 @@
 
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "NeoN/core/dictionaryBinding.hpp"
 #include "NeoN/core/input.hpp"
+#include "NeoN/core/timer.hpp"
 #include "NeoN/core/runtimeSelectionFactory.hpp"
+#include "NeoN/linearAlgebra/denseBlock.hpp"
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 
 namespace NeoN::la
 {
 
 
+/* @brief The wall clock times of the phases of a solve in milliseconds
+ *
+ * Solvers which do not distinguish a phase report zero for it, the phases sum up to at most the
+ * solve time of the statistics.
+ */
+struct SolverTimings
+{
+    scalar setupTime; // wrapping the matrix and the vectors, allocating work vectors
+
+    scalar preconditionerTime; // generating the solver and the preconditioner
+
+    scalar applyTime; // the iterations including the residual computations
+
+    scalar transferTime; // the copies between host and device, eg. of the residual norms
+};
+
 /* @brief A helper to collect statistics of the solver */
 struct SolverStats
 {
@@ -22,8 +49,73 @@ struct SolverStats
     scalar finalResNorm;
 
     scalar solveTime;
+
+    SolverTimings timings;
 };
 
+/* @brief Measures the durations of the consecutive phases of a solve in milliseconds
+ *
+ * Asynchronous executors need to be synchronised before every call, otherwise the durations
+ * only cover the launch of the kernels.
+ */
+class PhaseTimer
+{
+public:
+
+    PhaseTimer() : start_(std::chrono::steady_clock::now()), last_(start_) {}
+
+    /* @brief the time since the previous lap or the construction */
+    scalar lap()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const auto duration = milliseconds(now - last_);
+        last_ = now;
+        return duration;
+    }
+
+    /* @brief the time since the construction */
+    scalar total() const { return milliseconds(std::chrono::steady_clock::now() - start_); }
+
+private:
+
+    static scalar milliseconds(std::chrono::steady_clock::duration duration)
+    {
+        return static_cast<scalar>(
+                   std::chrono::duration_cast<std::chrono::microseconds>(duration).count()
+               )
+             / 1000.0;
+    }
+
+    std::chrono::steady_clock::time_point start_;
+
+    std::chrono::steady_clock::time_point last_;
+};
+
+/* @brief The strategies to solve a linear system with Vec3 values */
+enum class VectorSolveMode
+{
+    Segregated, /**< Solves the components one after another with a shared sparsity. */
+    Coupled     /**< Solves a single scalar system with interleaved components. */
+};
+
+/* @brief solves the scalar system of one component of a Vec3 system */
+using ComponentSolve =
+    std::function<SolverStats(const LinearSystem<scalar, localIdx>&, Vector<scalar>&, localIdx)>;
+
+/* @brief solves the three components of a Vec3 system one after another
+ *
+ * A single scalar system is allocated and refilled for each component, so all component solves
+ * share one sparsity and memory location. The residual norms of the returned statistics are the
+ * norms over all components.
+ *
+ * @param ls, the Vec3 linear system
+ * @param x, the solution vector
+ * @param solveCmpt, solves the scalar system of the component given as the last argument
+ */
+SolverStats solveSegregated(
+    const LinearSystem<Vec3, localIdx>& ls, Vector<Vec3>& x, const ComponentSolve& solveCmpt
+);
+
 /* @class SolverFactory
 **
 */
@@ -45,8 +137,37 @@ public:
 
     virtual SolverStats solve(const LinearSystem<scalar, localIdx>&, Vector<scalar>&) const = 0;
 
-    // virtual void
-    // solve(const LinearSystem<ValueType, int>&, Vector<Vec3>& ) const = 0;
+    /* @brief solves a Vec3 system component by component, see solveSegregated
+     *
+     * Solvers which can share their preconditioner between the components override this.
+     */
+    virtual SolverStats solve(const LinearSystem<Vec3, localIdx>& ls, Vector<Vec3>& x) const;
+
+    /* @brief solves the system for every column of b, the rhs of the system is not used
+     *
+     * x holds the initial guesses and returns the solutions, it has to have the shape of b. The
+     * default implementation solves the columns one after another, solvers which apply the matrix
+     * and the preconditioner to all columns at once override this. The residual norms of the
+     * returned statistics are the norms over all columns.
+     */
+    virtual SolverStats
+    solve(const LinearSystem<scalar, localIdx>& ls, const DenseBlock& b, DenseBlock& x) const;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /* @brief solves a system distributed over the ranks of its MPI environment
+     *
+     * x holds the locally owned rows of the solution. The default implementation exits with an
+     * error for solvers without distributed memory support.
+     */
+    virtual SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& ls, Vector<scalar>& x) const;
+#endif
+
+    /* @brief the bytes of the data kept between solves, eg. a preconditioner or a hierarchy
+     *
+     * Solvers without such data or whose data is held by an external library return zero.
+     */
+    virtual std::size_t memoryBytes() const { return 0; }
 
     // Pure virtual function for cloning
     virtual std::unique_ptr<SolverFactory> clone() const = 0;
@@ -62,26 +183,142 @@ class Solver
 public:
 
     Solver(const Solver& solver)
-        : exec_(solver.exec_), solverInstance_(solver.solverInstance_->clone()) {};
+        : exec_(solver.exec_), solverInstance_(solver.solverInstance_->clone()),
+          vectorSolveMode_(solver.vectorSolveMode_) {};
 
     Solver(Solver&& solver)
-        : exec_(solver.exec_), solverInstance_(std::move(solver.solverInstance_)) {};
+        : exec_(solver.exec_), solverInstance_(std::move(solver.solverInstance_)),
+          vectorSolveMode_(solver.vectorSolveMode_) {};
 
-    Solver(const Executor& exec, std::unique_ptr<SolverFactory> solverInstance)
-        : exec_(exec), solverInstance_(std::move(solverInstance)) {};
+    Solver(
+        const Executor& exec,
+        std::unique_ptr<SolverFactory> solverInstance,
+        VectorSolveMode vectorSolveMode = VectorSolveMode::Segregated
+    )
+        : exec_(exec), solverInstance_(std::move(solverInstance)),
+          vectorSolveMode_(vectorSolveMode) {};
 
+    /* @brief creates the solver selected by the solver key of the dictionary
+     *
+     * The optional vectorSolve key selects how Vec3 systems are solved, either segregated
+     * (default) or coupled.
+     */
     Solver(const Executor& exec, const Dictionary& dict)
-        : exec_(exec), solverInstance_(SolverFactory::create(exec, dict)) {};
+        : exec_(exec), solverInstance_(SolverFactory::create(exec, dict)),
+          vectorSolveMode_(readVectorSolveMode(dict)) {};
 
+    /* @brief solves the system for the first rows of the field
+     *
+     * The entries of the field after the rows of the system, eg. the ghost cells of a mesh, see
+     * UnstructuredMesh::nGhostCells, are kept.
+     */
     SolverStats solve(const LinearSystem<scalar, localIdx>& ls, Vector<scalar>& field) const
     {
+        ScopedTimer timer("la::Solver::solve", exec_);
+        if (field.size() > ls.rhs().size())
+        {
+            auto rows = Vector<scalar>::wrap(field.exec(), field.data(), ls.rhs().size());
+            return solverInstance_->solve(ls, rows);
+        }
         return solverInstance_->solve(ls, field);
     }
 
+    /* @brief solves the system for the first rows of the field, see the scalar solve */
+    SolverStats solve(const LinearSystem<Vec3, localIdx>& ls, Vector<Vec3>& field) const;
+
+    /* @brief solves the system for every column of b, see SolverFactory::solve */
+    SolverStats
+    solve(const LinearSystem<scalar, localIdx>& ls, const DenseBlock& b, DenseBlock& x) const
+    {
+        ScopedTimer timer("la::Solver::solveBlock", exec_);
+        return solverInstance_->solve(ls, b, x);
+    }
+
+    /* @brief starts the solve on a host thread and returns the statistics as future
+     *
+     * The call returns once the solve is launched, thus the caller can assemble the next system
+     * or write output while the system is solved. Until the future is ready the system and the
+     * solver must not be modified or destroyed and the solution must not be accessed. The kernels
+     * of the solve are enqueued on the executor of the solver.
+     */
+    template<typename ValueType>
+    std::future<SolverStats>
+    solveAsync(const LinearSystem<ValueType, localIdx>& ls, Vector<ValueType>& field) const
+    {
+        return std::async(std::launch::async, [this, &ls, &field]() { return solve(ls, field); });
+    }
+
+    /* @brief the bytes of the data kept between solves, see SolverFactory::memoryBytes */
+    std::size_t memoryBytes() const { return solverInstance_->memoryBytes(); }
+
+#ifdef NF_WITH_MPI_SUPPORT
+    SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& ls, Vector<scalar>& field) const
+    {
+        ScopedTimer timer("la::Solver::solveDistributed", exec_);
+        return solverInstance_->solve(ls, field);
+    }
+#endif
+
 private:
 
+    static VectorSolveMode readVectorSolveMode(const Dictionary& dict);
+
     const Executor exec_;
     std::unique_ptr<SolverFactory> solverInstance_;
+    VectorSolveMode vectorSolveMode_;
+};
+
+/* @brief caches solvers by the name of the equation, the executor and the solver dictionary
+ *
+ * Creating a solver runs the solver factory and, for Ginkgo, parses the configuration and
+ * builds the whole factory tree on the executor, so solvers are kept between time steps instead.
+ * The contents of the dictionary are part of the key, thus a modified dictionary creates a new
+ * solver. Dictionaries holding values of other types than bool, integers, floating point values,
+ * strings and dictionaries are not cached and a new solver is returned on every call.
+ * The solver last returned for an equation and executor is bound to the version of the dictionary,
+ * see Dictionary::version, thus the dictionary is only converted to a key once it changed.
+ */
+class SolverCache
+{
+public:
+
+    /* @brief returns the cached solver or creates it on the first call
+     *
+     * @param name, the name of the equation, usually the name of the solution field
+     * @param exec, the executor of the solver
+     * @param dict, the solver dictionary
+     */
+    std::shared_ptr<Solver>
+    get(const std::string& name, const Executor& exec, const Dictionary& dict);
+
+    /* @brief the number of cached solvers */
+    std::size_t size() const { return solvers_.size(); }
+
+    /* @brief adds the data kept by every cached solver to the solvers of a memory report */
+    void reportMemory(MemoryReport& report, const std::string& name) const;
+
+private:
+
+    struct Entry
+    {
+        Executor exec;
+        std::shared_ptr<Solver> solver;
+    };
+
+    struct Binding
+    {
+        Executor exec;
+        DictionaryBinding<std::shared_ptr<Solver>> solver;
+    };
+
+    std::unordered_multimap<std::string, Entry> solvers_;
+
+    /* @brief the solver last returned per equation name and executor */
+    std::unordered_multimap<std::string, Binding> bindings_;
 };
 
+/* @brief returns the solver cache of the mesh, which is stored in its stencil database */
+SolverCache& solverCache(const UnstructuredMesh& mesh);
+
 }
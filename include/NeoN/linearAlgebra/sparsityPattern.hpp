@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "NeoN/core/array.hpp"
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
@@ -17,6 +21,8 @@ namespace NeoN::la
  * This class implements the finite volume 3/5/7 pt stencil specific generation
  * of sparsity patterns from a given unstructured mesh
  *
+ * The rows are the local cells of the mesh. The faces of ghost cells, see
+ * UnstructuredMesh::nGhostCells, have no entries, the ghost cells are coupled through the rhs.
  */
 class SparsityPattern
 {
@@ -60,9 +66,9 @@ public:
     const Executor& exec() const { return exec_; };
 
     /*@brief getter for colIdxs */
-    [[nodiscard]] const Vector<localIdx>& colIdxs() const { return colIdxs_; };
+    [[nodiscard]] const Vector<columnIdx>& colIdxs() const { return colIdxs_; };
 
-    [[nodiscard]] Vector<localIdx>& colIdxs() { return colIdxs_; };
+    [[nodiscard]] Vector<columnIdx>& colIdxs() { return colIdxs_; };
 
     /*@brief getter for rowOffs */
     [[nodiscard]] const Vector<localIdx>& rowOffs() const { return rowOffs_; };
@@ -74,6 +80,13 @@ public:
 
     [[nodiscard]] localIdx nnz() const { return colIdxs_.size(); };
 
+    /* @brief the bytes allocated by the row offsets, column indices and face offsets */
+    [[nodiscard]] std::size_t memoryBytes() const
+    {
+        return rowOffs_.memoryBytes() + colIdxs_.memoryBytes() + ownerOffset_.memoryBytes()
+             + neighbourOffset_.memoryBytes() + diagOffset_.memoryBytes();
+    }
+
     // TODO add selection mechanism via dictionary later
     static const SparsityPattern& readOrCreate(const UnstructuredMesh& mesh);
 
@@ -83,7 +96,7 @@ private:
 
     Vector<localIdx> rowOffs_; //! rowOffs map from row to start index in values
 
-    Vector<localIdx> colIdxs_; //!
+    Vector<columnIdx> colIdxs_; //!
 
     Array<uint8_t> ownerOffset_; //! mapping from faceId to lower index in a row
 
@@ -94,6 +107,108 @@ private:
 
 SparsityPattern createSparsity(const UnstructuredMesh& mesh);
 
+/* @brief builds the sparsity pattern on the host using the SerialExecutor and copies the
+ * result back to the executor of the mesh
+ */
+void updateSparsityPatternSerial(const UnstructuredMesh& mesh, SparsityPattern& sp);
+
+/* @brief builds the sparsity pattern on the executor of the mesh
+ *
+ * The entries are inserted with atomics and each row is sorted by column index afterwards,
+ * thus the result is deterministic and matches the serial version.
+ */
+void updateSparsityPatternParallel(const UnstructuredMesh& mesh, SparsityPattern& sp);
+
 SparsityPattern updateSparsity(const UnstructuredMesh& mesh, SparsityPattern& in);
 
+/* @brief the result of IncrementalSparsityPattern::update */
+struct SparsityUpdate
+{
+    localIdx nTouchedRows; // the rows rebuilt from the faces of the mesh
+
+    bool rowOffsChanged; // a row changed its length, the values of the systems are reallocated
+
+    bool rebuilt; // a row exceeded its capacity, thus all rows were rebuilt
+
+    /* @brief the names of the stencil database entries depending on the topology, which have
+     * to be rebuilt for the changed mesh
+     */
+    std::vector<std::string> invalidated;
+};
+
+/* @class IncrementalSparsityPattern
+ * @brief a sparsity pattern patched after local topology changes, eg. refined or merged cells
+ *
+ * The rows are stored with a slack capacity, hence the rows of touched cells are rebuilt in
+ * place from the faces of the changed mesh and all other rows keep their entries and their face
+ * offsets. The compact pattern used by the linear systems is copied from the padded rows, only
+ * the touched rows if no row changed its length. The result equals the pattern created from the
+ * changed mesh.
+ *
+ * The cells and faces which are not listed as changed need to keep their index and their
+ * connectivity. New cells are appended, removed cells are the last cells of the old mesh.
+ */
+class IncrementalSparsityPattern
+{
+public:
+
+    /* @brief builds the pattern of the mesh with slack entries per row
+     *
+     * @param mesh, the mesh of the pattern
+     * @param slack, the number of free entries per row
+     */
+    IncrementalSparsityPattern(const UnstructuredMesh& mesh, localIdx slack = 2);
+
+    /* @brief patches the rows of the touched cells after a topology change
+     *
+     * A cell is touched if it is changed or the owner or neighbour of a changed internal face in
+     * the changed mesh. The changed cells need to include the cells which lost a face.
+     *
+     * @param mesh, the changed mesh
+     * @param changedCells, the cells whose faces changed, in the numbering of the changed mesh
+     * @param changedFaces, the new faces and the faces whose owner or neighbour changed
+     */
+    SparsityUpdate update(
+        const UnstructuredMesh& mesh,
+        const Vector<localIdx>& changedCells,
+        const Vector<localIdx>& changedFaces
+    );
+
+    /* @brief the compact pattern, eg. to insert into the stencil database of the changed mesh */
+    const SparsityPattern& pattern() const { return *pattern_; }
+
+    /* @brief the number of free entries per row after a rebuild */
+    localIdx slack() const { return slack_; }
+
+    /* @brief the number of entries the padded rows can hold */
+    localIdx capacity() const { return paddedCols_.size(); }
+
+    /* @brief the names of the stencil database entries depending on the topology
+     *
+     * @param rowOffsChanged, whether the number of entries of a row changed, which invalidates
+     * the linear systems and the solvers of the pattern
+     */
+    static std::vector<std::string> topologyCaches(bool rowOffsChanged);
+
+private:
+
+    /* @brief builds all rows from the mesh */
+    void rebuild(const UnstructuredMesh& mesh);
+
+    /* @brief appends the rows of the cells from oldRows with the given lengths plus the slack */
+    void appendRows(localIdx oldRows, const Vector<localIdx>& rowLengths);
+
+    localIdx slack_;
+
+    std::optional<SparsityPattern> pattern_;
+
+    Vector<localIdx> rowStarts_; //! start of every padded row, the capacity follows from the next
+
+    Vector<localIdx> rowLengths_; //! number of entries of every row
+
+    Vector<localIdx> paddedCols_; //! column indices of the padded rows
+
+    Vector<localIdx> paddedFaces_; //! face of every padded entry, -1 for the diagonal
+};
+
 } // namespace NeoN::la
@@ -7,6 +7,9 @@
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/linearAlgebra/CSRMatrix.hpp"
+#include "NeoN/linearAlgebra/lduMatrix.hpp"
+#include "NeoN/linearAlgebra/linearOperator.hpp"
+#include "NeoN/linearAlgebra/slicedEllMatrix.hpp"
 
 
 namespace NeoN::la
@@ -27,4 +30,106 @@ void computeResidual(
     Vector<scalar>& res
 );
 
+/* @brief computes the residual vector Ax-b for a matrix in sliced ELLPACK format
+ *
+ * Consecutive rows are processed by consecutive threads, which read consecutive entries of the
+ * matrix.
+ */
+void computeResidual(
+    const SlicedEllMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& b,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+/* @brief computes the residual vector Ax-b for a matrix in LDU format
+ *
+ * The diagonal is applied per row, the face coefficients are scattered into the owner and
+ * neighbour rows with atomics.
+ */
+void computeResidual(
+    const LduMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& b,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+/* @brief computes the residual vector Ax-b of a matrix free linear operator */
+void computeResidual(
+    const LinearOperator<scalar>& op,
+    const Vector<scalar>& b,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+/* @brief the L1, L2 and maximum norms of a residual vector */
+struct ResidualNorms
+{
+    scalar l1;
+    scalar l2;
+    scalar linf;
+};
+
+/* @brief computes the L1, L2 and maximum norms of a vector in a single pass */
+ResidualNorms computeNorms(const Vector<scalar>& res);
+
+/* @brief computes the residual vector Ax-b and its norms
+ *
+ * For the CSRMatrix and the SlicedEllMatrix the norms are reduced while the residual is
+ * computed, ie. one thread per row computes its residual entry and adds it to the norms, which
+ * saves the second pass over the residual required by computeResidual followed by a norm.
+ *
+ * @param[in] mtx, the corresponding matrix
+ * @param[in] b, rhs vector b
+ * @param[in] x, initial guess vector x
+ * @param[out] res, the residual vector Ax-b
+ * @return the norms of the residual vector
+ */
+ResidualNorms computeResidualNorms(
+    const CSRMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& b,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+/* @brief computes the residual vector Ax-b of a sliced ELLPACK matrix and its norms */
+ResidualNorms computeResidualNorms(
+    const SlicedEllMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& b,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+/* @brief computes the residual vector Ax-b of an LDU matrix and its norms
+ *
+ * The face contributions are scattered with atomics, hence the norms require a separate pass.
+ */
+ResidualNorms computeResidualNorms(
+    const LduMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& b,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+/* @brief computes the sparse matrix vector product y = Ax
+ *
+ * @param[in] mtx, the corresponding matrix
+ * @param[in] x, the vector to multiply
+ * @param[out] y, the result vector
+ */
+void spmv(const CSRMatrix<scalar, localIdx>& mtx, const Vector<scalar>& x, Vector<scalar>& y);
+
+/* @brief computes the sparse matrix vector product y = Ax for a matrix in sliced ELLPACK format
+ */
+void spmv(const SlicedEllMatrix<scalar, localIdx>& mtx, const Vector<scalar>& x, Vector<scalar>& y);
+
+/* @brief computes the sparse matrix vector product y = Ax for a matrix in LDU format */
+void spmv(const LduMatrix<scalar, localIdx>& mtx, const Vector<scalar>& x, Vector<scalar>& y);
+
+/* @brief computes the dot product of a and b */
+scalar dot(const Vector<scalar>& a, const Vector<scalar>& b);
+
+/* @brief computes y = alpha * x + beta * y */
+void axpby(scalar alpha, const Vector<scalar>& x, scalar beta, Vector<scalar>& y);
+
 }
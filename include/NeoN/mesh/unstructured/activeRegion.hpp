@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+#include "NeoN/core/vector/vector.hpp"
+
+namespace NeoN
+{
+
+class UnstructuredMesh;
+
+/**
+ * @class ActiveRegion
+ * @brief The active cells and faces of a mesh as compacted index lists.
+ *
+ * Parts of a mesh may be inactive for many time steps, eg. the solid of an immersed boundary or
+ * a converged zone. Once set on the mesh, see UnstructuredMesh::setActiveRegion, the face
+ * reductions of the operators loop over the active cells only and leave the results of the
+ * inactive cells unchanged, thus an explicit source is zero and an explicit update keeps the
+ * frozen value. The assembled systems replace the rows of the inactive cells by the identity
+ * with the current value as rhs, see la::freezeInactiveRows.
+ *
+ * A face is active if one of its cells is active, hence the faces between an active and an
+ * inactive cell read the frozen value of the inactive cell.
+ */
+class ActiveRegion
+{
+public:
+
+    /**
+     * @brief Builds the index lists of the active cells and faces.
+     *
+     * @param mesh The mesh of the region.
+     * @param cellMask The activity of every cell, a nonzero entry marks an active cell.
+     */
+    ActiveRegion(const UnstructuredMesh& mesh, const Vector<localIdx>& cellMask);
+
+    /**
+     * @brief Rebuilds the index lists after the activity of some cells has changed.
+     *
+     * @param mesh The mesh of the region.
+     * @param cellMask The activity of every cell, a nonzero entry marks an active cell.
+     */
+    void update(const UnstructuredMesh& mesh, const Vector<localIdx>& cellMask);
+
+    /**
+     * @brief Get the activity of every cell, one for active and zero for inactive cells.
+     *
+     * @return The cell mask.
+     */
+    const Vector<localIdx>& cellMask() const { return cellMask_; }
+
+    /**
+     * @brief Get the active cells in ascending order.
+     *
+     * @return The indices of the active cells.
+     */
+    const Vector<localIdx>& activeCells() const { return activeCells_; }
+
+    /**
+     * @brief Get the inactive cells in ascending order.
+     *
+     * @return The indices of the inactive cells.
+     */
+    const Vector<localIdx>& inactiveCells() const { return inactiveCells_; }
+
+    /**
+     * @brief Get the active internal and boundary faces in ascending order.
+     *
+     * The boundary faces follow the internal faces with an offset of nInternalFaces.
+     *
+     * @return The indices of the active faces.
+     */
+    const Vector<localIdx>& activeFaces() const { return activeFaces_; }
+
+    /**
+     * @brief Get the number of active cells.
+     *
+     * @return The number of active cells.
+     */
+    localIdx nActiveCells() const { return activeCells_.size(); }
+
+    /**
+     * @brief Get the version of the region.
+     *
+     * The version is incremented by every update, so that data derived from the region can
+     * detect whether it is outdated.
+     *
+     * @return The version of the region.
+     */
+    std::size_t version() const { return version_; }
+
+private:
+
+    Vector<localIdx> cellMask_;      /**< The activity of every cell. */
+    Vector<localIdx> activeCells_;   /**< The compacted active cells. */
+    Vector<localIdx> inactiveCells_; /**< The compacted inactive cells. */
+    Vector<localIdx> activeFaces_;   /**< The compacted active faces. */
+    std::size_t version_;            /**< The number of updates. */
+};
+
+} // namespace NeoN
@@ -6,6 +6,7 @@
 
 #include <vector>
 
+#include "NeoN/core/memoryReport.hpp"
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/core/vector/vectorTypeDefs.hpp"
 
@@ -209,6 +210,39 @@ public:
     // TODO consistent use of Vector on CPU
     const std::vector<localIdx>& offset() const;
 
+    /**
+     * @brief Get the offset of the boundary faces on the executor.
+     *
+     * @return A constant reference to the offsets, a copy of offset() on the executor.
+     */
+    const localIdxVector& patchOffsets() const;
+
+    /**
+     * @brief Get the patch of every boundary face on the executor.
+     *
+     * Allows boundary kernels over all boundary faces to find the patch of a face without a
+     * search in the offsets.
+     *
+     * @return A constant reference to the patch index of every boundary face.
+     */
+    const localIdxVector& facePatch() const;
+
+    /**
+     * @brief Adds the boundary geometry and connectivity to a memory report.
+     *
+     * @param report The report, the fields are added to the mesh geometry and mesh connectivity.
+     */
+    void reportMemory(MemoryReport& report) const;
+
+    /**
+     * @brief Replaces the geometry of the boundary faces after mesh motion.
+     *
+     * The face cells and the offsets of both boundary meshes need to agree.
+     *
+     * @param other The boundary mesh of the moved mesh.
+     */
+    void updateGeometry(const BoundaryMesh& other);
+
 
 private:
 
@@ -278,6 +312,16 @@ private:
      */
     // TODO consistent use of Vector on CPU
     std::vector<localIdx> offset_;
+
+    /**
+     * @brief Offset of the boundary faces on the executor.
+     */
+    localIdxVector patchOffsets_;
+
+    /**
+     * @brief Patch index of every boundary face on the executor.
+     */
+    localIdxVector facePatch_;
 };
 
 } // namespace NeoN
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @brief The cell adjacency graph of the internal faces in compressed row storage.
+ *
+ * The neighbours of cell i are adjacency[offsets[i]] to adjacency[offsets[i + 1] - 1], the graph
+ * resides on the host.
+ */
+struct CellGraph
+{
+    std::vector<localIdx> offsets;   /**< The first adjacency entry of every cell. */
+    std::vector<localIdx> adjacency; /**< The neighbour cells of all cells. */
+
+    localIdx degree(localIdx celli) const { return offsets[celli + 1] - offsets[celli]; }
+};
+
+/**
+ * @brief Creates the cell adjacency graph of the mesh.
+ *
+ * @param mesh The mesh.
+ * @return The cell graph on the host.
+ */
+CellGraph createCellGraph(const UnstructuredMesh& mesh);
+
+} // namespace NeoN
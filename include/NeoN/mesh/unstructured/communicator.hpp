@@ -4,17 +4,25 @@
 
 #pragma once
 
+#include <cstddef>
+#include <deque>
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 
 
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/timer.hpp"
 #include "NeoN/fields/field.hpp"
 
 #ifdef NF_WITH_MPI_SUPPORT
 #include "NeoN/core/mpi/fullDuplexCommBuffer.hpp"
 #include "NeoN/core/mpi/operators.hpp"
 #include "NeoN/core/mpi/environment.hpp"
+#include "NeoN/core/mpi/progress.hpp"
 #endif
 
 namespace NeoN
@@ -39,12 +47,170 @@ using RankCommMap = std::vector<NodeCommMap>;
  */
 using CommMap = std::vector<RankCommMap>;
 
+/**
+ * @brief A send or receive map in compressed sparse row layout. The local indices of rank r are
+ * stored in [rankOffsets[r], rankOffsets[r + 1]) of indices, in the order of the messages.
+ */
+struct FlatCommMap
+{
+    std::vector<localIdx> rankOffsets; /**< The first index of every rank and the total size. */
+    std::vector<localIdx> indices;     /**< The local indices of all ranks. */
+};
+
+/**
+ * @brief Flattens a send or receive map into the compressed sparse row layout.
+ * @param commMap The send or receive map.
+ * @return The flattened map.
+ */
+FlatCommMap flatten(const CommMap& commMap);
+
+/**
+ * @brief Returns the executor on which the communication buffers for data on exec are allocated.
+ * Without GPU-aware MPI device data is staged through host buffers.
+ * @param exec The executor of the communicated data.
+ * @return The executor of the communication buffers.
+ */
+inline Executor commBufferExecutor(const Executor& exec)
+{
+#ifdef NF_WITH_GPU_AWARE_MPI
+    return exec;
+#else
+    if (std::holds_alternative<GPUExecutor>(exec)) return SerialExecutor {};
+    return exec;
+#endif
+}
+
+/**
+ * @brief The precision of the values in the buffers of an exchange.
+ * With Single the scalar and Vec3 values are converted to single precision in the pack kernel
+ * and back to the precision of the field in the unpack kernel, which halves the communicated
+ * bytes of double precision builds at the cost of a relative error of about 1e-7 in the halo.
+ */
+enum class CommPrecision
+{
+    Full,  /**< The values are communicated unchanged. */
+    Single /**< The scalar and Vec3 values are communicated in single precision. */
+};
+
+namespace detail
+{
+
+/**
+ * @brief Communicates the values unchanged.
+ */
+template<typename ValueType>
+struct FullPrecision
+{
+    using type = ValueType;
+
+    KOKKOS_INLINE_FUNCTION static type pack(const ValueType& value) { return value; }
+
+    KOKKOS_INLINE_FUNCTION static ValueType unpack(const type& value) { return value; }
+};
+
+/**
+ * @brief Communicates the values in single precision, value types without a single precision
+ * representation are communicated unchanged.
+ */
+template<typename ValueType>
+struct SinglePrecision : public FullPrecision<ValueType>
+{};
+
+template<>
+struct SinglePrecision<double>
+{
+    using type = float;
+
+    KOKKOS_INLINE_FUNCTION static type pack(const double& value)
+    {
+        return static_cast<float>(value);
+    }
+
+    KOKKOS_INLINE_FUNCTION static double unpack(const type& value)
+    {
+        return static_cast<double>(value);
+    }
+};
+
+/**
+ * @brief The components of a Vec3 in single precision.
+ */
+struct SingleVec3
+{
+    float cmpts[3];
+};
+
+template<>
+struct SinglePrecision<Vec3>
+{
+    using type = std::conditional_t<sizeof(scalar) == sizeof(float), Vec3, SingleVec3>;
+
+    KOKKOS_INLINE_FUNCTION static type pack(const Vec3& value)
+    {
+        if constexpr (std::is_same_v<type, Vec3>)
+        {
+            return value;
+        }
+        else
+        {
+            return type {
+                {static_cast<float>(value[0]),
+                 static_cast<float>(value[1]),
+                 static_cast<float>(value[2])}
+            };
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION static Vec3 unpack(const type& value)
+    {
+        if constexpr (std::is_same_v<type, Vec3>)
+        {
+            return value;
+        }
+        else
+        {
+            return Vec3(
+                static_cast<scalar>(value.cmpts[0]),
+                static_cast<scalar>(value.cmpts[1]),
+                static_cast<scalar>(value.cmpts[2])
+            );
+        }
+    }
+};
+
+}
+
+/**
+ * @brief The accumulated statistics of the exchanges with one communication name.
+ * The unpack time covers the kernels of asynchronous executors only if the fences of the
+ * TimerRegistry are enabled, the pack time always includes them.
+ */
+struct CommStatistics
+{
+    std::size_t exchanges;        /**< The number of started exchanges. */
+    std::size_t bytesSent;        /**< The number of sent bytes. */
+    std::size_t bytesReceived;    /**< The number of received bytes. */
+    std::size_t messagesSent;     /**< The number of non-empty sent messages. */
+    std::size_t messagesReceived; /**< The number of non-empty received messages. */
+    std::size_t neighbours;       /**< The number of ranks exchanged with by the last exchange. */
+    double packTime;              /**< The seconds spent packing the send buffers. */
+    double waitTime;              /**< The seconds spent waiting for the completion. */
+    double unpackTime;            /**< The seconds spent unpacking the receive buffers. */
+    std::size_t incompleteTests;  /**< The number of times isComplete returned false. */
+};
+
 /**
  * @class Communicator
  * @brief Manages communication between ranks in a parallel environment.
  * The Communicator class provides functionality to manage communication of field data exchange
  * between MPI ranks for unstructured meshes. The class maintains an MPI environment and maps for
- * rank-specific send and receive operations.
+ * rank-specific send and receive operations. Packing and unpacking of the buffers is executed on
+ * the executor of the communicated field using flattened index arrays.
+ *
+ * The exchanges are timed by the TimerRegistry per communication name, with the pack, wait and
+ * unpack phases as nested timers and the communicated bytes and messages as counters. The totals
+ * are also available as CommStatistics. The values of scalar and Vec3 fields can be exchanged in
+ * single precision per communication name, see CommPrecision.
  */
 class Communicator
 {
@@ -62,6 +228,10 @@ public:
      */
     ~Communicator() = default;
 
+    Communicator(Communicator&&) = default;
+
+    Communicator& operator=(Communicator&&) = default;
+
     /**
      * @brief Constructor that initializes the Communicator with MPI environment, rank send map, and
      * rank receive map.
@@ -69,47 +239,157 @@ public:
      * @param rankSendMap The rank send map.
      * @param rankReceiveMap The rank receive map.
      */
-    Communicator(mpi::MPIEnvironment mpiEnviron, CommMap rankSendMap, CommMap rankReceiveMap)
-        : mpiEnviron_(mpiEnviron), sendMap_(rankSendMap), receiveMap_(rankReceiveMap)
+    Communicator(
+        mpi::MPIEnvironment mpiEnviron, const CommMap& rankSendMap, const CommMap& rankReceiveMap
+    )
+        : Communicator(mpiEnviron, flatten(rankSendMap), flatten(rankReceiveMap)) {};
+
+    /**
+     * @brief Constructor that initializes the Communicator with MPI environment and the send and
+     * receive maps in compressed sparse row layout, see FlatCommMap.
+     * @param mpiEnviron The MPI environment.
+     * @param sendMap The flattened send map.
+     * @param receiveMap The flattened receive map.
+     */
+    Communicator(mpi::MPIEnvironment mpiEnviron, FlatCommMap sendMap, FlatCommMap receiveMap)
+        : mpiEnviron_(mpiEnviron), send_(std::move(sendMap)), receive_(std::move(receiveMap)),
+          sendRankIdx_(flattenRanks(send_)), receiveRankIdx_(flattenRanks(receive_))
     {
         NF_DEBUG_ASSERT(
-            mpiEnviron_.sizeRank() == rankSendMap.size(),
+            mpiEnviron_.sizeRank() + 1 == send_.rankOffsets.size(),
             "Size of rankSendSize does not match MPI size."
         );
         NF_DEBUG_ASSERT(
-            mpiEnviron_.sizeRank() == rankReceiveMap.size(),
+            mpiEnviron_.sizeRank() + 1 == receive_.rankOffsets.size(),
             "Size of rankReceiveSize does not match MPI size."
         );
     };
 
     /**
-     * @brief Starts the non-blocking communication for a given field and communication name.
-     * @tparam valueType The value type of the field.
-     * @param field The field to be communicated/synchronized.
+     * @brief Enable or disable persistent MPI requests, which are set up once per buffer and
+     * restarted for every exchange with the same communication name.
+     * @param persistent Whether persistent requests are used.
+     */
+    void setPersistent(bool persistent) { persistent_ = persistent; }
+
+    /**
+     * @brief Enable or disable neighbourhood collectives, which exchange the halo of all
+     * neighbour ranks with a single MPI_Ineighbor_alltoallv over a distributed graph built from
+     * the send and receive maps. Enabling is a collective operation and the exchanges have to be
+     * started in the same order on all ranks.
+     * @param enable Whether neighbourhood collectives are used.
+     */
+    void setNeighbourhoodCollectives(bool enable);
+
+    /**
+     * @brief Enable or disable a thread driving the MPI progress of the ongoing exchanges, see
+     * mpi::ProgressThread. Requires MPI initialized with MPI_THREAD_MULTIPLE. Enabling and
+     * disabling are collective operations.
+     * @param enable Whether the progress thread runs.
+     * @param interval The time between two progress calls of the thread.
+     */
+    void setProgressThread(
+        bool enable, std::chrono::microseconds interval = std::chrono::microseconds(50)
+    );
+
+    /**
+     * @brief Tests all ongoing exchanges, which drives their progress in MPI libraries without
+     * asynchronous progress. Called when an exchange is started, i.e. at the boundary updates
+     * of the operators, and may be called between the kernels of long running operators.
+     */
+    void progress();
+
+    /**
+     * @brief Enable or disable the exchange through shared memory between the ranks of a compute
+     * node. The node-local messages are copied through an MPI-3 shared memory window, synchronised
+     * by a counter per message, instead of MPI point-to-point messages. A window is allocated per
+     * buffer on its first exchange, with slots for messages of up to maxEntryBytes per entry,
+     * larger messages are sent with MPI. Enabling and the allocation of the windows are collective
+     * operations on the node, hence the exchanges have to be started in the same order on all
+     * ranks. Neighbourhood collectives, if enabled, take precedence.
+     * @param enable Whether the exchange through shared memory is used.
+     * @param maxEntryBytes The largest value type size exchanged through shared memory.
+     */
+    void setSharedMemoryExchange(bool enable, std::size_t maxEntryBytes = sizeof(Vec3));
+
+#ifdef NF_WITH_NCCL
+    /**
+     * @brief Enable or disable the exchange of fields on a GPU executor with NCCL. The device
+     * resident buffers are exchanged by a group of ncclSend and ncclRecv calls enqueued on the
+     * stream of the field, thus the exchange is ordered with the pack and unpack kernels and
+     * neither startComm nor finaliseComm synchronise with the device. Enabling is a collective
+     * operation and the exchanges have to be started in the same order on all ranks. Fields on
+     * other executors are exchanged with MPI.
+     * @param enable Whether NCCL is used for the exchange of device resident fields.
+     */
+    void setNcclExchange(bool enable);
+#endif
+
+    /**
+     * @brief Allocates a dedicated buffer for the communication name, typically during the mesh
+     * setup. The buffer is sized once for valueType and reused by every exchange with this name,
+     * hence no buffer search, resize or type change is required per exchange.
+     * @tparam valueType The value type of the communicated fields.
      * @param commName The communication name, typically a file and line number.
+     * @param exec The executor of the communicated fields.
      */
     template<typename valueType>
-    void startComm(Vector<valueType>& field, const std::string& commName)
+    void reserveComm(const std::string& commName, const Executor& exec)
     {
         NF_DEBUG_ASSERT(
             CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
-            "There is already an ongoing communication for key " << commName << "."
+            "There is an ongoing communication for key " << commName << "."
         );
+        auto& buffer = reservedBuffers_[commName];
+        buffer.setMPIEnvironment(mpiEnviron_);
+        buffer.setExecutor(bufferExecutor(exec));
+        buffer.setCommRankSize<valueType>(rankSizes(send_), rankSizes(receive_));
+    }
 
-        CommBuffer_[commName] = findDuplexBuffer();
-        if (!CommBuffer_[commName])
-        {
-            CommBuffer_[commName] = createNewDuplexBuffer();
-        }
+    /**
+     * @brief Removes the reserved buffer, the buffer assignment and the precision of a
+     * communication name, which is no longer used. The statistics are kept.
+     * @param commName The communication name, typically a file and line number.
+     */
+    void releaseComm(const std::string& commName);
+
+    /**
+     * @brief Sets the precision of the exchanges with the given communication name, which
+     * applies to the following exchanges of scalar and Vec3 fields, the exchanges of other value
+     * types are always in full precision.
+     * @param commName The communication name, typically a file and line number.
+     * @param precision The precision of the communicated values.
+     */
+    void setPrecision(const std::string& commName, CommPrecision precision);
+
+    /**
+     * @brief Sets the precision of all communication names without an explicit precision.
+     * @param precision The precision of the communicated values.
+     */
+    void setPrecision(CommPrecision precision) { defaultPrecision_ = precision; }
+
+    /**
+     * @brief Gets the precision of the exchanges with the given communication name.
+     * @param commName The communication name, typically a file and line number.
+     * @return The precision of the communicated values.
+     */
+    CommPrecision precision(const std::string& commName) const;
 
-        CommBuffer_[commName]->initComm<valueType>(commName);
-        for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
+    /**
+     * @brief Starts the non-blocking communication for a given field and communication name.
+     * @tparam valueType The value type of the field.
+     * @param field The field to be communicated/synchronized.
+     * @param commName The communication name, typically a file and line number.
+     */
+    template<typename valueType>
+    void startComm(Vector<valueType>& field, const std::string& commName)
+    {
+        if (precision(commName) == CommPrecision::Single)
         {
-            auto rankBuffer = CommBuffer_[commName]->getSend<valueType>(rank);
-            for (size_t data = 0; data < sendMap_[rank].size(); ++data)
-                rankBuffer[data] = field(static_cast<size_t>(sendMap_[rank][data].local_idx));
+            startCommAs<detail::SinglePrecision<valueType>>(field, commName);
+            return;
         }
-        CommBuffer_[commName]->startComm();
+        startCommAs<detail::FullPrecision<valueType>>(field, commName);
     }
 
     /**
@@ -128,31 +408,270 @@ public:
     template<typename valueType>
     void finaliseComm(Vector<valueType>& field, std::string commName)
     {
+        if (precision(commName) == CommPrecision::Single)
+        {
+            finaliseCommAs<detail::SinglePrecision<valueType>>(field, commName);
+            return;
+        }
+        finaliseCommAs<detail::FullPrecision<valueType>>(field, commName);
+    }
+
+    /**
+     * @brief Starts the non-blocking communication of the boundary values, eg. with a
+     * communicator created by createFaceCommunicator.
+     * @tparam valueType The value type of the boundary data.
+     * @param boundaryData The boundary data whose values are communicated.
+     * @param commName The communication name, typically a file and line number.
+     */
+    template<typename valueType>
+    void startComm(BoundaryData<valueType>& boundaryData, const std::string& commName)
+    {
+        startComm(boundaryData.value(), commName);
+    }
+
+    /**
+     * @brief Finalizes the non-blocking communication of the boundary values.
+     * @tparam valueType The value type of the boundary data.
+     * @param boundaryData The boundary data whose values are communicated.
+     * @param commName The communication name, typically a file and line number.
+     */
+    template<typename valueType>
+    void finaliseComm(BoundaryData<valueType>& boundaryData, std::string commName)
+    {
+        finaliseComm(boundaryData.value(), commName);
+    }
+
+    /**
+     * @brief Gets the flattened receive map of all ranks, ie. the indices of the received values.
+     * @param exec The executor of the indices.
+     * @return The received indices, ordered by rank.
+     */
+    const Vector<localIdx>& receiveIndices(const Executor& exec)
+    {
+        return indices(receive_.indices, receiveIdxExec_, exec);
+    }
+
+    /**
+     * @brief Starts a single non-blocking communication for several fields of possibly different
+     * value types. The send values of all fields are packed into one message per neighbour rank.
+     * @tparam valueTypes The value types of the fields.
+     * @param commName The communication name, typically a file and line number.
+     * @param fields The fields to be communicated/synchronized, on the same executor.
+     */
+    template<typename... valueTypes>
+    void startAggregatedComm(const std::string& commName, Vector<valueTypes>&... fields)
+    {
+        ScopedTimer timer("Communicator::startAggregatedComm");
+        ScopedTimer commTimer(commName);
+        static_assert(sizeof...(valueTypes) > 0, "At least one field is required.");
+        NF_DEBUG_ASSERT(
+            CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
+            "There is already an ongoing communication for key " << commName << "."
+        );
+        progress();
+        const auto exec = std::get<0>(std::tie(fields...)).exec();
+        NF_DEBUG_ASSERT(((fields.exec() == exec) && ...), "Executors are not the same.");
+
+        auto& aggregated = aggregatedComm(commName, {sizeof(valueTypes)...}, exec);
+        auto& buffer = aggregated.buffer;
+        CommBuffer_[commName] = &buffer;
+        buffer.setPersistent(persistent_);
+        buffer.setTopology(topology_.get());
+        // the aggregated layout is fixed, the slots are sized for its messages
+        buffer.setSharedMemory(sharedMemory_.get(), sizeof(char));
+#ifdef NF_WITH_NCCL
+        buffer.setNccl(nccl_.get(), exec);
+#endif
+        buffer.initComm<char>(commName);
+
+        auto& stats = statistics_[commName];
+        {
+            ScopedTimer packTimer("pack");
+            auto sendBuffer = buffer.getSend<char>();
+            if (buffer.exec() == exec)
+            {
+                packAggregated(aggregated.sendOffsets, sendBuffer.data(), fields...);
+            }
+            else
+            {
+                Array<char> staging(exec, static_cast<localIdx>(sendBuffer.size()));
+                packAggregated(aggregated.sendOffsets, staging.data(), fields...);
+                std::visit(
+                    detail::deepCopyVisitor(staging.size(), staging.data(), sendBuffer.data()),
+                    exec,
+                    buffer.exec()
+                );
+            }
+            // the buffer must be complete before MPI reads it
+            if (!buffer.isStreamOrdered())
+            {
+                NeoN::fence(exec);
+            }
+            stats.packTime += packTimer.elapsed();
+        }
+        buffer.startComm();
+        recordStart(stats, buffer);
+    }
+
+    /**
+     * @brief Finalizes the aggregated communication started with startAggregatedComm.
+     * @tparam valueTypes The value types of the fields.
+     * @param commName The communication name, typically a file and line number.
+     * @param fields The fields to be synchronized, in the order passed to startAggregatedComm.
+     */
+    template<typename... valueTypes>
+    void finaliseAggregatedComm(const std::string& commName, Vector<valueTypes>&... fields)
+    {
+        ScopedTimer timer("Communicator::finaliseAggregatedComm");
+        ScopedTimer commTimer(commName);
         NF_DEBUG_ASSERT(
             CommBuffer_.find(commName) != CommBuffer_.end() && CommBuffer_[commName],
             "No communication associated with key: " << commName
         );
+        const auto exec = std::get<0>(std::tie(fields...)).exec();
+        auto& aggregated = aggregatedComm(commName, {sizeof(valueTypes)...}, exec);
+        auto& buffer = aggregated.buffer;
+        NF_DEBUG_ASSERT(CommBuffer_[commName] == &buffer, "Communication was not aggregated.");
+        auto& stats = statistics_[commName];
+        {
+            ScopedTimer waitTimer("wait");
+            buffer.waitComplete();
+            stats.waitTime += waitTimer.elapsed();
+        }
 
-        CommBuffer_[commName]->waitComplete();
-        for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
         {
-            auto rankBuffer = CommBuffer_[commName]->getReceive<valueType>(rank);
-            for (size_t data = 0; data < receiveMap_[rank].size(); ++data)
-                field(static_cast<size_t>(receiveMap_[rank][data].local_idx)) = rankBuffer[data];
+            ScopedTimer unpackTimer("unpack");
+            auto receiveBuffer = buffer.getReceive<char>();
+            if (buffer.exec() == exec)
+            {
+                unpackAggregated(aggregated.receiveOffsets, receiveBuffer.data(), fields...);
+            }
+            else
+            {
+                Array<char> staging(exec, static_cast<localIdx>(receiveBuffer.size()));
+                std::visit(
+                    detail::deepCopyVisitor(staging.size(), receiveBuffer.data(), staging.data()),
+                    buffer.exec(),
+                    exec
+                );
+                unpackAggregated(aggregated.receiveOffsets, staging.data(), fields...);
+            }
+            if (TimerRegistry::instance().fenceEnabled())
+            {
+                NeoN::fence(exec);
+            }
+            stats.unpackTime += unpackTimer.elapsed();
         }
-        CommBuffer_[commName]->finaliseComm();
+        recordFinalise(stats, buffer);
+        buffer.finaliseComm();
         CommBuffer_[commName] = nullptr;
     }
 
+    /**
+     * @brief Gets the statistics of the exchanges with the given communication name.
+     * @param commName The communication name, typically a file and line number.
+     * @return The accumulated statistics.
+     */
+    const CommStatistics& statistics(const std::string& commName) const;
+
+    /**
+     * @brief Gets the statistics of all communication names.
+     * @return The accumulated statistics per communication name.
+     */
+    const std::unordered_map<std::string, CommStatistics>& statistics() const
+    {
+        return statistics_;
+    }
+
+    /**
+     * @brief Removes the statistics of all communication names.
+     */
+    void resetStatistics() { statistics_.clear(); }
+
 private:
 
+    /**
+     * @brief The buffer and layout of an aggregated communication. The data of every field is
+     * stored contiguously per rank, with segments padded to aggregateAlignment bytes.
+     */
+    struct AggregatedComm
+    {
+        std::vector<std::size_t> typeSizes; /**< The value type sizes of the fields. */
+        std::vector<Vector<localIdx>>
+            sendOffsets; /**< Per field and rank, the byte offset of the send index zero. */
+        std::vector<Vector<localIdx>>
+            receiveOffsets; /**< Per field and rank, the byte offset of the receive index zero. */
+        bufferType buffer;  /**< The dedicated buffer of the communication. */
+    };
+
+    static constexpr std::size_t aggregateAlignment = alignof(std::max_align_t);
+
     mpi::MPIEnvironment mpiEnviron_; /**< The MPI environment. */
-    CommMap sendMap_;                /**< The rank send map. */
-    CommMap receiveMap_;             /**< The rank receive map. */
-    std::vector<bufferType> buffers; /**< Communication buffers. */
+    FlatCommMap send_;               /**< The flattened send map of all ranks. */
+    FlatCommMap receive_;            /**< The flattened receive map of all ranks. */
+    std::vector<localIdx> sendRankIdx_;    /**< The rank of every flattened send index. */
+    std::vector<localIdx> receiveRankIdx_; /**< The rank of every flattened receive index. */
+    std::unique_ptr<Vector<localIdx>>
+        sendIdxExec_; /**< The flattened send map on the executor of the last field. */
+    std::unique_ptr<Vector<localIdx>>
+        receiveIdxExec_; /**< The flattened receive map on the executor of the last field. */
+    std::unique_ptr<Vector<localIdx>> sendRankIdxExec_; /**< The send ranks on the executor. */
+    std::unique_ptr<Vector<localIdx>>
+        receiveRankIdxExec_; /**< The receive ranks on the executor. */
+    std::deque<bufferType> buffers; /**< Communication buffers, with stable addresses. */
+    bool persistent_ {false};       /**< Whether persistent MPI requests are used. */
+    std::unique_ptr<mpi::NeighbourhoodTopology>
+        topology_; /**< The neighbourhood topology, nullptr for point-to-point messages. */
+    std::unique_ptr<mpi::SharedMemoryNode>
+        sharedMemory_; /**< The ranks of this node, nullptr for MPI messages only. */
+    std::size_t sharedEntryBytes_ {0}; /**< The largest value type size in shared memory. */
+    std::unique_ptr<mpi::ProgressThread>
+        progressThread_; /**< The thread driving the MPI progress, nullptr if disabled. */
+#ifdef NF_WITH_NCCL
+    std::unique_ptr<mpi::NcclCommunicator>
+        nccl_; /**< The NCCL communicator, nullptr for MPI messages only. */
+#endif
+    std::unordered_map<std::string, bufferType>
+        reservedBuffers_; /**< The dedicated, pre-sized buffers per communication name. */
+    std::unordered_map<std::string, AggregatedComm>
+        aggregatedComms_; /**< The aggregated communications per communication name. */
     std::unordered_map<std::string, bufferType*>
         CommBuffer_; /**< The communication key to buffer map, nullptr indicates no assigned buffer.
                       */
+    std::unordered_map<std::string, CommStatistics>
+        statistics_; /**< The accumulated statistics per communication name. */
+    std::unordered_map<std::string, CommPrecision>
+        precisions_; /**< The precision per communication name, if set explicitly. */
+    CommPrecision defaultPrecision_ {CommPrecision::Full}; /**< The precision of other names. */
+
+    /**
+     * @brief Returns the executor of the communication buffers for data on exec, which is exec
+     * for the exchange with NCCL and commBufferExecutor(exec) otherwise.
+     * @param exec The executor of the communicated data.
+     * @return The executor of the communication buffers.
+     */
+    Executor bufferExecutor(const Executor& exec) const
+    {
+#ifdef NF_WITH_NCCL
+        if (nccl_ && std::holds_alternative<GPUExecutor>(exec)) return exec;
+#endif
+        return commBufferExecutor(exec);
+    }
+
+    /**
+     * @brief Accounts the messages of a started exchange and counts them in the current timer.
+     * @param stats The statistics of the communication name.
+     * @param buffer The buffer of the exchange.
+     */
+    static void recordStart(CommStatistics& stats, const bufferType& buffer);
+
+    /**
+     * @brief Accounts the received messages of a completed exchange and counts them in the
+     * current timer.
+     * @param stats The statistics of the communication name.
+     * @param buffer The buffer of the exchange.
+     */
+    static void recordFinalise(CommStatistics& stats, const bufferType& buffer);
 
     /**
      * @brief Finds an uninitialized communication buffer.
@@ -165,7 +684,339 @@ private:
      * @return pointer to the newly created buffer.
      */
     bufferType* createNewDuplexBuffer();
+
+    /**
+     * @brief Returns the number of communicated nodes per rank.
+     * @param commMap The flattened send or receive map.
+     * @return The number of nodes of every rank.
+     */
+    static std::vector<std::size_t> rankSizes(const FlatCommMap& commMap);
+
+    /**
+     * @brief Returns the aggregated communication of the given name, the layout and buffer are
+     * (re)created if the value types or the executor of the fields have changed.
+     * @param commName The communication name.
+     * @param typeSizes The value type sizes of the fields.
+     * @param exec The executor of the fields.
+     * @return The aggregated communication.
+     */
+    AggregatedComm& aggregatedComm(
+        const std::string& commName, const std::vector<std::size_t>& typeSizes, const Executor& exec
+    );
+
+    /**
+     * @brief Computes the per field and rank byte offsets of an aggregated buffer.
+     * @param commMap The flattened send or receive map.
+     * @param typeSizes The value type sizes of the fields.
+     * @param exec The executor of the fields.
+     * @param rankBytes Returns the number of bytes per rank.
+     * @return The offsets of every field on exec.
+     */
+    static std::vector<Vector<localIdx>> aggregatedOffsets(
+        const FlatCommMap& commMap,
+        const std::vector<std::size_t>& typeSizes,
+        const Executor& exec,
+        std::vector<std::size_t>& rankBytes
+    );
+
+    /**
+     * @brief Returns the rank of every index of the flattened map.
+     * @param commMap The flattened send or receive map.
+     * @return The ranks in the order of the indices.
+     */
+    static std::vector<localIdx> flattenRanks(const FlatCommMap& commMap);
+
+    /**
+     * @brief Returns the flattened index array on the given executor, copying it on first use.
+     * @param hostIdx The flattened index array on the host.
+     * @param execIdx The cached index array.
+     * @param exec The executor of the communicated field.
+     * @return The index array on exec.
+     */
+    static const Vector<localIdx>& indices(
+        const std::vector<localIdx>& hostIdx,
+        std::unique_ptr<Vector<localIdx>>& execIdx,
+        const Executor& exec
+    );
+
+    /**
+     * @brief Starts the non-blocking communication with the send values converted by Packed.
+     * @tparam Packed The conversion of the values to the type of the buffer.
+     * @tparam valueType The value type of the field.
+     * @param field The field to be communicated/synchronized.
+     * @param commName The communication name, typically a file and line number.
+     */
+    template<typename Packed, typename valueType>
+    void startCommAs(Vector<valueType>& field, const std::string& commName)
+    {
+        ScopedTimer timer("Communicator::startComm", field.exec());
+        ScopedTimer commTimer(commName);
+        NF_DEBUG_ASSERT(
+            CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
+            "There is already an ongoing communication for key " << commName << "."
+        );
+
+        progress();
+
+        using packedType = typename Packed::type;
+        const auto exec = field.exec();
+        const auto bufferExec = bufferExecutor(exec);
+        auto reserved = reservedBuffers_.find(commName);
+        if (reserved != reservedBuffers_.end())
+        {
+            NF_DEBUG_ASSERT(
+                reserved->second.exec() == bufferExec,
+                "Buffer for key " << commName << " was reserved for another executor."
+            );
+            CommBuffer_[commName] = &reserved->second;
+        }
+        else
+        {
+            CommBuffer_[commName] = findDuplexBuffer();
+            if (!CommBuffer_[commName])
+            {
+                CommBuffer_[commName] = createNewDuplexBuffer();
+            }
+            CommBuffer_[commName]->setExecutor(bufferExec);
+        }
+        CommBuffer_[commName]->setPersistent(persistent_);
+        CommBuffer_[commName]->setTopology(topology_.get());
+        CommBuffer_[commName]->setSharedMemory(sharedMemory_.get(), sharedEntryBytes_);
+#ifdef NF_WITH_NCCL
+        CommBuffer_[commName]->setNccl(nccl_.get(), exec);
+#endif
+        CommBuffer_[commName]->initComm<packedType>(commName);
+
+        auto& stats = statistics_[commName];
+        {
+            ScopedTimer packTimer("pack");
+            auto sendBuffer = CommBuffer_[commName]->getSend<packedType>();
+            if (bufferExec == exec)
+            {
+                pack<Packed>(field, sendBuffer);
+            }
+            else
+            {
+                Array<packedType> staging(exec, static_cast<localIdx>(sendBuffer.size()));
+                pack<Packed>(field, staging.view());
+                std::visit(
+                    detail::deepCopyVisitor(staging.size(), staging.data(), sendBuffer.data()),
+                    exec,
+                    bufferExec
+                );
+            }
+            // the buffer must be complete before MPI reads it
+            if (!CommBuffer_[commName]->isStreamOrdered())
+            {
+                NeoN::fence(exec);
+            }
+            stats.packTime += packTimer.elapsed();
+        }
+        CommBuffer_[commName]->startComm();
+        recordStart(stats, *CommBuffer_[commName]);
+    }
+
+    /**
+     * @brief Finalizes the non-blocking communication with the received values converted by
+     * Packed.
+     * @tparam Packed The conversion of the values to the type of the buffer.
+     * @tparam valueType The value type of the field.
+     * @param field The field to be communicated/synchronized.
+     * @param commName The communication name, typically a file and line number.
+     */
+    template<typename Packed, typename valueType>
+    void finaliseCommAs(Vector<valueType>& field, std::string commName)
+    {
+        ScopedTimer timer("Communicator::finaliseComm", field.exec());
+        ScopedTimer commTimer(commName);
+        NF_DEBUG_ASSERT(
+            CommBuffer_.find(commName) != CommBuffer_.end() && CommBuffer_[commName],
+            "No communication associated with key: " << commName
+        );
+
+        auto& stats = statistics_[commName];
+        {
+            ScopedTimer waitTimer("wait");
+            CommBuffer_[commName]->waitComplete();
+            stats.waitTime += waitTimer.elapsed();
+        }
+
+        {
+            ScopedTimer unpackTimer("unpack");
+            using packedType = typename Packed::type;
+            const auto exec = field.exec();
+            const auto bufferExec = CommBuffer_[commName]->exec();
+            auto receiveBuffer = CommBuffer_[commName]->getReceive<packedType>();
+            if (bufferExec == exec)
+            {
+                unpack<Packed>(View<const packedType>(receiveBuffer), field);
+            }
+            else
+            {
+                Array<packedType> staging(exec, static_cast<localIdx>(receiveBuffer.size()));
+                std::visit(
+                    detail::deepCopyVisitor(staging.size(), receiveBuffer.data(), staging.data()),
+                    bufferExec,
+                    exec
+                );
+                unpack<Packed>(View<const packedType>(staging.view()), field);
+            }
+            if (TimerRegistry::instance().fenceEnabled())
+            {
+                NeoN::fence(exec);
+            }
+            stats.unpackTime += unpackTimer.elapsed();
+        }
+        recordFinalise(stats, *CommBuffer_[commName]);
+        CommBuffer_[commName]->finaliseComm();
+        CommBuffer_[commName] = nullptr;
+    }
+
+    /**
+     * @brief Gathers the send values of field into a contiguous buffer on the field executor.
+     * @tparam Packed The conversion of the values to the type of the buffer.
+     * @param field The field to be communicated.
+     * @param buffer The buffer of all ranks, resides in the memory space of the field.
+     */
+    template<typename Packed, typename valueType>
+    void pack(const Vector<valueType>& field, View<typename Packed::type> buffer)
+    {
+        const auto& idx = indices(send_.indices, sendIdxExec_, field.exec());
+        NF_DEBUG_ASSERT(
+            static_cast<size_t>(idx.size()) == buffer.size(), "Send buffer size mismatch."
+        );
+        const auto [fieldView, idxView] = views(field, idx);
+        parallelFor(
+            field.exec(),
+            {0, idx.size()},
+            KOKKOS_LAMBDA(const localIdx i) { buffer[i] = Packed::pack(fieldView[idxView[i]]); },
+            "communicatorPack"
+        );
+    }
+
+    /**
+     * @brief Scatters a contiguous buffer into the receive values of field on the field executor.
+     * @tparam Packed The conversion of the values to the type of the buffer.
+     * @param buffer The buffer of all ranks, resides in the memory space of the field.
+     * @param field The field to be synchronized.
+     */
+    template<typename Packed, typename valueType>
+    void unpack(View<const typename Packed::type> buffer, Vector<valueType>& field)
+    {
+        const auto& idx = indices(receive_.indices, receiveIdxExec_, field.exec());
+        NF_DEBUG_ASSERT(
+            static_cast<size_t>(idx.size()) == buffer.size(), "Receive buffer size mismatch."
+        );
+        auto fieldView = field.view();
+        auto idxView = idx.view();
+        parallelFor(
+            field.exec(),
+            {0, idx.size()},
+            KOKKOS_LAMBDA(const localIdx i) { fieldView[idxView[i]] = Packed::unpack(buffer[i]); },
+            "communicatorUnpack"
+        );
+    }
+
+    /**
+     * @brief Packs the send values of all fields into an aggregated buffer.
+     * @param offsets The per field and rank byte offsets.
+     * @param buffer The buffer of all ranks, resides in the memory space of the fields.
+     * @param fields The fields to be communicated.
+     */
+    template<typename... valueTypes>
+    void packAggregated(
+        const std::vector<Vector<localIdx>>& offsets,
+        char* buffer,
+        const Vector<valueTypes>&... fields
+    )
+    {
+        std::size_t fieldi = 0;
+        (packAggregatedField(offsets[fieldi++], buffer, fields), ...);
+    }
+
+    template<typename valueType>
+    void packAggregatedField(
+        const Vector<localIdx>& offsets, char* buffer, const Vector<valueType>& field
+    )
+    {
+        const auto& idx = indices(send_.indices, sendIdxExec_, field.exec());
+        const auto& rankIdx = indices(sendRankIdx_, sendRankIdxExec_, field.exec());
+        const auto [fieldView, idxView, rankView, offsetView] = views(field, idx, rankIdx, offsets);
+        constexpr auto typeSize = static_cast<localIdx>(sizeof(valueType));
+        parallelFor(
+            field.exec(),
+            {0, idx.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                auto* value =
+                    reinterpret_cast<valueType*>(buffer + (offsetView[rankView[i]] + i * typeSize));
+                *value = fieldView[idxView[i]];
+            },
+            "communicatorPackAggregated"
+        );
+    }
+
+    /**
+     * @brief Unpacks an aggregated buffer into the receive values of all fields.
+     * @param offsets The per field and rank byte offsets.
+     * @param buffer The buffer of all ranks, resides in the memory space of the fields.
+     * @param fields The fields to be synchronized.
+     */
+    template<typename... valueTypes>
+    void unpackAggregated(
+        const std::vector<Vector<localIdx>>& offsets, char* buffer, Vector<valueTypes>&... fields
+    )
+    {
+        std::size_t fieldi = 0;
+        (unpackAggregatedField(offsets[fieldi++], buffer, fields), ...);
+    }
+
+    template<typename valueType>
+    void
+    unpackAggregatedField(const Vector<localIdx>& offsets, char* buffer, Vector<valueType>& field)
+    {
+        const auto& idx = indices(receive_.indices, receiveIdxExec_, field.exec());
+        const auto& rankIdx = indices(receiveRankIdx_, receiveRankIdxExec_, field.exec());
+        auto fieldView = field.view();
+        const auto [idxView, rankView, offsetView] = views(idx, rankIdx, offsets);
+        constexpr auto typeSize = static_cast<localIdx>(sizeof(valueType));
+        parallelFor(
+            field.exec(),
+            {0, idx.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                fieldView[idxView[i]] = *reinterpret_cast<const valueType*>(
+                    buffer + (offsetView[rankView[i]] + i * typeSize)
+                );
+            },
+            "communicatorUnpackAggregated"
+        );
+    }
 };
+
+/**
+ * @brief Runs a split-phase halo exchange that overlaps communication with computation.
+ * The exchange of field is started, interior is executed while the messages are in flight and
+ * after the exchange has been finalised boundary is executed, which may read the halo values.
+ * @tparam valueType The value type of the field.
+ * @param comm The communicator.
+ * @param field The field to be communicated/synchronized.
+ * @param commName The communication name, typically a file and line number.
+ * @param interior Work that does not depend on the halo values, e.g. interior faces.
+ * @param boundary Work that depends on the halo values, e.g. processor boundary faces.
+ */
+template<typename valueType, typename InteriorKernel, typename BoundaryKernel>
+void splitPhaseComm(
+    Communicator& comm,
+    Vector<valueType>& field,
+    const std::string& commName,
+    InteriorKernel interior,
+    BoundaryKernel boundary
+)
+{
+    comm.startComm(field, commName);
+    interior();
+    comm.finaliseComm(field, commName);
+    boundary();
+}
 #endif
 
 } // namespace NeoN
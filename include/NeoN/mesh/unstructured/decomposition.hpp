@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/vector/vectorTypeDefs.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/mesh/unstructured/communicator.hpp"
+#endif
+
+namespace NeoN
+{
+
+/**
+ * @brief The layout of the faces shared with other parts in the local mesh.
+ */
+enum class HaloLayout
+{
+    ProcessorPatch, /**< The shared faces form a final boundary patch. */
+    GhostCells      /**< The shared faces are internal faces with a ghost cell as neighbour. */
+};
+
+/**
+ * @brief The rank local part of a decomposed mesh.
+ *
+ * The local mesh contains the cells of one part in their original order. The internal faces
+ * between two local cells come first, followed by the original boundary patches restricted to
+ * the local cells and a final processor patch with the faces shared with other parts. The
+ * processor faces are sorted by neighbour part and original face index and are oriented
+ * outwards. The values of the remote cells are exchanged into a halo appended after the local
+ * cells, ie. the remote cell of processor face i is stored at nCells + i.
+ *
+ * With HaloLayout::GhostCells the halo is part of the mesh instead, see
+ * UnstructuredMesh::setGhostCells. The processor faces, in the same order, follow the local
+ * internal faces as internal faces whose neighbour is the ghost cell nCells + i, the cell
+ * volumes and centres hold the remote values after the local ones and there is no processor
+ * patch. The volume fields of the mesh are of size nCells plus the number of ghost cells and the
+ * ghost values are filled by the communicator of createCommunicator. Both parts compute the
+ * values of the processor faces, hence sendFaces and receiveFaces are empty.
+ */
+struct DecomposedMesh
+{
+    UnstructuredMesh mesh; /**< The rank local mesh. */
+    labelVector cellMap;   /**< Original index of every local cell. */
+    labelVector faceMap;   /**< Original index of every local face. */
+    /**
+     * @brief Per part, the local cells whose values are sent, in the order of the processor
+     * faces.
+     */
+    std::vector<std::vector<label>> sendCells;
+    /**
+     * @brief Per part, the halo positions the received values are stored at.
+     */
+    std::vector<std::vector<label>> receiveCells;
+    /**
+     * @brief Per part, the boundary faces of the processor patch whose values are sent, ie. the
+     * faces shared with a part of higher index, in the order of the processor faces.
+     */
+    std::vector<std::vector<label>> sendFaces;
+    /**
+     * @brief Per part, the boundary faces of the processor patch whose values are received, ie.
+     * the faces shared with a part of lower index.
+     */
+    std::vector<std::vector<label>> receiveFaces;
+};
+
+/**
+ * @brief Partitions the cells of the mesh by recursive bisection of the cell graph.
+ *
+ * Every bisection orders the cells of a part by a breadth first search from a peripheral cell and
+ * splits the order at the weighted median, so that the parts have connected and compact shapes
+ * with balanced cost.
+ *
+ * @param mesh The mesh to partition.
+ * @param nParts The number of parts.
+ * @param cellWeights The cost of every cell, unit costs are used if empty.
+ * @return The part of every cell.
+ */
+std::vector<label> partitionCells(
+    const UnstructuredMesh& mesh, localIdx nParts, const std::vector<scalar>& cellWeights = {}
+);
+
+/**
+ * @brief Extracts the rank local mesh and communication maps of one part.
+ *
+ * @param mesh The undecomposed mesh.
+ * @param cellToPart The part of every cell, eg. computed by partitionCells.
+ * @param part The part to extract.
+ * @param layout The layout of the faces shared with other parts.
+ * @return The local mesh, the maps to the original mesh and the communication maps.
+ */
+DecomposedMesh decomposeMesh(
+    const UnstructuredMesh& mesh,
+    const std::vector<label>& cellToPart,
+    label part,
+    HaloLayout layout = HaloLayout::ProcessorPatch
+);
+
+#ifdef NF_WITH_MPI_SUPPORT
+/**
+ * @brief Creates the communicator exchanging the halo of a decomposed mesh.
+ *
+ * @param mpiEnviron The MPI environment, the rank is the part of the decomposed mesh.
+ * @param decomposed The decomposed mesh.
+ * @return The communicator, fields of size nCells plus number of processor faces are exchanged.
+ */
+Communicator
+createCommunicator(const mpi::MPIEnvironment& mpiEnviron, const DecomposedMesh& decomposed);
+
+/**
+ * @brief Creates the communicator synchronising the values of the processor faces.
+ *
+ * Both parts of a processor face store its value, the part of lower index sends its value and
+ * the part of higher index receives it. Hence the value of a face has to be computed only once,
+ * eg. by the part of lower index, and agrees on both parts after the exchange.
+ *
+ * @param mpiEnviron The MPI environment, the rank is the part of the decomposed mesh.
+ * @param decomposed The decomposed mesh.
+ * @return The communicator, boundary values of size nBoundaryFaces are exchanged.
+ */
+Communicator
+createFaceCommunicator(const mpi::MPIEnvironment& mpiEnviron, const DecomposedMesh& decomposed);
+#endif
+
+} // namespace NeoN
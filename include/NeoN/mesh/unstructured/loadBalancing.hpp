@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/mesh/unstructured/decomposition.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/environment.hpp"
+#endif
+
+namespace NeoN
+{
+
+/**
+ * @brief The cells moved from one decomposition of a mesh to another, seen from one part.
+ *
+ * Both decompositions need to be created by decomposeMesh from the same mesh, so that the local
+ * cells of a part are the cells of the part in their original order.
+ */
+struct Redistribution
+{
+    /**
+     * @brief Per part of the new decomposition, the cells of the old local mesh moved to it.
+     */
+    std::vector<std::vector<label>> sendCells;
+    /**
+     * @brief Per part of the old decomposition, the cells of the new local mesh received from it,
+     * in the order of the sendCells of that part.
+     */
+    std::vector<std::vector<label>> receiveCells;
+    localIdx nCells; /**< The number of cells of the new local mesh. */
+};
+
+/**
+ * @brief Computes the cells a part sends and receives when changing the decomposition.
+ *
+ * No communication is required since the old and the new part of every cell is known on all
+ * parts.
+ *
+ * @param oldCellToPart The part of every cell in the current decomposition.
+ * @param newCellToPart The part of every cell in the new decomposition.
+ * @param part The part of this rank.
+ * @return The cells to send and receive.
+ */
+Redistribution createRedistribution(
+    const std::vector<label>& oldCellToPart, const std::vector<label>& newCellToPart, label part
+);
+
+/**
+ * @brief Sums the totals of all timers of the TimerRegistry with the given name.
+ *
+ * The timers are matched by the last element of their path, ie. the same phase is accumulated
+ * over all enclosing timers, eg. a chemistry timer opened inside of every time step.
+ *
+ * @param name The name of the timers.
+ * @return The accumulated duration in seconds.
+ */
+scalar timerCost(const std::string& name);
+
+#ifdef NF_WITH_MPI_SUPPORT
+/**
+ * @brief Computes the imbalance of a cost over the ranks.
+ *
+ * This is a collective operation.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param localCost The cost of this rank, eg. measured by timerCost.
+ * @return The maximum over the ranks divided by the average minus one, ie. zero if balanced.
+ */
+scalar loadImbalance(const mpi::MPIEnvironment& mpiEnviron, scalar localCost);
+
+/**
+ * @brief Distributes the measured cost of every rank over its cells and gathers the costs of all
+ * cells of the undecomposed mesh.
+ *
+ * The cost of a rank is split proportionally to the given cell weights, eg. the number of
+ * chemistry substeps of every cell, or evenly without weights. This is a collective operation.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param decomposed The part of this rank.
+ * @param nGlobalCells The number of cells of the undecomposed mesh.
+ * @param localCost The cost of this rank, eg. measured by timerCost.
+ * @param localCellWeights The relative cost of every local cell, even costs are used if empty.
+ * @return The cost of every cell of the undecomposed mesh on all ranks.
+ */
+std::vector<scalar> gatherCellCosts(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const DecomposedMesh& decomposed,
+    localIdx nGlobalCells,
+    scalar localCost,
+    const std::vector<scalar>& localCellWeights = {}
+);
+
+/**
+ * @brief Partitions the undecomposed mesh into one part per rank balancing the measured costs.
+ *
+ * The new decomposition follows from decomposeMesh with the returned parts, the fields are moved
+ * to it by redistribute with the Redistribution from the old to the new parts and the processor
+ * halo is exchanged by a new createCommunicator. This is a collective operation.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param mesh The undecomposed mesh.
+ * @param decomposed The part of this rank.
+ * @param localCost The cost of this rank, eg. measured by timerCost.
+ * @param localCellWeights The relative cost of every local cell, even costs are used if empty.
+ * @return The new part of every cell.
+ */
+std::vector<label> repartitionCells(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const UnstructuredMesh& mesh,
+    const DecomposedMesh& decomposed,
+    scalar localCost,
+    const std::vector<scalar>& localCellWeights = {}
+);
+
+/**
+ * @brief Moves the cell values of the old to the new decomposition.
+ *
+ * The values are staged on the host and exchanged with point to point messages, the values
+ * remaining on a rank are copied. This is a collective operation.
+ *
+ * @param mpiEnviron The MPI environment.
+ * @param redistribution The cells moved between the decompositions.
+ * @param values The values of the local cells of the old decomposition.
+ * @return The values of the local cells of the new decomposition on the executor of values.
+ */
+template<typename ValueType>
+Vector<ValueType> redistribute(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const Redistribution& redistribution,
+    const Vector<ValueType>& values
+);
+#endif
+
+} // namespace NeoN
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/vector/vectorTypeDefs.hpp"
+#include "NeoN/mesh/unstructured/boundaryMesh.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @brief The geometry of the faces and cells of a mesh.
+ */
+struct MeshGeometry
+{
+    vectorVector faceAreas;    /**< The area face normals. */
+    vectorVector faceCentres;  /**< The face centres. */
+    scalarVector magFaceAreas; /**< The magnitudes of the face areas. */
+    scalarVector cellVolumes;  /**< The cell volumes. */
+    vectorVector cellCentres;  /**< The cell centres. */
+};
+
+/** @brief computes the face and cell geometry from the points on the executor of the points
+ *
+ * The face centres and areas follow from a triangle decomposition of every face around its
+ * average point and the cell centres and volumes from a pyramid decomposition of every cell
+ * around the average of its face centres, the same decomposition as used by OpenFOAM. All
+ * faces and cells are computed in parallel, the contributions of the faces to their cells are
+ * accumulated atomically.
+ *
+ * @param points The mesh points.
+ * @param faceOffsets The start of the points of every face in facePoints, of size nFaces + 1.
+ * @param facePoints The points of all faces, ordered such that the area points out of the owner.
+ * @param faceOwner The owner cell of every face.
+ * @param faceNeighbour The neighbour cell of every internal face.
+ * @param nCells The number of cells.
+ */
+MeshGeometry computeMeshGeometry(
+    const vectorVector& points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    const labelVector& faceOwner,
+    const labelVector& faceNeighbour,
+    localIdx nCells
+);
+
+/** @brief creates the boundary mesh of the boundary faces, which follow the internal faces
+ *
+ * @param geometry The geometry of the mesh, see computeMeshGeometry.
+ * @param faceOwner The owner cell of every face.
+ * @param nInternalFaces The number of internal faces.
+ * @param boundaryOffsets The first boundary face of every patch and the number of boundary faces.
+ */
+BoundaryMesh computeBoundaryMesh(
+    const MeshGeometry& geometry,
+    const labelVector& faceOwner,
+    localIdx nInternalFaces,
+    std::vector<localIdx> boundaryOffsets
+);
+
+/** @brief recomputes the geometry of the faces with moved points and of the cells of these faces
+ *
+ * The faces whose points are unchanged and their cells keep their geometry.
+ *
+ * @param geometry The geometry at the old points, updated to the new points.
+ * @param oldPoints The mesh points before the motion.
+ * @param points The moved mesh points.
+ * @param faceOffsets The start of the points of every face in facePoints, of size nFaces + 1.
+ * @param facePoints The points of all faces.
+ * @param faceOwner The owner cell of every face.
+ * @param faceNeighbour The neighbour cell of every internal face.
+ * @return The volume swept by every face, positive if the face moves out of its owner.
+ */
+scalarVector updateMeshGeometry(
+    MeshGeometry& geometry,
+    const vectorVector& oldPoints,
+    const vectorVector& points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    const labelVector& faceOwner,
+    const labelVector& faceNeighbour
+);
+
+/** @brief moves the points of the mesh and updates its geometry on the executor of the mesh
+ *
+ * Only the geometry of the faces with moved points and of their cells is recomputed, see
+ * updateMeshGeometry. The topology is unchanged, hence the sparsity pattern and the solver
+ * structures stay valid, while the data derived from the geometry, eg. the weights of the
+ * GeometryScheme, is recomputed on its next use, see UnstructuredMesh::geometryVersion. The
+ * swept volumes divided by dt are stored as UnstructuredMesh::meshPhi and the previous cell
+ * volumes as UnstructuredMesh::oldCellVolumes, hence the points are moved once per time step
+ * before the equations are assembled.
+ *
+ * @param mesh The mesh to update.
+ * @param points The moved mesh points.
+ * @param faceOffsets The start of the points of every face in facePoints, of size nFaces + 1.
+ * @param facePoints The points of all faces, the connectivity the mesh was created from.
+ * @param dt The time step of the motion.
+ */
+void movePoints(
+    UnstructuredMesh& mesh,
+    vectorVector points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    scalar dt
+);
+
+} // namespace NeoN
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/vector/vectorTypeDefs.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @brief The cell orderings available for mesh renumbering.
+ */
+enum class CellOrdering
+{
+    ReverseCuthillMcKee, /**< Reduces the bandwidth of the cell adjacency graph. */
+    Morton,              /**< Sorts the cells along a Morton curve through the cell centres. */
+    Hilbert              /**< Sorts the cells along a Hilbert curve through the cell centres. */
+};
+
+/**
+ * @brief A renumbered mesh and the permutations relating it to the original mesh.
+ *
+ * The maps are given from new to old indices, ie. the value of new cell i is taken from the
+ * old cell cellMap[i]. Fields of the original mesh can be transferred with permute.
+ */
+struct RenumberedMesh
+{
+    UnstructuredMesh mesh; /**< The renumbered mesh. */
+    labelVector cellMap;   /**< Old index of every new cell. */
+    labelVector faceMap;   /**< Old index of every new face, boundary faces keep their index. */
+    /**
+     * @brief Orientation of every new face relative to its old face, -1 if owner and neighbour
+     * were swapped to keep the owner index below the neighbour index and 1 otherwise.
+     * Face fluxes have to be multiplied by it after being permuted.
+     */
+    scalarVector faceSign;
+};
+
+/**
+ * @brief Computes a cell ordering of the mesh.
+ *
+ * @param mesh The mesh to renumber.
+ * @param ordering The ordering to compute.
+ * @return The old cell index of every new cell.
+ */
+std::vector<localIdx> computeCellOrdering(const UnstructuredMesh& mesh, CellOrdering ordering);
+
+/**
+ * @brief Renumbers the cells of a mesh and sorts its internal faces by owner.
+ *
+ * The cells are reordered according to the given ordering. Afterwards the internal faces are
+ * sorted by owner and neighbour, boundary faces keep their order so that the patch offsets remain
+ * valid. All connectivity and geometry vectors are permuted, including the face cells of the
+ * BoundaryMesh.
+ *
+ * @param mesh The mesh to renumber.
+ * @param ordering The cell ordering to apply.
+ * @return The renumbered mesh and the permutations.
+ */
+RenumberedMesh renumberMesh(const UnstructuredMesh& mesh, CellOrdering ordering);
+
+/**
+ * @brief Permutes a vector, ie. computes dst[i] = src[newToOld[i]].
+ *
+ * @param src The vector to permute.
+ * @param newToOld The source index of every entry of the result.
+ * @return The permuted vector.
+ */
+template<typename ValueType>
+Vector<ValueType> permute(const Vector<ValueType>& src, const labelVector& newToOld)
+{
+    NF_ASSERT(src.exec() == newToOld.exec(), "Executors are not the same.");
+    Vector<ValueType> dst(src.exec(), newToOld.size());
+    const auto [dstV, srcV, mapV] = views(dst, src, newToOld);
+    parallelFor(
+        src.exec(),
+        {0, dst.size()},
+        KOKKOS_LAMBDA(const localIdx i) { dstV[i] = srcV[static_cast<localIdx>(mapV[i])]; },
+        "permute"
+    );
+    return dst;
+}
+
+} // namespace NeoN
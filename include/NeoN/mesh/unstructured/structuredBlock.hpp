@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/primitives/label.hpp"
+
+namespace NeoN
+{
+
+/**
+ * @brief A face of a cell of a StructuredBlock.
+ */
+struct StructuredFace
+{
+    localIdx facei; /**< The face index, boundary faces follow the internal faces. */
+    bool owner;     /**< Whether the cell is the owner of the face. */
+};
+
+/**
+ * @class StructuredBlock
+ * @brief The i, j, k extents of a block structured hexahedral mesh in the numbering of
+ * create3DUniformMesh.
+ *
+ * Cell (i, j, k) has the index i + nx * (j + ny * k) and owns the internal faces to its
+ * neighbours in positive x, y and z direction in this order, the internal faces are ordered by
+ * owner. The six boundaries are the faces at the lower and upper end of x, y and z in this
+ * order, the faces of a boundary are ordered by the cell indices along the other directions. Hence
+ * the faces of a cell follow from its index without the face owner, face neighbour or cell to
+ * face connectivity.
+ */
+struct StructuredBlock
+{
+    localIdx nx; /**< The number of cells in x direction. */
+    localIdx ny; /**< The number of cells in y direction. */
+    localIdx nz; /**< The number of cells in z direction. */
+
+    KOKKOS_INLINE_FUNCTION localIdx nCells() const { return nx * ny * nz; }
+
+    KOKKOS_INLINE_FUNCTION localIdx nInternalFaces() const
+    {
+        return (nx - 1) * ny * nz + nx * (ny - 1) * nz + nx * ny * (nz - 1);
+    }
+
+    /**
+     * @brief Get the number of cells in a direction.
+     * @param d The direction, 0, 1 or 2 for x, y and z.
+     */
+    KOKKOS_INLINE_FUNCTION localIdx extent(localIdx d) const
+    {
+        return d == 0 ? nx : (d == 1 ? ny : nz);
+    }
+
+    /**
+     * @brief Get the index of the first internal face owned by a cell.
+     *
+     * The number of faces owned by the cells before celli, ie. the cells below celli with a
+     * neighbour in positive x, y and z direction respectively.
+     */
+    KOKKOS_INLINE_FUNCTION localIdx ownedFaceStart(localIdx celli) const
+    {
+        const auto i = celli % nx;
+        const auto j = (celli / nx) % ny;
+        const auto k = celli / (nx * ny);
+        const auto xFaces = (celli / nx) * (nx - 1) + i;
+        const auto yFaces = k * nx * (ny - 1) + Kokkos::min(i + nx * j, nx * (ny - 1));
+        const auto zFaces = Kokkos::min(celli, nx * ny * (nz - 1));
+        return xFaces + yFaces + zFaces;
+    }
+
+    /**
+     * @brief Get a face of a cell.
+     * @param celli The index of the cell.
+     * @param d The direction of the face normal, 0, 1 or 2 for x, y and z.
+     * @param upper Whether the face is at the upper end of the cell in direction d.
+     * @return The face index and whether the cell owns the face.
+     */
+    KOKKOS_INLINE_FUNCTION StructuredFace face(localIdx celli, localIdx d, bool upper) const
+    {
+        const localIdx idx[3] = {celli % nx, (celli / nx) % ny, celli / (nx * ny)};
+        const localIdx n[3] = {nx, ny, nz};
+        const localIdx stride[3] = {1, nx, nx * ny};
+        if (upper ? idx[d] + 1 < n[d] : idx[d] > 0)
+        {
+            // the internal face is owned by the lower of the two cells
+            const auto own = upper ? celli : celli - stride[d];
+            const localIdx ownIdx[3] = {own % nx, (own / nx) % ny, own / (nx * ny)};
+            auto facei = ownedFaceStart(own);
+            for (localIdx dir = 0; dir < d; dir++)
+            {
+                facei += ownIdx[dir] + 1 < n[dir] ? 1 : 0;
+            }
+            return {facei, upper};
+        }
+        // the boundary faces of the patches in direction 0 to d - 1 come first
+        localIdx bFacei = 0;
+        for (localIdx dir = 0; dir < d; dir++)
+        {
+            bFacei += 2 * nCells() / n[dir];
+        }
+        const auto d1 = d == 0 ? 1 : 0;
+        const auto d2 = d == 2 ? 1 : 2;
+        bFacei += (upper ? nCells() / n[d] : 0) + idx[d1] + n[d1] * idx[d2];
+        return {nInternalFaces() + bFacei, true};
+    }
+};
+
+} // namespace NeoN
@@ -4,11 +4,17 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include "Kokkos_Sort.hpp"
 
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/hostMirror.hpp"
 #include "NeoN/core/vector/vectorTypeDefs.hpp"
+#include "NeoN/mesh/unstructured/activeRegion.hpp"
 #include "NeoN/mesh/unstructured/boundaryMesh.hpp"
+#include "NeoN/mesh/unstructured/structuredBlock.hpp"
 #include "NeoN/finiteVolume/cellCentred/stencil/stencilDataBase.hpp"
 
 namespace NeoN
@@ -80,6 +86,16 @@ public:
      */
     const scalarVector& cellVolumes() const;
 
+    /**
+     * @brief Get the field of inverse cell volumes in the mesh.
+     *
+     * The inverse volumes are computed once on construction, so that operators normalise their
+     * cell results by a multiplication instead of a division.
+     *
+     * @return The field of inverse cell volumes in the mesh.
+     */
+    const scalarVector& invCellVolumes() const;
+
     /**
      * @brief Get the field of cell centres in the mesh.
      *
@@ -122,6 +138,76 @@ public:
      */
     const labelVector& faceNeighbour() const;
 
+    /**
+     * @brief Get the mesh points on the host.
+     *
+     * The host accessors serve the host side algorithms, eg. the decomposition, renumbering,
+     * graph construction and coloring of the mesh. The device data stays authoritative, the host
+     * copies are created on the first access and reused afterwards as long as the mesh is
+     * unchanged, the geometric copies are refreshed after updateGeometry. On host executors the
+     * mirrors alias the data of the mesh, see HostMirror. The returned mirror is valid as long as
+     * the mesh, copies of the mesh hold their own mirrors.
+     *
+     * @return The host mirror of the mesh points.
+     */
+    const HostMirror<Vec3>& hostPoints() const;
+
+    /**
+     * @brief Get the cell volumes on the host, see hostPoints.
+     *
+     * @return The host mirror of the cell volumes.
+     */
+    const HostMirror<scalar>& hostCellVolumes() const;
+
+    /**
+     * @brief Get the cell centres on the host, see hostPoints.
+     *
+     * @return The host mirror of the cell centres.
+     */
+    const HostMirror<Vec3>& hostCellCentres() const;
+
+    /**
+     * @brief Get the face centres on the host, see hostPoints.
+     *
+     * @return The host mirror of the face centres.
+     */
+    const HostMirror<Vec3>& hostFaceCentres() const;
+
+    /**
+     * @brief Get the area face normals on the host, see hostPoints.
+     *
+     * @return The host mirror of the area face normals.
+     */
+    const HostMirror<Vec3>& hostFaceAreas() const;
+
+    /**
+     * @brief Get the magnitudes of the face areas on the host, see hostPoints.
+     *
+     * @return The host mirror of the magnitudes of the face areas.
+     */
+    const HostMirror<scalar>& hostMagFaceAreas() const;
+
+    /**
+     * @brief Get the face owner cells on the host, see hostPoints.
+     *
+     * @return The host mirror of the face owner cells.
+     */
+    const HostMirror<label>& hostFaceOwner() const;
+
+    /**
+     * @brief Get the face neighbour cells on the host, see hostPoints.
+     *
+     * @return The host mirror of the face neighbour cells.
+     */
+    const HostMirror<label>& hostFaceNeighbour() const;
+
+    /**
+     * @brief Get the cells of the boundary faces on the host, see hostPoints.
+     *
+     * @return The host mirror of the boundary face cells.
+     */
+    const HostMirror<label>& hostFaceCells() const;
+
     /**
      * @brief Get the number of cells in the mesh.
      *
@@ -171,6 +257,18 @@ public:
      */
     StencilDataBase& stencilDB() const;
 
+    /**
+     * @brief Adds the footprint of the mesh to a memory report.
+     *
+     * The geometry and connectivity of the internal and boundary faces and the cells are added
+     * to the mesh geometry and mesh connectivity categories, the entries of the stencil data base
+     * to the stencils category unless they report their parts themselves, eg. the linear systems
+     * and solvers stored in it.
+     *
+     * @param report The report to add to.
+     */
+    void reportMemory(MemoryReport& report) const;
+
     /**
      * @brief Get the executor.
      *
@@ -178,8 +276,217 @@ public:
      */
     const Executor& exec() const;
 
+    /**
+     * @brief Get the version of the mesh geometry.
+     *
+     * The version is incremented by every updateGeometry, so that data derived from the geometry,
+     * eg. the weights of the GeometryScheme, can detect whether it is outdated.
+     *
+     * @return The version of the mesh geometry.
+     */
+    std::size_t geometryVersion() const;
+
+    /**
+     * @brief Get the block structure of the mesh.
+     *
+     * Set for the meshes of create3DUniformMesh without random cell order, the face reductions
+     * of the finite volume operators then address the faces of a cell directly.
+     *
+     * @return The extents of the block or nothing for an unstructured mesh.
+     */
+    const std::optional<StructuredBlock>& structured() const;
+
+    /**
+     * @brief Marks the mesh as block structured.
+     *
+     * The cells and faces need to be numbered as described by StructuredBlock.
+     *
+     * @param block The extents of the block.
+     */
+    void setStructured(StructuredBlock block);
+
+    /**
+     * @brief Get the number of ghost cells.
+     *
+     * The ghost cells store the remote cells of a decomposed mesh after the nCells local cells,
+     * see HaloLayout::GhostCells. They are the neighbours of the last internal faces and have a
+     * volume and a centre but no faces of their own, loops over the cells exclude them.
+     *
+     * @return The number of ghost cells, zero for a mesh without ghost cells.
+     */
+    localIdx nGhostCells() const;
+
+    /**
+     * @brief Marks the cells after nCells as ghost cells.
+     *
+     * The cell volumes and centres need to hold the nCells local and the ghost cells.
+     *
+     * @param nGhostCells The number of ghost cells.
+     */
+    void setGhostCells(localIdx nGhostCells);
+
+    /**
+     * @brief Get the active region of the mesh.
+     *
+     * The face reductions of the operators only update the active cells and the assembled
+     * systems freeze the inactive cells, see ActiveRegion.
+     *
+     * @return The active region or nullptr if all cells are active.
+     */
+    const ActiveRegion* activeRegion() const;
+
+    /**
+     * @brief Restricts the operators to an active region.
+     *
+     * The region is shared, hence an update of the region applies to the mesh. The scattering
+     * face reductions are replaced by the gather over the active cells.
+     *
+     * @param region The active region, nullptr marks all cells as active.
+     */
+    void setActiveRegion(std::shared_ptr<const ActiveRegion> region);
+
+    /**
+     * @brief Whether the mesh has been moved, see updateMotion.
+     *
+     * @return True after the first updateMotion.
+     */
+    bool moving() const;
+
+    /**
+     * @brief Get the cell volumes before the last motion.
+     *
+     * For a static mesh these are the cell volumes.
+     *
+     * @return The field of old cell volumes.
+     */
+    const scalarVector& oldCellVolumes() const;
+
+    /**
+     * @brief Get the volume swept by the faces during the last motion divided by its time step.
+     *
+     * The flux is positive if a face moves out of its owner, the convective flux relative to the
+     * mesh is the absolute flux minus meshPhi. Only available for a moving mesh.
+     *
+     * @return The field of mesh fluxes of all faces.
+     */
+    const scalarVector& meshPhi() const;
+
+    /**
+     * @brief Replaces the geometry of the mesh after mesh motion.
+     *
+     * The topology is unchanged, hence all fields need to keep their size.
+     *
+     * @param points The field of moved mesh points.
+     * @param cellVolumes The field of cell volumes in the mesh.
+     * @param cellCentres The field of cell centres in the mesh.
+     * @param faceAreas The field of area face normals.
+     * @param faceCentres The field of face centres.
+     * @param magFaceAreas The field of magnitudes of face areas.
+     */
+    void updateGeometry(
+        vectorVector points,
+        scalarVector cellVolumes,
+        vectorVector cellCentres,
+        vectorVector faceAreas,
+        vectorVector faceCentres,
+        scalarVector magFaceAreas
+    );
+
+    /**
+     * @brief Replaces the geometry of the mesh and of its boundary faces after mesh motion.
+     *
+     * @param points The field of moved mesh points.
+     * @param cellVolumes The field of cell volumes in the mesh.
+     * @param cellCentres The field of cell centres in the mesh.
+     * @param faceAreas The field of area face normals.
+     * @param faceCentres The field of face centres.
+     * @param magFaceAreas The field of magnitudes of face areas.
+     * @param boundaryMesh The boundary mesh of the moved mesh, its faces need to agree.
+     */
+    void updateGeometry(
+        vectorVector points,
+        scalarVector cellVolumes,
+        vectorVector cellCentres,
+        vectorVector faceAreas,
+        vectorVector faceCentres,
+        scalarVector magFaceAreas,
+        const BoundaryMesh& boundaryMesh
+    );
+
+    /**
+     * @brief Records the motion of the mesh, called after the geometry has been updated.
+     *
+     * @param oldCellVolumes The cell volumes before the motion.
+     * @param meshPhi The volume swept by every face divided by the time step.
+     */
+    void updateMotion(scalarVector oldCellVolumes, scalarVector meshPhi);
+
 private:
 
+    /**
+     * @brief The lazily synchronized host copies of the mesh, see hostPoints.
+     *
+     * A copy starts without host data, so that the mirrors of a copy never refer to the vectors
+     * of the original mesh.
+     */
+    struct HostMirrors
+    {
+        HostMirrors() = default;
+
+        HostMirrors(const HostMirrors&) {}
+
+        HostMirrors& operator=(const HostMirrors&)
+        {
+            invalidate();
+            return *this;
+        }
+
+        /**
+         * @brief Forces the next access of every mirror to copy.
+         */
+        void invalidate()
+        {
+            invalidateGeometry();
+            faceOwner.invalidate();
+            faceNeighbour.invalidate();
+            faceCells.invalidate();
+        }
+
+        /**
+         * @brief Forces the next access of the geometric mirrors to copy.
+         */
+        void invalidateGeometry()
+        {
+            points.invalidate();
+            cellVolumes.invalidate();
+            cellCentres.invalidate();
+            faceCentres.invalidate();
+            faceAreas.invalidate();
+            magFaceAreas.invalidate();
+        }
+
+        HostMirror<Vec3> points;
+        HostMirror<scalar> cellVolumes;
+        HostMirror<Vec3> cellCentres;
+        HostMirror<Vec3> faceCentres;
+        HostMirror<Vec3> faceAreas;
+        HostMirror<scalar> magFaceAreas;
+        HostMirror<label> faceOwner;
+        HostMirror<label> faceNeighbour;
+        HostMirror<label> faceCells;
+        std::size_t geometryVersion {0}; // the geometry version of the geometric mirrors
+    };
+
+    /**
+     * @brief Computes the inverse cell volumes from the cell volumes.
+     */
+    void computeInvCellVolumes();
+
+    /**
+     * @brief Gets the host mirrors, the geometric mirrors are outdated after updateGeometry.
+     */
+    HostMirrors& hostMirrors() const;
+
     /**
      * @brief Executor
      *
@@ -197,6 +504,11 @@ private:
      */
     scalarVector cellVolumes_;
 
+    /**
+     * @brief Vector of inverse cell volumes in the mesh.
+     */
+    scalarVector invCellVolumes_;
+
     /**
      * @brief Vector of cell centres in the mesh.
      */
@@ -269,6 +581,46 @@ private:
      * The stencil data base is used to register stencils.
      */
     mutable StencilDataBase stencilDataBase_;
+
+    /**
+     * @brief Version of the mesh geometry.
+     */
+    std::size_t geometryVersion_;
+
+    /**
+     * @brief Host copies of the mesh, synchronized on access.
+     */
+    mutable HostMirrors hostMirrors_;
+
+    /**
+     * @brief Number of ghost cells after the local cells.
+     */
+    localIdx nGhostCells_;
+
+    /**
+     * @brief Block structure of the mesh, if any.
+     */
+    std::optional<StructuredBlock> structured_;
+
+    /**
+     * @brief Active region of the mesh, if any.
+     */
+    std::shared_ptr<const ActiveRegion> activeRegion_;
+
+    /**
+     * @brief Whether the mesh has been moved.
+     */
+    bool moving_;
+
+    /**
+     * @brief Vector of cell volumes before the last motion, empty for a static mesh.
+     */
+    scalarVector oldCellVolumes_;
+
+    /**
+     * @brief Vector of mesh fluxes of the last motion, empty for a static mesh.
+     */
+    scalarVector meshPhi_;
 };
 
 /** @brief creates a mesh containing only a single cell
@@ -288,5 +640,27 @@ UnstructuredMesh createSingleCellMesh(const Executor exec);
  */
 UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells);
 
+/** @brief A factory function for a 3D uniform hexahedral mesh of the unit cube
+ *
+ * The mesh consists of nx * ny * nz cells with six faces each and is created in parallel on the
+ * executor. Without renumbering cell (i, j, k) has the index i + nx * (j + ny * k) and the mesh
+ * is marked as structured, see StructuredBlock. The internal faces are ordered by owner and
+ * neighbour and the owner index is below the neighbour index. The six boundaries are in the
+ * order left, right, bottom, top, front and back, ie. the faces at x = 0, x = 1, y = 0, y = 1,
+ * z = 0 and z = 1.
+ *
+ * @param randomCellOrder Randomly permute the cells to mimic the ordering of an unstructured
+ * mesh, the internal faces are sorted by owner and neighbour afterwards.
+ * @param seed The seed of the random permutation.
+ */
+UnstructuredMesh create3DUniformMesh(
+    const Executor exec,
+    const localIdx nx,
+    const localIdx ny,
+    const localIdx nz,
+    const bool randomCellOrder = false,
+    const uint64_t seed = 5489
+);
+
 
 } // namespace NeoN
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief selects the time step size from the courant number and a local error estimate
+ *
+ * The courant number limit follows the damped update of OpenFOAM, the step grows by at most
+ * maxGrowth per step and shrinks immediately if the courant number exceeds maxCo. If an error
+ * estimate is given the step is additionally limited by the standard controller
+ * safety * err^(-1 / (order + 1)), where err is the weighted norm of the local error, which is
+ * below one for an accepted step.
+ *
+ * The settings are read from the dictionary, all keys are optional:
+ *  - maxCo: the maximum courant number (default 1)
+ *  - maxDeltaT: the maximum time step size (default unlimited)
+ *  - minDeltaT: the minimum time step size (default 0)
+ *  - maxGrowth: the maximum growth factor of the step size per step (default 1.2)
+ *  - minShrink: the minimum factor of the error controller per step (default 0.2)
+ *  - safety: the safety factor of the error controller (default 0.9)
+ */
+class AdaptiveTimeStep
+{
+public:
+
+    explicit AdaptiveTimeStep(const Dictionary& dict);
+
+    /* @brief returns the step size limited by the courant number of the last step
+     *
+     * @param dt, the size of the last time step
+     * @param coNum, the maximum courant number of the last time step
+     */
+    scalar next(scalar dt, scalar coNum) const;
+
+    /* @brief returns the step size limited by the courant number and the error estimate
+     *
+     * @param dt, the size of the last time step
+     * @param coNum, the maximum courant number of the last time step
+     * @param errorNorm, the weighted norm of the local error estimate of the last step
+     * @param order, the order of the error estimate
+     */
+    scalar next(scalar dt, scalar coNum, scalar errorNorm, int order) const;
+
+    /* @brief returns the step size limited by the courant number of the face flux
+     *
+     * The maximum courant number is computed with a single reduction, see computeCourantNumber.
+     */
+    scalar next(const finiteVolume::cellCentred::SurfaceField<scalar>& faceFlux, scalar dt) const;
+
+    scalar maxCo() const { return maxCo_; }
+
+    scalar maxGrowth() const { return maxGrowth_; }
+
+private:
+
+    scalar limit(scalar dt) const;
+
+    scalar maxCo_;
+    scalar maxDeltaT_;
+    scalar minDeltaT_;
+    scalar maxGrowth_;
+    scalar minShrink_;
+    scalar safety_;
+};
+
+} // namespace NeoN::timeIntegration
@@ -4,18 +4,30 @@
 
 #pragma once
 
+#include <memory>
+
 #include "NeoN/core/database/fieldCollection.hpp"
 #include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/database/solverStatsCollection.hpp"
 #include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/initialGuess.hpp"
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 #include "NeoN/dsl/solver.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
 
 
 namespace NeoN::timeIntegration
 {
 
+/* @class BackwardEuler
+ * @brief first order implicit time integration
+ *
+ * Equations whose implicit operators are ddt operators and implicit sources only are solved
+ * pointwise, see FusedExpression::solveDiagonal, without a linear system and a linear solver.
+ * Otherwise the linear system is taken from the stencil database of the mesh.
+ */
 template<typename SolutionVectorType>
 class BackwardEuler :
     public TimeIntegratorBase<SolutionVectorType>::template Register<
@@ -29,7 +41,7 @@ public:
         BackwardEuler<SolutionVectorType>>;
 
     BackwardEuler(const Dictionary& schemeDict, const Dictionary& solutionDict)
-        : Base(schemeDict, solutionDict)
+        : Base(schemeDict, solutionDict), initialGuess_(solutionDict)
     {}
 
     static std::string name() { return "backwardEuler"; }
@@ -42,26 +54,57 @@ public:
         dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
     ) override
     {
+        // the assembly shares the entries of the mesh with concurrent solves, see
+        // StencilDataBase::lock, the owned linear system is solved unlocked
+        auto lock = solutionVector.mesh().stencilDB().lock();
         auto source = eqn.explicitOperation(solutionVector.size());
-        auto sparsity = la::SparsityPattern(solutionVector.mesh());
-        auto ls = la::createEmptyLinearSystem<ValueType, localIdx>(solutionVector.mesh(), sparsity);
+        NeoN::finiteVolume::cellCentred::FusedExpression<ValueType> fused(eqn);
+        if (fused.implicitDiagonal() && !solutionVector.mesh().activeRegion())
+        {
+            // only ddt operators and implicit sources, the system is solved pointwise, which
+            // would also update the inactive cells
+            fused.solveDiagonal(solutionVector.internalVector(), dt);
+            la::recordSolverStats(solutionVector, {0, 0.0, 0.0, 0.0, {0.0, 0.0, 0.0, 0.0}});
+            completeStep(eqn.exec());
+            return;
+        }
+        // the structure of the linear system is allocated once per equation, only the values are
+        // reset
+        auto& ls = la::readOrCreateLinearSystem<ValueType, localIdx>(
+            solutionVector.mesh(), solutionVector.name
+        );
 
-        eqn.implicitOperation(ls);        // add spatial operators
-        eqn.implicitOperation(ls, t, dt); // add temporal operators
+        // add spatial and temporal operators
+        fused.assemble(ls, t, dt);
 
-        auto solver = NeoN::la::Solver(solutionVector.exec(), this->solutionDict_);
-        solver.solve(ls, solutionVector.internalVector());
-        // check if executor is GPU
-        if (std::holds_alternative<NeoN::GPUExecutor>(eqn.exec()))
+        if (!solver_)
         {
-            Kokkos::fence();
+            // the integrator is recreated by dsl::solve, hence the solver is taken from the
+            // cache of the mesh
+            solver_ = la::solverCache(solutionVector.mesh())
+                          .get(solutionVector.name, solutionVector.exec(), this->solutionDict_);
         }
+        la::freezeInactiveRows(ls, solutionVector.mesh(), solutionVector.internalVector());
+        initialGuess_.apply(ls, solutionVector);
+        lock.unlock();
+        auto stats = solver_->solve(ls, solutionVector.internalVector());
+        lock.lock();
+        la::recordSolverStats(solutionVector, stats);
+        completeStep(eqn.exec());
     };
 
     std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
     {
         return std::make_unique<BackwardEuler>(*this);
     }
+
+private:
+
+    InitialGuess<SolutionVectorType> initialGuess_;
+
+    // NOTE the solver is shared between copies since not all solvers support cloning,
+    // the solvers detect a change of the linear system and regenerate if required
+    std::shared_ptr<la::Solver> solver_ {nullptr}; //! persistent linear solver
 };
 
 
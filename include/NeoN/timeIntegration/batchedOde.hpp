@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <variant>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/batchedSolver.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief the settings of BatchedStiffOde
+ *
+ * The settings are read from the dictionary, all keys are optional:
+ *  - relTol: the relative tolerance of the local error (default 1e-6)
+ *  - absTol: the absolute tolerance of the local error (default 1e-10)
+ *  - maxSubSteps: the maximum number of sub steps per system and step (default 10000)
+ *  - maxGrowth: the maximum growth factor of the sub step size (default 5)
+ *  - minShrink: the minimum factor of the sub step size (default 0.2)
+ *  - safety: the safety factor of the error controller (default 0.9)
+ *  - pivotTol: the relative pivot tolerance of the factorisation, see factorizeDenseLU
+ *    (default 1e-14)
+ */
+struct BatchedOdeSettings
+{
+    BatchedOdeSettings() = default;
+
+    explicit BatchedOdeSettings(const Dictionary& dict);
+
+    scalar relTol {1e-6};
+    scalar absTol {1e-10};
+    localIdx maxSubSteps {10000};
+    scalar maxGrowth {5.0};
+    scalar minShrink {0.2};
+    scalar safety {0.9};
+    scalar pivotTol {1e-14};
+};
+
+/* @brief the work of a call of BatchedStiffOde::integrate */
+struct BatchedOdeStatistics
+{
+    localIdx nFailed {0};     // the systems which did not reach the end of the step
+    localIdx nSubSteps {0};   // the sub steps, including rejected ones, of all systems
+    localIdx maxSubSteps {0}; // the largest number of sub steps of a system
+};
+
+namespace detail
+{
+
+/* @brief the second order L-stable Rosenbrock method ROS2 of Verwer et al. on a single system
+ *
+ * One step solves
+ *     (I - gamma h J) k1 = f(y)
+ *     (I - gamma h J) k2 = f(y + h k1) - 2 k1
+ *     y = y + 3/2 h k1 + 1/2 h k2
+ * with gamma = 1 + 1 / sqrt(2), hence a single factorisation per step. The embedded linearly
+ * implicit Euler step y + h k1 gives the local error estimate h / 2 (k1 + k2).
+ *
+ * @return the number of sub steps, negative if the end of the step was not reached
+ */
+template<localIdx MaxSize, typename System>
+KOKKOS_INLINE_FUNCTION localIdx integrateRosenbrock(
+    const System& system,
+    const localIdx sysi,
+    const localIdx n,
+    scalar* y,
+    const scalar t,
+    const scalar dt,
+    scalar& h,
+    const BatchedOdeSettings& settings
+)
+{
+    constexpr scalar gamma = scalar(1.0 + 0.70710678118654752440);
+    scalar f[MaxSize];
+    scalar yStage[MaxSize];
+    scalar jac[MaxSize * MaxSize];
+    scalar m[MaxSize * MaxSize];
+    localIdx perm[MaxSize];
+    scalar k1[MaxSize];
+    scalar k2[MaxSize];
+
+    scalar elapsed = 0.0;
+    h = (h > 0.0 && h < dt) ? h : dt;
+    bool evaluate = true;
+    for (localIdx step = 0; step < settings.maxSubSteps; step++)
+    {
+        // the rhs and the jacobian only change with an accepted step
+        if (evaluate)
+        {
+            system.rhs(sysi, t + elapsed, y, f);
+            system.jacobian(sysi, t + elapsed, y, jac);
+            evaluate = false;
+        }
+        const bool last = h >= dt - elapsed;
+        const scalar hStep = last ? dt - elapsed : h;
+
+        for (localIdx i = 0; i < n * n; i++)
+        {
+            m[i] = -gamma * hStep * jac[i];
+        }
+        for (localIdx i = 0; i < n; i++)
+        {
+            m[i * n + i] += 1.0;
+        }
+        if (!la::factorizeDenseLU(n, m, perm, settings.pivotTol))
+        {
+            h = settings.minShrink * hStep;
+            continue;
+        }
+
+        for (localIdx i = 0; i < n; i++)
+        {
+            k1[i] = f[i];
+        }
+        la::solveDenseLU(n, m, perm, k1);
+        for (localIdx i = 0; i < n; i++)
+        {
+            yStage[i] = y[i] + hStep * k1[i];
+        }
+        system.rhs(sysi, t + elapsed + hStep, yStage, k2);
+        for (localIdx i = 0; i < n; i++)
+        {
+            k2[i] -= 2.0 * k1[i];
+        }
+        la::solveDenseLU(n, m, perm, k2);
+
+        // weighted root mean square norm of the local error, k1 holds the new state afterwards
+        scalar errSum = 0.0;
+        for (localIdx i = 0; i < n; i++)
+        {
+            const scalar yNew = y[i] + hStep * (1.5 * k1[i] + 0.5 * k2[i]);
+            const scalar err = 0.5 * hStep * (k1[i] + k2[i]);
+            const scalar yMax = Kokkos::max(Kokkos::abs(y[i]), Kokkos::abs(yNew));
+            const scalar weighted = err / (settings.absTol + settings.relTol * yMax);
+            errSum += weighted * weighted;
+            k1[i] = yNew;
+        }
+        scalar errNorm = Kokkos::sqrt(errSum / static_cast<scalar>(n));
+        // a non finite error rejects the step and shrinks it as far as allowed
+        errNorm = errNorm < 1e10 ? errNorm : scalar(1e10);
+
+        const scalar factor = settings.safety / Kokkos::sqrt(Kokkos::max(errNorm, ROOTVSMALL));
+        if (errNorm <= 1.0)
+        {
+            for (localIdx i = 0; i < n; i++)
+            {
+                y[i] = k1[i];
+            }
+            const scalar proposal =
+                hStep * Kokkos::min(settings.maxGrowth, Kokkos::max(settings.minShrink, factor));
+            if (last)
+            {
+                // a step truncated to the end keeps the proposal of the previous step
+                h = h > hStep ? h : proposal;
+                return step + 1;
+            }
+            h = proposal;
+            elapsed += hStep;
+            evaluate = true;
+        }
+        else
+        {
+            h = hStep * Kokkos::max(settings.minShrink, Kokkos::min(factor, scalar(1.0)));
+        }
+    }
+    return -settings.maxSubSteps;
+}
+
+}
+
+/* @class BatchedStiffOde
+ * @brief integrates a small stiff ODE system in every cell, ie. a batch of independent systems
+ *
+ * The systems are integrated over a step with adaptive sub steps of their own, as required for
+ * cell local chemistry, by a linearly implicit Rosenbrock method of second order, see
+ * detail::integrateRosenbrock. Every system is integrated by a single thread of one kernel, its
+ * state, right hand side, jacobian and factorisation are held in the local memory of the thread,
+ * hence the size of the systems is limited by the MaxSize template argument of integrate. The
+ * linear systems are solved with the dense LU factorisation of the batched solver.
+ *
+ * The sub step size of every system is kept as the initial sub step of the next step. On GPUs
+ * the systems are processed in the order of their number of sub steps in the last step, thus
+ * the threads of a warp integrate systems of similar cost.
+ *
+ * The system is a functor copied to the device with the members
+ *     void rhs(localIdx sysi, scalar t, const scalar* y, scalar* dydt) const
+ *     void jacobian(localIdx sysi, scalar t, const scalar* y, scalar* jac) const
+ * where jac is the row major jacobian df_i / dy_j. The method assumes an autonomous system, a
+ * dependency on t is evaluated at the stage times only.
+ */
+class BatchedStiffOde
+{
+public:
+
+    /* @brief creates the integrator of nSystems systems with size unknowns each
+     *
+     * @param exec, the executor of the states
+     * @param nSystems, the number of systems, eg. the number of cells
+     * @param size, the number of unknowns of every system
+     * @param dict, the settings, see BatchedOdeSettings
+     */
+    BatchedStiffOde(const Executor& exec, localIdx nSystems, localIdx size, const Dictionary& dict);
+
+    const Executor& exec() const { return subStepSizes_.exec(); }
+
+    localIdx nSystems() const { return subStepSizes_.size(); }
+
+    localIdx size() const { return size_; }
+
+    const BatchedOdeSettings& settings() const { return settings_; }
+
+    /* @brief the proposed initial sub step size of every system, zero before the first step */
+    const Vector<scalar>& subStepSizes() const { return subStepSizes_; }
+
+    /* @brief the number of sub steps of every system in the last step */
+    const Vector<localIdx>& nSubSteps() const { return nSubSteps_; }
+
+    /* @brief integrates all systems from t to t + dt
+     *
+     * @tparam MaxSize, the upper bound of the size of the systems, it sizes the local memory
+     * @param system, the right hand side and the jacobian of the systems
+     * @param y, the states, the unknown j of system i is stored at i * size + j, overwritten by
+     * the state at t + dt
+     * @param t, the time at the start of the step
+     * @param dt, the step size
+     * @return the work of the step, systems which fail keep the state they reached
+     */
+    template<localIdx MaxSize, typename System>
+    BatchedOdeStatistics integrate(const System& system, Vector<scalar>& y, scalar t, scalar dt)
+    {
+        NF_ASSERT(size_ <= MaxSize, "The systems are larger than MaxSize " << MaxSize);
+        NF_ASSERT_EQUAL(y.size(), nSystems() * size_);
+        NF_ASSERT(y.exec() == exec(), "Executors are not the same");
+        NF_ASSERT(dt > 0.0, "The step size has to be positive.");
+
+        const auto n = size_;
+        const auto settings = settings_;
+        auto [states, subDt, nSteps, order] = views(y, subStepSizes_, nSubSteps_, order_);
+        BatchedOdeStatistics stats;
+        parallelReduce(
+            exec(),
+            {0, nSystems()},
+            KOKKOS_LAMBDA(
+                const localIdx k, localIdx& failed, localIdx& total, localIdx& maxSteps
+            ) {
+                const localIdx sysi = order[k];
+                const localIdx steps = detail::integrateRosenbrock<MaxSize>(
+                    system, sysi, n, &states[sysi * n], t, dt, subDt[sysi], settings
+                );
+                const localIdx work = steps < 0 ? -steps : steps;
+                nSteps[sysi] = work;
+                failed += steps < 0 ? 1 : 0;
+                total += work;
+                maxSteps = work > maxSteps ? work : maxSteps;
+            },
+            Kokkos::Sum<localIdx>(stats.nFailed),
+            Kokkos::Sum<localIdx>(stats.nSubSteps),
+            Kokkos::Max<localIdx>(stats.maxSubSteps),
+            "BatchedStiffOde"
+        );
+        if (std::holds_alternative<GPUExecutor>(exec()))
+        {
+            orderByWork();
+        }
+        return stats;
+    }
+
+private:
+
+    /* @brief sorts the systems by their number of sub steps in the last step */
+    void orderByWork();
+
+    localIdx size_;
+
+    BatchedOdeSettings settings_;
+
+    Vector<scalar> subStepSizes_;
+
+    Vector<localIdx> nSubSteps_;
+
+    Vector<localIdx> order_; // the systems in the order of processing
+};
+
+} // namespace NeoN::timeIntegration
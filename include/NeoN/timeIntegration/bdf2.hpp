@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/database/solverStatsCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/initialGuess.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+#include "NeoN/dsl/solver.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief second order backward differentiation formula with a variable time step
+ *
+ * With the ratio w = dt / dtOld of the current and the previous time step the temporal operators
+ * are discretised as
+ *     ((1 + 2w) / (1 + w) u^{n+1} - (1 + w) u^n + w^2 / (1 + w) u^{n-1}) / dt
+ *   = (u^{n+1} - u^n) / (dt (1 + w) / (1 + 2w)) - w^2 / (1 + w) (u^n - u^{n-1}) / dt
+ * hence the temporal operators are assembled with a time step of dt (1 + w) / (1 + 2w) and the
+ * second old time level only adds a correction to the rhs, for a constant time step these are
+ * 2/3 dt and (u^n - u^{n-1}) / (2 dt). The two old time levels are taken from the old time
+ * collection, u^{n-1} is the old time field of u^n and has to be advanced with rotateOldTimes.
+ * The previous time step is stored in the field document of the solution after every step.
+ * Without the second old time level or the previous time step, ie. on the first step, a backward
+ * Euler step of size dt is taken and the second old time level is registered.
+ *
+ * The linear system of the equation is taken from the stencil database of the mesh, hence its
+ * structure is allocated once and only the values are reassembled every step.
+ */
+template<typename SolutionVectorType>
+class BDF2 :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<BDF2<SolutionVectorType>>
+{
+
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base =
+        TimeIntegratorBase<SolutionVectorType>::template Register<BDF2<SolutionVectorType>>;
+
+    BDF2(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict), initialGuess_(solutionDict)
+    {}
+
+    static std::string name() { return "BDF2"; }
+
+    static std::string doc() { return "second order backward differentiation formula"; }
+
+    static std::string schema() { return "none"; }
+
+    void solve(
+        dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
+    ) override
+    {
+        const auto& mesh = solutionVector.mesh();
+        // the assembly shares the entries of the mesh with concurrent solves, see
+        // StencilDataBase::lock, the owned linear system is solved unlocked
+        auto lock = mesh.stencilDB().lock();
+        auto& ls = la::readOrCreateLinearSystem<ValueType, localIdx>(mesh, solutionVector.name);
+        NeoN::finiteVolume::cellCentred::FusedExpression<ValueType> fused(eqn);
+        auto& fieldCollection = NeoN::finiteVolume::cellCentred::VectorCollection::instance(
+            solutionVector
+        );
+        auto& fieldDoc = fieldCollection.fieldDoc(solutionVector.key).doc();
+        auto& oldVector = NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        const bool history =
+            NeoN::finiteVolume::cellCentred::OldTimeCollection::instance(fieldCollection)
+                    .findNextTime(oldVector.key)
+                != ""
+            && fieldDoc.contains("deltaT");
+        // registers the second old time level, so that it is advanced by rotateOldTimes
+        auto& oldOldVector = NeoN::finiteVolume::cellCentred::oldTime(oldVector);
+
+        if (history)
+        {
+            const auto w = dt / fieldDoc.get<scalar>("deltaT");
+            // the temporal operators are assembled first, so that the diagonal only holds their
+            // coefficients when the correction of the second old time level is added
+            fused.implicitOperation(ls, t, dt * (1 + w) / (1 + 2 * w));
+            addOldOldCorrection(
+                ls,
+                la::SparsityPattern::readOrCreate(mesh),
+                oldVector.internalVector(),
+                oldOldVector.internalVector(),
+                w * w / (1 + 2 * w)
+            );
+        }
+        else
+        {
+            fused.implicitOperation(ls, t, dt);
+        }
+        fused.implicitOperation(ls); // add spatial operators
+
+        if (!solver_)
+        {
+            solver_ = la::solverCache(mesh).get(
+                solutionVector.name, solutionVector.exec(), this->solutionDict_
+            );
+        }
+        la::freezeInactiveRows(ls, mesh, solutionVector.internalVector());
+        initialGuess_.apply(ls, solutionVector);
+        lock.unlock();
+        auto stats = solver_->solve(ls, solutionVector.internalVector());
+        lock.lock();
+        la::recordSolverStats(solutionVector, stats);
+        fieldDoc.insert("deltaT", dt);
+        completeStep(eqn.exec());
+    };
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
+    {
+        return std::make_unique<BDF2>(*this);
+    }
+
+    bool multistep() const override { return true; }
+
+private:
+
+    /* @brief adds the weighted difference u^n - u^{n-1} times the temporal coefficient to the rhs
+     *
+     * @param weight, w^2 / (1 + 2w) with the ratio w of the current and the previous time step
+     */
+    void addOldOldCorrection(
+        la::LinearSystem<ValueType, localIdx>& ls,
+        const la::SparsityPattern& sparsity,
+        const Vector<ValueType>& oldVector,
+        const Vector<ValueType>& oldOldVector,
+        scalar weight
+    )
+    {
+        auto [matrix, rhs] = ls.view();
+        const auto [diagOffs, uOld, uOldOld] =
+            views(sparsity.diagOffset(), oldVector, oldOldVector);
+        parallelFor(
+            ls.exec(),
+            {0, rhs.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const auto diag = matrix.values[matrix.rowOffs[celli] + diagOffs[celli]];
+                rhs[celli] += weight * cmptMultiply(diag, uOld[celli] - uOldOld[celli]);
+            },
+            "BDF2::addOldOldCorrection"
+        );
+    }
+
+    InitialGuess<SolutionVectorType> initialGuess_;
+
+    // NOTE the solver is shared between copies since not all solvers support cloning,
+    // the solvers detect a change of the linear system and regenerate if required
+    std::shared_ptr<la::Solver> solver_ {nullptr}; //! persistent linear solver
+};
+
+
+} // namespace NeoN
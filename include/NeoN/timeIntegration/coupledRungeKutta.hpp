@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/dsl/expression.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/**
+ * @class CoupledRungeKutta
+ * @brief Integrates a system of PDE expressions, one per field, in a single explicit Runge-Kutta
+ * solve of the ERKStep module of Sundials.
+ * @tparam SolutionVectorType The Solution field type, should be a volume field.
+ *
+ * @details
+ * The internal vectors of all fields are concatenated into one N_Vector, hence all equations
+ * share the stages, the context and the vector operations of Sundials. A single rhs callback
+ * first copies the stage values of all fields into the fields and then evaluates all
+ * expressions, thus an expression may depend on the fields of the other equations, eg. for
+ * reacting species. The executor is synchronised once per rhs evaluation.
+ *
+ * The operators of an expression have to be built on the fields of the system, only explicit
+ * spatial operators are evaluated. The scheme dictionary selects the method by the optional
+ * Runge-Kutta-Method key, see sundials::stringToERKTable, by default the fourth order method of
+ * ERKStep is used.
+ *
+ * @warning The fields are not registered with the time integration factory, the system is solved
+ * by calling solve directly. The ERKStep memory is created again if the sizes of the fields
+ * change.
+ */
+template<typename SolutionVectorType>
+class CoupledRungeKutta
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+
+    /**
+     * @brief The state shared with the rhs callback of ERKStep during a solve.
+     */
+    struct UserData
+    {
+        std::vector<dsl::Expression<ValueType>*> expressions; /**< One expression per field. */
+        std::vector<SolutionVectorType*> solutions; /**< The fields the operators are built on. */
+        std::vector<localIdx> offsets; /**< The offset of each field in the N_Vector. */
+        std::vector<Vector<ValueType>> sources; /**< The explicit source of each equation. */
+    };
+
+    /**
+     * @brief Constructor that initializes the solver with a dictionary configuration.
+     * @param schemeDict The dictionary of the time integration scheme.
+     */
+    CoupledRungeKutta(const Dictionary& schemeDict) : schemeDict_(schemeDict) {}
+
+    CoupledRungeKutta(const CoupledRungeKutta& other) = delete;
+
+    CoupledRungeKutta& operator=(const CoupledRungeKutta& other) = delete;
+
+    /**
+     * @brief Solves one time step of the system, from n to n+1
+     * @param exps The expressions, one per field
+     * @param solutions The fields containing the solution at time t, which are overwritten by
+     * the solution at t + dt
+     * @param t The current time
+     * @param dt The time step size
+     */
+    void solve(
+        const std::vector<dsl::Expression<ValueType>*>& exps,
+        const std::vector<SolutionVectorType*>& solutions,
+        scalar t,
+        const scalar dt
+    );
+
+private:
+
+    /**
+     * @brief Creates the context, the concatenated state vector and the ERKStep memory.
+     * @param t The current time
+     */
+    void initERKStep(const scalar t);
+
+    Dictionary schemeDict_; /**< The dictionary of the time integration scheme. */
+    std::shared_ptr<SUNContext> context_ {
+        nullptr, sundials::SUN_CONTEXT_DELETER
+    }; /**< The SUNContext for the solve. */
+    NeoN::sundials::NVector state_; /**< The concatenated solution, owns its memory. */
+    std::unique_ptr<UserData> data_ {
+        std::make_unique<UserData>()
+    }; /**< The user data of the rhs, its address is kept by ERKStep. */
+    std::unique_ptr<char, decltype(sundials::SUN_ARK_DELETER)> ODEMemory_ {
+        nullptr, sundials::SUN_ARK_DELETER
+    }; /**< The ERKStep memory. */
+};
+
+} // namespace NeoN
+
+#endif
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/database/solverStatsCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/initialGuess.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+#include "NeoN/dsl/solver.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief the theta method, Crank-Nicolson for the default theta of 0.5
+ *
+ * For the spatial operators A u = b the time step is discretised as
+ *     (u^{n+1} - u^n) / dt + theta (A u^{n+1} - b) + (1 - theta) (A u^n - b) = 0
+ * which after division by theta becomes
+ *     (u^{n+1} - u^n) / (theta dt) + A u^{n+1} = (1 + w) b - w A u^n, w = (1 - theta) / theta
+ * Hence the spatial operators are assembled once, the rhs is updated with a single kernel from
+ * the assembled matrix and the old time field, and the temporal operators are assembled with a
+ * time step of theta dt. The old time field is taken from the old time collection. A theta of
+ * one recovers backward Euler.
+ *
+ * The value of theta is read from the theta key of the scheme dictionary. The linear system is
+ * taken from the stencil database of the mesh, hence its structure is allocated once and only
+ * the values are reassembled every step.
+ */
+template<typename SolutionVectorType>
+class CrankNicolson :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        CrankNicolson<SolutionVectorType>>
+{
+
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        CrankNicolson<SolutionVectorType>>;
+
+    CrankNicolson(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict),
+          theta_(schemeDict.contains("theta") ? schemeDict.get<scalar>("theta") : scalar(0.5)),
+          initialGuess_(solutionDict)
+    {
+        NF_ASSERT(
+            theta_ > 0.0 && theta_ <= 1.0,
+            "The theta of CrankNicolson has to be in (0, 1], got " << theta_
+        );
+    }
+
+    static std::string name() { return "CrankNicolson"; }
+
+    static std::string doc() { return "second order implicit theta method"; }
+
+    static std::string schema() { return "none"; }
+
+    void solve(
+        dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
+    ) override
+    {
+        const auto& mesh = solutionVector.mesh();
+        auto& ls = la::readOrCreateLinearSystem<ValueType, localIdx>(mesh);
+        NeoN::finiteVolume::cellCentred::FusedExpression<ValueType> fused(eqn);
+
+        // the spatial operators are assembled first, so that the matrix only holds A when the
+        // explicit part is added to the rhs
+        fused.implicitOperation(ls);
+        if (theta_ < 1.0)
+        {
+            auto& oldVector = NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+            addExplicitPart(ls, oldVector.internalVector());
+        }
+        fused.implicitOperation(ls, t, theta_ * dt); // add temporal operators
+
+        if (!solver_)
+        {
+            solver_ = la::solverCache(mesh).get(
+                solutionVector.name, solutionVector.exec(), this->solutionDict_
+            );
+        }
+        la::freezeInactiveRows(ls, mesh, solutionVector.internalVector());
+        initialGuess_.apply(ls, solutionVector);
+        auto stats = solver_->solve(ls, solutionVector.internalVector());
+        la::recordSolverStats(solutionVector, stats);
+        completeStep(eqn.exec());
+    };
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
+    {
+        return std::make_unique<CrankNicolson>(*this);
+    }
+
+private:
+
+    /* @brief replaces the rhs b by (1 + w) b - w A u^n */
+    void addExplicitPart(la::LinearSystem<ValueType, localIdx>& ls, const Vector<ValueType>& old)
+    {
+        const scalar w = (scalar(1.0) - theta_) / theta_;
+        auto [matrix, rhs] = ls.view();
+        const auto uOld = old.view();
+        parallelFor(
+            ls.exec(),
+            {0, uOld.size()},
+            KOKKOS_LAMBDA(const localIdx rowi) {
+                ValueType Au = zero<ValueType>();
+                for (auto j = matrix.rowOffs[rowi]; j < matrix.rowOffs[rowi + 1]; j++)
+                {
+                    Au += cmptMultiply(matrix.values[j], uOld[matrix.colIdxs[j]]);
+                }
+                rhs[rowi] = (scalar(1.0) + w) * rhs[rowi] - w * Au;
+            },
+            "CrankNicolson::addExplicitPart"
+        );
+    }
+
+    scalar theta_;
+
+    InitialGuess<SolutionVectorType> initialGuess_;
+
+    // NOTE the solver is shared between copies since not all solvers support cloning,
+    // the solvers detect a change of the linear system and regenerate if required
+    std::shared_ptr<la::Solver> solver_ {nullptr}; //! persistent linear solver
+};
+
+
+} // namespace NeoN
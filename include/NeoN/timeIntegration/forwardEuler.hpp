@@ -4,14 +4,168 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+
 #include "NeoN/core/database/fieldCollection.hpp"
 #include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/executor/kernelGraph.hpp"
 #include "NeoN/fields/field.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 
 namespace NeoN::timeIntegration
 {
 
+/* @brief the captured kernels of the forward Euler steps of a solution field
+ *
+ * The step is kept in the stencil database of the mesh, since the integrators are recreated by
+ * every dsl::solve. A copy of the expression is held, which shares the fields of the operators,
+ * thus the captured step never refers to the expression passed to a solve. The kernels are
+ * recaptured once the solution vectors, the time step, the operators or the mesh geometry
+ * change, see KernelGraph. The operators are compared by their name, type and coefficient,
+ * since every solve reads the operators and thus clones the concrete operators shared with the
+ * held copy. The replayed kernels read the values of the fields and of a field coefficient,
+ * hence these may change in place, while a scheme changed in fvSchemes is not detected.
+ */
+template<typename SolutionVectorType>
+class CapturedEulerStep
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+
+    /* @brief the captured step of a solution field, created on the first call */
+    static CapturedEulerStep& readOrCreate(SolutionVectorType& solutionVector)
+    {
+        auto& db = solutionVector.mesh().stencilDB();
+        const auto key = "CapturedEulerStep::" + solutionVector.name;
+        if (!db.contains(key))
+        {
+            db.insert(key, std::make_shared<CapturedEulerStep>(solutionVector.exec()));
+        }
+        return *db.template get<std::shared_ptr<CapturedEulerStep>>(key);
+    }
+
+    /* @brief the captured step of a solution field or nullptr if it was never captured */
+    static const CapturedEulerStep* find(const SolutionVectorType& solutionVector)
+    {
+        const auto& db = solutionVector.mesh().stencilDB();
+        const auto key = "CapturedEulerStep::" + solutionVector.name;
+        return db.contains(key) ? db.template get<std::shared_ptr<CapturedEulerStep>>(key).get()
+                                : nullptr;
+    }
+
+    explicit CapturedEulerStep(const Executor& exec) : graph_(exec), source_(exec, 0) {}
+
+    /* @brief replays the captured step or captures it if its arguments changed */
+    void advance(
+        const dsl::Expression<ValueType>& eqn,
+        SolutionVectorType& solutionVector,
+        SolutionVectorType& oldSolutionVector,
+        scalar dt
+    )
+    {
+        const auto geometryVersion = solutionVector.mesh().geometryVersion();
+        if (graph_.captured() && solution_ == &solutionVector
+            && solutionData_ == solutionVector.internalVector().data()
+            && oldData_ == oldSolutionVector.internalVector().data() && dt_ == dt
+            && sameOperators(eqn) && geometryVersion_ == geometryVersion)
+        {
+            graph_.replay();
+            replays_++;
+            return;
+        }
+
+        graph_.reset();
+        eqn_ = std::make_shared<dsl::Expression<ValueType>>(eqn);
+        source_ =
+            Vector<ValueType>(solutionVector.exec(), solutionVector.size(), zero<ValueType>());
+        // the first evaluation fills the caches, eg. the stencils and the memory pool, such that
+        // the captured kernels do not allocate or synchronize
+        const NeoN::finiteVolume::cellCentred::FusedExpression warmup(*eqn_);
+        warmup.explicitOperation(source_);
+
+        solution_ = &solutionVector;
+        solutionData_ = solutionVector.internalVector().data();
+        oldData_ = oldSolutionVector.internalVector().data();
+        dt_ = dt;
+        geometryVersion_ = geometryVersion;
+        replays_ = 0;
+
+        // the views are captured by value, the vectors are owned by the database and this step
+        auto [solutionV, oldV, sourceV] = views(
+            solutionVector.internalVector(), oldSolutionVector.internalVector(), source_
+        );
+        graph_.capture(
+            [expression = eqn_.get(), source = &source_, solution = solution_, solutionV, oldV,
+             sourceV, dt]()
+            {
+                fill(*source, zero<ValueType>());
+                const NeoN::finiteVolume::cellCentred::FusedExpression fused(*expression);
+                fused.explicitOperation(*source);
+                parallelFor(
+                    solution->exec(),
+                    {0, solutionV.size()},
+                    KOKKOS_LAMBDA(const localIdx celli) {
+                        solutionV[celli] = oldV[celli] - sourceV[celli] * dt;
+                    },
+                    "ForwardEuler::capturedStep"
+                );
+                solution->correctBoundaryConditions();
+            }
+        );
+    }
+
+    /* @brief the number of replays since the last capture */
+    std::size_t replays() const { return replays_; }
+
+    bool captured() const { return graph_.captured(); }
+
+    std::size_t memoryBytes() const { return source_.memoryBytes(); }
+
+private:
+
+    /* @brief whether the operators of the expression agree with the captured expression */
+    bool sameOperators(const dsl::Expression<ValueType>& eqn) const
+    {
+        const auto same = [](const auto& lhs, const auto& rhs)
+        {
+            return std::equal(
+                lhs.begin(),
+                lhs.end(),
+                rhs.begin(),
+                rhs.end(),
+                [](const auto& a, const auto& b)
+                {
+                    return a.getName() == b.getName() && a.getType() == b.getType()
+                        && a.getCoefficient() == b.getCoefficient();
+                }
+            );
+        };
+        return eqn_ && same(eqn.temporalOperators(), eqn_->temporalOperators())
+            && same(eqn.spatialOperators(), eqn_->spatialOperators());
+    }
+
+    KernelGraph graph_;
+
+    std::shared_ptr<dsl::Expression<ValueType>> eqn_ {nullptr};
+
+    Vector<ValueType> source_;
+
+    SolutionVectorType* solution_ {nullptr};
+
+    const ValueType* solutionData_ {nullptr};
+
+    const ValueType* oldData_ {nullptr};
+
+    scalar dt_ {0.0};
+
+    std::size_t geometryVersion_ {0};
+
+    std::size_t replays_ {0};
+};
+
 template<typename SolutionVectorType>
 class ForwardEuler :
     public TimeIntegratorBase<SolutionVectorType>::template Register<
@@ -25,7 +179,8 @@ public:
         TimeIntegratorBase<SolutionVectorType>::template Register<ForwardEuler<SolutionVectorType>>;
 
     ForwardEuler(const Dictionary& schemeDict, const Dictionary& solutionDict)
-        : Base(schemeDict, solutionDict)
+        : Base(schemeDict, solutionDict),
+          captureGraph_(schemeDict.contains("captureGraph") && schemeDict.get<bool>("captureGraph"))
     {}
 
     static std::string name() { return "forwardEuler"; }
@@ -41,24 +196,71 @@ public:
         scalar dt
     ) override
     {
-        auto source = eqn.explicitOperation(solutionVector.size());
-        SolutionVectorType& oldSolutionVector =
-            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
-
-        solutionVector.internalVector() = oldSolutionVector.internalVector() - source * dt;
-        solutionVector.correctBoundaryConditions();
-
-        // check if executor is GPU
-        if (std::holds_alternative<NeoN::GPUExecutor>(eqn.exec()))
+        // the explicit step shares the entries of the mesh with concurrent solves, see
+        // StencilDataBase::lock
+        auto lock = solutionVector.mesh().stencilDB().lock();
+        if (captureGraph_ && !localTimeStep(eqn))
         {
-            Kokkos::fence();
+            // the replayed kernels require fixed vectors, hence the update is not fused, local time
+            // steps are not captured
+            CapturedEulerStep<SolutionVectorType>::readOrCreate(solutionVector)
+                .advance(
+                    eqn,
+                    solutionVector,
+                    NeoN::finiteVolume::cellCentred::oldTime(solutionVector),
+                    dt
+                );
         }
+        else
+        {
+            step(eqn, solutionVector, dt);
+        }
+
+        completeStep(eqn.exec());
     };
 
     std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
     {
         return std::make_unique<ForwardEuler>(*this);
     }
+
+private:
+
+    void step(dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar dt)
+    {
+        const NeoN::finiteVolume::cellCentred::FusedExpression fused(eqn);
+        SolutionVectorType& oldSolutionVector =
+            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        const auto* localDt = localTimeStep(eqn);
+
+        // the update is applied by the face sweep of the fused terms, which may swap the
+        // internal vector of the solution with a workspace
+        fused.explicitEulerUpdate(
+            solutionVector.internalVector(), oldSolutionVector.internalVector(), dt, localDt
+        );
+        solutionVector.correctBoundaryConditions();
+    }
+
+    /* @brief the per cell time step of the ddt operators of the expression or nullptr */
+    static const Vector<scalar>* localTimeStep(const dsl::Expression<ValueType>& eqn)
+    {
+        for (const auto& op : eqn.temporalOperators())
+        {
+            const auto* ddt =
+                op.template as<NeoN::finiteVolume::cellCentred::DdtOperator<ValueType>>();
+            if (ddt && ddt->localTimeStep())
+            {
+                return ddt->localTimeStep();
+            }
+        }
+        return nullptr;
+    }
+
+    /* @brief whether the kernels of a time step are captured once and replayed afterwards
+     *
+     * The captured step is kept in the mesh, see CapturedEulerStep.
+     */
+    bool captureGraph_;
 };
 
 
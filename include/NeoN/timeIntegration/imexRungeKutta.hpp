@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+
+#include <sundials/sundials_linearsolver.h>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/**
+ * @class ImexRungeKutta
+ * @brief Integrates in time, using the ARKStep module of Sundials, a PDE expression with an
+ * additive implicit-explicit Runge-Kutta method.
+ * @tparam SolutionVectorType The Solution field type, should be a volume field.
+ *
+ * @details
+ * The implicit spatial operators of the expression, eg. a laplacian, are integrated by the
+ * diagonally implicit tableau, the explicit spatial operators, eg. a divergence, by the explicit
+ * tableau. The time step is thus not limited by the implicit operators, while the explicit
+ * operators do not require a linear solve.
+ *
+ * The implicit operators are assembled into the linear system of the equation, see
+ * la::readOrCreateLinearSystem, and have to be linear in the solution. The Newton systems
+ * (I - gamma J) x = b of ARKStep are solved as (V + gamma A) x = V b by the linear solver of the
+ * solution dictionary, where A is the assembled matrix, V the cell volumes and gamma the current
+ * scaling of ARKStep. The linear solver is attached as matrix embedded SUNLinearSolver, hence
+ * Sundials never sees the matrix.
+ *
+ * The stages are evaluated by copying the stage values into the solution field, thus the
+ * operators of the expression have to be built on the solution field. The temporal operators of
+ * the expression are ignored.
+ *
+ * The scheme dictionary selects the method by the IMEX-Method key, one of ARK-2, ARK-3 (default),
+ * ARK-4 and ARK-5, see sundials::stringToARKTables.
+ *
+ * @warning The Sundials context is shared between copies, see RungeKutta. The ARKStep memory is
+ * not copied, a copy creates it again on its first solve.
+ */
+template<typename SolutionVectorType>
+class ImexRungeKutta :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        ImexRungeKutta<SolutionVectorType>>
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        ImexRungeKutta<SolutionVectorType>>;
+
+    /**
+     * @brief The state shared with the callbacks of ARKStep during a solve.
+     */
+    struct UserData
+    {
+        dsl::Expression<ValueType>* expression {nullptr}; /**< The expression being integrated. */
+        SolutionVectorType* solution {nullptr}; /**< The field the operators are built on. */
+        std::shared_ptr<la::Solver> solver {nullptr}; /**< Solves the Newton systems. */
+        void* arkMemory {nullptr}; /**< The ARKStep memory, provides the current gamma. */
+    };
+
+    /**
+     * @brief Constructor that initializes the solver with a dictionary configuration.
+     * @param schemeDict The dictionary of the time integration scheme.
+     * @param solutionDict The dictionary of the linear solver of the implicit stages.
+     */
+    ImexRungeKutta(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict)
+    {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     * @note Only the configuration and the context are copied.
+     */
+    ImexRungeKutta(const ImexRungeKutta& other) : Base(other), context_(other.context_) {}
+
+    ImexRungeKutta(ImexRungeKutta&& other) = default;
+
+    // deleted because base class method deleted.
+    ImexRungeKutta& operator=(const ImexRungeKutta& other) = delete;
+
+    // deleted because base class method deleted.
+    ImexRungeKutta& operator=(ImexRungeKutta&& other) = delete;
+
+    /**
+     * @brief Returns the name of the class.
+     * @return std::string("IMEX-Runge-Kutta").
+     */
+    static std::string name() { return "IMEX-Runge-Kutta"; }
+
+    /**
+     * @brief Returns the documentation for the class.
+     * @return std::string containing class documentation.
+     */
+    static std::string doc()
+    {
+        return "Implicit-explicit time integration using additive Runge-Kutta methods.";
+    }
+
+    /**
+     * @brief Returns the schema for the class.
+     * @return std::string containing the schema definition.
+     */
+    static std::string schema() { return "none"; }
+
+    /**
+     * @brief Solves one time step, from n to n+1
+     * @param exp The expression to be solved
+     * @param solutionVector The field containing the solution at time t, which is overwritten
+     * by the solution at t + dt.
+     * @param t The current time
+     * @param dt The time step size
+     */
+    void solve(
+        dsl::Expression<ValueType>& exp,
+        SolutionVectorType& solutionVector,
+        scalar t,
+        const scalar dt
+    ) override;
+
+    /**
+     * @brief Return a copy of this instantiated class.
+     * @return std::unique_ptr to the new copy.
+     */
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override;
+
+private:
+
+    /**
+     * @brief Creates the context, the state vector, the ARKStep memory and the linear solver.
+     * @param solutionVector The solution field
+     * @param t The current time
+     */
+    void initARKStep(SolutionVectorType& solutionVector, const scalar t);
+
+    std::shared_ptr<SUNContext> context_ {
+        nullptr, sundials::SUN_CONTEXT_DELETER
+    }; /**< The SUNContext for the solve. */
+    NeoN::sundials::NVector state_; /**< The solution of ARKStep, owns its memory. */
+    std::unique_ptr<_generic_SUNLinearSolver, void (*)(SUNLinearSolver)> linearSolver_ {
+        nullptr, nullptr
+    }; /**< Solves the Newton systems of the implicit stages. */
+    std::unique_ptr<UserData> data_ {
+        std::make_unique<UserData>()
+    }; /**< The user data of the callbacks, its address is kept by ARKStep. */
+    // declared last, thus freed before the linear solver and the user data it references
+    std::unique_ptr<char, decltype(sundials::SUN_ARK_DELETER)> ODEMemory_ {
+        nullptr, sundials::SUN_ARK_DELETER
+    }; /**< The ARKStep memory. */
+};
+
+} // namespace NeoN
+
+#endif
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief the initial guesses of the linear solve of an implicit time step */
+enum class InitialGuessMode
+{
+    Previous,      /**< The current values, ie. the solution of the previous step. */
+    Extrapolation, /**< The linear extrapolation 2 u^n - u^{n-1} of the old time levels. */
+    Projection     /**< The combination of the old time levels with the smallest residual. */
+};
+
+namespace detail
+{
+
+/* @brief the inner product of two values, summed over the components */
+KOKKOS_INLINE_FUNCTION
+scalar innerProduct(const scalar& lhs, const scalar& rhs) { return lhs * rhs; }
+
+KOKKOS_INLINE_FUNCTION
+scalar innerProduct(const Vec3& lhs, const Vec3& rhs) { return lhs & rhs; }
+
+}
+
+/* @class InitialGuess
+ * @brief replaces the values of the solution by an initial guess computed from its old time
+ * levels before the linear solve
+ *
+ * In smooth transients the solution of the previous time step is a poor initial guess compared
+ * to an extrapolation of the old time levels, which saves a considerable part of the Krylov
+ * iterations. The old time levels are taken from the old time collection, hence levels which are
+ * not used by the time integration are registered on the first step, where they are initialised
+ * with the current values. The strategy is read from the solution dictionary:
+ *  - initialGuess: previous to keep the current values, extrapolate for 2 u^n - u^{n-1}, or
+ *    projection for the linear combination of the old time levels u^n, u^{n-1}, ... which
+ *    minimises the residual norm of the assembled system (default previous)
+ *  - initialGuessLevels: the number of old time levels of the projection (default 2)
+ *
+ * The projection requires one product with the matrix per level and generalises the
+ * extrapolation, which is one of the combinations of two levels. Linearly dependent levels, eg.
+ * the levels initialised on the first step, are dropped from the projection.
+ */
+template<typename SolutionVectorType>
+class InitialGuess
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+
+    InitialGuess(const Dictionary& solutionDict)
+        : mode_(readMode(solutionDict)),
+          nLevels_(
+              solutionDict.contains("initialGuessLevels")
+                  ? solutionDict.get<int>("initialGuessLevels")
+                  : 2
+          )
+    {
+        NF_ASSERT(nLevels_ > 0, "initialGuessLevels needs to be larger than zero");
+    }
+
+    InitialGuessMode mode() const { return mode_; }
+
+    /* @brief overwrites the internal values of the solution with the initial guess
+     *
+     * @param ls, the assembled linear system of the time step, used by the projection
+     * @param solution, the solution whose old time levels are the old time fields
+     */
+    void apply(const la::LinearSystem<ValueType, localIdx>& ls, SolutionVectorType& solution)
+    {
+        if (mode_ == InitialGuessMode::Previous)
+        {
+            return;
+        }
+        auto& oldVector = finiteVolume::cellCentred::oldTime(solution);
+        if (mode_ == InitialGuessMode::Extrapolation)
+        {
+            auto& oldOldVector = finiteVolume::cellCentred::oldTime(oldVector);
+            extrapolate(
+                oldVector.internalVector(), oldOldVector.internalVector(), solution.internalVector()
+            );
+            return;
+        }
+
+        std::vector<const Vector<ValueType>*> levels {&oldVector.internalVector()};
+        auto* level = &oldVector;
+        for (int leveli = 1; leveli < nLevels_; leveli++)
+        {
+            level = &finiteVolume::cellCentred::oldTime(*level);
+            levels.push_back(&level->internalVector());
+        }
+        project(ls, levels, solution.internalVector());
+    }
+
+private:
+
+    static InitialGuessMode readMode(const Dictionary& dict)
+    {
+        const auto mode =
+            dict.contains("initialGuess") ? dict.get<std::string>("initialGuess") : "previous";
+        if (mode == "extrapolate")
+        {
+            return InitialGuessMode::Extrapolation;
+        }
+        if (mode == "projection")
+        {
+            return InitialGuessMode::Projection;
+        }
+        if (mode != "previous")
+        {
+            NF_ERROR_EXIT(
+                "Unknown initialGuess " + mode + ", expected previous, extrapolate or projection."
+            );
+        }
+        return InitialGuessMode::Previous;
+    }
+
+    /* @brief computes x = 2 u^n - u^{n-1} */
+    void extrapolate(
+        const Vector<ValueType>& oldVector,
+        const Vector<ValueType>& oldOldVector,
+        Vector<ValueType>& x
+    )
+    {
+        auto xView = x.view();
+        const auto [uOld, uOldOld] = views(oldVector, oldOldVector);
+        parallelFor(
+            x.exec(),
+            {0, x.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                xView[celli] = scalar(2.0) * uOld[celli] - uOldOld[celli];
+            },
+            "InitialGuess::extrapolate"
+        );
+    }
+
+    /* @brief computes the products A u of the level with the assembled matrix */
+    void multiply(
+        const la::LinearSystem<ValueType, localIdx>& ls,
+        const Vector<ValueType>& level,
+        Vector<ValueType>& product
+    )
+    {
+        const auto matrix = ls.matrix().view();
+        const auto u = level.view();
+        auto Au = product.view();
+        parallelFor(
+            ls.exec(),
+            {0, u.size()},
+            KOKKOS_LAMBDA(const localIdx rowi) {
+                ValueType sum = zero<ValueType>();
+                for (auto j = matrix.rowOffs[rowi]; j < matrix.rowOffs[rowi + 1]; j++)
+                {
+                    sum += cmptMultiply(matrix.values[j], u[matrix.colIdxs[j]]);
+                }
+                Au[rowi] = sum;
+            },
+            "InitialGuess::multiply"
+        );
+    }
+
+    scalar dot(const Vector<ValueType>& lhs, const Vector<ValueType>& rhs)
+    {
+        const auto [a, b] = views(lhs, rhs);
+        scalar result = 0.0;
+        parallelReduce(
+            lhs.exec(),
+            {0, lhs.size()},
+            KOKKOS_LAMBDA(const localIdx i, scalar& sum) {
+                sum += detail::innerProduct(a[i], b[i]);
+            },
+            result,
+            "InitialGuess::dot"
+        );
+        return result;
+    }
+
+    /* @brief computes x = sum_k c_k u_k with the coefficients c minimising |b - A x|
+     *
+     * The normal equations (A u_i, A u_j) c_j = (A u_i, b) are solved by a Cholesky
+     * factorisation, which drops the levels whose product is linearly dependent on the products
+     * of the previous levels.
+     */
+    void project(
+        const la::LinearSystem<ValueType, localIdx>& ls,
+        const std::vector<const Vector<ValueType>*>& levels,
+        Vector<ValueType>& x
+    )
+    {
+        const auto nLevels = levels.size();
+        std::vector<Vector<ValueType>> products;
+        for (const auto* level : levels)
+        {
+            products.emplace_back(x.exec(), x.size());
+            multiply(ls, *level, products.back());
+        }
+
+        // the Cholesky factor of the normal equations and the rhs (A u_i, b)
+        std::vector<std::vector<scalar>> chol(nLevels, std::vector<scalar>(nLevels, 0.0));
+        std::vector<scalar> coeffs(nLevels, 0.0);
+        std::vector<bool> used(nLevels, false);
+        for (std::size_t i = 0; i < nLevels; i++)
+        {
+            coeffs[i] = dot(products[i], ls.rhs());
+            const scalar norm = dot(products[i], products[i]);
+            for (std::size_t j = 0; j <= i; j++)
+            {
+                scalar sum = j == i ? norm : dot(products[i], products[j]);
+                for (std::size_t k = 0; k < j; k++)
+                {
+                    sum -= chol[i][k] * chol[j][k];
+                }
+                if (j < i)
+                {
+                    chol[i][j] = used[j] ? sum / chol[j][j] : 0.0;
+                }
+                else if (sum > 1e-12 * norm)
+                {
+                    chol[i][i] = std::sqrt(sum);
+                    used[i] = true;
+                }
+            }
+        }
+
+        // forward and backward substitution, the dropped levels get a zero coefficient
+        for (std::size_t i = 0; i < nLevels; i++)
+        {
+            for (std::size_t k = 0; k < i; k++)
+            {
+                coeffs[i] -= chol[i][k] * coeffs[k];
+            }
+            coeffs[i] = used[i] ? coeffs[i] / chol[i][i] : 0.0;
+        }
+        for (std::size_t i = nLevels; i-- > 0;)
+        {
+            for (std::size_t k = i + 1; k < nLevels; k++)
+            {
+                coeffs[i] -= chol[k][i] * coeffs[k];
+            }
+            coeffs[i] = used[i] ? coeffs[i] / chol[i][i] : 0.0;
+        }
+
+        fill(x, zero<ValueType>());
+        for (std::size_t i = 0; i < nLevels; i++)
+        {
+            auto xView = x.view();
+            const auto u = levels[i]->view();
+            const auto c = coeffs[i];
+            parallelFor(
+                x.exec(),
+                {0, x.size()},
+                KOKKOS_LAMBDA(const localIdx celli) { xView[celli] += c * u[celli]; },
+                "InitialGuess::project"
+            );
+        }
+    }
+
+    InitialGuessMode mode_;
+    int nLevels_;
+};
+
+}
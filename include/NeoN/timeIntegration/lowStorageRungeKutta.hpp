@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief the coefficients of a low storage Runge-Kutta method
+ *
+ * Methods of the Williamson 2N form use a and b, each stage updates
+ *     du = a_i du + dt F(u)
+ *     u = u + b_i du
+ * Methods of the Ketcheson 2S* form use gamma1, gamma2 and beta, each stage updates
+ *     u = gamma1_i u + gamma2_i u^n + beta_i dt F(u)
+ * where F = -source is the explicit right hand side. Since u^n is the old time field, 2S*
+ * methods only require a single additional register.
+ */
+struct LowStorageTableau
+{
+    enum class Form
+    {
+        Williamson2N,
+        Ketcheson2SStar
+    };
+
+    Form form;
+    std::vector<scalar> a;
+    std::vector<scalar> b;
+    std::vector<scalar> gamma1;
+    std::vector<scalar> gamma2;
+    std::vector<scalar> beta;
+
+    localIdx nStages() const
+    {
+        return static_cast<localIdx>(form == Form::Williamson2N ? b.size() : beta.size());
+    }
+};
+
+/* @brief returns the tableau of a low storage method
+ *
+ * Supported methods are Williamson-RK3, the three stage third order method of Williamson,
+ * Carpenter-Kennedy-RK4, the five stage fourth order method of Carpenter and Kennedy, and SSP-RK3,
+ * the strong stability preserving three stage third order method of Shu and Osher.
+ */
+LowStorageTableau lowStorageTableau(const std::string& method);
+
+/* @brief explicit Runge-Kutta methods requiring two registers per solution vector
+ *
+ * The stages are evaluated by writing the stage value to the solution field, thus the explicit
+ * operators of the expression have to be defined on the solution field. Besides the solution and
+ * its old time field a single workspace vector is kept, into which the explicit operators
+ * accumulate their source. The update of the registers of a stage is a single kernel.
+ *
+ * The method is selected with the Runge-Kutta-Method key of the scheme dictionary, see
+ * lowStorageTableau, the default is Williamson-RK3.
+ */
+template<typename SolutionVectorType>
+class LowStorageRungeKutta :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        LowStorageRungeKutta<SolutionVectorType>>
+{
+
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        LowStorageRungeKutta<SolutionVectorType>>;
+
+    LowStorageRungeKutta(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict),
+          tableau_(lowStorageTableau(
+              schemeDict.contains("Runge-Kutta-Method")
+                  ? schemeDict.get<std::string>("Runge-Kutta-Method")
+                  : std::string("Williamson-RK3")
+          ))
+    {}
+
+    LowStorageRungeKutta(const LowStorageRungeKutta& other)
+        : Base(other), tableau_(other.tableau_), register_(nullptr)
+    {}
+
+    static std::string name() { return "lowStorageRungeKutta"; }
+
+    static std::string doc() { return "explicit low storage Runge-Kutta methods"; }
+
+    static std::string schema() { return "none"; }
+
+    void solve(
+        dsl::Expression<ValueType>& eqn,
+        SolutionVectorType& solutionVector,
+        [[maybe_unused]] scalar t,
+        scalar dt
+    ) override
+    {
+        NF_ASSERT(dt != 0.0, "Low storage Runge-Kutta methods require a non zero time step.");
+        SolutionVectorType& oldSolutionVector =
+            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        auto& u = solutionVector.internalVector();
+        if (!register_)
+        {
+            register_ = std::make_unique<Vector<ValueType>>(u.exec(), u.size());
+        }
+        register_->resize(u.size());
+        fill(*register_, zero<ValueType>());
+        u = oldSolutionVector.internalVector();
+        solutionVector.correctBoundaryConditions();
+
+        const NeoN::finiteVolume::cellCentred::FusedExpression fusedEqn(eqn);
+        for (localIdx stage = 0; stage < tableau_.nStages(); stage++)
+        {
+            fusedEqn.explicitOperation(*register_); // accumulate the source of the stage
+            if (tableau_.form == LowStorageTableau::Form::Williamson2N)
+            {
+                williamsonUpdate(u, stage, dt);
+            }
+            else
+            {
+                ketchesonUpdate(u, oldSolutionVector.internalVector(), stage, dt);
+            }
+            solutionVector.correctBoundaryConditions();
+        }
+
+        completeStep(eqn.exec());
+    };
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
+    {
+        return std::make_unique<LowStorageRungeKutta>(*this);
+    }
+
+private:
+
+    /* @brief updates u and du of a 2N stage
+     *
+     * On entry the register holds -a_i / dt du plus the source of the stage, ie. -du_i / dt. The
+     * register is left holding -a_{i+1} / dt du_i, so that the source of the next stage can be
+     * accumulated on top of it.
+     */
+    void williamsonUpdate(Vector<ValueType>& u, localIdx stage, scalar dt)
+    {
+        const auto i = static_cast<std::size_t>(stage);
+        const scalar b = tableau_.b[i];
+        const scalar next =
+            stage + 1 < tableau_.nStages() ? -tableau_.a[i + 1] / dt : scalar(0.0);
+        const auto [uView, duView] = views(u, *register_);
+        parallelFor(
+            u.exec(),
+            u.range(),
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const ValueType du = -dt * duView[celli];
+                uView[celli] = uView[celli] + b * du;
+                duView[celli] = next * du;
+            },
+            "lowStorageRungeKutta::williamsonUpdate"
+        );
+    }
+
+    /* @brief updates u of a 2S* stage and clears the source register for the next stage */
+    void ketchesonUpdate(
+        Vector<ValueType>& u, const Vector<ValueType>& uOld, localIdx stage, scalar dt
+    )
+    {
+        const auto i = static_cast<std::size_t>(stage);
+        const scalar gamma1 = tableau_.gamma1[i];
+        const scalar gamma2 = tableau_.gamma2[i];
+        const scalar betaDt = tableau_.beta[i] * dt;
+        const auto [uView, uOldView, sourceView] = views(u, uOld, *register_);
+        parallelFor(
+            u.exec(),
+            u.range(),
+            KOKKOS_LAMBDA(const localIdx celli) {
+                uView[celli] = gamma1 * uView[celli] + gamma2 * uOldView[celli]
+                             - betaDt * sourceView[celli];
+                sourceView[celli] = zero<ValueType>();
+            },
+            "lowStorageRungeKutta::ketchesonUpdate"
+        );
+    }
+
+    LowStorageTableau tableau_;
+
+    /* @brief the du register of 2N methods or the source register of 2S* methods */
+    std::unique_ptr<Vector<ValueType>> register_ {nullptr};
+};
+
+} // namespace NeoN
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+
+#include <arkode/arkode_mristep.h>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/**
+ * @class MultirateRungeKutta
+ * @brief Integrates in time, using the MRIStep module of Sundials, a PDE expression with a
+ * multirate infinitesimal method, which subcycles the source terms within a slow step.
+ * @tparam SolutionVectorType The Solution field type, should be a volume field.
+ *
+ * @details
+ * The explicit source terms of the expression, see finiteVolume::cellCentred::SourceTerm, form
+ * the fast partition, all other explicit spatial operators, eg. a divergence, the slow partition.
+ * The slow partition is integrated by the explicit coupling of MRIStep with the time step of the
+ * solve, the fast partition by an explicit ARKStep method with fastSubSteps steps per slow step.
+ * Thus stiff reactions are resolved without evaluating the transport at the fast time step.
+ *
+ * The stages are evaluated by copying the stage values into the solution field, thus the
+ * operators of the expression have to be built on the solution field. Implicit spatial
+ * operators are not supported and the temporal operators of the expression are ignored.
+ *
+ * The scheme dictionary provides the optional keys:
+ *  - fastSubSteps, the number of fast steps per slow step (default 10).
+ *  - Runge-Kutta-Method, the explicit method of the fast partition, see
+ *    sundials::stringToERKTable (default the fourth order method of ARKStep).
+ *
+ * @warning The Sundials context is shared between copies, see RungeKutta. The MRIStep memory is
+ * not copied, a copy creates it again on its first solve.
+ */
+template<typename SolutionVectorType>
+class MultirateRungeKutta :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        MultirateRungeKutta<SolutionVectorType>>
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        MultirateRungeKutta<SolutionVectorType>>;
+
+    /**
+     * @brief The state shared with the callbacks of MRIStep and ARKStep during a solve.
+     */
+    struct UserData
+    {
+        std::unique_ptr<dsl::Expression<ValueType>> slow {nullptr}; /**< The slow operators. */
+        std::unique_ptr<dsl::Expression<ValueType>> fast {nullptr}; /**< The source terms. */
+        SolutionVectorType* solution {nullptr}; /**< The field the operators are built on. */
+    };
+
+    /**
+     * @brief Constructor that initializes the solver with a dictionary configuration.
+     * @param schemeDict The dictionary of the time integration scheme.
+     * @param solutionDict The dictionary of the solution, not used.
+     */
+    MultirateRungeKutta(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict)
+    {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     * @note Only the configuration and the context are copied.
+     */
+    MultirateRungeKutta(const MultirateRungeKutta& other) : Base(other), context_(other.context_)
+    {}
+
+    MultirateRungeKutta(MultirateRungeKutta&& other) = default;
+
+    // deleted because base class method deleted.
+    MultirateRungeKutta& operator=(const MultirateRungeKutta& other) = delete;
+
+    // deleted because base class method deleted.
+    MultirateRungeKutta& operator=(MultirateRungeKutta&& other) = delete;
+
+    /**
+     * @brief Returns the name of the class.
+     * @return std::string("Multirate-Runge-Kutta").
+     */
+    static std::string name() { return "Multirate-Runge-Kutta"; }
+
+    /**
+     * @brief Returns the documentation for the class.
+     * @return std::string containing class documentation.
+     */
+    static std::string doc()
+    {
+        return "Multirate time integration subcycling the source terms in a slow explicit step.";
+    }
+
+    /**
+     * @brief Returns the schema for the class.
+     * @return std::string containing the schema definition.
+     */
+    static std::string schema() { return "none"; }
+
+    /**
+     * @brief Solves one slow time step, from n to n+1
+     * @param exp The expression to be solved
+     * @param solutionVector The field containing the solution at time t, which is overwritten
+     * by the solution at t + dt.
+     * @param t The current time
+     * @param dt The slow time step size
+     */
+    void solve(
+        dsl::Expression<ValueType>& exp,
+        SolutionVectorType& solutionVector,
+        scalar t,
+        const scalar dt
+    ) override;
+
+    /**
+     * @brief Return a copy of this instantiated class.
+     * @return std::unique_ptr to the new copy.
+     */
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override;
+
+private:
+
+    /**
+     * @brief Creates the context, the state vector, the fast ARKStep and the MRIStep memory.
+     * @param solutionVector The solution field
+     * @param t The current time
+     */
+    void initMRIStep(SolutionVectorType& solutionVector, const scalar t);
+
+    std::shared_ptr<SUNContext> context_ {
+        nullptr, sundials::SUN_CONTEXT_DELETER
+    }; /**< The SUNContext for the solve. */
+    NeoN::sundials::NVector state_; /**< The solution of MRIStep, owns its memory. */
+    std::unique_ptr<UserData> data_ {
+        std::make_unique<UserData>()
+    }; /**< The user data of the callbacks, its address is kept by MRIStep and ARKStep. */
+    std::unique_ptr<char, decltype(sundials::SUN_ARK_DELETER)> fastMemory_ {
+        nullptr, sundials::SUN_ARK_DELETER
+    }; /**< The ARKStep memory of the fast partition. */
+    std::unique_ptr<_MRIStepInnerStepper, void (*)(MRIStepInnerStepper)> innerStepper_ {
+        nullptr, nullptr
+    }; /**< Couples the fast ARKStep to MRIStep. */
+    // declared last, thus freed before the inner stepper and the fast memory it references
+    std::unique_ptr<char, decltype(sundials::SUN_ARK_DELETER)> ODEMemory_ {
+        nullptr, sundials::SUN_ARK_DELETER
+    }; /**< The MRIStep memory. */
+};
+
+} // namespace NeoN
+
+#endif
@@ -0,0 +1,428 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include <mpi.h>
+
+#include "NeoN/core/mpi/operators.hpp"
+#include "NeoN/mesh/unstructured/communicator.hpp"
+#endif
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief the largest difference of the values of two vectors of the same size
+ *
+ * @param a, the first vector
+ * @param b, the second vector
+ * @return the maximum over all elements of mag(a - b)
+ */
+template<typename ValueType>
+scalar maxDifference(const Vector<ValueType>& a, const Vector<ValueType>& b);
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+/* @brief the communicators of a decomposition in space and time */
+struct SpaceTimeCommunicators
+{
+    MPI_Comm space; // the ranks of a time slice, which decompose the mesh
+    MPI_Comm time;  // the ranks holding the same part of the mesh in the different slices
+};
+
+/* @brief splits the ranks of a communicator into nSlices time slices of consecutive ranks
+ *
+ * Rank r belongs to slice r / (size / nSlices), hence the ranks of a slice are usually on the
+ * same nodes and the halo exchange stays within them. Every slice needs the same decomposition of
+ * the mesh, such that the ranks of a time communicator exchange states of the same cells. The
+ * communicators are freed by the caller with MPI_Comm_free.
+ *
+ * @param comm, the communicator of all ranks, its size needs to be a multiple of nSlices
+ * @param nSlices, the number of time slices
+ * @return the space and time communicators of this rank
+ */
+SpaceTimeCommunicators splitSpaceTime(MPI_Comm comm, int nSlices);
+
+#endif
+
+/* @brief the parallel in time integration of a window by the Parareal method
+ *
+ * The window [t, t + dt] of a solve is split into time slices. A cheap coarse scheme predicts the
+ * states at the slice boundaries sequentially, then every iteration k propagates the states of
+ * all slices with the accurate fine scheme independently and corrects them sequentially by
+ *     U_{n+1}^k = G(U_n^k) + F(U_n^{k-1}) - G(U_n^{k-1})
+ * where G and F are the coarse and fine propagators over slice n. After k iterations the first k
+ * slices agree with the sequential fine solution, hence at most nSlices iterations are done. The
+ * iteration stops once the largest change of a slice boundary state is at most tolerance.
+ *
+ * The propagators are TimeIntegration instances of the coarse and fine scheme dictionaries on
+ * the same expression, they are created for every slice since consecutive propagations do not
+ * continue each other. Every step copies the solution into its old time field before the scheme
+ * is applied, thus the multistep methods, eg. bdf2, are not supported. Only the internal vector
+ * of the solution is propagated, the boundary values are corrected after every change.
+ *
+ * With a timeCommunicator every rank of it integrates one slice, the slices are ordered by rank
+ * and the boundary states are sent between consecutive ranks, see splitSpaceTime. Without it the
+ * nSlices slices are integrated in turn, which gives the same result. After the solve all ranks
+ * hold the state at the end of the window and the old time field holds the state at its start.
+ *
+ * The scheme dictionary understands:
+ *  - fine: the dictionary of the fine scheme, eg. {type lowStorageRungeKutta;} (required)
+ *  - coarse: the dictionary of the coarse scheme (default {type forwardEuler;})
+ *  - fineSteps: the number of fine steps per slice (default 10)
+ *  - coarseSteps: the number of coarse steps per slice (default 1)
+ *  - nSlices: the number of slices without a time communicator (default 1)
+ *  - maxIterations: the maximum number of corrections (default the number of slices)
+ *  - tolerance: the change of the boundary states at which the iteration stops (default 1e-8)
+ *  - timeCommunicator: the MPI_Comm of the slices, see splitSpaceTime (optional)
+ *  - spaceCommunicator: the MPI_Comm of the ranks of a slice for the change of the boundary
+ *    states of a decomposed mesh (optional)
+ */
+template<typename SolutionVectorType>
+class Parareal :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        Parareal<SolutionVectorType>>
+{
+
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base =
+        TimeIntegratorBase<SolutionVectorType>::template Register<Parareal<SolutionVectorType>>;
+
+    Parareal(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict),
+          fineDict_(schemeDict.subDict("fine")),
+          coarseDict_(
+              schemeDict.contains("coarse") ? schemeDict.subDict("coarse")
+                                            : Dictionary {{"type", std::string("forwardEuler")}}
+          ),
+          fineSteps_(option<int>(schemeDict, "fineSteps", 10)),
+          coarseSteps_(option<int>(schemeDict, "coarseSteps", 1)),
+          nSlices_(option<int>(schemeDict, "nSlices", 1)),
+          maxIterations_(option<int>(schemeDict, "maxIterations", 0)),
+          tolerance_(option<scalar>(schemeDict, "tolerance", 1e-8))
+    {
+        for (const auto* dict : {&fineDict_, &coarseDict_})
+        {
+            // the propagators restart in every slice, thus the history of a multistep scheme
+            // would be taken from another slice
+            const auto type = dict->get<std::string>("type");
+            if (type == name()
+                || TimeIntegration<SolutionVectorType>(*dict, solutionDict).multistep())
+            {
+                NF_THROW("Parareal does not support the " + type + " scheme as propagator.");
+            }
+        }
+        NF_ASSERT(fineSteps_ > 0 && coarseSteps_ > 0, "The number of steps needs to be positive.");
+        NF_ASSERT(nSlices_ > 0, "The number of slices needs to be positive.");
+#ifdef NF_WITH_MPI_SUPPORT
+        if (schemeDict.contains("timeCommunicator"))
+        {
+            timeComm_ = schemeDict.get<MPI_Comm>("timeCommunicator");
+            MPI_Comm_size(timeComm_, &nSlices_);
+        }
+        if (schemeDict.contains("spaceCommunicator"))
+        {
+            spaceComm_ = schemeDict.get<MPI_Comm>("spaceCommunicator");
+        }
+#endif
+    }
+
+    static std::string name() { return "parareal"; }
+
+    static std::string doc() { return "parallel in time integration by the Parareal method"; }
+
+    static std::string schema() { return "none"; }
+
+    void solve(
+        dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
+    ) override
+    {
+        const Vector<ValueType> start(solutionVector.internalVector());
+#ifdef NF_WITH_MPI_SUPPORT
+        auto end = timeComm_ != MPI_COMM_NULL ? solveDistributed(eqn, solutionVector, t, dt)
+                                              : solveSlices(eqn, solutionVector, t, dt);
+#else
+        auto end = solveSlices(eqn, solutionVector, t, dt);
+#endif
+        auto& oldSolutionVector = NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        oldSolutionVector.internalVector() = start;
+        oldSolutionVector.correctBoundaryConditions();
+        solutionVector.internalVector() = end;
+        solutionVector.correctBoundaryConditions();
+        completeStep(eqn.exec());
+    };
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
+    {
+        return std::make_unique<Parareal>(*this);
+    }
+
+    /* @brief the number of slices of the window */
+    int nSlices() const { return nSlices_; }
+
+    /* @brief the number of corrections of the last solve */
+    int iterations() const { return iterations_; }
+
+private:
+
+    template<typename T>
+    static T option(const Dictionary& dict, const std::string& key, T defaultValue)
+    {
+        return dict.contains(key) ? dict.get<T>(key) : defaultValue;
+    }
+
+    int maxIterations() const
+    {
+        return maxIterations_ > 0 ? std::min(maxIterations_, nSlices_) : nSlices_;
+    }
+
+    /* @brief advances a state over a slice by nSteps steps of a scheme
+     *
+     * The solution field is the workspace of the propagation, since the operators of the
+     * expression are defined on it.
+     */
+    void propagate(
+        const Dictionary& scheme,
+        int nSteps,
+        dsl::Expression<ValueType>& eqn,
+        SolutionVectorType& solutionVector,
+        Vector<ValueType>& state,
+        scalar t,
+        scalar sliceDt
+    ) const
+    {
+        TimeIntegration<SolutionVectorType> integrator(scheme, this->solutionDict_);
+        auto& oldSolutionVector = NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        solutionVector.internalVector() = state;
+        solutionVector.correctBoundaryConditions();
+        const scalar stepDt = sliceDt / static_cast<scalar>(nSteps);
+        for (int step = 0; step < nSteps; step++)
+        {
+            oldSolutionVector.internalVector() = solutionVector.internalVector();
+            oldSolutionVector.correctBoundaryConditions();
+            integrator.solve(eqn, solutionVector, t + static_cast<scalar>(step) * stepDt, stepDt);
+        }
+        state = solutionVector.internalVector();
+    }
+
+    /* @brief integrates all slices on this rank and returns the state at the end */
+    Vector<ValueType> solveSlices(
+        dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
+    )
+    {
+        const auto n = static_cast<std::size_t>(nSlices_);
+        const scalar sliceDt = dt / static_cast<scalar>(nSlices_);
+        auto sliceStart = [&](std::size_t slicei)
+        { return t + static_cast<scalar>(slicei) * sliceDt; };
+
+        // the coarse prediction of the boundary states, states[i] is the start of slice i
+        std::vector<Vector<ValueType>> states(n + 1, solutionVector.internalVector());
+        std::vector<Vector<ValueType>> coarse;
+        coarse.reserve(n);
+        for (std::size_t slicei = 0; slicei < n; slicei++)
+        {
+            states[slicei + 1] = states[slicei];
+            propagate(
+                coarseDict_,
+                coarseSteps_,
+                eqn,
+                solutionVector,
+                states[slicei + 1],
+                sliceStart(slicei),
+                sliceDt
+            );
+            coarse.push_back(states[slicei + 1]);
+        }
+
+        std::vector<Vector<ValueType>> fine(states.begin(), states.end() - 1);
+        iterations_ = 0;
+        for (int iter = 0; iter < maxIterations(); iter++)
+        {
+            // the slices before iter have converged, the others are independent
+            const auto first = static_cast<std::size_t>(iter);
+            for (std::size_t slicei = first; slicei < n; slicei++)
+            {
+                fine[slicei] = states[slicei];
+                propagate(
+                    fineDict_,
+                    fineSteps_,
+                    eqn,
+                    solutionVector,
+                    fine[slicei],
+                    sliceStart(slicei),
+                    sliceDt
+                );
+            }
+
+            scalar change = 0.0;
+            for (std::size_t slicei = first; slicei < n; slicei++)
+            {
+                Vector<ValueType> predicted(states[slicei]);
+                propagate(
+                    coarseDict_,
+                    coarseSteps_,
+                    eqn,
+                    solutionVector,
+                    predicted,
+                    sliceStart(slicei),
+                    sliceDt
+                );
+                Vector<ValueType> corrected(predicted);
+                corrected += fine[slicei];
+                corrected -= coarse[slicei];
+                change = std::max(change, maxDifference(corrected, states[slicei + 1]));
+                states[slicei + 1] = corrected;
+                coarse[slicei] = predicted;
+            }
+            iterations_++;
+            if (change <= tolerance_)
+            {
+                break;
+            }
+        }
+        return states[n];
+    }
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+    /* @brief integrates the slice of this rank of the time communicator
+     *
+     * The corrections are pipelined, rank n waits for the corrected start of its slice from rank
+     * n - 1 while the fine propagations of all ranks overlap. The end of the window is broadcast
+     * from the last rank.
+     */
+    Vector<ValueType> solveDistributed(
+        dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
+    )
+    {
+        int slicei = 0;
+        MPI_Comm_rank(timeComm_, &slicei);
+        const bool first = slicei == 0;
+        const bool last = slicei + 1 == nSlices_;
+        const scalar sliceDt = dt / static_cast<scalar>(nSlices_);
+        const scalar sliceStart = t + static_cast<scalar>(slicei) * sliceDt;
+
+        Vector<ValueType> start(solutionVector.internalVector());
+        if (!first)
+        {
+            receive(start, slicei - 1);
+        }
+        Vector<ValueType> coarse(start);
+        propagate(coarseDict_, coarseSteps_, eqn, solutionVector, coarse, sliceStart, sliceDt);
+        if (!last)
+        {
+            send(coarse, slicei + 1);
+        }
+
+        Vector<ValueType> end(coarse);
+        iterations_ = 0;
+        for (int iter = 0; iter < maxIterations(); iter++)
+        {
+            Vector<ValueType> fine(start);
+            propagate(fineDict_, fineSteps_, eqn, solutionVector, fine, sliceStart, sliceDt);
+            if (!first)
+            {
+                receive(start, slicei - 1);
+            }
+            Vector<ValueType> predicted(start);
+            propagate(
+                coarseDict_, coarseSteps_, eqn, solutionVector, predicted, sliceStart, sliceDt
+            );
+            Vector<ValueType> corrected(predicted);
+            corrected += fine;
+            corrected -= coarse;
+            if (!last)
+            {
+                send(corrected, slicei + 1);
+            }
+
+            scalar change = maxDifference(corrected, end);
+            if (spaceComm_ != MPI_COMM_NULL)
+            {
+                mpi::allReduce(change, mpi::ReduceOp::Max, spaceComm_);
+            }
+            mpi::allReduce(change, mpi::ReduceOp::Max, timeComm_);
+            end = corrected;
+            coarse = predicted;
+            iterations_++;
+            if (change <= tolerance_)
+            {
+                break;
+            }
+        }
+        broadcast(end, nSlices_ - 1);
+        return end;
+    }
+
+    /* @brief the size of a state in bytes, the values are exchanged as raw memory */
+    static int bytes(const Vector<ValueType>& state)
+    {
+        const auto size = static_cast<std::size_t>(state.size()) * sizeof(ValueType);
+        NF_ASSERT(
+            size <= static_cast<std::size_t>(std::numeric_limits<int>::max()),
+            "The state exceeds the size of an MPI message."
+        );
+        return static_cast<int>(size);
+    }
+
+    void send(const Vector<ValueType>& state, int rank) const
+    {
+        fence(state.exec());
+        const auto buffer = state.copyToExecutor(commBufferExecutor(state.exec()));
+        MPI_Send(buffer.data(), bytes(state), MPI_BYTE, rank, 0, timeComm_);
+    }
+
+    void receive(Vector<ValueType>& state, int rank) const
+    {
+        Vector<ValueType> buffer(commBufferExecutor(state.exec()), state.size());
+        MPI_Recv(buffer.data(), bytes(state), MPI_BYTE, rank, 0, timeComm_, MPI_STATUS_IGNORE);
+        state = buffer.copyToExecutor(state.exec());
+    }
+
+    void broadcast(Vector<ValueType>& state, int root) const
+    {
+        fence(state.exec());
+        auto buffer = state.copyToExecutor(commBufferExecutor(state.exec()));
+        MPI_Bcast(buffer.data(), bytes(state), MPI_BYTE, root, timeComm_);
+        state = buffer.copyToExecutor(state.exec());
+    }
+
+    MPI_Comm timeComm_ {MPI_COMM_NULL};
+
+    MPI_Comm spaceComm_ {MPI_COMM_NULL};
+
+#endif
+
+    Dictionary fineDict_;
+
+    Dictionary coarseDict_;
+
+    int fineSteps_;
+
+    int coarseSteps_;
+
+    int nSlices_;
+
+    int maxIterations_; // zero for the number of slices
+
+    scalar tolerance_;
+
+    int iterations_ {0};
+};
+
+} // namespace NeoN
@@ -27,8 +27,8 @@ namespace NeoN::timeIntegration
  *
  * @details
  * Implements explicit Runge-Kutta time integration using the Sundials library. The class manages
- * Sundials vectors and memory through RAII principles, handling the conversion between internal
- * field representations and Sundials' N_Vector format. Supports various (at present explicit)
+ * Sundials vectors and memory through RAII principles, the N_Vectors operate directly on the
+ * memory of NeoN Vectors, see sundials::wrapVector. Supports various (at present explicit)
  * Runge-Kutta methods which can be specified through the dictionary configuration. The main
  * interface for a solve is through the `solve` function.
  *
@@ -37,19 +37,20 @@ namespace NeoN::timeIntegration
  * interface, this simplifies things considerably as compared to some of the examples:
  * Initialization (and order thereof):
  * https://sundials.readthedocs.io/en/latest/arkode/Usage/Skeleton.html
- * Sundials-Kokkos:
- * https://sundials.readthedocs.io/en/latest/nvectors/NVector_links.html#the-nvector-kokkos-module
+ * Custom N_Vectors:
+ * https://sundials.readthedocs.io/en/latest/nvectors/NVector_API_link.html
  * Sundials Contexts (scroll to bottom eg, they don't like copying):
  * https://sundials.readthedocs.io/en/latest/sundials/SUNContext_link.html#c.SUNContext_Create
  *
  * @warning For developers:
- * 1. This class uses Sundials-Kokkos vectors for computation, which are immediately wrapped as
- *    Sundials N_Vectors. After initialization, only interact with the N_Vector interface as per
- *    Sundials guidelines.
- * 2. The Sundials context is supposed to only be created and freed once in a program, making
- *    copying less desirable, see above. However we need to copy, so the context is placed in a
- *    shared_ptr to prevent early freeing. Please read the documentation about multiple, concurrent
- *    solves (you must not do them). You have been warned.
+ * 1. This class uses N_Vectors on top of NeoN Vectors for computation. The solution N_Vector
+ *    shares the memory of the solution field, the stages and the RHS are N_Vectors cloned by
+ *    Sundials, which own their NeoN Vectors. Only interact with them through the N_Vector
+ *    interface or sundials::vector.
+ * 2. The Sundials context is supposed to only be created and freed once in a program, hence all
+ *    integrators and their copies share the context of sundials::sharedContext. Please read the
+ *    documentation about multiple, concurrent solves (you must not do them). You have been
+ *    warned.
  */
 template<typename SolutionVectorType>
 class RungeKutta :
@@ -82,8 +83,8 @@ public:
     /**
      * @brief Copy constructor.
      * @param other The RungeKutta instance to copy from.
-     * @note Sundials Kokkos vectors have copy constructors, N_Vectors should be constructed from
-     * the Kokkos vectors.
+     * @note The owned initial conditions are copied, the solution is wrapped again on the next
+     * solve.
      */
     RungeKutta(const RungeKutta& other);
 
@@ -140,9 +141,8 @@ public:
 
 private:
 
-    NeoN::sundials::SKVector<ValueType>
-        solution_; /**< Solution vector, contains the sundails N_Vector. */
-    NeoN::sundials::SKVector<ValueType>
+    NeoN::sundials::NVector solution_; /**< Wraps the solution field as sundails N_Vector. */
+    NeoN::sundials::NVector
         initialConditions_; /**< Initial conditions vector, contains the sundails N_Vector. */
     std::shared_ptr<SUNContext> context_ {
         nullptr, sundials::SUN_CONTEXT_DELETER
@@ -152,6 +152,9 @@ private:
     }; /**< The 'memory' sundails for the RK solver. (note void* is not stl compliant). */
     std::unique_ptr<NeoN::dsl::Expression<ValueType>> pdeExpr_ {nullptr
     }; /**< Pointer to the pde system we are integrating in time. */
+    std::unique_ptr<NeoN::sundials::ExplicitRKUserData<SolutionVectorType>> rhsData_ {
+        std::make_unique<NeoN::sundials::ExplicitRKUserData<SolutionVectorType>>()
+    }; /**< The user data of the RHS evaluation. */
 
     /**
      * @brief Initializes the complete Sundials solver setup.
@@ -9,17 +9,18 @@
 #include <concepts>
 #include <functional>
 #include <memory>
+#include <utility>
 
 #include <sundials/sundials_nvector.h>
 #include <sundials/sundials_core.hpp>
-#include <nvector/nvector_serial.h>
-#include <nvector/nvector_kokkos.hpp>
 #include <arkode/arkode_arkstep.h>
 #include <arkode/arkode_erkstep.h>
 
 #include "NeoN/core/error.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/dsl/expression.hpp"
 #include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
 
 namespace NeoN::sundials
 {
@@ -37,6 +38,13 @@ inline auto SUN_CONTEXT_DELETER = [](SUNContext* ctx)
     }
 };
 
+/**
+ * @brief Returns the SUNContext shared by all SUNDIALS objects of the process.
+ * @details The context is created on first use, see BackendRegistry. Solves sharing the
+ * context must not run concurrently.
+ */
+std::shared_ptr<SUNContext> sharedContext();
+
 /**
  * @brief Custom deleter for explicit type RK solvers (ERK, ARK, etc) for the unique pointers.
  * @param ark Pointer to the ark memory to be freed, can be nullptr.
@@ -60,434 +68,221 @@ inline auto SUN_ARK_DELETER = [](char* ark)
 inline ARKODE_ERKTableID stringToERKTable(const std::string& key)
 {
     if (key == "Forward-Euler") return ARKODE_FORWARD_EULER_1_1;
-    if (key == "Heun")
-    {
-        NF_ERROR_EXIT("Currently unsupported until field time step-stage indexing resolved.");
-        return ARKODE_HEUN_EULER_2_1_2;
-    }
-    if (key == "Midpoint")
-    {
-        NF_ERROR_EXIT("Currently unsupported until field time step-stage indexing resolved.");
-        return ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2;
-    }
+    if (key == "Heun") return ARKODE_HEUN_EULER_2_1_2;
+    if (key == "Midpoint") return ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2;
+    if (key == "Bogacki-Shampine") return ARKODE_BOGACKI_SHAMPINE_4_2_3;
+    if (key == "Zonneveld") return ARKODE_ZONNEVELD_5_3_4;
     NF_ERROR_EXIT(
         "Unsupported Runge-Kutta time integration method selectied: " + key + ".\n"
-        + "Supported methods are: Forward-Euler, Heun, Midpoint."
+        + "Supported methods are: Forward-Euler, Heun, Midpoint, Bogacki-Shampine, Zonneveld."
     );
     return ARKODE_ERK_NONE; // avoids compiler warnings.
 }
 
 /**
- * @brief Converts NeoN Vector data to SUNDIALS N_Vector format.
- * @tparam SKVectorType The SUNDIALS Kokkos vector type
- * @tparam ValueType The field data type
- * @param field Source NeoN field
- * @param vector Target SUNDIALS N_Vector
- * @warning Assumes matching initialization and size between field and vector
+ * @brief Maps dictionary keywords to the SUNDIALS tables of additive Runge-Kutta methods.
+ * @param key The name of the implicit-explicit Runge-Kutta method.
+ * @return The implicit (DIRK) and explicit (ERK) Butcher tableau of the method.
+ * @throws Runtime error for unsupported methods.
  */
-template<typename SKVectorType, typename ValueType>
-void fieldToSunNVectorImpl(const NeoN::Vector<ValueType>& field, N_Vector& vector)
+inline std::pair<ARKODE_DIRKTableID, ARKODE_ERKTableID> stringToARKTables(const std::string& key)
 {
-    auto view = ::sundials::kokkos::GetVec<SKVectorType>(vector)->View();
-    auto fieldView = field.view();
-    NeoN::parallelFor(
-        field.exec(), field.range(), KOKKOS_LAMBDA(const localIdx i) { view(i) = fieldView[i]; }
+    if (key == "ARK-2") return {ARKODE_ARK2_DIRK_3_1_2, ARKODE_ARK2_ERK_3_1_2};
+    if (key == "ARK-3") return {ARKODE_ARK324L2SA_DIRK_4_2_3, ARKODE_ARK324L2SA_ERK_4_2_3};
+    if (key == "ARK-4") return {ARKODE_ARK436L2SA_DIRK_6_3_4, ARKODE_ARK436L2SA_ERK_6_3_4};
+    if (key == "ARK-5") return {ARKODE_ARK548L2SA_DIRK_8_4_5, ARKODE_ARK548L2SA_ERK_8_4_5};
+    NF_ERROR_EXIT(
+        "Unsupported implicit-explicit Runge-Kutta method selected: " + key + ".\n"
+        + "Supported methods are: ARK-2, ARK-3, ARK-4, ARK-5."
     );
-};
+    return {ARKODE_DIRK_NONE, ARKODE_ERK_NONE}; // avoids compiler warnings.
+}
 
 /**
- * @brief Dispatcher for field to N_Vector conversion based on executor type.
- * @tparam ValueType The field data type
- * @param field Source NeoN field
- * @param vector Target SUNDIALS N_Vector
- * @throws Runtime error for unsupported executors
+ * @brief Creates an N_Vector sharing the memory of a NeoN Vector.
+ * @param vector The vector holding the data, it has to outlive the N_Vector
+ * @param context The SUNDIALS context of the N_Vector
+ * @return The N_Vector, to be freed with N_VDestroy
+ *
+ * @details The operations of the N_Vector are implemented as NeoN kernels on the executor of the
+ * vector, thus no data is copied between NeoN and SUNDIALS. N_VClone creates N_Vectors owning a
+ * new NeoN Vector on the same executor, which is freed together with the N_Vector. The values are
+ * of type scalar, which has to match sunrealtype.
  */
-template<typename ValueType>
-void fieldToSunNVector(const NeoN::Vector<ValueType>& field, N_Vector& vector)
-{
-    // CHECK FOR N_Vector on correct space in DEBUG
-    if (std::holds_alternative<NeoN::GPUExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>>(
-            field, vector
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::CPUExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>>(
-            field, vector
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::SerialExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::Serial>>(field, vector);
-        return;
-    }
-    NF_ERROR_EXIT("Unsupported NeoN executor for field.");
-};
+N_Vector wrapVector(NeoN::Vector<scalar>& vector, SUNContext context);
 
 /**
- * @brief Converts SUNDIALS N_Vector data back to NeoN Vector format.
- * @tparam SKVectorType The SUNDIALS Kokkos vector type
- * @tparam ValueType The field data type
- * @param vector Source SUNDIALS N_Vector
- * @param field Target NeoN field
- * @warning Assumes matching initialization and size between vector and field
+ * @brief Returns the NeoN Vector of an N_Vector created by wrapVector or N_VClone.
+ * @param nvector The N_Vector
+ * @return Reference to the NeoN Vector holding the data of the N_Vector
  */
-template<typename SKVectorType, typename ValueType>
-void sunNVectorToVectorImpl(const N_Vector& vector, NeoN::Vector<ValueType>& field)
+NeoN::Vector<scalar>& vector(N_Vector nvector);
+
+/**
+ * @brief Replaces the NeoN Vector wrapped by an N_Vector without creating a new N_Vector.
+ * @param nvector The N_Vector created by wrapVector
+ * @param vector The new vector, it has to outlive the N_Vector
+ */
+void rewrapVector(N_Vector nvector, NeoN::Vector<scalar>& vector);
+
+/**
+ * @brief The user data of the explicit Runge-Kutta RHS evaluation.
+ * @tparam SolutionVectorType The solution field type
+ */
+template<typename SolutionVectorType>
+struct ExplicitRKUserData
 {
-    auto view = ::sundials::kokkos::GetVec<SKVectorType>(vector)->View();
-    ValueType* fieldData = field.data();
-    NeoN::parallelFor(
-        field.exec(), field.range(), KOKKOS_LAMBDA(const localIdx i) { fieldData[i] = view(i); }
-    );
+    using ValueType = typename SolutionVectorType::VectorValueType;
+
+    NeoN::dsl::Expression<ValueType>* expression {nullptr}; /**< The expression to evaluate. */
+    SolutionVectorType* solution {nullptr};    /**< The solution field, the stages are bound to. */
+    SolutionVectorType* oldSolution {nullptr}; /**< Its old time level, the stages are bound to. */
 };
 
 /**
- * @brief Dispatcher for N_Vector to field conversion based on executor type.
- * @tparam ValueType The field data type
- * @param vector Source SUNDIALS N_Vector
- * @param field Target NeoN field
+ * @brief Binds the memory of a stage to the internal vector of a field without a copy.
+ * @param field The field, nothing is bound if it is a nullptr or already holds the stage
+ * @param stage A vector wrapping the stage, it holds the internal vector of the field afterwards
+ * @return Whether the stage was bound, if so it is released by calling the function again
  */
-template<typename ValueType>
-void sunNVectorToVector(const N_Vector& vector, NeoN::Vector<ValueType>& field)
+template<typename SolutionVectorType>
+bool bindStage(
+    SolutionVectorType* field, Vector<typename SolutionVectorType::VectorValueType>& stage
+)
 {
-    if (std::holds_alternative<NeoN::GPUExecutor>(field.exec()))
-    {
-        sunNVectorToVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>>(
-            vector, field
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::CPUExecutor>(field.exec()))
+    if (field == nullptr || field->internalVector().data() == stage.data())
     {
-        sunNVectorToVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>>(
-            vector, field
-        );
-        return;
+        return false;
     }
-    if (std::holds_alternative<NeoN::SerialExecutor>(field.exec()))
-    {
-        sunNVectorToVectorImpl<::sundials::kokkos::Vector<Kokkos::Serial>>(vector, field);
-        return;
-    }
-    NF_ERROR_EXIT("Unsupported NeoN executor for field.");
-};
+    field->internalVector().swap(stage);
+    return true;
+}
 
 /**
  * @brief Performs a single explicit Runge-Kutta stage evaluation.
  * @param t Current time value
  * @param y Current solution vector
  * @param ydot Output RHS vector
- * @param userData Pointer to Expression object
+ * @param userData Pointer to ExplicitRKUserData object
  * @return 0 on success, non-zero on error
  *
  * @details This is our implementation of the RHS of explicit spacial integration, to be integrated
- * in time. In our case user_data is a unique_ptr to an expression. In this function a 'working
- * source' vector is created and parsed to the explicitOperation, which should contain the field
- * variable at the start of the time step. Currently 'multi-stage RK' is not supported until y
- * can be copied to this field.
+ * in time. In our case user_data holds a pointer to an expression, whose explicitOperation is
+ * evaluated directly into the NeoN Vector of ydot. The operators of the expression read the
+ * solution field or its old time level, hence the stage state y is bound as the internal vector
+ * of both fields for the evaluation and their boundaries are corrected for the stage, which makes
+ * multi-stage methods evaluate every stage on its own state. The binding swaps the pointers of the
+ * vectors, no values are copied. The stages ARKode computes in the solution N_Vector share the
+ * memory of the solution field already, see RungeKutta::solve.
  */
 template<typename SolutionVectorType>
 int explicitRKSolve([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
 {
     // Pointer wrangling
     using ValueType = typename SolutionVectorType::VectorValueType;
-    NeoN::dsl::Expression<ValueType>* pdeExpre =
-        reinterpret_cast<NeoN::dsl::Expression<ValueType>*>(userData);
-    sunrealtype* yDotArray = N_VGetArrayPointer(ydot);
-    sunrealtype* yArray = N_VGetArrayPointer(y);
+    auto* rkData = reinterpret_cast<ExplicitRKUserData<SolutionVectorType>*>(userData);
+    NeoN::dsl::Expression<ValueType>* pdeExpre = rkData ? rkData->expression : nullptr;
 
     NF_ASSERT(
-        yDotArray != nullptr && yArray != nullptr && pdeExpre != nullptr,
+        y != nullptr && ydot != nullptr && pdeExpre != nullptr,
         "Failed to dereference pointers in sundails."
     );
 
-    auto size = static_cast<localIdx>(N_VGetLength(y));
-    // Copy initial value from y to source.
-    NeoN::Vector<NeoN::scalar> source = pdeExpre->explicitOperation(size) * -1.0; // compute spatial
-    if (std::holds_alternative<NeoN::GPUExecutor>(pdeExpre->exec()))
+    auto& state = NeoN::sundials::vector(y);
+    auto* solution = rkData->solution;
+    auto* oldSolution = rkData->oldSolution != solution ? rkData->oldSolution : nullptr;
+    auto stage = Vector<ValueType>::wrap(state.exec(), state.data(), state.size());
+    auto oldStage = Vector<ValueType>::wrap(state.exec(), state.data(), state.size());
+    const bool boundSolution = bindStage(solution, stage);
+    const bool boundOldSolution = bindStage(oldSolution, oldStage);
+    for (auto* field : {solution, oldSolution})
     {
-        Kokkos::fence();
+        if (field != nullptr)
+        {
+            field->correctBoundaryConditions();
+        }
     }
-    NeoN::sundials::fieldToSunNVector(source, ydot); // assign rhs to ydot.
-    return 0;
-}
-
-namespace detail
-{
 
-/**
- * @brief Initializes a vector wrapper with specified size and context.
- * @tparam Vector Vector wrapper type implementing initNVector interface
- * @param[in] size Number of elements
- * @param[in] context SUNDIALS context for vector operations
- * @param[in,out] vec Vector to initialize
- */
-template<typename Vector>
-void initNVector(size_t size, std::shared_ptr<SUNContext> context, Vector& vec)
-{
-    vec.initNVector(size, context);
-}
+    auto& source = NeoN::sundials::vector(ydot);
+    fill(source, zero<ValueType>());
+    pdeExpre->explicitOperation(source); // compute spatial
+    source *= scalar(-1.0);              // the rhs is the negated source
 
-/**
- * @brief Provides const access to underlying N_Vector.
- * @tparam Vector Vector wrapper type implementing NVector interface
- * @param vec Source vector wrapper
- * @return Const reference to wrapped N_Vector
- */
-template<typename Vector>
-const N_Vector& sunNVector(const Vector& vec)
-{
-    return vec.sunNVector();
-}
-
-/**
- * @brief Provides mutable access to underlying N_Vector.
- * @tparam Vector Vector wrapper type implementing NVector interface
- * @param[in,out] vec Source vector wrapper
- * @return Mutable reference to wrapped N_Vector
- */
-template<typename Vector>
-N_Vector& sunNVector(Vector& vec)
-{
-    return vec.sunNVector();
-}
-}
-
-/**
- * @brief Serial executor SUNDIALS Kokkos vector wrapper.
- * @tparam ValueType The vector data type
- * @details Provides RAII management of SUNDIALS Kokkos vectors for serial execution.
- */
-template<typename ValueType>
-class SKVectorSerial
-{
-public:
-
-    SKVectorSerial() {};
-    ~SKVectorSerial() = default;
-    SKVectorSerial(const SKVectorSerial& other)
-        : kvector_(other.kvector_), svector_(other.kvector_) {};
-    SKVectorSerial(SKVectorSerial&& other) noexcept
-        : kvector_(std::move(other.kvector_)), svector_(std::move(other.svector_)) {};
-    SKVectorSerial& operator=(const SKVectorSerial& other) = delete;
-    SKVectorSerial& operator=(SKVectorSerial&& other) = delete;
-
-
-    using KVector = ::sundials::kokkos::Vector<Kokkos::Serial>;
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
+    // release the stage, the fields get their own vectors back
+    if (boundSolution)
     {
-        kvector_ = KVector(size, *context);
-        svector_ = kvector_;
-    };
-    const N_Vector& sunNVector() const { return svector_; };
-    N_Vector& sunNVector() { return svector_; };
-
-private:
-
-    KVector kvector_ {}; /**< The Sundails, kokkos initial conditions vector (do not use).*/
-    N_Vector svector_ {nullptr};
-};
-
-/**
- * @brief Host default executor SUNDIALS Kokkos vector wrapper.
- * @tparam ValueType The vector data type
- * @details Provides RAII management of SUNDIALS Kokkos vectors for CPU execution.
- */
-template<typename ValueType>
-class SKVectorHostDefault
-{
-public:
-
-    using KVector = ::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>;
-
-    SKVectorHostDefault() = default;
-    ~SKVectorHostDefault() = default;
-    SKVectorHostDefault(const SKVectorHostDefault& other)
-        : kvector_(other.kvector_), svector_(other.kvector_) {};
-    SKVectorHostDefault(SKVectorHostDefault&& other) noexcept
-        : kvector_(std::move(other.kvector_)), svector_(std::move(other.svector_)) {};
-    SKVectorHostDefault& operator=(const SKVectorHostDefault& other) = delete;
-    SKVectorHostDefault& operator=(SKVectorHostDefault&& other) = delete;
-
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
+        bindStage(solution, stage);
+    }
+    if (boundOldSolution)
     {
-        kvector_ = KVector(size, *context);
-        svector_ = kvector_;
-    };
-    const N_Vector& sunNVector() const { return svector_; };
-    N_Vector& sunNVector() { return svector_; };
-
-private:
-
-    KVector kvector_ {}; /**< The Sundails, kokkos initial conditions vector (do not use).*/
-    N_Vector svector_ {nullptr};
-};
+        bindStage(oldSolution, oldStage);
+    }
+    // the vector operations of SUNDIALS are kernels on the same instance, see wrapVector
+    NeoN::timeIntegration::completeStep(pdeExpre->exec());
+    return 0;
+}
 
 /**
- * @brief Default executor SUNDIALS Kokkos vector wrapper.
- * @tparam ValueType The vector data type
- * @details Provides RAII management of SUNDIALS Kokkos vectors for GPU execution.
+ * @brief RAII wrapper of an N_Vector on top of NeoN Vector memory.
+ *
+ * @details The N_Vector either owns its NeoN Vector, see initNVector, or shares the memory of a
+ * vector owned by the caller, see wrap.
  */
-template<typename ValueType>
-class SKVectorDefault
+class NVector
 {
 public:
 
-    using KVector = ::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>;
+    NVector() = default;
 
-    SKVectorDefault() = default;
-    ~SKVectorDefault() = default;
-    SKVectorDefault(const SKVectorDefault& other)
-        : kvector_(other.kvector_), svector_(other.kvector_) {};
-    SKVectorDefault(SKVectorDefault&& other) noexcept
-        : kvector_(std::move(other.kvector_)), svector_(std::move(other.svector_)) {};
-    SKVectorDefault& operator=(const SKVectorDefault& other) = delete;
-    SKVectorDefault& operator=(SKVectorDefault&& other) = delete;
-
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
-    {
-        kvector_ = KVector(size, *context);
-        svector_ = kvector_;
-    };
-
-    const N_Vector& sunNVector() const { return svector_; };
-
-    N_Vector& sunNVector() { return svector_; };
-
-private:
-
-    KVector kvector_ {}; /**< The Sundails, kokkos initial conditions vector (do not use).*/
-    N_Vector svector_ {nullptr};
-};
-
-/**
- * @brief Unified interface for SUNDIALS Kokkos vector management.
- * @tparam ValueType The vector data type
- * @details Manages executor-specific vector implementations through variant storage.
- * Provides common interface for vector initialization and access.
- */
-template<typename ValueType>
-class SKVector
-{
-public:
-
-    using SKVectorSerialV = SKVectorSerial<ValueType>;
-    using SKVectorHostDefaultV = SKVectorHostDefault<ValueType>;
-    using SKDefaultVectorV = SKVectorDefault<ValueType>;
-    using SKVectorVariant = std::variant<SKVectorSerialV, SKVectorHostDefaultV, SKDefaultVectorV>;
+    ~NVector();
 
     /**
-     * @brief Default constructor. Initializes with host-default vector.
+     * @brief Copy constructor, owned data is copied, wrapped data is wrapped again.
+     * @param[in] other Source NVector to copy from
      */
-    SKVector() { vector_.template emplace<SKVectorHostDefaultV>(); };
+    NVector(const NVector& other);
 
-    /**
-     * @brief Default destructor.
-     */
-    ~SKVector() = default;
+    NVector(NVector&& other) noexcept;
 
-    /**
-     * @brief Copy constructor.
-     * @param[in] other Source SKVector to copy from
-     */
-    SKVector(const SKVector&) = default;
-
-    /**
-     * @brief Copy assignment operator (deleted).
-     */
-    SKVector& operator=(const SKVector&) = delete;
-
-    /**
-     * @brief Move constructor.
-     * @param[in] other Source SKVector to move from
-     */
-    SKVector(SKVector&&) noexcept = default;
-
-    /**
-     * @brief Move assignment operator (deleted).
-     */
-    SKVector& operator=(SKVector&&) noexcept = delete;
-
-    /**
-     * @brief Sets appropriate vector implementation based on executor type.
-     * @param[in] exec NeoN executor specifying computation space
-     */
-    void setExecutor(const NeoN::Executor& exec)
-    {
-        if (std::holds_alternative<NeoN::GPUExecutor>(exec))
-        {
-            vector_.template emplace<SKDefaultVectorV>();
-            return;
-        }
-        if (std::holds_alternative<NeoN::CPUExecutor>(exec))
-        {
-            vector_.template emplace<SKVectorHostDefaultV>();
-            return;
-        }
-        if (std::holds_alternative<NeoN::SerialExecutor>(exec))
-        {
-            vector_.template emplace<SKVectorSerialV>();
-            return;
-        }
+    NVector& operator=(const NVector&) = delete;
 
-        NF_ERROR_EXIT(
-            "Unsupported NeoN executor: "
-            << std::visit([](const auto& e) { return e.name(); }, exec) << "."
-        );
-    }
+    NVector& operator=(NVector&&) noexcept = delete;
 
     /**
-     * @brief Initializes underlying vector with given size and context.
+     * @brief Creates an N_Vector owning a new NeoN Vector.
+     * @param exec Executor of the vector
      * @param size Number of vector elements
      * @param context SUNDIALS context for vector operations
      */
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
-    {
-        std::visit(
-            [size, &context](auto& vec) { detail::initNVector(size, context, vec); }, vector_
-        );
-    }
+    void initNVector(const Executor& exec, size_t size, std::shared_ptr<SUNContext> context);
 
     /**
-     * @brief Gets const reference to underlying N_Vector.
-     * @return Const reference to wrapped SUNDIALS N_Vector
+     * @brief Shares the memory of the given vector, an existing N_Vector is reused.
+     * @param vector The vector, it has to outlive this object or the next call of wrap
+     * @param context SUNDIALS context for vector operations
      */
-    const N_Vector& sunNVector() const
-    {
-        return std::visit(
-            [](const auto& vec) -> const N_Vector& { return detail::sunNVector(vec); }, vector_
-        );
-    }
+    void wrap(NeoN::Vector<scalar>& vector, std::shared_ptr<SUNContext> context);
 
     /**
-     * @brief Gets mutable reference to underlying N_Vector.
-     * @return Mutable reference to wrapped SUNDIALS N_Vector
+     * @brief Gets the NeoN Vector holding the data.
      */
-    N_Vector& sunNVector()
-    {
-        return std::visit([](auto& vec) -> N_Vector& { return detail::sunNVector(vec); }, vector_);
-    }
+    NeoN::Vector<scalar>& vector();
 
     /**
-     * @brief Gets const reference to variant storing implementation.
-     * @return Const reference to vector variant
+     * @brief Gets const reference to underlying N_Vector.
      */
-    const SKVectorVariant& variant() const { return vector_; }
+    const N_Vector& sunNVector() const { return svector_; };
 
     /**
-     * @brief Gets mutable reference to variant storing implementation.
-     * @return Mutable reference to vector variant
+     * @brief Gets mutable reference to underlying N_Vector.
      */
-    SKVectorVariant& variant() { return vector_; }
+    N_Vector& sunNVector() { return svector_; };
 
 private:
 
-    SKVectorVariant vector_; /**< Variant storing executor-specific vector implementation */
+    std::unique_ptr<NeoN::Vector<scalar>> owned_ {nullptr}; /**< The owned data, if any. */
+    std::shared_ptr<SUNContext> context_ {nullptr}; /**< Keeps the context of svector_ alive. */
+    N_Vector svector_ {nullptr};
 };
 }
 
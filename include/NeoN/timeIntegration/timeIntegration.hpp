@@ -5,7 +5,9 @@
 #pragma once
 
 #include <functional>
+#include <string>
 
+#include "NeoN/core/timer.hpp"
 #include "NeoN/fields/field.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/dsl/expression.hpp"
@@ -13,6 +15,22 @@
 namespace NeoN::timeIntegration
 {
 
+/* @brief completes the work of a time step or of a right hand side evaluation on exec
+ *
+ * The kernels of the next step are enqueued on the same execution space instance and thus
+ * ordered after the current ones, and every host access of device data waits for the kernels it
+ * depends on, ie. the transfers to the host, the reductions, the exchange buffers of MPI and the
+ * solvers. Hence the GPUExecutor is not waited for and the host runs ahead to enqueue the next
+ * kernels. The host executors are waited for, since their results are read through views.
+ */
+inline void completeStep(const Executor& exec)
+{
+    if (!std::holds_alternative<GPUExecutor>(exec))
+    {
+        NeoN::fence(exec);
+    }
+}
+
 /* @class Factory class to create time integration method by a given name
  * using NeoNs runTimeFactory mechanism
  */
@@ -43,6 +61,12 @@ public:
     // Pure virtual function for cloning
     virtual std::unique_ptr<TimeIntegratorBase> clone() const = 0;
 
+    /* @brief whether the scheme reads old time levels before the previous one
+     *
+     * The history of these schemes is only valid for consecutive steps of one solution.
+     */
+    virtual bool multistep() const { return false; }
+
 protected:
 
     const Dictionary& schemeDict_;
@@ -65,24 +89,33 @@ public:
     using Expression = NeoN::dsl::Expression<ValueType>;
 
     TimeIntegration(const TimeIntegration& timeIntegrator)
-        : timeIntegratorStrategy_(timeIntegrator.timeIntegratorStrategy_->clone()) {};
+        : timeIntegratorStrategy_(timeIntegrator.timeIntegratorStrategy_->clone()),
+          timerName_(timeIntegrator.timerName_) {};
 
     TimeIntegration(TimeIntegration&& timeIntegrator)
-        : timeIntegratorStrategy_(std::move(timeIntegrator.timeIntegratorStrategy_)) {};
+        : timeIntegratorStrategy_(std::move(timeIntegrator.timeIntegratorStrategy_)),
+          timerName_(std::move(timeIntegrator.timerName_)) {};
 
     TimeIntegration(const Dictionary& schemeDict, const Dictionary& solutionDict)
         : timeIntegratorStrategy_(TimeIntegratorBase<SolutionVectorType>::create(
             schemeDict.get<std::string>("type"), schemeDict, solutionDict
-        )) {};
+        )),
+          timerName_("timeIntegration::" + schemeDict.get<std::string>("type")) {};
 
     void solve(Expression& eqn, SolutionVectorType& sol, scalar t, scalar dt)
     {
+        // the time step is recorded as timer and profiling region of the integrator
+        ScopedTimer timer(timerName_, sol.exec());
         timeIntegratorStrategy_->solve(eqn, sol, t, dt);
     }
 
+    bool multistep() const { return timeIntegratorStrategy_->multistep(); }
+
 private:
 
     std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> timeIntegratorStrategy_;
+
+    std::string timerName_;
 };
 
 
@@ -0,0 +1,112 @@
+# SPDX-FileCopyrightText: 2025 NeoN authors
+#
+# SPDX-License-Identifier: MIT
+
+"""Stores the results of a benchmark run as baseline or compares a run against
+its baseline.
+
+usage: benchmarkBaseline.py store <benchmark>.xml <baseline>.json
+       benchmarkBaseline.py compare <benchmark>.xml <baseline>.json [threshold] [sigma]
+
+The results are read from the Catch2 xml output of the benchmark, every record
+is identified by the executor, the benchmark and the size, ie. the test case,
+the sections and the name of the benchmark. Storing merges the records into
+the baseline, existing records are replaced.
+
+Comparing flags a record as regression if its mean time exceeds the baseline
+by more than the relative threshold (default 0.1) and by more than sigma
+(default 2) times the summed standard deviations of both runs, which keeps
+noisy benchmarks from failing. The exit code is one if any record regressed.
+"""
+
+import json
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+
+def parse_results(element, test_case, sections, records):
+    """collects the benchmark results below element into records"""
+    for child in element:
+        if child.tag == "Section":
+            parse_results(child, test_case, sections + [child.get("name")], records)
+        elif child.tag == "BenchmarkResults":
+            name = child.get("name")
+            # the benchmarks are named by their executor or contain it as "<executor> ..."
+            executor = name.split()[0] if name else ""
+            key = "/".join([test_case] + sections + [name])
+            records[key] = {
+                "executor": executor,
+                "benchmark": test_case,
+                "size": "/".join(sections),
+                "name": name,
+                "mean": float(child.find("mean").get("value")),
+                "standardDeviation": float(child.find("standardDeviation").get("value")),
+            }
+
+
+def parse_file(file_name):
+    """returns the records of a Catch2 xml file by key"""
+    records = {}
+    root = ET.parse(file_name).getroot()
+    for test_case in root.iter("TestCase"):
+        parse_results(test_case, test_case.get("name"), [], records)
+    return records
+
+
+def read_baseline(file_name):
+    if not os.path.exists(file_name):
+        return {}
+    with open(file_name, "r") as fh:
+        return json.load(fh)
+
+
+def store(records, baseline_file):
+    baseline = read_baseline(baseline_file)
+    baseline.update(records)
+    with open(baseline_file, "w") as fh:
+        json.dump(baseline, fh, indent=2, sort_keys=True)
+    print(f"stored {len(records)} results in {baseline_file}")
+    return 0
+
+
+def compare(records, baseline_file, threshold, sigma):
+    baseline = read_baseline(baseline_file)
+    if not baseline:
+        print(f"no baseline {baseline_file}, nothing to compare")
+        return 0
+
+    regressions = 0
+    print(f"{'benchmark':60s} {'base [ns]':>14s} {'run [ns]':>14s} {'ratio':>7s}")
+    for key, record in sorted(records.items()):
+        base = baseline.get(key)
+        if base is None:
+            print(f"{key:60s} {'new':>14s} {record['mean']:14.1f}")
+            continue
+        ratio = record["mean"] / base["mean"] if base["mean"] > 0 else 1.0
+        noise = sigma * (record["standardDeviation"] + base["standardDeviation"])
+        regressed = ratio > 1.0 + threshold and record["mean"] - base["mean"] > noise
+        regressions += regressed
+        flag = " REGRESSION" if regressed else ""
+        print(f"{key:60s} {base['mean']:14.1f} {record['mean']:14.1f} {ratio:7.3f}{flag}")
+
+    if regressions:
+        print(f"{regressions} benchmarks are slower than {baseline_file} by more than {threshold}")
+    return 1 if regressions else 0
+
+
+def main():
+    if len(sys.argv) < 4 or sys.argv[1] not in ("store", "compare"):
+        print(__doc__)
+        return 2
+    mode, xml_file, baseline_file = sys.argv[1:4]
+    records = parse_file(xml_file)
+    if mode == "store":
+        return store(records, baseline_file)
+    threshold = float(sys.argv[4]) if len(sys.argv) > 4 else 0.1
+    sigma = float(sys.argv[5]) if len(sys.argv) > 5 else 2.0
+    return compare(records, baseline_file, threshold, sigma)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
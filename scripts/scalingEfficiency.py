@@ -0,0 +1,123 @@
+# SPDX-FileCopyrightText: 2025 NeoN authors
+#
+# SPDX-License-Identifier: MIT
+
+"""Combines the merged timer reports of a scaling benchmark run with different
+rank counts into parallel efficiency tables.
+
+usage: scalingEfficiency.py <benchmark> [directory]
+
+Reads every <benchmark>_<ranks>.txt of the directory, prints the tables and
+writes them to <benchmark>_efficiency.md.
+"""
+
+import glob
+import os
+import sys
+
+
+def parse_report(lines):
+    """takes the lines of a merged timer report and returns a dict of the
+    timer paths to their calls and maximum total over the ranks"""
+    timers = {}
+    stack = []
+    for line in lines[1:]:
+        tokens = line.split()
+        if len(tokens) < 8 or tokens[0].startswith("["):
+            continue
+        depth = (len(line) - len(line.lstrip(" "))) // 2
+        name = " ".join(tokens[:-7])
+        stack = stack[:depth] + [name]
+        timers["/".join(stack)] = {
+            "calls": int(tokens[-7]),
+            "max": float(tokens[-4]),
+            "depth": depth,
+        }
+    return timers
+
+
+def parse_file(file_name):
+    """returns the cases of the output of one run as list of records"""
+    records = []
+    with open(file_name, "r") as fh:
+        lines = fh.read().splitlines()
+    i = 0
+    while i < len(lines):
+        if not lines[i].startswith("# scaling"):
+            i += 1
+            continue
+        record = dict(kv.split("=") for kv in lines[i].split()[2:])
+        end = i + 1
+        while end < len(lines) and not lines[end].startswith("# end"):
+            end += 1
+        record["timers"] = parse_report(lines[i + 1 : end])
+        records.append(record)
+        i = end + 1
+    return records
+
+
+def efficiency(mode, base, record, phase):
+    """the parallel efficiency of a phase relative to the run with the fewest ranks"""
+    p0, p = int(base["ranks"]), int(record["ranks"])
+    t0, t = base["timers"][phase]["max"], record["timers"][phase]["max"]
+    if t <= 0.0 or t0 <= 0.0:
+        return 0.0
+    if mode == "strong":
+        return (t0 * p0) / (t * p)
+    # the cells per rank of the weak scaling runs change with the rounding of the mesh size
+    c0, c = int(base["cells"]) / p0, int(record["cells"]) / p
+    return (t0 / c0) / (t / c)
+
+
+def tables(records):
+    """returns the markdown tables per mode and executor"""
+    out = []
+    cases = sorted({(r["mode"], r["executor"]) for r in records})
+    for mode, executor in cases:
+        runs = sorted(
+            (r for r in records if r["mode"] == mode and r["executor"] == executor),
+            key=lambda r: int(r["ranks"]),
+        )
+        base = runs[0]
+        phases = [
+            path
+            for path, timer in base["timers"].items()
+            if timer["depth"] <= 2 and all(path in r["timers"] for r in runs)
+        ]
+        out.append(f"## {mode} scaling on {executor}\n")
+        header = "| phase | " + " | ".join(f"{r['ranks']} ranks" for r in runs) + " |"
+        out.append(header)
+        out.append("|" + "---|" * (len(runs) + 1))
+        out.append("| cells | " + " | ".join(r["cells"] for r in runs) + " |")
+        for phase in phases:
+            cols = []
+            for r in runs:
+                steps = int(r["steps"])
+                ms = 1e3 * r["timers"][phase]["max"] / steps
+                eff = 100.0 * efficiency(mode, base, r, phase)
+                cols.append(f"{ms:.3f} ms ({eff:.0f}%)")
+            out.append(f"| {phase} | " + " | ".join(cols) + " |")
+        out.append("")
+    return "\n".join(out)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    bench = sys.argv[1]
+    directory = sys.argv[2] if len(sys.argv) > 2 else "."
+    records = []
+    for file_name in glob.glob(os.path.join(directory, f"{bench}_*.txt")):
+        records += parse_file(file_name)
+    if not records:
+        print(f"no scaling results of {bench} found in {directory}")
+        sys.exit(1)
+    result = tables(records)
+    print(result)
+    with open(os.path.join(directory, f"{bench}_efficiency.md"), "w") as outfile:
+        outfile.write(result)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstdio>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/backendRegistry.hpp"
+
+namespace NeoN
+{
+
+BackendRegistry& BackendRegistry::instance()
+{
+    static BackendRegistry registry;
+    return registry;
+}
+
+BackendRegistry::BackendRegistry()
+{
+    Kokkos::push_finalize_hook([]() { BackendRegistry::instance().release(); });
+}
+
+void BackendRegistry::record(const std::string& name, std::chrono::duration<double> duration)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto backend = std::find_if(
+        stats_.begin(), stats_.end(), [&](const BackendStats& s) { return s.name == name; }
+    );
+    if (backend == stats_.end())
+    {
+        stats_.push_back({name, 0, 0.0});
+        backend = stats_.end() - 1;
+    }
+    backend->calls++;
+    backend->total += duration.count();
+}
+
+bool BackendRegistry::initialized(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::any_of(
+        stats_.begin(), stats_.end(), [&](const BackendStats& s) { return s.name == name; }
+    );
+}
+
+std::vector<BackendStats> BackendRegistry::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+double BackendRegistry::total() const
+{
+    double sum = 0.0;
+    for (const auto& backend : stats())
+    {
+        sum += backend.total;
+    }
+    return sum;
+}
+
+void BackendRegistry::report(std::ostream& os) const
+{
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "%-24s%10s%12s", "Backend", "calls", "total[s]");
+    os << buffer << "\n";
+    for (const auto& backend : stats())
+    {
+        std::snprintf(
+            buffer,
+            sizeof(buffer),
+            "%-24s%10zu%12.4g",
+            backend.name.c_str(),
+            backend.calls,
+            backend.total
+        );
+        os << buffer << "\n";
+    }
+}
+
+void BackendRegistry::release()
+{
+    std::lock_guard<std::mutex> lock(initMutex_);
+    objects_.clear();
+}
+
+} // namespace NeoN
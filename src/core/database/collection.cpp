@@ -2,12 +2,49 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <cstdint>
+
 #include "NeoN/core/database/collection.hpp"
+#include "NeoN/core/error.hpp"
 
 
 namespace NeoN
 {
 
+std::string indexValue(const std::any& value)
+{
+    if (const auto* str = std::any_cast<std::string>(&value))
+    {
+        return *str;
+    }
+    if (const auto* chars = std::any_cast<const char*>(&value))
+    {
+        return *chars;
+    }
+    if (const auto* i64 = std::any_cast<std::int64_t>(&value))
+    {
+        return std::to_string(*i64);
+    }
+    if (const auto* i32 = std::any_cast<std::int32_t>(&value))
+    {
+        return std::to_string(*i32);
+    }
+    if (const auto* u64 = std::any_cast<std::uint64_t>(&value))
+    {
+        return std::to_string(*u64);
+    }
+    if (const auto* u32 = std::any_cast<std::uint32_t>(&value))
+    {
+        return std::to_string(*u32);
+    }
+    if (const auto* b = std::any_cast<bool>(&value))
+    {
+        return *b ? "true" : "false";
+    }
+    NF_ERROR_EXIT("The type " << value.type().name() << " cannot be used as an index value.");
+    return "";
+}
+
 Document& Collection::doc(const std::string& id) { return impl_->doc(id); }
 
 const Document& Collection::doc(const std::string& id) const { return impl_->doc(id); }
@@ -18,6 +55,11 @@ std::vector<std::string> Collection::find(const std::function<bool(const Documen
     return impl_->find(predicate);
 }
 
+std::vector<std::string> Collection::findBy(const std::string& key, const std::any& value) const
+{
+    return impl_->findBy(key, value);
+}
+
 size_t Collection::size() const { return impl_->size(); }
 
 std::string Collection::type() const { return impl_->type(); }
@@ -2,6 +2,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+
 #include "NeoN/core/database/database.hpp"
 #include "NeoN/core/database/collection.hpp"
 
@@ -21,6 +23,17 @@ const Collection& Database::at(const std::string& name) const { return collectio
 
 std::size_t Database::size() const { return collections_.size(); }
 
+std::vector<std::string> Database::names() const
+{
+    std::vector<std::string> result;
+    for (const auto& entry : collections_)
+    {
+        result.push_back(entry.first);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 bool Database::remove(const std::string& name) { return collections_.erase(name) > 0; }
 
 } // namespace NeoN
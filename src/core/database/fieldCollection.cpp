@@ -46,10 +46,25 @@ std::int64_t VectorDocument::subCycleIndex() const
 
 std::int64_t& VectorDocument::subCycleIndex() { return doc_.get<std::int64_t>("subCycleIndex"); }
 
+bool VectorDocument::offloadable() const
+{
+    return doc_.contains("offloadable") && doc_.get<bool>("offloadable");
+}
+
+void VectorDocument::setOffloadable(bool offloadable) { doc_.insert("offloadable", offloadable); }
+
+bool VectorDocument::resident() const
+{
+    return !doc_.contains("resident") || doc_.get<bool>("resident");
+}
+
 
 VectorCollection::VectorCollection(NeoN::Database& db, std::string name)
     : NeoN::CollectionMixin<VectorDocument>(db, name)
-{}
+{
+    // fields are usually searched by name
+    createIndex("name");
+}
 
 bool VectorCollection::contains(const std::string& id) const { return docs_.contains(id); }
 
@@ -60,7 +75,7 @@ std::string VectorCollection::insert(const VectorDocument& cc)
     {
         return "";
     }
-    docs_.emplace(id, cc);
+    emplaceDoc(id, cc);
     return id;
 }
 
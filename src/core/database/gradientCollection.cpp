@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/database/gradientCollection.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+GradientDocument::GradientDocument(const Document& doc) : doc_(doc) {}
+
+const std::string& GradientDocument::fieldKey() const
+{
+    return doc_.get<std::string>("fieldKey");
+}
+
+std::int64_t& GradientDocument::timeIndex() { return doc_.get<std::int64_t>("timeIndex"); }
+
+std::int64_t& GradientDocument::iterationIndex()
+{
+    return doc_.get<std::int64_t>("iterationIndex");
+}
+
+std::int64_t& GradientDocument::subCycleIndex() { return doc_.get<std::int64_t>("subCycleIndex"); }
+
+std::array<std::size_t, 3>& GradientDocument::versions()
+{
+    return doc_.get<std::array<std::size_t, 3>>("versions");
+}
+
+bool GradientDocument::current(
+    const VectorDocument& fieldDoc, const std::array<std::size_t, 3>& versions
+) const
+{
+    return doc_.get<std::int64_t>("timeIndex") == fieldDoc.timeIndex()
+        && doc_.get<std::int64_t>("iterationIndex") == fieldDoc.iterationIndex()
+        && doc_.get<std::int64_t>("subCycleIndex") == fieldDoc.subCycleIndex()
+        && doc_.get<std::array<std::size_t, 3>>("versions") == versions;
+}
+
+Document& GradientDocument::doc() { return doc_; }
+
+const Document& GradientDocument::doc() const { return doc_; }
+
+std::string GradientDocument::id() const { return doc_.id(); }
+
+std::string GradientDocument::typeName() { return "GradientDocument"; }
+
+GradientCollection::GradientCollection(
+    Database& db, std::string name, std::string fieldCollectionName
+)
+    : CollectionMixin<GradientDocument>(db, name), fieldCollectionName_(fieldCollectionName)
+{
+    // the gradients are looked up by the key of their field on every request
+    createIndex("fieldKey");
+}
+
+bool GradientCollection::contains(const std::string& id) const { return docs_.contains(id); }
+
+bool GradientCollection::insert(const GradientDocument& gd)
+{
+    std::string id = gd.id();
+    if (contains(id))
+    {
+        return false;
+    }
+    emplaceDoc(id, gd);
+    return true;
+}
+
+std::string GradientCollection::findGradient(const std::string& fieldKey) const
+{
+    auto keys = findBy("fieldKey", fieldKey);
+    if (keys.size() == 1)
+    {
+        return keys[0];
+    }
+    return "";
+}
+
+GradientDocument& GradientCollection::gradientDoc(const std::string& id) { return docs_.at(id); }
+
+const GradientDocument& GradientCollection::gradientDoc(const std::string& id) const
+{
+    return docs_.at(id);
+}
+
+GradientCollection&
+GradientCollection::instance(Database& db, std::string name, std::string fieldCollectionName)
+{
+    Collection& col = db.insert(name, GradientCollection(db, name, fieldCollectionName));
+    return col.as<GradientCollection>();
+}
+
+GradientCollection& GradientCollection::instance(VectorCollection& fieldCollection)
+{
+    std::string name = fieldCollection.name() + "_gradient";
+    return instance(fieldCollection.db(), name, fieldCollection.name());
+}
+
+} // namespace NeoN
@@ -55,7 +55,11 @@ OldTimeCollection::OldTimeCollection(
     Database& db, std::string name, std::string fieldCollectionName
 )
     : CollectionMixin<OldTimeDocument>(db, name), fieldCollectionName_(fieldCollectionName)
-{}
+{
+    // the old time chains are traversed by the keys of the neighbouring fields
+    createIndex("nextTime");
+    createIndex("previousTime");
+}
 
 OldTimeDocument& OldTimeCollection::oldTimeDoc(const std::string& id) { return docs_.at(id); }
 
@@ -94,13 +98,13 @@ bool OldTimeCollection::insert(const OldTimeDocument& otd)
     {
         return false;
     }
-    docs_.emplace(id, otd);
+    emplaceDoc(id, otd);
     return true;
 }
 
 std::string OldTimeCollection::findNextTime(std::string id) const
 {
-    auto keys = find([id](const Document& doc) { return doc.get<std::string>("nextTime") == id; });
+    auto keys = findBy("nextTime", id);
     if (keys.size() == 1)
     {
         return keys[0];
@@ -110,8 +114,7 @@ std::string OldTimeCollection::findNextTime(std::string id) const
 
 std::string OldTimeCollection::findPreviousTime(std::string id) const
 {
-    auto keys =
-        find([id](const Document& doc) { return doc.get<std::string>("previousTime") == id; });
+    auto keys = findBy("previousTime", id);
     if (keys.size() == 1)
     {
         return keys[0];
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+
+#include "NeoN/core/database/solverStatsCollection.hpp"
+
+namespace NeoN::la
+{
+
+SolverStatsDocument::SolverStatsDocument(const Document& doc) : doc_(doc) {}
+
+SolverStatsDocument::SolverStatsDocument(
+    std::string equation,
+    std::int64_t timeIndex,
+    std::int64_t iterationIndex,
+    std::size_t solveIndex,
+    const SolverStats& stats
+)
+    : doc_(Document(
+        {{"equation", equation},
+         {"timeIndex", timeIndex},
+         {"iterationIndex", iterationIndex},
+         {"solveIndex", solveIndex},
+         {"numIter", stats.numIter},
+         {"initResNorm", stats.initResNorm},
+         {"finalResNorm", stats.finalResNorm},
+         {"solveTime", stats.solveTime},
+         {"setupTime", stats.timings.setupTime},
+         {"preconditionerTime", stats.timings.preconditionerTime},
+         {"applyTime", stats.timings.applyTime},
+         {"transferTime", stats.timings.transferTime}}
+    ))
+{}
+
+const std::string& SolverStatsDocument::equation() const
+{
+    return doc_.get<std::string>("equation");
+}
+
+std::int64_t SolverStatsDocument::timeIndex() const { return doc_.get<std::int64_t>("timeIndex"); }
+
+std::int64_t SolverStatsDocument::iterationIndex() const
+{
+    return doc_.get<std::int64_t>("iterationIndex");
+}
+
+std::size_t SolverStatsDocument::solveIndex() const { return doc_.get<std::size_t>("solveIndex"); }
+
+SolverStats SolverStatsDocument::stats() const
+{
+    return {
+        doc_.get<int>("numIter"),
+        doc_.get<scalar>("initResNorm"),
+        doc_.get<scalar>("finalResNorm"),
+        doc_.get<scalar>("solveTime"),
+        {doc_.get<scalar>("setupTime"),
+         doc_.get<scalar>("preconditionerTime"),
+         doc_.get<scalar>("applyTime"),
+         doc_.get<scalar>("transferTime")}
+    };
+}
+
+Document& SolverStatsDocument::doc() { return doc_; }
+
+const Document& SolverStatsDocument::doc() const { return doc_; }
+
+std::string SolverStatsDocument::id() const { return doc_.id(); }
+
+std::string SolverStatsDocument::typeName() { return "SolverStatsDocument"; }
+
+SolverStatsCollection::SolverStatsCollection(Database& db, std::string name)
+    : CollectionMixin<SolverStatsDocument>(db, name)
+{
+    createIndex("equation");
+}
+
+bool SolverStatsCollection::contains(const std::string& id) const { return docs_.contains(id); }
+
+bool SolverStatsCollection::insert(const SolverStatsDocument& doc)
+{
+    std::string id = doc.id();
+    if (contains(id))
+    {
+        return false;
+    }
+    emplaceDoc(id, doc);
+    nSolves_ = std::max(nSolves_, doc.solveIndex() + 1);
+    return true;
+}
+
+std::string SolverStatsCollection::record(
+    const std::string& equation,
+    std::int64_t timeIndex,
+    std::int64_t iterationIndex,
+    const SolverStats& stats
+)
+{
+    SolverStatsDocument doc(equation, timeIndex, iterationIndex, nSolves_, stats);
+    insert(doc);
+    return doc.id();
+}
+
+SolverStatsDocument& SolverStatsCollection::statsDoc(const std::string& id) { return docs_.at(id); }
+
+const SolverStatsDocument& SolverStatsCollection::statsDoc(const std::string& id) const
+{
+    return docs_.at(id);
+}
+
+/* @brief sorts the documents by the order of their solves */
+static std::vector<SolverStatsDocument> sortBySolve(std::vector<SolverStatsDocument> docs)
+{
+    std::sort(
+        docs.begin(),
+        docs.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.solveIndex() < rhs.solveIndex(); }
+    );
+    return docs;
+}
+
+std::vector<SolverStatsDocument> SolverStatsCollection::history(const std::string& equation) const
+{
+    std::vector<SolverStatsDocument> result;
+    for (const auto& id : findBy("equation", equation))
+    {
+        result.push_back(docs_.at(id));
+    }
+    return sortBySolve(result);
+}
+
+std::vector<SolverStatsDocument>
+SolverStatsCollection::history(const std::string& equation, std::int64_t timeIndex) const
+{
+    std::vector<SolverStatsDocument> result;
+    for (const auto& id : findBy("equation", equation))
+    {
+        const auto& doc = docs_.at(id);
+        if (doc.timeIndex() == timeIndex)
+        {
+            result.push_back(doc);
+        }
+    }
+    return sortBySolve(result);
+}
+
+void SolverStatsCollection::write(std::ostream& os) const
+{
+    std::vector<SolverStatsDocument> docs;
+    for (const auto& [id, doc] : docs_)
+    {
+        docs.push_back(doc);
+    }
+    os << "equation,timeIndex,iterationIndex,numIter,initResNorm,finalResNorm,solveTime,"
+       << "setupTime,preconditionerTime,applyTime,transferTime\n";
+    for (const auto& doc : sortBySolve(docs))
+    {
+        const auto stats = doc.stats();
+        os << doc.equation() << "," << doc.timeIndex() << "," << doc.iterationIndex() << ","
+           << stats.numIter << "," << stats.initResNorm << "," << stats.finalResNorm << ","
+           << stats.solveTime << "," << stats.timings.setupTime << ","
+           << stats.timings.preconditionerTime << "," << stats.timings.applyTime << ","
+           << stats.timings.transferTime << "\n";
+    }
+}
+
+SolverStatsCollection& SolverStatsCollection::instance(Database& db, std::string name)
+{
+    Collection& col = db.insert(name, SolverStatsCollection(db, name));
+    return col.as<SolverStatsCollection>();
+}
+
+SolverStatsCollection& SolverStatsCollection::instance(Database& db)
+{
+    return instance(db, "solverStats");
+}
+
+} // namespace NeoN
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/database/statisticsCollection.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+StatisticsDocument::StatisticsDocument(const Document& doc) : doc_(doc) {}
+
+const std::string& StatisticsDocument::fieldKey() const
+{
+    return doc_.get<std::string>("fieldKey");
+}
+
+std::int64_t StatisticsDocument::startTimeIndex() const
+{
+    return doc_.get<std::int64_t>("startTimeIndex");
+}
+
+std::int64_t StatisticsDocument::interval() const { return doc_.get<std::int64_t>("interval"); }
+
+std::int64_t& StatisticsDocument::sampledTimeIndex()
+{
+    return doc_.get<std::int64_t>("sampledTimeIndex");
+}
+
+bool StatisticsDocument::due(std::int64_t timeIndex) const
+{
+    return timeIndex != doc_.get<std::int64_t>("sampledTimeIndex")
+        && (timeIndex - startTimeIndex()) % interval() == 0;
+}
+
+Document& StatisticsDocument::doc() { return doc_; }
+
+const Document& StatisticsDocument::doc() const { return doc_; }
+
+std::string StatisticsDocument::id() const { return doc_.id(); }
+
+std::string StatisticsDocument::typeName() { return "StatisticsDocument"; }
+
+StatisticsCollection::StatisticsCollection(
+    Database& db, std::string name, std::string fieldCollectionName
+)
+    : CollectionMixin<StatisticsDocument>(db, name), fieldCollectionName_(fieldCollectionName)
+{
+    // the statistics are looked up by the key of their field on every sample
+    createIndex("fieldKey");
+}
+
+bool StatisticsCollection::contains(const std::string& id) const { return docs_.contains(id); }
+
+bool StatisticsCollection::insert(const StatisticsDocument& sd)
+{
+    std::string id = sd.id();
+    if (contains(id))
+    {
+        return false;
+    }
+    emplaceDoc(id, sd);
+    return true;
+}
+
+std::string StatisticsCollection::findStatistics(const std::string& fieldKey) const
+{
+    auto keys = findBy("fieldKey", fieldKey);
+    if (keys.size() == 1)
+    {
+        return keys[0];
+    }
+    return "";
+}
+
+StatisticsDocument& StatisticsCollection::statisticsDoc(const std::string& id)
+{
+    return docs_.at(id);
+}
+
+const StatisticsDocument& StatisticsCollection::statisticsDoc(const std::string& id) const
+{
+    return docs_.at(id);
+}
+
+StatisticsCollection&
+StatisticsCollection::instance(Database& db, std::string name, std::string fieldCollectionName)
+{
+    Collection& col = db.insert(name, StatisticsCollection(db, name, fieldCollectionName));
+    return col.as<StatisticsCollection>();
+}
+
+StatisticsCollection& StatisticsCollection::instance(VectorCollection& fieldCollection)
+{
+    std::string name = fieldCollection.name() + "_statistics";
+    return instance(fieldCollection.db(), name, fieldCollection.name());
+}
+
+} // namespace NeoN
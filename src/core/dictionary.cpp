@@ -2,8 +2,11 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <iostream> // for operator<<, basic_ostream, endl, cerr, ostream
+#include <sstream>
 
 #include "NeoN/core/dictionary.hpp"
 #include "NeoN/core/error.hpp"
@@ -89,14 +92,49 @@ Dictionary::Dictionary(const std::initializer_list<std::pair<std::string, std::a
     }
 }
 
-void Dictionary::insert(const std::string& key, const std::any& value) { data_[key] = value; }
+Dictionary::Dictionary(Dictionary&& other) noexcept
+    : data_(std::move(other.data_)), version_(other.version_)
+{
+    other.touch();
+}
 
-void Dictionary::remove(const std::string& key) { data_.erase(key); }
+Dictionary& Dictionary::operator=(Dictionary&& other) noexcept
+{
+    if (this != &other)
+    {
+        data_ = std::move(other.data_);
+        version_ = other.version_;
+        other.touch();
+    }
+    return *this;
+}
+
+std::uint64_t Dictionary::nextVersion()
+{
+    // versions are unique over all dictionaries, zero is left for bindings which are not bound
+    static std::atomic<std::uint64_t> counter {0};
+    return ++counter;
+}
+
+void Dictionary::touch() { version_ = nextVersion(); }
+
+void Dictionary::insert(const std::string& key, const std::any& value)
+{
+    touch();
+    data_[key] = value;
+}
+
+void Dictionary::remove(const std::string& key)
+{
+    touch();
+    data_.erase(key);
+}
 
 bool Dictionary::contains(const std::string& key) const { return data_.find(key) != data_.end(); }
 
 std::any& Dictionary::operator[](const std::string& key)
 {
+    touch();
     try
     {
         return data_.at(key);
@@ -147,10 +185,97 @@ std::vector<std::string> Dictionary::keys() const
     return keys;
 }
 
-std::unordered_map<std::string, std::any>& Dictionary::getMap() { return data_; }
+std::unordered_map<std::string, std::any>& Dictionary::getMap()
+{
+    touch();
+    return data_;
+}
 
 const std::unordered_map<std::string, std::any>& Dictionary::getMap() const { return data_; }
 
+/* @brief writes the contents of the dictionary with sorted keys to the stream
+ *
+ * @return false if the dictionary holds a value of a type which is not written
+ */
+static bool writeContentKey(std::ostream& os, const Dictionary& dict)
+{
+    auto keys = dict.keys();
+    std::sort(keys.begin(), keys.end());
+    os << "{";
+    for (const auto& key : keys)
+    {
+        os << key << ":";
+        if (!writeContentKey(os, dict[key]))
+        {
+            return false;
+        }
+        os << ";";
+    }
+    os << "}";
+    return true;
+}
+
+bool writeContentKey(std::ostream& os, const std::any& value)
+{
+    if (const auto* v = std::any_cast<std::string>(&value))
+    {
+        os << "s" << v->size() << ":" << *v;
+    }
+    else if (const auto* c = std::any_cast<const char*>(&value))
+    {
+        const std::string str(*c);
+        os << "s" << str.size() << ":" << str;
+    }
+    else if (const auto* b = std::any_cast<bool>(&value))
+    {
+        os << "b" << *b;
+    }
+    else if (const auto* i = std::any_cast<int>(&value))
+    {
+        os << "i" << *i;
+    }
+    else if (const auto* l = std::any_cast<long>(&value))
+    {
+        os << "i" << *l;
+    }
+    else if (const auto* ll = std::any_cast<long long>(&value))
+    {
+        os << "i" << *ll;
+    }
+    else if (const auto* u = std::any_cast<std::size_t>(&value))
+    {
+        os << "i" << *u;
+    }
+    else if (const auto* d = std::any_cast<double>(&value))
+    {
+        os << "f" << *d;
+    }
+    else if (const auto* f = std::any_cast<float>(&value))
+    {
+        os << "f" << static_cast<double>(*f);
+    }
+    else if (const auto* sub = std::any_cast<Dictionary>(&value))
+    {
+        return writeContentKey(os, *sub);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+std::optional<std::string> contentKey(const Dictionary& dict)
+{
+    std::ostringstream os;
+    os.precision(17);
+    if (!writeContentKey(os, dict))
+    {
+        return std::nullopt;
+    }
+    return os.str();
+}
+
 std::ostream& operator<<(std::ostream& os, const Dictionary& in)
 {
     os << "{\n";
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstdio>
+
+#include "NeoN/core/memoryReport.hpp"
+
+namespace NeoN
+{
+
+namespace
+{
+
+constexpr std::size_t nameWidth = 40;
+
+std::string formatRow(
+    const std::string& name, std::size_t indent, double mib, double perCell, double share
+)
+{
+    std::string row(indent, ' ');
+    row += name;
+    row.resize(std::max(row.size() + 1, nameWidth), ' ');
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%12.4g%12.4g%10.1f", mib, perCell, share);
+    return row + buffer;
+}
+
+}
+
+void MemoryReport::add(const std::string& category, const std::string& name, std::size_t bytes)
+{
+    auto it = std::find_if(
+        entries_.begin(),
+        entries_.end(),
+        [&](const auto& entry) { return entry.category == category && entry.name == name; }
+    );
+    if (it != entries_.end())
+    {
+        it->bytes += bytes;
+        return;
+    }
+    entries_.push_back({category, name, bytes});
+}
+
+std::vector<std::string> MemoryReport::categories() const
+{
+    std::vector<std::string> result;
+    for (const auto& entry : entries_)
+    {
+        if (std::find(result.begin(), result.end(), entry.category) == result.end())
+        {
+            result.push_back(entry.category);
+        }
+    }
+    return result;
+}
+
+std::size_t MemoryReport::bytes() const
+{
+    std::size_t result = 0;
+    for (const auto& entry : entries_)
+    {
+        result += entry.bytes;
+    }
+    return result;
+}
+
+std::size_t MemoryReport::bytes(const std::string& category) const
+{
+    std::size_t result = 0;
+    for (const auto& entry : entries_)
+    {
+        if (entry.category == category)
+        {
+            result += entry.bytes;
+        }
+    }
+    return result;
+}
+
+void MemoryReport::print(std::ostream& os, bool listEntries) const
+{
+    const auto total = static_cast<double>(bytes());
+    const auto nCells = static_cast<double>(std::max<localIdx>(nCells_, 1));
+    const auto row = [&](const std::string& name, std::size_t indent, std::size_t entryBytes)
+    {
+        const auto value = static_cast<double>(entryBytes);
+        const auto share = total > 0.0 ? 100.0 * value / total : 0.0;
+        return formatRow(name, indent, value / (1024.0 * 1024.0), value / nCells, share);
+    };
+
+    std::string header = "Memory of " + std::to_string(nCells_) + " cells";
+    header.resize(std::max(header.size() + 1, nameWidth), ' ');
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%12s%12s%10s", "MiB", "bytes/cell", "%total");
+    os << header << buffer << "\n";
+    for (const auto& category : categories())
+    {
+        os << row(category, 0, bytes(category)) << "\n";
+        for (const auto& entry : entries_)
+        {
+            if (listEntries && entry.category == category)
+            {
+                os << row(entry.name, 2, entry.bytes) << "\n";
+            }
+        }
+    }
+    os << row("total", 0, bytes()) << "\n";
+}
+
+} // namespace NeoN
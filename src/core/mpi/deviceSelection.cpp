@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/mpi/deviceSelection.hpp"
+#include "NeoN/core/mpi/sharedMemory.hpp"
+
+namespace NeoN
+{
+
+namespace mpi
+{
+
+int deviceId(int nodeRank, int nodeSize, int nDevices, DeviceMapping mapping)
+{
+    NF_ASSERT(nodeRank >= 0 && nodeRank < nodeSize, "Invalid node rank " << nodeRank);
+    if (nDevices <= 0)
+    {
+        return -1;
+    }
+    if (mapping == DeviceMapping::block)
+    {
+        // the product does not overflow for any realistic number of ranks and devices per node
+        return static_cast<int>(
+            static_cast<long long>(nodeRank) * nDevices / std::max(nodeSize, 1)
+        );
+    }
+    return nodeRank % nDevices;
+}
+
+int nVisibleDevices()
+{
+    int nDevices = 0;
+#if defined(KOKKOS_ENABLE_CUDA)
+    if (cudaGetDeviceCount(&nDevices) != cudaSuccess)
+    {
+        static_cast<void>(cudaGetLastError());
+        nDevices = 0;
+    }
+#elif defined(KOKKOS_ENABLE_HIP)
+    if (hipGetDeviceCount(&nDevices) != hipSuccess)
+    {
+        static_cast<void>(hipGetLastError());
+        nDevices = 0;
+    }
+#endif
+    return nDevices;
+}
+
+DeviceAssignment selectDevice(const MPIEnvironment& mpiEnviron, DeviceMapping mapping)
+{
+    const SharedMemoryNode node(mpiEnviron);
+    DeviceAssignment assignment;
+    assignment.nodeRank = node.rank();
+    assignment.nodeSize = node.size();
+    assignment.nDevices = nVisibleDevices();
+    assignment.deviceId =
+        deviceId(assignment.nodeRank, assignment.nodeSize, assignment.nDevices, mapping);
+    return assignment;
+}
+
+Kokkos::InitializationSettings initializationSettings(const DeviceAssignment& assignment)
+{
+    Kokkos::InitializationSettings settings;
+    if (assignment.deviceId >= 0)
+    {
+        settings.set_device_id(assignment.deviceId);
+    }
+    return settings;
+}
+
+void reportDevices(
+    const MPIEnvironment& mpiEnviron, const DeviceAssignment& assignment, std::ostream& out
+)
+{
+    char host[MPI_MAX_PROCESSOR_NAME] = {};
+    int hostLength = 0;
+    MPI_Get_processor_name(host, &hostLength);
+
+    const auto nRanks = mpiEnviron.sizeRank();
+    const bool root = mpiEnviron.rank() == 0;
+    std::vector<char> hosts(root ? nRanks * MPI_MAX_PROCESSOR_NAME : 0);
+    MPI_Gather(
+        host,
+        MPI_MAX_PROCESSOR_NAME,
+        MPI_CHAR,
+        hosts.data(),
+        MPI_MAX_PROCESSOR_NAME,
+        MPI_CHAR,
+        0,
+        mpiEnviron.comm()
+    );
+    const int local[3] = {assignment.nodeRank, assignment.nDevices, assignment.deviceId};
+    std::vector<int> all(root ? 3 * nRanks : 0);
+    MPI_Gather(local, 3, MPI_INT, all.data(), 3, MPI_INT, 0, mpiEnviron.comm());
+    if (!root)
+    {
+        return;
+    }
+
+    out << "rank host nodeRank device nDevices\n";
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        const std::string rankHost(&hosts[rank * MPI_MAX_PROCESSOR_NAME]);
+        const auto deviceId = all[3 * rank + 2];
+        bool shared = false;
+        for (size_t other = 0; other < nRanks && deviceId >= 0; other++)
+        {
+            shared |= other != rank && all[3 * other + 2] == deviceId
+                   && rankHost == std::string(&hosts[other * MPI_MAX_PROCESSOR_NAME]);
+        }
+        out << rank << " " << rankHost << " " << all[3 * rank] << " " << deviceId << " "
+            << all[3 * rank + 1] << (shared ? " (shared)" : "") << "\n";
+    }
+    out << std::flush;
+}
+
+}
+
+} // namespace NeoN
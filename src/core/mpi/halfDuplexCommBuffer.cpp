@@ -10,11 +10,163 @@ namespace NeoN
 namespace mpi
 {
 
+HalfDuplexCommBuffer::~HalfDuplexCommBuffer()
+{
+    freePersistent();
+    if (rankBuffer_ != nullptr)
+    {
+        std::visit([this](const auto& exec) { exec.free(rankBuffer_); }, exec_);
+    }
+}
+
+HalfDuplexCommBuffer::HalfDuplexCommBuffer(HalfDuplexCommBuffer&& other) noexcept
+    : tag_(other.tag_), commName_(std::move(other.commName_)), typeSize_(other.typeSize_),
+      mpiEnviron_(other.mpiEnviron_), request_(std::move(other.request_)),
+      neighbours_(std::move(other.neighbours_)), exec_(other.exec_),
+      rankBuffer_(other.rankBuffer_), capacity_(other.capacity_),
+      rankOffset_(std::move(other.rankOffset_)), persistent_(other.persistent_),
+      persistentRequest_(std::move(other.persistentRequest_)),
+      persistentOffset_(std::move(other.persistentOffset_)),
+      persistentBuffer_(other.persistentBuffer_), persistentTag_(other.persistentTag_),
+      persistentSend_(other.persistentSend_),
+      persistentShared_(std::move(other.persistentShared_)), shared_(std::move(other.shared_))
+{
+    other.tag_ = -1;
+    other.rankBuffer_ = nullptr;
+    other.capacity_ = 0;
+    other.persistentRequest_.clear();
+    other.persistentBuffer_ = nullptr;
+}
+
+HalfDuplexCommBuffer& HalfDuplexCommBuffer::operator=(HalfDuplexCommBuffer&& other) noexcept
+{
+    std::swap(tag_, other.tag_);
+    std::swap(commName_, other.commName_);
+    std::swap(typeSize_, other.typeSize_);
+    std::swap(mpiEnviron_, other.mpiEnviron_);
+    std::swap(request_, other.request_);
+    std::swap(neighbours_, other.neighbours_);
+    std::swap(exec_, other.exec_);
+    std::swap(rankBuffer_, other.rankBuffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(rankOffset_, other.rankOffset_);
+    std::swap(persistent_, other.persistent_);
+    std::swap(persistentRequest_, other.persistentRequest_);
+    std::swap(persistentOffset_, other.persistentOffset_);
+    std::swap(persistentBuffer_, other.persistentBuffer_);
+    std::swap(persistentTag_, other.persistentTag_);
+    std::swap(persistentSend_, other.persistentSend_);
+    std::swap(persistentShared_, other.persistentShared_);
+    std::swap(shared_, other.shared_);
+    return *this;
+}
+
+void HalfDuplexCommBuffer::setExecutor(const Executor& exec)
+{
+    NF_DEBUG_ASSERT(
+        !isCommInit(), "Communication buffer was initialised by name: " << commName_ << "."
+    );
+    if (exec == exec_) return;
+    if (rankBuffer_ != nullptr)
+    {
+        std::visit([this](const auto& oldExec) { oldExec.free(rankBuffer_); }, exec_);
+    }
+    exec_ = exec;
+    rankBuffer_ = nullptr;
+    const std::size_t capacity = capacity_;
+    capacity_ = 0;
+    if (capacity > 0) reserve(capacity);
+}
+
+void HalfDuplexCommBuffer::setPersistent(bool persistent)
+{
+    NF_DEBUG_ASSERT(
+        !isCommInit(), "Communication buffer was initialised by name: " << commName_ << "."
+    );
+    if (!persistent) freePersistent();
+    persistent_ = persistent;
+}
+
+void HalfDuplexCommBuffer::startPersistent(bool send)
+{
+    const bool bound = !persistentOffset_.empty() && persistentSend_ == send
+                    && persistentTag_ == tag_ && persistentBuffer_ == rankBuffer_
+                    && persistentOffset_ == rankOffset_ && persistentShared_ == shared_;
+    if (!bound)
+    {
+        freePersistent();
+        for (const auto rank : neighbours_)
+        {
+            if (isShared(rank)) continue;
+            auto& request = persistentRequest_.emplace_back(MPI_REQUEST_NULL);
+            auto size = static_cast<mpi_label_t>(rankOffset_[rank + 1] - rankOffset_[rank]);
+            if (send)
+            {
+                sendInit<char>(
+                    rankBuffer_ + rankOffset_[rank],
+                    size,
+                    static_cast<mpi_label_t>(rank),
+                    tag_,
+                    mpiEnviron_.comm(),
+                    &request
+                );
+            }
+            else
+            {
+                recvInit<char>(
+                    rankBuffer_ + rankOffset_[rank],
+                    size,
+                    static_cast<mpi_label_t>(rank),
+                    tag_,
+                    mpiEnviron_.comm(),
+                    &request
+                );
+            }
+        }
+        persistentOffset_ = rankOffset_;
+        persistentBuffer_ = rankBuffer_;
+        persistentTag_ = tag_;
+        persistentSend_ = send;
+        persistentShared_ = shared_;
+    }
+    if (persistentRequest_.empty()) return;
+    int err = MPI_Startall(static_cast<int>(persistentRequest_.size()), persistentRequest_.data());
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Startall failed.");
+}
+
+void HalfDuplexCommBuffer::freePersistent()
+{
+    for (auto& request : persistentRequest_)
+    {
+        if (request != MPI_REQUEST_NULL) MPI_Request_free(&request);
+    }
+    persistentRequest_.clear();
+    persistentOffset_.clear();
+    persistentBuffer_ = nullptr;
+    persistentTag_ = -1;
+}
+
+void HalfDuplexCommBuffer::reserve(std::size_t dataSize)
+{
+    if (dataSize <= capacity_) return;
+    void* ptr = nullptr;
+    std::visit(
+        [this, &ptr, dataSize](const auto& exec)
+        {
+            ptr = rankBuffer_ == nullptr ? exec.alloc(dataSize)
+                                         : exec.realloc(rankBuffer_, dataSize);
+        },
+        exec_
+    );
+    rankBuffer_ = static_cast<char*>(ptr);
+    capacity_ = dataSize;
+}
+
 bool HalfDuplexCommBuffer::isComplete()
 {
     NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
-    int flag;
-    for (auto& request : request_)
+    int flag = 1;
+    for (auto& request : requests())
     {
         int err = MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
         NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Test failed.");
@@ -27,16 +179,22 @@ void HalfDuplexCommBuffer::send()
 {
     NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
     NF_DEBUG_ASSERT(isComplete(), "Communication buffer is already active.");
-    for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
+    if (persistent_)
     {
-        if (rankOffset_[rank + 1] - rankOffset_[rank] == 0) continue;
+        startPersistent(true);
+        return;
+    }
+    for (size_t i = 0; i < neighbours_.size(); ++i)
+    {
+        const auto rank = neighbours_[i];
+        if (isShared(rank)) continue;
         isend<char>(
-            rankBuffer_.data() + rankOffset_[rank],
+            rankBuffer_ + rankOffset_[rank],
             static_cast<mpi_label_t>(rankOffset_[rank + 1] - rankOffset_[rank]),
             static_cast<mpi_label_t>(rank),
             tag_,
             mpiEnviron_.comm(),
-            &request_[rank]
+            &request_[i]
         );
     }
 }
@@ -45,16 +203,22 @@ void HalfDuplexCommBuffer::receive()
 {
     NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
     NF_DEBUG_ASSERT(isComplete(), "Communication buffer is already active.");
-    for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
+    if (persistent_)
+    {
+        startPersistent(false);
+        return;
+    }
+    for (size_t i = 0; i < neighbours_.size(); ++i)
     {
-        if (rankOffset_[rank + 1] - rankOffset_[rank] == 0) continue;
+        const auto rank = neighbours_[i];
+        if (isShared(rank)) continue;
         irecv<char>(
-            rankBuffer_.data() + rankOffset_[rank],
+            rankBuffer_ + rankOffset_[rank],
             static_cast<mpi_label_t>(rankOffset_[rank + 1] - rankOffset_[rank]),
             static_cast<mpi_label_t>(rank),
             tag_,
             mpiEnviron_.comm(),
-            &request_[rank]
+            &request_[i]
         );
     }
 }
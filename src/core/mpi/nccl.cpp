@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/mpi/nccl.hpp"
+
+#if defined(KOKKOS_ENABLE_CUDA)
+#include <nccl.h>
+#elif defined(KOKKOS_ENABLE_HIP)
+#include <rccl/rccl.h>
+#else
+#error "The NCCL exchange requires the CUDA or the HIP backend of Kokkos."
+#endif
+
+namespace NeoN
+{
+
+namespace mpi
+{
+
+namespace
+{
+
+auto stream(const GPUExecutor& exec)
+{
+#if defined(KOKKOS_ENABLE_CUDA)
+    return exec.underlyingExec().cuda_stream();
+#else
+    return exec.underlyingExec().hip_stream();
+#endif
+}
+
+}
+
+NcclCommunicator::NcclCommunicator(const MPIEnvironment& mpiEnviron)
+{
+    ncclUniqueId id;
+    if (mpiEnviron.rank() == 0)
+    {
+        ncclResult_t result = ncclGetUniqueId(&id);
+        NF_ASSERT(result == ncclSuccess, "ncclGetUniqueId failed: " << ncclGetErrorString(result));
+    }
+    int err = MPI_Bcast(&id, static_cast<int>(sizeof(id)), MPI_BYTE, 0, mpiEnviron.comm());
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Bcast of the NCCL unique id failed.");
+    ncclResult_t result = ncclCommInitRank(
+        &comm_, static_cast<int>(mpiEnviron.sizeRank()), id, static_cast<int>(mpiEnviron.rank())
+    );
+    NF_ASSERT(result == ncclSuccess, "ncclCommInitRank failed: " << ncclGetErrorString(result));
+}
+
+NcclCommunicator::~NcclCommunicator()
+{
+    if (comm_ != nullptr) ncclCommDestroy(comm_);
+}
+
+void NcclCommunicator::startExchange(
+    HalfDuplexCommBuffer& send, HalfDuplexCommBuffer& receive, const GPUExecutor& exec
+) const
+{
+    NF_DEBUG_ASSERT(
+        std::holds_alternative<GPUExecutor>(send.exec())
+            && std::holds_alternative<GPUExecutor>(receive.exec()),
+        "The NCCL exchange requires device resident buffers."
+    );
+    const auto execStream = stream(exec);
+    const auto& sendOffsets = send.rankOffsets();
+    const auto& receiveOffsets = receive.rankOffsets();
+    ncclGroupStart();
+    for (const auto rank : send.neighbours())
+    {
+        ncclSend(
+            send.data() + sendOffsets[rank],
+            sendOffsets[rank + 1] - sendOffsets[rank],
+            ncclChar,
+            static_cast<int>(rank),
+            comm_,
+            execStream
+        );
+    }
+    for (const auto rank : receive.neighbours())
+    {
+        ncclRecv(
+            receive.data() + receiveOffsets[rank],
+            receiveOffsets[rank + 1] - receiveOffsets[rank],
+            ncclChar,
+            static_cast<int>(rank),
+            comm_,
+            execStream
+        );
+    }
+    ncclResult_t result = ncclGroupEnd();
+    NF_DEBUG_ASSERT(result == ncclSuccess, "ncclGroupEnd failed: " << ncclGetErrorString(result));
+}
+
+}
+
+} // namespace NeoN
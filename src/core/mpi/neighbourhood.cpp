@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/mpi/neighbourhood.hpp"
+
+namespace NeoN
+{
+
+namespace mpi
+{
+
+namespace
+{
+
+std::vector<int> nonEmptyRanks(const std::vector<std::size_t>& rankSize)
+{
+    std::vector<int> ranks;
+    for (size_t rank = 0; rank < rankSize.size(); ++rank)
+    {
+        if (rankSize[rank] != 0) ranks.push_back(static_cast<int>(rank));
+    }
+    return ranks;
+}
+
+/* @brief the message counts and displacements (in bytes) of the given ranks */
+void countsAndDispls(
+    const std::vector<std::size_t>& rankOffsets,
+    const std::vector<int>& ranks,
+    std::vector<int>& counts,
+    std::vector<int>& displs
+)
+{
+    counts.resize(ranks.size());
+    displs.resize(ranks.size());
+    for (size_t i = 0; i < ranks.size(); ++i)
+    {
+        const auto rank = static_cast<size_t>(ranks[i]);
+        counts[i] = static_cast<int>(rankOffsets[rank + 1] - rankOffsets[rank]);
+        displs[i] = static_cast<int>(rankOffsets[rank]);
+    }
+}
+
+}
+
+NeighbourhoodTopology::NeighbourhoodTopology(
+    const MPIEnvironment& mpiEnviron,
+    const std::vector<std::size_t>& sendSize,
+    const std::vector<std::size_t>& receiveSize
+)
+    : sources_(nonEmptyRanks(receiveSize)), destinations_(nonEmptyRanks(sendSize))
+{
+    NF_ASSERT_EQUAL(sendSize.size(), mpiEnviron.sizeRank());
+    NF_ASSERT_EQUAL(receiveSize.size(), mpiEnviron.sizeRank());
+    int err = MPI_Dist_graph_create_adjacent(
+        mpiEnviron.comm(),
+        static_cast<int>(sources_.size()),
+        sources_.data(),
+        MPI_UNWEIGHTED,
+        static_cast<int>(destinations_.size()),
+        destinations_.data(),
+        MPI_UNWEIGHTED,
+        MPI_INFO_NULL,
+        0, // keep the rank numbering of the maps
+        &graphComm_
+    );
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Dist_graph_create_adjacent failed.");
+}
+
+NeighbourhoodTopology::~NeighbourhoodTopology()
+{
+    if (graphComm_ != MPI_COMM_NULL) MPI_Comm_free(&graphComm_);
+}
+
+void NeighbourhoodTopology::startExchange(
+    HalfDuplexCommBuffer& send, HalfDuplexCommBuffer& receive, NeighbourhoodExchange& exchange
+) const
+{
+    NF_DEBUG_ASSERT(send.neighbours().size() == destinations_.size(), "Send layout mismatch.");
+    NF_DEBUG_ASSERT(receive.neighbours().size() == sources_.size(), "Receive layout mismatch.");
+    // the counts are recomputed per exchange as the value type of the buffers may change
+    countsAndDispls(send.rankOffsets(), destinations_, exchange.sendCounts, exchange.sendDispls);
+    countsAndDispls(
+        receive.rankOffsets(), sources_, exchange.receiveCounts, exchange.receiveDispls
+    );
+    int err = MPI_Ineighbor_alltoallv(
+        send.data(),
+        exchange.sendCounts.data(),
+        exchange.sendDispls.data(),
+        MPI_CHAR,
+        receive.data(),
+        exchange.receiveCounts.data(),
+        exchange.receiveDispls.data(),
+        MPI_CHAR,
+        graphComm_,
+        &exchange.request
+    );
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Ineighbor_alltoallv failed.");
+}
+
+}
+
+} // namespace NeoN
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/mpi/progress.hpp"
+
+namespace NeoN
+{
+
+namespace mpi
+{
+
+ProgressThread::ProgressThread(
+    const MPIEnvironment& mpiEnviron, std::chrono::microseconds interval
+)
+{
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    NF_ASSERT(
+        provided == MPI_THREAD_MULTIPLE,
+        "The MPI progress thread requires MPI to be initialized with MPI_THREAD_MULTIPLE."
+    );
+    int err = MPI_Comm_dup(mpiEnviron.comm(), &comm_);
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Comm_dup failed.");
+    thread_ = std::thread(
+        [this, interval]()
+        {
+            while (!stop_.load(std::memory_order_relaxed))
+            {
+                int flag = 0;
+                MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm_, &flag, MPI_STATUS_IGNORE);
+                probes_.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(interval);
+            }
+        }
+    );
+}
+
+ProgressThread::~ProgressThread()
+{
+    stop_.store(true, std::memory_order_relaxed);
+    if (thread_.joinable()) thread_.join();
+    if (comm_ != MPI_COMM_NULL) MPI_Comm_free(&comm_);
+}
+
+}
+
+} // namespace NeoN
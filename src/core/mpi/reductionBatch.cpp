@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+
+#include "NeoN/core/mpi/reductionBatch.hpp"
+
+namespace NeoN::mpi
+{
+
+namespace
+{
+
+/* @brief the attribute key holding the operations of a batch datatype */
+int opsKeyval()
+{
+    static const int keyval = []()
+    {
+        int key = MPI_KEYVAL_INVALID;
+        MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN, MPI_TYPE_NULL_DELETE_FN, &key, nullptr);
+        return key;
+    }();
+    return keyval;
+}
+
+scalar combine(const ReduceOp op, const scalar a, const scalar b)
+{
+    switch (op)
+    {
+    case ReduceOp::Max:
+        return std::max(a, b);
+    case ReduceOp::Min:
+        return std::min(a, b);
+    case ReduceOp::Sum:
+        return a + b;
+    default:
+        return a * b;
+    }
+}
+
+/* @brief the user defined operation, applies the operation of every value of the batch */
+void reduceBatch(void* in, void* inout, int* len, MPI_Datatype* type)
+{
+    void* attribute = nullptr;
+    int found = 0;
+    MPI_Type_get_attr(*type, opsKeyval(), &attribute, &found);
+    NF_ASSERT(found, "The datatype is not the datatype of a reduction batch.");
+    const auto& ops = *static_cast<const std::vector<ReduceOp>*>(attribute);
+    const auto* a = static_cast<const scalar*>(in);
+    auto* b = static_cast<scalar*>(inout);
+    for (int k = 0; k < *len; k++)
+    {
+        for (const auto op : ops)
+        {
+            *b = combine(op, *a++, *b);
+            b++;
+        }
+    }
+}
+
+}
+
+ReductionBatch::ReductionBatch(MPI_Comm comm)
+    : comm_(comm), values_(), ops_(), typeOps_(), type_(MPI_DATATYPE_NULL), op_(MPI_OP_NULL),
+      request_(MPI_REQUEST_NULL), nReductions_(0)
+{}
+
+ReductionBatch::~ReductionBatch()
+{
+    if (pending())
+    {
+        wait();
+    }
+    if (type_ != MPI_DATATYPE_NULL)
+    {
+        MPI_Type_free(&type_);
+    }
+    if (op_ != MPI_OP_NULL)
+    {
+        MPI_Op_free(&op_);
+    }
+}
+
+std::size_t ReductionBatch::add(scalar value, ReduceOp op)
+{
+    NF_ASSERT(!pending(), "The batch can not be modified during a reduction.");
+    NF_ASSERT(
+        op == ReduceOp::Max || op == ReduceOp::Min || op == ReduceOp::Sum || op == ReduceOp::Prod,
+        "Only Max, Min, Sum and Prod can be batched."
+    );
+    values_.push_back(value);
+    ops_.push_back(op);
+    return values_.size() - 1;
+}
+
+std::size_t ReductionBatch::add(const Vec3& vector, ReduceOp op)
+{
+    const auto i = add(vector[0], op);
+    add(vector[1], op);
+    add(vector[2], op);
+    return i;
+}
+
+std::tuple<MPI_Datatype, MPI_Op, int> ReductionBatch::typeAndOp()
+{
+    // a batch of a single operation reduces the scalars with the predefined operation
+    if (std::all_of(ops_.begin(), ops_.end(), [&](ReduceOp op) { return op == ops_[0]; }))
+    {
+        return {getType<scalar>(), getOp(ops_[0]), static_cast<int>(values_.size())};
+    }
+    if (op_ == MPI_OP_NULL)
+    {
+        MPI_Op_create(reduceBatch, 1, &op_);
+    }
+    if (type_ == MPI_DATATYPE_NULL || typeOps_ != ops_)
+    {
+        if (type_ != MPI_DATATYPE_NULL)
+        {
+            MPI_Type_free(&type_);
+        }
+        typeOps_ = ops_;
+        MPI_Type_contiguous(static_cast<int>(ops_.size()), getType<scalar>(), &type_);
+        MPI_Type_commit(&type_);
+        MPI_Type_set_attr(type_, opsKeyval(), &typeOps_);
+    }
+    return {type_, op_, 1};
+}
+
+void ReductionBatch::reduce()
+{
+    start();
+    wait();
+}
+
+void ReductionBatch::start()
+{
+    NF_ASSERT(!pending(), "A reduction of the batch is pending.");
+    if (values_.empty())
+    {
+        return;
+    }
+    const auto [type, op, count] = typeAndOp();
+    const auto err =
+        MPI_Iallreduce(MPI_IN_PLACE, values_.data(), count, type, op, comm_, &request_);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Iallreduce failed.");
+    nReductions_++;
+}
+
+void ReductionBatch::wait()
+{
+    if (pending())
+    {
+        mpi::wait(&request_);
+    }
+}
+
+scalar ReductionBatch::value(std::size_t i) const
+{
+    NF_ASSERT(!pending(), "The values are not available during a reduction.");
+    NF_ASSERT(i < values_.size(), "The value " << i << " is not in the batch.");
+    return values_[i];
+}
+
+Vec3 ReductionBatch::vec3(std::size_t i) const
+{
+    return Vec3(value(i), value(i + 1), value(i + 2));
+}
+
+void ReductionBatch::clear()
+{
+    NF_ASSERT(!pending(), "The batch can not be modified during a reduction.");
+    values_.clear();
+    ops_.clear();
+}
+
+} // namespace NeoN::mpi
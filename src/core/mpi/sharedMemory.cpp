@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+
+#include "NeoN/core/mpi/sharedMemory.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
+
+namespace NeoN
+{
+
+namespace mpi
+{
+
+namespace
+{
+
+/* @brief the header of a slot, padded to a cache line to keep the counters of the slots apart */
+constexpr std::size_t headerBytes = 64;
+
+constexpr std::size_t ready = 0;
+constexpr std::size_t consumed = 1;
+constexpr std::size_t capacity = 2;
+
+constexpr std::uint64_t noSlot = std::numeric_limits<std::uint64_t>::max();
+
+std::size_t roundUp(std::size_t bytes)
+{
+    return (bytes + headerBytes - 1) / headerBytes * headerBytes;
+}
+
+std::uint64_t load(std::uint64_t* counter)
+{
+    return std::atomic_ref<std::uint64_t>(*counter).load(std::memory_order_acquire);
+}
+
+void store(std::uint64_t* counter, std::uint64_t value)
+{
+    std::atomic_ref<std::uint64_t>(*counter).store(value, std::memory_order_release);
+}
+
+std::size_t messageBytes(const HalfDuplexCommBuffer& buffer, std::size_t rank)
+{
+    const auto& rankOffsets = buffer.rankOffsets();
+    return rankOffsets[rank + 1] - rankOffsets[rank];
+}
+
+}
+
+SharedMemoryNode::SharedMemoryNode(const MPIEnvironment& mpiEnviron)
+    : nodeRanks_(mpiEnviron.sizeRank(), MPI_UNDEFINED)
+{
+    int err = MPI_Comm_split_type(
+        mpiEnviron.comm(), MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm_
+    );
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Comm_split_type failed.");
+
+    MPI_Group group;
+    MPI_Group nodeGroup;
+    MPI_Comm_group(mpiEnviron.comm(), &group);
+    MPI_Comm_group(nodeComm_, &nodeGroup);
+    std::vector<int> ranks(mpiEnviron.sizeRank());
+    std::iota(ranks.begin(), ranks.end(), 0);
+    err = MPI_Group_translate_ranks(
+        group, static_cast<int>(ranks.size()), ranks.data(), nodeGroup, nodeRanks_.data()
+    );
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Group_translate_ranks failed.");
+    MPI_Group_free(&group);
+    MPI_Group_free(&nodeGroup);
+}
+
+SharedMemoryNode::~SharedMemoryNode()
+{
+    if (nodeComm_ != MPI_COMM_NULL) MPI_Comm_free(&nodeComm_);
+}
+
+int SharedMemoryNode::rank() const
+{
+    int nodeRank = 0;
+    MPI_Comm_rank(nodeComm_, &nodeRank);
+    return nodeRank;
+}
+
+int SharedMemoryNode::size() const
+{
+    int nodeSize = 0;
+    MPI_Comm_size(nodeComm_, &nodeSize);
+    return nodeSize;
+}
+
+SharedMemoryWindow::SharedMemoryWindow(
+    const SharedMemoryNode& node,
+    const HalfDuplexCommBuffer& send,
+    const HalfDuplexCommBuffer& receive,
+    std::size_t entryBytes
+)
+{
+    const auto& nodeRanks = node.nodeRanks();
+    int nodeSize = 0;
+    MPI_Comm_size(node.comm(), &nodeSize);
+
+    // the slots of this rank, sized for messages of entries of up to entryBytes
+    std::vector<std::uint64_t> slotOffsets(static_cast<size_t>(nodeSize), noSlot);
+    std::size_t segmentBytes = 0;
+    for (const auto rank : send.neighbours())
+    {
+        if (nodeRanks[rank] == MPI_UNDEFINED) continue;
+        const auto bytes = messageBytes(send, rank);
+        const auto slotCapacity = roundUp(std::max(bytes, bytes / send.typeSize() * entryBytes));
+        slotOffsets[static_cast<size_t>(nodeRanks[rank])] = segmentBytes;
+        sendSlots_.push_back({rank, nullptr, slotCapacity});
+        segmentBytes += headerBytes + slotCapacity;
+    }
+
+    // the segments need not be contiguous, which allows to place them close to their rank
+    MPI_Info info;
+    MPI_Info_create(&info);
+    MPI_Info_set(info, "alloc_shared_noncontig", "true");
+    char* base = nullptr;
+    int err = MPI_Win_allocate_shared(
+        static_cast<MPI_Aint>(segmentBytes), 1, info, node.comm(), &base, &win_
+    );
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Win_allocate_shared failed.");
+    MPI_Info_free(&info);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+
+    for (auto& slot : sendSlots_)
+    {
+        slot.header = reinterpret_cast<std::uint64_t*>(
+            base + slotOffsets[static_cast<size_t>(nodeRanks[slot.rank])]
+        );
+        slot.header[ready] = 0;
+        slot.header[consumed] = 0;
+        slot.header[capacity] = slot.capacity;
+    }
+    MPI_Win_sync(win_);
+
+    // every source tells its destinations where their slot starts, this also orders the
+    // initialisation of the headers before their first read
+    std::vector<std::uint64_t> sourceOffsets(static_cast<size_t>(nodeSize), noSlot);
+    err = MPI_Alltoall(
+        slotOffsets.data(), 1, MPI_UINT64_T, sourceOffsets.data(), 1, MPI_UINT64_T, node.comm()
+    );
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Alltoall failed.");
+    MPI_Win_sync(win_);
+
+    for (const auto rank : receive.neighbours())
+    {
+        if (nodeRanks[rank] == MPI_UNDEFINED) continue;
+        const auto offset = sourceOffsets[static_cast<size_t>(nodeRanks[rank])];
+        NF_ASSERT(offset != noSlot, "Rank " << rank << " sends no message to this rank.");
+        MPI_Aint size = 0;
+        int dispUnit = 0;
+        char* sourceBase = nullptr;
+        MPI_Win_shared_query(win_, nodeRanks[rank], &size, &dispUnit, &sourceBase);
+        auto* header = reinterpret_cast<std::uint64_t*>(sourceBase + offset);
+        receiveSlots_.push_back({rank, header, static_cast<std::size_t>(header[capacity])});
+    }
+    pending_.assign(receiveSlots_.size(), false);
+    sendShared_.assign(send.rankOffsets().size() - 1, false);
+    receiveShared_.assign(receive.rankOffsets().size() - 1, false);
+}
+
+SharedMemoryWindow::~SharedMemoryWindow()
+{
+    if (win_ != MPI_WIN_NULL)
+    {
+        MPI_Win_unlock_all(win_);
+        MPI_Win_free(&win_);
+    }
+}
+
+void SharedMemoryWindow::startExchange(HalfDuplexCommBuffer& send, HalfDuplexCommBuffer& receive)
+{
+    for (const auto& slot : sendSlots_)
+    {
+        const auto bytes = messageBytes(send, slot.rank);
+        sendShared_[slot.rank] = bytes <= slot.capacity;
+        if (!sendShared_[slot.rank]) continue;
+        // the previous message has to be consumed before the slot is overwritten
+        const auto sequence = slot.header[ready];
+        while (load(slot.header + consumed) != sequence)
+        {
+            MPI_Win_sync(win_);
+        }
+        auto* data = reinterpret_cast<char*>(slot.header) + headerBytes;
+        std::visit(
+            detail::deepCopyVisitor(
+                static_cast<localIdx>(bytes), send.data() + send.rankOffsets()[slot.rank], data
+            ),
+            send.exec(),
+            Executor(SerialExecutor {})
+        );
+        MPI_Win_sync(win_);
+        store(slot.header + ready, sequence + 1);
+    }
+    for (size_t i = 0; i < receiveSlots_.size(); ++i)
+    {
+        const auto& slot = receiveSlots_[i];
+        receiveShared_[slot.rank] = messageBytes(receive, slot.rank) <= slot.capacity;
+        pending_[i] = receiveShared_[slot.rank];
+    }
+    send.setSharedRanks(sendShared_);
+    receive.setSharedRanks(receiveShared_);
+}
+
+bool SharedMemoryWindow::testExchange(HalfDuplexCommBuffer& receive)
+{
+    bool complete = true;
+    for (size_t i = 0; i < receiveSlots_.size(); ++i)
+    {
+        if (!pending_[i]) continue;
+        const auto& slot = receiveSlots_[i];
+        const auto sequence = slot.header[consumed];
+        if (load(slot.header + ready) == sequence)
+        {
+            MPI_Win_sync(win_);
+            complete = false;
+            continue;
+        }
+        MPI_Win_sync(win_);
+        const auto* data = reinterpret_cast<const char*>(slot.header) + headerBytes;
+        std::visit(
+            detail::deepCopyVisitor(
+                static_cast<localIdx>(messageBytes(receive, slot.rank)),
+                data,
+                receive.data() + receive.rankOffsets()[slot.rank]
+            ),
+            Executor(SerialExecutor {}),
+            receive.exec()
+        );
+        store(slot.header + consumed, sequence + 1);
+        pending_[i] = false;
+    }
+    return complete;
+}
+
+}
+
+} // namespace NeoN
@@ -3,10 +3,17 @@
 // SPDX-License-Identifier: MIT
 
 #include "NeoN/core/time.hpp"
+#include "NeoN/core/timer.hpp"
 
 namespace NeoN
 {
 
 const std::string Time::CONTROL_DICT_NAME = "system/controlDict";
 
+std::ostream& Time::printExecutionTime(std::ostream& os) const
+{
+    TimerRegistry::instance().report(os);
+    return os;
+}
+
 }
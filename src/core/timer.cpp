@@ -0,0 +1,352 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/timer.hpp"
+
+namespace NeoN
+{
+
+thread_local TimerRegistry::Node* TimerRegistry::current_ = nullptr;
+
+namespace
+{
+
+constexpr std::size_t nameWidth = 48;
+
+std::string formatName(const std::string& name, std::size_t depth)
+{
+    std::string row(2 * depth, ' ');
+    row += name;
+    row.resize(std::max(row.size() + 1, nameWidth), ' ');
+    return row;
+}
+
+std::string formatHeader(const std::vector<std::string>& cols)
+{
+    auto row = formatName("Timer", 0);
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%10s", "calls");
+    row += buffer;
+    for (const auto& col : cols)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%12s", col.c_str());
+        row += buffer;
+    }
+    return row;
+}
+
+std::string formatRow(
+    const std::string& name, std::size_t depth, std::size_t calls, const std::vector<double>& cols
+)
+{
+    auto row = formatName(name, depth);
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%10zu", calls);
+    row += buffer;
+    for (auto col : cols)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%12.4g", col);
+        row += buffer;
+    }
+    return row;
+}
+
+std::string formatCounter(
+    const std::string& name, std::size_t depth, const std::vector<double>& cols
+)
+{
+    auto row = formatName("[" + name + "]", depth);
+    row += std::string(10, ' ');
+    char buffer[32];
+    for (auto col : cols)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%12.4g", col);
+        row += buffer;
+    }
+    return row;
+}
+
+std::string lastName(const std::string& path)
+{
+    const auto pos = path.rfind('/');
+    return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+}
+
+TimerRegistry& TimerRegistry::instance()
+{
+    static TimerRegistry registry;
+    return registry;
+}
+
+TimerRegistry::TimerRegistry() : root_ {"", nullptr, 0, 0.0, 0.0, {}, {}} {}
+
+void TimerRegistry::start(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto* parent = current_ ? current_ : &root_;
+    auto child = std::find_if(
+        parent->children.begin(),
+        parent->children.end(),
+        [&](const auto& node) { return node->name == name; }
+    );
+    if (child == parent->children.end())
+    {
+        parent->children.push_back(
+            std::make_unique<Node>(Node {name, parent, 0, 0.0, 0.0, {}, {}})
+        );
+        child = parent->children.end() - 1;
+    }
+    current_ = child->get();
+}
+
+void TimerRegistry::stop(double seconds)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    NF_ASSERT(current_ != nullptr, "No timer is running on this thread.");
+    auto* node = current_;
+    node->calls++;
+    node->total += seconds;
+    node->max = std::max(node->max, seconds);
+    current_ = node->parent == &root_ ? nullptr : node->parent;
+}
+
+void TimerRegistry::count(const std::string& name, double value)
+{
+    if (!enabled())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto* node = current_ ? current_ : &root_;
+    auto counter = std::find_if(
+        node->counters.begin(),
+        node->counters.end(),
+        [&](const auto& entry) { return entry.first == name; }
+    );
+    if (counter == node->counters.end())
+    {
+        node->counters.emplace_back(name, value);
+        return;
+    }
+    counter->second += value;
+}
+
+std::vector<TimerStats> TimerRegistry::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TimerStats> result;
+    auto collect = [&](auto& self, const Node& node, const std::string& path, std::size_t depth,
+                       double topTotal) -> void
+    {
+        for (const auto& child : node.children)
+        {
+            const auto childPath = path.empty() ? child->name : path + "/" + child->name;
+            const auto top = depth == 0 ? child->total : topTotal;
+            result.push_back(TimerStats {
+                childPath,
+                depth,
+                child->calls,
+                child->total,
+                child->max,
+                top > 0.0 ? child->total / top : 0.0,
+                child->counters
+            });
+            self(self, *child, childPath, depth + 1, top);
+        }
+    };
+    collect(collect, root_, "", 0, 0.0);
+    return result;
+}
+
+void TimerRegistry::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    NF_ASSERT(current_ == nullptr, "Timers can not be reset while a timer is running.");
+    root_.children.clear();
+    root_.counters.clear();
+}
+
+void TimerRegistry::report(std::ostream& os) const
+{
+    os << formatHeader({"total[s]", "mean[ms]", "max[ms]", "%step"}) << "\n";
+    for (const auto& timer : stats())
+    {
+        const auto calls = static_cast<double>(std::max<std::size_t>(timer.calls, 1));
+        os << formatRow(
+            lastName(timer.path),
+            timer.depth,
+            timer.calls,
+            {timer.total, 1e3 * timer.total / calls, 1e3 * timer.max, 100.0 * timer.fraction}
+        ) << "\n";
+        for (const auto& [name, value] : timer.counters)
+        {
+            os << formatCounter(name, timer.depth + 1, {value}) << "\n";
+        }
+    }
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+void TimerRegistry::report(std::ostream& os, MPI_Comm comm) const
+{
+    int rank = 0;
+    int nRanks = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nRanks);
+
+    // the timers of the first rank are looked up on all ranks by their paths, the counters of a
+    // timer follow its path as lines starting with a tab
+    const auto local = stats();
+    std::string paths;
+    if (rank == 0)
+    {
+        for (const auto& timer : local)
+        {
+            paths += timer.path + '\n';
+            for (const auto& counter : timer.counters)
+            {
+                paths += '\t' + counter.first + '\n';
+            }
+        }
+    }
+    auto length = static_cast<unsigned long>(paths.size());
+    MPI_Bcast(&length, 1, MPI_UNSIGNED_LONG, 0, comm);
+    paths.resize(length);
+    MPI_Bcast(paths.data(), static_cast<int>(length), MPI_CHAR, 0, comm);
+
+    std::vector<std::string> timerPaths;
+    std::vector<std::pair<std::size_t, std::string>> counterNames; // timer index and name
+    std::size_t begin = 0;
+    for (auto end = paths.find('\n'); end != std::string::npos; end = paths.find('\n', begin))
+    {
+        if (paths[begin] == '\t')
+        {
+            const auto name = paths.substr(begin + 1, end - begin - 1);
+            counterNames.emplace_back(timerPaths.size() - 1, name);
+        }
+        else
+        {
+            timerPaths.push_back(paths.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+    const auto nTimers = timerPaths.size();
+    std::vector<double> totals(nTimers, 0.0);
+    std::vector<double> maxs(nTimers, 0.0);
+    std::vector<double> calls(nTimers, 0.0);
+    for (std::size_t i = 0; i < nTimers; i++)
+    {
+        auto timer = std::find_if(
+            local.begin(), local.end(), [&](const auto& t) { return t.path == timerPaths[i]; }
+        );
+        if (timer != local.end())
+        {
+            totals[i] = timer->total;
+            maxs[i] = timer->max;
+            calls[i] = static_cast<double>(timer->calls);
+        }
+    }
+    const auto nCounters = counterNames.size();
+    std::vector<double> counts(nCounters, 0.0);
+    for (std::size_t i = 0; i < nCounters; i++)
+    {
+        const auto& [timeri, name] = counterNames[i];
+        auto timer = std::find_if(
+            local.begin(), local.end(), [&](const auto& t) { return t.path == timerPaths[timeri]; }
+        );
+        if (timer == local.end())
+        {
+            continue;
+        }
+        auto counter = std::find_if(
+            timer->counters.begin(),
+            timer->counters.end(),
+            [&](const auto& entry) { return entry.first == name; }
+        );
+        if (counter != timer->counters.end())
+        {
+            counts[i] = counter->second;
+        }
+    }
+    const auto n = static_cast<int>(nTimers);
+    const auto nc = static_cast<int>(nCounters);
+    std::vector<double> minTotals(nTimers), sumTotals(nTimers), maxTotals(nTimers);
+    std::vector<double> maxMaxs(nTimers), sumCalls(nTimers);
+    MPI_Reduce(totals.data(), minTotals.data(), n, MPI_DOUBLE, MPI_MIN, 0, comm);
+    MPI_Reduce(totals.data(), sumTotals.data(), n, MPI_DOUBLE, MPI_SUM, 0, comm);
+    MPI_Reduce(totals.data(), maxTotals.data(), n, MPI_DOUBLE, MPI_MAX, 0, comm);
+    MPI_Reduce(maxs.data(), maxMaxs.data(), n, MPI_DOUBLE, MPI_MAX, 0, comm);
+    MPI_Reduce(calls.data(), sumCalls.data(), n, MPI_DOUBLE, MPI_SUM, 0, comm);
+    std::vector<double> minCounts(nCounters), sumCounts(nCounters), maxCounts(nCounters);
+    MPI_Reduce(counts.data(), minCounts.data(), nc, MPI_DOUBLE, MPI_MIN, 0, comm);
+    MPI_Reduce(counts.data(), sumCounts.data(), nc, MPI_DOUBLE, MPI_SUM, 0, comm);
+    MPI_Reduce(counts.data(), maxCounts.data(), nc, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (rank != 0)
+    {
+        return;
+    }
+
+    os << formatHeader({"min tot[s]", "avg tot[s]", "max tot[s]", "mean[ms]", "max[ms]", "%step"})
+       << "\n";
+    double topTotal = 0.0;
+    std::size_t counteri = 0;
+    for (std::size_t i = 0; i < nTimers; i++)
+    {
+        const auto avgTotal = sumTotals[i] / static_cast<double>(nRanks);
+        if (local[i].depth == 0)
+        {
+            topTotal = avgTotal;
+        }
+        const auto avgCalls = sumCalls[i] / static_cast<double>(nRanks);
+        os << formatRow(
+            lastName(timerPaths[i]),
+            local[i].depth,
+            local[i].calls,
+            {minTotals[i],
+             avgTotal,
+             maxTotals[i],
+             avgCalls > 0.0 ? 1e3 * avgTotal / avgCalls : 0.0,
+             1e3 * maxMaxs[i],
+             topTotal > 0.0 ? 100.0 * avgTotal / topTotal : 0.0}
+        ) << "\n";
+        for (; counteri < nCounters && counterNames[counteri].first == i; counteri++)
+        {
+            os << formatCounter(
+                counterNames[counteri].second,
+                local[i].depth + 1,
+                {minCounts[counteri],
+                 sumCounts[counteri] / static_cast<double>(nRanks),
+                 maxCounts[counteri]}
+            ) << "\n";
+        }
+    }
+}
+#endif
+
+void TimerRegistry::finalize() const
+{
+    if (!reportAtFinalize_)
+    {
+        return;
+    }
+#ifdef NF_WITH_MPI_SUPPORT
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (initialized)
+    {
+        report(std::cout, MPI_COMM_WORLD);
+        return;
+    }
+#endif
+    report(std::cout);
+}
+
+} // namespace NeoN
@@ -40,4 +40,6 @@ void TokenList::remove(size_t index)
 
 [[nodiscard]] std::vector<std::any>& TokenList::tokens() { return data_; }
 
+[[nodiscard]] const std::vector<std::any>& TokenList::tokens() const { return data_; }
+
 } // namespace NeoN
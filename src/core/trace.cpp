@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/trace.hpp"
+
+namespace NeoN
+{
+
+namespace
+{
+
+std::string escapeJson(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+            result += buffer;
+        }
+        else
+        {
+            result += c;
+        }
+    }
+    return result;
+}
+
+std::string categoryOf(const std::string& name)
+{
+    const auto pos = name.find("::");
+    return pos == std::string::npos ? "timer" : name.substr(0, pos);
+}
+
+void writeEvents(std::ostream& os, const std::vector<TraceEvent>& events, int pid, bool& first)
+{
+    char buffer[128];
+    for (const auto& event : events)
+    {
+        std::snprintf(
+            buffer,
+            sizeof(buffer),
+            "\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%zu}",
+            event.begin,
+            event.duration,
+            pid,
+            event.thread
+        );
+        os << (first ? "\n" : ",\n") << "{\"name\":\"" << escapeJson(event.name)
+           << "\",\"cat\":\"" << escapeJson(event.category) << "\"," << buffer;
+        first = false;
+    }
+}
+
+}
+
+TraceRecorder& TraceRecorder::instance()
+{
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::enable(bool kernels, const std::string& fileName)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fileName_ = fileName;
+        written_ = false;
+    }
+    if (kernels)
+    {
+        NF_ASSERT(Kokkos::is_initialized(), "Kokkos must be initialized to record kernels.");
+        installKernelCallbacks();
+    }
+    if (!finalizeHook_ && Kokkos::is_initialized())
+    {
+        Kokkos::push_finalize_hook([]() { TraceRecorder::instance().finalize(); });
+        finalizeHook_ = true;
+    }
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void TraceRecorder::disable()
+{
+    enabled_.store(false, std::memory_order_relaxed);
+    if (kernelCallbacks_)
+    {
+        namespace tools = Kokkos::Tools::Experimental;
+        tools::set_begin_parallel_for_callback(nullptr);
+        tools::set_end_parallel_for_callback(nullptr);
+        tools::set_begin_parallel_reduce_callback(nullptr);
+        tools::set_end_parallel_reduce_callback(nullptr);
+        tools::set_begin_parallel_scan_callback(nullptr);
+        tools::set_end_parallel_scan_callback(nullptr);
+        kernelCallbacks_ = false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+}
+
+double TraceRecorder::now()
+{
+    const std::chrono::duration<double, std::micro> time =
+        std::chrono::system_clock::now().time_since_epoch();
+    return time.count();
+}
+
+void TraceRecorder::record(const std::string& name, double begin, double end)
+{
+    const auto thread = threadIndex();
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back(TraceEvent {name, categoryOf(name), begin, end - begin, thread});
+}
+
+std::vector<TraceEvent> TraceRecorder::events() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_;
+}
+
+void TraceRecorder::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+}
+
+void TraceRecorder::write(std::ostream& os) const
+{
+    bool first = true;
+    os << "{\"traceEvents\":[";
+    writeEvents(os, events(), 0, first);
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+void TraceRecorder::write(std::ostream& os, MPI_Comm comm) const
+{
+    int rank = 0;
+    int nRanks = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nRanks);
+
+    // every rank serializes its events, which are gathered as text on the first rank
+    std::stringstream local;
+    bool first = rank == 0;
+    writeEvents(local, events(), rank, first);
+    const auto text = local.str();
+    auto length = static_cast<int>(text.size());
+    std::vector<int> lengths(static_cast<std::size_t>(nRanks), 0);
+    MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, comm);
+
+    std::vector<int> offsets(static_cast<std::size_t>(nRanks), 0);
+    std::string merged;
+    if (rank == 0)
+    {
+        int total = 0;
+        for (std::size_t i = 0; i < lengths.size(); i++)
+        {
+            offsets[i] = total;
+            total += lengths[i];
+        }
+        merged.resize(static_cast<std::size_t>(total));
+    }
+    MPI_Gatherv(
+        text.data(),
+        length,
+        MPI_CHAR,
+        merged.data(),
+        lengths.data(),
+        offsets.data(),
+        MPI_CHAR,
+        0,
+        comm
+    );
+    if (rank != 0)
+    {
+        return;
+    }
+    // the events of the first rank may be empty, hence a leading comma is removed
+    if (!merged.empty() && merged[0] == ',')
+    {
+        merged.erase(0, 1);
+    }
+    os << "{\"traceEvents\":[" << merged << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+#endif
+
+void TraceRecorder::finalize()
+{
+    std::string fileName;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (written_ || fileName_.empty())
+        {
+            return;
+        }
+        written_ = true;
+        fileName = fileName_;
+    }
+    disable();
+#ifdef NF_WITH_MPI_SUPPORT
+    int initialized = 0;
+    int finalized = 0;
+    MPI_Initialized(&initialized);
+    MPI_Finalized(&finalized);
+    if (initialized && !finalized)
+    {
+        int rank = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        std::stringstream trace;
+        write(trace, MPI_COMM_WORLD);
+        if (rank == 0)
+        {
+            std::ofstream(fileName) << trace.str();
+        }
+        return;
+    }
+#endif
+    std::ofstream file(fileName);
+    write(file);
+}
+
+std::size_t TraceRecorder::threadIndex()
+{
+    static std::atomic<std::size_t> nThreads {0};
+    thread_local const std::size_t index = nThreads.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+void TraceRecorder::beginKernel(const char* name, std::uint32_t, std::uint64_t* kernelId)
+{
+    auto& recorder = instance();
+    *kernelId = recorder.nextKernelId_.fetch_add(1, std::memory_order_relaxed);
+    if (!recorder.enabled())
+    {
+        return;
+    }
+    const auto begin = now();
+    const auto thread = threadIndex();
+    std::lock_guard<std::mutex> lock(recorder.mutex_);
+    recorder.pending_.emplace(*kernelId, PendingKernel {name, begin, thread});
+}
+
+void TraceRecorder::endKernel(std::uint64_t kernelId)
+{
+    auto& recorder = instance();
+    const auto end = now();
+    std::lock_guard<std::mutex> lock(recorder.mutex_);
+    auto kernel = recorder.pending_.find(kernelId);
+    if (kernel == recorder.pending_.end())
+    {
+        return;
+    }
+    auto& [name, begin, thread] = kernel->second;
+    recorder.events_.push_back(TraceEvent {name, "kernel", begin, end - begin, thread});
+    recorder.pending_.erase(kernel);
+}
+
+void TraceRecorder::installKernelCallbacks()
+{
+    if (kernelCallbacks_)
+    {
+        return;
+    }
+    namespace tools = Kokkos::Tools::Experimental;
+    tools::set_begin_parallel_for_callback(&TraceRecorder::beginKernel);
+    tools::set_end_parallel_for_callback(&TraceRecorder::endKernel);
+    tools::set_begin_parallel_reduce_callback(&TraceRecorder::beginKernel);
+    tools::set_end_parallel_reduce_callback(&TraceRecorder::endKernel);
+    tools::set_begin_parallel_scan_callback(&TraceRecorder::beginKernel);
+    tools::set_end_parallel_scan_callback(&TraceRecorder::endKernel);
+    kernelCallbacks_ = true;
+}
+
+} // namespace NeoN
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/vector/vec3SoAVector.hpp"
+
+namespace NeoN
+{
+
+Vec3SoAVector::Vec3SoAVector(const Executor& exec, localIdx size)
+    : cmpts_ {Vector<scalar>(exec, size), Vector<scalar>(exec, size), Vector<scalar>(exec, size)}
+{}
+
+Vec3SoAVector::Vec3SoAVector(const Vector<Vec3>& in) : Vec3SoAVector(in.exec(), in.size())
+{
+    assign(in);
+}
+
+void Vec3SoAVector::assign(const Vector<Vec3>& in)
+{
+    NF_ASSERT(in.exec() == exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(in.size(), size());
+    const auto inView = in.view();
+    const auto soa = view();
+    parallelFor(
+        exec(),
+        {0, size()},
+        KOKKOS_LAMBDA(const localIdx i) { soa.set(i, inView[i]); },
+        "vec3SoAAssign"
+    );
+}
+
+Vector<Vec3> Vec3SoAVector::toAoS() const
+{
+    Vector<Vec3> out(exec(), size());
+    auto outView = out.view();
+    const auto soa = view();
+    parallelFor(
+        exec(),
+        {0, size()},
+        KOKKOS_LAMBDA(const localIdx i) { outView[i] = soa[i]; },
+        "vec3SoAToAoS"
+    );
+    return out;
+}
+
+Vec3SoAView<scalar> Vec3SoAVector::view()
+{
+    return {cmpts_[0].view(), cmpts_[1].view(), cmpts_[2].view()};
+}
+
+Vec3SoAView<const scalar> Vec3SoAVector::view() const
+{
+    return {cmpts_[0].view(), cmpts_[1].view(), cmpts_[2].view()};
+}
+
+}
@@ -2,8 +2,12 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <atomic>
+#include <utility>
+
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/primitives/tensor.hpp"
 #include "NeoN/core/macros.hpp"
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/vector/vector.hpp"
@@ -11,9 +15,15 @@
 namespace NeoN
 {
 
+std::size_t detail::nextVectorVersion()
+{
+    static std::atomic<std::size_t> version {0};
+    return ++version;
+}
+
 template<typename ValueType>
 Vector<ValueType>::Vector(const Executor& exec, localIdx size)
-    : size_(size), data_(nullptr), exec_(exec)
+    : size_(size), capacity_(size), data_(nullptr), exec_(exec)
 {
     void* ptr = nullptr;
     std::visit(
@@ -28,7 +38,7 @@ template<typename ValueType>
 Vector<ValueType>::Vector(
     const Executor& exec, const ValueType* in, localIdx size, Executor hostExec
 )
-    : size_(size), data_(nullptr), exec_(exec)
+    : size_(size), capacity_(size), data_(nullptr), exec_(exec)
 {
     void* ptr = nullptr;
     std::visit(
@@ -40,9 +50,21 @@ Vector<ValueType>::Vector(
     std::visit(detail::deepCopyVisitor<ValueType>(size_, in, data_), hostExec, exec_);
 }
 
+template<typename ValueType>
+Vector<ValueType> Vector<ValueType>::wrap(const Executor& exec, ValueType* data, localIdx size)
+{
+    Vector<ValueType> result(exec, 0);
+    std::visit([&result](const auto& concreteExec) { concreteExec.free(result.data_); }, exec);
+    result.data_ = data;
+    result.size_ = size;
+    result.capacity_ = size;
+    result.owning_ = false;
+    return result;
+}
+
 template<typename ValueType>
 Vector<ValueType>::Vector(const Executor& exec, localIdx size, ValueType value)
-    : size_(size), data_(nullptr), exec_(exec)
+    : size_(size), capacity_(size), data_(nullptr), exec_(exec)
 {
     void* ptr = nullptr;
     std::visit(
@@ -71,16 +93,23 @@ Vector<ValueType>::Vector(const Vector<ValueType>& rhs)
 
 template<typename ValueType>
 Vector<ValueType>::Vector(Vector<ValueType>&& rhs) noexcept
-    : size_(rhs.size_), data_(rhs.data_), exec_(rhs.exec_)
+    : size_(rhs.size_), capacity_(rhs.capacity_), data_(rhs.data_), exec_(rhs.exec_),
+      version_(rhs.version_), owning_(rhs.owning_)
 {
     rhs.data_ = nullptr;
     rhs.size_ = 0;
+    rhs.capacity_ = 0;
+    rhs.version_ = detail::nextVectorVersion();
+    rhs.owning_ = true;
 }
 
 template<typename ValueType>
 Vector<ValueType>::~Vector()
 {
-    std::visit([this](const auto& exec) { exec.free(data_); }, exec_);
+    if (owning_)
+    {
+        std::visit([this](const auto& exec) { exec.free(data_); }, exec_);
+    }
     data_ = nullptr;
 }
 
@@ -95,12 +124,45 @@ template<typename ValueType>
     return result;
 }
 
+template<typename ValueType>
+[[nodiscard]] std::pair<Vector<ValueType>, CompletionToken>
+Vector<ValueType>::copyToExecutorAsync(Executor dstExec) const
+{
+    if (dstExec == exec_) return {Vector<ValueType>(*this), CompletionToken()};
+
+    Vector<ValueType> result(dstExec, size_);
+    const Executor copyExec = std::holds_alternative<GPUExecutor>(exec_) ? exec_ : dstExec;
+    const auto size = static_cast<size_t>(size_);
+    ValueType* dstPtr = result.data();
+    std::visit(
+        [this, size, dstPtr](const auto& srcExec, const auto& dst, const auto& copy)
+        {
+            Kokkos::deep_copy(
+                copy.underlyingExec(),
+                dst.createKokkosView(dstPtr, size),
+                srcExec.createKokkosView(data_, size)
+            );
+        },
+        exec_,
+        dstExec,
+        copyExec
+    );
+    return {std::move(result), CompletionToken(copyExec)};
+}
+
 template<typename ValueType>
 [[nodiscard]] Vector<ValueType> Vector<ValueType>::copyToHost() const
 {
     return copyToExecutor(SerialExecutor());
 }
 
+template<typename ValueType>
+[[nodiscard]] std::pair<Vector<ValueType>, CompletionToken>
+Vector<ValueType>::copyToHostAsync() const
+{
+    return copyToExecutorAsync(SerialExecutor());
+}
+
 template<typename ValueType>
 void Vector<ValueType>::copyToHost(Vector<ValueType>& result)
 {
@@ -144,102 +206,100 @@ Vector<ValueType>& Vector<ValueType>::operator-=(const Vector<ValueType>& rhs)
 }
 
 template<typename ValueType>
-Vector<ValueType> Vector<ValueType>::operator*(const Vector<ValueType>& rhs)
-    requires requires(ValueType a, ValueType b) { a* b; }
+Vector<ValueType>& Vector<ValueType>::operator*=(const Vector<ValueType>& rhs)
+    requires requires(ValueType a, ValueType b) { a *= b; }
 {
     validateOtherVector(rhs);
-    Vector<ValueType> result(exec_, size_);
-    result = *this;
+    Vector<ValueType>& result = *this;
     mul(result, rhs);
     return result;
 }
 
 template<typename ValueType>
-Vector<ValueType> Vector<ValueType>::operator*(const scalar rhs)
-    requires requires(ValueType a, scalar b) { a* b; }
+Vector<ValueType>& Vector<ValueType>::operator*=(const scalar rhs)
+    requires requires(ValueType a, scalar b) { a *= b; }
 {
-    Vector<ValueType> result(exec_, size_);
-    result = *this;
+    Vector<ValueType>& result = *this;
     scalarMul(result, rhs);
     return result;
 }
 
 template<typename ValueType>
-Vector<ValueType>& Vector<ValueType>::operator*=(const Vector<ValueType>& rhs)
-    requires requires(ValueType a, ValueType b) { a *= b; }
+void Vector<ValueType>::resize(const localIdx size)
 {
-    validateOtherVector(rhs);
-    Vector<ValueType>& result = *this;
-    mul(result, rhs);
-    return result;
+    if (size > capacity_)
+    {
+        reallocate(size);
+    }
+    size_ = size;
+    version_ = detail::nextVectorVersion();
 }
 
 template<typename ValueType>
-Vector<ValueType>& Vector<ValueType>::operator*=(const scalar rhs)
-    requires requires(ValueType a, scalar b) { a *= b; }
+void Vector<ValueType>::reserve(const localIdx capacity)
 {
-    Vector<ValueType>& result = *this;
-    scalarMul(result, rhs);
-    return result;
+    if (capacity > capacity_)
+    {
+        reallocate(capacity);
+    }
 }
 
 template<typename ValueType>
-void Vector<ValueType>::resize(const localIdx size)
+void Vector<ValueType>::shrinkToFit()
+{
+    // external memory is kept as is
+    if (owning_ && capacity_ > size_)
+    {
+        reallocate(size_);
+    }
+}
+
+template<typename ValueType>
+void Vector<ValueType>::reallocate(const localIdx capacity)
 {
+    NF_ASSERT(owning_, "A vector wrapping external memory can not grow beyond its size.");
     void* ptr = nullptr;
-    if (!empty())
+    if (capacity > 0)
     {
         std::visit(
-            [this, &ptr, size](const auto& exec)
-            { ptr = exec.realloc(this->data_, static_cast<size_t>(size) * sizeof(ValueType)); },
+            [this, &ptr, capacity](const auto& exec)
+            {
+                ptr = exec.realloc(this->data_, static_cast<size_t>(capacity) * sizeof(ValueType));
+            },
             exec_
         );
     }
     else
     {
-        std::visit(
-            [&ptr, size](const auto& exec)
-            { ptr = exec.alloc(static_cast<size_t>(size) * sizeof(ValueType)); },
-            exec_
-        );
+        std::visit([this](const auto& exec) { exec.free(this->data_); }, exec_);
     }
     data_ = static_cast<ValueType*>(ptr);
-    size_ = size;
+    capacity_ = capacity;
+    version_ = detail::nextVectorVersion();
 }
 
 template<typename ValueType>
-void Vector<ValueType>::validateOtherVector(const Vector<ValueType>& rhs) const
+void Vector<ValueType>::swap(Vector<ValueType>& other)
 {
-    NF_DEBUG_ASSERT(size() == rhs.size(), "Vectors are not the same size.");
-    NF_DEBUG_ASSERT(exec() == rhs.exec(), "Executors are not the same.");
+    NF_ASSERT(exec_ == other.exec_, "Executors are not the same.");
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(data_, other.data_);
+    std::swap(version_, other.version_);
+    std::swap(owning_, other.owning_);
 }
 
 template<typename ValueType>
-[[nodiscard]] Vector<ValueType> operator+(Vector<ValueType> lhs, const Vector<ValueType>& rhs)
-{
-    lhs += rhs;
-    return lhs;
-}
-
-template<typename ValueType>
-[[nodiscard]] Vector<ValueType> operator-(Vector<ValueType> lhs, const Vector<ValueType>& rhs)
+void Vector<ValueType>::validateOtherVector(const Vector<ValueType>& rhs) const
 {
-    lhs -= rhs;
-    return lhs;
+    NF_DEBUG_ASSERT(size() == rhs.size(), "Vectors are not the same size.");
+    NF_DEBUG_ASSERT(exec() == rhs.exec(), "Executors are not the same.");
 }
 
 #define NN_VECTOR_CLASS_INSTANTIATION(Type) template class Vector<Type>
 
 NN_FOR_ALL_VALUE_TYPES(NN_VECTOR_CLASS_INSTANTIATION);
 NN_FOR_ALL_INTEGER_TYPES(NN_VECTOR_CLASS_INSTANTIATION);
-
-// operator instantiation
-#define NN_VECTOR_OPERATOR_INSTANTIATION(Type)                                                     \
-    /* free function opperators with additional requirements  */                                   \
-    template Vector<Type> operator+(Vector<Type> lhs, const Vector<Type>& rhs);                    \
-    template Vector<Type> operator-(Vector<Type> lhs, const Vector<Type>& rhs)
-
-NN_FOR_ALL_VALUE_TYPES(NN_VECTOR_OPERATOR_INSTANTIATION);
-NN_FOR_ALL_INTEGER_TYPES(NN_VECTOR_OPERATOR_INSTANTIATION);
+NN_VECTOR_CLASS_INSTANTIATION(Tensor);
 
 } // namespace NeoN
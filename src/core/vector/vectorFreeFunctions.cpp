@@ -2,12 +2,15 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <cmath>
+
 #include <Kokkos_Core.hpp>
 
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/primitives/tensor.hpp"
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/core/macros.hpp"
 #include "NeoN/core/view.hpp"
@@ -21,11 +24,13 @@ template<typename ValueType>
 void scalarMul(Vector<ValueType>& vect, const scalar value)
     requires requires(ValueType a, scalar b) { a* b; }
 {
-    if constexpr (std::is_same_v<ValueType, Vec3>)
+    if constexpr (std::is_same_v<ValueType, Vec3> || std::is_same_v<ValueType, Tensor>)
     {
         auto viewA = vect.view();
         parallelFor(
-            vect, KOKKOS_LAMBDA(const localIdx i)->ValueType { return viewA[i] * value; }
+            vect,
+            KOKKOS_LAMBDA(const localIdx i)->ValueType { return viewA[i] * value; },
+            "scalarMul"
         );
     }
     else
@@ -35,7 +40,8 @@ void scalarMul(Vector<ValueType>& vect, const scalar value)
             vect,
             KOKKOS_LAMBDA(const localIdx i)->ValueType {
                 return viewA[i] * static_cast<ValueType>(value);
-            }
+            },
+            "scalarMul"
         );
     }
 }
@@ -51,7 +57,7 @@ void fieldBinaryOp(
 {
     auto view = vect.view();
     parallelFor(
-        vect, KOKKOS_LAMBDA(const localIdx i) { return op(view[i], value); }
+        vect, KOKKOS_LAMBDA(const localIdx i) { return op(view[i], value); }, "fieldBinaryOp"
     );
 }
 
@@ -64,7 +70,7 @@ void fieldBinaryOp(
     auto viewA = vect1.view();
     auto viewB = vect2.view();
     parallelFor(
-        vect1, KOKKOS_LAMBDA(const localIdx i) { return op(viewA[i], viewB[i]); }
+        vect1, KOKKOS_LAMBDA(const localIdx i) { return op(viewA[i], viewB[i]); }, "fieldBinaryOp"
     );
 }
 
@@ -120,6 +126,147 @@ void mul(Vector<ValueType>& vect1, const Vector<std::type_identity_t<ValueType>>
     );
 }
 
+namespace detail
+{
+
+/* @brief the type of the coefficients of the fused operations, Vec3 is scaled by scalars */
+template<typename ValueType>
+using Coefficient = std::conditional_t<std::is_same_v<ValueType, Vec3>, scalar, ValueType>;
+
+template<typename ValueType>
+KOKKOS_INLINE_FUNCTION scalar innerProduct(const ValueType& a, const ValueType& b)
+{
+    if constexpr (std::is_same_v<ValueType, Vec3>)
+    {
+        return a & b;
+    }
+    else
+    {
+        return static_cast<scalar>(a * b);
+    }
+}
+
+}
+
+template<typename ValueType>
+void axpby(
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    Vector<ValueType>& y
+)
+{
+    NeoN_ASSERT_EQUAL_LENGTH(x, y);
+    const auto a = static_cast<detail::Coefficient<ValueType>>(alpha);
+    const auto b = static_cast<detail::Coefficient<ValueType>>(beta);
+    auto [yV, xV] = views(y, x);
+    parallelFor(
+        y.exec(),
+        y.range(),
+        KOKKOS_LAMBDA(const localIdx i) { yV[i] = xV[i] * a + yV[i] * b; },
+        "axpby"
+    );
+}
+
+template<typename ValueType>
+void waxpby(
+    Vector<ValueType>& w,
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    const Vector<std::type_identity_t<ValueType>>& y
+)
+{
+    NeoN_ASSERT_EQUAL_LENGTH(w, x);
+    NeoN_ASSERT_EQUAL_LENGTH(w, y);
+    const auto a = static_cast<detail::Coefficient<ValueType>>(alpha);
+    const auto b = static_cast<detail::Coefficient<ValueType>>(beta);
+    auto [wV, xV, yV] = views(w, x, y);
+    parallelFor(
+        w.exec(),
+        w.range(),
+        KOKKOS_LAMBDA(const localIdx i) { wV[i] = xV[i] * a + yV[i] * b; },
+        "waxpby"
+    );
+}
+
+template<typename ValueType>
+void axpbypcz(
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    const Vector<std::type_identity_t<ValueType>>& y,
+    const scalar gamma,
+    Vector<ValueType>& z
+)
+{
+    NeoN_ASSERT_EQUAL_LENGTH(z, x);
+    NeoN_ASSERT_EQUAL_LENGTH(z, y);
+    const auto a = static_cast<detail::Coefficient<ValueType>>(alpha);
+    const auto b = static_cast<detail::Coefficient<ValueType>>(beta);
+    const auto c = static_cast<detail::Coefficient<ValueType>>(gamma);
+    auto [zV, xV, yV] = views(z, x, y);
+    parallelFor(
+        z.exec(),
+        z.range(),
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = xV[i] * a + yV[i] * b + zV[i] * c; },
+        "axpbypcz"
+    );
+}
+
+template<typename ValueType>
+scalar dot(const Vector<ValueType>& x, const Vector<std::type_identity_t<ValueType>>& y)
+{
+    NeoN_ASSERT_EQUAL_LENGTH(x, y);
+    const auto [xV, yV] = views(x, y);
+    scalar sum = 0.0;
+    parallelReduce(
+        x.exec(),
+        x.range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            lsum += detail::innerProduct(xV[i], yV[i]);
+        },
+        sum,
+        "dot"
+    );
+    return sum;
+}
+
+template<typename ValueType>
+scalar norm2(const Vector<ValueType>& x)
+{
+    return std::sqrt(dot(x, x));
+}
+
+template<typename ValueType>
+scalar axpbyDot(
+    const scalar alpha,
+    const Vector<std::type_identity_t<ValueType>>& x,
+    const scalar beta,
+    Vector<ValueType>& y,
+    const Vector<std::type_identity_t<ValueType>>& z
+)
+{
+    NeoN_ASSERT_EQUAL_LENGTH(y, x);
+    NeoN_ASSERT_EQUAL_LENGTH(y, z);
+    const auto a = static_cast<detail::Coefficient<ValueType>>(alpha);
+    const auto b = static_cast<detail::Coefficient<ValueType>>(beta);
+    // z is read after y is written, thus with z being y the updated value enters the product
+    auto [yV, xV, zV] = views(y, x, z);
+    scalar sum = 0.0;
+    parallelReduce(
+        y.exec(),
+        y.range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            yV[i] = xV[i] * a + yV[i] * b;
+            lsum += detail::innerProduct(yV[i], zV[i]);
+        },
+        sum,
+        "axpbyDot"
+    );
+    return sum;
+}
+
 // operator instantiation
 #define NN_VECTOR_OPERATOR_INSTANTIATION(Type)                                                     \
     /* free function operator with additional requirements  */                                     \
@@ -139,9 +286,27 @@ void mul(Vector<ValueType>& vect1, const Vector<std::type_identity_t<ValueType>>
     template void sub<Type>(Vector<Type>&, const std::type_identity_t<Type>&);                     \
     template void sub<Type>(Vector<Type>&, const Vector<std::type_identity_t<Type>>&);
 
+#define NN_VECTOR_FUSED_INSTANTIATION(Type)                                                        \
+    template void axpby<Type>(scalar, const Vector<Type>&, scalar, Vector<Type>&);                 \
+    template void waxpby<Type>(                                                                    \
+        Vector<Type>&, scalar, const Vector<Type>&, scalar, const Vector<Type>&                    \
+    );                                                                                             \
+    template void axpbypcz<Type>(                                                                  \
+        scalar, const Vector<Type>&, scalar, const Vector<Type>&, scalar, Vector<Type>&            \
+    );                                                                                             \
+    template scalar dot<Type>(const Vector<Type>&, const Vector<Type>&);                           \
+    template scalar norm2<Type>(const Vector<Type>&);                                              \
+    template scalar axpbyDot<Type>(                                                                \
+        scalar, const Vector<Type>&, scalar, Vector<Type>&, const Vector<Type>&                    \
+    );
+
 NN_FOR_ALL_INTEGER_TYPES(NN_VECTOR_OPERATOR_INSTANTIATION);
 NN_VECTOR_OPERATOR_INSTANTIATION(float);
 NN_VECTOR_OPERATOR_INSTANTIATION(double);
 NN_VECTOR_OPERATOR_INSTANTIATION_VEC3(Vec3);
+NN_VECTOR_OPERATOR_INSTANTIATION_VEC3(Tensor);
+NN_VECTOR_FUSED_INSTANTIATION(float);
+NN_VECTOR_FUSED_INSTANTIATION(double);
+NN_VECTOR_FUSED_INSTANTIATION(Vec3);
 
 } // namespace NeoN
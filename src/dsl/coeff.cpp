@@ -45,18 +45,27 @@ Coeff& Coeff::operator*=(const Coeff& rhs)
     return this->operator*=(rhs.coeff_);
 }
 
+bool Coeff::operator==(const Coeff& rhs) const
+{
+    return coeff_ == rhs.coeff_ && hasView_ == rhs.hasView_ && view_.data() == rhs.view_.data()
+        && view_.size() == rhs.view_.size();
+}
+
 namespace detail
 {
 void toVector(Coeff& coeff, Vector<scalar>& rhs)
 {
     if (coeff.hasView())
     {
+        // the size alternates between one and the field size, resize keeps the allocation
         rhs.resize(coeff.view().size());
-        fill(rhs, 1.0);
         auto rhsView = rhs.view();
         // otherwise we are unable to capture values in the lambda
         parallelFor(
-            rhs.exec(), rhs.range(), KOKKOS_LAMBDA(const localIdx i) { rhsView[i] *= coeff[i]; }
+            rhs.exec(),
+            rhs.range(),
+            KOKKOS_LAMBDA(const localIdx i) { rhsView[i] = coeff[i]; },
+            "Coeff::toVector"
         );
     }
     else
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/dsl/newtonKrylov.hpp"
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <kinsol/kinsol.h>
+#include <sunlinsol/sunlinsol_spgmr.h>
+
+#include "NeoN/core/timer.hpp"
+#include "NeoN/dsl/solver.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+
+namespace NeoN::dsl
+{
+
+namespace
+{
+
+/* @brief the state shared with the callbacks of KINSOL during a solve */
+template<typename VectorType>
+struct NewtonKrylovData
+{
+    Expression<scalar>* expression;
+    VectorType* solution;
+    const NewtonKrylovUpdate<VectorType>* update;
+    scalar t;
+    scalar dt;
+    std::shared_ptr<la::Solver> solver;
+    std::optional<la::LinearSystem<scalar, localIdx>> picard; // the preconditioner system
+    Vector<scalar> correction;                                // the result of the preconditioner
+};
+
+/* @brief copies an iterate into the solution field and assembles the linear system at it */
+template<typename VectorType>
+la::LinearSystem<scalar, localIdx>& assembleAt(N_Vector u, NewtonKrylovData<VectorType>& data)
+{
+    auto& iterate = sundials::vector(u);
+    auto& solution = *data.solution;
+    if (iterate.data() != solution.internalVector().data())
+    {
+        solution.internalVector() = iterate;
+    }
+    solution.correctBoundaryConditions();
+    if (*data.update)
+    {
+        (*data.update)(solution);
+    }
+
+    auto& ls = detail::assemble(*data.expression, solution);
+    if (data.expression->temporalOperators().size() > 0)
+    {
+        data.expression->implicitOperation(ls, data.t, data.dt);
+    }
+    return ls;
+}
+
+/* @brief the nonlinear residual F(u) = A(u) u - b(u) */
+template<typename VectorType>
+int residual(N_Vector u, N_Vector f, void* userData)
+{
+    auto& data = *static_cast<NewtonKrylovData<VectorType>*>(userData);
+    auto& ls = assembleAt(u, data);
+    la::computeResidual(ls.matrix(), ls.rhs(), sundials::vector(u), sundials::vector(f));
+    NeoN::fence(data.expression->exec());
+    return 0;
+}
+
+/* @brief assembles and keeps the Picard matrix A(u) of the current iterate */
+template<typename VectorType>
+int preconditionerSetup(N_Vector u, N_Vector, N_Vector, N_Vector, void* userData)
+{
+    auto& data = *static_cast<NewtonKrylovData<VectorType>*>(userData);
+    data.picard.emplace(assembleAt(u, data));
+    NeoN::fence(data.expression->exec());
+    return 0;
+}
+
+/* @brief approximates the inverse of the Jacobian by solving with the Picard matrix */
+template<typename VectorType>
+int preconditionerSolve(N_Vector, N_Vector, N_Vector, N_Vector, N_Vector v, void* userData)
+{
+    auto& data = *static_cast<NewtonKrylovData<VectorType>*>(userData);
+    auto& vV = sundials::vector(v);
+    data.picard->rhs() = vV;
+    fill(data.correction, scalar(0.0));
+    data.solver->solve(*data.picard, data.correction);
+    vV = data.correction;
+    NeoN::fence(data.expression->exec());
+    return 0;
+}
+
+void freeKinsol(void* kinsol) { KINFree(&kinsol); }
+
+}
+
+template<typename VectorType>
+NewtonKrylovStats solveNewtonKrylov(
+    Expression<typename VectorType::ElementType>& exp,
+    VectorType& solution,
+    scalar t,
+    scalar dt,
+    const Dictionary& fvSchemes,
+    const Dictionary& newtonDict,
+    const NewtonKrylovUpdate<VectorType>& update
+)
+{
+    ScopedTimer timer("dsl::solveNewtonKrylov", solution.exec());
+    if (exp.temporalOperators().size() == 0 && exp.spatialOperators().size() == 0)
+    {
+        NF_ERROR_EXIT("No temporal or implicit terms to solve.");
+    }
+    exp.read(fvSchemes);
+
+    const auto tolerance =
+        newtonDict.contains("tolerance") ? newtonDict.get<scalar>("tolerance") : scalar(1e-8);
+    const auto maxIter = newtonDict.contains("maxIter") ? newtonDict.get<int>("maxIter") : 50;
+    const auto maxKrylovDim =
+        newtonDict.contains("maxKrylovDim") ? newtonDict.get<int>("maxKrylovDim") : 10;
+    const auto rebuildEvery = newtonDict.contains("rebuildPreconditionerEvery")
+                                ? newtonDict.get<int>("rebuildPreconditionerEvery")
+                                : 1;
+    const auto lineSearch =
+        newtonDict.contains("lineSearch") && newtonDict.get<bool>("lineSearch");
+
+    NewtonKrylovData<VectorType> data {
+        &exp,
+        &solution,
+        &update,
+        t,
+        dt,
+        la::solverCache(solution.mesh())
+            .get(solution.name, solution.exec(), newtonDict.subDict("preconditioner")),
+        std::nullopt,
+        Vector<scalar>(solution.exec(), solution.internalVector().size())
+    };
+
+    const auto context = sundials::sharedContext();
+
+    // the iterate is owned, thus perturbed iterates of the Jacobian products never alias the field
+    const auto& internal = solution.internalVector();
+    const auto size = static_cast<size_t>(internal.size());
+    sundials::NVector state;
+    state.initNVector(internal.exec(), size, context);
+    state.vector() = internal;
+    sundials::NVector scale;
+    scale.initNVector(internal.exec(), size, context);
+    fill(scale.vector(), scalar(1.0));
+
+    std::unique_ptr<void, void (*)(void*)> kinsol(KINCreate(*context), freeKinsol);
+    NF_ASSERT(kinsol != nullptr, "KINCreate failed");
+    int flag = KINInit(kinsol.get(), residual<VectorType>, state.sunNVector());
+    NF_ASSERT(flag == KIN_SUCCESS, "KINInit failed");
+    KINSetUserData(kinsol.get(), &data);
+
+    std::unique_ptr<_generic_SUNLinearSolver, decltype(&SUNLinSolFree)> gmres(
+        SUNLinSol_SPGMR(state.sunNVector(), SUN_PREC_RIGHT, maxKrylovDim, *context), SUNLinSolFree
+    );
+    NF_ASSERT(gmres != nullptr, "SUNLinSol_SPGMR failed");
+    // without a matrix the Jacobian vector products are approximated by finite differences
+    flag = KINSetLinearSolver(kinsol.get(), gmres.get(), nullptr);
+    NF_ASSERT(flag == KIN_SUCCESS, "KINSetLinearSolver failed");
+    KINSetPreconditioner(
+        kinsol.get(), preconditionerSetup<VectorType>, preconditionerSolve<VectorType>
+    );
+    KINSetFuncNormTol(kinsol.get(), tolerance);
+    KINSetNumMaxIters(kinsol.get(), maxIter);
+    KINSetMaxSetupCalls(kinsol.get(), rebuildEvery);
+
+    flag = KINSol(
+        kinsol.get(),
+        state.sunNVector(),
+        lineSearch ? KIN_LINESEARCH : KIN_NONE,
+        scale.sunNVector(),
+        scale.sunNVector()
+    );
+    NF_ASSERT(flag >= KIN_SUCCESS, "KINSol failed with flag " + std::to_string(flag));
+
+    // the field holds the last evaluated iterate, which may be a perturbed one
+    solution.internalVector() = state.vector();
+    solution.correctBoundaryConditions();
+    if (update)
+    {
+        update(solution);
+    }
+
+    NewtonKrylovStats stats {0, 0, 0, 0.0};
+    long numLinResidualEvals = 0;
+    KINGetNumNonlinSolvIters(kinsol.get(), &stats.numNonlinearIter);
+    KINGetNumLinIters(kinsol.get(), &stats.numLinearIter);
+    KINGetNumFuncEvals(kinsol.get(), &stats.numResidualEvals);
+    KINGetNumLinFuncEvals(kinsol.get(), &numLinResidualEvals);
+    KINGetFuncNorm(kinsol.get(), &stats.finalResNorm);
+    stats.numResidualEvals += numLinResidualEvals;
+    NeoN::fence(solution.exec());
+    return stats;
+}
+
+template NewtonKrylovStats solveNewtonKrylov<finiteVolume::cellCentred::VolumeField<scalar>>(
+    Expression<scalar>&,
+    finiteVolume::cellCentred::VolumeField<scalar>&,
+    scalar,
+    scalar,
+    const Dictionary&,
+    const Dictionary&,
+    const NewtonKrylovUpdate<finiteVolume::cellCentred::VolumeField<scalar>>&
+);
+
+}
+
+#endif
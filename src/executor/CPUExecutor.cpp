@@ -2,8 +2,52 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <atomic>
+#include <type_traits>
+
 #include "NeoN/core/executor/CPUExecutor.hpp"
 
-NeoN::CPUExecutor::CPUExecutor() {};
+namespace
+{
+
+// the smallest page size of the supported platforms
+constexpr size_t pageSize = 4096;
+
+std::atomic<bool>& firstTouchEnabled()
+{
+    static std::atomic<bool> enabled {true};
+    return enabled;
+}
+
+}
+
+NeoN::CPUExecutor::CPUExecutor() : instance_() {};
+
+NeoN::CPUExecutor::CPUExecutor(const exec& instance) : instance_(instance) {};
 
 NeoN::CPUExecutor::~CPUExecutor() {};
+
+bool NeoN::CPUExecutor::firstTouch() { return firstTouchEnabled().load(); }
+
+void NeoN::CPUExecutor::setFirstTouch(bool enabled) { firstTouchEnabled().store(enabled); }
+
+void NeoN::CPUExecutor::touchPages(void* ptr, size_t size) const
+{
+    // a single thread places all pages on its own node anyway
+    if constexpr (std::is_same_v<exec, Kokkos::Serial>)
+    {
+        return;
+    }
+    if (ptr == nullptr || size == 0)
+    {
+        return;
+    }
+    auto* bytes = static_cast<char*>(ptr);
+    const size_t nPages = (size + pageSize - 1) / pageSize;
+    Kokkos::parallel_for(
+        "NeoN::CPUExecutor::touchPages",
+        Kokkos::RangePolicy<exec, Kokkos::Schedule<Kokkos::Static>>(instance_, 0, nPages),
+        KOKKOS_LAMBDA(const size_t page) { bytes[page * pageSize] = 0; }
+    );
+    instance_.fence("NeoN::CPUExecutor::touchPages");
+}
@@ -4,6 +4,57 @@
 
 #include "NeoN/core/executor/GPUExecutor.hpp"
 
-NeoN::GPUExecutor::GPUExecutor() {};
+NeoN::GPUExecutor::GPUExecutor() : instance_() {};
+
+NeoN::GPUExecutor::GPUExecutor(const exec& instance) : instance_(instance) {};
 
 NeoN::GPUExecutor::~GPUExecutor() {};
+
+int NeoN::GPUExecutor::deviceId() const
+{
+#if defined(KOKKOS_ENABLE_CUDA)
+    return instance_.cuda_device();
+#elif defined(KOKKOS_ENABLE_HIP)
+    return instance_.hip_device();
+#else
+    return -1;
+#endif
+}
+
+// the calls are hints, they fail for memory which is not managed, whose error is discarded
+void NeoN::GPUExecutor::prefetch(
+    [[maybe_unused]] const void* ptr, [[maybe_unused]] size_t bytes
+) const
+{
+#if defined(KOKKOS_ENABLE_CUDA)
+    if (cudaMemPrefetchAsync(ptr, bytes, instance_.cuda_device(), instance_.cuda_stream())
+        != cudaSuccess)
+    {
+        static_cast<void>(cudaGetLastError());
+    }
+#elif defined(KOKKOS_ENABLE_HIP)
+    if (hipMemPrefetchAsync(ptr, bytes, instance_.hip_device(), instance_.hip_stream())
+        != hipSuccess)
+    {
+        static_cast<void>(hipGetLastError());
+    }
+#endif
+}
+
+void NeoN::GPUExecutor::adviseReadMostly(
+    [[maybe_unused]] const void* ptr, [[maybe_unused]] size_t bytes
+) const
+{
+#if defined(KOKKOS_ENABLE_CUDA)
+    if (cudaMemAdvise(ptr, bytes, cudaMemAdviseSetReadMostly, instance_.cuda_device())
+        != cudaSuccess)
+    {
+        static_cast<void>(cudaGetLastError());
+    }
+#elif defined(KOKKOS_ENABLE_HIP)
+    if (hipMemAdvise(ptr, bytes, hipMemAdviseSetReadMostly, instance_.hip_device()) != hipSuccess)
+    {
+        static_cast<void>(hipGetLastError());
+    }
+#endif
+}
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/executor/kernelGraph.hpp"
+
+namespace NeoN
+{
+
+#ifdef KOKKOS_ENABLE_CUDA
+namespace
+{
+
+void checkCuda(cudaError_t err, const std::string& operation)
+{
+    NF_ASSERT(err == cudaSuccess, operation << " failed: " << cudaGetErrorString(err));
+}
+
+cudaStream_t stream(const Executor& exec)
+{
+    return std::get<GPUExecutor>(exec).underlyingExec().cuda_stream();
+}
+
+}
+#endif
+
+KernelGraph::KernelGraph(const Executor& exec) : exec_(exec) {}
+
+KernelGraph::~KernelGraph() { reset(); }
+
+bool KernelGraph::isDeviceGraph() const
+{
+#ifdef KOKKOS_ENABLE_CUDA
+    return graphExec_ != nullptr;
+#else
+    return false;
+#endif
+}
+
+void KernelGraph::capture(std::function<void()> work)
+{
+    reset();
+    work_ = std::move(work);
+#ifdef KOKKOS_ENABLE_CUDA
+    if (std::holds_alternative<GPUExecutor>(exec_))
+    {
+        NF_ASSERT(
+            stream(exec_) != nullptr,
+            "Capturing requires a GPUExecutor with its own stream, see partition."
+        );
+        auto& pool = GPUExecutor::pool::instance();
+        fence(exec_);
+        pool.beginRetain();
+        checkCuda(
+            cudaStreamBeginCapture(stream(exec_), cudaStreamCaptureModeRelaxed),
+            "cudaStreamBeginCapture"
+        );
+        work_();
+        const auto err = cudaStreamEndCapture(stream(exec_), &graph_);
+        retained_ = pool.endRetain();
+        captured_ = true;
+        checkCuda(err, "cudaStreamEndCapture");
+        checkCuda(
+            cudaGraphInstantiateWithFlags(&graphExec_, graph_, 0), "cudaGraphInstantiate"
+        );
+        // the capture only records the kernels, thus they are executed once here
+        replay();
+        return;
+    }
+#endif
+    work_();
+    captured_ = true;
+}
+
+void KernelGraph::replay()
+{
+    NF_ASSERT(captured_, "No kernels have been captured.");
+#ifdef KOKKOS_ENABLE_CUDA
+    if (graphExec_ != nullptr)
+    {
+        checkCuda(cudaGraphLaunch(graphExec_, stream(exec_)), "cudaGraphLaunch");
+        return;
+    }
+#endif
+    work_();
+}
+
+void KernelGraph::reset()
+{
+    if (!captured_)
+    {
+        return;
+    }
+    fence(exec_);
+#ifdef KOKKOS_ENABLE_CUDA
+    if (graphExec_ != nullptr)
+    {
+        cudaGraphExecDestroy(graphExec_);
+        graphExec_ = nullptr;
+    }
+    if (graph_ != nullptr)
+    {
+        cudaGraphDestroy(graph_);
+        graph_ = nullptr;
+    }
+#endif
+    std::visit(
+        [this](const auto& e)
+        {
+            auto& pool = memoryPool(e);
+            for (void* ptr : retained_)
+            {
+                pool.deallocate(ptr);
+            }
+        },
+        exec_
+    );
+    retained_.clear();
+    work_ = {};
+    captured_ = false;
+}
+
+} // namespace NeoN
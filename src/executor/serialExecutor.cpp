@@ -4,6 +4,8 @@
 
 #include "NeoN/core/executor/serialExecutor.hpp"
 
-NeoN::SerialExecutor::SerialExecutor() {};
+NeoN::SerialExecutor::SerialExecutor() : instance_() {};
+
+NeoN::SerialExecutor::SerialExecutor(const exec& instance) : instance_(instance) {};
 
 NeoN::SerialExecutor::~SerialExecutor() {};
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+#include "NeoN/core/executor/taskGraph.hpp"
+#include "NeoN/core/timer.hpp"
+
+namespace NeoN
+{
+
+TaskGraph::TaskGraph(const Executor& exec, std::size_t nInstances)
+    : instances_(partition(exec, nInstances))
+{
+    NF_ASSERT(nInstances > 0, "A task graph requires at least one instance.");
+}
+
+TaskGraph::TaskId TaskGraph::submit(std::string name, TaskAccess access, Work work)
+{
+    return submit(std::move(name), std::move(access), instances_.size(), std::move(work));
+}
+
+TaskGraph::TaskId
+TaskGraph::submit(std::string name, TaskAccess access, std::size_t instance, Work work)
+{
+    NF_ASSERT(
+        instance <= instances_.size(),
+        "Instance " << instance << " exceeds the " << instances_.size() << " instances."
+    );
+    const TaskId id = tasks_.size();
+    std::vector<TaskId> dependencies;
+    for (const auto* resource : access.reads)
+    {
+        auto& state = resources_[resource];
+        if (state.written)
+        {
+            dependencies.push_back(state.writer);
+        }
+    }
+    for (const auto* resource : access.writes)
+    {
+        auto& state = resources_[resource];
+        if (state.written)
+        {
+            dependencies.push_back(state.writer);
+        }
+        dependencies.insert(dependencies.end(), state.readers.begin(), state.readers.end());
+    }
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+    // a task accessing a resource twice must not depend on itself
+    for (const auto* resource : access.reads)
+    {
+        resources_[resource].readers.push_back(id);
+    }
+    for (const auto* resource : access.writes)
+    {
+        auto& state = resources_[resource];
+        state.written = true;
+        state.writer = id;
+        state.readers.clear();
+    }
+
+    std::size_t level = 0;
+    for (const auto dependency : dependencies)
+    {
+        level = std::max(level, tasks_[dependency].level + 1);
+    }
+    if (levelSize_.size() <= level)
+    {
+        levelSize_.resize(level + 1, 0);
+    }
+    if (instance == instances_.size())
+    {
+        instance = levelSize_[level] % instances_.size();
+    }
+    levelSize_[level]++;
+    tasks_.push_back(Task {std::move(name), std::move(work), instance, level, dependencies});
+    return id;
+}
+
+void TaskGraph::run()
+{
+    ScopedTimer timer("TaskGraph::run");
+    std::vector<std::vector<TaskId>> levels(levelSize_.size());
+    for (TaskId id = 0; id < tasks_.size(); id++)
+    {
+        levels[tasks_[id].level].push_back(id);
+    }
+    for (const auto& level : levels)
+    {
+        runLevel(level);
+    }
+    clear();
+}
+
+void TaskGraph::clear()
+{
+    tasks_.clear();
+    resources_.clear();
+    levelSize_.clear();
+}
+
+const std::vector<TaskGraph::TaskId>& TaskGraph::dependencies(TaskId task) const
+{
+    NF_ASSERT(task < tasks_.size(), "No task with id " << task << ".");
+    return tasks_[task].dependencies;
+}
+
+std::size_t TaskGraph::level(TaskId task) const
+{
+    NF_ASSERT(task < tasks_.size(), "No task with id " << task << ".");
+    return tasks_[task].level;
+}
+
+const Executor& TaskGraph::instance(std::size_t i) const
+{
+    NF_ASSERT(i < instances_.size(), "Instance " << i << " exceeds the number of instances.");
+    return instances_[i];
+}
+
+void TaskGraph::runLevel(const std::vector<TaskId>& level)
+{
+    if (std::holds_alternative<CPUExecutor>(instances_.front()) && instances_.size() > 1)
+    {
+        // the kernels of a CPUExecutor block the calling thread, hence every instance is
+        // driven by its own thread
+        std::vector<std::exception_ptr> errors(instances_.size());
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < instances_.size(); i++)
+        {
+            threads.emplace_back(
+                [this, &level, &errors, i]()
+                {
+                    try
+                    {
+                        runInstance(level, i);
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                }
+            );
+        }
+        try
+        {
+            runInstance(level, 0);
+        }
+        catch (...)
+        {
+            errors[0] = std::current_exception();
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        for (const auto& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < instances_.size(); i++)
+        {
+            runInstance(level, i);
+        }
+    }
+    for (const auto& exec : instances_)
+    {
+        fence(exec);
+    }
+}
+
+void TaskGraph::runInstance(const std::vector<TaskId>& level, std::size_t instance)
+{
+    const auto& exec = instances_[instance];
+    for (const auto id : level)
+    {
+        auto& task = tasks_[id];
+        if (task.instance == instance)
+        {
+            ScopedTimer timer(task.name, exec);
+            task.work(exec);
+        }
+    }
+}
+
+} // namespace NeoN
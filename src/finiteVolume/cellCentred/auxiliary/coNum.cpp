@@ -2,8 +2,6 @@
 //
 // SPDX-License-Identifier: MIT
 
-#include <limits>
-
 #include "NeoN/core/info.hpp"
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
@@ -12,88 +10,182 @@
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/reductionBatch.hpp"
+#endif
 
 namespace NeoN::finiteVolume::cellCentred
 {
 
-scalar computeCoNum(const SurfaceField<scalar>& faceFlux, const scalar dt)
+/* @brief returns the total volume of the mesh, which is computed on the first call only */
+static scalar totalVolume(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<scalar> key("totalVolume");
+    return mesh.stencilDB().getOrCreate(
+        key,
+        [&]()
+        {
+            const auto surfV = mesh.cellVolumes().view();
+            scalar totalVol = 0.0;
+            parallelReduce(
+                mesh.exec(),
+                {0, mesh.nCells()},
+                KOKKOS_LAMBDA(const localIdx celli, scalar& lsum) { lsum += surfV[celli]; },
+                totalVol,
+                "computeCoNum::totalVolume"
+            );
+            return totalVol;
+        }
+    );
+}
+
+/* @brief returns the maximum of the summed absolute face fluxes of a cell divided by its volume
+ * and the sum over all cells, both computed in a single pass
+ */
+static std::pair<scalar, scalar> localCourantSums(const SurfaceField<scalar>& faceFlux)
 {
     const UnstructuredMesh& mesh = faceFlux.mesh();
     const auto exec = faceFlux.exec();
     VolumeField<scalar> phi(exec, "phi", mesh, createCalculatedBCs<VolumeBoundary<scalar>>(mesh));
     fill(phi.internalVector(), 0.0);
 
-    const auto [surfFaceCells, volPhi, surfOwner, surfNeighbour, surfFaceFlux, surfV] = views(
-        mesh.boundaryMesh().faceCells(),
-        phi.internalVector(),
-        mesh.faceOwner(),
-        mesh.faceNeighbour(),
-        faceFlux.internalVector(),
-        mesh.cellVolumes()
-    );
-    auto nInternalFaces = mesh.nInternalFaces();
-
-    scalar maxCoNum = std::numeric_limits<scalar>::lowest();
-    scalar meanCoNum = 0.0;
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx i) {
-            scalar flux = Kokkos::sqrt(surfFaceFlux[i] * surfFaceFlux[i]);
-            Kokkos::atomic_add(&volPhi[surfOwner[i]], flux);
-            Kokkos::atomic_add(&volPhi[surfNeighbour[i]], flux);
-        }
-    );
+    const auto [volPhi, surfFaceFlux, invVol] =
+        views(phi.internalVector(), faceFlux.internalVector(), mesh.invCellVolumes());
 
-    parallelFor(
-        exec,
-        {nInternalFaces, faceFlux.size()},
+    reduceFaceValues(
+        mesh,
+        volPhi,
         KOKKOS_LAMBDA(const localIdx i) {
-            auto own = surfFaceCells[i - nInternalFaces];
-            scalar flux = Kokkos::sqrt(surfFaceFlux[i] * surfFaceFlux[i]);
-            Kokkos::atomic_add(&volPhi[own], flux);
-        }
+            return Kokkos::sqrt(surfFaceFlux[i] * surfFaceFlux[i]);
+        },
+        false
     );
 
     phi.correctBoundaryConditions();
 
+    // the maximum and the sum are computed in a single pass
     scalar maxValue {0.0};
+    scalar totalPhi = 0.0;
     Kokkos::Max<NeoN::scalar> maxReducer(maxValue);
     parallelReduce(
         exec,
         {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli, NeoN::scalar& lmax) {
-            NeoN::scalar val = (volPhi[celli] / surfV[celli]);
+        KOKKOS_LAMBDA(const localIdx celli, NeoN::scalar& lmax, scalar& lsum) {
+            NeoN::scalar val = volPhi[celli] * invVol[celli];
             if (val > lmax) lmax = val;
+            lsum += volPhi[celli];
         },
-        maxReducer
+        maxReducer,
+        totalPhi,
+        "computeCoNum::courant"
     );
+    return {maxReducer.reference(), totalPhi};
+}
 
-    scalar totalPhi = 0.0;
-    Kokkos::Sum<NeoN::scalar> sumPhi(totalPhi);
-    parallelReduce(
-        exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli, scalar& lsum) { lsum += volPhi[celli]; },
-        sumPhi
+CourantNumber computeCourantNumber(const SurfaceField<scalar>& faceFlux, const scalar dt)
+{
+    const auto [maxValue, totalPhi] = localCourantSums(faceFlux);
+    return {0.5 * (totalPhi / totalVolume(faceFlux.mesh())) * dt, maxValue * 0.5 * dt};
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+CourantNumber computeCourantNumber(
+    const mpi::MPIEnvironment& mpiEnviron, const SurfaceField<scalar>& faceFlux, const scalar dt
+)
+{
+    const auto [maxValue, totalPhi] = localCourantSums(faceFlux);
+    mpi::ReductionBatch batch(mpiEnviron.comm());
+    const auto maxIdx = batch.add(maxValue, mpi::ReduceOp::Max);
+    const auto phiIdx = batch.add(totalPhi, mpi::ReduceOp::Sum);
+    const auto volIdx = batch.add(totalVolume(faceFlux.mesh()), mpi::ReduceOp::Sum);
+    batch.reduce();
+    return {
+        0.5 * (batch.value(phiIdx) / batch.value(volIdx)) * dt, batch.value(maxIdx) * 0.5 * dt
+    };
+}
+#endif
+
+scalar computeCoNum(const SurfaceField<scalar>& faceFlux, const scalar dt)
+{
+    const auto coNum = computeCourantNumber(faceFlux, dt);
+    NF_INFO(
+        "Courant Number mean: " + std::to_string(coNum.mean) + " max: " + std::to_string(coNum.max)
     );
+    return coNum.max;
+}
 
-    scalar totalVol = 0.0;
-    Kokkos::Sum<NeoN::scalar> sumVol(totalVol);
-    parallelReduce(
-        exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli, scalar& lsum) { lsum += surfV[celli]; },
-        sumVol
+/* @brief converts the summed inverse time scales of the faces into the time steps of the cells
+ */
+static void invertTimeScales(
+    const UnstructuredMesh& mesh, const LocalTimeStepLimits& limits, Vector<scalar>& localDt
+)
+{
+    const auto maxDt = limits.maxDt;
+    const auto [dtV, vol] = views(localDt, mesh.cellVolumes());
+    parallelFor(
+        localDt.exec(),
+        localDt.range(),
+        KOKKOS_LAMBDA(const localIdx celli) {
+            // dtV holds sum_f 1 / dt_f * V, ie. the inverse time step times the cell volume
+            const scalar invDt = dtV[celli] / vol[celli];
+            dtV[celli] = invDt * maxDt > 1.0 ? 1.0 / invDt : maxDt;
+        },
+        "computeLocalTimeStep::invert"
     );
+}
 
-    maxCoNum = maxReducer.reference() * 0.5 * dt;
-    meanCoNum = 0.5 * (sumPhi.reference() / sumVol.reference()) * dt;
-    NF_INFO(
-        "Courant Number mean: " + std::to_string(meanCoNum) + " max: " + std::to_string(maxCoNum)
+void computeLocalTimeStep(
+    const SurfaceField<scalar>& faceFlux,
+    const SurfaceField<scalar>& gamma,
+    const LocalTimeStepLimits& limits,
+    Vector<scalar>& localDt
+)
+{
+    const UnstructuredMesh& mesh = faceFlux.mesh();
+    NF_ASSERT_EQUAL(localDt.size(), mesh.nCells());
+    const auto geometryScheme = GeometryScheme::readOrCreate(mesh);
+    const auto [flux, gammaV, magSf, deltaCoeffs] = views(
+        faceFlux.internalVector(),
+        gamma.internalVector(),
+        mesh.magFaceAreas(),
+        geometryScheme->nonOrthDeltaCoeffs().internalVector()
     );
+    const scalar coWeight = 0.5 / limits.maxCo;
+    const scalar diffusionWeight = 1.0 / limits.maxDiffusionNumber;
 
-    return maxCoNum;
+    fill(localDt, 0.0);
+    reduceFaceValues(
+        mesh,
+        localDt.view(),
+        KOKKOS_LAMBDA(const localIdx facei) {
+            return coWeight * Kokkos::abs(flux[facei])
+                 + diffusionWeight * gammaV[facei] * magSf[facei] * deltaCoeffs[facei];
+        },
+        false
+    );
+    invertTimeScales(mesh, limits, localDt);
+}
+
+void computeLocalTimeStep(
+    const SurfaceField<scalar>& faceFlux, const LocalTimeStepLimits& limits, Vector<scalar>& localDt
+)
+{
+    const UnstructuredMesh& mesh = faceFlux.mesh();
+    NF_ASSERT_EQUAL(localDt.size(), mesh.nCells());
+    const auto flux = faceFlux.internalVector().view();
+    const scalar coWeight = 0.5 / limits.maxCo;
+
+    fill(localDt, 0.0);
+    reduceFaceValues(
+        mesh,
+        localDt.view(),
+        KOKKOS_LAMBDA(const localIdx facei) { return coWeight * Kokkos::abs(flux[facei]); },
+        false
+    );
+    invertTimeScales(mesh, limits, localDt);
 }
 
 };
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <any>
+#include <unordered_set>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/memoryReport.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief returns the bytes of a field stored in a document, zero for unknown field types */
+static std::size_t fieldBytes(const std::any& field)
+{
+    if (const auto* f = std::any_cast<VolumeField<scalar>>(&field))
+    {
+        return f->memoryBytes();
+    }
+    if (const auto* f = std::any_cast<VolumeField<Vec3>>(&field))
+    {
+        return f->memoryBytes();
+    }
+    if (const auto* f = std::any_cast<SurfaceField<scalar>>(&field))
+    {
+        return f->memoryBytes();
+    }
+    if (const auto* f = std::any_cast<SurfaceField<Vec3>>(&field))
+    {
+        return f->memoryBytes();
+    }
+    return 0;
+}
+
+void reportMemory(MemoryReport& report, const Database& db)
+{
+    const auto all = [](const Document&) { return true; };
+
+    // the old time levels are the previous times of the old time documents
+    std::unordered_set<std::string> oldLevels;
+    for (const auto& name : db.names())
+    {
+        const auto& collection = db.at(name);
+        if (collection.type() != OldTimeDocument::typeName())
+        {
+            continue;
+        }
+        for (const auto& id : collection.find(all))
+        {
+            oldLevels.insert(collection.doc(id).get<std::string>("previousTime"));
+        }
+    }
+
+    for (const auto& name : db.names())
+    {
+        const auto& collection = db.at(name);
+        if (collection.type() != VectorDocument::typeName())
+        {
+            continue;
+        }
+        for (const auto& id : collection.find(all))
+        {
+            const auto& doc = collection.doc(id);
+            report.add(
+                oldLevels.contains(id) ? "old-time fields" : "fields",
+                doc.get<std::string>("name"),
+                fieldBytes(doc["field"])
+            );
+        }
+    }
+}
+
+MemoryReport memoryReport(const UnstructuredMesh& mesh, const Database& db)
+{
+    MemoryReport report(mesh.nCells());
+    mesh.reportMemory(report);
+    reportMemory(report, db);
+    return report;
+}
+
+} // namespace NeoN
@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "NeoN/core/macros.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/probes.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToCellStencil.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace
+{
+
+/* @brief a uniform grid of bins over the cell centres, to find the nearest cell centre */
+class CentreBins
+{
+public:
+
+    CentreBins(View<const Vec3> centres) : centres_(centres)
+    {
+        const auto nCells = centres.size();
+        lower_ = centres[0];
+        Vec3 upper = centres[0];
+        for (localIdx celli = 1; celli < nCells; celli++)
+        {
+            for (size_t d = 0; d < 3; d++)
+            {
+                lower_[d] = std::min(lower_[d], centres[celli][d]);
+                upper[d] = std::max(upper[d], centres[celli][d]);
+            }
+        }
+        // about one cell per bin
+        const auto nBins1D = std::max(1.0, std::floor(std::cbrt(static_cast<scalar>(nCells))));
+        for (size_t d = 0; d < 3; d++)
+        {
+            const scalar extent = upper[d] - lower_[d];
+            nBins_[d] = extent > 0 ? static_cast<localIdx>(nBins1D) : 1;
+            width_[d] = extent > 0 ? extent / static_cast<scalar>(nBins_[d]) : 1.0;
+        }
+        nBinCells_.assign(static_cast<size_t>(nBins_[0] * nBins_[1] * nBins_[2]) + 1, 0);
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            nBinCells_[static_cast<size_t>(bin(bins(centres[celli]))) + 1]++;
+        }
+        for (size_t b = 1; b < nBinCells_.size(); b++)
+        {
+            nBinCells_[b] += nBinCells_[b - 1];
+        }
+        binCells_.resize(static_cast<size_t>(nCells));
+        auto next = nBinCells_;
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            const auto b = static_cast<size_t>(bin(bins(centres[celli])));
+            binCells_[static_cast<size_t>(next[b]++)] = celli;
+        }
+    }
+
+    /* @brief the cell with the centre nearest to point */
+    localIdx nearest(const Vec3& point) const
+    {
+        const auto centre = bins(point);
+        const auto minWidth = std::min({width_[0], width_[1], width_[2]});
+        const auto maxRing = std::max({nBins_[0], nBins_[1], nBins_[2]});
+        bool found = false;
+        localIdx nearestCell = 0;
+        scalar nearestDistance = std::numeric_limits<scalar>::max();
+        for (localIdx ring = 0; ring <= maxRing; ring++)
+        {
+            forRing(
+                centre,
+                ring,
+                [&](localIdx b)
+                {
+                    for (auto i = nBinCells_[static_cast<size_t>(b)];
+                         i < nBinCells_[static_cast<size_t>(b) + 1];
+                         i++)
+                    {
+                        const auto celli = binCells_[static_cast<size_t>(i)];
+                        const auto distance = mag(centres_[celli] - point);
+                        if (distance < nearestDistance)
+                        {
+                            nearestDistance = distance;
+                            nearestCell = celli;
+                            found = true;
+                        }
+                    }
+                }
+            );
+            // the cells of the next rings are at least ring bin widths away from the bin of the
+            // point, or its projection into the grid, which is closer to all centres
+            if (found && nearestDistance <= static_cast<scalar>(ring) * minWidth)
+            {
+                break;
+            }
+        }
+        return nearestCell;
+    }
+
+private:
+
+    /* @brief the bin coordinates of point, points outside of the grid are clamped */
+    std::array<localIdx, 3> bins(const Vec3& point) const
+    {
+        std::array<localIdx, 3> ijk;
+        for (size_t d = 0; d < 3; d++)
+        {
+            const auto i = static_cast<localIdx>(std::floor((point[d] - lower_[d]) / width_[d]));
+            ijk[d] = std::clamp(i, localIdx(0), nBins_[d] - 1);
+        }
+        return ijk;
+    }
+
+    localIdx bin(const std::array<localIdx, 3>& ijk) const
+    {
+        return (ijk[2] * nBins_[1] + ijk[1]) * nBins_[0] + ijk[0];
+    }
+
+    /* @brief calls f for the bins at a Chebyshev distance of ring from the bin centre */
+    template<typename F>
+    void forRing(const std::array<localIdx, 3>& centre, localIdx ring, F f) const
+    {
+        std::array<localIdx, 3> lo;
+        std::array<localIdx, 3> hi;
+        for (size_t d = 0; d < 3; d++)
+        {
+            lo[d] = centre[d] > ring ? centre[d] - ring : 0;
+            hi[d] = std::min(centre[d] + ring, nBins_[d] - 1);
+        }
+        for (auto k = lo[2]; k <= hi[2]; k++)
+        {
+            for (auto j = lo[1]; j <= hi[1]; j++)
+            {
+                for (auto i = lo[0]; i <= hi[0]; i++)
+                {
+                    const bool onRing = i + ring == centre[0] || i == centre[0] + ring
+                                     || j + ring == centre[1] || j == centre[1] + ring
+                                     || k + ring == centre[2] || k == centre[2] + ring;
+                    if (onRing)
+                    {
+                        f(bin({i, j, k}));
+                    }
+                }
+            }
+        }
+    }
+
+    View<const Vec3> centres_;
+    Vec3 lower_;
+    std::array<localIdx, 3> nBins_;
+    std::array<scalar, 3> width_;
+    std::vector<localIdx> nBinCells_; // the offsets of the cells of every bin
+    std::vector<localIdx> binCells_;
+};
+
+}
+
+ProbeLocations::ProbeLocations(const UnstructuredMesh& mesh, const std::vector<Vec3>& points)
+    : cells_(points.size()), offsets_(mesh.exec(), 0), stencilCells_(mesh.exec(), 0),
+      weights_(mesh.exec(), 0)
+{
+    NF_ASSERT(mesh.nCells() > 0, "Probes require a mesh with cells.");
+    const auto centres = mesh.hostCellCentres().view();
+    const auto& stencil = CellToCellStencil::readOrCreate(mesh);
+    const auto neighboursHost = stencil.values().copyToHost();
+    const auto segmentsHost = stencil.segments().copyToHost();
+    const auto [neighbours, segments] = views(neighboursHost, segmentsHost);
+
+    const CentreBins bins(centres);
+    std::vector<localIdx> offsets {0};
+    std::vector<localIdx> stencilCells;
+    std::vector<scalar> weights;
+    for (size_t pointi = 0; pointi < points.size(); pointi++)
+    {
+        const auto& point = points[pointi];
+        const auto celli = bins.nearest(point);
+        cells_[pointi] = celli;
+
+        const auto start = stencilCells.size();
+        stencilCells.push_back(celli);
+        for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+        {
+            stencilCells.push_back(neighbours[i]);
+        }
+        // the distance below which the point is considered at the cell centre
+        scalar tolerance = 0;
+        for (auto i = start + 1; i < stencilCells.size(); i++)
+        {
+            tolerance = std::max(tolerance, 1e-6 * mag(centres[stencilCells[i]] - centres[celli]));
+        }
+        scalar sum = 0;
+        for (auto i = start; i < stencilCells.size(); i++)
+        {
+            const auto distance = mag(centres[stencilCells[i]] - point);
+            const scalar w = distance <= tolerance ? 1.0 : 1.0 / (distance * distance);
+            if (i == start && distance <= tolerance)
+            {
+                stencilCells.resize(start + 1);
+                weights.push_back(1.0);
+                sum = 1.0;
+                break;
+            }
+            weights.push_back(w);
+            sum += w;
+        }
+        for (auto i = start; i < stencilCells.size(); i++)
+        {
+            weights[i] /= sum;
+        }
+        offsets.push_back(static_cast<localIdx>(stencilCells.size()));
+    }
+    offsets_ = Vector<localIdx>(mesh.exec(), offsets);
+    stencilCells_ = Vector<localIdx>(mesh.exec(), stencilCells);
+    weights_ = Vector<scalar>(mesh.exec(), weights);
+}
+
+template<typename ValueType>
+Probes<ValueType>::Probes(
+    const UnstructuredMesh& mesh,
+    const std::vector<Vec3>& points,
+    localIdx nFields,
+    localIdx bufferSteps,
+    ProbeWriter<ValueType> writer
+)
+    : locations_(mesh, points), nFields_(nFields), bufferSteps_(bufferSteps),
+      writer_(std::move(writer)),
+      buffers_ {
+          Vector<ValueType>(mesh.exec(), bufferSteps * nFields * locations_.size()),
+          Vector<ValueType>(mesh.exec(), bufferSteps * nFields * locations_.size())
+      }
+{
+    NF_ASSERT(bufferSteps > 0, "Probes require a buffer of at least one step.");
+}
+
+template<typename ValueType>
+void Probes<ValueType>::sample(
+    const std::vector<const VolumeField<ValueType>*>& fields, scalar time
+)
+{
+    NF_ASSERT_EQUAL(static_cast<localIdx>(fields.size()), nFields_);
+    auto& times = times_[active_];
+    const auto step = static_cast<localIdx>(times.size());
+    const auto nProbes = locations_.size();
+    const auto [offsets, stencilCells, weights] =
+        views(locations_.offsets(), locations_.stencilCells(), locations_.weights());
+    auto buffer = buffers_[active_].view();
+
+    for (localIdx start = 0; start < nFields_; start += maxBatchSize)
+    {
+        const auto nBatch = std::min(maxBatchSize, nFields_ - start);
+        ViewBatch<const ValueType> values;
+        for (localIdx k = 0; k < nBatch; k++)
+        {
+            values[k] = fields[static_cast<size_t>(start + k)]->internalVector().view();
+        }
+        const auto first = (step * nFields_ + start) * nProbes;
+        parallelFor(
+            locations_.offsets().exec(),
+            {0, nProbes},
+            KOKKOS_LAMBDA(const localIdx probei) {
+                for (localIdx k = 0; k < nBatch; k++)
+                {
+                    ValueType value = zero<ValueType>();
+                    for (auto i = offsets[probei]; i < offsets[probei + 1]; i++)
+                    {
+                        value += weights[i] * values[k][stencilCells[i]];
+                    }
+                    buffer[first + k * nProbes + probei] = value;
+                }
+            },
+            "sampleProbes"
+        );
+    }
+    times.push_back(time);
+    if (step + 1 == bufferSteps_)
+    {
+        flush();
+    }
+}
+
+template<typename ValueType>
+void Probes<ValueType>::flush()
+{
+    if (times_[active_].empty())
+    {
+        return;
+    }
+    mirrors_[active_].syncToHostAsync(buffers_[active_]);
+    pending_[active_] = true;
+    active_ = 1 - active_;
+    // the other buffer is reused, its samples have to be written before
+    write(active_);
+}
+
+template<typename ValueType>
+void Probes<ValueType>::finish()
+{
+    flush();
+    write(0);
+    write(1);
+}
+
+template<typename ValueType>
+void Probes<ValueType>::write(std::size_t b)
+{
+    if (pending_[b])
+    {
+        const ProbeSamples<ValueType> samples {
+            times_[b], nFields_, locations_.size(), std::as_const(mirrors_[b]).view()
+        };
+        writer_(samples);
+        pending_[b] = false;
+    }
+    times_[b].clear();
+}
+
+#define NF_DECLARE_PROBES(TYPENAME) template class Probes<TYPENAME>
+
+NN_FOR_ALL_VALUE_TYPES(NF_DECLARE_PROBES);
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <sstream>
+
+#include "NeoN/finiteVolume/cellCentred/auxiliary/schemeCache.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+std::optional<std::string> schemeCacheKey(const TokenList& tokens)
+{
+    std::ostringstream os;
+    os.precision(17);
+    const auto& values = tokens.tokens();
+    for (std::size_t i = tokens.nextIndex(); i < values.size(); i++)
+    {
+        if (!writeContentKey(os, values[i]))
+        {
+            return std::nullopt;
+        }
+        os << ";";
+    }
+    return os.str();
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
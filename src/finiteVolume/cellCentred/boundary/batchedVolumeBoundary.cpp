@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/macros.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/boundary/batchedVolumeBoundary.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+template<typename ValueType>
+std::vector<BatchedBoundaryParameters<ValueType>>
+collectParameters(const std::vector<VolumeBoundary<ValueType>>& bcs)
+{
+    std::vector<BatchedBoundaryParameters<ValueType>> parameters;
+    parameters.reserve(bcs.size());
+    for (const auto& bc : bcs)
+    {
+        parameters.push_back(bc.batchedParameters());
+    }
+    return parameters;
+}
+
+template<typename ValueType>
+BatchedVolumeBoundary<ValueType>::BatchedVolumeBoundary(
+    const UnstructuredMesh& mesh, const std::vector<VolumeBoundary<ValueType>>& bcs
+)
+    : mesh_(mesh), patchKinds_(mesh.exec(), 0),
+      patchValues_(mesh.exec(), 0), custom_(), batched_(false), writesRefValue_(false),
+      writesRefGrad_(false)
+{
+    const auto parameters = collectParameters(bcs);
+    std::vector<int> patchKinds;
+    std::vector<ValueType> patchValues;
+    for (std::size_t patchi = 0; patchi < bcs.size(); patchi++)
+    {
+        const auto [start, end] = bcs[patchi].range();
+        const auto kind = parameters[patchi].kind;
+        patchKinds.push_back(static_cast<int>(kind));
+        patchValues.push_back(parameters[patchi].value);
+        if (kind == BatchedBoundaryKind::Custom)
+        {
+            custom_.push_back(patchi);
+        }
+        else if (kind != BatchedBoundaryKind::None && start != end)
+        {
+            batched_ = true;
+            writesRefValue_ = writesRefValue_ || kind != BatchedBoundaryKind::FixedGradient;
+            writesRefGrad_ = writesRefGrad_ || kind == BatchedBoundaryKind::FixedGradient;
+        }
+    }
+    patchKinds_ = Vector<int>(mesh.exec(), patchKinds);
+    patchValues_ = Vector<ValueType>(mesh.exec(), patchValues);
+}
+
+template<typename ValueType>
+void BatchedVolumeBoundary<ValueType>::correctBoundaryConditions(
+    Field<ValueType>& domainVector, std::vector<VolumeBoundary<ValueType>>& bcs
+) const
+{
+    if (batched_)
+    {
+        const auto iVector = domainVector.internalVector().view();
+        auto& boundaryData = domainVector.boundaryData();
+        auto [value, valueFraction] = views(boundaryData.value(), boundaryData.valueFraction());
+        // only the components which are read for the present kinds are touched
+        View<ValueType> refValue;
+        View<ValueType> refGradient;
+        if (writesRefValue_)
+        {
+            refValue = boundaryData.refValue().view();
+        }
+        if (writesRefGrad_)
+        {
+            refGradient = boundaryData.refGrad().view();
+        }
+        const auto [facePatch, kinds, patchValues, faceCells, deltaCoeffs] = views(
+            mesh_.boundaryMesh().facePatch(),
+            patchKinds_,
+            patchValues_,
+            mesh_.boundaryMesh().faceCells(),
+            mesh_.boundaryMesh().deltaCoeffs()
+        );
+
+        parallelFor(
+            domainVector.exec(),
+            {0, mesh_.nBoundaryFaces()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                const auto patchi = facePatch[i];
+                const auto kind = static_cast<BatchedBoundaryKind>(kinds[patchi]);
+                const ValueType patchValue = patchValues[patchi];
+                if (kind == BatchedBoundaryKind::FixedValue)
+                {
+                    refValue[i] = patchValue;
+                    value[i] = patchValue;
+                    valueFraction[i] = 1.0;
+                }
+                else if (kind == BatchedBoundaryKind::FixedGradient)
+                {
+                    refGradient[i] = patchValue;
+                    value[i] = iVector[faceCells[i]] + patchValue * (1 / deltaCoeffs[i]);
+                    valueFraction[i] = 0.0;
+                }
+                else if (kind == BatchedBoundaryKind::Extrapolated)
+                {
+                    const ValueType internalCellValue = iVector[faceCells[i]];
+                    value[i] = internalCellValue;
+                    valueFraction[i] = 1.0;
+                    refValue[i] = internalCellValue;
+                }
+            },
+            "correctBatchedBoundaryConditions"
+        );
+    }
+    for (const auto patchi : custom_)
+    {
+        bcs[patchi].correctBoundaryCondition(domainVector);
+    }
+}
+
+#define NN_DECLARE_BATCHED_BOUNDARY(TYPENAME) template class BatchedVolumeBoundary<TYPENAME>
+
+NN_FOR_ALL_VALUE_TYPES(NN_DECLARE_BATCHED_BOUNDARY);
+
+}
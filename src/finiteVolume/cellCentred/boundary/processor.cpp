@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "NeoN/finiteVolume/cellCentred/boundary/volume/processor.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+void setProcessorCommunicator(const UnstructuredMesh& mesh, Communicator& comm)
+{
+    auto& stencilDB = mesh.stencilDB();
+    if (stencilDB.contains("ProcessorCommunicator"))
+    {
+        stencilDB.get<Communicator*>("ProcessorCommunicator") = &comm;
+        return;
+    }
+    stencilDB.insert("ProcessorCommunicator", &comm);
+}
+
+Communicator& processorCommunicator(const UnstructuredMesh& mesh)
+{
+    const auto& stencilDB = mesh.stencilDB();
+    NF_ASSERT(
+        stencilDB.contains("ProcessorCommunicator"),
+        "No communicator is registered for the processor patches of the mesh."
+    );
+    return *stencilDB.get<Communicator*>("ProcessorCommunicator");
+}
+
+std::pair<Vector<localIdx>, Vector<globalIdx>> processorInterface(
+    const UnstructuredMesh& mesh, localIdx patchID, const la::GlobalRowNumbering& numbering
+)
+{
+    const auto& offset = mesh.boundaryMesh().offset();
+    const auto start = offset[static_cast<size_t>(patchID)];
+    const auto nPatchFaces = offset[static_cast<size_t>(patchID) + 1] - start;
+    const auto nCells = mesh.nCells();
+
+    Vector<localIdx> rows(mesh.exec(), nPatchFaces);
+    Vector<localIdx> haloIdxs(mesh.exec(), nPatchFaces);
+    auto [rowsV, haloV] = views(rows, haloIdxs);
+    const auto faceCells = mesh.boundaryMesh().faceCells().view();
+    parallelFor(
+        mesh.exec(),
+        {0, nPatchFaces},
+        KOKKOS_LAMBDA(const localIdx i) {
+            rowsV[i] = static_cast<localIdx>(faceCells[start + i]);
+            haloV[i] = nCells + i;
+        },
+        "processorInterface"
+    );
+    auto& comm = processorCommunicator(mesh);
+    auto cols = la::exchangeGlobalIdxs(comm, numbering, haloIdxs, nCells + nPatchFaces);
+    return {std::move(rows), std::move(cols)};
+}
+
+namespace volumeBoundary::detail
+{
+
+namespace
+{
+
+struct ProcessorCommNames
+{
+    std::mutex mutex;
+    std::size_t counter {0};
+    std::set<std::size_t> released;
+};
+
+ProcessorCommNames& processorCommNames()
+{
+    static ProcessorCommNames names;
+    return names;
+}
+
+constexpr std::string_view processorCommPrefix = "processor";
+
+}
+
+std::string nextProcessorCommName()
+{
+    auto& names = processorCommNames();
+    const std::lock_guard<std::mutex> lock(names.mutex);
+    if (names.released.empty())
+    {
+        return std::string(processorCommPrefix) + std::to_string(names.counter++);
+    }
+    const auto id = *names.released.begin();
+    names.released.erase(names.released.begin());
+    return std::string(processorCommPrefix) + std::to_string(id);
+}
+
+void releaseProcessorCommName(const std::string& name)
+{
+    auto& names = processorCommNames();
+    const std::lock_guard<std::mutex> lock(names.mutex);
+    names.released.insert(std::stoul(name.substr(processorCommPrefix.size())));
+}
+
+CommPrecision processorPrecision(const Dictionary& dict)
+{
+    if (!dict.contains("precision"))
+    {
+        return CommPrecision::Full;
+    }
+    const auto precision = dict.get<std::string>("precision");
+    if (precision == "single")
+    {
+        return CommPrecision::Single;
+    }
+    NF_ASSERT(precision == "full", "Unknown processor exchange precision: " << precision);
+    return CommPrecision::Full;
+}
+
+}
+
+}
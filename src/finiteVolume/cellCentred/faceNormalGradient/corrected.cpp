@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+
+#include "NeoN/finiteVolume/cellCentred/faceNormalGradient/corrected.hpp"
+#include "NeoN/finiteVolume/cellCentred/faceNormalGradient/uncorrected.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief adds the correction k_f & (grad s)_f to the internal faces */
+void addNonOrthCorrection(
+    const VolumeField<Vec3>& gradVolVector,
+    const std::shared_ptr<GeometryScheme> geometryScheme,
+    SurfaceField<scalar>& surfaceVector
+)
+{
+    const UnstructuredMesh& mesh = surfaceVector.mesh();
+    const auto [owner, neighbour] = views(mesh.faceOwner(), mesh.faceNeighbour());
+    auto phif = surfaceVector.internalVector().view();
+    const auto [gradPhi, weights, correctionVec3s] = views(
+        gradVolVector.internalVector(),
+        geometryScheme->weights().internalVector(),
+        geometryScheme->nonOrthCorrectionVec3s().internalVector()
+    );
+
+    NeoN::parallelFor(
+        surfaceVector.exec(),
+        {0, mesh.nInternalFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            const auto w = weights[facei];
+            const Vec3 gradf = w * gradPhi[owner[facei]] + (1.0 - w) * gradPhi[neighbour[facei]];
+            phif[facei] += correctionVec3s[facei] & gradf;
+        },
+        "computeCorrectedFaceNormalGrad"
+    );
+}
+
+void computeCorrectedFaceNormalGrad(
+    const VolumeField<scalar>& volVector,
+    const std::shared_ptr<GeometryScheme> geometryScheme,
+    SurfaceField<scalar>& surfaceVector
+)
+{
+    computeFaceNormalGrad(volVector, geometryScheme, surfaceVector);
+    if (volVector.registered())
+    {
+        addNonOrthCorrection(cachedGrad(volVector), geometryScheme, surfaceVector);
+        return;
+    }
+    const auto gradVolVector = GaussGreenGrad(volVector.exec(), volVector.mesh()).grad(volVector);
+    addNonOrthCorrection(gradVolVector, geometryScheme, surfaceVector);
+}
+
+} // namespace NeoN
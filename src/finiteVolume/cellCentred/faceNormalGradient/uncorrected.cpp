@@ -23,10 +23,9 @@ void computeFaceNormalGrad(
         views(mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
 
 
-    const auto [phif, phi, phiBCValue, nonOrthDeltaCoeffs] = views(
+    const auto [phif, phi, nonOrthDeltaCoeffs] = views(
         surfaceVector.internalVector(),
         volVector.internalVector(),
-        volVector.boundaryData().value(),
         geometryScheme->nonOrthDeltaCoeffs().internalVector()
     );
 
@@ -37,9 +36,14 @@ void computeFaceNormalGrad(
         {0, nInternalFaces},
         KOKKOS_LAMBDA(const localIdx facei) {
             phif[facei] = nonOrthDeltaCoeffs[facei] * (phi[neighbour[facei]] - phi[owner[facei]]);
-        }
+        },
+        "Uncorrected::internal"
     );
 
+    // the boundary values are read after the internal faces are computed, hence a pending halo
+    // exchange of a processor patch is finalised only now, see Processor
+    const auto phiBCValue = volVector.boundaryData().value().view();
+
     NeoN::parallelFor(
         exec,
         {nInternalFaces, phif.size()},
@@ -48,7 +52,8 @@ void computeFaceNormalGrad(
             auto own = surfFaceCells[faceBCI];
 
             phif[facei] = nonOrthDeltaCoeffs[facei] * (phiBCValue[faceBCI] - phi[own]);
-        }
+        },
+        "Uncorrected::boundary"
     );
 }
 
@@ -18,7 +18,13 @@ VolumeField<ValueType>::VolumeField(
     const std::vector<VolumeBoundary<ValueType>>& boundaryConditions
 )
     : DomainMixin<ValueType>(
-        exec, name, mesh, Field<ValueType>(exec, mesh.nCells(), mesh.boundaryMesh().offset())
+        exec,
+        name,
+        mesh,
+        // the ghost cells of the mesh store the remote values after the local cells
+        Field<ValueType>(
+            exec, mesh.nCells() + mesh.nGhostCells(), mesh.boundaryMesh().offset()
+        )
     ),
       key(""), fieldCollectionName(""), boundaryConditions_(boundaryConditions), db_(std::nullopt)
 {}
@@ -69,7 +75,8 @@ VolumeField<ValueType>::VolumeField(
 template<typename ValueType>
 VolumeField<ValueType>::VolumeField(const VolumeField& other)
     : DomainMixin<ValueType>(other), key(other.key), fieldCollectionName(other.fieldCollectionName),
-      boundaryConditions_(other.boundaryConditions_), db_(other.db_)
+      boundaryConditions_(other.boundaryConditions_), db_(other.db_),
+      batchedBoundary_(other.batchedBoundary_)
 {}
 
 template<typename ValueType>
@@ -91,10 +98,12 @@ VolumeField<ValueType>& VolumeField<ValueType>::operator-=(const ValueType rhs)
 template<typename ValueType>
 void VolumeField<ValueType>::correctBoundaryConditions()
 {
-    for (auto& boundaryCondition : boundaryConditions_)
+    if (!batchedBoundary_)
     {
-        boundaryCondition.correctBoundaryCondition(this->field_);
+        batchedBoundary_ =
+            std::make_shared<BatchedVolumeBoundary<ValueType>>(this->mesh(), boundaryConditions_);
     }
+    batchedBoundary_->correctBoundaryConditions(this->field_, boundaryConditions_);
 }
 
 #define NN_DECLARE_FIELD(TYPENAME) template class VolumeField<TYPENAME>
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/macros.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeFieldBlock.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace
+{
+
+/* @brief copies the nValues values of src into dst, both on exec */
+template<typename ValueType>
+void copyValues(
+    const Executor& exec, View<const ValueType> src, View<ValueType> dst, localIdx nValues
+)
+{
+    parallelFor(
+        exec,
+        {0, nValues},
+        KOKKOS_LAMBDA(const localIdx i) { dst[i] = src[i]; },
+        "copyVolumeFieldBlock"
+    );
+}
+
+}
+
+template<typename ValueType>
+VolumeFieldBlock<ValueType>::VolumeFieldBlock(
+    const Executor& exec,
+    std::string blockName,
+    const UnstructuredMesh& mesh,
+    const std::vector<std::string>& componentNames,
+    const std::vector<VolumeBoundary<ValueType>>& boundaryConditions
+)
+    : name(blockName), mesh_(mesh),
+      internalVector_(exec, static_cast<localIdx>(componentNames.size()) * mesh.nCells()),
+      componentNames_(componentNames),
+      boundaryData_(
+          componentNames.size(), BoundaryData<ValueType>(exec, mesh.boundaryMesh().offset())
+      ),
+      boundaryConditions_(componentNames.size(), boundaryConditions)
+{}
+
+template<typename ValueType>
+VolumeFieldBlock<ValueType>::VolumeFieldBlock(
+    std::string blockName, const std::vector<const VolumeField<ValueType>*>& fields
+)
+    : name(blockName), mesh_(fields.at(0)->mesh()),
+      internalVector_(fields[0]->exec(), static_cast<localIdx>(fields.size()) * mesh_.nCells())
+{
+    for (std::size_t k = 0; k < fields.size(); k++)
+    {
+        NF_ASSERT(&fields[k]->mesh() == &mesh_, "The fields of a block have to share the mesh.");
+        NF_ASSERT(
+            fields[k]->exec() == exec(), "The fields of a block have to share the executor."
+        );
+        componentNames_.push_back(fields[k]->name);
+        boundaryData_.push_back(fields[k]->boundaryData());
+        boundaryConditions_.push_back(fields[k]->boundaryConditions());
+        copyValues<ValueType>(
+            exec(),
+            fields[k]->internalVector().view(),
+            internalVector_.view(range(static_cast<localIdx>(k))),
+            nCells()
+        );
+    }
+}
+
+template<typename ValueType>
+VolumeField<ValueType> VolumeFieldBlock<ValueType>::component(const localIdx k) const
+{
+    VolumeField<ValueType> field(
+        exec(),
+        componentName(k),
+        mesh_,
+        Vector<ValueType>(exec(), nCells()),
+        boundaryData(k),
+        boundaryConditions(k)
+    );
+    copyValues<ValueType>(
+        exec(), internalVector_.view(range(k)), field.internalVector().view(), nCells()
+    );
+    return field;
+}
+
+template<typename ValueType>
+void VolumeFieldBlock<ValueType>::assign(const localIdx k, const VolumeField<ValueType>& field)
+{
+    NF_ASSERT(&field.mesh() == &mesh_, "The field does not share the mesh of the block.");
+    NF_ASSERT(field.exec() == exec(), "The field does not share the executor of the block.");
+    copyValues<ValueType>(
+        exec(), field.internalVector().view(), internalVector_.view(range(k)), nCells()
+    );
+    boundaryData(k) = field.boundaryData();
+}
+
+template<typename ValueType>
+void VolumeFieldBlock<ValueType>::correctBoundaryConditions()
+{
+    for (localIdx k = 0; k < nComponents(); k++)
+    {
+        auto field = component(k);
+        field.correctBoundaryConditions();
+        boundaryData(k) = field.boundaryData();
+    }
+}
+
+template<typename ValueType>
+std::size_t VolumeFieldBlock<ValueType>::memoryBytes() const
+{
+    std::size_t bytes = internalVector_.memoryBytes();
+    for (const auto& data : boundaryData_)
+    {
+        bytes += data.memoryBytes();
+    }
+    return bytes;
+}
+
+#define NN_DECLARE_FIELD_BLOCK(TYPENAME) template class VolumeFieldBlock<TYPENAME>
+
+NN_FOR_ALL_VALUE_TYPES(NN_DECLARE_FIELD_BLOCK);
+
+}
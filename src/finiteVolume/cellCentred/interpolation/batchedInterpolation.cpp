@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/faceDirection.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceRanges.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+template<typename ValueType>
+void computeBatchedInterpolation(
+    InlineInterpolation kind,
+    const SurfaceField<scalar>& flux,
+    const std::vector<const VolumeField<ValueType>*>& srcs,
+    const std::vector<SurfaceField<ValueType>*>& dsts
+)
+{
+    NF_ASSERT(kind != InlineInterpolation::None, "Scheme cannot be evaluated inline.");
+    NF_ASSERT(srcs.size() == dsts.size(), "Number of source and destination fields differ.");
+    const UnstructuredMesh& mesh = flux.mesh();
+    const auto exec = flux.exec();
+    const auto& weights = GeometryScheme::readOrCreate(mesh)->weights();
+    const auto [weightsV, owner, neighbour] =
+        views(weights.internalVector(), mesh.faceOwner(), mesh.faceNeighbour());
+    const bool upwind = kind == InlineInterpolation::Upwind;
+    // the upwind weight only depends on the sign of the flux
+    const auto directions = upwind ? FaceDirection::readOrCreate(flux).directions().view()
+                                   : View<const std::uint32_t> {};
+    const auto nTotal = static_cast<localIdx>(srcs.size());
+
+    for (localIdx start = 0; start < nTotal; start += maxBatchSize)
+    {
+        const localIdx nFields = std::min(maxBatchSize, nTotal - start);
+        ViewBatch<const ValueType> srcV;
+        ViewBatch<const ValueType> srcB;
+        ViewBatch<ValueType> dstV;
+        for (localIdx k = 0; k < nFields; k++)
+        {
+            srcV[k] = srcs[start + k]->internalVector().view();
+            srcB[k] = srcs[start + k]->boundaryData().value().view();
+            dstV[k] = dsts[start + k]->internalVector().view();
+        }
+
+        parallelForFaces(
+            exec,
+            mesh,
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const scalar w = upwind ? (ownerUpwind(directions, facei) ? 1.0 : 0.0)
+                                        : weightsV[facei];
+                const auto own = owner[facei];
+                const auto nei = neighbour[facei];
+                for (localIdx k = 0; k < nFields; k++)
+                {
+                    dstV[k][facei] = w * srcV[k][own] + (1 - w) * srcV[k][nei];
+                }
+            },
+            KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+                const scalar w = weightsV[facei];
+                for (localIdx k = 0; k < nFields; k++)
+                {
+                    dstV[k][facei] = w * srcB[k][bfacei];
+                }
+            },
+            "computeBatchedInterpolation"
+        );
+    }
+}
+
+#define NF_DECLARE_COMPUTE_BATCHED_INT(TYPENAME)                                                   \
+    template void computeBatchedInterpolation<TYPENAME>(                                           \
+        InlineInterpolation,                                                                       \
+        const SurfaceField<scalar>&,                                                               \
+        const std::vector<const VolumeField<TYPENAME>*>&,                                          \
+        const std::vector<SurfaceField<TYPENAME>*>&                                                \
+    )
+
+NF_DECLARE_COMPUTE_BATCHED_INT(scalar);
+NF_DECLARE_COMPUTE_BATCHED_INT(Vec3);
+
+} // namespace NeoN
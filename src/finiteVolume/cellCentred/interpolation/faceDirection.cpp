@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/faceDirection.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+FaceDirection::FaceDirection(const SurfaceField<scalar>& flux)
+    : flux_(flux.internalVector().data()), fluxVersion_(flux.internalVector().version()),
+      directions_(
+          flux.exec(),
+          (flux.mesh().nInternalFaces() + facesPerDirectionWord - 1) / facesPerDirectionWord
+      )
+{
+    const auto nInternalFaces = flux.mesh().nInternalFaces();
+    const auto fluxV = flux.internalVector().view();
+    auto directionsV = directions_.view();
+    // one thread per word, hence the words are written without atomics
+    parallelFor(
+        flux.exec(),
+        {0, directions_.size()},
+        KOKKOS_LAMBDA(const localIdx wordi) {
+            const auto start = wordi * facesPerDirectionWord;
+            const auto end = Kokkos::min(start + facesPerDirectionWord, nInternalFaces);
+            std::uint32_t word = 0;
+            for (auto facei = start; facei < end; facei++)
+            {
+                word |= static_cast<std::uint32_t>(fluxV[facei] >= 0) << (facei - start);
+            }
+            directionsV[wordi] = word;
+        },
+        "computeFaceDirection"
+    );
+}
+
+bool FaceDirection::upToDate(const SurfaceField<scalar>& flux) const
+{
+    return flux_ == flux.internalVector().data() && fluxVersion_ == flux.internalVector().version();
+}
+
+const FaceDirection& FaceDirection::readOrCreate(const SurfaceField<scalar>& flux)
+{
+    static const StencilKey<FaceDirectionCache> key("FaceDirection");
+    auto& entries =
+        flux.mesh().stencilDB().getOrCreate(key, []() { return FaceDirectionCache {}; }).entries;
+    const auto* data = flux.internalVector().data();
+    auto entry = std::find_if(
+        entries.begin(), entries.end(), [&](const auto& e) { return e.flux_ == data; }
+    );
+    if (entry != entries.end() && entry->upToDate(flux))
+    {
+        std::rotate(entry, entry + 1, entries.end());
+        return entries.back();
+    }
+    if (entry != entries.end())
+    {
+        entries.erase(entry);
+    }
+    else if (entries.size() == FaceDirectionCache::maxEntries)
+    {
+        entries.erase(entries.begin());
+    }
+    entries.emplace_back(flux);
+    return entries.back();
+}
+
+std::size_t FaceDirectionCache::memoryBytes() const
+{
+    std::size_t bytes = 0;
+    for (const auto& entry : entries)
+    {
+        bytes += entry.memoryBytes();
+    }
+    return bytes;
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
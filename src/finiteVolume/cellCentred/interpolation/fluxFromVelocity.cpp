@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/fluxFromVelocity.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceRanges.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the flux of a velocity field interpolated with the geometric weights */
+static void computeLinearFlux(const VolumeField<Vec3>& u, SurfaceField<scalar>& phi)
+{
+    const UnstructuredMesh& mesh = phi.mesh();
+    const auto& weights = GeometryScheme::readOrCreate(mesh)->weights();
+    auto phiV = phi.internalVector().view();
+    const auto [uV, uB, weightsV, faceAreas, owner, neighbour] = views(
+        u.internalVector(),
+        u.boundaryData().value(),
+        weights.internalVector(),
+        mesh.faceAreas(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour()
+    );
+
+    parallelForFaces(
+        phi.exec(),
+        mesh,
+        KOKKOS_LAMBDA(const localIdx facei) {
+            const scalar w = weightsV[facei];
+            const Vec3 uf = w * uV[owner[facei]] + (1 - w) * uV[neighbour[facei]];
+            phiV[facei] = uf & faceAreas[facei];
+        },
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            phiV[facei] = (weightsV[facei] * uB[bfacei]) & faceAreas[facei];
+        },
+        "fluxFromVelocity"
+    );
+}
+
+void fluxFromVelocity(
+    const SurfaceInterpolation<Vec3>& interpolation,
+    const VolumeField<Vec3>& u,
+    SurfaceField<scalar>& phi
+)
+{
+    if (interpolation.inlineInterpolation() == InlineInterpolation::Linear)
+    {
+        computeLinearFlux(u, phi);
+        return;
+    }
+    const UnstructuredMesh& mesh = phi.mesh();
+    SurfaceField<Vec3> uf(
+        phi.exec(), "interpolated_" + u.name, mesh, createCalculatedBCs<SurfaceBoundary<Vec3>>(mesh)
+    );
+    interpolation.interpolate(u, uf);
+    const auto [ufV, faceAreas] = views(uf.internalVector(), mesh.faceAreas());
+    auto phiV = phi.internalVector().view();
+    parallelFor(
+        phi.exec(),
+        phi.internalVector().range(),
+        KOKKOS_LAMBDA(const localIdx facei) { phiV[facei] = ufV[facei] & faceAreas[facei]; },
+        "fluxFromVelocity::dot"
+    );
+}
+
+} // namespace NeoN
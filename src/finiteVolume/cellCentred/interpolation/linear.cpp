@@ -5,7 +5,9 @@
 #include <memory>
 
 #include "NeoN/finiteVolume/cellCentred/interpolation/linear.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceRanges.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/simd.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -19,30 +21,85 @@ void computeLinearInterpolation(
 {
     const auto exec = dst.exec();
     auto dstS = dst.internalVector().view();
-    const auto [srcS, weightS, ownerS, neighS, boundS] = views(
+    const auto [srcS, weightS, ownerS, neighS] = views(
         src.internalVector(),
         weights.internalVector(),
         dst.mesh().faceOwner(),
-        dst.mesh().faceNeighbour(),
-        src.boundaryData().value()
+        dst.mesh().faceNeighbour()
     );
     auto nInternalFaces = dst.mesh().nInternalFaces();
 
-    NeoN::parallelFor(
+    auto internalKernel = KOKKOS_LAMBDA(const localIdx facei)
+    {
+        auto own = ownerS[facei];
+        auto nei = neighS[facei];
+        dstS[facei] = weightS[facei] * srcS[own] + (1 - weightS[facei]) * srcS[nei];
+    };
+    if constexpr (std::is_same_v<ValueType, scalar>)
+    {
+        simdParallelFor(
+            exec,
+            {0, nInternalFaces},
+            [=](const localIdx facei)
+            {
+                const auto w = simdLoad(weightS.data() + facei);
+                const auto own = simdGather(srcS.data(), ownerS.data() + facei);
+                const auto nei = simdGather(srcS.data(), neighS.data() + facei);
+                simdStore(w * own + (SimdScalar(1.0) - w) * nei, dstS.data() + facei);
+            },
+            internalKernel,
+            "computeLinearInterpolationInternal"
+        );
+    }
+    else
+    {
+        parallelFor(
+            exec, {0, nInternalFaces}, internalKernel, "computeLinearInterpolationInternal"
+        );
+    }
+
+    // the boundary values are read after the internal faces are interpolated, hence a pending
+    // halo exchange of a processor patch is finalised only now, see Processor
+    const auto boundS = src.boundaryData().value().view();
+    parallelForBoundaryFaces(
         exec,
-        {0, dstS.size()},
+        dst.mesh(),
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            dstS[facei] = weightS[facei] * boundS[bfacei];
+        },
+        "computeLinearInterpolationBoundary"
+    );
+}
+
+template<typename ValueType>
+void computeLinearInterpolation(
+    const VolumeField<ValueType>& src, const Vector<float>& weights, SurfaceField<ValueType>& dst
+)
+{
+    NF_ASSERT_EQUAL(weights.size(), dst.internalVector().size());
+    const auto exec = dst.exec();
+    auto dstS = dst.internalVector().view();
+    const auto [srcS, weightS, ownerS, neighS] =
+        views(src.internalVector(), weights, dst.mesh().faceOwner(), dst.mesh().faceNeighbour());
+
+    parallelFor(
+        exec,
+        {0, dst.mesh().nInternalFaces()},
         KOKKOS_LAMBDA(const localIdx facei) {
-            if (facei < nInternalFaces)
-            {
-                auto own = ownerS[facei];
-                auto nei = neighS[facei];
-                dstS[facei] = weightS[facei] * srcS[own] + (1 - weightS[facei]) * srcS[nei];
-            }
-            else
-            {
-                dstS[facei] = weightS[facei] * boundS[facei - nInternalFaces];
-            }
-        }
+            const scalar w = load(weightS[facei]);
+            dstS[facei] = w * srcS[ownerS[facei]] + (1 - w) * srcS[neighS[facei]];
+        },
+        "computeLinearInterpolationFloatWeightsInternal"
+    );
+
+    const auto boundS = src.boundaryData().value().view();
+    parallelForBoundaryFaces(
+        exec,
+        dst.mesh(),
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            dstS[facei] = scalar(load(weightS[facei])) * boundS[bfacei];
+        },
+        "computeLinearInterpolationFloatWeightsBoundary"
     );
 }
 
@@ -53,6 +110,13 @@ void computeLinearInterpolation(
 NF_DECLARE_COMPUTE_IMP_LIN_INT(scalar);
 NF_DECLARE_COMPUTE_IMP_LIN_INT(Vec3);
 
+#define NF_DECLARE_COMPUTE_IMP_LIN_INT_FLOAT(TYPENAME)                                             \
+    template void computeLinearInterpolation<                                                      \
+        TYPENAME>(const VolumeField<TYPENAME>&, const Vector<float>&, SurfaceField<TYPENAME>&)
+
+NF_DECLARE_COMPUTE_IMP_LIN_INT_FLOAT(scalar);
+NF_DECLARE_COMPUTE_IMP_LIN_INT_FLOAT(Vec3);
+
 // template class Linear<scalar>;
 // template class Linear<Vec3>;
 
@@ -5,7 +5,10 @@
 #include <memory>
 
 #include "NeoN/finiteVolume/cellCentred/interpolation/upwind.hpp"
+#include "NeoN/finiteVolume/cellCentred/interpolation/faceDirection.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceRanges.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/simd.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -20,39 +23,53 @@ void computeUpwindInterpolation(
 {
     const auto exec = dst.exec();
     auto dstS = dst.internalVector().view();
-    const auto [srcS, weightS, ownerS, neighS, boundS, fluxS] = views(
+    const auto [srcS, weightS, ownerS, neighS, fluxS] = views(
         src.internalVector(),
         weights.internalVector(),
         dst.mesh().faceOwner(),
         dst.mesh().faceNeighbour(),
-        src.boundaryData().value(),
         flux.internalVector()
     );
     auto nInternalFaces = dst.mesh().nInternalFaces();
+    const auto directions = FaceDirection::readOrCreate(flux).directions().view();
 
-    parallelFor(
-        exec,
-        {0, dstS.size()},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            if (facei < nInternalFaces)
+    auto internalKernel = KOKKOS_LAMBDA(const localIdx facei)
+    {
+        dstS[facei] = ownerUpwind(directions, facei) ? srcS[ownerS[facei]] : srcS[neighS[facei]];
+    };
+    if constexpr (std::is_same_v<ValueType, scalar>)
+    {
+        simdParallelFor(
+            exec,
+            {0, nInternalFaces},
+            [=](const localIdx facei)
             {
-                if (fluxS[facei] >= 0)
-                {
-                    auto own = ownerS[facei];
-                    dstS[facei] = srcS[own];
-                }
-                else
-                {
-                    auto nei = neighS[facei];
-                    dstS[facei] = srcS[nei];
-                }
-            }
-            else
-            {
-                dstS[facei] = weightS[facei] * boundS[facei - nInternalFaces];
-            }
+                const auto positive = simdLoad(fluxS.data() + facei) >= SimdScalar(0.0);
+                const auto own = simdGather(srcS.data(), ownerS.data() + facei);
+                const auto nei = simdGather(srcS.data(), neighS.data() + facei);
+                const auto upwind = Kokkos::Experimental::condition(positive, own, nei);
+                simdStore(upwind, dstS.data() + facei);
+            },
+            internalKernel,
+            "computeUpwindInterpolationInternal"
+        );
+    }
+    else
+    {
+        parallelFor(
+            exec, {0, nInternalFaces}, internalKernel, "computeUpwindInterpolationInternal"
+        );
+    }
+
+    // a pending halo exchange of a processor patch overlaps the internal faces, see Processor
+    const auto boundS = src.boundaryData().value().view();
+    parallelForBoundaryFaces(
+        exec,
+        dst.mesh(),
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            dstS[facei] = weightS[facei] * boundS[bfacei];
         },
-        "computeUpwindInterpolation"
+        "computeUpwindInterpolationBoundary"
     );
 }
 
@@ -65,31 +82,72 @@ void computeUpwindInterpolationWeights(
 )
 {
     const auto exec = src.exec();
-    const auto [weightS, weightB, ownerS, neighS, fluxS] = views(
-        weights.internalVector(),
-        weights.boundaryData().value(),
-        src.mesh().faceOwner(),
-        src.mesh().faceNeighbour(),
-        flux.internalVector()
-    );
+    auto [weightS, weightB] = views(weights.internalVector(), weights.boundaryData().value());
     auto nInternalFaces = src.mesh().nInternalFaces();
+    const auto directions = FaceDirection::readOrCreate(flux).directions().view();
 
     parallelFor(
         exec,
-        {0, weights.size()},
+        {0, nInternalFaces},
         KOKKOS_LAMBDA(const localIdx facei) {
-            if (facei < nInternalFaces)
-            {
-                weightS[facei] = fluxS[facei] >= 0 ? 1 : 0;
-            }
-            else
-            {
-                auto bcfacei = facei - nInternalFaces;
-                weightB[bcfacei] = 1.0;
-                weightS[facei] = 1.0;
-            }
+            weightS[facei] = ownerUpwind(directions, facei) ? 1 : 0;
+        },
+        "computeUpwindInterpolationWeightsInternal"
+    );
+
+    parallelForBoundaryFaces(
+        exec,
+        src.mesh(),
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            weightB[bfacei] = 1.0;
+            weightS[facei] = 1.0;
+        },
+        "computeUpwindInterpolationWeightsBoundary"
+    );
+}
+
+template<typename ValueType>
+void computeUpwindInterpolationAndWeights(
+    const VolumeField<ValueType>& src,
+    const SurfaceField<scalar>& flux,
+    const SurfaceField<scalar>& geometryWeights,
+    SurfaceField<scalar>& weights,
+    SurfaceField<ValueType>& dst
+)
+{
+    const auto exec = dst.exec();
+    auto [dstS, weightS, weightB] =
+        views(dst.internalVector(), weights.internalVector(), weights.boundaryData().value());
+    const auto [srcS, geometryWeightS, ownerS, neighS] = views(
+        src.internalVector(),
+        geometryWeights.internalVector(),
+        dst.mesh().faceOwner(),
+        dst.mesh().faceNeighbour()
+    );
+    auto nInternalFaces = dst.mesh().nInternalFaces();
+    const auto directions = FaceDirection::readOrCreate(flux).directions().view();
+
+    parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            const bool positive = ownerUpwind(directions, facei);
+            weightS[facei] = positive ? 1 : 0;
+            dstS[facei] = positive ? srcS[ownerS[facei]] : srcS[neighS[facei]];
+        },
+        "computeUpwindInterpolationAndWeightsInternal"
+    );
+
+    const auto boundS = src.boundaryData().value().view();
+    parallelForBoundaryFaces(
+        exec,
+        dst.mesh(),
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            weightB[bfacei] = 1.0;
+            weightS[facei] = 1.0;
+            dstS[facei] = geometryWeightS[facei] * boundS[bfacei];
         },
-        "computeUpwindInterpolation"
+        "computeUpwindInterpolationAndWeightsBoundary"
     );
 }
 
@@ -107,4 +165,16 @@ NF_DECLARE_COMPUTE_IMP_UPW_INT(Vec3);
 NF_DECLARE_COMPUTE_IMP_UPW_INT_W(scalar);
 NF_DECLARE_COMPUTE_IMP_UPW_INT_W(Vec3);
 
+#define NF_DECLARE_COMPUTE_IMP_UPW_INT_AND_W(TYPENAME)                                             \
+    template void computeUpwindInterpolationAndWeights<TYPENAME>(                                  \
+        const VolumeField<TYPENAME>&,                                                              \
+        const SurfaceField<scalar>&,                                                               \
+        const SurfaceField<scalar>&,                                                               \
+        SurfaceField<scalar>&,                                                                     \
+        SurfaceField<TYPENAME>&                                                                    \
+    )
+
+NF_DECLARE_COMPUTE_IMP_UPW_INT_AND_W(scalar);
+NF_DECLARE_COMPUTE_IMP_UPW_INT_AND_W(Vec3);
+
 } // namespace NeoN
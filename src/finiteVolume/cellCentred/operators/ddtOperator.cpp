@@ -3,7 +3,6 @@
 // SPDX-License-Identifier: MIT
 
 #include "NeoN/core/parallelAlgorithms.hpp"
-#include "NeoN/core/database/oldTimeCollection.hpp"
 
 #include "NeoN/finiteVolume/cellCentred/operators/ddtOperator.hpp"
 
@@ -19,44 +18,76 @@ DdtOperator<ValueType>::DdtOperator(dsl::Operator::Type termType, VolumeField<Va
     : dsl::OperatorMixin<VolumeField<ValueType>>(field.exec(), dsl::Coeff(1.0), field, termType),
       sparsityPattern_(la::SparsityPattern::readOrCreate(field.mesh())) {};
 
+template<typename ValueType>
+DdtOperator<ValueType>::DdtOperator(
+    dsl::Operator::Type termType, VolumeField<ValueType>& field, const Vector<scalar>& localDt
+)
+    : DdtOperator(termType, field)
+{
+    NF_ASSERT_EQUAL(localDt.size(), field.mesh().nCells());
+    localDt_ = &localDt;
+}
+
 template<typename ValueType>
 void DdtOperator<ValueType>::explicitOperation(Vector<ValueType>& source, scalar, scalar dt) const
 {
-    const scalar dtInver = 1.0 / dt;
-    const auto vol = this->getVector().mesh().cellVolumes().view();
+    const auto step = timeStep(dt);
+    const auto& mesh = this->getVector().mesh();
+    // the old time value is weighted by the cell volume before the last mesh motion
+    const auto [vol, oldVol] = views(mesh.cellVolumes(), mesh.oldCellVolumes());
     auto [sourceView, field, oldVector] =
-        views(source, this->field_.internalVector(), oldTime(this->field_).internalVector());
+        views(source, this->field_.internalVector(), oldTime_.get(this->field_).internalVector());
 
     parallelFor(
         source.exec(),
         source.range(),
         KOKKOS_LAMBDA(const localIdx celli) {
-            sourceView[celli] += dtInver * (field[celli] - oldVector[celli]) * vol[celli];
-        }
+            sourceView[celli] += step.inverse(celli)
+                               * (field[celli] * vol[celli] - oldVector[celli] * oldVol[celli]);
+        },
+        "DdtOperator::explicit"
     );
 }
 
-template<typename ValueType>
-void DdtOperator<ValueType>::implicitOperation(
-    la::LinearSystem<ValueType, localIdx>& ls, scalar, scalar dt
-) const
+/* @brief adds the diagonal and rhs contributions of the ddt operator, the kernel is instantiated
+ * for the statically typed coefficient of dsl::Coeff::visit
+ */
+template<typename ValueType, typename CoeffType>
+void assembleDdt(
+    la::LinearSystem<ValueType, localIdx>& ls,
+    const la::SparsityPattern& sparsityPattern,
+    const VolumeField<ValueType>& oldField,
+    const DdtTimeStep step,
+    const CoeffType operatorScaling
+)
 {
-    const scalar dtInver = 1.0 / dt;
-    const auto vol = this->getVector().mesh().cellVolumes().view();
-    const auto operatorScaling = this->getCoefficient();
+    const auto& mesh = oldField.mesh();
+    const auto [vol, oldVol] = views(mesh.cellVolumes(), mesh.oldCellVolumes());
     const auto [diagOffs, oldVector] =
-        views(getSparsityPattern().diagOffset(), oldTime(this->field_).internalVector());
+        views(sparsityPattern.diagOffset(), oldField.internalVector());
     auto [matrix, rhs] = ls.view();
 
     parallelFor(
         ls.exec(),
-        {0, oldVector.size()},
+        {0, mesh.nCells()},
         KOKKOS_LAMBDA(const localIdx celli) {
             const auto idx = matrix.rowOffs[celli] + diagOffs[celli];
-            const auto commonCoef = operatorScaling[celli] * vol[celli] * dtInver;
-            matrix.values[idx] += commonCoef * one<ValueType>();
-            rhs[celli] += commonCoef * oldVector[celli];
-        }
+            const auto commonCoef = operatorScaling[celli] * step.inverse(celli);
+            matrix.values[idx] += commonCoef * vol[celli] * one<ValueType>();
+            rhs[celli] += commonCoef * oldVol[celli] * oldVector[celli];
+        },
+        "DdtOperator::implicit"
+    );
+}
+
+template<typename ValueType>
+void DdtOperator<ValueType>::implicitOperation(
+    la::LinearSystem<ValueType, localIdx>& ls, scalar, scalar dt
+) const
+{
+    this->getCoefficient().visit(
+        [&](const auto scaling)
+        { assembleDdt(ls, getSparsityPattern(), oldField(), timeStep(dt), scaling); }
     );
 }
 
@@ -0,0 +1,531 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <utility>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedExpression.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedCoefficients.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/divOperator.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/laplacianOperator.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceColoring.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief returns the fused term of an operator or nullopt if the operator cannot be fused */
+template<typename ValueType>
+std::optional<FusedTerm<ValueType>> fusedTerm(const dsl::SpatialOperator<ValueType>& op)
+{
+    const auto coeff = op.getCoefficient();
+    if (const auto* div = op.template as<DivOperator<ValueType>>())
+    {
+        const auto kind = div->inlineInterpolation();
+        if (kind == InlineInterpolation::None)
+        {
+            return std::nullopt;
+        }
+        return FusedTerm<ValueType> {
+            kind == InlineInterpolation::Upwind ? FusedTermKind::UpwindDiv
+                                                : FusedTermKind::LinearDiv,
+            &div->faceFlux(),
+            &div->getVector(),
+            coeff
+        };
+    }
+    if (const auto* lap = op.template as<LaplacianOperator<ValueType>>())
+    {
+        if (!lap->inlineFaceNormalGrad())
+        {
+            return std::nullopt;
+        }
+        return FusedTerm<ValueType> {
+            FusedTermKind::Laplacian, &lap->gamma(), &lap->getVector(), coeff
+        };
+    }
+    return std::nullopt;
+}
+
+/* @brief the face value of at most maxFusedTerms terms
+**
+** The terms share the face connectivity, the geometric weights and the delta coefficients, which
+** are read once per face.
+*/
+template<typename ValueType>
+struct FusedFaceValue
+{
+    FusedFaceValue(const FusedTerm<ValueType>* terms, localIdx nTerms) : nTerms(nTerms)
+    {
+        const UnstructuredMesh& mesh = terms[0].phi->mesh();
+        const auto geometryScheme = GeometryScheme::readOrCreate(mesh);
+        weights = geometryScheme->weights().internalVector().view();
+        deltaCoeffs = geometryScheme->nonOrthDeltaCoeffs().internalVector().view();
+        magFaceArea = mesh.magFaceAreas().view();
+        owner = mesh.faceOwner().view();
+        neighbour = mesh.faceNeighbour().view();
+        faceCells = mesh.boundaryMesh().faceCells().view();
+        nInternalFaces = mesh.nInternalFaces();
+        for (localIdx k = 0; k < nTerms; k++)
+        {
+            kinds[k] = terms[k].kind;
+            faceCoeffs[k] = terms[k].faceCoeff->internalVector().view();
+            phiV[k] = terms[k].phi->internalVector().view();
+            phiB[k] = terms[k].phi->boundaryData().value().view();
+            scalings[k] = terms[k].coeff[0];
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION ValueType operator()(const localIdx facei) const
+    {
+        const bool boundary = facei >= nInternalFaces;
+        const auto bfacei = facei - nInternalFaces;
+        const auto own = boundary ? faceCells[bfacei] : owner[facei];
+        ValueType value = zero<ValueType>();
+        for (localIdx k = 0; k < nTerms; k++)
+        {
+            const scalar faceCoeff = faceCoeffs[k][facei];
+            const scalar c = scalings[k] * faceCoeff;
+            if (kinds[k] == FusedTermKind::Laplacian)
+            {
+                const ValueType phiN = boundary ? phiB[k][bfacei] : phiV[k][neighbour[facei]];
+                value += c * magFaceArea[facei] * deltaCoeffs[facei] * (phiN - phiV[k][own]);
+            }
+            else if (boundary)
+            {
+                value += c * weights[facei] * phiB[k][bfacei];
+            }
+            else
+            {
+                const bool upwind = kinds[k] == FusedTermKind::UpwindDiv;
+                const scalar w = inlineOwnerWeight(upwind, faceCoeff, weights[facei]);
+                value += c * (w * phiV[k][own] + (1 - w) * phiV[k][neighbour[facei]]);
+            }
+        }
+        return value;
+    }
+
+    localIdx nTerms;
+    localIdx nInternalFaces;
+    View<const scalar> weights;
+    View<const scalar> deltaCoeffs;
+    View<const scalar> magFaceArea;
+    View<const label> owner;
+    View<const label> neighbour;
+    View<const label> faceCells;
+    Kokkos::Array<FusedTermKind, maxFusedTerms> kinds;
+    Kokkos::Array<View<const scalar>, maxFusedTerms> faceCoeffs;
+    Kokkos::Array<View<const ValueType>, maxFusedTerms> phiV;
+    Kokkos::Array<View<const ValueType>, maxFusedTerms> phiB;
+    Kokkos::Array<scalar, maxFusedTerms> scalings;
+};
+
+/* @brief the cell update of an explicit euler step, x = xOld - dt / V * sum */
+template<typename ValueType>
+struct ExplicitEulerUpdate
+{
+    View<const ValueType> oldValues;
+    View<const scalar> invVol;
+    View<const scalar> localDt; // the per cell time step, empty for a uniform time step
+    scalar dt;
+
+    KOKKOS_INLINE_FUNCTION ValueType
+    operator()(const localIdx celli, const ValueType&, const ValueType& sum) const
+    {
+        const scalar cellDt = localDt.size() > 0 ? localDt[celli] : dt;
+        return oldValues[celli] - (cellDt * invVol[celli]) * sum;
+    }
+};
+
+/* @brief accumulates the face values of at most maxFusedTerms terms into res and scales res by
+** the inverse cell volumes
+*/
+template<typename ValueType>
+void computeFusedFaceTerms(
+    const FusedTerm<ValueType>* terms, localIdx nTerms, Vector<ValueType>& res
+)
+{
+    const UnstructuredMesh& mesh = terms[0].phi->mesh();
+    const auto invVol = mesh.invCellVolumes().view();
+    reduceAndScaleFaceValues(
+        mesh,
+        res.view(),
+        FusedFaceValue<ValueType>(terms, nTerms),
+        true,
+        KOKKOS_LAMBDA(const localIdx celli) { return invVol[celli]; }
+    );
+}
+
+/* @brief assembles the matrix coefficients of at most maxFusedTerms terms in one pass over the
+** internal and one pass over the boundary faces
+**
+** The coefficients of a face are summed over the terms before they are written to the matrix,
+** see FusedFaceCoefficients.
+*/
+template<typename ValueType>
+void computeFusedFaceTermsImpl(
+    const FusedTerm<ValueType>* terms,
+    localIdx nTerms,
+    la::LinearSystem<ValueType, localIdx>& ls,
+    const la::SparsityPattern& sparsityPattern
+)
+{
+    const UnstructuredMesh& mesh = terms[0].phi->mesh();
+    const auto exec = mesh.exec();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nCells = mesh.nCells();
+    const auto [owner, neighbour, faceCells, diagOffs, ownOffs, neiOffs] = views(
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.boundaryMesh().faceCells(),
+        sparsityPattern.diagOffset(),
+        sparsityPattern.ownerOffset(),
+        sparsityPattern.neighbourOffset()
+    );
+    const FusedFaceCoefficients<ValueType> coefficients(terms, nTerms);
+
+    auto [values, colIdxs, rowOffs] = ls.matrix().view();
+    auto rhs = ls.rhs().view();
+    auto& bcCoeffs = ls.boundaryCoefficients();
+    auto [boundValues, rhsBoundValues] = views(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
+
+    // with a face coloring no two faces of a color share a row, thus no atomics are required
+    const bool raceFree = coloredFaceLoops(mesh);
+
+    auto internalKernel = KOKKOS_LAMBDA(const localIdx facei)
+    {
+        const auto own = owner[facei];
+        const auto nei = neighbour[facei];
+        const auto rowOwnStart = rowOffs[own];
+        if (nei >= nCells)
+        {
+            // the ghost cell has no row, its current value couples the owner through the rhs
+            const auto g = coefficients.ghostFace(facei, own, nei);
+            scatterAdd(values[rowOwnStart + diagOffs[own]], g.ownDiag * one<ValueType>(), raceFree);
+            scatterAdd(rhs[own], g.source, raceFree);
+            return;
+        }
+        const auto c = coefficients.internalFace(facei, own, nei);
+        const auto rowNeiStart = rowOffs[nei];
+        values[rowOwnStart + ownOffs[facei]] += c.upper * one<ValueType>();
+        values[rowNeiStart + neiOffs[facei]] += c.lower * one<ValueType>();
+        scatterAdd(values[rowOwnStart + diagOffs[own]], c.ownDiag * one<ValueType>(), raceFree);
+        scatterAdd(values[rowNeiStart + diagOffs[nei]], c.neiDiag * one<ValueType>(), raceFree);
+    };
+
+    auto boundaryKernel = KOKKOS_LAMBDA(const localIdx facei)
+    {
+        const auto bfacei = facei - nInternalFaces;
+        const auto own = faceCells[bfacei];
+        const auto c = coefficients.boundaryFace(facei, own);
+        boundValues[bfacei] += c.boundMat;
+        rhsBoundValues[bfacei] += c.boundRhs;
+        scatterAdd(values[rowOffs[own] + diagOffs[own]], c.diag, raceFree);
+        scatterAdd(rhs[own], c.source, raceFree);
+    };
+
+    fusedFaceLoops(mesh, raceFree, internalKernel, boundaryKernel, "computeFusedFaceTermsImpl");
+}
+
+/* @brief assembles the diagonal and rhs contributions of source terms and ddt operators in one
+** pass over the cells, the ddt operators are skipped if dt is zero
+*/
+template<typename ValueType>
+void computeFusedCellTermsImpl(
+    const std::vector<const SourceTerm<ValueType>*>& sources,
+    const std::vector<const DdtOperator<ValueType>*>& ddts,
+    scalar dt,
+    la::LinearSystem<ValueType, localIdx>& ls,
+    const UnstructuredMesh& mesh
+)
+{
+    const FusedCellCoefficients<ValueType> coefficients(sources, ddts, dt, mesh);
+    if (coefficients.empty())
+    {
+        return;
+    }
+    const auto diagOffs = la::SparsityPattern::readOrCreate(mesh).diagOffset().view();
+
+    auto [matrix, rhs] = ls.view();
+    parallelFor(
+        ls.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            const auto diag = coefficients.diag(celli) * one<ValueType>();
+            matrix.values[matrix.rowOffs[celli] + diagOffs[celli]] += diag;
+            rhs[celli] += coefficients.source(celli);
+        },
+        "computeFusedCellTermsImpl"
+    );
+}
+
+template<typename ValueType>
+FusedExpression<ValueType>::FusedExpression(dsl::Expression<ValueType>& expr)
+{
+    // all fused terms have to live on the same mesh
+    const UnstructuredMesh* mesh = nullptr;
+    const auto sameMesh = [&mesh](const UnstructuredMesh& termMesh)
+    {
+        if (!mesh)
+        {
+            mesh = &termMesh;
+        }
+        return mesh == &termMesh;
+    };
+
+    for (auto& op : expr.spatialOperators())
+    {
+        const auto term = fusedTerm(op);
+        if (op.getType() == dsl::Operator::Type::Explicit)
+        {
+            // a cell dependent scaling cannot be applied after the sum over the terms, the const
+            // access does not detach the operator from the copies of the expression
+            auto coeff = std::as_const(op).getCoefficient();
+            if (term && !coeff.hasView() && sameMesh(term->phi->mesh()))
+            {
+                fusedTerms_.push_back(*term);
+            }
+            else
+            {
+                remainingOperators_.push_back(&op);
+            }
+            continue;
+        }
+        if (op.getType() != dsl::Operator::Type::Implicit)
+        {
+            continue;
+        }
+        if (term && sameMesh(term->phi->mesh()))
+        {
+            fusedImplicitTerms_.push_back(*term);
+            continue;
+        }
+        const auto* source = op.template as<SourceTerm<ValueType>>();
+        if (source && fusedSources_.size() < static_cast<std::size_t>(maxFusedTerms)
+            && sameMesh(source->getVector().mesh()))
+        {
+            fusedSources_.push_back(source);
+            continue;
+        }
+        remainingImplicitOperators_.push_back(&op);
+    }
+
+    for (auto& op : expr.temporalOperators())
+    {
+        if (op.getType() != dsl::Operator::Type::Implicit)
+        {
+            continue;
+        }
+        const auto* ddt = op.template as<DdtOperator<ValueType>>();
+        if (ddt && fusedDdts_.size() < static_cast<std::size_t>(maxFusedTerms)
+            && sameMesh(ddt->getVector().mesh()))
+        {
+            fusedDdts_.push_back(ddt);
+            continue;
+        }
+        remainingTemporalOperators_.push_back(&op);
+    }
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::explicitOperation(Vector<ValueType>& source) const
+{
+    for (const auto* op : remainingOperators_)
+    {
+        op->explicitOperation(source);
+    }
+    if (fusedTerms_.empty())
+    {
+        return;
+    }
+    if (!workspace_ || workspace_->size() != source.size())
+    {
+        workspace_.emplace(source.exec(), source.size());
+    }
+    const auto nTerms = static_cast<localIdx>(fusedTerms_.size());
+    for (localIdx start = 0; start < nTerms; start += maxFusedTerms)
+    {
+        fill(*workspace_, zero<ValueType>());
+        computeFusedFaceTerms(
+            fusedTerms_.data() + start, std::min(maxFusedTerms, nTerms - start), *workspace_
+        );
+        source += *workspace_;
+    }
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::explicitEulerUpdate(
+    Vector<ValueType>& x, const Vector<ValueType>& xOld, scalar dt, const Vector<scalar>* localDt
+) const
+{
+    NF_ASSERT_EQUAL(x.size(), xOld.size());
+    const auto nTerms = static_cast<localIdx>(fusedTerms_.size());
+    if (!remainingOperators_.empty() || nTerms == 0 || nTerms > maxFusedTerms)
+    {
+        Vector<ValueType> source(x.exec(), x.size(), zero<ValueType>());
+        explicitOperation(source);
+        auto [xV, oldV, sourceV] = views(x, xOld, source);
+        const auto localDtV = localDt ? localDt->view() : View<const scalar> {};
+        parallelFor(
+            x.exec(),
+            {0, x.size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const scalar cellDt = localDtV.size() > 0 ? localDtV[celli] : dt;
+                xV[celli] = oldV[celli] - sourceV[celli] * cellDt;
+            },
+            "FusedExpression::explicitEulerUpdate"
+        );
+        return;
+    }
+
+    const UnstructuredMesh& mesh = fusedTerms_[0].phi->mesh();
+    // the update writes the local cells, the ghost cells are filled by the communicator
+    NF_ASSERT_EQUAL(x.size(), mesh.nCells() + mesh.nGhostCells());
+    if (!workspace_ || workspace_->size() != x.size())
+    {
+        workspace_.emplace(x.exec(), x.size());
+    }
+    // the face values read the old cell values of the terms, if x is one of them the cells are
+    // updated in a second vector, which is swapped with x afterwards
+    const bool aliased = std::any_of(
+        fusedTerms_.begin(),
+        fusedTerms_.end(),
+        [&x](const auto& term) { return &term.phi->internalVector() == &x; }
+    );
+    if (aliased && (!updateWorkspace_ || updateWorkspace_->size() != x.size()))
+    {
+        updateWorkspace_.emplace(x.exec(), x.size());
+    }
+    auto& res = aliased ? *updateWorkspace_ : x;
+    if (aliased && (mesh.activeRegion() || mesh.nGhostCells() > 0))
+    {
+        // the inactive and the ghost cells are not written by the update and keep their value
+        res = x;
+    }
+    const ExplicitEulerUpdate<ValueType> update {
+        xOld.view(),
+        mesh.invCellVolumes().view(),
+        localDt ? localDt->view() : View<const scalar> {},
+        dt
+    };
+    reduceAndUpdateFaceValues(
+        mesh,
+        res.view(),
+        FusedFaceValue<ValueType>(fusedTerms_.data(), nTerms),
+        true,
+        update,
+        workspace_->view()
+    );
+    if (aliased)
+    {
+        x.swap(*updateWorkspace_);
+    }
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::assembleFused(
+    la::LinearSystem<ValueType, localIdx>& ls, bool spatial, scalar dt
+)
+{
+    const auto* mesh = !fusedImplicitTerms_.empty() ? &fusedImplicitTerms_[0].phi->mesh()
+                     : !fusedSources_.empty()       ? &fusedSources_[0]->getVector().mesh()
+                     : !fusedDdts_.empty()          ? &fusedDdts_[0]->getVector().mesh()
+                                                    : nullptr;
+    if (!mesh)
+    {
+        return;
+    }
+    if (spatial && !fusedImplicitTerms_.empty())
+    {
+        const auto& sparsityPattern = la::SparsityPattern::readOrCreate(*mesh);
+        const auto nTerms = static_cast<localIdx>(fusedImplicitTerms_.size());
+        for (localIdx start = 0; start < nTerms; start += maxFusedTerms)
+        {
+            computeFusedFaceTermsImpl(
+                fusedImplicitTerms_.data() + start,
+                std::min(maxFusedTerms, nTerms - start),
+                ls,
+                sparsityPattern
+            );
+        }
+    }
+    computeFusedCellTermsImpl(
+        spatial ? fusedSources_ : std::vector<const SourceTerm<ValueType>*> {},
+        fusedDdts_,
+        dt,
+        ls,
+        *mesh
+    );
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::implicitOperation(la::LinearSystem<ValueType, localIdx>& ls)
+{
+    for (auto* op : remainingImplicitOperators_)
+    {
+        op->implicitOperation(ls);
+    }
+    assembleFused(ls, true, 0.0);
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::implicitOperation(
+    la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt
+)
+{
+    NF_ASSERT(dt != 0.0, "The implicit temporal operators require a non zero time step.");
+    for (auto* op : remainingTemporalOperators_)
+    {
+        op->implicitOperation(ls, t, dt);
+    }
+    assembleFused(ls, false, dt);
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::assemble(
+    la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt
+)
+{
+    NF_ASSERT(dt != 0.0, "The implicit temporal operators require a non zero time step.");
+    for (auto* op : remainingImplicitOperators_)
+    {
+        op->implicitOperation(ls);
+    }
+    for (auto* op : remainingTemporalOperators_)
+    {
+        op->implicitOperation(ls, t, dt);
+    }
+    assembleFused(ls, true, dt);
+}
+
+template<typename ValueType>
+void FusedExpression<ValueType>::solveDiagonal(Vector<ValueType>& x, scalar dt) const
+{
+    NF_ASSERT(implicitDiagonal(), "The implicit operators do not form a diagonal system.");
+    NF_ASSERT(dt != 0.0, "The implicit temporal operators require a non zero time step.");
+    const auto& mesh = !fusedSources_.empty() ? fusedSources_[0]->getVector().mesh()
+                                              : fusedDdts_[0]->getVector().mesh();
+    // only the local cells are solved for, the ghost cells keep their value
+    NF_ASSERT_EQUAL(x.size(), mesh.nCells() + mesh.nGhostCells());
+    const FusedCellCoefficients<ValueType> coefficients(fusedSources_, fusedDdts_, dt, mesh);
+
+    auto xV = x.view();
+    parallelFor(
+        x.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            xV[celli] = (1.0 / coefficients.diag(celli)) * coefficients.source(celli);
+        },
+        "FusedExpression::solveDiagonal"
+    );
+}
+
+// instantiate the template class
+template class FusedExpression<scalar>;
+template class FusedExpression<Vec3>;
+
+} // namespace NeoN::finiteVolume::cellCentred
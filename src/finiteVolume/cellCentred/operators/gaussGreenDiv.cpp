@@ -2,9 +2,15 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/gaussGreenDiv.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceRanges.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReductionTuner.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -15,7 +21,7 @@ namespace NeoN::finiteVolume::cellCentred
 **  phi_f is the face interpolate value
 **
 **
-** @param exec The executor
+** @param mesh The mesh, provides the executor and the cell to face stencil
 ** @param nInternalFaces - number of internal faces
 ** @param nBoundaryFaces - number of boundary faces
 ** @param neighbour - mapping from face id to neighbour cell id
@@ -23,26 +29,27 @@ namespace NeoN::finiteVolume::cellCentred
 ** @param faceCells - mapping from boundary face id to owner cell id
 ** @param faceFlux - flux on cell faces
 ** @param phiF - flux on cell faces
-** @param v - cell volumes
+** @param invVol - inverse cell volumes
 ** @param res - view holding the result
-** @param operatorScaling - any additional coefficients
+** @param operatorScaling - any additional coefficients, a statically typed coefficient
 */
-template<typename ValueType>
+template<typename ValueType, typename CoeffType>
 void computeDiv(
-    const Executor& exec,
+    const UnstructuredMesh& mesh,
     localIdx nInternalFaces,
     localIdx nBoundaryFaces,
-    View<const localIdx> neighbour,
-    View<const localIdx> owner,
-    View<const localIdx> faceCells,
+    View<const label> neighbour,
+    View<const label> owner,
+    View<const label> faceCells,
     View<const scalar> faceFlux,
     View<const ValueType> phiF,
-    View<const scalar> v,
+    View<const scalar> invVol,
     View<ValueType> res,
-    const dsl::Coeff operatorScaling
+    const CoeffType operatorScaling
 )
 {
-    auto nCells = v.size();
+    const auto exec = mesh.exec();
+    auto nCells = invVol.size();
     // check if the executor is GPU
     if (std::holds_alternative<SerialExecutor>(exec))
     {
@@ -60,45 +67,155 @@ void computeDiv(
             res[own] += valueOwn;
         }
 
-        // TODO does it make sense to store invVol and multiply?
         for (localIdx celli = 0; celli < nCells; celli++)
         {
-            res[celli] *= operatorScaling[celli] / v[celli];
+            res[celli] *= operatorScaling[celli] * invVol[celli];
         }
     }
     else
     {
-        parallelFor(
-            exec,
-            {0, nInternalFaces},
-            KOKKOS_LAMBDA(const localIdx i) {
-                ValueType flux = faceFlux[i] * phiF[i];
-                Kokkos::atomic_add(&res[owner[i]], flux);
-                Kokkos::atomic_sub(&res[neighbour[i]], flux);
-            },
-            "sumFluxesInternal"
+        reduceAndScaleFaceValues(
+            mesh,
+            res,
+            KOKKOS_LAMBDA(const localIdx i) { return faceFlux[i] * phiF[i]; },
+            true,
+            KOKKOS_LAMBDA(const localIdx celli) { return operatorScaling[celli] * invVol[celli]; }
         );
+    }
+}
 
+/* @brief fused interpolation and divergence for the linear and upwind schemes
+** evaluates phi_f inline in the face reduction and thus avoids the face sized temporary
+**
+** @param kind - the inline interpolation scheme, must not be None
+** @param operatorScaling - a statically typed coefficient
+*/
+template<typename ValueType, typename CoeffType>
+void computeFusedDivExp(
+    const SurfaceField<scalar>& faceFlux,
+    const VolumeField<ValueType>& phi,
+    InlineInterpolation kind,
+    Vector<ValueType>& divPhi,
+    const CoeffType operatorScaling
+)
+{
+    const UnstructuredMesh& mesh = phi.mesh();
+    const auto& weights = GeometryScheme::readOrCreate(mesh)->weights();
+    const auto [fluxV, weightsV, phiV, owner, neighbour, invVol] = views(
+        faceFlux.internalVector(),
+        weights.internalVector(),
+        phi.internalVector(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.invCellVolumes()
+    );
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const bool upwind = kind == InlineInterpolation::Upwind;
+
+    if (phi.boundaryData().hasPendingUpdates())
+    {
+        // the boundary values are read after the internal faces are reduced, hence a pending
+        // halo exchange of a processor patch is finalised only now, see Processor
+        auto res = divPhi.view();
+        reduceFaceValues(
+            mesh,
+            res,
+            KOKKOS_LAMBDA(const localIdx facei) {
+                if (facei >= nInternalFaces)
+                {
+                    return zero<ValueType>();
+                }
+                const scalar flux = fluxV[facei];
+                const scalar w = inlineOwnerWeight(upwind, flux, weightsV[facei]);
+                const auto own = owner[facei];
+                const auto nei = neighbour[facei];
+                return ValueType(flux * (w * phiV[own] + (1 - w) * phiV[nei]));
+            },
+            true
+        );
+        const auto [phiB, faceCells] =
+            views(phi.boundaryData().value(), mesh.boundaryMesh().faceCells());
+        parallelForBoundaryFaces(
+            mesh.exec(),
+            mesh,
+            KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+                const ValueType value = fluxV[facei] * weightsV[facei] * phiB[bfacei];
+                atomicAdd(&res[faceCells[bfacei]], value);
+            },
+            "computeFusedDivExpBoundary"
+        );
         parallelFor(
-            exec,
-            {nInternalFaces, nInternalFaces + nBoundaryFaces},
-            KOKKOS_LAMBDA(const localIdx i) {
-                auto own = faceCells[i - nInternalFaces];
-                ValueType valueOwn = faceFlux[i] * phiF[i];
-                Kokkos::atomic_add(&res[own], valueOwn);
+            mesh.exec(),
+            {0, mesh.nCells()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                res[celli] *= operatorScaling[celli] * invVol[celli];
             },
-            "sumFluxesInternal"
+            "computeFusedDivExpScale"
         );
+        return;
+    }
 
+    const auto phiB = phi.boundaryData().value().view();
+    if (faceReduction(mesh) == FaceReduction::Structured)
+    {
+        // the cells adjacent to a face follow from the cell index, no connectivity is read
+        const StructuredBlock block = *mesh.structured();
+        const localIdx stride[3] = {1, block.nx, block.nx * block.ny};
+        auto res = divPhi.view();
         parallelFor(
-            exec,
-            {0, nCells},
+            mesh.exec(),
+            {0, mesh.nCells()},
             KOKKOS_LAMBDA(const localIdx celli) {
-                res[celli] *= operatorScaling[celli] / v[celli];
+                ValueType sum = zero<ValueType>();
+                for (localIdx d = 0; d < 3; d++)
+                {
+                    for (localIdx side = 0; side < 2; side++)
+                    {
+                        const bool upper = side == 1;
+                        const auto face = block.face(celli, d, upper);
+                        const scalar flux = fluxV[face.facei];
+                        if (face.facei >= nInternalFaces)
+                        {
+                            const auto bfacei = face.facei - nInternalFaces;
+                            sum += flux * weightsV[face.facei] * phiB[bfacei];
+                            continue;
+                        }
+                        const auto other = upper ? celli + stride[d] : celli - stride[d];
+                        const auto own = face.owner ? celli : other;
+                        const auto nei = face.owner ? other : celli;
+                        const scalar w = inlineOwnerWeight(upwind, flux, weightsV[face.facei]);
+                        const ValueType value = flux * (w * phiV[own] + (1 - w) * phiV[nei]);
+                        sum += face.owner ? value : ValueType(-1.0 * value);
+                    }
+                }
+                res[celli] = operatorScaling[celli] * invVol[celli] * (res[celli] + sum);
             },
-            "normalizeFluxes"
+            "computeFusedDivExpStructured"
         );
+        return;
     }
+
+    reduceAndScaleFaceValues(
+        mesh,
+        divPhi.view(),
+        KOKKOS_LAMBDA(const localIdx facei) {
+            const scalar flux = fluxV[facei];
+            if (facei >= nInternalFaces)
+            {
+                return ValueType(flux * weightsV[facei] * phiB[facei - nInternalFaces]);
+            }
+            const auto own = owner[facei];
+            const auto nei = neighbour[facei];
+            if (upwind)
+            {
+                return ValueType(flux * (flux >= 0 ? phiV[own] : phiV[nei]));
+            }
+            const scalar w = weightsV[facei];
+            return ValueType(flux * (w * phiV[own] + (1 - w) * phiV[nei]));
+        },
+        true,
+        KOKKOS_LAMBDA(const localIdx celli) { return operatorScaling[celli] * invVol[celli]; }
+    );
 }
 
 template<typename ValueType>
@@ -110,6 +227,16 @@ void computeDivExp(
     const dsl::Coeff operatorScaling
 )
 {
+    FaceReductionTuning tuning(phi.mesh(), "computeDivExp", typeid(ValueType));
+    const auto kind = surfInterp.inlineInterpolation();
+    if (kind != InlineInterpolation::None)
+    {
+        operatorScaling.visit(
+            [&](const auto scaling) { computeFusedDivExp(faceFlux, phi, kind, divPhi, scaling); }
+        );
+        return;
+    }
+
     const UnstructuredMesh& mesh = phi.mesh();
     const auto exec = phi.exec();
     SurfaceField<ValueType> phif(
@@ -124,19 +251,23 @@ void computeDivExp(
 
     auto nInternalFaces = mesh.nInternalFaces();
     auto nBoundaryFaces = mesh.nBoundaryFaces();
-    computeDiv<ValueType>(
-        exec,
-        nInternalFaces,
-        nBoundaryFaces,
-        mesh.faceNeighbour().view(),
-        mesh.faceOwner().view(),
-        mesh.boundaryMesh().faceCells().view(),
-        faceFlux.internalVector().view(),
-        phif.internalVector().view(),
-        mesh.cellVolumes().view(),
-        divPhi.view(),
-        operatorScaling
-
+    operatorScaling.visit(
+        [&](const auto scaling)
+        {
+            computeDiv<ValueType>(
+                mesh,
+                nInternalFaces,
+                nBoundaryFaces,
+                mesh.faceNeighbour().view(),
+                mesh.faceOwner().view(),
+                mesh.boundaryMesh().faceCells().view(),
+                faceFlux.internalVector().view(),
+                phif.internalVector().view(),
+                mesh.invCellVolumes().view(),
+                divPhi.view(),
+                scaling
+            );
+        }
     );
 }
 
@@ -152,6 +283,262 @@ void computeDivExp(
 NF_DECLARE_COMPUTE_EXP_DIV(scalar);
 NF_DECLARE_COMPUTE_EXP_DIV(Vec3);
 
+/* @brief fused divergence of a batch of at most maxBatchSize fields with the same flux
+** the face connectivity, flux and weights are read once per face for all fields of the batch
+*/
+template<typename ValueType>
+void computeBatchedFusedDivExp(
+    const SurfaceField<scalar>& faceFlux,
+    const ViewBatch<const ValueType>& phiV,
+    const ViewBatch<const ValueType>& phiB,
+    const ViewBatch<ValueType>& res,
+    localIdx nFields,
+    InlineInterpolation kind,
+    const dsl::Coeff operatorScaling
+)
+{
+    const UnstructuredMesh& mesh = faceFlux.mesh();
+    const auto exec = faceFlux.exec();
+    const auto& weights = GeometryScheme::readOrCreate(mesh)->weights();
+    const auto [fluxV, weightsV, owner, neighbour, faceCells, invVol] = views(
+        faceFlux.internalVector(),
+        weights.internalVector(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.boundaryMesh().faceCells(),
+        mesh.invCellVolumes()
+    );
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const bool upwind = kind == InlineInterpolation::Upwind;
+
+    // the strategy of the mesh, which selects the gather for meshes with ghost cells or an active
+    // region, since the gather alone writes the local and active cells only
+    if (faceReduction(mesh) == FaceReduction::Gather)
+    {
+        const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+        const auto [cellFaces, segments] = views(stencil.values(), stencil.segments());
+        const auto* region = mesh.activeRegion();
+        const bool active = region != nullptr;
+        const auto activeCells = active ? region->activeCells().view() : View<const localIdx>();
+        const auto nGatherCells = active ? activeCells.size() : mesh.nCells();
+        parallelFor(
+            exec,
+            {0, nGatherCells},
+            KOKKOS_LAMBDA(const localIdx j) {
+                const auto celli = active ? activeCells[j] : j;
+                for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+                {
+                    const auto facei = cellFaces[i];
+                    const scalar flux = fluxV[facei];
+                    if (facei >= nInternalFaces)
+                    {
+                        const scalar fluxB = flux * weightsV[facei];
+                        for (localIdx k = 0; k < nFields; k++)
+                        {
+                            res[k][celli] += fluxB * phiB[k][facei - nInternalFaces];
+                        }
+                        continue;
+                    }
+                    const scalar w = inlineOwnerWeight(upwind, flux, weightsV[facei]);
+                    const auto own = owner[facei];
+                    const auto nei = neighbour[facei];
+                    const scalar signedFlux = nei == celli ? -flux : flux;
+                    for (localIdx k = 0; k < nFields; k++)
+                    {
+                        res[k][celli] += signedFlux * (w * phiV[k][own] + (1 - w) * phiV[k][nei]);
+                    }
+                }
+                const scalar scaling = operatorScaling[celli] * invVol[celli];
+                for (localIdx k = 0; k < nFields; k++)
+                {
+                    res[k][celli] *= scaling;
+                }
+            },
+            "computeBatchedDivExpGather"
+        );
+        return;
+    }
+    else
+    {
+        const bool raceFree = coloredFaceLoops(mesh);
+        auto internalKernel = KOKKOS_LAMBDA(const localIdx facei)
+        {
+            const scalar flux = fluxV[facei];
+            const scalar w = inlineOwnerWeight(upwind, flux, weightsV[facei]);
+            const auto own = owner[facei];
+            const auto nei = neighbour[facei];
+            for (localIdx k = 0; k < nFields; k++)
+            {
+                const ValueType value = flux * (w * phiV[k][own] + (1 - w) * phiV[k][nei]);
+                scatterAdd(res[k][own], value, raceFree);
+                scatterAdd(res[k][nei], ValueType(-1.0 * value), raceFree);
+            }
+        };
+        auto boundaryKernel = KOKKOS_LAMBDA(const localIdx facei)
+        {
+            const scalar fluxB = fluxV[facei] * weightsV[facei];
+            const auto bfacei = facei - nInternalFaces;
+            const auto own = faceCells[bfacei];
+            for (localIdx k = 0; k < nFields; k++)
+            {
+                scatterAdd(res[k][own], ValueType(fluxB * phiB[k][bfacei]), raceFree);
+            }
+        };
+
+        if (raceFree)
+        {
+            const auto& coloring = FaceColoring::readOrCreate(mesh);
+            coloredParallelFor(
+                exec, coloring.internalFaces(), internalKernel, "computeBatchedDivExpInternal"
+            );
+            coloredParallelFor(
+                exec, coloring.boundaryFaces(), boundaryKernel, "computeBatchedDivExpBoundary"
+            );
+        }
+        else
+        {
+            parallelFor(exec, {0, nInternalFaces}, internalKernel, "computeBatchedDivExpInternal");
+            parallelFor(
+                exec,
+                {nInternalFaces, nInternalFaces + mesh.nBoundaryFaces()},
+                boundaryKernel,
+                "computeBatchedDivExpBoundary"
+            );
+        }
+    }
+
+    parallelFor(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            const scalar scaling = operatorScaling[celli] * invVol[celli];
+            for (localIdx k = 0; k < nFields; k++)
+            {
+                res[k][celli] *= scaling;
+            }
+        },
+        "normalizeBatchedFluxes"
+    );
+}
+
+template<typename ValueType>
+void computeBatchedDivExp(
+    const SurfaceField<scalar>& faceFlux,
+    const std::vector<const VolumeField<ValueType>*>& phis,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    const std::vector<Vector<ValueType>*>& divPhis,
+    const dsl::Coeff operatorScaling
+)
+{
+    NF_ASSERT(phis.size() == divPhis.size(), "Number of fields and results differ.");
+    const auto kind = surfInterp.inlineInterpolation();
+    if (kind == InlineInterpolation::None)
+    {
+        for (std::size_t k = 0; k < phis.size(); k++)
+        {
+            computeDivExp(faceFlux, *phis[k], surfInterp, *divPhis[k], operatorScaling);
+        }
+        return;
+    }
+
+    const auto nTotal = static_cast<localIdx>(phis.size());
+    for (localIdx start = 0; start < nTotal; start += maxBatchSize)
+    {
+        const auto nFields = std::min(maxBatchSize, nTotal - start);
+        ViewBatch<const ValueType> phiV;
+        ViewBatch<const ValueType> phiB;
+        ViewBatch<ValueType> res;
+        for (localIdx k = 0; k < nFields; k++)
+        {
+            const auto fieldi = static_cast<std::size_t>(start + k);
+            phiV[k] = phis[fieldi]->internalVector().view();
+            phiB[k] = phis[fieldi]->boundaryData().value().view();
+            res[k] = divPhis[fieldi]->view();
+        }
+        computeBatchedFusedDivExp(faceFlux, phiV, phiB, res, nFields, kind, operatorScaling);
+    }
+}
+
+#define NF_DECLARE_COMPUTE_BATCHED_EXP_DIV(TYPENAME)                                               \
+    template void computeBatchedDivExp<TYPENAME>(                                                  \
+        const SurfaceField<scalar>&,                                                               \
+        const std::vector<const VolumeField<TYPENAME>*>&,                                          \
+        const SurfaceInterpolation<TYPENAME>&,                                                     \
+        const std::vector<Vector<TYPENAME>*>&,                                                     \
+        const dsl::Coeff                                                                           \
+    )
+
+NF_DECLARE_COMPUTE_BATCHED_EXP_DIV(scalar);
+NF_DECLARE_COMPUTE_BATCHED_EXP_DIV(Vec3);
+
+template<typename ValueType>
+void computeBlockDivExp(
+    const SurfaceField<scalar>& faceFlux,
+    const VolumeFieldBlock<ValueType>& phi,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    Vector<ValueType>& divPhi,
+    const dsl::Coeff operatorScaling
+)
+{
+    NF_ASSERT_EQUAL(divPhi.size(), phi.internalVector().size());
+    const auto exec = phi.exec();
+    const auto nCells = phi.nCells();
+    const auto kind = surfInterp.inlineInterpolation();
+    if (kind == InlineInterpolation::None)
+    {
+        for (localIdx k = 0; k < phi.nComponents(); k++)
+        {
+            Vector<ValueType> divPhiK(exec, nCells);
+            auto [resK, res] = views(divPhiK, divPhi);
+            const auto offset = k * nCells;
+            parallelFor(
+                exec,
+                {0, nCells},
+                KOKKOS_LAMBDA(const localIdx celli) { resK[celli] = res[offset + celli]; },
+                "gatherBlockDivExp"
+            );
+            computeDivExp(faceFlux, phi.component(k), surfInterp, divPhiK, operatorScaling);
+            parallelFor(
+                exec,
+                {0, nCells},
+                KOKKOS_LAMBDA(const localIdx celli) { res[offset + celli] = resK[celli]; },
+                "scatterBlockDivExp"
+            );
+        }
+        return;
+    }
+
+    const auto phiV = phi.view();
+    const auto res = BlockView<ValueType>(divPhi.view(), nCells);
+    for (localIdx start = 0; start < phi.nComponents(); start += maxBatchSize)
+    {
+        const auto nFields = std::min(maxBatchSize, phi.nComponents() - start);
+        ViewBatch<const ValueType> phiVK;
+        ViewBatch<const ValueType> phiBK;
+        ViewBatch<ValueType> resK;
+        for (localIdx k = 0; k < nFields; k++)
+        {
+            phiVK[k] = phiV.component(start + k);
+            phiBK[k] = phi.boundaryData(start + k).value().view();
+            resK[k] = res.component(start + k);
+        }
+        computeBatchedFusedDivExp(faceFlux, phiVK, phiBK, resK, nFields, kind, operatorScaling);
+    }
+}
+
+#define NF_DECLARE_COMPUTE_BLOCK_EXP_DIV(TYPENAME)                                                 \
+    template void computeBlockDivExp<TYPENAME>(                                                    \
+        const SurfaceField<scalar>&,                                                               \
+        const VolumeFieldBlock<TYPENAME>&,                                                         \
+        const SurfaceInterpolation<TYPENAME>&,                                                     \
+        Vector<TYPENAME>&,                                                                         \
+        const dsl::Coeff                                                                           \
+    )
+
+NF_DECLARE_COMPUTE_BLOCK_EXP_DIV(scalar);
+NF_DECLARE_COMPUTE_BLOCK_EXP_DIV(Vec3);
+
+
 
 template<typename ValueType>
 void computeDivImp(
@@ -165,6 +552,7 @@ void computeDivImp(
 {
     const UnstructuredMesh& mesh = phi.mesh();
     const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nCells = mesh.nCells();
     const auto exec = phi.exec();
     const auto weights = surfInterp.weight(faceFlux, phi);
 
@@ -179,6 +567,7 @@ void computeDivImp(
             sparsityPattern.ownerOffset(),
             sparsityPattern.neighbourOffset()
         );
+    const auto phiV = phi.internalVector().view();
     auto [matrix, rhs] = ls.view();
 
     parallelFor(
@@ -190,13 +579,25 @@ void computeDivImp(
             auto value = zero<ValueType>();
             auto own = owner[facei];
             auto nei = neighbour[facei];
+            auto rowOwnStart = matrix.rowOffs[own];
+            auto operatorScalingOwn = operatorScaling[own];
+
+            if (nei >= nCells)
+            {
+                // the ghost cell has no row, its current value couples the owner through the rhs
+                atomicAdd(
+                    &matrix.values[rowOwnStart + diagOffs[own]],
+                    weight * flux * operatorScalingOwn * one<ValueType>()
+                );
+                Kokkos::atomic_sub(
+                    &rhs[own], flux * (1 - weight) * operatorScalingOwn * phiV[nei]
+                );
+                return;
+            }
 
             // add neighbour contribution upper
             auto rowNeiStart = matrix.rowOffs[nei];
-            auto rowOwnStart = matrix.rowOffs[own];
-
             auto operatorScalingNei = operatorScaling[nei];
-            auto operatorScalingOwn = operatorScaling[own];
 
             value = -weight * flux * one<ValueType>();
             // scalar valueNei = (1 - weight) * flux;
@@ -225,10 +626,7 @@ void computeDivImp(
         mesh.boundaryMesh().deltaCoeffs()
     );
 
-    auto& bcCoeffs =
-        ls.auxiliaryCoefficients().template get<la::BoundaryCoefficients<ValueType, localIdx>>(
-            "boundaryCoefficients"
-        );
+    auto& bcCoeffs = ls.boundaryCoefficients();
 
     auto [boundValues, rhsBoundValues] = views(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
 
@@ -248,7 +646,7 @@ void computeDivImp(
 
             auto valueMat = flux * operatorScalingOwn * valFrac2 * one<ValueType>();
 
-            Kokkos::atomic_add(&matrix.values[rowOwnStart + diagOffs[own]], valueMat);
+            atomicAdd(&matrix.values[rowOwnStart + diagOffs[own]], valueMat);
             boundValues[bcfacei] = valueMat;
 
             auto valueRhs = (flux * operatorScalingOwn * (valFrac1 * refValue[bcfacei]))
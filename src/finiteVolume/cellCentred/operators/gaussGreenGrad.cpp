@@ -4,9 +4,14 @@
 
 #include "NeoN/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/linear.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReductionTuner.hpp"
 #include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/database/gradientCollection.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 
+#include <utility>
+
 namespace NeoN::finiteVolume::cellCentred
 {
 
@@ -14,15 +19,19 @@ namespace NeoN::finiteVolume::cellCentred
 ** ie computes \sum_f \phi_f
 **
 ** @param[in] in - Vector on which the gradient should be computed
+** @param[in] faceAreas - View of the face areas, either View<const Vec3> or Vec3SoAView
 ** @param[in,out] out - Vector to hold the result
 */
+template<typename FaceAreaView>
 void computeGrad(
     const VolumeField<scalar>& in,
     const SurfaceInterpolation<scalar>& surfInterp,
+    const FaceAreaView faceAreaS,
     VolumeField<Vec3>& out
 )
 {
     const UnstructuredMesh& mesh = out.mesh();
+    FaceReductionTuning tuning(mesh, "computeGrad", typeid(scalar));
     const auto exec = out.exec();
     SurfaceField<scalar> phif(
         exec, "phif", mesh, createCalculatedBCs<SurfaceBoundary<scalar>>(mesh)
@@ -31,64 +40,139 @@ void computeGrad(
 
     auto surfGradPhi = out.internalVector().view();
 
-    const auto [surfFaceCells, sBSf, surfPhif, surfOwner, surfNeighbour, faceAreaS, surfV] = views(
-        mesh.boundaryMesh().faceCells(),
-        mesh.boundaryMesh().sf(),
-        phif.internalVector(),
-        mesh.faceOwner(),
-        mesh.faceNeighbour(),
-        mesh.faceAreas(),
-        mesh.cellVolumes()
-    );
+    const auto [surfPhif, invVol] = views(phif.internalVector(), mesh.invCellVolumes());
 
-    auto nInternalFaces = mesh.nInternalFaces();
-
-    // TODO use NeoN::atomic_
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx i) {
-            Vec3 flux = faceAreaS[i] * surfPhif[i];
-            Kokkos::atomic_add(&surfGradPhi[surfOwner[i]], flux);
-            Kokkos::atomic_sub(&surfGradPhi[surfNeighbour[i]], flux);
-        }
+    reduceAndScaleFaceValues(
+        mesh,
+        surfGradPhi,
+        KOKKOS_LAMBDA(const localIdx i) { return Vec3(faceAreaS[i] * surfPhif[i]); },
+        true,
+        KOKKOS_LAMBDA(const localIdx celli) { return invVol[celli]; }
     );
+}
 
-    parallelFor(
-        exec,
-        {nInternalFaces, surfPhif.size()},
-        KOKKOS_LAMBDA(const localIdx i) {
-            auto own = surfFaceCells[i - nInternalFaces];
-            Vec3 valueOwn = faceAreaS[i] * surfPhif[i];
-            Kokkos::atomic_add(&surfGradPhi[own], valueOwn);
-        }
-    );
+/* @brief the explicit gradient of a vector field, ie. computes \sum_f S_f U_f / V
+**
+** The field is interpolated to the faces at once and the outer products of all faces are reduced
+** in one pass.
+*/
+template<typename FaceAreaView>
+void computeGrad(
+    const VolumeField<Vec3>& in,
+    const SurfaceInterpolation<Vec3>& surfInterp,
+    const FaceAreaView faceAreaS,
+    Vector<Tensor>& out
+)
+{
+    const UnstructuredMesh& mesh = in.mesh();
+    FaceReductionTuning tuning(mesh, "computeGrad", typeid(Vec3));
+    const auto exec = in.exec();
+    SurfaceField<Vec3> uf(exec, "uf", mesh, createCalculatedBCs<SurfaceBoundary<Vec3>>(mesh));
+    surfInterp.interpolate(in, uf);
 
-    parallelFor(
-        exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli) { surfGradPhi[celli] *= 1 / surfV[celli]; }
+    out.resize(mesh.nCells());
+    fill(out, zero<Tensor>());
+    const auto [surfUf, invVol] = views(uf.internalVector(), mesh.invCellVolumes());
+
+    reduceAndScaleFaceValues(
+        mesh,
+        out.view(),
+        KOKKOS_LAMBDA(const localIdx i) { return outer(faceAreaS[i], surfUf[i]); },
+        true,
+        KOKKOS_LAMBDA(const localIdx celli) { return invVol[celli]; }
     );
 }
 
-GaussGreenGrad::GaussGreenGrad(const Executor& exec, const UnstructuredMesh& mesh)
+GaussGreenGrad::GaussGreenGrad(
+    const Executor& exec, const UnstructuredMesh& mesh, VectorLayout layout
+)
     : mesh_(mesh), surfaceInterpolation_(
                        exec, mesh, std::make_unique<Linear<scalar>>(exec, mesh, Dictionary())
-                   ) {};
+                   ),
+      vectorInterpolation_(exec, mesh, std::make_unique<Linear<Vec3>>(exec, mesh, Dictionary())),
+      layout_(layout), faceAreasSoA_(), geometryVersion_(mesh.geometryVersion()),
+      cachedGrad_(), cachedVersions_(), cachedTensorGrad_(), cachedTensorVersions_() {};
+
+void GaussGreenGrad::updateFaceAreasSoA()
+{
+    if (!faceAreasSoA_)
+    {
+        faceAreasSoA_.emplace(mesh_.faceAreas());
+    }
+    else if (geometryVersion_ != mesh_.geometryVersion())
+    {
+        faceAreasSoA_->assign(mesh_.faceAreas());
+    }
+    geometryVersion_ = mesh_.geometryVersion();
+}
 
 
 void GaussGreenGrad::grad(const VolumeField<scalar>& phi, VolumeField<Vec3>& gradPhi)
 {
-    computeGrad(phi, surfaceInterpolation_, gradPhi);
+    if (layout_ == VectorLayout::AoS)
+    {
+        computeGrad(phi, surfaceInterpolation_, mesh_.faceAreas().view(), gradPhi);
+        return;
+    }
+    updateFaceAreasSoA();
+    computeGrad(phi, surfaceInterpolation_, std::as_const(*faceAreasSoA_).view(), gradPhi);
 };
 
+void GaussGreenGrad::grad(const VolumeField<Vec3>& u, Vector<Tensor>& gradU)
+{
+    if (layout_ == VectorLayout::AoS)
+    {
+        computeGrad(u, vectorInterpolation_, mesh_.faceAreas().view(), gradU);
+        return;
+    }
+    updateFaceAreasSoA();
+    computeGrad(u, vectorInterpolation_, std::as_const(*faceAreasSoA_).view(), gradU);
+}
+
 VolumeField<Vec3> GaussGreenGrad::grad(const VolumeField<scalar>& phi)
 {
+    // the versions are unique over all vectors, hence also a different phi is detected
+    const std::array<std::size_t, 3> versions {
+        phi.internalVector().version(),
+        phi.boundaryData().value().version(),
+        mesh_.geometryVersion()
+    };
+    if (cachedGrad_ && cachedVersions_ == versions)
+    {
+        return *cachedGrad_;
+    }
     auto gradBCs = createCalculatedBCs<VolumeBoundary<Vec3>>(phi.mesh());
     VolumeField<Vec3> gradPhi = VolumeField<Vec3>(phi.exec(), "gradPhi", phi.mesh(), gradBCs);
     fill(gradPhi.internalVector(), zero<Vec3>());
-    computeGrad(phi, surfaceInterpolation_, gradPhi);
+    grad(phi, gradPhi);
+    cachedGrad_.emplace(gradPhi);
+    cachedVersions_ = versions;
     return gradPhi;
 }
 
+Vector<Tensor> GaussGreenGrad::grad(const VolumeField<Vec3>& u)
+{
+    const std::array<std::size_t, 3> versions {
+        u.internalVector().version(), u.boundaryData().value().version(), mesh_.geometryVersion()
+    };
+    if (cachedTensorGrad_ && cachedTensorVersions_ == versions)
+    {
+        return *cachedTensorGrad_;
+    }
+    Vector<Tensor> gradU(u.exec(), mesh_.nCells());
+    grad(u, gradU);
+    cachedTensorGrad_.emplace(gradU);
+    cachedTensorVersions_ = versions;
+    return gradU;
+}
+
+const VolumeField<Vec3>& cachedGrad(const VolumeField<scalar>& phi)
+{
+    return cachedGradient(
+        phi,
+        [](const VolumeField<scalar>& field)
+        { return GaussGreenGrad(field.exec(), field.mesh()).grad(field); }
+    );
+}
+
 } // namespace NeoN
@@ -4,59 +4,55 @@
 
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/gaussGreenLaplacian.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReductionTuner.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
 
+/* @brief sums the face normal gradients, the kernel is instantiated for the statically typed
+** coefficient of dsl::Coeff::visit
+*/
+template<typename ValueType, typename CoeffType>
+void computeLaplacianExpScaled(
+    const SurfaceField<scalar>& gamma,
+    const SurfaceField<ValueType>& faceNormalGrad,
+    Vector<ValueType>& lapPhi,
+    const CoeffType operatorScaling
+)
+{
+    const UnstructuredMesh& mesh = gamma.mesh();
+    const auto [result, faceArea, sGamma, fnGrad, invVol] = views(
+        lapPhi,
+        mesh.magFaceAreas(),
+        gamma.internalVector(),
+        faceNormalGrad.internalVector(),
+        mesh.invCellVolumes()
+    );
+
+    reduceAndScaleFaceValues(
+        mesh,
+        result,
+        KOKKOS_LAMBDA(const localIdx i) { return sGamma[i] * faceArea[i] * fnGrad[i]; },
+        true,
+        KOKKOS_LAMBDA(const localIdx celli) { return operatorScaling[celli] * invVol[celli]; }
+    );
+}
+
 template<typename ValueType>
 void computeLaplacianExp(
     const FaceNormalGradient<ValueType>& faceNormalGradient,
-    const SurfaceField<scalar>&, // gamma,
+    const SurfaceField<scalar>& gamma,
     VolumeField<ValueType>& phi,
     Vector<ValueType>& lapPhi,
     const dsl::Coeff operatorScaling
 )
 {
-    const UnstructuredMesh& mesh = phi.mesh();
-    const auto exec = phi.exec();
-
+    FaceReductionTuning tuning(phi.mesh(), "computeLaplacianExp", typeid(ValueType));
     SurfaceField<ValueType> faceNormalGrad = faceNormalGradient.faceNormalGrad(phi);
-
-    const auto [owner, neighbour, surfFaceCells] =
-        views(mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
-
-    const auto [result, faceArea, fnGrad, vol] =
-        views(lapPhi, mesh.magFaceAreas(), faceNormalGrad.internalVector(), mesh.cellVolumes());
-
-    auto nInternalFaces = mesh.nInternalFaces();
-
-    // TODO use NeoN::add and sub
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx i) {
-            ValueType flux = faceArea[i] * fnGrad[i];
-            Kokkos::atomic_add(&result[owner[i]], flux);
-            Kokkos::atomic_sub(&result[neighbour[i]], flux);
-        }
-    );
-
-    parallelFor(
-        exec,
-        {nInternalFaces, fnGrad.size()},
-        KOKKOS_LAMBDA(const localIdx i) {
-            auto own = surfFaceCells[i - nInternalFaces];
-            ValueType valueOwn = faceArea[i] * fnGrad[i];
-            Kokkos::atomic_add(&result[own], valueOwn);
-        }
-    );
-
-    parallelFor(
-        exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli) {
-            result[celli] *= operatorScaling[celli] / vol[celli];
-        }
+    operatorScaling.visit(
+        [&](const auto scaling)
+        { computeLaplacianExpScaled(gamma, faceNormalGrad, lapPhi, scaling); }
     );
 }
 
@@ -84,7 +80,15 @@ void computeLaplacianImpl(
 )
 {
     const UnstructuredMesh& mesh = phi.mesh();
+    // the assembly only distinguishes the colored loop from the atomic one
+    FaceReductionTuning tuning(
+        mesh,
+        "computeLaplacianImp",
+        typeid(ValueType),
+        {FaceReduction::Atomic, FaceReduction::Coloring}
+    );
     const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nCells = mesh.nCells();
     const auto exec = phi.exec();
     const auto [owner, neighbour, surfFaceCells, diagOffs, ownOffs, neiOffs] = views(
         mesh.faceOwner(),
@@ -95,46 +99,61 @@ void computeLaplacianImpl(
         sparsityPattern.neighbourOffset()
     );
 
-    const auto [sGamma, deltaCoeffs, magFaceArea] = views(
+    const auto [sGamma, deltaCoeffs, magFaceArea, phiV] = views(
         gamma.internalVector(),
         faceNormalGradient.deltaCoeffs().internalVector(),
-        mesh.magFaceAreas()
+        mesh.magFaceAreas(),
+        phi.internalVector()
     );
 
     auto [values, colIdxs, rowOffs] = ls.matrix().view();
     auto rhs = ls.rhs().view();
 
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            auto flux = deltaCoeffs[facei] * sGamma[facei] * magFaceArea[facei];
-
-            auto own = owner[facei];
-            auto nei = neighbour[facei];
-
-            // add neighbour contribution upper
-            auto rowNeiStart = rowOffs[nei];
-            auto rowOwnStart = rowOffs[own];
+    // with a face coloring no two faces of a color share a row, thus no atomics are required
+    const bool raceFree = coloredFaceLoops(mesh);
+
+    auto internalKernel = KOKKOS_LAMBDA(const localIdx facei)
+    {
+        auto flux = deltaCoeffs[facei] * sGamma[facei] * magFaceArea[facei];
+
+        auto own = owner[facei];
+        auto nei = neighbour[facei];
+        auto rowOwnStart = rowOffs[own];
+        auto operatorScalingOwn = operatorScaling[own];
+
+        if (nei >= nCells)
+        {
+            // the ghost cell has no row, its current value couples the owner through the rhs
+            scatterAdd(
+                values[rowOwnStart + diagOffs[own]],
+                -flux * one<ValueType>() * operatorScalingOwn,
+                raceFree
+            );
+            scatterAdd(rhs[own], -flux * operatorScalingOwn * phiV[nei], raceFree);
+            return;
+        }
 
-            auto operatorScalingNei = operatorScaling[nei];
-            auto operatorScalingOwn = operatorScaling[own];
+        // add neighbour contribution upper
+        auto rowNeiStart = rowOffs[nei];
+        auto operatorScalingNei = operatorScaling[nei];
 
-            // scalar valueNei = (1 - weight) * flux;
-            values[rowNeiStart + neiOffs[facei]] += flux * one<ValueType>() * operatorScalingNei;
-            Kokkos::atomic_sub(
-                &values[rowOwnStart + diagOffs[own]], flux * one<ValueType>() * operatorScalingOwn
-            );
+        // scalar valueNei = (1 - weight) * flux;
+        values[rowNeiStart + neiOffs[facei]] += flux * one<ValueType>() * operatorScalingNei;
+        scatterAdd(
+            values[rowOwnStart + diagOffs[own]],
+            -flux * one<ValueType>() * operatorScalingOwn,
+            raceFree
+        );
 
-            // upper triangular part
-            // add owner contribution lower
-            values[rowOwnStart + ownOffs[facei]] += flux * one<ValueType>() * operatorScalingOwn;
-            Kokkos::atomic_sub(
-                &values[rowNeiStart + diagOffs[nei]], flux * one<ValueType>() * operatorScalingNei
-            );
-        },
-        "computeLocalLaplacianCoefficients"
-    );
+        // upper triangular part
+        // add owner contribution lower
+        values[rowOwnStart + ownOffs[facei]] += flux * one<ValueType>() * operatorScalingOwn;
+        scatterAdd(
+            values[rowNeiStart + diagOffs[nei]],
+            -flux * one<ValueType>() * operatorScalingNei,
+            raceFree
+        );
+    };
 
     auto [refGradient, value, valueFraction, refValue] = views(
         phi.boundaryData().refGrad(),
@@ -143,37 +162,53 @@ void computeLaplacianImpl(
         phi.boundaryData().refValue()
     );
 
-    auto& bcCoeffs =
-        ls.auxiliaryCoefficients().template get<la::BoundaryCoefficients<ValueType, localIdx>>(
-            "boundaryCoefficients"
-        );
+    auto& bcCoeffs = ls.boundaryCoefficients();
 
     auto [boundValues, rhsBoundValues] = views(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
 
-    parallelFor(
-        exec,
-        {nInternalFaces, sGamma.size()},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            auto bcfacei = facei - nInternalFaces;
-            auto flux = sGamma[facei] * magFaceArea[facei];
-
-            auto own = surfFaceCells[bcfacei];
-            auto rowOwnStart = rowOffs[own];
-            auto operatorScalingOwn = operatorScaling[own];
-
-            ValueType valueMat = flux * operatorScalingOwn * valueFraction[bcfacei]
-                               * deltaCoeffs[facei] * one<ValueType>();
-            Kokkos::atomic_sub(&values[rowOwnStart + diagOffs[own]], valueMat);
-            boundValues[bcfacei] = valueMat;
-
-            ValueType valueRhs = flux * operatorScalingOwn
-                               * (valueFraction[bcfacei] * deltaCoeffs[facei] * refValue[bcfacei]
-                                  + (1.0 - valueFraction[bcfacei]) * refGradient[bcfacei]);
-            Kokkos::atomic_sub(&rhs[own], valueRhs);
-            rhsBoundValues[bcfacei] = valueRhs;
-        },
-        "computeInterfaceLaplacianCoefficients"
-    );
+    auto boundaryKernel = KOKKOS_LAMBDA(const localIdx facei)
+    {
+        auto bcfacei = facei - nInternalFaces;
+        auto flux = sGamma[facei] * magFaceArea[facei];
+
+        auto own = surfFaceCells[bcfacei];
+        auto rowOwnStart = rowOffs[own];
+        auto operatorScalingOwn = operatorScaling[own];
+
+        ValueType valueMat = flux * operatorScalingOwn * valueFraction[bcfacei]
+                           * deltaCoeffs[facei] * one<ValueType>();
+        scatterAdd(values[rowOwnStart + diagOffs[own]], -1.0 * valueMat, raceFree);
+        boundValues[bcfacei] = valueMat;
+
+        ValueType valueRhs = flux * operatorScalingOwn
+                           * (valueFraction[bcfacei] * deltaCoeffs[facei] * refValue[bcfacei]
+                              + (1.0 - valueFraction[bcfacei]) * refGradient[bcfacei]);
+        scatterAdd(rhs[own], -1.0 * valueRhs, raceFree);
+        rhsBoundValues[bcfacei] = valueRhs;
+    };
+
+    if (raceFree)
+    {
+        const auto& coloring = FaceColoring::readOrCreate(mesh);
+        coloredParallelFor(
+            exec, coloring.internalFaces(), internalKernel, "computeLocalLaplacianCoefficients"
+        );
+        coloredParallelFor(
+            exec, coloring.boundaryFaces(), boundaryKernel, "computeInterfaceLaplacianCoefficients"
+        );
+    }
+    else
+    {
+        parallelFor(
+            exec, {0, nInternalFaces}, internalKernel, "computeLocalLaplacianCoefficients"
+        );
+        parallelFor(
+            exec,
+            {nInternalFaces, sGamma.size()},
+            boundaryKernel,
+            "computeInterfaceLaplacianCoefficients"
+        );
+    }
 }
 
 #define NN_DECLARE_COMPUTE_IMP_LAP(TYPENAME)                                                       \
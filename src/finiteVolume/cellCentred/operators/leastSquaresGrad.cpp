@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/finiteVolume/cellCentred/operators/leastSquaresGrad.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+
+#include <utility>
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief the distance from the centre of celli to the other side of face facei */
+KOKKOS_INLINE_FUNCTION
+Vec3 leastSquaresDistance(
+    const localIdx celli,
+    const localIdx facei,
+    const localIdx nInternalFaces,
+    const View<const label> owner,
+    const View<const label> neighbour,
+    const View<const Vec3> cellCentres,
+    const View<const Vec3> faceCentres
+)
+{
+    if (facei >= nInternalFaces)
+    {
+        return faceCentres[facei] - cellCentres[celli];
+    }
+    const auto other = owner[facei] == celli ? neighbour[facei] : owner[facei];
+    return cellCentres[other] - cellCentres[celli];
+}
+
+LeastSquaresMatrices computeLeastSquaresMatrices(const UnstructuredMesh& mesh)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    Vector<scalar> invMatrices(mesh.exec(), nPackedSymmEntries * mesh.nCells());
+    auto inv = invMatrices.view();
+    const auto [cellFaces, segments, owner, neighbour, cellCentres, faceCentres] = views(
+        stencil.values(),
+        stencil.segments(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.cellCentres(),
+        mesh.faceCentres()
+    );
+    const auto nInternalFaces = mesh.nInternalFaces();
+
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            scalar xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                const auto d = leastSquaresDistance(
+                    celli, cellFaces[i], nInternalFaces, owner, neighbour, cellCentres, faceCentres
+                );
+                const auto w = 1.0 / (d & d);
+                xx += w * d[0] * d[0];
+                xy += w * d[0] * d[1];
+                xz += w * d[0] * d[2];
+                yy += w * d[1] * d[1];
+                yz += w * d[1] * d[2];
+                zz += w * d[2] * d[2];
+            }
+            // the inverse of the symmetric matrix from its cofactors
+            const scalar cxx = yy * zz - yz * yz;
+            const scalar cxy = xz * yz - xy * zz;
+            const scalar cxz = xy * yz - xz * yy;
+            const scalar invDet = 1.0 / (xx * cxx + xy * cxy + xz * cxz);
+            const auto start = nPackedSymmEntries * celli;
+            inv[start] = invDet * cxx;
+            inv[start + 1] = invDet * cxy;
+            inv[start + 2] = invDet * cxz;
+            inv[start + 3] = invDet * (xx * zz - xz * xz);
+            inv[start + 4] = invDet * (xy * xz - xx * yz);
+            inv[start + 5] = invDet * (xx * yy - xy * xy);
+        },
+        "computeLeastSquaresMatrices"
+    );
+
+    return LeastSquaresMatrices {std::move(invMatrices), mesh.geometryVersion()};
+}
+
+const LeastSquaresMatrices& LeastSquaresMatrices::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<LeastSquaresMatrices> key("LeastSquaresMatrices");
+    auto& matrices =
+        mesh.stencilDB().getOrCreate(key, [&]() { return computeLeastSquaresMatrices(mesh); });
+    if (matrices.geometryVersion != mesh.geometryVersion())
+    {
+        matrices = computeLeastSquaresMatrices(mesh);
+    }
+    return matrices;
+}
+
+LeastSquaresGrad::LeastSquaresGrad(const Executor&, const UnstructuredMesh& mesh) : mesh_(mesh) {}
+
+void LeastSquaresGrad::grad(const VolumeField<scalar>& phi, VolumeField<Vec3>& gradPhi)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh_);
+    const auto& matrices = LeastSquaresMatrices::readOrCreate(mesh_);
+    auto res = gradPhi.internalVector().view();
+    const auto [cellFaces, segments, owner, neighbour, cellCentres, faceCentres] = views(
+        stencil.values(),
+        stencil.segments(),
+        mesh_.faceOwner(),
+        mesh_.faceNeighbour(),
+        mesh_.cellCentres(),
+        mesh_.faceCentres()
+    );
+    const auto [inv, phiV, phiB] =
+        views(matrices.invMatrices, phi.internalVector(), phi.boundaryData().value());
+    const auto nInternalFaces = mesh_.nInternalFaces();
+
+    parallelFor(
+        phi.exec(),
+        {0, mesh_.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            const scalar phiC = phiV[celli];
+            Vec3 sum = zero<Vec3>();
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                const auto facei = cellFaces[i];
+                const auto d = leastSquaresDistance(
+                    celli, facei, nInternalFaces, owner, neighbour, cellCentres, faceCentres
+                );
+                scalar phiF = 0;
+                if (facei >= nInternalFaces)
+                {
+                    phiF = phiB[facei - nInternalFaces];
+                }
+                else
+                {
+                    phiF = phiV[owner[facei] == celli ? neighbour[facei] : owner[facei]];
+                }
+                sum += ((phiF - phiC) / (d & d)) * d;
+            }
+            const auto start = nPackedSymmEntries * celli;
+            res[celli] = Vec3(
+                inv[start] * sum[0] + inv[start + 1] * sum[1] + inv[start + 2] * sum[2],
+                inv[start + 1] * sum[0] + inv[start + 3] * sum[1] + inv[start + 4] * sum[2],
+                inv[start + 2] * sum[0] + inv[start + 4] * sum[1] + inv[start + 5] * sum[2]
+            );
+        },
+        "leastSquaresGrad"
+    );
+}
+
+VolumeField<Vec3> LeastSquaresGrad::grad(const VolumeField<scalar>& phi)
+{
+    auto gradBCs = createCalculatedBCs<VolumeBoundary<Vec3>>(phi.mesh());
+    VolumeField<Vec3> gradPhi = VolumeField<Vec3>(phi.exec(), "gradPhi", phi.mesh(), gradBCs);
+    grad(phi, gradPhi);
+    return gradPhi;
+}
+
+} // namespace NeoN
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/matrixFreeOperator.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedCoefficients.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief returns the mesh of the fused terms or exits if the expression has no implicit terms */
+template<typename ValueType>
+const UnstructuredMesh* fusedMesh(const FusedExpression<ValueType>& fused)
+{
+    if (!fused.fusedImplicitTerms().empty())
+    {
+        return &fused.fusedImplicitTerms()[0].phi->mesh();
+    }
+    if (!fused.fusedSources().empty())
+    {
+        return &fused.fusedSources()[0]->getVector().mesh();
+    }
+    if (!fused.fusedDdts().empty())
+    {
+        return &fused.fusedDdts()[0]->getVector().mesh();
+    }
+    NF_ERROR_EXIT("A matrix free operator requires at least one implicit operator.");
+    return nullptr;
+}
+
+template<typename ValueType>
+MatrixFreeOperator<ValueType>::MatrixFreeOperator(dsl::Expression<ValueType>& expr, scalar dt)
+    : fused_(expr), mesh_(fusedMesh(fused_)), dt_(dt)
+{
+    NF_ASSERT(
+        fused_.implicitFullyFused(),
+        "All implicit operators of a matrix free operator have to be fusable."
+    );
+}
+
+template<typename ValueType>
+void MatrixFreeOperator<ValueType>::apply(View<const ValueType> x, View<ValueType> y) const
+{
+    const auto& mesh = *mesh_;
+    const auto [owner, neighbour, faceCells] =
+        views(mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nCells = mesh.nCells();
+
+    const FusedCellCoefficients<ValueType> cellCoefficients(
+        fused_.fusedSources(), fused_.fusedDdts(), dt_, mesh
+    );
+    parallelFor(
+        mesh.exec(),
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) { y[celli] = cellCoefficients.diag(celli) * x[celli]; },
+        "MatrixFreeOperator::applyCells"
+    );
+
+    // with a face coloring no two faces of a color share a row, thus no atomics are required
+    const bool raceFree = coloredFaceLoops(mesh);
+    const auto& terms = fused_.fusedImplicitTerms();
+    const auto nTerms = static_cast<localIdx>(terms.size());
+    for (localIdx start = 0; start < nTerms; start += maxFusedTerms)
+    {
+        const FusedFaceCoefficients<ValueType> coefficients(
+            terms.data() + start, std::min(maxFusedTerms, nTerms - start)
+        );
+        fusedFaceLoops(
+            mesh,
+            raceFree,
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto own = owner[facei];
+                const auto nei = neighbour[facei];
+                if (nei >= nCells)
+                {
+                    // the ghost cells are coupled through the rhs
+                    const auto g = coefficients.ghostFace(facei, own, nei);
+                    scatterAdd(y[own], g.ownDiag * x[own], raceFree);
+                    return;
+                }
+                const auto c = coefficients.internalFace(facei, own, nei);
+                scatterAdd(y[own], c.ownDiag * x[own] + c.upper * x[nei], raceFree);
+                scatterAdd(y[nei], c.lower * x[own] + c.neiDiag * x[nei], raceFree);
+            },
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto own = faceCells[facei - nInternalFaces];
+                const auto c = coefficients.boundaryFace(facei, own);
+                scatterAdd(y[own], cmptMultiply(c.diag, x[own]), raceFree);
+            },
+            "MatrixFreeOperator::apply"
+        );
+    }
+}
+
+template<typename ValueType>
+void MatrixFreeOperator<ValueType>::rhs(Vector<ValueType>& bV) const
+{
+    NF_ASSERT(bV.size() == nRows(), "The rhs does not match the size of the linear operator");
+    const auto& mesh = *mesh_;
+    const auto faceCells = mesh.boundaryMesh().faceCells().view();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    auto b = bV.view();
+
+    const FusedCellCoefficients<ValueType> cellCoefficients(
+        fused_.fusedSources(), fused_.fusedDdts(), dt_, mesh
+    );
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) { b[celli] = cellCoefficients.source(celli); },
+        "MatrixFreeOperator::rhsCells"
+    );
+
+    // only the boundary faces and the faces of the ghost cells contribute to the rhs, the latter
+    // are the last internal faces
+    const bool raceFree = coloredFaceLoops(mesh);
+    const auto [owner, neighbour] = views(mesh.faceOwner(), mesh.faceNeighbour());
+    const auto& terms = fused_.fusedImplicitTerms();
+    const auto nTerms = static_cast<localIdx>(terms.size());
+    for (localIdx start = 0; start < nTerms; start += maxFusedTerms)
+    {
+        const FusedFaceCoefficients<ValueType> coefficients(
+            terms.data() + start, std::min(maxFusedTerms, nTerms - start)
+        );
+        if (mesh.nGhostCells() > 0)
+        {
+            parallelFor(
+                mesh.exec(),
+                {nInternalFaces - mesh.nGhostCells(), nInternalFaces},
+                KOKKOS_LAMBDA(const localIdx facei) {
+                    const auto own = owner[facei];
+                    atomicAdd(&b[own], coefficients.ghostFace(facei, own, neighbour[facei]).source);
+                },
+                "MatrixFreeOperator::rhsGhostFaces"
+            );
+        }
+        auto boundaryKernel = KOKKOS_LAMBDA(const localIdx facei)
+        {
+            const auto own = faceCells[facei - nInternalFaces];
+            scatterAdd(b[own], coefficients.boundaryFace(facei, own).source, raceFree);
+        };
+        if (raceFree)
+        {
+            coloredParallelFor(
+                mesh.exec(),
+                FaceColoring::readOrCreate(mesh).boundaryFaces(),
+                boundaryKernel,
+                "MatrixFreeOperator::rhsBoundary"
+            );
+        }
+        else
+        {
+            parallelFor(
+                mesh.exec(),
+                {nInternalFaces, nInternalFaces + mesh.nBoundaryFaces()},
+                boundaryKernel,
+                "MatrixFreeOperator::rhsBoundary"
+            );
+        }
+    }
+}
+
+// instantiate the template class
+template class MatrixFreeOperator<scalar>;
+template class MatrixFreeOperator<Vec3>;
+
+} // namespace NeoN::finiteVolume::cellCentred
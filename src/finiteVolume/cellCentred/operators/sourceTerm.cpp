@@ -31,7 +31,8 @@ void SourceTerm<ValueType>::explicitOperation(Vector<ValueType>& source) const
         source.range(),
         KOKKOS_LAMBDA(const localIdx celli) {
             sourceView[celli] += operatorScaling[celli] * coeff[celli] * fieldView[celli];
-        }
+        },
+        "SourceTerm::explicit"
     );
 }
 
@@ -44,14 +45,16 @@ void SourceTerm<ValueType>::implicitOperation(la::LinearSystem<ValueType, localI
         views(getSparsityPattern().diagOffset(), coefficients_.internalVector());
     auto [matrix, rhs] = ls.view();
 
+    // the rows are the local cells, the coefficients also hold the ghost cells
     NeoN::parallelFor(
         ls.exec(),
-        {0, coeff.size()},
+        {0, rhs.size()},
         KOKKOS_LAMBDA(const localIdx celli) {
             localIdx idx = matrix.rowOffs[celli] + diagOffs[celli];
             matrix.values[idx] +=
                 operatorScaling[celli] * coeff[celli] * vol[celli] * one<ValueType>();
-        }
+        },
+        "SourceTerm::implicit"
     );
 }
 
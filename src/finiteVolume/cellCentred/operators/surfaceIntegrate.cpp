@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "NeoN/core/atomic.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/surfaceIntegrate.hpp"
 
@@ -16,20 +17,21 @@ void surfaceIntegrate(
     View<const int> owner,
     View<const int> faceCells,
     View<const ValueType> flux,
-    View<const scalar> v,
+    View<const scalar> invVol,
     View<ValueType> res,
     const dsl::Coeff operatorScaling
 )
 {
-    auto nCells = v.size();
+    auto nCells = invVol.size();
     const auto nBoundaryFaces = faceCells.size();
     parallelFor(
         exec,
         {0, nInternalFaces},
         KOKKOS_LAMBDA(const localIdx i) {
-            Kokkos::atomic_add(&res[static_cast<size_t>(owner[i])], flux[i]);
+            atomicAdd(&res[static_cast<size_t>(owner[i])], flux[i]);
             Kokkos::atomic_sub(&res[static_cast<size_t>(neighbour[i])], flux[i]);
-        }
+        },
+        "surfaceIntegrate::internal"
     );
 
     parallelFor(
@@ -37,14 +39,18 @@ void surfaceIntegrate(
         {nInternalFaces, nInternalFaces + nBoundaryFaces},
         KOKKOS_LAMBDA(const localIdx i) {
             auto own = faceCells[i - nInternalFaces];
-            Kokkos::atomic_add(&res[own], flux[i]);
-        }
+            atomicAdd(&res[own], flux[i]);
+        },
+        "surfaceIntegrate::boundary"
     );
 
     parallelFor(
         exec,
         {0, nCells},
-        KOKKOS_LAMBDA(const localIdx celli) { res[celli] *= operatorScaling[celli] / v[celli]; }
+        KOKKOS_LAMBDA(const localIdx celli) {
+            res[celli] *= operatorScaling[celli] * invVol[celli];
+        },
+        "surfaceIntegrate::scale"
     );
 }
 
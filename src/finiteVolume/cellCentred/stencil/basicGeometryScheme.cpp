@@ -5,6 +5,7 @@
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/stencil/basicGeometryScheme.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceRanges.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -31,26 +32,21 @@ void BasicGeometryScheme::updateWeights(const Executor& exec, SurfaceField<scala
         KOKKOS_LAMBDA(const localIdx facei) {
             scalar sfdOwn = std::abs(sf[facei] & (cf[facei] - c[owner[facei]]));
             scalar sfdNei = std::abs(sf[facei] & (c[neighbour[facei]] - cf[facei]));
-
-            if (std::abs(sfdOwn + sfdNei) > ROOTVSMALL)
-            {
-                weightS[facei] = sfdNei / (sfdOwn + sfdNei);
-            }
-            else
-            {
-                weightS[facei] = 0.5;
-            }
-        }
+            // a select instead of a branch keeps the loop vectorizable
+            const scalar sfd = sfdOwn + sfdNei;
+            weightS[facei] = std::abs(sfd) > ROOTVSMALL ? sfdNei / sfd : 0.5;
+        },
+        "BasicGeometryScheme::weightsInternal"
     );
 
-    parallelFor(
+    parallelForBoundaryFaces(
         exec,
-        {nInternalFaces, weightS.size()},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            const auto bcfacei = facei - nInternalFaces;
+        mesh_,
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
             weightS[facei] = 1.0;
-            weightB[bcfacei] = 1.0;
-        }
+            weightB[bfacei] = 1.0;
+        },
+        "BasicGeometryScheme::weightsBoundary"
     );
 }
 
@@ -72,20 +68,20 @@ void BasicGeometryScheme::updateDeltaCoeffs(
         KOKKOS_LAMBDA(const localIdx facei) {
             Vec3 cellToCellDist = cellCentre[neighbour[facei]] - cellCentre[owner[facei]];
             deltaCoeff[facei] = 1.0 / mag(cellToCellDist);
-        }
+        },
+        "BasicGeometryScheme::deltaCoeffsInternal"
     );
 
-    const auto nInternalFaces = mesh_.nInternalFaces();
-
-    parallelFor(
+    parallelForBoundaryFaces(
         exec,
-        {nInternalFaces, deltaCoeff.size()},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            auto own = surfFaceCells[facei - nInternalFaces];
+        mesh_,
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            auto own = surfFaceCells[bfacei];
             Vec3 cellToCellDist = cf[facei] - cellCentre[own];
 
             deltaCoeff[facei] = 1.0 / mag(cellToCellDist);
-        }
+        },
+        "BasicGeometryScheme::deltaCoeffsBoundary"
     );
 }
 
@@ -117,14 +113,15 @@ void BasicGeometryScheme::updateNonOrthDeltaCoeffs(
 
 
             nonOrthDeltaCoeff[facei] = 1.0 / std::max(orthoDist, 0.05 * mag(cellToCellDist));
-        }
+        },
+        "BasicGeometryScheme::nonOrthDeltaCoeffsInternal"
     );
 
-    parallelFor(
+    parallelForBoundaryFaces(
         exec,
-        {nInternalFaces, nonOrthDeltaCoeff.size()},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            auto own = surfFaceCells[facei - nInternalFaces];
+        mesh_,
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+            auto own = surfFaceCells[bfacei];
             Vec3 cellToCellDist = cf[facei] - cellCentre[own];
             Vec3 faceNormal = 1 / faceArea[facei] * faceAreaVec3[facei];
 
@@ -132,16 +129,39 @@ void BasicGeometryScheme::updateNonOrthDeltaCoeffs(
 
 
             nonOrthDeltaCoeff[facei] = 1.0 / std::max(orthoDist, 0.05 * mag(cellToCellDist));
-        }
+        },
+        "BasicGeometryScheme::nonOrthDeltaCoeffsBoundary"
     );
 }
 
 
 void BasicGeometryScheme::updateNonOrthDeltaCoeffs(
-    [[maybe_unused]] const Executor& exec, [[maybe_unused]] SurfaceField<Vec3>& nonOrthDeltaCoeffs
+    const Executor& exec, SurfaceField<Vec3>& nonOrthCorrectionVec3s
 )
 {
-    NF_ERROR_EXIT("Not implemented");
+    const auto [owner, neighbour] = views(mesh_.faceOwner(), mesh_.faceNeighbour());
+    const auto [cellCentre, faceAreaVec3, faceArea] =
+        views(mesh_.cellCentres(), mesh_.faceAreas(), mesh_.magFaceAreas());
+
+    auto correctionVec3 = nonOrthCorrectionVec3s.internalVector().view();
+    // boundary faces are not corrected
+    fill(nonOrthCorrectionVec3s.internalVector(), zero<Vec3>());
+
+    parallelFor(
+        exec,
+        {0, mesh_.nInternalFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            Vec3 cellToCellDist = cellCentre[neighbour[facei]] - cellCentre[owner[facei]];
+            Vec3 faceNormal = 1 / faceArea[facei] * faceAreaVec3[facei];
+
+            scalar orthoDist = faceNormal & cellToCellDist;
+            scalar nonOrthDeltaCoeff = 1.0 / std::max(orthoDist, 0.05 * mag(cellToCellDist));
+
+            // k_f = n_f - d_f nonOrthDeltaCoeff_f, the part of n_f not along d_f
+            correctionVec3[facei] = faceNormal - nonOrthDeltaCoeff * cellToCellDist;
+        },
+        "BasicGeometryScheme::nonOrthCorrection"
+    );
 }
 
 } // namespace NeoN
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToCellStencil.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief copies the sorted and unique prefix of every candidate segment into a new stencil
+ *
+ * @param candidates The candidate segments, the first nUnique[celli] values of segment celli
+ * are kept
+ * @param nUnique The number of values of every segment to keep
+ */
+SegmentedVector<localIdx, localIdx> compressStencil(
+    const SegmentedVector<localIdx, localIdx>& candidates, const Vector<localIdx>& nUnique
+)
+{
+    SegmentedVector<localIdx, localIdx> stencil(nUnique);
+    auto [values, segments] = stencil.views();
+    const auto [candidateValues, candidateSegments] =
+        views(candidates.values(), candidates.segments());
+
+    parallelFor(
+        candidates.exec(),
+        {0, stencil.numSegments()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            const auto offset = candidateSegments[celli] - segments[celli];
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                values[i] = candidateValues[i + offset];
+            }
+        },
+        "compressCellToCellStencil"
+    );
+    return stencil;
+}
+
+CellToCellStencil::CellToCellStencil(const UnstructuredMesh& mesh) : mesh_(mesh) {}
+
+const SegmentedVector<localIdx, localIdx>&
+CellToCellStencil::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<SegmentedVector<localIdx, localIdx>> key("CellToCellStencil");
+    return mesh.stencilDB().getOrCreate(
+        key, [&]() { return CellToCellStencil(mesh).computeStencil(); }
+    );
+}
+
+const SegmentedVector<localIdx, localIdx>&
+CellToCellStencil::readOrCreateExtended(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<SegmentedVector<localIdx, localIdx>> key("ExtendedCellToCellStencil");
+    return mesh.stencilDB().getOrCreate(
+        key, [&]() { return CellToCellStencil(mesh).computeExtendedStencil(); }
+    );
+}
+
+SegmentedVector<localIdx, localIdx> CellToCellStencil::computeStencil() const
+{
+    const auto exec = mesh_.exec();
+    const auto& cellFaces = CellToFaceStencil::readOrCreate(mesh_);
+    const auto [faces, faceSegments, owner, neighbour] =
+        views(cellFaces.values(), cellFaces.segments(), mesh_.faceOwner(), mesh_.faceNeighbour());
+    const auto nInternalFaces = mesh_.nInternalFaces();
+
+    // every internal face of a cell adds one neighbour
+    Vector<localIdx> nNeighbours(exec, mesh_.nCells());
+    auto nNeighboursView = nNeighbours.view();
+    parallelFor(
+        exec,
+        {0, mesh_.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            localIdx count = 0;
+            for (auto i = faceSegments[celli]; i < faceSegments[celli + 1]; i++)
+            {
+                if (faces[i] < nInternalFaces)
+                {
+                    count++;
+                }
+            }
+            nNeighboursView[celli] = count;
+        },
+        "countCellToCellStencil"
+    );
+
+    SegmentedVector<localIdx, localIdx> candidates(nNeighbours);
+    auto [values, segments] = candidates.views();
+    parallelFor(
+        exec,
+        {0, mesh_.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            auto j = segments[celli];
+            for (auto i = faceSegments[celli]; i < faceSegments[celli + 1]; i++)
+            {
+                const auto facei = faces[i];
+                if (facei < nInternalFaces)
+                {
+                    const auto own = static_cast<localIdx>(owner[facei]);
+                    values[j++] = own == celli ? static_cast<localIdx>(neighbour[facei]) : own;
+                }
+            }
+            // duplicates occur if two cells share several faces
+            nNeighboursView[celli] =
+                sortUniqueSegment(values, segments[celli], segments[celli + 1]) - segments[celli];
+        },
+        "fillCellToCellStencil"
+    );
+
+    return compressStencil(candidates, nNeighbours);
+}
+
+SegmentedVector<localIdx, localIdx> CellToCellStencil::computeExtendedStencil() const
+{
+    const auto exec = mesh_.exec();
+    const auto& firstRing = readOrCreate(mesh_);
+    const auto [ring, ringSegments] = views(firstRing.values(), firstRing.segments());
+
+    // the first ring and the first rings of all neighbours bound the stencil size
+    Vector<localIdx> nNeighbours(exec, mesh_.nCells());
+    auto nNeighboursView = nNeighbours.view();
+    parallelFor(
+        exec,
+        {0, mesh_.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            auto count = ringSegments[celli + 1] - ringSegments[celli];
+            for (auto i = ringSegments[celli]; i < ringSegments[celli + 1]; i++)
+            {
+                count += ringSegments[ring[i] + 1] - ringSegments[ring[i]];
+            }
+            nNeighboursView[celli] = count;
+        },
+        "countExtendedCellToCellStencil"
+    );
+
+    SegmentedVector<localIdx, localIdx> candidates(nNeighbours);
+    auto [values, segments] = candidates.views();
+    parallelFor(
+        exec,
+        {0, mesh_.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            auto j = segments[celli];
+            for (auto i = ringSegments[celli]; i < ringSegments[celli + 1]; i++)
+            {
+                const auto nei = ring[i];
+                values[j++] = nei;
+                for (auto k = ringSegments[nei]; k < ringSegments[nei + 1]; k++)
+                {
+                    // the cell itself is a neighbour of all its neighbours
+                    if (ring[k] != celli)
+                    {
+                        values[j++] = ring[k];
+                    }
+                }
+            }
+            const auto start = segments[celli];
+            nNeighboursView[celli] = sortUniqueSegment(values, start, j) - start;
+        },
+        "fillExtendedCellToCellStencil"
+    );
+
+    return compressStencil(candidates, nNeighbours);
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -2,83 +2,92 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <limits>
+
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
 
-CellToFaceStencil::CellToFaceStencil(const UnstructuredMesh& mesh) : mesh_(mesh) {}
-
-SegmentedVector<localIdx, localIdx> CellToFaceStencil::computeStencil() const
+namespace
 {
-    const auto exec = mesh_.exec();
-    const auto nCells = mesh_.nCells();
-    const auto [faceOwner, faceNeighbour, faceFaceCells] =
-        views(mesh_.faceOwner(), mesh_.faceNeighbour(), mesh_.boundaryMesh().faceCells());
-
-    const auto nInternalFaces = mesh_.nInternalFaces();
 
-    Vector<localIdx> nFacesPerCell(exec, nCells, 0);
-    View<localIdx> nFacesPerCellView = nFacesPerCell.view();
-
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx i) {
-            Kokkos::atomic_increment(&nFacesPerCellView[static_cast<size_t>(faceOwner[i])]
-            ); // hit on performance on serial
-            Kokkos::atomic_increment(&nFacesPerCellView[static_cast<size_t>(faceNeighbour[i])]);
-        }
-    );
-
-    parallelFor(
+localIdx computeUniformSegmentSize(
+    const Executor& exec, const SegmentedVector<localIdx, localIdx>& stencil
+)
+{
+    const auto segments = stencil.segments().view();
+    // the serial reduction starts from the initial values, not from the reducer identity
+    localIdx minSize = std::numeric_limits<localIdx>::max();
+    localIdx maxSize = 0;
+    Kokkos::Min<localIdx> minReducer(minSize);
+    Kokkos::Max<localIdx> maxReducer(maxSize);
+    parallelReduce(
         exec,
-        {0, faceFaceCells.size()},
-        KOKKOS_LAMBDA(const localIdx i) {
-            Kokkos::atomic_increment(&nFacesPerCellView[faceFaceCells[i]]);
-        }
+        {0, stencil.numSegments()},
+        KOKKOS_LAMBDA(const localIdx celli, localIdx& lmin, localIdx& lmax) {
+            const auto size = segments[celli + 1] - segments[celli];
+            lmin = size < lmin ? size : lmin;
+            lmax = size > lmax ? size : lmax;
+        },
+        minReducer,
+        maxReducer,
+        "CellToFaceStencil::uniformSegmentSize"
     );
+    return stencil.numSegments() > 0 && minSize == maxSize ? minSize : localIdx(0);
+}
 
-    SegmentedVector<localIdx, localIdx> stencil(nFacesPerCell); // guessed
-    auto [stencilValues, segment] = stencil.views();
-
-    fill(nFacesPerCell, 0); // reset nFacesPerCell
-
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            localIdx owner = faceOwner[facei];
-            localIdx neighbour = faceNeighbour[facei];
+}
 
-            // return the oldValues
-            localIdx segIdxOwn = Kokkos::atomic_fetch_add(
-                &nFacesPerCellView[owner], 1
-            ); // hit on performance on serial
-            localIdx segIdxNei = Kokkos::atomic_fetch_add(&nFacesPerCellView[neighbour], 1);
+CellToFaceStencil::CellToFaceStencil(const UnstructuredMesh& mesh) : mesh_(mesh) {}
 
-            auto startSegOwn = segment[owner];
-            auto startSegNei = segment[neighbour];
-            Kokkos::atomic_assign(&stencilValues[startSegOwn + segIdxOwn], facei);
-            Kokkos::atomic_assign(&stencilValues[startSegNei + segIdxNei], facei);
-        }
+const SegmentedVector<localIdx, localIdx>&
+CellToFaceStencil::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<SegmentedVector<localIdx, localIdx>> key("CellToFaceStencil");
+    return mesh.stencilDB().getOrCreate(
+        key, [&]() { return CellToFaceStencil(mesh).computeStencil(); }
     );
+}
 
-    parallelFor(
-        exec,
-        {nInternalFaces, nInternalFaces + faceFaceCells.size()},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            localIdx owner = faceFaceCells[facei - nInternalFaces];
-            // return the oldValues
-            localIdx segIdxOwn = Kokkos::atomic_fetch_add(
-                &nFacesPerCellView[owner], 1
-            ); // hit on performance on serial
-            localIdx startSegOwn = segment[owner];
-            Kokkos::atomic_assign(&stencilValues[startSegOwn + segIdxOwn], facei);
-        }
+localIdx CellToFaceStencil::uniformSegmentSize(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<localIdx> key("CellToFaceStencilUniformSegmentSize");
+    return mesh.stencilDB().getOrCreate(
+        key, [&]() { return computeUniformSegmentSize(mesh.exec(), readOrCreate(mesh)); }
     );
+}
 
+SegmentedVector<localIdx, localIdx> CellToFaceStencil::computeStencil() const
+{
+    const auto exec = mesh_.exec();
+    const auto [faceOwner, faceNeighbour, faceFaceCells] =
+        views(mesh_.faceOwner(), mesh_.faceNeighbour(), mesh_.boundaryMesh().faceCells());
+    const auto nInternalFaces = mesh_.nInternalFaces();
+
+    // the entries are the owner and the neighbour side of every internal face followed by the
+    // boundary faces, the faces of every cell are sorted, which is the order on all executors,
+    // the ghost cells get segments after the local cells
+    const auto nInternalSides = 2 * nInternalFaces;
+    const auto nSegments = mesh_.nCells() + mesh_.nGhostCells();
+    SegmentedVector<localIdx, localIdx> stencil(exec, 0, nSegments);
+    SegmentedVectorBuilder<localIdx, localIdx>(exec).build(
+        stencil,
+        nSegments,
+        nInternalSides + faceFaceCells.size(),
+        KOKKOS_LAMBDA(const localIdx p) {
+            if (p < nInternalSides)
+            {
+                return p % 2 == 0 ? faceOwner[p / 2] : faceNeighbour[p / 2];
+            }
+            return faceFaceCells[p - nInternalSides];
+        },
+        KOKKOS_LAMBDA(const localIdx p) {
+            return p < nInternalSides ? p / 2 : p - nInternalFaces;
+        },
+        true
+    );
     return stencil;
 }
 
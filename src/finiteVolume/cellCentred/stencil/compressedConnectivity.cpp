@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/compressedConnectivity.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/stencilDataBase.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief the largest absolute difference of neighbour and owner of the internal faces, negative
+ * if the faces are not sorted by owner
+ */
+std::int64_t maxNeighbourDelta(View<const label> owner, View<const label> neighbour)
+{
+    std::int64_t maxDelta = 0;
+    for (localIdx facei = 0; facei < owner.size(); facei++)
+    {
+        if (facei > 0 && owner[facei] < owner[facei - 1])
+        {
+            return -1;
+        }
+        const auto delta =
+            static_cast<std::int64_t>(neighbour[facei]) - static_cast<std::int64_t>(owner[facei]);
+        maxDelta = std::max(maxDelta, delta < 0 ? -delta : delta);
+    }
+    return maxDelta;
+}
+
+/* @brief the neighbour to owner differences packed into words, see CompressedConnectivityView */
+Vector<std::uint32_t> packNeighbourDeltas(
+    const Executor& exec, View<const label> owner, View<const label> neighbour, DeltaWidth width
+)
+{
+    const bool packed = width == DeltaWidth::Bits16;
+    const auto nFaces = static_cast<size_t>(owner.size());
+    std::vector<std::uint32_t> words(packed ? (nFaces + 1) / 2 : nFaces, 0);
+    for (localIdx facei = 0; facei < owner.size(); facei++)
+    {
+        const auto delta = static_cast<std::int32_t>(
+            static_cast<std::int64_t>(neighbour[facei]) - static_cast<std::int64_t>(owner[facei])
+        );
+        const auto f = static_cast<size_t>(facei);
+        if (packed)
+        {
+            const auto bits = static_cast<std::uint16_t>(static_cast<std::int16_t>(delta));
+            words[f / 2] |= static_cast<std::uint32_t>(bits) << (16 * (f % 2));
+        }
+        else
+        {
+            words[f] = static_cast<std::uint32_t>(delta);
+        }
+    }
+    return Vector<std::uint32_t>(exec, words);
+}
+
+}
+
+bool CompressedConnectivity::compressible(const UnstructuredMesh& mesh)
+{
+    auto [ownerH, neighbourH] = copyToHosts(mesh.faceOwner(), mesh.faceNeighbour());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto maxDelta = detail::maxNeighbourDelta(
+        ownerH.view().subview(0, nInternalFaces), neighbourH.view().subview(0, nInternalFaces)
+    );
+    return maxDelta >= 0 && maxDelta <= std::numeric_limits<std::int32_t>::max();
+}
+
+CompressedConnectivity::CompressedConnectivity(const UnstructuredMesh& mesh)
+    : nInternalFaces_(mesh.nInternalFaces()), width_(DeltaWidth::Bits32),
+      ownerOffsets_(mesh.exec(), 0), deltas_(mesh.exec(), 0)
+{
+    auto [ownerH, neighbourH] = copyToHosts(mesh.faceOwner(), mesh.faceNeighbour());
+    const View<const label> owner = ownerH.view().subview(0, nInternalFaces_);
+    const View<const label> neighbour = neighbourH.view().subview(0, nInternalFaces_);
+    const auto maxDelta = detail::maxNeighbourDelta(owner, neighbour);
+    NF_ASSERT(maxDelta >= 0, "The internal faces are not sorted by owner, see renumberMesh.");
+    NF_ASSERT(
+        maxDelta <= std::numeric_limits<std::int32_t>::max(),
+        "The neighbour to owner offsets exceed 32 bits."
+    );
+
+    // bucket the internal faces by owner, the faces of an owner are contiguous
+    std::vector<localIdx> offsets(static_cast<size_t>(mesh.nCells()) + 1, 0);
+    for (const auto own : owner)
+    {
+        offsets[static_cast<size_t>(own) + 1]++;
+    }
+    for (size_t celli = 0; celli + 1 < offsets.size(); celli++)
+    {
+        offsets[celli + 1] += offsets[celli];
+    }
+    ownerOffsets_ = Vector<localIdx>(mesh.exec(), offsets);
+
+    if (maxDelta <= std::numeric_limits<std::int16_t>::max())
+    {
+        width_ = DeltaWidth::Bits16;
+    }
+    deltas_ = detail::packNeighbourDeltas(mesh.exec(), owner, neighbour, width_);
+}
+
+void CompressedConnectivity::decompress(
+    Vector<localIdx>& owners, Vector<localIdx>& neighbours
+) const
+{
+    owners.resize(nInternalFaces_);
+    neighbours.resize(nInternalFaces_);
+    auto [ownersV, neighboursV] = views(owners, neighbours);
+    compressedParallelFor(
+        ownerOffsets_.exec(),
+        *this,
+        KOKKOS_LAMBDA(const localIdx facei, const localIdx own, const localIdx nei) {
+            ownersV[facei] = own;
+            neighboursV[facei] = nei;
+        },
+        "CompressedConnectivity::decompress"
+    );
+}
+
+const CompressedConnectivity& CompressedConnectivity::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<CompressedConnectivity> key("CompressedConnectivity");
+    return mesh.stencilDB().getOrCreate(key, [&]() { return CompressedConnectivity(mesh); });
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
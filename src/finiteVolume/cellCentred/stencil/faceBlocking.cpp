@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <vector>
+
+#include "NeoN/finiteVolume/cellCentred/stencil/faceBlocking.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief the faces bucketed by block on the host, the last bucket holds the faces between
+ * blocks
+ */
+struct BlockedFaces
+{
+    std::vector<localIdx> faces;
+    std::vector<localIdx> offsets;
+};
+
+BlockedFaces blockFaces(const UnstructuredMesh& mesh, localIdx cellsPerBlock)
+{
+    NF_ASSERT(cellsPerBlock > 0, "A face block needs at least one cell.");
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nFaces = nInternalFaces + mesh.nBoundaryFaces();
+    const auto nBlocks =
+        std::max(localIdx(1), (mesh.nCells() + cellsPerBlock - 1) / cellsPerBlock);
+    auto [ownerH, neighbourH, faceCellsH] =
+        copyToHosts(mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
+    auto [owner, neighbour, faceCells] = views(ownerH, neighbourH, faceCellsH);
+
+    // the block of a face, nBlocks for a face between blocks
+    std::vector<localIdx> faceBlock(static_cast<size_t>(nFaces));
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        const auto ownBlock = static_cast<localIdx>(owner[facei]) / cellsPerBlock;
+        const auto neiBlock = static_cast<localIdx>(neighbour[facei]) / cellsPerBlock;
+        faceBlock[static_cast<size_t>(facei)] = ownBlock == neiBlock ? ownBlock : nBlocks;
+    }
+    for (localIdx facei = nInternalFaces; facei < nFaces; facei++)
+    {
+        faceBlock[static_cast<size_t>(facei)] =
+            static_cast<localIdx>(faceCells[facei - nInternalFaces]) / cellsPerBlock;
+    }
+
+    // bucket the faces by block, keeping the face order within a block
+    std::vector<localIdx> offsets(static_cast<size_t>(nBlocks) + 2, 0);
+    for (auto block : faceBlock)
+    {
+        offsets[static_cast<size_t>(block) + 1]++;
+    }
+    for (size_t block = 0; block < static_cast<size_t>(nBlocks) + 1; block++)
+    {
+        offsets[block + 1] += offsets[block];
+    }
+    std::vector<localIdx> faces(faceBlock.size());
+    std::vector<localIdx> insert(offsets.begin(), offsets.end() - 1);
+    for (localIdx facei = 0; facei < nFaces; facei++)
+    {
+        auto block = static_cast<size_t>(faceBlock[static_cast<size_t>(facei)]);
+        faces[static_cast<size_t>(insert[block]++)] = facei;
+    }
+
+    return {faces, offsets};
+}
+
+}
+
+FaceBlocking::FaceBlocking(const UnstructuredMesh& mesh, localIdx cellsPerBlock)
+    : FaceBlocking(mesh.exec(), detail::blockFaces(mesh, cellsPerBlock))
+{}
+
+FaceBlocking::FaceBlocking(const Executor& exec, detail::BlockedFaces blocked)
+    : faces_(exec, blocked.faces),
+      blockOffsets_(
+          exec, std::vector<localIdx>(blocked.offsets.begin(), blocked.offsets.end() - 1)
+      ),
+      nBlockFaces_(blocked.offsets[blocked.offsets.size() - 2])
+{}
+
+const FaceBlocking& FaceBlocking::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<FaceBlocking> key("FaceBlocking");
+    return mesh.stencilDB().getOrCreate(key, [&]() { return FaceBlocking(mesh); });
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
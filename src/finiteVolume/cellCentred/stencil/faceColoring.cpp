@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#include "NeoN/finiteVolume/cellCentred/stencil/faceColoring.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief greedy coloring, each face gets the lowest color not used by any of its cells
+ *
+ * The colors used by the faces of a cell are stored as a bitmask of nWords words per cell,
+ * the masks are widened by a word whenever a face needs a color beyond them.
+ *
+ * @param faceCells returns the two cells of a face, both entries are identical for a
+ * boundary face
+ */
+template<typename FaceCells>
+ColoredFaces
+colorFaces(const Executor& exec, localIdx nCells, localIdx start, localIdx end, FaceCells faceCells)
+{
+    constexpr localIdx wordBits = 64;
+    const auto cells = static_cast<size_t>(nCells);
+    size_t nWords = 1;
+    std::vector<std::uint64_t> usedColors(cells * nWords, 0);
+    std::vector<localIdx> faceColor(static_cast<size_t>(end - start));
+    localIdx nColors = 0;
+
+    for (localIdx facei = start; facei < end; facei++)
+    {
+        auto [c0, c1] = faceCells(facei);
+        auto word0 = static_cast<size_t>(c0) * nWords;
+        auto word1 = static_cast<size_t>(c1) * nWords;
+        size_t word = 0;
+        constexpr auto full = ~std::uint64_t(0);
+        while (word < nWords && (usedColors[word0 + word] | usedColors[word1 + word]) == full)
+        {
+            word++;
+        }
+        if (word == nWords)
+        {
+            // all colors of the masks are used by the cells, widen the masks by a word
+            std::vector<std::uint64_t> wider(cells * (nWords + 1), 0);
+            for (size_t celli = 0; celli < cells; celli++)
+            {
+                std::copy_n(&usedColors[celli * nWords], nWords, &wider[celli * (nWords + 1)]);
+            }
+            usedColors = std::move(wider);
+            nWords++;
+            word0 = static_cast<size_t>(c0) * nWords;
+            word1 = static_cast<size_t>(c1) * nWords;
+        }
+        auto used = usedColors[word0 + word] | usedColors[word1 + word];
+        auto bitIdx = std::countr_one(used);
+        std::uint64_t bit = std::uint64_t(1) << bitIdx;
+        usedColors[word0 + word] |= bit;
+        usedColors[word1 + word] |= bit;
+        auto color = static_cast<localIdx>(word) * wordBits + static_cast<localIdx>(bitIdx);
+        faceColor[static_cast<size_t>(facei - start)] = color;
+        nColors = std::max(nColors, color + 1);
+    }
+
+    // bucket the faces by color, keeping the face order within a color
+    std::vector<localIdx> offsets(static_cast<size_t>(nColors) + 1, 0);
+    for (auto color : faceColor)
+    {
+        offsets[static_cast<size_t>(color) + 1]++;
+    }
+    for (size_t color = 0; color < static_cast<size_t>(nColors); color++)
+    {
+        offsets[color + 1] += offsets[color];
+    }
+    std::vector<localIdx> faces(faceColor.size());
+    std::vector<localIdx> insert(offsets.begin(), offsets.end() - 1);
+    for (localIdx facei = start; facei < end; facei++)
+    {
+        auto color = static_cast<size_t>(faceColor[static_cast<size_t>(facei - start)]);
+        faces[static_cast<size_t>(insert[color]++)] = facei;
+    }
+
+    return {Vector<localIdx>(exec, faces), offsets};
+}
+
+ColoredFaces colorInternalFaces(const UnstructuredMesh& mesh)
+{
+    const auto [owner, neighbour] = views(mesh.hostFaceOwner(), mesh.hostFaceNeighbour());
+    // the ghost cells are neighbours of internal faces
+    return colorFaces(
+        mesh.exec(),
+        mesh.nCells() + mesh.nGhostCells(),
+        0,
+        mesh.nInternalFaces(),
+        [&](const localIdx facei) { return std::pair {owner[facei], neighbour[facei]}; }
+    );
+}
+
+ColoredFaces colorBoundaryFaces(const UnstructuredMesh& mesh)
+{
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto faceCells = mesh.hostFaceCells().view();
+    return colorFaces(
+        mesh.exec(),
+        mesh.nCells(),
+        nInternalFaces,
+        nInternalFaces + mesh.nBoundaryFaces(),
+        [&](const localIdx facei)
+        {
+            auto celli = faceCells[facei - nInternalFaces];
+            return std::pair {celli, celli};
+        }
+    );
+}
+
+}
+
+FaceColoring::FaceColoring(const UnstructuredMesh& mesh)
+    : internalFaces_(detail::colorInternalFaces(mesh)),
+      boundaryFaces_(detail::colorBoundaryFaces(mesh))
+{}
+
+const FaceColoring& FaceColoring::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<FaceColoring> key("FaceColoring");
+    return mesh.stencilDB().getOrCreate(key, [&]() { return FaceColoring(mesh); });
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
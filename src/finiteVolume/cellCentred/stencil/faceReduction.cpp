@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReduction.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReductionTuner.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+FaceReduction faceReduction(const Executor& exec)
+{
+    if (const auto tuned = FaceReductionTuner::instance().active())
+    {
+        return *tuned;
+    }
+    if (std::holds_alternative<CPUExecutor>(exec))
+    {
+        return FaceReduction::Coloring;
+    }
+    if (std::holds_alternative<GPUExecutor>(exec))
+    {
+        return FaceReduction::Gather;
+    }
+    return FaceReduction::Atomic;
+}
+
+FaceReduction faceReduction(const UnstructuredMesh& mesh)
+{
+    // only the gather writes the local cells alone, the others also scatter into the ghost
+    // cells and into the inactive cells
+    if (mesh.nGhostCells() > 0 || mesh.activeRegion())
+    {
+        return FaceReduction::Gather;
+    }
+    if (const auto tuned = FaceReductionTuner::instance().active())
+    {
+        return *tuned;
+    }
+    const auto strategy = faceReduction(mesh.exec());
+    if (mesh.structured() && strategy != FaceReduction::Atomic)
+    {
+        return FaceReduction::Structured;
+    }
+    if (strategy == FaceReduction::Coloring && !coloredFaceLoops(mesh))
+    {
+        return FaceReduction::Atomic;
+    }
+    return strategy;
+}
+
+bool coloredFaceLoops(const UnstructuredMesh& mesh)
+{
+    return faceReduction(mesh.exec()) == FaceReduction::Coloring
+        && FaceColoring::readOrCreate(mesh).efficient();
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
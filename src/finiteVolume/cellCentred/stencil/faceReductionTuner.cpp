@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "NeoN/finiteVolume/cellCentred/stencil/faceReductionTuner.hpp"
+#include "NeoN/core/demangle.hpp"
+#include "NeoN/core/error.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace
+{
+
+const std::vector<std::pair<FaceReduction, std::string>> faceReductionNames {
+    {FaceReduction::Atomic, "Atomic"},
+    {FaceReduction::Gather, "Gather"},
+    {FaceReduction::Coloring, "Coloring"},
+    {FaceReduction::Structured, "Structured"},
+    {FaceReduction::Blocked, "Blocked"}
+};
+
+std::string toString(FaceReduction strategy)
+{
+    for (const auto& [value, name] : faceReductionNames)
+    {
+        if (value == strategy)
+        {
+            return name;
+        }
+    }
+    return "Unknown"; // not read back from the cache file
+}
+
+std::optional<FaceReduction> fromString(const std::string& strategy)
+{
+    for (const auto& [value, name] : faceReductionNames)
+    {
+        if (name == strategy)
+        {
+            return value;
+        }
+    }
+    return std::nullopt;
+}
+
+}
+
+std::vector<FaceReduction> faceReductionCandidates(const UnstructuredMesh& mesh)
+{
+    std::vector<FaceReduction> candidates {
+        FaceReduction::Atomic, FaceReduction::Gather, FaceReduction::Coloring
+    };
+    if (mesh.structured())
+    {
+        candidates.push_back(FaceReduction::Structured);
+    }
+    // a device has too few blocks to fill its threads
+    if (!std::holds_alternative<GPUExecutor>(mesh.exec()))
+    {
+        candidates.push_back(FaceReduction::Blocked);
+    }
+    return candidates;
+}
+
+FaceReductionTuner& FaceReductionTuner::instance()
+{
+    static FaceReductionTuner tuner;
+    return tuner;
+}
+
+void FaceReductionTuner::enable(int trials, const std::string& cacheFile)
+{
+    NF_ASSERT(trials > 0, "The face reduction tuner needs at least one trial.");
+    trials_ = static_cast<std::size_t>(trials);
+    cacheFile_ = cacheFile;
+    enabled_ = true;
+    read();
+}
+
+void FaceReductionTuner::disable()
+{
+    enabled_ = false;
+    active_.reset();
+}
+
+void FaceReductionTuner::clear()
+{
+    entries_.clear();
+    active_.reset();
+}
+
+std::optional<FaceReduction> FaceReductionTuner::selected(
+    const UnstructuredMesh& mesh, const std::string& kernel, const std::type_info& valueType
+) const
+{
+    const auto entry = entries_.find(key(mesh, kernel, valueType));
+    if (entry == entries_.end())
+    {
+        return std::nullopt;
+    }
+    return entry->second.selected;
+}
+
+std::string FaceReductionTuner::key(
+    const UnstructuredMesh& mesh, const std::string& kernel, const std::type_info& valueType
+)
+{
+    const auto execName = std::visit([](const auto& e) { return e.name(); }, mesh.exec());
+    std::ostringstream key;
+    key << kernel << " " << demangle(valueType.name()) << " " << execName << " " << mesh.nCells()
+        << " " << mesh.nFaces();
+    return key.str();
+}
+
+void FaceReductionTuner::read()
+{
+    if (cacheFile_.empty())
+    {
+        return;
+    }
+    std::ifstream file(cacheFile_);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        // the key contains blanks, the strategy follows the last tab
+        const auto tab = line.rfind('\t');
+        if (tab == std::string::npos)
+        {
+            continue;
+        }
+        const auto strategy = fromString(line.substr(tab + 1));
+        if (strategy)
+        {
+            entries_[line.substr(0, tab)].selected = strategy;
+        }
+    }
+}
+
+void FaceReductionTuner::write() const
+{
+    if (cacheFile_.empty())
+    {
+        return;
+    }
+    std::ofstream file(cacheFile_);
+    for (const auto& [key, entry] : entries_)
+    {
+        if (entry.selected)
+        {
+            file << key << "\t" << toString(*entry.selected) << "\n";
+        }
+    }
+}
+
+FaceReductionTuning::FaceReductionTuning(
+    const UnstructuredMesh& mesh, const char* kernel, const std::type_info& valueType
+)
+    : mesh_(mesh)
+{
+    const auto& tuner = FaceReductionTuner::instance();
+    if (tuner.enabled() && !tuner.active())
+    {
+        start(kernel, valueType, faceReductionCandidates(mesh));
+    }
+}
+
+FaceReductionTuning::FaceReductionTuning(
+    const UnstructuredMesh& mesh,
+    const char* kernel,
+    const std::type_info& valueType,
+    const std::vector<FaceReduction>& candidates
+)
+    : mesh_(mesh)
+{
+    const auto& tuner = FaceReductionTuner::instance();
+    if (tuner.enabled() && !tuner.active())
+    {
+        start(kernel, valueType, candidates);
+    }
+}
+
+void FaceReductionTuning::start(
+    const char* kernel,
+    const std::type_info& valueType,
+    const std::vector<FaceReduction>& candidates
+)
+{
+    NF_ASSERT(!candidates.empty(), "No face reduction strategy to tune.");
+    auto& tuner = FaceReductionTuner::instance();
+    auto& entry = tuner.entries_[FaceReductionTuner::key(mesh_, kernel, valueType)];
+    owner_ = true;
+    if (entry.selected)
+    {
+        tuner.active_ = entry.selected;
+        return;
+    }
+    if (entry.candidates.empty())
+    {
+        entry.candidates = candidates;
+        entry.seconds.assign(candidates.size(), std::numeric_limits<double>::max());
+    }
+    entry_ = &entry;
+    candidate_ = entry.calls / tuner.trials_;
+    tuner.active_ = entry.candidates[candidate_];
+    // the preceding work of an asynchronous executor is not part of the call
+    fence(mesh_.exec());
+    start_ = std::chrono::steady_clock::now();
+}
+
+FaceReductionTuning::~FaceReductionTuning()
+{
+    if (!owner_)
+    {
+        return;
+    }
+    auto& tuner = FaceReductionTuner::instance();
+    tuner.active_.reset();
+    if (entry_ == nullptr)
+    {
+        return;
+    }
+    fence(mesh_.exec());
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    auto& entry = *entry_;
+    entry.seconds[candidate_] = std::min(entry.seconds[candidate_], elapsed.count());
+    entry.calls++;
+    if (entry.calls == tuner.trials_ * entry.candidates.size())
+    {
+        const auto fastest = std::min_element(entry.seconds.begin(), entry.seconds.end());
+        entry.selected = entry.candidates[static_cast<std::size_t>(
+            std::distance(entry.seconds.begin(), fastest)
+        )];
+        tuner.write();
+    }
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -5,6 +5,7 @@
 #include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
 #include "NeoN/finiteVolume/cellCentred/stencil/basicGeometryScheme.hpp"
 #include "NeoN/finiteVolume/cellCentred/boundary.hpp"
+#include "NeoN/core/vector/mixedPrecision.hpp"
 
 #include <memory>
 
@@ -16,12 +17,10 @@ GeometrySchemeFactory::GeometrySchemeFactory([[maybe_unused]] const Unstructured
 
 const std::shared_ptr<GeometryScheme> GeometryScheme::readOrCreate(const UnstructuredMesh& mesh)
 {
-    StencilDataBase& stencilDb = mesh.stencilDB();
-    if (!stencilDb.contains("GeometryScheme"))
-    {
-        stencilDb.insert(std::string("GeometryScheme"), std::make_shared<GeometryScheme>(mesh));
-    }
-    return stencilDb.get<std::shared_ptr<GeometryScheme>>("GeometryScheme");
+    static const StencilKey<std::shared_ptr<GeometryScheme>> key("GeometryScheme");
+    return mesh.stencilDB().getOrCreate(
+        key, [&]() { return std::make_shared<GeometryScheme>(mesh); }
+    );
 }
 
 
@@ -35,7 +34,8 @@ GeometryScheme::GeometryScheme(
 )
     : exec_(exec), mesh_(weights.mesh()), kernel_(std::move(kernel)), weights_(weights),
       deltaCoeffs_(deltaCoeffs), nonOrthDeltaCoeffs_(nonOrthDeltaCoeffs),
-      nonOrthCorrectionVec3s_(nonOrthCorrectionVec3s)
+      nonOrthCorrectionVec3s_(nonOrthCorrectionVec3s), floatWeights_(exec, 0),
+      geometryVersion_(mesh_.geometryVersion())
 {
     if (kernel_ == nullptr)
     {
@@ -64,13 +64,13 @@ GeometryScheme::GeometryScheme(
           "nonOrthCorrectionVec3s",
           mesh,
           createCalculatedBCs<SurfaceBoundary<Vec3>>(mesh)
-      )
+      ),
+      floatWeights_(mesh.exec(), 0), geometryVersion_(notComputed)
 {
     if (kernel_ == nullptr)
     {
         NF_ERROR_EXIT("Kernel is not initialized");
     }
-    update();
 }
 
 GeometryScheme::GeometryScheme(const UnstructuredMesh& mesh)
@@ -91,18 +91,22 @@ GeometryScheme::GeometryScheme(const UnstructuredMesh& mesh)
           "nonOrthCorrectionVec3s",
           mesh,
           createCalculatedBCs<SurfaceBoundary<Vec3>>(mesh)
-      )
+      ),
+      floatWeights_(mesh.exec(), 0), geometryVersion_(notComputed)
 {
     if (kernel_ == nullptr)
     {
         NF_ERROR_EXIT("Kernel is not initialized");
     }
-    update();
 }
 
 std::string GeometryScheme::name() const { return std::string("GeometryScheme"); }
 
-void GeometryScheme::update()
+void GeometryScheme::update() { compute(); }
+
+bool GeometryScheme::upToDate() const { return geometryVersion_ == mesh_.geometryVersion(); }
+
+void GeometryScheme::compute() const
 {
     std::visit(
         [&](const auto& exec)
@@ -110,23 +114,54 @@ void GeometryScheme::update()
             kernel_->updateWeights(exec, weights_);
             kernel_->updateDeltaCoeffs(exec, deltaCoeffs_);
             kernel_->updateNonOrthDeltaCoeffs(exec, nonOrthDeltaCoeffs_);
-            // kernel_->updateNonOrthCorrectionVec3s(exec, nonOrthCorrectionVec3s_);
+            kernel_->updateNonOrthDeltaCoeffs(exec, nonOrthCorrectionVec3s_);
         },
         exec_
     );
+    geometryVersion_ = mesh_.geometryVersion();
 }
 
-const SurfaceField<scalar>& GeometryScheme::weights() const { return weights_; }
+void GeometryScheme::updateIfOutdated() const
+{
+    if (!upToDate())
+    {
+        compute();
+    }
+}
 
-const SurfaceField<scalar>& GeometryScheme::deltaCoeffs() const { return deltaCoeffs_; }
+const SurfaceField<scalar>& GeometryScheme::weights() const
+{
+    updateIfOutdated();
+    return weights_;
+}
+
+const Vector<float>& GeometryScheme::floatWeights() const
+{
+    const auto& weights = this->weights().internalVector();
+    if (floatWeightsVersion_ != geometryVersion_ || floatWeights_.size() != weights.size())
+    {
+        floatWeights_.resize(weights.size());
+        convertPrecision(weights, floatWeights_);
+        floatWeightsVersion_ = geometryVersion_;
+    }
+    return floatWeights_;
+}
+
+const SurfaceField<scalar>& GeometryScheme::deltaCoeffs() const
+{
+    updateIfOutdated();
+    return deltaCoeffs_;
+}
 
 const SurfaceField<scalar>& GeometryScheme::nonOrthDeltaCoeffs() const
 {
+    updateIfOutdated();
     return nonOrthDeltaCoeffs_;
 }
 
 const SurfaceField<Vec3>& GeometryScheme::nonOrthCorrectionVec3s() const
 {
+    updateIfOutdated();
     return nonOrthCorrectionVec3s_;
 }
 
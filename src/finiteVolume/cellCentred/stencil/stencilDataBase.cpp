@@ -2,16 +2,85 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
 #include "NeoN/finiteVolume/cellCentred/stencil/stencilDataBase.hpp"
 
-std::any& NeoN::StencilDataBase::operator[](const std::string& key) { return stencilDB_.at(key); }
+std::any& NeoN::StencilDataBase::operator[](const std::string& key)
+{
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    return stencilDB_.at(key);
+}
 
 const std::any& NeoN::StencilDataBase::operator[](const std::string& key) const
 {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
     return stencilDB_.at(key);
 }
 
 bool NeoN::StencilDataBase::contains(const std::string& key) const
 {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
     return stencilDB_.contains(key);
 }
+
+NeoN::StencilDataBase::StencilDataBase(const StencilDataBase& other)
+{
+    std::lock_guard<std::recursive_mutex> guard(other.mutex_);
+    stencilDB_ = other.stencilDB_;
+    reporters_ = other.reporters_;
+}
+
+NeoN::StencilDataBase::StencilDataBase(StencilDataBase&& other)
+{
+    std::lock_guard<std::recursive_mutex> guard(other.mutex_);
+    stencilDB_ = std::move(other.stencilDB_);
+    slots_ = std::move(other.slots_);
+    reporters_ = std::move(other.reporters_);
+}
+
+NeoN::StencilDataBase& NeoN::StencilDataBase::operator=(const StencilDataBase& other)
+{
+    if (this != &other)
+    {
+        std::scoped_lock guard(mutex_, other.mutex_);
+        stencilDB_ = other.stencilDB_;
+        slots_.clear();
+        reporters_ = other.reporters_;
+    }
+    return *this;
+}
+
+NeoN::StencilDataBase& NeoN::StencilDataBase::operator=(StencilDataBase&& other)
+{
+    if (this != &other)
+    {
+        std::scoped_lock guard(mutex_, other.mutex_);
+        stencilDB_ = std::move(other.stencilDB_);
+        slots_ = std::move(other.slots_);
+        reporters_ = std::move(other.reporters_);
+    }
+    return *this;
+}
+
+void NeoN::StencilDataBase::reportMemory(MemoryReport& report, const std::string& category) const
+{
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::vector<std::string> keys;
+    for (const auto& entry : stencilDB_)
+    {
+        keys.push_back(entry.first);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (const auto& key : keys)
+    {
+        const auto reporter = reporters_.find(key);
+        const auto& value = stencilDB_.at(key);
+        if (reporter == reporters_.end() || !reporter->second(report, category, key, value))
+        {
+            report.add(category, key, 0);
+        }
+    }
+}
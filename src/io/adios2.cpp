@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/io/adios2.hpp"
+#include "NeoN/core/timer.hpp"
+
+namespace NeoN::io
+{
+
+adios2::MemorySpace memorySpace(const Executor& exec)
+{
+    return std::holds_alternative<GPUExecutor>(exec) ? adios2::MemorySpace::GPU
+                                                     : adios2::MemorySpace::Host;
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+Adios2Writer::Adios2Writer(
+    const std::string& fileName, const mpi::MPIEnvironment& mpiEnviron, const Adios2Options& options
+)
+    : adios_(mpiEnviron.comm())
+{
+    configure(fileName, options);
+}
+#else
+Adios2Writer::Adios2Writer(const std::string& fileName, const Adios2Options& options) : adios_()
+{
+    configure(fileName, options);
+}
+#endif
+
+void Adios2Writer::configure(const std::string& fileName, const Adios2Options& options)
+{
+    io_ = adios_.DeclareIO("NeoNWriter");
+    io_.SetEngine(options.engine);
+    if (options.engine == "BP5")
+    {
+        io_.SetParameter("AsyncWrite", options.asyncWrite ? "Guided" : "Off");
+        // aggregate the data of the ranks of a node in shared memory before writing it
+        io_.SetParameter("AggregationType", "TwoLevelShm");
+        if (options.nAggregators > 0)
+        {
+            io_.SetParameter("NumAggregators", std::to_string(options.nAggregators));
+        }
+        if (!options.burstBufferPath.empty())
+        {
+            io_.SetParameter("BurstBufferPath", options.burstBufferPath);
+            io_.SetParameter("BurstBufferDrain", options.burstBufferDrain ? "true" : "false");
+        }
+    }
+    if (!options.compression.empty())
+    {
+        compressor_ = adios_.DefineOperator("compressor", "blosc");
+        compressionParams_ = {
+            {"compressor", options.compression},
+            {"clevel", std::to_string(options.compressionLevel)},
+            // the bytes of equal significance compress far better than the interleaved values
+            {"doshuffle", "BLOSC_SHUFFLE"}
+        };
+    }
+    engine_ = io_.Open(fileName, adios2::Mode::Write);
+}
+
+Adios2Writer::~Adios2Writer() { close(); }
+
+void Adios2Writer::beginStep() { engine_.BeginStep(); }
+
+void Adios2Writer::endStep()
+{
+    ScopedTimer timer("io::Adios2Writer::endStep");
+    engine_.EndStep();
+}
+
+void Adios2Writer::close()
+{
+    if (engine_) engine_.Close();
+}
+
+void Adios2Writer::put(const UnstructuredMesh& mesh)
+{
+    ScopedTimer timer("io::Adios2Writer::putMesh");
+    put("mesh/points", mesh.points());
+    put("mesh/cellVolumes", mesh.cellVolumes());
+    put("mesh/cellCentres", mesh.cellCentres());
+    put("mesh/faceAreas", mesh.faceAreas());
+    put("mesh/faceCentres", mesh.faceCentres());
+    put("mesh/magFaceAreas", mesh.magFaceAreas());
+    put("mesh/faceOwner", mesh.faceOwner());
+    put("mesh/faceNeighbour", mesh.faceNeighbour());
+    put("mesh/sizes",
+        std::vector<std::int64_t> {
+            static_cast<std::int64_t>(mesh.nCells()),
+            static_cast<std::int64_t>(mesh.nInternalFaces()),
+            static_cast<std::int64_t>(mesh.nBoundaryFaces()),
+            static_cast<std::int64_t>(mesh.nBoundaries()),
+            static_cast<std::int64_t>(mesh.nFaces())
+        });
+
+    const auto& bMesh = mesh.boundaryMesh();
+    put("mesh/boundary/faceCells", bMesh.faceCells());
+    put("mesh/boundary/cf", bMesh.cf());
+    put("mesh/boundary/cn", bMesh.cn());
+    put("mesh/boundary/sf", bMesh.sf());
+    put("mesh/boundary/magSf", bMesh.magSf());
+    put("mesh/boundary/nf", bMesh.nf());
+    put("mesh/boundary/delta", bMesh.delta());
+    put("mesh/boundary/weights", bMesh.weights());
+    put("mesh/boundary/deltaCoeffs", bMesh.deltaCoeffs());
+    const auto& offset = bMesh.offset();
+    put("mesh/boundary/offset", std::vector<std::int64_t>(offset.begin(), offset.end()));
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+Adios2Reader::Adios2Reader(
+    const std::string& fileName, const mpi::MPIEnvironment& mpiEnviron, const std::string& engine
+)
+    : adios_(mpiEnviron.comm()), block_(mpiEnviron.rank())
+{
+    io_ = adios_.DeclareIO("NeoNReader");
+    io_.SetEngine(engine);
+    engine_ = io_.Open(fileName, adios2::Mode::Read);
+}
+#else
+Adios2Reader::Adios2Reader(const std::string& fileName, const std::string& engine)
+    : adios_(), block_(0)
+{
+    io_ = adios_.DeclareIO("NeoNReader");
+    io_.SetEngine(engine);
+    engine_ = io_.Open(fileName, adios2::Mode::Read);
+}
+#endif
+
+Adios2Reader::~Adios2Reader() { close(); }
+
+bool Adios2Reader::beginStep() { return engine_.BeginStep() == adios2::StepStatus::OK; }
+
+void Adios2Reader::endStep() { engine_.EndStep(); }
+
+void Adios2Reader::close()
+{
+    if (engine_) engine_.Close();
+}
+
+UnstructuredMesh Adios2Reader::getMesh(const Executor& exec)
+{
+    ScopedTimer timer("io::Adios2Reader::getMesh");
+    const auto sizes = get<std::int64_t>("mesh/sizes");
+    NF_ASSERT_EQUAL(sizes.size(), std::size_t {5});
+    const auto offset64 = get<std::int64_t>("mesh/boundary/offset");
+
+    vectorVector points(exec, 0);
+    scalarVector cellVolumes(exec, 0);
+    vectorVector cellCentres(exec, 0);
+    vectorVector faceAreas(exec, 0);
+    vectorVector faceCentres(exec, 0);
+    scalarVector magFaceAreas(exec, 0);
+    labelVector faceOwner(exec, 0);
+    labelVector faceNeighbour(exec, 0);
+    get("mesh/points", points);
+    get("mesh/cellVolumes", cellVolumes);
+    get("mesh/cellCentres", cellCentres);
+    get("mesh/faceAreas", faceAreas);
+    get("mesh/faceCentres", faceCentres);
+    get("mesh/magFaceAreas", magFaceAreas);
+    get("mesh/faceOwner", faceOwner);
+    get("mesh/faceNeighbour", faceNeighbour);
+
+    labelVector faceCells(exec, 0);
+    vectorVector cf(exec, 0);
+    vectorVector cn(exec, 0);
+    vectorVector sf(exec, 0);
+    scalarVector magSf(exec, 0);
+    vectorVector nf(exec, 0);
+    vectorVector delta(exec, 0);
+    scalarVector weights(exec, 0);
+    scalarVector deltaCoeffs(exec, 0);
+    get("mesh/boundary/faceCells", faceCells);
+    get("mesh/boundary/cf", cf);
+    get("mesh/boundary/cn", cn);
+    get("mesh/boundary/sf", sf);
+    get("mesh/boundary/magSf", magSf);
+    get("mesh/boundary/nf", nf);
+    get("mesh/boundary/delta", delta);
+    get("mesh/boundary/weights", weights);
+    get("mesh/boundary/deltaCoeffs", deltaCoeffs);
+
+    // the mesh copies the vectors, hence the data has to be read before it is constructed
+    engine_.PerformGets();
+
+    BoundaryMesh boundaryMesh(
+        exec,
+        faceCells,
+        cf,
+        cn,
+        sf,
+        magSf,
+        nf,
+        delta,
+        weights,
+        deltaCoeffs,
+        std::vector<localIdx>(offset64.begin(), offset64.end())
+    );
+    return UnstructuredMesh(
+        points,
+        cellVolumes,
+        cellCentres,
+        faceAreas,
+        faceCentres,
+        magFaceAreas,
+        faceOwner,
+        faceNeighbour,
+        static_cast<localIdx>(sizes[0]),
+        static_cast<localIdx>(sizes[1]),
+        static_cast<localIdx>(sizes[2]),
+        static_cast<localIdx>(sizes[3]),
+        static_cast<localIdx>(sizes[4]),
+        boundaryMesh
+    );
+}
+
+}
@@ -0,0 +1,324 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "NeoN/io/binaryMesh.hpp"
+#include "NeoN/core/timer.hpp"
+#include "NeoN/core/vector/hostMirror.hpp"
+
+namespace NeoN::io
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> magic {'N', 'E', 'O', 'N', 'M', 'E', 'S', 'H'};
+
+/* @brief the arrays of a binary mesh file, in the order they are stored */
+enum class MeshArray : std::size_t
+{
+    points,
+    cellVolumes,
+    cellCentres,
+    faceAreas,
+    faceCentres,
+    magFaceAreas,
+    faceOwner,
+    faceNeighbour,
+    faceCells,
+    cf,
+    cn,
+    sf,
+    magSf,
+    nf,
+    delta,
+    weights,
+    deltaCoeffs,
+    boundaryOffset,
+    size
+};
+
+constexpr std::size_t nArrays = static_cast<std::size_t>(MeshArray::size);
+
+struct ArrayEntry
+{
+    std::uint64_t offset;
+    std::uint64_t count;
+    std::uint64_t elementSize;
+};
+
+struct Header
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t labelSize;
+    std::uint32_t scalarSize;
+    std::uint32_t nArrays;
+    std::int64_t nCells;
+    std::int64_t nInternalFaces;
+    std::int64_t nBoundaryFaces;
+    std::int64_t nBoundaries;
+    std::int64_t nFaces;
+    std::array<ArrayEntry, nArrays> arrays;
+};
+
+std::uint64_t align(std::uint64_t offset)
+{
+    return (offset + binaryMeshAlignment - 1) / binaryMeshAlignment * binaryMeshAlignment;
+}
+
+/* @brief a read only view of a whole file, memory mapped where available */
+class MappedFile
+{
+public:
+
+    explicit MappedFile(const std::string& fileName)
+    {
+#ifdef _WIN32
+        std::ifstream file(fileName, std::ios::binary);
+        NF_ASSERT(file, "Cannot open the mesh file " + fileName + ".");
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        fd_ = ::open(fileName.c_str(), O_RDONLY);
+        NF_ASSERT(fd_ >= 0, "Cannot open the mesh file " + fileName + ".");
+        struct stat status;
+        NF_ASSERT(::fstat(fd_, &status) == 0, "Cannot stat the mesh file " + fileName + ".");
+        size_ = static_cast<std::size_t>(status.st_size);
+        void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        NF_ASSERT(ptr != MAP_FAILED, "Cannot map the mesh file " + fileName + ".");
+        // the arrays are copied front to back, allow the kernel to read ahead
+        ::madvise(ptr, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(ptr);
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+
+    std::size_t size() const { return size_; }
+
+private:
+
+    const char* data_ {nullptr};
+    std::size_t size_ {0};
+#ifdef _WIN32
+    std::vector<char> buffer_;
+#else
+    int fd_ {-1};
+#endif
+};
+
+/* @brief copies an array of the mapped file into a vector on the executor */
+template<typename ValueType>
+Vector<ValueType>
+readArray(const Executor& exec, const MappedFile& file, const Header& header, MeshArray array)
+{
+    const auto& entry = header.arrays[static_cast<std::size_t>(array)];
+    NF_ASSERT_EQUAL(entry.elementSize, std::uint64_t {sizeof(ValueType)});
+    NF_ASSERT(
+        entry.offset % alignof(ValueType) == 0
+            && entry.offset + entry.count * entry.elementSize <= file.size(),
+        "The mesh file is truncated or corrupted."
+    );
+    const auto* data = reinterpret_cast<const ValueType*>(file.data() + entry.offset);
+    return Vector<ValueType>(exec, data, static_cast<localIdx>(entry.count));
+}
+
+}
+
+std::string binaryMeshFileName(const std::string& baseName, std::size_t rank)
+{
+    return baseName + "." + std::to_string(rank) + ".nmesh";
+}
+
+void writeBinaryMesh(const std::string& fileName, const UnstructuredMesh& mesh)
+{
+    ScopedTimer timer("io::writeBinaryMesh");
+    const auto& bMesh = mesh.boundaryMesh();
+    std::vector<std::int64_t> offset(bMesh.offset().begin(), bMesh.offset().end());
+
+    Header header {};
+    header.magic = magic;
+    header.version = binaryMeshVersion;
+    header.labelSize = static_cast<std::uint32_t>(sizeof(label));
+    header.scalarSize = static_cast<std::uint32_t>(sizeof(scalar));
+    header.nArrays = static_cast<std::uint32_t>(nArrays);
+    header.nCells = mesh.nCells();
+    header.nInternalFaces = mesh.nInternalFaces();
+    header.nBoundaryFaces = mesh.nBoundaryFaces();
+    header.nBoundaries = mesh.nBoundaries();
+    header.nFaces = mesh.nFaces();
+
+    // the layout only depends on the sizes, hence the header is written first and every array is
+    // copied to the host one at a time
+    std::uint64_t end = sizeof(Header);
+    const auto addEntry = [&](MeshArray array, std::size_t count, std::size_t elementSize)
+    {
+        auto& entry = header.arrays[static_cast<std::size_t>(array)];
+        entry.offset = align(end);
+        entry.count = count;
+        entry.elementSize = elementSize;
+        end = entry.offset + entry.count * entry.elementSize;
+    };
+    const auto addVector = [&](MeshArray array, const auto& vector)
+    {
+        using ValueType = typename std::remove_cvref_t<decltype(vector)>::VectorValueType;
+        addEntry(array, static_cast<std::size_t>(vector.size()), sizeof(ValueType));
+    };
+    addVector(MeshArray::points, mesh.points());
+    addVector(MeshArray::cellVolumes, mesh.cellVolumes());
+    addVector(MeshArray::cellCentres, mesh.cellCentres());
+    addVector(MeshArray::faceAreas, mesh.faceAreas());
+    addVector(MeshArray::faceCentres, mesh.faceCentres());
+    addVector(MeshArray::magFaceAreas, mesh.magFaceAreas());
+    addVector(MeshArray::faceOwner, mesh.faceOwner());
+    addVector(MeshArray::faceNeighbour, mesh.faceNeighbour());
+    addVector(MeshArray::faceCells, bMesh.faceCells());
+    addVector(MeshArray::cf, bMesh.cf());
+    addVector(MeshArray::cn, bMesh.cn());
+    addVector(MeshArray::sf, bMesh.sf());
+    addVector(MeshArray::magSf, bMesh.magSf());
+    addVector(MeshArray::nf, bMesh.nf());
+    addVector(MeshArray::delta, bMesh.delta());
+    addVector(MeshArray::weights, bMesh.weights());
+    addVector(MeshArray::deltaCoeffs, bMesh.deltaCoeffs());
+    addEntry(MeshArray::boundaryOffset, offset.size(), sizeof(std::int64_t));
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    NF_ASSERT(file, "Cannot open the mesh file " + fileName + " for writing.");
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+    std::uint64_t pos = sizeof(Header);
+    const std::array<char, binaryMeshAlignment> padding {};
+    const auto writeArray = [&](MeshArray array, const void* data)
+    {
+        const auto& entry = header.arrays[static_cast<std::size_t>(array)];
+        file.write(padding.data(), static_cast<std::streamsize>(entry.offset - pos));
+        const auto bytes = entry.count * entry.elementSize;
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        pos = entry.offset + bytes;
+    };
+    // the mirrors alias the memory of host executors, hence only device data is copied
+    const auto writeVector = [&](MeshArray array, const auto& vector)
+    {
+        using ValueType = typename std::decay_t<decltype(vector)>::VectorValueType;
+        writeArray(array, HostMirror<ValueType>(vector).data());
+    };
+    writeVector(MeshArray::points, mesh.points());
+    writeVector(MeshArray::cellVolumes, mesh.cellVolumes());
+    writeVector(MeshArray::cellCentres, mesh.cellCentres());
+    writeVector(MeshArray::faceAreas, mesh.faceAreas());
+    writeVector(MeshArray::faceCentres, mesh.faceCentres());
+    writeVector(MeshArray::magFaceAreas, mesh.magFaceAreas());
+    writeVector(MeshArray::faceOwner, mesh.faceOwner());
+    writeVector(MeshArray::faceNeighbour, mesh.faceNeighbour());
+    writeVector(MeshArray::faceCells, bMesh.faceCells());
+    writeVector(MeshArray::cf, bMesh.cf());
+    writeVector(MeshArray::cn, bMesh.cn());
+    writeVector(MeshArray::sf, bMesh.sf());
+    writeVector(MeshArray::magSf, bMesh.magSf());
+    writeVector(MeshArray::nf, bMesh.nf());
+    writeVector(MeshArray::delta, bMesh.delta());
+    writeVector(MeshArray::weights, bMesh.weights());
+    writeVector(MeshArray::deltaCoeffs, bMesh.deltaCoeffs());
+    writeArray(MeshArray::boundaryOffset, offset.data());
+    NF_ASSERT(file, "Failed to write the mesh file " + fileName + ".");
+}
+
+UnstructuredMesh readBinaryMesh(const Executor& exec, const std::string& fileName)
+{
+    ScopedTimer timer("io::readBinaryMesh");
+    MappedFile file(fileName);
+    NF_ASSERT(file.size() >= sizeof(Header), "The file " + fileName + " is not a NeoN mesh.");
+    Header header;
+    std::memcpy(&header, file.data(), sizeof(Header));
+    NF_ASSERT(header.magic == magic, "The file " + fileName + " is not a NeoN mesh.");
+    NF_ASSERT(
+        header.version == binaryMeshVersion,
+        "The mesh file " + fileName + " has version " + std::to_string(header.version)
+            + ", expected " + std::to_string(binaryMeshVersion) + "."
+    );
+    NF_ASSERT(
+        header.labelSize == sizeof(label) && header.scalarSize == sizeof(scalar),
+        "The mesh file " + fileName + " was written with different label or scalar types."
+    );
+    NF_ASSERT_EQUAL(header.nArrays, std::uint32_t {nArrays});
+
+    const auto& offsetEntry = header.arrays[static_cast<std::size_t>(MeshArray::boundaryOffset)];
+    NF_ASSERT(
+        offsetEntry.offset + offsetEntry.count * sizeof(std::int64_t) <= file.size(),
+        "The mesh file " + fileName + " is truncated."
+    );
+    std::vector<localIdx> offset(offsetEntry.count);
+    for (std::size_t i = 0; i < offset.size(); i++)
+    {
+        std::int64_t value;
+        std::memcpy(
+            &value,
+            file.data() + offsetEntry.offset + i * sizeof(std::int64_t),
+            sizeof(std::int64_t)
+        );
+        offset[i] = static_cast<localIdx>(value);
+    }
+
+    BoundaryMesh boundaryMesh(
+        exec,
+        readArray<label>(exec, file, header, MeshArray::faceCells),
+        readArray<Vec3>(exec, file, header, MeshArray::cf),
+        readArray<Vec3>(exec, file, header, MeshArray::cn),
+        readArray<Vec3>(exec, file, header, MeshArray::sf),
+        readArray<scalar>(exec, file, header, MeshArray::magSf),
+        readArray<Vec3>(exec, file, header, MeshArray::nf),
+        readArray<Vec3>(exec, file, header, MeshArray::delta),
+        readArray<scalar>(exec, file, header, MeshArray::weights),
+        readArray<scalar>(exec, file, header, MeshArray::deltaCoeffs),
+        std::move(offset)
+    );
+    return UnstructuredMesh(
+        readArray<Vec3>(exec, file, header, MeshArray::points),
+        readArray<scalar>(exec, file, header, MeshArray::cellVolumes),
+        readArray<Vec3>(exec, file, header, MeshArray::cellCentres),
+        readArray<Vec3>(exec, file, header, MeshArray::faceAreas),
+        readArray<Vec3>(exec, file, header, MeshArray::faceCentres),
+        readArray<scalar>(exec, file, header, MeshArray::magFaceAreas),
+        readArray<label>(exec, file, header, MeshArray::faceOwner),
+        readArray<label>(exec, file, header, MeshArray::faceNeighbour),
+        static_cast<localIdx>(header.nCells),
+        static_cast<localIdx>(header.nInternalFaces),
+        static_cast<localIdx>(header.nBoundaryFaces),
+        static_cast<localIdx>(header.nBoundaries),
+        static_cast<localIdx>(header.nFaces),
+        std::move(boundaryMesh)
+    );
+}
+
+}
@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <exception>
+#include <filesystem>
+#include <typeinfo>
+
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/timer.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/io/checkpoint.hpp"
+
+namespace NeoN::io
+{
+
+namespace fvcc = finiteVolume::cellCentred;
+
+namespace
+{
+
+/* @brief the old time level of a field, zero for a current field */
+std::int32_t oldTimeLevel(const fvcc::VectorCollection& collection, const std::string& key)
+{
+    if (!collection.db().contains(collection.name() + "_oldTime"))
+    {
+        return 0;
+    }
+    const auto& oldTimes = fvcc::OldTimeCollection::instance(collection);
+    const auto id = oldTimes.findPreviousTime(key);
+    return id == "" ? 0 : oldTimes.oldTimeDoc(id).level();
+}
+
+template<typename ValueType>
+void putFields(Adios2Writer& writer, const fvcc::VectorCollection& collection, int nOldTimeLevels)
+{
+    using FieldType = fvcc::VolumeField<ValueType>;
+    for (const auto& id : collection.find(
+             [](const Document& doc) { return doc["field"].type() == typeid(FieldType); }
+         ))
+    {
+        const auto& fieldDoc = collection.fieldDoc(id);
+        const auto& field = fieldDoc.field<FieldType>();
+        const auto level = oldTimeLevel(collection, field.key);
+        if (nOldTimeLevels >= 0 && level > nOldTimeLevels)
+        {
+            continue;
+        }
+        const auto& name = field.name;
+        writer.put(name + "/internal", field.internalVector());
+        writer.put(name + "/boundary", field.boundaryData().value());
+        writer.put(
+            name + "/indices",
+            std::vector<std::int64_t> {fieldDoc.timeIndex(), fieldDoc.iterationIndex(), level}
+        );
+    }
+}
+
+template<typename ValueType>
+localIdx getFields(Adios2Reader& reader, fvcc::VectorCollection& collection)
+{
+    using FieldType = fvcc::VolumeField<ValueType>;
+    localIdx nRestored = 0;
+    for (const auto& id : collection.find(
+             [](const Document& doc) { return doc["field"].type() == typeid(FieldType); }
+         ))
+    {
+        auto& fieldDoc = collection.fieldDoc(id);
+        auto& field = fieldDoc.field<FieldType>();
+        if (!reader.contains(field.name + "/internal"))
+        {
+            continue;
+        }
+        reader.get(field.name + "/internal", field.internalVector());
+        reader.get(field.name + "/boundary", field.boundaryData().value());
+        const auto indices = reader.get<std::int64_t>(field.name + "/indices");
+        NF_ASSERT_EQUAL(indices.size(), std::size_t {3});
+        fieldDoc.timeIndex() = indices[0];
+        fieldDoc.iterationIndex() = indices[1];
+        collection.reindex(id);
+        nRestored++;
+    }
+    return nRestored;
+}
+
+}
+
+std::string checkpointMeshFile(const std::string& prefix) { return prefix + "_mesh.bp"; }
+
+std::string checkpointFile(const std::string& prefix, int slot)
+{
+    return prefix + "_" + std::to_string(slot) + ".bp";
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+CheckpointWriter::CheckpointWriter(
+    const std::string& prefix,
+    const UnstructuredMesh& mesh,
+    const mpi::MPIEnvironment& mpiEnviron,
+    const CheckpointOptions& options
+)
+    : prefix_(prefix), options_(options), mpiEnviron_(mpiEnviron)
+#else
+CheckpointWriter::CheckpointWriter(
+    const std::string& prefix, const UnstructuredMesh& mesh, const CheckpointOptions& options
+)
+    : prefix_(prefix), options_(options)
+#endif
+{
+    ScopedTimer timer("io::CheckpointWriter::writeMesh");
+    open(checkpointMeshFile(prefix_), options_.io);
+    writer_->beginStep();
+    writer_->put(mesh);
+    writer_->endStep();
+}
+
+void CheckpointWriter::open(const std::string& fileName, const Adios2Options& options)
+{
+    // the previous file is completed before the next is opened
+    writer_.reset();
+#ifdef NF_WITH_MPI_SUPPORT
+    writer_.emplace(fileName, mpiEnviron_, options);
+#else
+    writer_.emplace(fileName, options);
+#endif
+}
+
+void CheckpointWriter::write(const fvcc::VectorCollection& collection, scalar time)
+{
+    ScopedTimer timer("io::CheckpointWriter::write");
+    open(checkpointFile(prefix_, static_cast<int>(nCheckpoints_ % 2)), options_.io);
+    writer_->beginStep();
+    writer_->put("checkpoint/time", std::vector<scalar> {time});
+    writer_->put("checkpoint/index", std::vector<std::int64_t> {nCheckpoints_});
+    putFields<scalar>(*writer_, collection, options_.nOldTimeLevels);
+    putFields<Vec3>(*writer_, collection, options_.nOldTimeLevels);
+    writer_->endStep();
+    nCheckpoints_++;
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+CheckpointReader::CheckpointReader(const std::string& prefix, const mpi::MPIEnvironment& mpiEnviron)
+    : prefix_(prefix), mpiEnviron_(mpiEnviron)
+#else
+CheckpointReader::CheckpointReader(const std::string& prefix) : prefix_(prefix)
+#endif
+{
+    // the index of the checkpoint in every slot, a slot may be missing or incomplete
+    std::int64_t latestIndex = -1;
+    int latestSlot = 0;
+    for (int slot = 0; slot < 2; slot++)
+    {
+        const auto fileName = checkpointFile(prefix_, slot);
+        if (!std::filesystem::exists(fileName))
+        {
+            continue;
+        }
+        try
+        {
+#ifdef NF_WITH_MPI_SUPPORT
+            Adios2Reader reader(fileName, mpiEnviron_);
+#else
+            Adios2Reader reader(fileName);
+#endif
+            if (reader.beginStep() && reader.contains("checkpoint/index"))
+            {
+                const auto index = reader.get<std::int64_t>("checkpoint/index")[0];
+                if (index > latestIndex)
+                {
+                    latestIndex = index;
+                    latestSlot = slot;
+                }
+                reader.endStep();
+            }
+        }
+        catch (const std::exception&)
+        {
+            // a checkpoint interrupted while writing is skipped
+        }
+    }
+    NF_ASSERT(latestIndex >= 0, "No complete checkpoint found for " + prefix_);
+#ifdef NF_WITH_MPI_SUPPORT
+    reader_.emplace(checkpointFile(prefix_, latestSlot), mpiEnviron_);
+#else
+    reader_.emplace(checkpointFile(prefix_, latestSlot));
+#endif
+    reader_->beginStep();
+    time_ = reader_->get<scalar>("checkpoint/time")[0];
+}
+
+UnstructuredMesh CheckpointReader::readMesh(const Executor& exec) const
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    Adios2Reader reader(checkpointMeshFile(prefix_), mpiEnviron_);
+#else
+    Adios2Reader reader(checkpointMeshFile(prefix_));
+#endif
+    NF_ASSERT(reader.beginStep(), "No mesh found in " + checkpointMeshFile(prefix_));
+    auto mesh = reader.getMesh(exec);
+    reader.endStep();
+    return mesh;
+}
+
+localIdx CheckpointReader::restore(fvcc::VectorCollection& collection)
+{
+    ScopedTimer timer("io::CheckpointReader::restore");
+    NF_ASSERT(reader_, "The checkpoint " + prefix_ + " has already been restored.");
+    localIdx nRestored = getFields<scalar>(*reader_, collection);
+    nRestored += getFields<Vec3>(*reader_, collection);
+    // performs the deferred reads into the fields
+    reader_->endStep();
+    reader_.reset();
+    return nRestored;
+}
+
+}
@@ -0,0 +1,499 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include "NeoN/io/foamMesh.hpp"
+#include "NeoN/core/timer.hpp"
+#include "NeoN/mesh/unstructured/meshGeometry.hpp"
+
+namespace NeoN::io
+{
+
+namespace
+{
+
+/* @brief a parser for the files of an OpenFOAM polyMesh directory
+ *
+ * The FoamFile header is parsed on construction and determines whether the lists are stored as
+ * text or as raw binary data, as well as the width of the binary labels and scalars.
+ */
+class FoamFile
+{
+public:
+
+    explicit FoamFile(const std::filesystem::path& path) : path_(path.string())
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file && std::filesystem::exists(path_ + ".gz"))
+        {
+            NF_ERROR_EXIT("The compressed file " + path_ + ".gz is not supported.");
+        }
+        NF_ASSERT(file, "Cannot open the file " + path_ + ".");
+        content_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        parseHeader();
+    }
+
+    const std::string& className() const { return header_.at("class"); }
+
+    /* @brief reads a list of labels of the given size, converting them to label */
+    std::vector<label> readLabelList()
+    {
+        const auto size = readListStart();
+        std::vector<label> values(size);
+        if (uniform_)
+        {
+            std::fill(values.begin(), values.end(), static_cast<label>(readInteger()));
+            expect('}');
+            return values;
+        }
+        if (binary_)
+        {
+            readBinaryLabels(values);
+        }
+        else
+        {
+            for (auto& value : values)
+            {
+                value = static_cast<label>(readInteger());
+            }
+        }
+        expect(')');
+        return values;
+    }
+
+    std::vector<Vec3> readVectorList()
+    {
+        const auto size = readListStart();
+        std::vector<Vec3> values(size);
+        if (uniform_)
+        {
+            std::fill(values.begin(), values.end(), readVector());
+            expect('}');
+            return values;
+        }
+        if (binary_ && vec3Lanes == 3)
+        {
+            readBinaryScalars(reinterpret_cast<scalar*>(values.data()), 3 * size);
+        }
+        else if (binary_)
+        {
+            // a padded Vec3 does not match the compact layout of the file
+            std::vector<scalar> cmpts(3 * size);
+            readBinaryScalars(cmpts.data(), cmpts.size());
+            for (std::size_t i = 0; i < size; i++)
+            {
+                values[i] = Vec3(cmpts[3 * i], cmpts[3 * i + 1], cmpts[3 * i + 2]);
+            }
+        }
+        else
+        {
+            for (auto& value : values)
+            {
+                value = readVector();
+            }
+        }
+        expect(')');
+        return values;
+    }
+
+    /* @brief reads a faceList or faceCompactList into offsets and points */
+    void readFaces(std::vector<localIdx>& offsets, std::vector<label>& points)
+    {
+        if (className() == "faceCompactList")
+        {
+            const auto compactOffsets = readLabelList();
+            points = readLabelList();
+            offsets.assign(compactOffsets.begin(), compactOffsets.end());
+            NF_ASSERT(
+                !offsets.empty()
+                    && offsets.back() == static_cast<localIdx>(points.size()),
+                "The faces in " + path_ + " are inconsistent."
+            );
+            return;
+        }
+        NF_ASSERT(
+            className() == "faceList", "The faces in " + path_ + " have the class " + className()
+        );
+        // the binary faceList stores every face as a list, hence it is parsed like the text form
+        const auto size = readListStart();
+        NF_ASSERT(!uniform_, "A uniform face list is not supported.");
+        offsets.assign(1, 0);
+        offsets.reserve(size + 1);
+        for (std::size_t facei = 0; facei < size; facei++)
+        {
+            const auto facePoints = readLabelList();
+            points.insert(points.end(), facePoints.begin(), facePoints.end());
+            offsets.push_back(static_cast<localIdx>(points.size()));
+        }
+        expect(')');
+    }
+
+    std::vector<FoamPatch> readPatches()
+    {
+        const auto size = readListStart();
+        NF_ASSERT(!uniform_, "A uniform patch list is not supported.");
+        std::vector<FoamPatch> patches;
+        for (std::size_t patchi = 0; patchi < size; patchi++)
+        {
+            FoamPatch patch {readWord(), "", 0, 0, -1};
+            const auto entries = readDict();
+            NF_ASSERT(
+                entries.contains("nFaces") && entries.contains("startFace"),
+                "The patch " + patch.name + " in " + path_ + " has no nFaces or startFace."
+            );
+            patch.type = entries.contains("type") ? entries.at("type") : "patch";
+            patch.nFaces = static_cast<localIdx>(std::stoll(entries.at("nFaces")));
+            patch.startFace = static_cast<localIdx>(std::stoll(entries.at("startFace")));
+            if (entries.contains("neighbProcNo"))
+            {
+                patch.neighbProcNo = std::stoi(entries.at("neighbProcNo"));
+            }
+            patches.push_back(std::move(patch));
+        }
+        expect(')');
+        return patches;
+    }
+
+private:
+
+    std::string path_;
+    std::string content_;
+    std::size_t pos_ {0};
+    std::map<std::string, std::string> header_;
+    bool binary_ {false};
+    bool uniform_ {false};
+    std::size_t labelBytes_ {4};
+    std::size_t scalarBytes_ {8};
+
+    void parseHeader()
+    {
+        NF_ASSERT(readWord() == "FoamFile", "The file " + path_ + " has no FoamFile header.");
+        header_ = readDict();
+        binary_ = header_.contains("format") && header_.at("format") == "binary";
+        const auto arch = header_.contains("arch") ? header_.at("arch") : std::string();
+        const auto bits = [&arch](const std::string& key, std::size_t fallback)
+        {
+            const auto pos = arch.find(key + "=");
+            return pos == std::string::npos
+                     ? fallback
+                     : static_cast<std::size_t>(std::stoul(arch.substr(pos + key.size() + 1)));
+        };
+        labelBytes_ = bits("label", 32) / 8;
+        scalarBytes_ = bits("scalar", 64) / 8;
+        NF_ASSERT(
+            labelBytes_ == 4 || labelBytes_ == 8, "Unsupported label width in " + path_ + "."
+        );
+        NF_ASSERT(
+            scalarBytes_ == 4 || scalarBytes_ == 8, "Unsupported scalar width in " + path_ + "."
+        );
+    }
+
+    /* @brief skips white space and C and C++ style comments */
+    void skipSpace()
+    {
+        while (pos_ < content_.size())
+        {
+            if (std::isspace(static_cast<unsigned char>(content_[pos_])))
+            {
+                pos_++;
+            }
+            else if (content_.compare(pos_, 2, "//") == 0)
+            {
+                pos_ = content_.find('\n', pos_);
+            }
+            else if (content_.compare(pos_, 2, "/*") == 0)
+            {
+                pos_ = content_.find("*/", pos_);
+                pos_ = pos_ == std::string::npos ? pos_ : pos_ + 2;
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+
+    void expect(char c)
+    {
+        skipSpace();
+        NF_ASSERT(
+            pos_ < content_.size() && content_[pos_] == c,
+            "Expected '" << c << "' at position " << pos_ << " in " << path_ << "."
+        );
+        pos_++;
+    }
+
+    std::string readWord()
+    {
+        skipSpace();
+        const auto start = pos_;
+        while (pos_ < content_.size()
+               && !std::isspace(static_cast<unsigned char>(content_[pos_]))
+               && std::strchr(";{}()", content_[pos_]) == nullptr)
+        {
+            pos_++;
+        }
+        NF_ASSERT(pos_ > start, "Expected a word at position " << start << " in " << path_ << ".");
+        return content_.substr(start, pos_ - start);
+    }
+
+    /* @brief reads the entries of a dictionary, every value is the text up to the semicolon */
+    std::map<std::string, std::string> readDict()
+    {
+        std::map<std::string, std::string> entries;
+        expect('{');
+        skipSpace();
+        while (pos_ < content_.size() && content_[pos_] != '}')
+        {
+            const auto key = readWord();
+            skipSpace();
+            const auto start = pos_;
+            bool quoted = false;
+            while (pos_ < content_.size() && (quoted || content_[pos_] != ';'))
+            {
+                quoted = content_[pos_] == '"' ? !quoted : quoted;
+                pos_++;
+            }
+            auto value = content_.substr(start, pos_ - start);
+            value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
+            entries[key] = value.substr(0, value.find_last_not_of(" \t\r\n") + 1);
+            expect(';');
+            skipSpace();
+        }
+        expect('}');
+        return entries;
+    }
+
+    long long readInteger()
+    {
+        skipSpace();
+        char* end = nullptr;
+        const auto value = std::strtoll(content_.c_str() + pos_, &end, 10);
+        NF_ASSERT(
+            end != content_.c_str() + pos_,
+            "Expected an integer at position " << pos_ << " in " << path_ << "."
+        );
+        pos_ = static_cast<std::size_t>(end - content_.c_str());
+        return value;
+    }
+
+    scalar readScalar()
+    {
+        skipSpace();
+        char* end = nullptr;
+        const auto value = std::strtod(content_.c_str() + pos_, &end);
+        NF_ASSERT(
+            end != content_.c_str() + pos_,
+            "Expected a scalar at position " << pos_ << " in " << path_ << "."
+        );
+        pos_ = static_cast<std::size_t>(end - content_.c_str());
+        return static_cast<scalar>(value);
+    }
+
+    Vec3 readVector()
+    {
+        expect('(');
+        const auto x = readScalar();
+        const auto y = readScalar();
+        const auto z = readScalar();
+        expect(')');
+        return Vec3(x, y, z);
+    }
+
+    /* @brief reads the size of a list and its opening bracket, ie. '(' or '{' for uniform lists */
+    std::size_t readListStart()
+    {
+        const auto size = readInteger();
+        NF_ASSERT(size >= 0, "Negative list size in " + path_ + ".");
+        skipSpace();
+        NF_ASSERT(pos_ < content_.size(), "Unexpected end of " + path_ + ".");
+        uniform_ = content_[pos_] == '{';
+        expect(uniform_ ? '{' : '(');
+        return static_cast<std::size_t>(size);
+    }
+
+    const char* readBytes(std::size_t bytes)
+    {
+        NF_ASSERT(pos_ + bytes <= content_.size(), "Unexpected end of " + path_ + ".");
+        const auto* data = content_.data() + pos_;
+        pos_ += bytes;
+        return data;
+    }
+
+    void readBinaryLabels(std::vector<label>& values)
+    {
+        const auto* data = readBytes(values.size() * labelBytes_);
+        if (labelBytes_ == sizeof(label))
+        {
+            std::memcpy(values.data(), data, values.size() * sizeof(label));
+            return;
+        }
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            if (labelBytes_ == 4)
+            {
+                std::int32_t value;
+                std::memcpy(&value, data + 4 * i, 4);
+                values[i] = static_cast<label>(value);
+            }
+            else
+            {
+                std::int64_t value;
+                std::memcpy(&value, data + 8 * i, 8);
+                values[i] = static_cast<label>(value);
+            }
+        }
+    }
+
+    void readBinaryScalars(scalar* values, std::size_t size)
+    {
+        const auto* data = readBytes(size * scalarBytes_);
+        if (scalarBytes_ == sizeof(scalar))
+        {
+            std::memcpy(values, data, size * sizeof(scalar));
+            return;
+        }
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (scalarBytes_ == 4)
+            {
+                float value;
+                std::memcpy(&value, data + 4 * i, 4);
+                values[i] = static_cast<scalar>(value);
+            }
+            else
+            {
+                double value;
+                std::memcpy(&value, data + 8 * i, 8);
+                values[i] = static_cast<scalar>(value);
+            }
+        }
+    }
+};
+
+}
+
+UnstructuredMesh createMeshFromFaces(
+    vectorVector points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    labelVector faceOwner,
+    labelVector faceNeighbour,
+    localIdx nCells,
+    std::vector<localIdx> boundaryOffsets
+)
+{
+    const auto nFaces = faceOwner.size();
+    const auto nInternalFaces = faceNeighbour.size();
+    const auto nBoundaryFaces = nFaces - nInternalFaces;
+
+    auto geometry =
+        computeMeshGeometry(points, faceOffsets, facePoints, faceOwner, faceNeighbour, nCells);
+    const auto nBoundaries = static_cast<localIdx>(boundaryOffsets.size()) - 1;
+    auto boundaryMesh =
+        computeBoundaryMesh(geometry, faceOwner, nInternalFaces, std::move(boundaryOffsets));
+    return UnstructuredMesh(
+        std::move(points),
+        std::move(geometry.cellVolumes),
+        std::move(geometry.cellCentres),
+        std::move(geometry.faceAreas),
+        std::move(geometry.faceCentres),
+        std::move(geometry.magFaceAreas),
+        std::move(faceOwner),
+        std::move(faceNeighbour),
+        nCells,
+        nInternalFaces,
+        nBoundaryFaces,
+        nBoundaries,
+        nFaces,
+        std::move(boundaryMesh)
+    );
+}
+
+FoamMesh readFoamMesh(const Executor& exec, const std::string& polyMeshDir)
+{
+    ScopedTimer timer("io::readFoamMesh");
+    const std::filesystem::path dir(polyMeshDir);
+    auto points = FoamFile(dir / "points").readVectorList();
+    std::vector<localIdx> faceOffsets;
+    std::vector<label> facePoints;
+    FoamFile(dir / "faces").readFaces(faceOffsets, facePoints);
+    auto owner = FoamFile(dir / "owner").readLabelList();
+    auto neighbour = FoamFile(dir / "neighbour").readLabelList();
+    auto patches = FoamFile(dir / "boundary").readPatches();
+
+    // old meshes store a neighbour of -1 for every boundary face
+    while (!neighbour.empty() && neighbour.back() < 0)
+    {
+        neighbour.pop_back();
+    }
+    const auto nFaces = static_cast<localIdx>(owner.size());
+    const auto nInternalFaces = static_cast<localIdx>(neighbour.size());
+    NF_ASSERT_EQUAL(static_cast<localIdx>(faceOffsets.size()), nFaces + 1);
+    label maxCell = -1;
+    for (const auto celli : owner)
+    {
+        maxCell = std::max(maxCell, celli);
+    }
+    for (const auto celli : neighbour)
+    {
+        maxCell = std::max(maxCell, celli);
+    }
+    const auto nCells = static_cast<localIdx>(maxCell) + 1;
+
+    std::vector<localIdx> boundaryOffsets {0};
+    for (const auto& patch : patches)
+    {
+        NF_ASSERT(
+            patch.startFace == nInternalFaces + boundaryOffsets.back(),
+            "The faces of patch " + patch.name + " do not follow the previous patch."
+        );
+        boundaryOffsets.push_back(boundaryOffsets.back() + patch.nFaces);
+    }
+
+    return FoamMesh {
+        createMeshFromFaces(
+            vectorVector(exec, std::move(points)),
+            Vector<localIdx>(exec, std::move(faceOffsets)),
+            labelVector(exec, std::move(facePoints)),
+            labelVector(exec, std::move(owner)),
+            labelVector(exec, std::move(neighbour)),
+            nCells,
+            std::move(boundaryOffsets)
+        ),
+        std::move(patches)
+    };
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+FoamMesh readFoamCase(
+    const Executor& exec, const std::string& caseDir, const mpi::MPIEnvironment& mpiEnviron
+)
+{
+    const std::filesystem::path dir(caseDir);
+    if (mpiEnviron.sizeRank() == 1)
+    {
+        return readFoamMesh(exec, (dir / "constant" / "polyMesh").string());
+    }
+    const auto processorDir = dir / ("processor" + std::to_string(mpiEnviron.rank()));
+    return readFoamMesh(exec, (processorDir / "constant" / "polyMesh").string());
+}
+#else
+FoamMesh readFoamCase(const Executor& exec, const std::string& caseDir)
+{
+    return readFoamMesh(exec, (std::filesystem::path(caseDir) / "constant" / "polyMesh").string());
+}
+#endif
+
+}
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#include "NeoN/linearAlgebra/agglomeration.hpp"
+
+namespace NeoN::la
+{
+
+std::vector<localIdx> pairwiseAggregation(
+    const std::vector<localIdx>& rowOffs,
+    const std::vector<localIdx>& colIdxs,
+    const std::vector<scalar>& weights
+)
+{
+    constexpr auto unassigned = std::numeric_limits<localIdx>::max();
+    const auto nRows = rowOffs.size() - 1;
+    std::vector<localIdx> aggregates(nRows, unassigned);
+    localIdx nAggregates = 0;
+    for (std::size_t rowi = 0; rowi < nRows; rowi++)
+    {
+        if (aggregates[rowi] != unassigned)
+        {
+            continue;
+        }
+        auto unpaired = unassigned;
+        auto paired = unassigned;
+        scalar unpairedWeight = -1.0;
+        scalar pairedWeight = -1.0;
+        for (auto k = static_cast<std::size_t>(rowOffs[rowi]); k < rowOffs[rowi + 1]; k++)
+        {
+            const auto coli = colIdxs[k];
+            if (static_cast<std::size_t>(coli) == rowi)
+            {
+                continue;
+            }
+            if (aggregates[static_cast<std::size_t>(coli)] == unassigned)
+            {
+                if (weights[k] > unpairedWeight)
+                {
+                    unpairedWeight = weights[k];
+                    unpaired = coli;
+                }
+            }
+            else if (weights[k] > pairedWeight)
+            {
+                pairedWeight = weights[k];
+                paired = coli;
+            }
+        }
+        if (unpaired != unassigned)
+        {
+            aggregates[static_cast<std::size_t>(unpaired)] = nAggregates;
+            aggregates[rowi] = nAggregates++;
+        }
+        else if (paired != unassigned)
+        {
+            aggregates[rowi] = aggregates[static_cast<std::size_t>(paired)];
+        }
+        else
+        {
+            aggregates[rowi] = nAggregates++;
+        }
+    }
+    return aggregates;
+}
+
+/* @brief the weighted graph of the face connectivity of the cells or aggregates of a level */
+struct FaceGraph
+{
+    std::vector<localIdx> rowOffs;
+    std::vector<localIdx> colIdxs;
+    std::vector<scalar> weights;
+};
+
+/* @brief builds the symmetric graph of the given edges, the weights of duplicate edges are
+ * summed
+ *
+ * @param edges, the two vertices and the weight of every edge, each edge is given once
+ */
+static FaceGraph
+createFaceGraph(std::size_t nRows, std::vector<std::tuple<localIdx, localIdx, scalar>> edges)
+{
+    const auto nEdges = edges.size();
+    for (std::size_t edgei = 0; edgei < nEdges; edgei++)
+    {
+        const auto [rowi, coli, weight] = edges[edgei];
+        edges.emplace_back(coli, rowi, weight);
+    }
+    std::sort(edges.begin(), edges.end());
+
+    FaceGraph graph {std::vector<localIdx>(nRows + 1, 0), {}, {}};
+    for (std::size_t edgei = 0; edgei < edges.size(); edgei++)
+    {
+        const auto [rowi, coli, weight] = edges[edgei];
+        const bool duplicate = edgei > 0 && std::get<0>(edges[edgei - 1]) == rowi
+                            && std::get<1>(edges[edgei - 1]) == coli;
+        if (duplicate)
+        {
+            graph.weights.back() += weight;
+            continue;
+        }
+        graph.colIdxs.push_back(coli);
+        graph.weights.push_back(weight);
+        graph.rowOffs[static_cast<std::size_t>(rowi) + 1]++;
+    }
+    for (std::size_t rowi = 0; rowi < nRows; rowi++)
+    {
+        graph.rowOffs[rowi + 1] += graph.rowOffs[rowi];
+    }
+    return graph;
+}
+
+FaceAgglomeration::FaceAgglomeration(const UnstructuredMesh& mesh) : aggregates_()
+{
+    const auto [ownerV, neighbourV, magSf] =
+        views(mesh.hostFaceOwner(), mesh.hostFaceNeighbour(), mesh.hostMagFaceAreas());
+
+    std::vector<std::tuple<localIdx, localIdx, scalar>> edges;
+    edges.reserve(static_cast<std::size_t>(mesh.nInternalFaces()));
+    for (localIdx facei = 0; facei < mesh.nInternalFaces(); facei++)
+    {
+        edges.emplace_back(
+            static_cast<localIdx>(ownerV[facei]),
+            static_cast<localIdx>(neighbourV[facei]),
+            magSf[facei]
+        );
+    }
+    auto graph = createFaceGraph(static_cast<std::size_t>(mesh.nCells()), edges);
+
+    auto nRows = static_cast<std::size_t>(mesh.nCells());
+    while (nRows > 1)
+    {
+        auto aggregates = pairwiseAggregation(graph.rowOffs, graph.colIdxs, graph.weights);
+        const auto nCoarse =
+            static_cast<std::size_t>(*std::max_element(aggregates.begin(), aggregates.end())) + 1;
+        if (nCoarse == nRows)
+        {
+            // no faces are left between the aggregates
+            break;
+        }
+
+        // the faces between two aggregates are merged into a single weighted edge
+        edges.clear();
+        for (std::size_t rowi = 0; rowi < nRows; rowi++)
+        {
+            for (auto k = graph.rowOffs[rowi]; k < graph.rowOffs[rowi + 1]; k++)
+            {
+                const auto coarsei = aggregates[rowi];
+                const auto coarsej = aggregates[static_cast<std::size_t>(graph.colIdxs[k])];
+                if (coarsei < coarsej)
+                {
+                    edges.emplace_back(coarsei, coarsej, graph.weights[k]);
+                }
+            }
+        }
+        graph = createFaceGraph(nCoarse, edges);
+        aggregates_.push_back(std::move(aggregates));
+        nRows = nCoarse;
+    }
+}
+
+const FaceAgglomeration& FaceAgglomeration::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<FaceAgglomeration> key("FaceAgglomeration");
+    return mesh.stencilDB().getOrCreate(key, [&]() { return FaceAgglomeration(mesh); });
+}
+
+}
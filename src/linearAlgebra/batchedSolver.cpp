@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/batchedSolver.hpp"
+
+namespace NeoN::la
+{
+
+/* @brief the number of matrix values of every system */
+Vector<localIdx> squaredSizes(const Vector<localIdx>& sizes)
+{
+    Vector<localIdx> squared(sizes.exec(), sizes.size());
+    const auto [n, n2] = views(sizes, squared);
+    parallelFor(
+        sizes.exec(),
+        {0, sizes.size()},
+        KOKKOS_LAMBDA(const localIdx i) { n2[i] = n[i] * n[i]; },
+        "batchedSquaredSizes"
+    );
+    return squared;
+}
+
+BatchedDenseSystems::BatchedDenseSystems(const Vector<localIdx>& sizes)
+    : sizes_(sizes), matrices_(squaredSizes(sizes)), rhs_(sizes)
+{
+    fill(matrices_.values(), 0.0);
+    fill(rhs_.values(), 0.0);
+}
+
+BatchedDenseSystems::BatchedDenseSystems(const Executor& exec, localIdx nSystems, localIdx size)
+    : BatchedDenseSystems(Vector<localIdx>(exec, nSystems, size))
+{}
+
+SegmentedVector<scalar, localIdx> BatchedDenseSystems::createSolution() const
+{
+    return SegmentedVector<scalar, localIdx>(
+        Vector<scalar>(exec(), rhs_.values().size(), 0.0), rhs_.segments()
+    );
+}
+
+localIdx
+solveBatchedLU(BatchedDenseSystems& systems, SegmentedVector<scalar, localIdx>& x, scalar pivotTol)
+{
+    NF_ASSERT(systems.exec() == x.values().exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(x.values().size(), systems.rhs().values().size());
+    const auto sizes = systems.sizes().view();
+    const auto matrices = systems.matrices().view();
+    const auto rhs = systems.rhs().view();
+    auto sol = x.view();
+
+    localIdx nSingular = 0;
+    parallelReduce(
+        systems.exec(),
+        {0, systems.nSystems()},
+        KOKKOS_LAMBDA(const localIdx sysi, localIdx& singular) {
+            const localIdx n = sizes[sysi];
+            const localIdx aStart = matrices.segments[sysi];
+            const localIdx bStart = rhs.segments[sysi];
+            auto a = [&](localIdx row, localIdx col) -> scalar&
+            { return matrices.values[aStart + row * n + col]; };
+            auto y = [&](localIdx row) -> scalar& { return sol.values[bStart + row]; };
+
+            scalar maxEntry = 0.0;
+            for (localIdx i = 0; i < n * n; i++)
+            {
+                const scalar entry = Kokkos::abs(matrices.values[aStart + i]);
+                maxEntry = entry > maxEntry ? entry : maxEntry;
+            }
+            for (localIdx row = 0; row < n; row++)
+            {
+                y(row) = rhs.values[bStart + row];
+            }
+
+            bool regular = true;
+            for (localIdx k = 0; k < n; k++)
+            {
+                localIdx pivot = k;
+                for (localIdx row = k + 1; row < n; row++)
+                {
+                    if (Kokkos::abs(a(row, k)) > Kokkos::abs(a(pivot, k)))
+                    {
+                        pivot = row;
+                    }
+                }
+                if (Kokkos::abs(a(pivot, k)) <= pivotTol * maxEntry)
+                {
+                    regular = false;
+                    break;
+                }
+                if (pivot != k)
+                {
+                    for (localIdx col = k; col < n; col++)
+                    {
+                        const scalar tmp = a(k, col);
+                        a(k, col) = a(pivot, col);
+                        a(pivot, col) = tmp;
+                    }
+                    const scalar tmp = y(k);
+                    y(k) = y(pivot);
+                    y(pivot) = tmp;
+                }
+                const scalar invPivot = 1.0 / a(k, k);
+                for (localIdx row = k + 1; row < n; row++)
+                {
+                    const scalar factor = a(row, k) * invPivot;
+                    a(row, k) = 0.0;
+                    for (localIdx col = k + 1; col < n; col++)
+                    {
+                        a(row, col) -= factor * a(k, col);
+                    }
+                    y(row) -= factor * y(k);
+                }
+            }
+
+            if (!regular)
+            {
+                for (localIdx row = 0; row < n; row++)
+                {
+                    y(row) = 0.0;
+                }
+                singular += 1;
+                return;
+            }
+            for (localIdx row = n; row-- > 0;)
+            {
+                scalar sum = y(row);
+                for (localIdx col = row + 1; col < n; col++)
+                {
+                    sum -= a(row, col) * y(col);
+                }
+                y(row) = sum / a(row, row);
+            }
+        },
+        nSingular,
+        "solveBatchedLU"
+    );
+    return nSingular;
+}
+
+localIdx solveBatchedLU(BatchedDenseSystems& systems, SegmentedVector<scalar, localIdx>& x)
+{
+    return solveBatchedLU(systems, x, 1e-14);
+}
+
+}
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/blockJacobi.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+
+namespace NeoN::la
+{
+
+template<typename T>
+static T readOption(const Dictionary& dict, const std::string& key, T defaultValue)
+{
+    return dict.contains(key) ? dict.get<T>(key) : defaultValue;
+}
+
+Vector<localIdx> uniformBlockOffsets(const Executor& exec, localIdx nRows, localIdx blockSize)
+{
+    NF_ASSERT(blockSize > 0, "The block size needs to be larger than zero");
+    const auto nBlocks = (nRows + blockSize - 1) / blockSize;
+    Vector<localIdx> offsetsV(exec, nBlocks + 1);
+    auto offsets = offsetsV.view();
+    parallelFor(
+        exec,
+        {0, nBlocks + 1},
+        KOKKOS_LAMBDA(const localIdx blocki) {
+            offsets[blocki] = blocki * blockSize < nRows ? blocki * blockSize : nRows;
+        },
+        "uniformBlockOffsets"
+    );
+    return offsetsV;
+}
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(
+    const Executor& exec, localIdx nRows, localIdx blockSize
+)
+    : nRows_(nRows), blockSize_(blockSize),
+      blockOffsets_(uniformBlockOffsets(exec, nRows, blockSize)),
+      factors_(exec, (blockOffsets_.size() - 1) * blockSize * blockSize),
+      pivots_(exec, (blockOffsets_.size() - 1) * blockSize)
+{
+    NF_ASSERT(
+        blockSize <= maxBlockSize,
+        "The block size needs to be at most " + std::to_string(maxBlockSize)
+    );
+}
+
+void BlockJacobiPreconditioner::factorize(const CSRMatrix<scalar, localIdx>& mtx)
+{
+    NF_ASSERT_EQUAL(mtx.nRows(), nRows_);
+    NF_ASSERT(mtx.exec() == factors_.exec(), "Executors are not the same");
+    const auto bs = blockSize_;
+    const auto [values, colIdxs, rowOffs] = mtx.view();
+    const auto offsets = blockOffsets_.view();
+    auto [lu, pivots] = views(factors_, pivots_);
+    parallelFor(
+        factors_.exec(),
+        {0, nBlocks()},
+        KOKKOS_LAMBDA(const localIdx blocki) {
+            const auto start = offsets[blocki];
+            const auto n = offsets[blocki + 1] - start;
+            const auto base = blocki * bs * bs;
+            for (localIdx i = 0; i < n * n; i++)
+            {
+                lu[base + i] = 0.0;
+            }
+            for (localIdx i = 0; i < n; i++)
+            {
+                for (auto k = rowOffs[start + i]; k < rowOffs[start + i + 1]; k++)
+                {
+                    const auto j = colIdxs[k] - start;
+                    if (j >= 0 && j < n)
+                    {
+                        lu[base + i * n + j] += values[k];
+                    }
+                }
+            }
+
+            // LU with partial pivoting, the row swaps include the factors of L
+            for (localIdx j = 0; j < n; j++)
+            {
+                localIdx p = j;
+                for (localIdx i = j + 1; i < n; i++)
+                {
+                    if (Kokkos::abs(lu[base + i * n + j]) > Kokkos::abs(lu[base + p * n + j]))
+                    {
+                        p = i;
+                    }
+                }
+                pivots[blocki * bs + j] = p;
+                if (p != j)
+                {
+                    for (localIdx k = 0; k < n; k++)
+                    {
+                        const auto tmp = lu[base + j * n + k];
+                        lu[base + j * n + k] = lu[base + p * n + k];
+                        lu[base + p * n + k] = tmp;
+                    }
+                }
+                if (lu[base + j * n + j] == 0.0)
+                {
+                    lu[base + j * n + j] = 1.0;
+                }
+                for (localIdx i = j + 1; i < n; i++)
+                {
+                    const auto l = lu[base + i * n + j] / lu[base + j * n + j];
+                    lu[base + i * n + j] = l;
+                    for (localIdx k = j + 1; k < n; k++)
+                    {
+                        lu[base + i * n + k] -= l * lu[base + j * n + k];
+                    }
+                }
+            }
+        },
+        "blockJacobiFactorize"
+    );
+}
+
+void BlockJacobiPreconditioner::apply(const Vector<scalar>& xV, Vector<scalar>& yV) const
+{
+    NF_ASSERT_EQUAL(xV.size(), nRows_);
+    NF_ASSERT_EQUAL(yV.size(), nRows_);
+    const auto bs = blockSize_;
+    const auto [x, offsets, lu, pivots] = views(xV, blockOffsets_, factors_, pivots_);
+    auto y = yV.view();
+    parallelFor(
+        yV.exec(),
+        {0, nBlocks()},
+        KOKKOS_LAMBDA(const localIdx blocki) {
+            const auto start = offsets[blocki];
+            const auto n = offsets[blocki + 1] - start;
+            const auto base = blocki * bs * bs;
+            for (localIdx i = 0; i < n; i++)
+            {
+                y[start + i] = x[start + i];
+            }
+            for (localIdx j = 0; j < n; j++)
+            {
+                const auto p = pivots[blocki * bs + j];
+                const auto tmp = y[start + j];
+                y[start + j] = y[start + p];
+                y[start + p] = tmp;
+            }
+            // forward substitution with the unit lower and backward with the upper factor
+            for (localIdx i = 1; i < n; i++)
+            {
+                for (localIdx k = 0; k < i; k++)
+                {
+                    y[start + i] -= lu[base + i * n + k] * y[start + k];
+                }
+            }
+            for (localIdx i = n - 1; i >= 0; i--)
+            {
+                for (localIdx k = i + 1; k < n; k++)
+                {
+                    y[start + i] -= lu[base + i * n + k] * y[start + k];
+                }
+                y[start + i] /= lu[base + i * n + i];
+            }
+        },
+        "blockJacobiApply"
+    );
+}
+
+BlockJacobi::BlockJacobi(const Executor& exec, const Dictionary& solverConfig)
+    : Base(exec), blockSize_(static_cast<localIdx>(readOption<int>(solverConfig, "blockSize", 16))),
+      useCG_(readOption<std::string>(solverConfig, "krylov", "cg") == "cg"),
+      maxIters_(readOption<int>(solverConfig, "maxIters", 1000)),
+      relTol_(readOption<scalar>(solverConfig, "relTol", 1e-6)),
+      absTol_(readOption<scalar>(solverConfig, "absTol", 0.0))
+{
+    const auto krylov = readOption<std::string>(solverConfig, "krylov", "cg");
+    if (krylov != "cg" && krylov != "none")
+    {
+        NF_ERROR_EXIT("Unknown krylov " + krylov + ", expected cg or none.");
+    }
+    NF_ASSERT(
+        blockSize_ > 0 && blockSize_ <= BlockJacobiPreconditioner::maxBlockSize,
+        "blockSize needs to be in [1, 32]"
+    );
+    NF_ASSERT(maxIters_ > 0, "maxIters needs to be larger than zero");
+}
+
+SolverStats BlockJacobi::solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
+{
+    NF_ASSERT(sys.matrix().exec() == x.exec(), "Executors are not the same");
+    PhaseTimer timer;
+    SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+    const auto& mtx = sys.matrix();
+    if (!preconditioner_ || preconditioner_->nRows() != mtx.nRows())
+    {
+        preconditioner_.emplace(x.exec(), mtx.nRows(), blockSize_);
+    }
+    preconditioner_->factorize(mtx);
+    timings.preconditionerTime = timer.lap();
+
+    Vector<scalar> r(x.exec(), x.size());
+    Vector<scalar> z(x.exec(), x.size());
+    timings.setupTime = timer.lap();
+    const scalar initResNorm = computeResidualNorms(mtx, sys.rhs(), x, r).l2;
+    const scalar tol = std::max(absTol_, relTol_ * initResNorm);
+    scalar resNorm = initResNorm;
+
+    int numIter = 0;
+    if (useCG_)
+    {
+        // r = rhs - A x, z = M^-1 r
+        scalarMul(r, -1.0);
+        Vector<scalar> p(x.exec(), x.size(), 0.0);
+        Vector<scalar> q(x.exec(), x.size());
+        scalar rz = 0.0;
+        while (numIter < maxIters_ && resNorm > tol)
+        {
+            preconditioner_->apply(r, z);
+            const scalar rzNew = dot(r, z);
+            axpby(1.0, z, numIter == 0 ? 0.0 : rzNew / rz, p);
+            rz = rzNew;
+            spmv(mtx, p, q);
+            const scalar alpha = rz / dot(p, q);
+            axpby(alpha, p, 1.0, x);
+            axpby(-alpha, q, 1.0, r);
+            resNorm = std::sqrt(dot(r, r));
+            numIter++;
+        }
+    }
+    else
+    {
+        // r = A x - rhs, thus x -= M^-1 r
+        while (numIter < maxIters_ && resNorm > tol)
+        {
+            preconditioner_->apply(r, z);
+            axpby(-1.0, z, 1.0, x);
+            resNorm = computeResidualNorms(mtx, sys.rhs(), x, r).l2;
+            numIter++;
+        }
+    }
+
+    timings.applyTime = timer.lap();
+    return {numIter, initResNorm, resNorm, timer.total(), timings};
+}
+
+}
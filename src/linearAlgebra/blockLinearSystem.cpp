@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/blockLinearSystem.hpp"
+
+namespace NeoN::la
+{
+
+LinearSystem<scalar, localIdx> createComponentSystem(const LinearSystem<Vec3, localIdx>& ls)
+{
+    const auto& exec = ls.exec();
+    const auto& mtx = ls.matrix();
+    return {
+        CSRMatrix<scalar, localIdx> {
+            Vector<scalar>(exec, mtx.values().size(), 0.0), mtx.colIdxs(), mtx.rowOffs()
+        },
+        Vector<scalar>(exec, ls.rhs().size(), 0.0),
+        ls.auxiliaryCoefficients()
+    };
+}
+
+void extractComponent(
+    const LinearSystem<Vec3, localIdx>& ls, localIdx cmpt, LinearSystem<scalar, localIdx>& cmptLs
+)
+{
+    NF_ASSERT(ls.exec() == cmptLs.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(ls.matrix().values().size(), cmptLs.matrix().values().size());
+    NF_ASSERT_EQUAL(ls.rhs().size(), cmptLs.rhs().size());
+
+    const auto [values, rhs] = views(ls.matrix().values(), ls.rhs());
+    auto [cmptValues, cmptRhs] = views(cmptLs.matrix().values(), cmptLs.rhs());
+
+    parallelFor(
+        ls.exec(),
+        {0, values.size()},
+        KOKKOS_LAMBDA(const localIdx i) { cmptValues[i] = values[i][cmpt]; },
+        "extractComponentValues"
+    );
+    parallelFor(
+        ls.exec(),
+        {0, rhs.size()},
+        KOKKOS_LAMBDA(const localIdx i) { cmptRhs[i] = rhs[i][cmpt]; },
+        "extractComponentRhs"
+    );
+}
+
+void extractComponent(const Vector<Vec3>& in, localIdx cmpt, Vector<scalar>& out)
+{
+    NF_ASSERT(in.exec() == out.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(in.size(), out.size());
+    auto [outV, inV] = views(out, in);
+    parallelFor(
+        in.exec(),
+        {0, in.size()},
+        KOKKOS_LAMBDA(const localIdx i) { outV[i] = inV[i][cmpt]; },
+        "extractComponent"
+    );
+}
+
+void insertComponent(const Vector<scalar>& in, localIdx cmpt, Vector<Vec3>& out)
+{
+    NF_ASSERT(in.exec() == out.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(in.size(), out.size());
+    auto [outV, inV] = views(out, in);
+    parallelFor(
+        in.exec(),
+        {0, in.size()},
+        KOKKOS_LAMBDA(const localIdx i) { outV[i][cmpt] = inV[i]; },
+        "insertComponent"
+    );
+}
+
+LinearSystem<scalar, localIdx> createCoupledSystem(const LinearSystem<Vec3, localIdx>& ls)
+{
+    const auto& exec = ls.exec();
+    const auto nRows = ls.rhs().size();
+    const auto nnz = ls.matrix().values().size();
+
+    Vector<scalar> values(exec, 3 * nnz);
+    Vector<columnIdx> colIdxs(exec, 3 * nnz);
+    Vector<localIdx> rowOffs(exec, 3 * nRows + 1);
+    Vector<scalar> rhs(exec, 3 * nRows);
+
+    const auto [vecValues, vecColIdxs, vecRowOffs] = ls.matrix().view();
+    const auto vecRhs = ls.rhs().view();
+    auto [cValues, cColIdxs, cRowOffs, cRhs] = views(values, colIdxs, rowOffs, rhs);
+
+    parallelFor(
+        exec,
+        {0, nRows},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            const auto rowStart = vecRowOffs[rowi];
+            const auto rowLength = vecRowOffs[rowi + 1] - rowStart;
+            for (localIdx d = 0; d < 3; d++)
+            {
+                // the three rows of a cell are stored consecutively
+                const auto cRowStart = 3 * rowStart + d * rowLength;
+                cRowOffs[3 * rowi + d] = cRowStart;
+                for (localIdx j = 0; j < rowLength; j++)
+                {
+                    cValues[cRowStart + j] = vecValues[rowStart + j][d];
+                    cColIdxs[cRowStart + j] =
+                        static_cast<columnIdx>(3 * vecColIdxs[rowStart + j] + d);
+                }
+                cRhs[3 * rowi + d] = vecRhs[rowi][d];
+            }
+            if (rowi == nRows - 1)
+            {
+                cRowOffs[3 * nRows] = 3 * vecRowOffs[nRows];
+            }
+        },
+        "createCoupledSystem"
+    );
+
+    return {CSRMatrix<scalar, localIdx> {values, colIdxs, rowOffs}, rhs};
+}
+
+void interleave(const Vector<Vec3>& in, Vector<scalar>& out)
+{
+    NF_ASSERT(in.exec() == out.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(3 * in.size(), out.size());
+    auto [outV, inV] = views(out, in);
+    parallelFor(
+        in.exec(),
+        {0, in.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            for (localIdx d = 0; d < 3; d++)
+            {
+                outV[3 * i + d] = inV[i][d];
+            }
+        },
+        "interleave"
+    );
+}
+
+void deinterleave(const Vector<scalar>& in, Vector<Vec3>& out)
+{
+    NF_ASSERT(in.exec() == out.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(in.size(), 3 * out.size());
+    auto [outV, inV] = views(out, in);
+    parallelFor(
+        in.exec(),
+        {0, out.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            for (localIdx d = 0; d < 3; d++)
+            {
+                outV[i][d] = inV[3 * i + d];
+            }
+        },
+        "deinterleave"
+    );
+}
+
+}
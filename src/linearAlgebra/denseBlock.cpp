@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/denseBlock.hpp"
+
+namespace NeoN::la
+{
+
+void DenseBlock::getColumn(localIdx j, Vector<scalar>& column) const
+{
+    NF_ASSERT(j >= 0 && j < nCols_, "Column " << j << " is out of range.");
+    NF_ASSERT(column.exec() == exec(), "Executors are not the same.");
+    column.resize(nRows_);
+    auto columnV = column.view();
+    const auto valuesV = values_.view();
+    const auto nCols = nCols_;
+    parallelFor(
+        exec(),
+        {0, nRows_},
+        KOKKOS_LAMBDA(const localIdx i) { columnV[i] = valuesV[i * nCols + j]; },
+        "DenseBlock::getColumn"
+    );
+}
+
+void DenseBlock::setColumn(localIdx j, const Vector<scalar>& column)
+{
+    NF_ASSERT(j >= 0 && j < nCols_, "Column " << j << " is out of range.");
+    NF_ASSERT_EQUAL(column.size(), nRows_);
+    NF_ASSERT(column.exec() == exec(), "Executors are not the same.");
+    auto valuesV = values_.view();
+    const auto columnV = column.view();
+    const auto nCols = nCols_;
+    parallelFor(
+        exec(),
+        {0, nRows_},
+        KOKKOS_LAMBDA(const localIdx i) { valuesV[i * nCols + j] = columnV[i]; },
+        "DenseBlock::setColumn"
+    );
+}
+
+}
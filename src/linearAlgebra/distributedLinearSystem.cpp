@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
+
+namespace NeoN::la
+{
+
+GlobalRowNumbering::GlobalRowNumbering(const mpi::MPIEnvironment& mpiEnviron, localIdx nLocalRows)
+    : rank_(mpiEnviron.rank()), rankOffsets_(mpiEnviron.sizeRank() + 1, 0)
+{
+    std::vector<globalIdx> nRows(mpiEnviron.sizeRank());
+    globalIdx nLocal = static_cast<globalIdx>(nLocalRows);
+    MPI_Allgather(
+        &nLocal,
+        1,
+        mpi::getType<globalIdx>(),
+        nRows.data(),
+        1,
+        mpi::getType<globalIdx>(),
+        mpiEnviron.comm()
+    );
+    for (size_t rank = 0; rank < nRows.size(); rank++)
+    {
+        rankOffsets_[rank + 1] = rankOffsets_[rank] + nRows[rank];
+    }
+}
+
+Vector<globalIdx> exchangeGlobalIdxs(
+    Communicator& comm,
+    const GlobalRowNumbering& numbering,
+    const Vector<localIdx>& haloIdxs,
+    localIdx haloSize
+)
+{
+    const auto exec = haloIdxs.exec();
+    const auto nLocal = numbering.nLocalRows();
+    const auto offset = numbering.rowOffset();
+    NF_ASSERT(haloSize >= nLocal, "The halo size is smaller than the number of local rows");
+
+    Vector<globalIdx> globalIdxs(exec, haloSize, globalIdx(-1));
+    auto globalIdxsView = globalIdxs.view();
+    parallelFor(
+        exec,
+        {0, nLocal},
+        KOKKOS_LAMBDA(const localIdx i) { globalIdxsView[i] = offset + static_cast<globalIdx>(i); },
+        "setGlobalIdxs"
+    );
+
+    comm.startComm(globalIdxs, "exchangeGlobalIdxs");
+    comm.finaliseComm(globalIdxs, "exchangeGlobalIdxs");
+
+    Vector<globalIdx> haloGlobalIdxs(exec, haloIdxs.size());
+    auto [haloGlobal, halo, global] = views(haloGlobalIdxs, haloIdxs, globalIdxs);
+    parallelFor(
+        exec,
+        {0, haloIdxs.size()},
+        KOKKOS_LAMBDA(const localIdx i) { haloGlobal[i] = global[halo[i]]; },
+        "gatherHaloGlobalIdxs"
+    );
+    return haloGlobalIdxs;
+}
+
+}
@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/gaussSeidel.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+
+namespace NeoN::la
+{
+
+template<typename T>
+static T readOption(const Dictionary& dict, const std::string& key, T defaultValue)
+{
+    return dict.contains(key) ? dict.get<T>(key) : defaultValue;
+}
+
+const MatrixColoring& MatrixColoring::readOrCreate(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<MatrixColoring> key("MatrixColoring");
+    return mesh.stencilDB().getOrCreate(
+        key, [&]() { return createColoring(SparsityPattern::readOrCreate(mesh)); }
+    );
+}
+
+MatrixColoring createColoring(const Vector<localIdx>& rowOffsV, const Vector<columnIdx>& colIdxsV)
+{
+    const auto hostRowOffs = rowOffsV.copyToHost();
+    const auto hostColIdxs = colIdxsV.copyToHost();
+    const auto [rowOffs, colIdxs] = views(hostRowOffs, hostColIdxs);
+    const auto nRows = rowOffs.size() > 0 ? rowOffs.size() - 1 : 0;
+    constexpr auto uncolored = std::numeric_limits<localIdx>::max();
+    std::vector<localIdx> rowColor(nRows, uncolored);
+    // the last row which found a color used by one of its neighbours
+    std::vector<std::size_t> usedBy;
+    localIdx nColors = 0;
+    for (std::size_t rowi = 0; rowi < nRows; rowi++)
+    {
+        for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+        {
+            const auto color = rowColor[static_cast<std::size_t>(colIdxs[k])];
+            if (color != uncolored)
+            {
+                usedBy[static_cast<std::size_t>(color)] = rowi;
+            }
+        }
+        localIdx color = 0;
+        while (color < nColors && usedBy[static_cast<std::size_t>(color)] == rowi)
+        {
+            color++;
+        }
+        if (color == nColors)
+        {
+            nColors++;
+            usedBy.push_back(nRows);
+        }
+        rowColor[rowi] = color;
+    }
+
+    std::vector<localIdx> offsets(static_cast<std::size_t>(nColors) + 1, 0);
+    for (auto color : rowColor)
+    {
+        offsets[static_cast<std::size_t>(color) + 1]++;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<localIdx> rows(nRows);
+    std::vector<localIdx> insert(offsets.begin(), offsets.end() - 1);
+    for (std::size_t rowi = 0; rowi < nRows; rowi++)
+    {
+        const auto color = static_cast<std::size_t>(rowColor[rowi]);
+        rows[static_cast<std::size_t>(insert[color]++)] = static_cast<localIdx>(rowi);
+    }
+    return MatrixColoring {Vector<localIdx>(rowOffsV.exec(), rows), offsets};
+}
+
+MatrixColoring createColoring(const SparsityPattern& sparsity)
+{
+    return createColoring(sparsity.rowOffs(), sparsity.colIdxs());
+}
+
+MatrixColoring createColoring(const CSRMatrix<scalar, localIdx>& mtx)
+{
+    return createColoring(mtx.rowOffs(), mtx.colIdxs());
+}
+
+Vector<localIdx> diagonalIndices(const CSRMatrix<scalar, localIdx>& mtx)
+{
+    Vector<localIdx> diagIdxsV(mtx.exec(), mtx.nRows());
+    auto diagIdxs = diagIdxsV.view();
+    const auto [values, colIdxs, rowOffs] = mtx.view();
+    localIdx nMissing = 0;
+    parallelReduce(
+        mtx.exec(),
+        {0, mtx.nRows()},
+        KOKKOS_LAMBDA(const localIdx rowi, localIdx& missing) {
+            auto k = rowOffs[rowi];
+            while (k < rowOffs[rowi + 1] && colIdxs[k] != rowi)
+            {
+                k++;
+            }
+            diagIdxs[rowi] = k;
+            if (k == rowOffs[rowi + 1])
+            {
+                missing += 1;
+            }
+        },
+        nMissing,
+        "diagonalIndices"
+    );
+    NF_ASSERT(nMissing == 0, "Gauss-Seidel requires a diagonal entry in every row");
+    return diagIdxsV;
+}
+
+/* @brief updates the rows of one color, the rows of a color are not coupled */
+void gaussSeidelColor(
+    const CSRMatrix<scalar, localIdx>& mtx,
+    const Vector<localIdx>& diagIdxsV,
+    const MatrixColoring& coloring,
+    const Vector<scalar>& rhsV,
+    Vector<scalar>& xV,
+    std::size_t color,
+    scalar relaxation
+)
+{
+    auto [x, rhs, diagIdxs, rows] = views(xV, rhsV, diagIdxsV, coloring.rows);
+    const auto [values, colIdxs, rowOffs] = mtx.view();
+    parallelFor(
+        xV.exec(),
+        {coloring.offsets[color], coloring.offsets[color + 1]},
+        KOKKOS_LAMBDA(const localIdx i) {
+            const auto rowi = rows[i];
+            scalar sum = rhs[rowi];
+            for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+            {
+                if (k != diagIdxs[rowi])
+                {
+                    sum -= values[k] * x[colIdxs[k]];
+                }
+            }
+            x[rowi] += relaxation * (sum / values[diagIdxs[rowi]] - x[rowi]);
+        },
+        "gaussSeidelColor"
+    );
+}
+
+void gaussSeidelSweeps(
+    const CSRMatrix<scalar, localIdx>& mtx,
+    const Vector<localIdx>& diagIdxs,
+    const MatrixColoring& coloring,
+    const Vector<scalar>& rhs,
+    Vector<scalar>& x,
+    int sweeps,
+    SweepDirection direction,
+    scalar relaxation
+)
+{
+    NF_ASSERT(mtx.exec() == x.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(coloring.rows.size(), mtx.nRows());
+    const auto nColors = static_cast<std::size_t>(coloring.nColors());
+    for (int sweep = 0; sweep < sweeps; sweep++)
+    {
+        if (direction != SweepDirection::Backward)
+        {
+            for (std::size_t color = 0; color < nColors; color++)
+            {
+                gaussSeidelColor(mtx, diagIdxs, coloring, rhs, x, color, relaxation);
+            }
+        }
+        if (direction != SweepDirection::Forward)
+        {
+            for (std::size_t color = nColors; color-- > 0;)
+            {
+                gaussSeidelColor(mtx, diagIdxs, coloring, rhs, x, color, relaxation);
+            }
+        }
+    }
+}
+
+GaussSeidel::GaussSeidel(const Executor& exec, const Dictionary& solverConfig)
+    : Base(exec), direction_(SweepDirection::Symmetric),
+      relaxation_(readOption<scalar>(solverConfig, "relaxation", 1.0)),
+      useCG_(readOption<std::string>(solverConfig, "krylov", "none") == "cg"),
+      maxIters_(readOption<int>(solverConfig, "maxIters", 100)),
+      relTol_(readOption<scalar>(solverConfig, "relTol", 1e-6)),
+      absTol_(readOption<scalar>(solverConfig, "absTol", 0.0)), diagIdxs_(exec, 0)
+{
+    const auto sweep = readOption<std::string>(solverConfig, "sweep", "symmetric");
+    if (sweep == "forward")
+    {
+        direction_ = SweepDirection::Forward;
+    }
+    else if (sweep == "backward")
+    {
+        direction_ = SweepDirection::Backward;
+    }
+    else if (sweep != "symmetric")
+    {
+        NF_ERROR_EXIT("Unknown sweep " + sweep + ", expected forward, backward or symmetric.");
+    }
+    const auto krylov = readOption<std::string>(solverConfig, "krylov", "none");
+    if (krylov != "cg" && krylov != "none")
+    {
+        NF_ERROR_EXIT("Unknown krylov " + krylov + ", expected cg or none.");
+    }
+    NF_ASSERT(
+        !useCG_ || direction_ == SweepDirection::Symmetric,
+        "The conjugate gradient method requires a symmetric sweep"
+    );
+    NF_ASSERT(relaxation_ > 0.0 && relaxation_ < 2.0, "relaxation needs to be in (0, 2)");
+    NF_ASSERT(maxIters_ > 0, "maxIters needs to be larger than zero");
+}
+
+void GaussSeidel::updateColoring(const LinearSystem<scalar, localIdx>& sys) const
+{
+    const auto& mtx = sys.matrix();
+    if (coloring_ && diagIdxs_.size() == mtx.nRows() && nNonZeros_ == mtx.nNonZeros())
+    {
+        return;
+    }
+    const auto& aux = sys.auxiliaryCoefficients();
+    const UnstructuredMesh* mesh =
+        aux.contains("mesh") ? aux.get<const UnstructuredMesh*>("mesh") : nullptr;
+    if (mesh != nullptr && mesh->nCells() == mtx.nRows()
+        && SparsityPattern::readOrCreate(*mesh).nnz() == mtx.nNonZeros())
+    {
+        coloring_.emplace(MatrixColoring::readOrCreate(*mesh));
+    }
+    else
+    {
+        coloring_.emplace(createColoring(mtx));
+    }
+    diagIdxs_ = diagonalIndices(mtx);
+    nNonZeros_ = mtx.nNonZeros();
+}
+
+SolverStats GaussSeidel::solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
+{
+    NF_ASSERT(sys.matrix().exec() == x.exec(), "Executors are not the same");
+    PhaseTimer timer;
+    SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+    updateColoring(sys);
+    timings.preconditionerTime = timer.lap();
+
+    const auto& mtx = sys.matrix();
+    Vector<scalar> r(x.exec(), x.size());
+    timings.setupTime = timer.lap();
+    const scalar initResNorm = computeResidualNorms(mtx, sys.rhs(), x, r).l2;
+    const scalar tol = std::max(absTol_, relTol_ * initResNorm);
+    scalar resNorm = initResNorm;
+
+    int numIter = 0;
+    if (useCG_)
+    {
+        // r = rhs - A x, z = M^-1 r with one symmetric sweep from a zero initial guess
+        scalarMul(r, -1.0);
+        Vector<scalar> z(x.exec(), x.size());
+        Vector<scalar> p(x.exec(), x.size(), 0.0);
+        Vector<scalar> q(x.exec(), x.size());
+        scalar rz = 0.0;
+        while (numIter < maxIters_ && resNorm > tol)
+        {
+            fill(z, 0.0);
+            gaussSeidelSweeps(
+                mtx, diagIdxs_, *coloring_, r, z, 1, SweepDirection::Symmetric, relaxation_
+            );
+            const scalar rzNew = dot(r, z);
+            axpby(1.0, z, numIter == 0 ? 0.0 : rzNew / rz, p);
+            rz = rzNew;
+            spmv(mtx, p, q);
+            const scalar alpha = rz / dot(p, q);
+            axpby(alpha, p, 1.0, x);
+            axpby(-alpha, q, 1.0, r);
+            resNorm = std::sqrt(dot(r, r));
+            numIter++;
+        }
+    }
+    else
+    {
+        while (numIter < maxIters_ && resNorm > tol)
+        {
+            gaussSeidelSweeps(mtx, diagIdxs_, *coloring_, sys.rhs(), x, 1, direction_, relaxation_);
+            resNorm = computeResidualNorms(mtx, sys.rhs(), x, r).l2;
+            numIter++;
+        }
+    }
+
+    timings.applyTime = timer.lap();
+    return {numIter, initResNorm, resNorm, timer.total(), timings};
+}
+
+}
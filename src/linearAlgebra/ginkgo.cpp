@@ -4,8 +4,12 @@
 
 #if NF_WITH_GINKGO
 
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <utility>
 
+#include "NeoN/core/backendRegistry.hpp"
 #include "NeoN/linearAlgebra/ginkgo.hpp"
 
 gko::config::pnode NeoN::la::ginkgo::parse(const Dictionary& dict)
@@ -94,23 +98,130 @@ gko::config::pnode NeoN::la::ginkgo::parse(const Dictionary& dict)
     return gko::config::pnode {result};
 }
 
-// TODO: check if this can be replaced by Ginkgos executor mapping
+namespace
+{
+
+/* @brief the Ginkgo executors shared by all solvers of the process
+ *
+ * The executors are created on first use and released when Kokkos is finalized, before the
+ * device runtime is torn down. GPU executors are registered per stream of the execution space
+ * instance, all other executors per executor type.
+ */
+class GkoExecutorRegistry
+{
+public:
+
+    using Key = std::pair<std::size_t, const void*>;
+
+    static GkoExecutorRegistry& instance()
+    {
+        static GkoExecutorRegistry registry;
+        return registry;
+    }
+
+    template<typename Create>
+    std::shared_ptr<gko::Executor> getOrCreate(const Key& key, Create create)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& gkoExec = executors_[key];
+        if (!gkoExec)
+        {
+            gkoExec = BackendRegistry::instance().timed("Ginkgo", create);
+        }
+        return gkoExec;
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        executors_.clear();
+    }
+
+private:
+
+    GkoExecutorRegistry()
+    {
+        Kokkos::push_finalize_hook([]() { GkoExecutorRegistry::instance().release(); });
+    }
+
+    std::mutex mutex_;
+
+    std::map<Key, std::shared_ptr<gko::Executor>> executors_;
+};
+
+}
+
 std::shared_ptr<gko::Executor> NeoN::la::ginkgo::getGkoExecutor(NeoN::Executor exec)
 {
+    const auto index = exec.index();
     return std::visit(
-        [](auto concreteExec) -> std::shared_ptr<gko::Executor>
+        [index](auto concreteExec) -> std::shared_ptr<gko::Executor>
         {
             using ExecType = std::decay_t<decltype(concreteExec)>;
+            auto& registry = GkoExecutorRegistry::instance();
             if constexpr (std::is_same_v<ExecType, NeoN::SerialExecutor>)
             {
-                return gko::ReferenceExecutor::create();
+                return registry.getOrCreate(
+                    {index, nullptr}, []() { return gko::ReferenceExecutor::create(); }
+                );
             }
             else if constexpr (std::is_same_v<ExecType, NeoN::CPUExecutor>)
             {
 #if defined(KOKKOS_ENABLE_OMP)
-                return gko::OmpExecutor::create();
+                return registry.getOrCreate(
+                    {index, nullptr}, []() { return gko::OmpExecutor::create(); }
+                );
 #elif defined(KOKKOS_ENABLE_THREADS)
-                return gko::ReferenceExecutor::create();
+                return registry.getOrCreate(
+                    {index, nullptr}, []() { return gko::ReferenceExecutor::create(); }
+                );
+#endif
+            }
+            else if constexpr (std::is_same_v<ExecType, NeoN::GPUExecutor>)
+            {
+                // Ginkgo enqueues on the stream of the Kokkos instance, so no synchronization
+                // between both libraries is required
+#if defined(KOKKOS_ENABLE_CUDA)
+                auto stream = concreteExec.underlyingExec().cuda_stream();
+                return registry.getOrCreate(
+                    {index, stream},
+                    [stream]()
+                    {
+                        return gko::CudaExecutor::create(
+                            Kokkos::device_id(),
+                            gko::ReferenceExecutor::create(),
+                            std::make_shared<gko::CudaAllocator>(),
+                            stream
+                        );
+                    }
+                );
+#elif defined(KOKKOS_ENABLE_HIP)
+                auto stream = concreteExec.underlyingExec().hip_stream();
+                return registry.getOrCreate(
+                    {index, stream},
+                    [stream]()
+                    {
+                        return gko::HipExecutor::create(
+                            Kokkos::device_id(),
+                            gko::ReferenceExecutor::create(),
+                            std::make_shared<gko::HipAllocator>(),
+                            stream
+                        );
+                    }
+                );
+#endif
+                throw std::runtime_error("No valid GPU executor mapping available");
+            }
+            else
+            {
+                throw std::runtime_error("Unsupported executor type");
+            }
+            return gko::ReferenceExecutor::create();
+        },
+        exec
+    );
+}
+
 #endif
             }
             else if constexpr (std::is_same_v<ExecType, NeoN::GPUExecutor>)
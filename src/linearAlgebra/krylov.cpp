@@ -0,0 +1,1113 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/timer.hpp"
+#include "NeoN/linearAlgebra/krylov.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+
+namespace NeoN::la
+{
+
+template<typename T>
+static T readOption(const Dictionary& dict, const std::string& key, T defaultValue)
+{
+    return dict.contains(key) ? dict.get<T>(key) : defaultValue;
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+/* @brief returns the exclusive prefix sum of the counts, ie. the offsets of the ranks */
+static std::vector<mpi_label_t> rankOffsets(const std::vector<mpi_label_t>& counts)
+{
+    std::vector<mpi_label_t> offsets(counts.size() + 1, 0);
+    std::partial_sum(counts.begin(), counts.end(), offsets.begin() + 1);
+    return offsets;
+}
+
+InterfaceExchange::InterfaceExchange(const DistributedLinearSystem<scalar, localIdx>& sys)
+    : comm_(MPI_COMM_NULL), interfaceValues_(sys.interfaceValues()), sendRows_(sys.exec(), 0),
+      entries_(sys.exec(), 0), entryRowOffs_(sys.exec(), 0), recvIdxs_(sys.exec(), 0),
+      send_(sys.exec(), 0), recv_(sys.exec(), 0), sendHost_(SerialExecutor {}, 0),
+      recvHost_(SerialExecutor {}, 0)
+{
+    const auto exec = sys.exec();
+    MPI_Comm_dup(sys.mpiEnvironment().comm(), &comm_);
+    const auto nRanks = sys.mpiEnvironment().sizeRank();
+    const auto& numbering = sys.numbering();
+    const auto& globalOffsets = numbering.rankOffsets();
+    const auto hostRows = sys.interfaceRows().copyToHost();
+    const auto hostCols = sys.interfaceCols().copyToHost();
+    const auto [ifRows, ifCols] = views(hostRows, hostCols);
+    const auto nEntries = ifCols.size();
+
+    // the requested columns in ascending order are grouped by their owner
+    std::vector<globalIdx> recvCols(ifCols.begin(), ifCols.end());
+    std::sort(recvCols.begin(), recvCols.end());
+    recvCols.erase(std::unique(recvCols.begin(), recvCols.end()), recvCols.end());
+    std::vector<mpi_label_t> recvCounts(nRanks, 0);
+    for (const auto col : recvCols)
+    {
+        const auto owner =
+            std::upper_bound(globalOffsets.begin(), globalOffsets.end(), col)
+            - globalOffsets.begin() - 1;
+        recvCounts[static_cast<std::size_t>(owner)]++;
+    }
+
+    // every owner receives the columns requested from it
+    std::vector<mpi_label_t> sendCounts(nRanks, 0);
+    MPI_Alltoall(
+        recvCounts.data(),
+        1,
+        mpi::getType<mpi_label_t>(),
+        sendCounts.data(),
+        1,
+        mpi::getType<mpi_label_t>(),
+        comm_
+    );
+    recvOffsets_ = rankOffsets(recvCounts);
+    sendOffsets_ = rankOffsets(sendCounts);
+    std::vector<globalIdx> sendCols(static_cast<std::size_t>(sendOffsets_.back()));
+    MPI_Alltoallv(
+        recvCols.data(),
+        recvCounts.data(),
+        recvOffsets_.data(),
+        mpi::getType<globalIdx>(),
+        sendCols.data(),
+        sendCounts.data(),
+        sendOffsets_.data(),
+        mpi::getType<globalIdx>(),
+        comm_
+    );
+    std::vector<localIdx> sendRows(sendCols.size());
+    for (std::size_t i = 0; i < sendCols.size(); i++)
+    {
+        sendRows[i] = static_cast<localIdx>(sendCols[i] - numbering.rowOffset());
+    }
+
+    // the coefficients sorted by row, so every row adds its contributions without atomics
+    const auto nRows = static_cast<std::size_t>(numbering.nLocalRows());
+    std::vector<localIdx> entryRowOffs(nRows + 1, 0);
+    for (const auto rowi : ifRows)
+    {
+        entryRowOffs[static_cast<std::size_t>(rowi) + 1]++;
+    }
+    std::partial_sum(entryRowOffs.begin(), entryRowOffs.end(), entryRowOffs.begin());
+    std::vector<localIdx> next(entryRowOffs.begin(), entryRowOffs.end() - 1);
+    std::vector<localIdx> entries(nEntries);
+    std::vector<localIdx> recvIdxs(nEntries);
+    for (std::size_t i = 0; i < nEntries; i++)
+    {
+        const auto rowi = static_cast<std::size_t>(ifRows[static_cast<localIdx>(i)]);
+        entries[static_cast<std::size_t>(next[rowi]++)] = static_cast<localIdx>(i);
+        const auto col = ifCols[static_cast<localIdx>(i)];
+        recvIdxs[i] = static_cast<localIdx>(
+            std::lower_bound(recvCols.begin(), recvCols.end(), col) - recvCols.begin()
+        );
+    }
+
+    sendRows_ = Vector<localIdx>(exec, sendRows);
+    entries_ = Vector<localIdx>(exec, entries);
+    entryRowOffs_ = Vector<localIdx>(exec, entryRowOffs);
+    recvIdxs_ = Vector<localIdx>(exec, recvIdxs);
+    send_ = Vector<scalar>(exec, static_cast<localIdx>(sendCols.size()));
+    recv_ = Vector<scalar>(exec, static_cast<localIdx>(recvCols.size()));
+    sendHost_ = Vector<scalar>(SerialExecutor {}, send_.size());
+    recvHost_ = Vector<scalar>(SerialExecutor {}, recv_.size());
+}
+
+InterfaceExchange::~InterfaceExchange() { MPI_Comm_free(&comm_); }
+
+void InterfaceExchange::start(const Vector<scalar>& xV)
+{
+    ScopedTimer timer("InterfaceExchange::start", xV.exec());
+    auto [send, sendRows, x] = views(send_, sendRows_, xV);
+    parallelFor(
+        xV.exec(),
+        {0, send_.size()},
+        KOKKOS_LAMBDA(const localIdx i) { send[i] = x[sendRows[i]]; },
+        "packInterfaceValues"
+    );
+    send_.copyToHost(sendHost_);
+
+    requests_.clear();
+    for (std::size_t rank = 0; rank + 1 < recvOffsets_.size(); rank++)
+    {
+        const auto count = recvOffsets_[rank + 1] - recvOffsets_[rank];
+        if (count > 0)
+        {
+            auto& request = requests_.emplace_back(MPI_REQUEST_NULL);
+            mpi::irecv(
+                recvHost_.data() + recvOffsets_[rank],
+                count,
+                static_cast<mpi_label_t>(rank),
+                0,
+                comm_,
+                &request
+            );
+        }
+    }
+    for (std::size_t rank = 0; rank + 1 < sendOffsets_.size(); rank++)
+    {
+        const auto count = sendOffsets_[rank + 1] - sendOffsets_[rank];
+        if (count > 0)
+        {
+            auto& request = requests_.emplace_back(MPI_REQUEST_NULL);
+            mpi::isend(
+                sendHost_.data() + sendOffsets_[rank],
+                count,
+                static_cast<mpi_label_t>(rank),
+                0,
+                comm_,
+                &request
+            );
+        }
+    }
+}
+
+void InterfaceExchange::finish(Vector<scalar>& yV)
+{
+    ScopedTimer timer("InterfaceExchange::finish", yV.exec());
+    MPI_Waitall(static_cast<mpi_label_t>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE);
+    recv_ = recvHost_.copyToExecutor(yV.exec());
+
+    auto [y, recv, values, entries, entryRowOffs, recvIdxs] =
+        views(yV, recv_, interfaceValues_, entries_, entryRowOffs_, recvIdxs_);
+    parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            scalar sum = 0.0;
+            for (auto k = entryRowOffs[rowi]; k < entryRowOffs[rowi + 1]; k++)
+            {
+                const auto entryi = entries[k];
+                sum += values[entryi] * recv[recvIdxs[entryi]];
+            }
+            y[rowi] += sum;
+        },
+        "addInterfaceContributions"
+    );
+}
+#endif
+
+/* @brief computes the inverse diagonal of the matrix, rows without diagonal entry get one */
+Vector<scalar> inverseDiagonal(const CSRMatrix<scalar, localIdx>& mtx)
+{
+    Vector<scalar> invDiagV(mtx.values().exec(), mtx.nRows());
+    const auto [values, colIdxs, rowOffs] = mtx.view();
+    auto invDiag = invDiagV.view();
+    parallelFor(
+        invDiagV.exec(),
+        {0, invDiagV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            scalar diag = 0.0;
+            for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+            {
+                if (colIdxs[k] == rowi)
+                {
+                    diag = values[k];
+                }
+            }
+            invDiag[rowi] = diag != 0.0 ? 1.0 / diag : 1.0;
+        },
+        "krylovInverseDiagonal"
+    );
+    return invDiagV;
+}
+
+KrylovOperator::KrylovOperator(const LinearSystem<scalar, localIdx>& sys, bool jacobi)
+    : sys_(sys), invDiag_(sys.exec(), sys.rhs().size(), 1.0)
+{
+    if (jacobi)
+    {
+        invDiag_ = inverseDiagonal(sys.matrix());
+    }
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+KrylovOperator::KrylovOperator(const DistributedLinearSystem<scalar, localIdx>& sys, bool jacobi)
+    : KrylovOperator(sys.localSystem(), jacobi)
+{
+    exchange_ = std::make_unique<InterfaceExchange>(sys);
+    comm_ = sys.mpiEnvironment().comm();
+}
+#endif
+
+void KrylovOperator::apply(const Vector<scalar>& x, Vector<scalar>& y)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    if (exchange_)
+    {
+        exchange_->start(x);
+        spmv(sys_.matrix(), x, y);
+        exchange_->finish(y);
+        return;
+    }
+#endif
+    spmv(sys_.matrix(), x, y);
+}
+
+void KrylovOperator::precondition(const Vector<scalar>& xV, Vector<scalar>& yV) const
+{
+    auto [y, x, invDiag] = views(yV, xV, invDiag_);
+    parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { y[i] = invDiag[i] * x[i]; },
+        "krylovPrecondition"
+    );
+}
+
+void KrylovOperator::startReduce([[maybe_unused]] std::span<scalar> values)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    if (exchange_)
+    {
+        mpi::iAllReduce(
+            values.data(),
+            static_cast<mpi_label_t>(values.size()),
+            mpi::ReduceOp::Sum,
+            comm_,
+            &request_
+        );
+    }
+#endif
+}
+
+void KrylovOperator::finishReduce()
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    if (exchange_)
+    {
+        mpi::wait(&request_);
+    }
+#endif
+}
+
+/* @brief computes the residual r = b - A x and the preconditioned residual u = M^-1 r
+ *
+ * r has to hold A x on entry.
+ */
+void preconditionedResidual(
+    const Vector<scalar>& bV, const Vector<scalar>& invDiagV, Vector<scalar>& rV, Vector<scalar>& uV
+)
+{
+    auto [r, u, b, invDiag] = views(rV, uV, bV, invDiagV);
+    parallelFor(
+        rV.exec(),
+        {0, rV.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            r[i] = b[i] - r[i];
+            u[i] = invDiag[i] * r[i];
+        },
+        "krylovResidual"
+    );
+}
+
+/* @brief the vectors of the pipelined CG method, see Ghysels and Vanroose, Parallel Computing
+ * 40 (2014)
+ */
+struct PipelinedCGVectors
+{
+    Vector<scalar> r, u, w, m, n, z, q, s, p;
+
+    PipelinedCGVectors(const Executor& exec, localIdx size)
+        : r(exec, size), u(exec, size), w(exec, size), m(exec, size), n(exec, size, 0.0),
+          z(exec, size, 0.0), q(exec, size, 0.0), s(exec, size, 0.0), p(exec, size, 0.0)
+    {}
+};
+
+/* @brief updates all recurrences of one pipelined CG iteration and computes the inner products
+ * (r, u), (w, u) and (r, r) of the updated vectors in a single kernel
+ *
+ * With alpha and beta zero only m = M^-1 w and the inner products are computed.
+ */
+std::array<scalar, 3> pipelinedCGUpdate(
+    scalar alpha,
+    scalar beta,
+    const Vector<scalar>& invDiagV,
+    PipelinedCGVectors& vec,
+    Vector<scalar>& xV
+)
+{
+    auto [x, r, u, w, m, z, q, s, p] =
+        views(xV, vec.r, vec.u, vec.w, vec.m, vec.z, vec.q, vec.s, vec.p);
+    const auto [n, invDiag] = views(vec.n, invDiagV);
+    std::array<scalar, 3> sums {0.0, 0.0, 0.0};
+    parallelReduce(
+        xV.exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& ru, scalar& wu, scalar& rr) {
+            z[i] = n[i] + beta * z[i];
+            q[i] = m[i] + beta * q[i];
+            s[i] = w[i] + beta * s[i];
+            p[i] = u[i] + beta * p[i];
+            x[i] += alpha * p[i];
+            r[i] -= alpha * s[i];
+            u[i] -= alpha * q[i];
+            w[i] -= alpha * z[i];
+            m[i] = invDiag[i] * w[i];
+            ru += r[i] * u[i];
+            wu += w[i] * u[i];
+            rr += r[i] * r[i];
+        },
+        sums[0],
+        sums[1],
+        sums[2],
+        "pipelinedCG::update"
+    );
+    return sums;
+}
+
+/* @brief the preconditioned pipelined CG method
+ *
+ * The sum of the inner products over the ranks is overlapped with the product n = A m, where
+ * m = M^-1 w is already computed by the fused update.
+ */
+SolverStats pipelinedCG(
+    KrylovOperator& op, Vector<scalar>& x, int maxIters, scalar relTol, scalar absTol
+)
+{
+    const auto& sys = op.localSystem();
+    PipelinedCGVectors vec(x.exec(), x.size());
+
+    // r = b - A x, u = M^-1 r and w = A u
+    op.apply(x, vec.r);
+    preconditionedResidual(sys.rhs(), op.invDiag(), vec.r, vec.u);
+    op.apply(vec.u, vec.w);
+    auto sums = pipelinedCGUpdate(0.0, 0.0, op.invDiag(), vec, x);
+
+    scalar initResNorm = 0.0;
+    scalar resNorm = 0.0;
+    scalar tol = 0.0;
+    scalar alpha = 0.0;
+    scalar gammaOld = 0.0;
+    int numIter = 0;
+    while (true)
+    {
+        op.startReduce(sums);
+        op.apply(vec.m, vec.n);
+        op.finishReduce();
+
+        const auto [gamma, delta, rr] = sums;
+        resNorm = std::sqrt(rr);
+        if (numIter == 0)
+        {
+            initResNorm = resNorm;
+            tol = std::max(absTol, relTol * initResNorm);
+        }
+        if (numIter >= maxIters || resNorm <= tol)
+        {
+            break;
+        }
+
+        const scalar beta = numIter > 0 ? gamma / gammaOld : 0.0;
+        alpha = numIter > 0 ? gamma / (delta - beta * gamma / alpha) : gamma / delta;
+        gammaOld = gamma;
+        sums = pipelinedCGUpdate(alpha, beta, op.invDiag(), vec, x);
+        numIter++;
+    }
+    return {numIter, initResNorm, resNorm, 0.0, {0.0, 0.0, 0.0, 0.0}};
+}
+
+/* @brief the vectors of the pipelined BiCGStab method, see Cools and Vanroose, Parallel
+ * Computing 65 (2017)
+ *
+ * The method is applied to A M^-1, thus w = A M^-1 r, t = A M^-1 w, s = A M^-1 p,
+ * z = A M^-1 s and v = A M^-1 z. tmp holds M^-1 of the next vector multiplied with A.
+ */
+struct PipelinedBiCGStabVectors
+{
+    Vector<scalar> r, rHat, w, t, p, s, z, v, q, y, tmp;
+
+    PipelinedBiCGStabVectors(const Executor& exec, localIdx size)
+        : r(exec, size), rHat(exec, size), w(exec, size), t(exec, size), p(exec, size, 0.0),
+          s(exec, size, 0.0), z(exec, size, 0.0), v(exec, size, 0.0), q(exec, size),
+          y(exec, size), tmp(exec, size)
+    {}
+};
+
+/* @brief updates the search directions and q = r - alpha s, y = A M^-1 q, computes tmp = M^-1 z
+ * and the inner products (q, y) and (y, y) in a single kernel
+ */
+std::array<scalar, 2> pipelinedBiCGStabDirections(
+    scalar alpha,
+    scalar beta,
+    scalar omega,
+    const Vector<scalar>& invDiagV,
+    PipelinedBiCGStabVectors& vec
+)
+{
+    auto [p, s, z, q, y, tmp] = views(vec.p, vec.s, vec.z, vec.q, vec.y, vec.tmp);
+    const auto [r, w, t, v, invDiag] = views(vec.r, vec.w, vec.t, vec.v, invDiagV);
+    std::array<scalar, 2> sums {0.0, 0.0};
+    parallelReduce(
+        vec.r.exec(),
+        {0, vec.r.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& qy, scalar& yy) {
+            p[i] = r[i] + beta * (p[i] - omega * s[i]);
+            s[i] = w[i] + beta * (s[i] - omega * z[i]);
+            z[i] = t[i] + beta * (z[i] - omega * v[i]);
+            q[i] = r[i] - alpha * s[i];
+            y[i] = w[i] - alpha * z[i];
+            tmp[i] = invDiag[i] * z[i];
+            qy += q[i] * y[i];
+            yy += y[i] * y[i];
+        },
+        sums[0],
+        sums[1],
+        "pipelinedBiCGStab::directions"
+    );
+    return sums;
+}
+
+/* @brief updates the solution, r and w, computes tmp = M^-1 w and the inner products
+ * (rHat, r), (rHat, w), (rHat, s), (rHat, z) and (r, r) in a single kernel
+ */
+std::array<scalar, 5> pipelinedBiCGStabUpdate(
+    scalar alpha,
+    scalar omega,
+    const Vector<scalar>& invDiagV,
+    PipelinedBiCGStabVectors& vec,
+    Vector<scalar>& xV
+)
+{
+    auto [x, r, w, tmp] = views(xV, vec.r, vec.w, vec.tmp);
+    const auto [rHat, t, p, s, z, v, q, y, invDiag] =
+        views(vec.rHat, vec.t, vec.p, vec.s, vec.z, vec.v, vec.q, vec.y, invDiagV);
+    std::array<scalar, 5> sums {0.0, 0.0, 0.0, 0.0, 0.0};
+    parallelReduce(
+        xV.exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(
+            const localIdx i, scalar& hr, scalar& hw, scalar& hs, scalar& hz, scalar& rr
+        ) {
+            x[i] += invDiag[i] * (alpha * p[i] + omega * q[i]);
+            r[i] = q[i] - omega * y[i];
+            w[i] = y[i] - omega * (t[i] - alpha * v[i]);
+            tmp[i] = invDiag[i] * w[i];
+            hr += rHat[i] * r[i];
+            hw += rHat[i] * w[i];
+            hs += rHat[i] * s[i];
+            hz += rHat[i] * z[i];
+            rr += r[i] * r[i];
+        },
+        sums[0],
+        sums[1],
+        sums[2],
+        sums[3],
+        sums[4],
+        "pipelinedBiCGStab::update"
+    );
+    return sums;
+}
+
+/* @brief the right preconditioned pipelined BiCGStab method
+ *
+ * The sums of both reductions of an iteration are overlapped with the products v = A M^-1 z
+ * and t = A M^-1 w respectively.
+ */
+SolverStats pipelinedBiCGStab(
+    KrylovOperator& op, Vector<scalar>& x, int maxIters, scalar relTol, scalar absTol
+)
+{
+    const auto& sys = op.localSystem();
+    PipelinedBiCGStabVectors vec(x.exec(), x.size());
+
+    // r = b - A x, w = A M^-1 r and t = A M^-1 w, the shadow residual is the initial residual
+    op.apply(x, vec.r);
+    preconditionedResidual(sys.rhs(), op.invDiag(), vec.r, vec.tmp);
+    vec.rHat = vec.r;
+    op.apply(vec.tmp, vec.w);
+    auto sums = pipelinedBiCGStabUpdate(0.0, 0.0, op.invDiag(), vec, x);
+    op.startReduce(sums);
+    op.apply(vec.tmp, vec.t);
+    op.finishReduce();
+
+    scalar rho = sums[0];
+    scalar alpha = sums[1] != 0.0 ? rho / sums[1] : 0.0;
+    scalar beta = 0.0;
+    scalar omega = 0.0;
+    const scalar initResNorm = std::sqrt(sums[4]);
+    const scalar tol = std::max(absTol, relTol * initResNorm);
+    scalar resNorm = initResNorm;
+    int numIter = 0;
+    while (numIter < maxIters && resNorm > tol)
+    {
+        auto directionSums = pipelinedBiCGStabDirections(alpha, beta, omega, op.invDiag(), vec);
+        op.startReduce(directionSums);
+        op.apply(vec.tmp, vec.v);
+        op.finishReduce();
+        const auto [qy, yy] = directionSums;
+        omega = yy > 0.0 ? qy / yy : 0.0;
+
+        sums = pipelinedBiCGStabUpdate(alpha, omega, op.invDiag(), vec, x);
+        op.startReduce(sums);
+        op.apply(vec.tmp, vec.t);
+        op.finishReduce();
+        numIter++;
+
+        const auto [hr, hw, hs, hz, rr] = sums;
+        resNorm = std::sqrt(rr);
+        if (omega == 0.0 || rho == 0.0)
+        {
+            // breakdown, the recurrences cannot be continued
+            break;
+        }
+        beta = (alpha / omega) * (hr / rho);
+        const scalar denom = hw + beta * hs - beta * omega * hz;
+        if (denom == 0.0)
+        {
+            break;
+        }
+        alpha = hr / denom;
+        rho = hr;
+    }
+    return {numIter, initResNorm, resNorm, 0.0, {0.0, 0.0, 0.0, 0.0}};
+}
+
+/* @brief sums the values over all ranks and waits for the result */
+template<std::size_t N>
+void globalSum(KrylovOperator& op, std::array<scalar, N>& values)
+{
+    op.startReduce(values);
+    op.finishReduce();
+}
+
+/* @brief computes the inner product of a and b over all ranks */
+scalar globalDot(KrylovOperator& op, const Vector<scalar>& aV, const Vector<scalar>& bV)
+{
+    std::array<scalar, 1> sums {dot(aV, bV)};
+    globalSum(op, sums);
+    return sums[0];
+}
+
+/* @brief the vectors of the preconditioned CG method */
+struct CGVectors
+{
+    Vector<scalar> r, z, p, q;
+
+    CGVectors(const Executor& exec, localIdx size)
+        : r(exec, size), z(exec, size), p(exec, size, 0.0), q(exec, size, 0.0)
+    {}
+};
+
+/* @brief computes x += alpha p, r -= alpha q, z = M^-1 r and the inner products (r, z) and
+ * (r, r) of the updated vectors in a single kernel
+ */
+std::array<scalar, 2>
+cgUpdate(scalar alpha, const Vector<scalar>& invDiagV, CGVectors& vec, Vector<scalar>& xV)
+{
+    auto [x, r, z] = views(xV, vec.r, vec.z);
+    const auto [p, q, invDiag] = views(vec.p, vec.q, invDiagV);
+    std::array<scalar, 2> sums {0.0, 0.0};
+    parallelReduce(
+        xV.exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& rz, scalar& rr) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+            z[i] = invDiag[i] * r[i];
+            rz += r[i] * z[i];
+            rr += r[i] * r[i];
+        },
+        sums[0],
+        sums[1],
+        "CG::update"
+    );
+    return sums;
+}
+
+/* @brief computes the search direction p = z + beta p */
+void cgDirection(scalar beta, CGVectors& vec) { axpby(1.0, vec.z, beta, vec.p); }
+
+/* @brief the preconditioned CG method
+ *
+ * The update of the solution and the residual, the preconditioner and both inner products of the
+ * residual are fused into one kernel, so an iteration runs the product with the matrix, the
+ * product (p, A p), the fused update and the update of the search direction.
+ */
+SolverStats conjugateGradient(
+    KrylovOperator& op, Vector<scalar>& x, int maxIters, scalar relTol, scalar absTol
+)
+{
+    CGVectors vec(x.exec(), x.size());
+
+    // r = b - A x, the update with alpha zero only computes z and the inner products
+    op.apply(x, vec.r);
+    preconditionedResidual(op.localSystem().rhs(), op.invDiag(), vec.r, vec.z);
+    auto sums = cgUpdate(0.0, op.invDiag(), vec, x);
+    globalSum(op, sums);
+
+    scalar rz = sums[0];
+    const scalar initResNorm = std::sqrt(sums[1]);
+    const scalar tol = std::max(absTol, relTol * initResNorm);
+    scalar resNorm = initResNorm;
+    scalar rzOld = 0.0;
+    int numIter = 0;
+    while (numIter < maxIters && resNorm > tol)
+    {
+        cgDirection(numIter > 0 ? rz / rzOld : 0.0, vec);
+        op.apply(vec.p, vec.q);
+        const scalar pq = globalDot(op, vec.p, vec.q);
+        if (pq == 0.0)
+        {
+            break;
+        }
+
+        sums = cgUpdate(rz / pq, op.invDiag(), vec, x);
+        globalSum(op, sums);
+        rzOld = rz;
+        rz = sums[0];
+        resNorm = std::sqrt(sums[1]);
+        numIter++;
+    }
+    return {numIter, initResNorm, resNorm, 0.0, {0.0, 0.0, 0.0, 0.0}};
+}
+
+/* @brief the vectors of the right preconditioned BiCGStab method, pHat = M^-1 p and
+ * sHat = M^-1 s
+ */
+struct BiCGStabVectors
+{
+    Vector<scalar> r, rHat, p, pHat, v, s, sHat, t;
+
+    BiCGStabVectors(const Executor& exec, localIdx size)
+        : r(exec, size), rHat(exec, size), p(exec, size), pHat(exec, size), v(exec, size),
+          s(exec, size), sHat(exec, size), t(exec, size, 0.0)
+    {}
+};
+
+/* @brief computes s = r - alpha v, sHat = M^-1 s and (s, s) in a single kernel */
+std::array<scalar, 1>
+biCGStabIntermediate(scalar alpha, const Vector<scalar>& invDiagV, BiCGStabVectors& vec)
+{
+    auto [s, sHat] = views(vec.s, vec.sHat);
+    const auto [r, v, invDiag] = views(vec.r, vec.v, invDiagV);
+    std::array<scalar, 1> sums {0.0};
+    parallelReduce(
+        vec.s.exec(),
+        {0, vec.s.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& ss) {
+            s[i] = r[i] - alpha * v[i];
+            sHat[i] = invDiag[i] * s[i];
+            ss += s[i] * s[i];
+        },
+        sums[0],
+        "BiCGStab::intermediate"
+    );
+    return sums;
+}
+
+/* @brief computes the inner products (t, s) and (t, t) in a single kernel */
+std::array<scalar, 2> biCGStabStabilization(BiCGStabVectors& vec)
+{
+    const auto [s, t] = views(vec.s, vec.t);
+    std::array<scalar, 2> sums {0.0, 0.0};
+    parallelReduce(
+        vec.s.exec(),
+        {0, vec.s.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& ts, scalar& tt) {
+            ts += t[i] * s[i];
+            tt += t[i] * t[i];
+        },
+        sums[0],
+        sums[1],
+        "BiCGStab::stabilization"
+    );
+    return sums;
+}
+
+/* @brief computes x += alpha pHat + omega sHat, r = s - omega t and the inner products
+ * (rHat, r) and (r, r) in a single kernel
+ */
+std::array<scalar, 2>
+biCGStabUpdate(scalar alpha, scalar omega, BiCGStabVectors& vec, Vector<scalar>& xV)
+{
+    auto [x, r] = views(xV, vec.r);
+    const auto [rHat, pHat, s, sHat, t] = views(vec.rHat, vec.pHat, vec.s, vec.sHat, vec.t);
+    std::array<scalar, 2> sums {0.0, 0.0};
+    parallelReduce(
+        xV.exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& hr, scalar& rr) {
+            x[i] += alpha * pHat[i] + omega * sHat[i];
+            r[i] = s[i] - omega * t[i];
+            hr += rHat[i] * r[i];
+            rr += r[i] * r[i];
+        },
+        sums[0],
+        sums[1],
+        "BiCGStab::update"
+    );
+    return sums;
+}
+
+/* @brief computes the search direction p = r + beta (p - omega v) and pHat = M^-1 p */
+void biCGStabDirection(
+    scalar beta, scalar omega, const Vector<scalar>& invDiagV, BiCGStabVectors& vec
+)
+{
+    auto [p, pHat] = views(vec.p, vec.pHat);
+    const auto [r, v, invDiag] = views(vec.r, vec.v, invDiagV);
+    parallelFor(
+        vec.p.exec(),
+        {0, vec.p.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            pHat[i] = invDiag[i] * p[i];
+        },
+        "biCGStabDirection"
+    );
+}
+
+/* @brief the right preconditioned BiCGStab method
+ *
+ * The preconditioner is fused into the vector updates and every update computes the inner
+ * products of its results, which leaves three reductions per iteration.
+ */
+SolverStats biCGStab(
+    KrylovOperator& op, Vector<scalar>& x, int maxIters, scalar relTol, scalar absTol
+)
+{
+    BiCGStabVectors vec(x.exec(), x.size());
+
+    // r = b - A x, the shadow residual and the first search direction are the initial residual
+    op.apply(x, vec.r);
+    preconditionedResidual(op.localSystem().rhs(), op.invDiag(), vec.r, vec.pHat);
+    vec.rHat = vec.r;
+    vec.p = vec.r;
+
+    scalar rho = globalDot(op, vec.r, vec.r);
+    const scalar initResNorm = std::sqrt(rho);
+    const scalar tol = std::max(absTol, relTol * initResNorm);
+    scalar resNorm = initResNorm;
+    int numIter = 0;
+    while (numIter < maxIters && resNorm > tol)
+    {
+        op.apply(vec.pHat, vec.v);
+        const scalar hv = globalDot(op, vec.rHat, vec.v);
+        if (hv == 0.0)
+        {
+            break;
+        }
+        const scalar alpha = rho / hv;
+
+        auto intermediateSums = biCGStabIntermediate(alpha, op.invDiag(), vec);
+        globalSum(op, intermediateSums);
+        scalar omega = 0.0;
+        if (std::sqrt(intermediateSums[0]) > tol)
+        {
+            op.apply(vec.sHat, vec.t);
+            auto stabilizationSums = biCGStabStabilization(vec);
+            globalSum(op, stabilizationSums);
+            const auto [ts, tt] = stabilizationSums;
+            omega = tt > 0.0 ? ts / tt : 0.0;
+        }
+
+        // with omega zero, ie. a converged intermediate residual, r = s
+        auto sums = biCGStabUpdate(alpha, omega, vec, x);
+        globalSum(op, sums);
+        numIter++;
+        const auto [hr, rr] = sums;
+        resNorm = std::sqrt(rr);
+        if (omega == 0.0 || rho == 0.0)
+        {
+            break;
+        }
+
+        biCGStabDirection((hr / rho) * (alpha / omega), omega, op.invDiag(), vec);
+        rho = hr;
+    }
+    return {numIter, initResNorm, resNorm, 0.0, {0.0, 0.0, 0.0, 0.0}};
+}
+
+/* @brief computes b - r, where r holds A x, in place and its squared norm in a single kernel */
+std::array<scalar, 1> residualNorm(const Vector<scalar>& bV, Vector<scalar>& rV)
+{
+    auto r = rV.view();
+    const auto b = bV.view();
+    std::array<scalar, 1> sums {0.0};
+    parallelReduce(
+        rV.exec(),
+        {0, rV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& rr) {
+            r[i] = b[i] - r[i];
+            rr += r[i] * r[i];
+        },
+        sums[0],
+        "krylov::residualNorm"
+    );
+    return sums;
+}
+
+/* @brief scales v by factor and computes z = M^-1 v in a single kernel */
+void scaleAndPrecondition(
+    scalar factor, const Vector<scalar>& invDiagV, Vector<scalar>& vV, Vector<scalar>& zV
+)
+{
+    auto [v, z] = views(vV, zV);
+    const auto invDiag = invDiagV.view();
+    parallelFor(
+        vV.exec(),
+        {0, vV.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            v[i] *= factor;
+            z[i] = invDiag[i] * v[i];
+        },
+        "gmresScaleAndPrecondition"
+    );
+}
+
+/* @brief one modified Gram-Schmidt step w -= h v fused with the inner product of the updated w
+ * with next, or with w itself if next is a nullptr
+ */
+std::array<scalar, 1> gramSchmidtStep(
+    scalar h, const Vector<scalar>& vV, const Vector<scalar>* nextV, Vector<scalar>& wV
+)
+{
+    return {axpbyDot(-h, vV, 1.0, wV, nextV == nullptr ? wV : *nextV)};
+}
+
+/* @brief adds M^-1 sum_j y_j v_j to x */
+void gmresCorrection(
+    const std::vector<scalar>& y,
+    const std::vector<Vector<scalar>>& basis,
+    const Vector<scalar>& invDiagV,
+    Vector<scalar>& tmpV,
+    Vector<scalar>& xV
+)
+{
+    // the basis vectors are combined two per pass
+    const auto nBasis = y.size();
+    if (nBasis == 0)
+    {
+        return;
+    }
+    const std::size_t first = nBasis % 2 == 0 ? 2 : 1;
+    waxpby(tmpV, y[0], basis[0], first == 2 ? y[1] : 0.0, basis[first - 1]);
+    for (std::size_t j = first; j < nBasis; j += 2)
+    {
+        axpbypcz(y[j], basis[j], y[j + 1], basis[j + 1], 1.0, tmpV);
+    }
+    auto x = xV.view();
+    const auto [tmp, invDiag] = views(tmpV, invDiagV);
+    parallelFor(
+        xV.exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { x[i] += invDiag[i] * tmp[i]; },
+        "gmresCorrection"
+    );
+}
+
+/* @brief the restarted and right preconditioned GMRES method
+ *
+ * The orthogonalization by modified Gram-Schmidt fuses every projection with the inner product
+ * required by the next projection, and the last one with the norm of the new basis vector. The
+ * small least squares problem is solved with Givens rotations on the host.
+ */
+SolverStats gmres(
+    KrylovOperator& op,
+    Vector<scalar>& x,
+    int maxIters,
+    int restart,
+    scalar relTol,
+    scalar absTol
+)
+{
+    const auto m = static_cast<std::size_t>(restart);
+    std::vector<Vector<scalar>> basis(m + 1, Vector<scalar>(x.exec(), x.size()));
+    Vector<scalar> z(x.exec(), x.size());
+    std::vector<std::vector<scalar>> hessenberg(m + 1, std::vector<scalar>(m, 0.0));
+    std::vector<scalar> cs(m, 0.0);
+    std::vector<scalar> sn(m, 0.0);
+    std::vector<scalar> g(m + 1, 0.0);
+
+    scalar initResNorm = 0.0;
+    scalar resNorm = 0.0;
+    scalar tol = 0.0;
+    int numIter = 0;
+    while (true)
+    {
+        // the true residual at every restart
+        op.apply(x, basis[0]);
+        auto sums = residualNorm(op.localSystem().rhs(), basis[0]);
+        globalSum(op, sums);
+        resNorm = std::sqrt(sums[0]);
+        if (numIter == 0)
+        {
+            initResNorm = resNorm;
+            tol = std::max(absTol, relTol * initResNorm);
+        }
+        if (numIter >= maxIters || resNorm <= tol)
+        {
+            break;
+        }
+
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = resNorm;
+        scaleAndPrecondition(1.0 / resNorm, op.invDiag(), basis[0], z);
+        std::size_t k = 0;
+        while (k < m && numIter < maxIters && resNorm > tol)
+        {
+            auto& w = basis[k + 1];
+            op.apply(z, w);
+
+            // a projection with h zero computes (w, v_0)
+            auto product = gramSchmidtStep(0.0, basis[0], &basis[0], w);
+            globalSum(op, product);
+            for (std::size_t i = 0; i <= k; i++)
+            {
+                hessenberg[i][k] = product[0];
+                product = gramSchmidtStep(
+                    hessenberg[i][k], basis[i], i < k ? &basis[i + 1] : nullptr, w
+                );
+                globalSum(op, product);
+            }
+            const scalar hNext = std::sqrt(product[0]);
+
+            // apply the previous rotations and eliminate the subdiagonal entry
+            for (std::size_t i = 0; i < k; i++)
+            {
+                const scalar tmp = cs[i] * hessenberg[i][k] + sn[i] * hessenberg[i + 1][k];
+                hessenberg[i + 1][k] = -sn[i] * hessenberg[i][k] + cs[i] * hessenberg[i + 1][k];
+                hessenberg[i][k] = tmp;
+            }
+            const scalar denom = std::hypot(hessenberg[k][k], hNext);
+            cs[k] = denom > 0.0 ? hessenberg[k][k] / denom : 1.0;
+            sn[k] = denom > 0.0 ? hNext / denom : 0.0;
+            hessenberg[k][k] = denom;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+            resNorm = std::abs(g[k + 1]);
+            numIter++;
+            k++;
+
+            if (hNext == 0.0)
+            {
+                // lucky breakdown, the solution lies in the current space
+                break;
+            }
+            scaleAndPrecondition(1.0 / hNext, op.invDiag(), w, z);
+        }
+
+        // solve the triangular system of the rotated Hessenberg matrix
+        std::vector<scalar> y(k, 0.0);
+        for (std::size_t i = k; i-- > 0;)
+        {
+            scalar sum = g[i];
+            for (std::size_t j = i + 1; j < k; j++)
+            {
+                sum -= hessenberg[i][j] * y[j];
+            }
+            y[i] = hessenberg[i][i] != 0.0 ? sum / hessenberg[i][i] : 0.0;
+        }
+        gmresCorrection(y, basis, op.invDiag(), z, x);
+    }
+    return {numIter, initResNorm, resNorm, 0.0, {0.0, 0.0, 0.0, 0.0}};
+}
+
+/* @brief the method selected by the method key of the solver dictionary */
+KrylovMethod readMethod(const Dictionary& dict)
+{
+    const auto method = readOption<std::string>(dict, "method", "pipelinedCG");
+    if (method == "cg")
+    {
+        return KrylovMethod::CG;
+    }
+    if (method == "biCGStab")
+    {
+        return KrylovMethod::BiCGStab;
+    }
+    if (method == "gmres")
+    {
+        return KrylovMethod::GMRES;
+    }
+    if (method == "pipelinedBiCGStab")
+    {
+        return KrylovMethod::PipelinedBiCGStab;
+    }
+    if (method != "pipelinedCG")
+    {
+        NF_ERROR_EXIT(
+            "Unknown method " + method
+            + ", expected cg, biCGStab, gmres, pipelinedCG or pipelinedBiCGStab."
+        );
+    }
+    return KrylovMethod::PipelinedCG;
+}
+
+Krylov::Krylov(const Executor& exec, const Dictionary& solverConfig)
+    : Base(exec), method_(readMethod(solverConfig)),
+      jacobi_(readOption<std::string>(solverConfig, "preconditioner", "jacobi") == "jacobi"),
+      maxIters_(readOption<int>(solverConfig, "maxIters", 1000)),
+      restart_(readOption<int>(solverConfig, "restart", 30)),
+      relTol_(readOption<scalar>(solverConfig, "relTol", 1e-6)),
+      absTol_(readOption<scalar>(solverConfig, "absTol", 0.0))
+{
+    const auto preconditioner = readOption<std::string>(solverConfig, "preconditioner", "jacobi");
+    if (preconditioner != "jacobi" && preconditioner != "none")
+    {
+        NF_ERROR_EXIT("Unknown preconditioner " + preconditioner + ", expected jacobi or none.");
+    }
+    NF_ASSERT(maxIters_ > 0, "maxIters needs to be larger than zero");
+    NF_ASSERT(restart_ > 0, "restart needs to be larger than zero");
+}
+
+SolverStats Krylov::iterate(KrylovOperator& op, Vector<scalar>& x, PhaseTimer& timer) const
+{
+    // the construction of the operator computes the inverse diagonal and sets up the messages
+    fence(x.exec());
+    const scalar setupTime = timer.lap();
+    SolverStats stats {0, 0.0, 0.0, 0.0, {0.0, 0.0, 0.0, 0.0}};
+    switch (method_)
+    {
+    case KrylovMethod::CG:
+        stats = conjugateGradient(op, x, maxIters_, relTol_, absTol_);
+        break;
+    case KrylovMethod::BiCGStab:
+        stats = biCGStab(op, x, maxIters_, relTol_, absTol_);
+        break;
+    case KrylovMethod::GMRES:
+        stats = gmres(op, x, maxIters_, restart_, relTol_, absTol_);
+        break;
+    case KrylovMethod::PipelinedCG:
+        stats = pipelinedCG(op, x, maxIters_, relTol_, absTol_);
+        break;
+    case KrylovMethod::PipelinedBiCGStab:
+        stats = pipelinedBiCGStab(op, x, maxIters_, relTol_, absTol_);
+        break;
+    }
+    stats.timings = {setupTime, 0.0, timer.lap(), 0.0};
+    stats.solveTime = timer.total();
+    return stats;
+}
+
+SolverStats Krylov::solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
+{
+    NF_ASSERT(sys.matrix().exec() == x.exec(), "Executors are not the same");
+    PhaseTimer timer;
+    KrylovOperator op(sys, jacobi_);
+    return iterate(op, x, timer);
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+SolverStats
+Krylov::solve(const DistributedLinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
+{
+    NF_ASSERT(sys.exec() == x.exec(), "Executors are not the same");
+    NF_ASSERT_EQUAL(x.size(), sys.numbering().nLocalRows());
+    PhaseTimer timer;
+    KrylovOperator op(sys, jacobi_);
+    return iterate(op, x, timer);
+}
+#endif
+
+}
@@ -0,0 +1,590 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/multigrid.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+
+namespace NeoN::la
+{
+
+template<typename T>
+static T readOption(const Dictionary& dict, const std::string& key, T defaultValue)
+{
+    return dict.contains(key) ? dict.get<T>(key) : defaultValue;
+}
+
+MultigridSettings MultigridSettings::read(const Dictionary& dict)
+{
+    MultigridSettings settings;
+    settings.maxLevels = static_cast<localIdx>(readOption<int>(dict, "maxLevels", 25));
+    settings.maxCoarseRows = static_cast<localIdx>(readOption<int>(dict, "maxCoarseRows", 16));
+    settings.preSweeps = readOption<int>(dict, "preSweeps", settings.preSweeps);
+    settings.postSweeps = readOption<int>(dict, "postSweeps", settings.postSweeps);
+    settings.coarsestSweeps = readOption<int>(dict, "coarsestSweeps", settings.coarsestSweeps);
+    settings.relaxation = readOption<scalar>(dict, "relaxation", settings.relaxation);
+    const auto smoother = readOption<std::string>(dict, "smoother", "jacobi");
+    if (smoother == "gaussSeidel")
+    {
+        settings.smoother = MultigridSmoother::GaussSeidel;
+    }
+    else if (smoother == "symmetricGaussSeidel")
+    {
+        settings.smoother = MultigridSmoother::SymmetricGaussSeidel;
+    }
+    else if (smoother != "jacobi")
+    {
+        NF_ERROR_EXIT(
+            "Unknown smoother " + smoother
+            + ", expected jacobi, gaussSeidel or symmetricGaussSeidel."
+        );
+    }
+    NF_ASSERT(settings.maxLevels > 0, "maxLevels needs to be larger than zero");
+    NF_ASSERT(settings.relaxation > 0.0, "relaxation needs to be positive");
+    return settings;
+}
+
+/* @brief creates the level of a matrix given on the host, the values are set by refresh
+ *
+ * @param colored, whether the rows are colored for the Gauss-Seidel smoother
+ */
+MultigridLevel
+createLevel(const Executor& exec, const CSRMatrix<scalar, localIdx>& hostMtx, bool colored)
+{
+    const auto nRows = static_cast<std::size_t>(hostMtx.nRows());
+    const auto [values, colIdxs, rowOffs] = hostMtx.view();
+    std::vector<localIdx> diagIdxs(nRows);
+    for (std::size_t rowi = 0; rowi < nRows; rowi++)
+    {
+        auto k = rowOffs[rowi];
+        while (k < rowOffs[rowi + 1] && static_cast<std::size_t>(colIdxs[k]) != rowi)
+        {
+            k++;
+        }
+        NF_ASSERT(k < rowOffs[rowi + 1], "Multigrid requires a diagonal entry in every row");
+        diagIdxs[rowi] = k;
+    }
+    const auto size = hostMtx.nRows();
+    auto coloring = colored ? createColoring(hostMtx)
+                            : MatrixColoring {Vector<localIdx>(SerialExecutor {}, 0), {0}};
+    return MultigridLevel {
+        CSRMatrix<scalar, localIdx>(
+            hostMtx.values().copyToExecutor(exec),
+            hostMtx.colIdxs().copyToExecutor(exec),
+            hostMtx.rowOffs().copyToExecutor(exec)
+        ),
+        Vector<localIdx>(exec, diagIdxs),
+        Vector<scalar>(exec, size, 0.0),
+        Vector<localIdx>(exec, 0),
+        SegmentedVector<localIdx, localIdx>(exec, 0, 0),
+        SegmentedVector<localIdx, localIdx>(exec, 0, 0),
+        Vector<scalar>(exec, size, 0.0),
+        Vector<scalar>(exec, size, 0.0),
+        Vector<scalar>(exec, size, 0.0),
+        MatrixColoring {coloring.rows.copyToExecutor(exec), coloring.offsets}
+    };
+}
+
+/* @brief groups the indices 0 to group.size() by their group
+ *
+ * @return the values and segments of a segmented vector holding the indices of every group
+ */
+static std::pair<std::vector<localIdx>, std::vector<localIdx>>
+groupIndices(const std::vector<localIdx>& group, std::size_t nGroups)
+{
+    std::vector<localIdx> segments(nGroups + 1, 0);
+    for (auto groupi : group)
+    {
+        segments[static_cast<std::size_t>(groupi) + 1]++;
+    }
+    std::partial_sum(segments.begin(), segments.end(), segments.begin());
+    std::vector<localIdx> values(group.size());
+    std::vector<localIdx> next(segments.begin(), segments.end() - 1);
+    for (std::size_t i = 0; i < group.size(); i++)
+    {
+        values[static_cast<std::size_t>(next[static_cast<std::size_t>(group[i])]++)] =
+            static_cast<localIdx>(i);
+    }
+    return {values, segments};
+}
+
+/* @brief sets up the transfer of the level to the aggregates of its rows
+ *
+ * @return the sparsity pattern of the coarse operator on the host with zero values
+ */
+CSRMatrix<scalar, localIdx> coarsen(
+    const Executor& exec,
+    const CSRMatrix<scalar, localIdx>& hostMtx,
+    const std::vector<localIdx>& aggregates,
+    MultigridLevel& level
+)
+{
+    const auto nRows = static_cast<std::size_t>(hostMtx.nRows());
+    const auto nCoarse =
+        static_cast<std::size_t>(*std::max_element(aggregates.begin(), aggregates.end())) + 1;
+    const auto [values, colIdxs, rowOffs] = hostMtx.view();
+
+    auto [rows, rowSegments] = groupIndices(aggregates, nCoarse);
+
+    // the coarse columns of a coarse row are the aggregates of the columns of its rows
+    std::vector<localIdx> coarseRowOffs(nCoarse + 1, 0);
+    std::vector<columnIdx> coarseColIdxs;
+    for (std::size_t coarsei = 0; coarsei < nCoarse; coarsei++)
+    {
+        const auto begin = coarseColIdxs.size();
+        for (auto j = rowSegments[coarsei]; j < rowSegments[coarsei + 1]; j++)
+        {
+            const auto rowi = static_cast<std::size_t>(rows[static_cast<std::size_t>(j)]);
+            for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+            {
+                coarseColIdxs.push_back(
+                    static_cast<columnIdx>(aggregates[static_cast<std::size_t>(colIdxs[k])])
+                );
+            }
+        }
+        auto first = coarseColIdxs.begin() + static_cast<std::ptrdiff_t>(begin);
+        std::sort(first, coarseColIdxs.end());
+        coarseColIdxs.erase(std::unique(first, coarseColIdxs.end()), coarseColIdxs.end());
+        coarseRowOffs[coarsei + 1] = static_cast<localIdx>(coarseColIdxs.size());
+    }
+
+    // every entry of the level is added to the coarse entry coupling the aggregates of its row
+    // and column
+    std::vector<localIdx> coarseEntry(static_cast<std::size_t>(hostMtx.nNonZeros()));
+    for (std::size_t rowi = 0; rowi < nRows; rowi++)
+    {
+        const auto coarsei = static_cast<std::size_t>(aggregates[rowi]);
+        const auto first = coarseColIdxs.begin() + coarseRowOffs[coarsei];
+        const auto last = coarseColIdxs.begin() + coarseRowOffs[coarsei + 1];
+        for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+        {
+            const auto coarsej =
+                static_cast<columnIdx>(aggregates[static_cast<std::size_t>(colIdxs[k])]);
+            coarseEntry[static_cast<std::size_t>(k)] =
+                static_cast<localIdx>(std::lower_bound(first, last, coarsej) - first)
+                + coarseRowOffs[coarsei];
+        }
+    }
+    auto [entries, entrySegments] = groupIndices(coarseEntry, coarseColIdxs.size());
+
+    level.aggregates = Vector<localIdx>(exec, aggregates);
+    level.aggregateRows = SegmentedVector<localIdx, localIdx>(
+        Vector<localIdx>(exec, rows), Vector<localIdx>(exec, rowSegments)
+    );
+    level.coarseEntries = SegmentedVector<localIdx, localIdx>(
+        Vector<localIdx>(exec, entries), Vector<localIdx>(exec, entrySegments)
+    );
+
+    const auto nCoarseEntries = static_cast<localIdx>(coarseColIdxs.size());
+    return CSRMatrix<scalar, localIdx>(
+        Vector<scalar>(SerialExecutor {}, nCoarseEntries, 0.0),
+        Vector<columnIdx>(SerialExecutor {}, coarseColIdxs),
+        Vector<localIdx>(SerialExecutor {}, coarseRowOffs)
+    );
+}
+
+/* @brief sums the entries of the fine operator per coarse entry, ie. R A P */
+void galerkinProduct(
+    const SegmentedVector<localIdx, localIdx>& coarseEntries,
+    const Vector<scalar>& fineValues,
+    Vector<scalar>& coarseValuesV
+)
+{
+    const auto fine = fineValues.view();
+    auto coarseValues = coarseValuesV.view();
+    const SegmentedVectorView<const localIdx, const localIdx> entries {
+        coarseEntries.values().view(), coarseEntries.segments().view()
+    };
+    const auto entryIdxs = entries.values;
+    NeoN::parallelReduce<scalar>(
+        coarseValuesV.exec(),
+        entries,
+        KOKKOS_LAMBDA(const localIdx, const localIdx k, scalar& sum) {
+            sum += fine[entryIdxs[k]];
+        },
+        KOKKOS_LAMBDA(const localIdx coarsei, const scalar sum) { coarseValues[coarsei] = sum; },
+        "multigridGalerkinProduct"
+    );
+}
+
+/* @brief computes the inverse diagonal of the level, rows with a zero diagonal are skipped */
+void invertDiagonal(MultigridLevel& level)
+{
+    auto [invDiag, diagIdxs, values] =
+        views(level.invDiag, level.diagIdxs, level.matrix.values());
+    parallelFor(
+        level.invDiag.exec(),
+        {0, level.invDiag.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            const auto diag = values[diagIdxs[rowi]];
+            invDiag[rowi] = diag != 0.0 ? 1.0 / diag : 0.0;
+        },
+        "multigridInvertDiagonal"
+    );
+}
+
+/* @brief applies damped Jacobi sweeps x -= omega D^-1 (A x - rhs) */
+void jacobiSmooth(
+    MultigridLevel& level, const Vector<scalar>& rhs, Vector<scalar>& xV, int sweeps, scalar omega
+)
+{
+    for (int sweep = 0; sweep < sweeps; sweep++)
+    {
+        computeResidual(level.matrix, rhs, xV, level.res);
+        auto [x, res, invDiag] = views(xV, level.res, level.invDiag);
+        parallelFor(
+            xV.exec(),
+            {0, xV.size()},
+            KOKKOS_LAMBDA(const localIdx rowi) { x[rowi] -= omega * invDiag[rowi] * res[rowi]; },
+            "multigridJacobiSmooth"
+        );
+    }
+}
+
+/* @brief restricts the negated residual A x - rhs to the aggregates */
+void restrictResidual(
+    const SegmentedVector<localIdx, localIdx>& aggregateRows,
+    const Vector<scalar>& resV,
+    Vector<scalar>& coarseRhsV
+)
+{
+    const auto res = resV.view();
+    auto coarseRhs = coarseRhsV.view();
+    const SegmentedVectorView<const localIdx, const localIdx> rows {
+        aggregateRows.values().view(), aggregateRows.segments().view()
+    };
+    const auto rowIdxs = rows.values;
+    NeoN::parallelReduce<scalar>(
+        coarseRhsV.exec(),
+        rows,
+        KOKKOS_LAMBDA(const localIdx, const localIdx j, scalar& sum) { sum -= res[rowIdxs[j]]; },
+        KOKKOS_LAMBDA(const localIdx coarsei, const scalar sum) { coarseRhs[coarsei] = sum; },
+        "multigridRestrict"
+    );
+}
+
+/* @brief adds the coarse grid correction of its aggregate to every row */
+void prolongate(
+    const Vector<localIdx>& aggregatesV, const Vector<scalar>& coarseXV, Vector<scalar>& xV
+)
+{
+    auto [x, coarseX, aggregates] = views(xV, coarseXV, aggregatesV);
+    parallelFor(
+        xV.exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) { x[rowi] += coarseX[aggregates[rowi]]; },
+        "multigridProlongate"
+    );
+}
+
+/* @brief counts the entries in which two vectors of the same size differ */
+template<typename ValueType>
+localIdx countDifferences(const Vector<ValueType>& aV, const Vector<ValueType>& bV)
+{
+    const auto [a, b] = views(aV, bV);
+    localIdx nDifferences = 0;
+    parallelReduce(
+        aV.exec(),
+        aV.range(),
+        KOKKOS_LAMBDA(const localIdx i, localIdx& sum) { sum += a[i] != b[i] ? 1 : 0; },
+        Kokkos::Sum<localIdx>(nDifferences),
+        "multigridCountDifferences"
+    );
+    return nDifferences;
+}
+
+MultigridHierarchy::MultigridHierarchy(
+    const CSRMatrix<scalar, localIdx>& mtx, const MultigridSettings& settings
+)
+    : settings_(settings), levels_()
+{
+    build(
+        mtx,
+        [](std::size_t, const CSRMatrix<scalar, localIdx>& hostMtx)
+        {
+            const auto [values, colIdxs, rowOffs] = hostMtx.view();
+            std::vector<scalar> weights(values.size());
+            std::transform(
+                values.begin(), values.end(), weights.begin(), [](scalar v) { return std::abs(v); }
+            );
+            return pairwiseAggregation(
+                std::vector<localIdx>(rowOffs.begin(), rowOffs.end()),
+                std::vector<localIdx>(colIdxs.begin(), colIdxs.end()),
+                weights
+            );
+        }
+    );
+}
+
+MultigridHierarchy::MultigridHierarchy(
+    const CSRMatrix<scalar, localIdx>& mtx,
+    const FaceAgglomeration& agglomeration,
+    const MultigridSettings& settings
+)
+    : settings_(settings), levels_()
+{
+    build(
+        mtx,
+        [&](std::size_t leveli, const CSRMatrix<scalar, localIdx>&)
+        {
+            const auto nAgglomerationLevels = static_cast<std::size_t>(agglomeration.nLevels());
+            return leveli < nAgglomerationLevels
+                     ? agglomeration.aggregates(static_cast<localIdx>(leveli))
+                     : std::vector<localIdx> {};
+        }
+    );
+}
+
+void MultigridHierarchy::build(
+    const CSRMatrix<scalar, localIdx>& mtx, const Aggregation& aggregation
+)
+{
+    const auto exec = mtx.exec();
+    const bool colored = settings_.smoother != MultigridSmoother::Jacobi;
+    auto hostMtx = CSRMatrix<scalar, localIdx>(
+        mtx.values().copyToHost(), mtx.colIdxs().copyToHost(), mtx.rowOffs().copyToHost()
+    );
+    for (std::size_t leveli = 0;; leveli++)
+    {
+        levels_.push_back(createLevel(exec, hostMtx, colored));
+        const auto nRows = hostMtx.nRows();
+        if (nLevels() >= settings_.maxLevels || nRows <= settings_.maxCoarseRows)
+        {
+            break;
+        }
+        const auto aggregates = aggregation(leveli, hostMtx);
+        if (aggregates.empty())
+        {
+            break;
+        }
+        NF_ASSERT(
+            aggregates.size() == static_cast<std::size_t>(nRows),
+            "The aggregates do not match the rows of the multigrid level"
+        );
+        const auto nCoarse = *std::max_element(aggregates.begin(), aggregates.end()) + 1;
+        if (nCoarse == nRows)
+        {
+            // the rows are decoupled, further levels would not reduce the size
+            break;
+        }
+        hostMtx = coarsen(exec, hostMtx, aggregates, levels_.back());
+    }
+    colIdxsVersion_ = mtx.colIdxs().version();
+    rowOffsVersion_ = mtx.rowOffs().version();
+    refresh(mtx);
+}
+
+bool MultigridHierarchy::matches(const CSRMatrix<scalar, localIdx>& mtx) const
+{
+    const auto& finest = levels_.front().matrix;
+    if (mtx.exec() != finest.exec() || mtx.nRows() != finest.nRows()
+        || mtx.nNonZeros() != finest.nNonZeros())
+    {
+        return false;
+    }
+    const auto colIdxsVersion = mtx.colIdxs().version();
+    const auto rowOffsVersion = mtx.rowOffs().version();
+    if (colIdxsVersion == colIdxsVersion_ && rowOffsVersion == rowOffsVersion_)
+    {
+        return true;
+    }
+    if (countDifferences(mtx.rowOffs(), finest.rowOffs()) != 0
+        || countDifferences(mtx.colIdxs(), finest.colIdxs()) != 0)
+    {
+        return false;
+    }
+    colIdxsVersion_ = colIdxsVersion;
+    rowOffsVersion_ = rowOffsVersion;
+    return true;
+}
+
+void MultigridHierarchy::refresh(const CSRMatrix<scalar, localIdx>& mtx)
+{
+    NF_ASSERT(matches(mtx), "The matrix does not match the multigrid hierarchy");
+    levels_.front().matrix.values() = mtx.values();
+    for (std::size_t leveli = 0; leveli + 1 < levels_.size(); leveli++)
+    {
+        galerkinProduct(
+            levels_[leveli].coarseEntries,
+            levels_[leveli].matrix.values(),
+            levels_[leveli + 1].matrix.values()
+        );
+    }
+    for (auto& level : levels_)
+    {
+        invertDiagonal(level);
+    }
+}
+
+void MultigridHierarchy::apply(const Vector<scalar>& rhs, Vector<scalar>& x)
+{
+    cycle(0, rhs, x);
+}
+
+void MultigridHierarchy::cycle(std::size_t leveli, const Vector<scalar>& rhs, Vector<scalar>& x)
+{
+    auto& level = levels_[leveli];
+    fill(x, 0.0);
+    if (leveli + 1 == levels_.size())
+    {
+        smooth(level, rhs, x, settings_.coarsestSweeps, SweepDirection::Symmetric);
+        return;
+    }
+    smooth(level, rhs, x, settings_.preSweeps, SweepDirection::Forward);
+    computeResidual(level.matrix, rhs, x, level.res);
+    auto& coarse = levels_[leveli + 1];
+    restrictResidual(level.aggregateRows, level.res, coarse.rhs);
+    cycle(leveli + 1, coarse.rhs, coarse.x);
+    prolongate(level.aggregates, coarse.x, x);
+    smooth(level, rhs, x, settings_.postSweeps, SweepDirection::Backward);
+}
+
+void MultigridHierarchy::smooth(
+    MultigridLevel& level,
+    const Vector<scalar>& rhs,
+    Vector<scalar>& x,
+    int sweeps,
+    SweepDirection direction
+) const
+{
+    if (settings_.smoother != MultigridSmoother::Jacobi)
+    {
+        // the symmetric smoother applies a forward and a backward pass in every sweep
+        const auto sweepDirection = settings_.smoother == MultigridSmoother::SymmetricGaussSeidel
+                                      ? SweepDirection::Symmetric
+                                      : direction;
+        gaussSeidelSweeps(
+            level.matrix, level.diagIdxs, level.coloring, rhs, x, sweeps, sweepDirection, 1.0
+        );
+        return;
+    }
+    jacobiSmooth(level, rhs, x, sweeps, settings_.relaxation);
+}
+
+Multigrid::Multigrid(const Executor& exec, const Dictionary& solverConfig)
+    : Base(exec), settings_(MultigridSettings::read(solverConfig)),
+      useCG_(readOption<std::string>(solverConfig, "krylov", "cg") == "cg"),
+      maxIters_(readOption<int>(solverConfig, "maxIters", 100)),
+      relTol_(readOption<scalar>(solverConfig, "relTol", 1e-6)),
+      absTol_(readOption<scalar>(solverConfig, "absTol", 0.0)),
+      rebuildEvery_(readOption<int>(solverConfig, "rebuildHierarchyEvery", 0)),
+      faceAgglomeration_(
+          readOption<std::string>(solverConfig, "agglomeration", "algebraic") == "faceArea"
+      )
+{
+    const auto agglomeration = readOption<std::string>(solverConfig, "agglomeration", "algebraic");
+    if (agglomeration != "algebraic" && agglomeration != "faceArea")
+    {
+        NF_ERROR_EXIT(
+            "Unknown agglomeration " + agglomeration + ", expected algebraic or faceArea."
+        );
+    }
+    const auto krylov = readOption<std::string>(solverConfig, "krylov", "cg");
+    if (krylov != "cg" && krylov != "none")
+    {
+        NF_ERROR_EXIT("Unknown krylov " + krylov + ", expected cg or none.");
+    }
+    NF_ASSERT(maxIters_ > 0, "maxIters needs to be larger than zero");
+    NF_ASSERT(rebuildEvery_ >= 0, "rebuildHierarchyEvery must not be negative");
+}
+
+Multigrid::Multigrid(const Multigrid& other)
+    : Base(other.exec_), settings_(other.settings_), useCG_(other.useCG_),
+      maxIters_(other.maxIters_), relTol_(other.relTol_), absTol_(other.absTol_),
+      rebuildEvery_(other.rebuildEvery_), faceAgglomeration_(other.faceAgglomeration_)
+{}
+
+void Multigrid::updateHierarchy(const LinearSystem<scalar, localIdx>& sys) const
+{
+    const auto& mtx = sys.matrix();
+    const bool expired = rebuildEvery_ > 0 && solvesSinceRebuild_ >= rebuildEvery_;
+    if (!hierarchy_ || expired || !hierarchy_->matches(mtx))
+    {
+        if (faceAgglomeration_)
+        {
+            const auto& aux = sys.auxiliaryCoefficients();
+            if (!aux.contains("mesh"))
+            {
+                NF_ERROR_EXIT("The faceArea agglomeration requires the mesh of the linear system.");
+            }
+            const auto& mesh = *aux.get<const UnstructuredMesh*>("mesh");
+            hierarchy_ = std::make_unique<MultigridHierarchy>(
+                mtx, FaceAgglomeration::readOrCreate(mesh), settings_
+            );
+        }
+        else
+        {
+            hierarchy_ = std::make_unique<MultigridHierarchy>(mtx, settings_);
+        }
+        solvesSinceRebuild_ = 0;
+    }
+    else
+    {
+        hierarchy_->refresh(mtx);
+    }
+    solvesSinceRebuild_++;
+}
+
+SolverStats Multigrid::solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
+{
+    NF_ASSERT(sys.matrix().exec() == x.exec(), "Executors are not the same");
+    PhaseTimer timer;
+    SolverTimings timings {0.0, 0.0, 0.0, 0.0};
+    const auto& mtx = sys.matrix();
+    updateHierarchy(sys);
+    fence(x.exec());
+    timings.preconditionerTime = timer.lap();
+
+    // r = rhs - A x
+    Vector<scalar> r(x.exec(), x.size());
+    Vector<scalar> z(x.exec(), x.size());
+    timings.setupTime = timer.lap();
+    const scalar initResNorm = computeResidualNorms(mtx, sys.rhs(), x, r).l2;
+    scalarMul(r, -1.0);
+    const scalar tol = std::max(absTol_, relTol_ * initResNorm);
+    scalar resNorm = initResNorm;
+
+    int numIter = 0;
+    if (useCG_)
+    {
+        Vector<scalar> p(x.exec(), x.size(), 0.0);
+        Vector<scalar> q(x.exec(), x.size());
+        scalar rz = 0.0;
+        while (numIter < maxIters_ && resNorm > tol)
+        {
+            hierarchy_->apply(r, z);
+            const scalar rzNew = dot(r, z);
+            axpby(1.0, z, numIter == 0 ? 0.0 : rzNew / rz, p);
+            rz = rzNew;
+            spmv(mtx, p, q);
+            const scalar alpha = rz / dot(p, q);
+            axpby(alpha, p, 1.0, x);
+            axpby(-alpha, q, 1.0, r);
+            resNorm = std::sqrt(dot(r, r));
+            numIter++;
+        }
+    }
+    else
+    {
+        while (numIter < maxIters_ && resNorm > tol)
+        {
+            hierarchy_->apply(r, z);
+            axpby(1.0, z, 1.0, x);
+            resNorm = computeResidualNorms(mtx, sys.rhs(), x, r).l2;
+            scalarMul(r, -1.0);
+            numIter++;
+        }
+    }
+
+    timings.applyTime = timer.lap();
+    return {numIter, initResNorm, resNorm, timer.total(), timings};
+}
+
+}
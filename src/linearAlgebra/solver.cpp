@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+
+#include "NeoN/core/timer.hpp"
+#include "NeoN/linearAlgebra/blockLinearSystem.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+
+namespace NeoN::la
+{
+
+SolverStats solveSegregated(
+    const LinearSystem<Vec3, localIdx>& ls, Vector<Vec3>& x, const ComponentSolve& solveCmpt
+)
+{
+    NF_ASSERT(ls.exec() == x.exec(), "Executors are not the same");
+    auto cmptLs = createComponentSystem(ls);
+    Vector<scalar> cmptX(x.exec(), x.size());
+
+    SolverStats stats {0, 0.0, 0.0, 0.0, {0.0, 0.0, 0.0, 0.0}};
+    for (localIdx cmpt = 0; cmpt < 3; cmpt++)
+    {
+        extractComponent(ls, cmpt, cmptLs);
+        extractComponent(x, cmpt, cmptX);
+        auto cmptStats = solveCmpt(cmptLs, cmptX, cmpt);
+        insertComponent(cmptX, cmpt, x);
+
+        stats.numIter += cmptStats.numIter;
+        stats.initResNorm += cmptStats.initResNorm * cmptStats.initResNorm;
+        stats.finalResNorm += cmptStats.finalResNorm * cmptStats.finalResNorm;
+        stats.solveTime += cmptStats.solveTime;
+        stats.timings.setupTime += cmptStats.timings.setupTime;
+        stats.timings.preconditionerTime += cmptStats.timings.preconditionerTime;
+        stats.timings.applyTime += cmptStats.timings.applyTime;
+        stats.timings.transferTime += cmptStats.timings.transferTime;
+    }
+    stats.initResNorm = std::sqrt(stats.initResNorm);
+    stats.finalResNorm = std::sqrt(stats.finalResNorm);
+    return stats;
+}
+
+SolverStats SolverFactory::solve(const LinearSystem<Vec3, localIdx>& ls, Vector<Vec3>& x) const
+{
+    return solveSegregated(
+        ls,
+        x,
+        [this](const auto& cmptLs, auto& cmptX, localIdx) { return solve(cmptLs, cmptX); }
+    );
+}
+
+SolverStats SolverFactory::solve(
+    const LinearSystem<scalar, localIdx>& ls, const DenseBlock& b, DenseBlock& x
+) const
+{
+    NF_ASSERT_EQUAL(b.nRows(), ls.rhs().size());
+    NF_ASSERT_EQUAL(b.nRows(), x.nRows());
+    NF_ASSERT_EQUAL(b.nCols(), x.nCols());
+    LinearSystem<scalar, localIdx> columnLs(ls);
+    Vector<scalar> columnX(x.exec(), x.nRows());
+
+    SolverStats stats {0, 0.0, 0.0, 0.0, {0.0, 0.0, 0.0, 0.0}};
+    for (localIdx j = 0; j < b.nCols(); j++)
+    {
+        b.getColumn(j, columnLs.rhs());
+        x.getColumn(j, columnX);
+        auto columnStats = solve(columnLs, columnX);
+        x.setColumn(j, columnX);
+
+        stats.numIter += columnStats.numIter;
+        stats.initResNorm += columnStats.initResNorm * columnStats.initResNorm;
+        stats.finalResNorm += columnStats.finalResNorm * columnStats.finalResNorm;
+        stats.solveTime += columnStats.solveTime;
+        stats.timings.setupTime += columnStats.timings.setupTime;
+        stats.timings.preconditionerTime += columnStats.timings.preconditionerTime;
+        stats.timings.applyTime += columnStats.timings.applyTime;
+        stats.timings.transferTime += columnStats.timings.transferTime;
+    }
+    stats.initResNorm = std::sqrt(stats.initResNorm);
+    stats.finalResNorm = std::sqrt(stats.finalResNorm);
+    return stats;
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+SolverStats
+SolverFactory::solve(const DistributedLinearSystem<scalar, localIdx>&, Vector<scalar>&) const
+{
+    NF_ERROR_EXIT("The selected solver does not support distributed linear systems.");
+    return {0, 0.0, 0.0, 0.0, {0.0, 0.0, 0.0, 0.0}};
+}
+#endif
+
+SolverStats Solver::solve(const LinearSystem<Vec3, localIdx>& ls, Vector<Vec3>& field) const
+{
+    ScopedTimer timer("la::Solver::solveVec3", field.exec());
+    if (field.size() > ls.rhs().size())
+    {
+        auto rows = Vector<Vec3>::wrap(field.exec(), field.data(), ls.rhs().size());
+        return solve(ls, rows);
+    }
+    if (vectorSolveMode_ == VectorSolveMode::Segregated)
+    {
+        return solverInstance_->solve(ls, field);
+    }
+    auto coupledLs = createCoupledSystem(ls);
+    Vector<scalar> coupledX(field.exec(), 3 * field.size());
+    interleave(field, coupledX);
+    auto stats = solverInstance_->solve(coupledLs, coupledX);
+    deinterleave(coupledX, field);
+    return stats;
+}
+
+VectorSolveMode Solver::readVectorSolveMode(const Dictionary& dict)
+{
+    if (!dict.contains("vectorSolve"))
+    {
+        return VectorSolveMode::Segregated;
+    }
+    const auto mode = dict.get<std::string>("vectorSolve");
+    if (mode == "segregated")
+    {
+        return VectorSolveMode::Segregated;
+    }
+    if (mode != "coupled")
+    {
+        NF_ERROR_EXIT("Unknown vectorSolve " + mode + ", expected segregated or coupled.");
+    }
+    return VectorSolveMode::Coupled;
+}
+
+std::shared_ptr<Solver>
+SolverCache::get(const std::string& name, const Executor& exec, const Dictionary& dict)
+{
+    auto [bindBegin, bindEnd] = bindings_.equal_range(name);
+    auto binding = std::find_if(
+        bindBegin, bindEnd, [&](const auto& entry) { return entry.second.exec == exec; }
+    );
+    if (binding == bindEnd)
+    {
+        binding = bindings_.emplace(name, Binding {exec, {}});
+    }
+    if (binding->second.solver.bound(dict))
+    {
+        return binding->second.solver.value();
+    }
+
+    const auto dictKey = contentKey(dict);
+    if (!dictKey)
+    {
+        return std::make_shared<Solver>(exec, dict);
+    }
+    const auto key = name + "\n" + *dictKey;
+    auto [begin, end] = solvers_.equal_range(key);
+    auto it =
+        std::find_if(begin, end, [&](const auto& entry) { return entry.second.exec == exec; });
+    if (it == end)
+    {
+        it = solvers_.emplace(key, Entry {exec, std::make_shared<Solver>(exec, dict)});
+    }
+    const auto& solver = it->second.solver;
+    return binding->second.solver.bind(dict, [&](const Dictionary&) { return solver; });
+}
+
+void SolverCache::reportMemory(MemoryReport& report, const std::string&) const
+{
+    for (const auto& [key, entry] : solvers_)
+    {
+        // the key starts with the name of the equation
+        report.add("solvers", key.substr(0, key.find('\n')), entry.solver->memoryBytes());
+    }
+}
+
+SolverCache& solverCache(const UnstructuredMesh& mesh)
+{
+    static const StencilKey<SolverCache> key("SolverCache");
+    return mesh.stencilDB().getOrCreate(key, []() { return SolverCache(); });
+}
+
+}
@@ -2,8 +2,12 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <utility>
+
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/core/vector/hostMirror.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
 
 namespace NeoN::la
@@ -11,34 +15,41 @@ namespace NeoN::la
 
 const SparsityPattern& SparsityPattern::readOrCreate(const UnstructuredMesh& mesh)
 {
-    StencilDataBase& stencilDb = mesh.stencilDB();
-    if (!stencilDb.contains("SparsityPattern"))
-    {
-        stencilDb.insert(std::string("SparsityPattern"), SparsityPattern(mesh));
-    }
-    return stencilDb.get<SparsityPattern>("SparsityPattern");
+    static const StencilKey<SparsityPattern> key("SparsityPattern");
+    return mesh.stencilDB().getOrCreate(key, [&]() { return SparsityPattern(mesh); });
 }
 
+/* @brief the internal faces between two local cells, which define the off diagonal entries
+ *
+ * The faces of the ghost cells follow them, see HaloLayout::GhostCells. The ghost cells have no
+ * row, hence their faces only couple the owner explicitly, eg. through the rhs.
+ */
+static localIdx nLocalInternalFaces(const UnstructuredMesh& mesh)
+{
+    return mesh.nInternalFaces() - mesh.nGhostCells();
+}
 
 void updateSparsityPatternSerial(const UnstructuredMesh& mesh, SparsityPattern& sp)
 {
-    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nInternalFaces = nLocalInternalFaces(mesh);
     const auto exec = mesh.exec();
     auto nCells = mesh.nCells();
 
     // start with one to include the diagonal
     // TODO: currently the whole algorithm is performed in serial on the host
     auto nFacesPerCellH = Vector<localIdx>(SerialExecutor {}, nCells, 1);
-    auto [neiOffsetH, ownOffsetH, diagOffsetH, faceOwnH, faceNeiH] = copyToHosts(
-        sp.neighbourOffset(),
-        sp.ownerOffset(),
-        sp.diagOffset(),
-        mesh.faceOwner(),
-        mesh.faceNeighbour()
-    );
+    auto [neiOffsetH, ownOffsetH, diagOffsetH] =
+        copyToHosts(sp.neighbourOffset(), sp.ownerOffset(), sp.diagOffset());
+    // the mirrors alias the memory of host executors, hence only device data is copied
+    const auto& faceOwnH = mesh.hostFaceOwner();
+    const auto& faceNeiH = mesh.hostFaceNeighbour();
+    HostMirror<localIdx> rowOffsH(sp.rowOffs());
+    HostMirror<columnIdx> colIdxH(sp.colIdxs());
 
     auto [nFacesPerCellHV, neiOffsetHV, ownOffsetHV, diagOffsetHV, faceOwnHV, faceNeiHV] =
         views(nFacesPerCellH, neiOffsetH, ownOffsetH, diagOffsetH, faceOwnH, faceNeiH);
+    auto rowOffsHV = rowOffsH.view();
+    auto colIdxHV = colIdxH.view();
 
 
     // accumulate number non-zeros per row
@@ -54,15 +65,13 @@ void updateSparsityPatternSerial(const UnstructuredMesh& mesh, SparsityPattern&
 
             Kokkos::atomic_increment(&nFacesPerCellHV[own]);
             Kokkos::atomic_increment(&nFacesPerCellHV[nei]);
-        }
+        },
+        "SparsityPattern::count"
     );
 
     // get number of total non-zeros
-    auto rowOffsH = sp.rowOffs().copyToHost();
-    auto rowOffsHV = rowOffsH.view();
-    segmentsFromIntervals(nFacesPerCellH, rowOffsH);
-    auto colIdxH = sp.colIdxs().copyToHost();
-    auto colIdxHV = colIdxH.view();
+    // the first offset is assumed to be zero
+    inclusiveScan(SerialExecutor {}, nFacesPerCellH.view(), rowOffsHV.subview(1));
     fill(nFacesPerCellH, 0); // reset nFacesPerCell
 
     // compute the lower triangular part of the matrix
@@ -83,7 +92,8 @@ void updateSparsityPatternSerial(const UnstructuredMesh& mesh, SparsityPattern&
             // neighbour --> current cell
             // colIdx for row[neighbour] stores owner as a column entry
             Kokkos::atomic_assign(&colIdxHV[startSegNei + segIdxNei], own);
-        }
+        },
+        "SparsityPattern::lower"
     );
 
     map(
@@ -91,7 +101,7 @@ void updateSparsityPatternSerial(const UnstructuredMesh& mesh, SparsityPattern&
         KOKKOS_LAMBDA(const localIdx celli) {
             auto nFaces = nFacesPerCellHV[celli];
             diagOffsetHV[celli] = static_cast<uint8_t>(nFaces);
-            colIdxHV[rowOffsHV[celli] + nFaces] = celli;
+            colIdxHV[rowOffsHV[celli] + nFaces] = static_cast<columnIdx>(celli);
             return nFaces + 1;
         }
     );
@@ -114,114 +124,148 @@ void updateSparsityPatternSerial(const UnstructuredMesh& mesh, SparsityPattern&
             // owner --> current cell
             // colIdx --> needs to be store the neighbour
             Kokkos::atomic_assign(&colIdxHV[startSegOwn + segIdxOwn], nei);
-        }
+        },
+        "SparsityPattern::upper"
     );
     // NOTE copy back to device
+    colIdxH.syncToDeviceAsync(sp.colIdxs());
+    rowOffsH.syncToDeviceAsync(sp.rowOffs());
     sp.ownerOffset() = ownOffsetH.copyToExecutor(exec);
     sp.neighbourOffset() = neiOffsetH.copyToExecutor(exec);
     sp.diagOffset() = diagOffsetH.copyToExecutor(exec);
-    sp.colIdxs() = colIdxH.copyToExecutor(exec);
-    sp.rowOffs() = rowOffsH.copyToExecutor(exec);
+    colIdxH.fence();
+    rowOffsH.fence();
 }
 
 void updateSparsityPatternParallel(const UnstructuredMesh& mesh, SparsityPattern& sp)
 {
-    const auto faceOwner = mesh.faceOwner().view();
-    const auto faceNeiV = mesh.faceNeighbour().view();
-    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nInternalFaces = nLocalInternalFaces(mesh);
     const auto exec = mesh.exec();
     auto nCells = mesh.nCells();
 
     // start with one to include the diagonal
     auto nFacesPerCell = Vector<localIdx>(exec, nCells, 1);
-    auto [nFacesPerCellView, neighbourOffsetView, ownerOffsetView, diagOffsetView] =
-        views(nFacesPerCell, sp.neighbourOffset(), sp.ownerOffset(), sp.diagOffset());
+    // temporary mapping from a non-zero entry to the face it originates from,
+    // nInternalFaces marks the diagonal entry
+    auto entryFace = Vector<localIdx>(exec, sp.nnz(), nInternalFaces);
+
+    auto [faceOwn, faceNei, nFacesPerCellV, entryFaceV] =
+        views(mesh.faceOwner(), mesh.faceNeighbour(), nFacesPerCell, entryFace);
 
     // accumulate number non-zeros per row
     // only the internalfaces define the sparsity pattern
-    // get the number of faces per cell to allocate the correct size
     parallelFor(
         exec,
         {0, nInternalFaces},
         KOKKOS_LAMBDA(const localIdx facei) {
-            // hit on performance on serial
-            auto owner = faceOwner[facei];
-            auto neighbour = faceNeiV[facei];
-
-            Kokkos::atomic_increment(&nFacesPerCellView[owner]);
-            Kokkos::atomic_increment(&nFacesPerCellView[neighbour]);
-        }
+            Kokkos::atomic_increment(&nFacesPerCellV[faceOwn[facei]]);
+            Kokkos::atomic_increment(&nFacesPerCellV[faceNei[facei]]);
+        },
+        "countSparsityPatternEntries"
     );
 
-    // get number of total non-zeros
-    auto rowOffs = sp.rowOffs().view();
     segmentsFromIntervals(nFacesPerCell, sp.rowOffs());
-    auto colIdxV = sp.colIdxs().view();
-    fill(nFacesPerCell, 0); // reset nFacesPerCell
 
-    // compute the lower triangular part of the matrix
+    auto [rowOffs, colIdx, ownOffs, neiOffs, diagOffs] =
+        views(sp.rowOffs(), sp.colIdxs(), sp.ownerOffset(), sp.neighbourOffset(), sp.diagOffset());
+
+    // the diagonal is stored in the first slot of each row, the remaining
+    // slots are filled in arbitrary order and sorted afterwards
     parallelFor(
         exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx facei) {
-            auto neighbour = faceNeiV[facei];
-            auto owner = faceOwner[facei];
-
-            // return the oldValues
-            // hit on performance on serial
-            auto segIdxNei = Kokkos::atomic_fetch_add(&nFacesPerCellView[neighbour], 1);
-            neighbourOffsetView[facei] = static_cast<uint8_t>(segIdxNei);
-
-            auto startSegNei = rowOffs[neighbour];
-            // neighbour --> current cell
-            // colIdx --> needs to be store the owner
-            Kokkos::atomic_assign(&colIdxV[startSegNei + segIdxNei], owner);
-        }
-    );
-
-    map(
-        nFacesPerCell,
+        {0, nCells},
         KOKKOS_LAMBDA(const localIdx celli) {
-            auto nFaces = nFacesPerCellView[celli];
-            diagOffsetView[celli] = static_cast<uint8_t>(nFaces);
-            colIdxV[rowOffs[celli] + nFaces] = celli;
-            return nFaces + 1;
-        }
+            colIdx[rowOffs[celli]] = static_cast<columnIdx>(celli);
+            nFacesPerCellV[celli] = 1;
+        },
+        "insertSparsityPatternDiagonal"
     );
 
-    // compute the upper triangular part of the matrix
     parallelFor(
         exec,
         {0, nInternalFaces},
         KOKKOS_LAMBDA(const localIdx facei) {
-            auto neighbour = faceNeiV[facei];
-            auto owner = faceOwner[facei];
-
-            // return the oldValues
-            // hit on performance on serial
-            auto segIdxOwn =
-                static_cast<uint8_t>(Kokkos::atomic_fetch_add(&nFacesPerCellView[owner], 1));
-            ownerOffsetView[facei] = segIdxOwn;
+            auto own = faceOwn[facei];
+            auto nei = faceNei[facei];
+
+            // neighbour --> current cell, colIdx for row[neighbour] stores the owner
+            auto idxNei = rowOffs[nei] + Kokkos::atomic_fetch_add(&nFacesPerCellV[nei], 1);
+            colIdx[idxNei] = own;
+            entryFaceV[idxNei] = facei;
+
+            // owner --> current cell, colIdx for row[owner] stores the neighbour
+            auto idxOwn = rowOffs[own] + Kokkos::atomic_fetch_add(&nFacesPerCellV[own], 1);
+            colIdx[idxOwn] = nei;
+            entryFaceV[idxOwn] = facei;
+        },
+        "scatterSparsityPatternEntries"
+    );
 
-            auto startSegOwn = rowOffs[owner];
-            // owner --> current cell
-            // colIdx --> needs to be store the neighbour
-            Kokkos::atomic_assign(&colIdxV[startSegOwn + segIdxOwn], neighbour);
-        }
+    // sort each row by column and face index, this makes the pattern independent of
+    // the order in which the atomics were resolved. Afterwards the face to row offsets
+    // can be read directly from the sorted rows.
+    parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            auto start = rowOffs[celli];
+            auto end = rowOffs[celli + 1];
+
+            // rows are short, thus insertion sort is sufficient
+            for (localIdx i = start + 1; i < end; i++)
+            {
+                auto col = colIdx[i];
+                auto face = entryFaceV[i];
+                localIdx j = i;
+                while (j > start)
+                {
+                    auto prevCol = colIdx[j - 1];
+                    if (prevCol < col || (prevCol == col && entryFaceV[j - 1] < face))
+                    {
+                        break;
+                    }
+                    colIdx[j] = colIdx[j - 1];
+                    entryFaceV[j] = entryFaceV[j - 1];
+                    j--;
+                }
+                colIdx[j] = col;
+                entryFaceV[j] = face;
+            }
+
+            for (localIdx i = start; i < end; i++)
+            {
+                auto offset = static_cast<uint8_t>(i - start);
+                auto facei = entryFaceV[i];
+                if (facei == nInternalFaces)
+                {
+                    diagOffs[celli] = offset;
+                }
+                else if (faceOwn[facei] == celli)
+                {
+                    // current cell is the owner, thus the entry stores the neighbour
+                    ownOffs[facei] = offset;
+                }
+                else
+                {
+                    // current cell is the neighbour, thus the entry stores the owner
+                    neiOffs[facei] = offset;
+                }
+            }
+        },
+        "sortSparsityPatternRows"
     );
 }
 
 void updateSparsityPattern(const UnstructuredMesh& mesh, SparsityPattern& sp)
 {
-    // TODO sort pattern after creation and use parallel version
-    updateSparsityPatternSerial(mesh, sp);
+    updateSparsityPatternParallel(mesh, sp);
 }
 
 SparsityPattern createSparsity(const UnstructuredMesh& mesh)
 {
     const auto exec = mesh.exec();
     const auto nCells = mesh.nCells();
-    const auto nnzs = 2 * mesh.nInternalFaces() + nCells;
+    const auto nnzs = 2 * nLocalInternalFaces(mesh) + nCells;
     auto ret = SparsityPattern(exec, nCells, nnzs);
     updateSparsityPattern(mesh, ret);
     return ret;
@@ -229,7 +273,7 @@ SparsityPattern createSparsity(const UnstructuredMesh& mesh)
 
 SparsityPattern::SparsityPattern(const UnstructuredMesh& mesh)
     : rowOffs_(mesh.exec(), mesh.nCells() + 1, 0),
-      colIdxs_(mesh.exec(), mesh.nCells() + 2 * mesh.nInternalFaces(), 0),
+      colIdxs_(mesh.exec(), mesh.nCells() + 2 * nLocalInternalFaces(mesh), 0),
       ownerOffset_(mesh.exec(), mesh.nInternalFaces(), 0),
       neighbourOffset_(mesh.exec(), mesh.nInternalFaces(), 0),
       diagOffset_(mesh.exec(), mesh.nCells(), 0)
@@ -244,6 +288,405 @@ SparsityPattern::SparsityPattern(Executor exec, localIdx nRows, localIdx nnzs)
       diagOffset_(exec, nRows, 0)
 {}
 
+/* @brief copies the padded rows into the compact column indices, all rows or the touched ones */
+static void copyPaddedRows(
+    const Executor& exec,
+    const Vector<localIdx>& rowStarts,
+    const Vector<localIdx>& rowLengths,
+    const Vector<localIdx>& paddedCols,
+    const Vector<localIdx>& touched,
+    bool allRows,
+    SparsityPattern& sp
+)
+{
+    const auto [starts, lengths, cols, touchedV, rowOffs] =
+        views(rowStarts, rowLengths, paddedCols, touched, sp.rowOffs());
+    auto colIdxs = sp.colIdxs().view();
+    parallelFor(
+        exec,
+        {0, lengths.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            if (allRows || touchedV[celli] != 0)
+            {
+                for (localIdx k = 0; k < lengths[celli]; k++)
+                {
+                    colIdxs[rowOffs[celli] + k] = static_cast<columnIdx>(cols[starts[celli] + k]);
+                }
+            }
+        },
+        "copyPaddedSparsityRows"
+    );
+}
+
+/* @brief sorts the touched padded rows by column and face and sets their face offsets */
+static void sortPaddedRows(
+    const UnstructuredMesh& mesh,
+    const Vector<localIdx>& rowStarts,
+    const Vector<localIdx>& rowLengths,
+    const Vector<localIdx>& touched,
+    Vector<localIdx>& paddedCols,
+    Vector<localIdx>& paddedFaces,
+    SparsityPattern& sp
+)
+{
+    const auto [starts, lengths, touchedV, faceOwn] =
+        views(rowStarts, rowLengths, touched, mesh.faceOwner());
+    auto [colIdx, entryFace, ownOffs, neiOffs, diagOffs] = views(
+        paddedCols, paddedFaces, sp.ownerOffset(), sp.neighbourOffset(), sp.diagOffset()
+    );
+    parallelFor(
+        mesh.exec(),
+        {0, lengths.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            if (touchedV[celli] == 0)
+            {
+                return;
+            }
+            auto start = starts[celli];
+            auto end = start + lengths[celli];
+
+            // the same order as updateSparsityPatternParallel, the diagonal has no face
+            for (localIdx i = start + 1; i < end; i++)
+            {
+                auto col = colIdx[i];
+                auto face = entryFace[i];
+                localIdx j = i;
+                while (j > start)
+                {
+                    auto prevCol = colIdx[j - 1];
+                    if (prevCol < col || (prevCol == col && entryFace[j - 1] < face))
+                    {
+                        break;
+                    }
+                    colIdx[j] = colIdx[j - 1];
+                    entryFace[j] = entryFace[j - 1];
+                    j--;
+                }
+                colIdx[j] = col;
+                entryFace[j] = face;
+            }
+
+            for (localIdx i = start; i < end; i++)
+            {
+                auto offset = static_cast<uint8_t>(i - start);
+                auto facei = entryFace[i];
+                if (facei < 0)
+                {
+                    diagOffs[celli] = offset;
+                }
+                else if (faceOwn[facei] == celli)
+                {
+                    ownOffs[facei] = offset;
+                }
+                else
+                {
+                    neiOffs[facei] = offset;
+                }
+            }
+        },
+        "sortPaddedSparsityRows"
+    );
+}
+
+IncrementalSparsityPattern::IncrementalSparsityPattern(const UnstructuredMesh& mesh, localIdx slack)
+    : slack_(slack), pattern_(), rowStarts_(mesh.exec(), 0), rowLengths_(mesh.exec(), 0),
+      paddedCols_(mesh.exec(), 0), paddedFaces_(mesh.exec(), 0)
+{
+    NF_ASSERT(slack >= 0, "The slack of the sparsity pattern needs to be non-negative.");
+    NF_ASSERT(
+        mesh.nGhostCells() == 0, "The incremental sparsity pattern does not support ghost cells."
+    );
+    rebuild(mesh);
+}
+
+void IncrementalSparsityPattern::rebuild(const UnstructuredMesh& mesh)
+{
+    const auto exec = mesh.exec();
+    const auto nCells = mesh.nCells();
+    pattern_.emplace(mesh);
+    rowLengths_.resize(nCells);
+    rowStarts_ = Vector<localIdx>(exec, nCells + 1, 0);
+    Vector<localIdx> capacities(exec, nCells);
+    const auto slack = slack_;
+    {
+        const auto rowOffs = pattern_->rowOffs().view();
+        auto [lengths, caps] = views(rowLengths_, capacities);
+        parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                lengths[celli] = rowOffs[celli + 1] - rowOffs[celli];
+                caps[celli] = lengths[celli] + slack;
+            },
+            "paddedSparsityRowLengths"
+        );
+    }
+    const auto total = segmentsFromIntervals(std::as_const(capacities), rowStarts_);
+    paddedCols_.resize(total);
+    paddedFaces_.resize(total);
+
+    const auto [rowOffs, colIdxs, ownOffs, neiOffs, diagOffs, starts, lengths, faceOwn, faceNei] =
+        views(
+            pattern_->rowOffs(),
+            pattern_->colIdxs(),
+            pattern_->ownerOffset(),
+            pattern_->neighbourOffset(),
+            pattern_->diagOffset(),
+            rowStarts_,
+            rowLengths_,
+            mesh.faceOwner(),
+            mesh.faceNeighbour()
+        );
+    auto [cols, faces] = views(paddedCols_, paddedFaces_);
+    parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            for (localIdx k = 0; k < lengths[celli]; k++)
+            {
+                cols[starts[celli] + k] = colIdxs[rowOffs[celli] + k];
+            }
+            faces[starts[celli] + diagOffs[celli]] = -1;
+        },
+        "paddedSparsityRows"
+    );
+    parallelFor(
+        exec,
+        {0, mesh.nInternalFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            faces[starts[faceOwn[facei]] + ownOffs[facei]] = facei;
+            faces[starts[faceNei[facei]] + neiOffs[facei]] = facei;
+        },
+        "paddedSparsityFaces"
+    );
+}
+
+void IncrementalSparsityPattern::appendRows(localIdx oldRows, const Vector<localIdx>& rowLengths)
+{
+    const auto exec = rowLengths.exec();
+    const auto nRows = rowLengths.size();
+    const auto nNew = nRows - oldRows;
+    // the rows start after the last entry, the unused entries of removed rows are skipped
+    const auto base = paddedCols_.size();
+    Vector<localIdx> capacities(exec, nNew);
+    Vector<localIdx> offsets(exec, nNew);
+    const auto slack = slack_;
+    {
+        const auto lengths = rowLengths.view();
+        auto caps = capacities.view();
+        parallelFor(
+            exec,
+            {0, nNew},
+            KOKKOS_LAMBDA(const localIdx i) { caps[i] = lengths[oldRows + i] + slack; },
+            "appendedSparsityRowCapacities"
+        );
+    }
+    const auto total = exclusiveScan(exec, std::as_const(capacities).view(), offsets.view());
+    const auto [caps, offs] = views(capacities, offsets);
+    auto starts = rowStarts_.view();
+    parallelFor(
+        exec,
+        {0, nNew},
+        KOKKOS_LAMBDA(const localIdx i) {
+            starts[oldRows + i] = base + offs[i];
+            if (i == nNew - 1)
+            {
+                starts[nRows] = base + offs[i] + caps[i];
+            }
+        },
+        "appendSparsityRows"
+    );
+    paddedCols_.resize(base + total);
+    paddedFaces_.resize(base + total);
+}
+
+SparsityUpdate IncrementalSparsityPattern::update(
+    const UnstructuredMesh& mesh,
+    const Vector<localIdx>& changedCells,
+    const Vector<localIdx>& changedFaces
+)
+{
+    const auto exec = mesh.exec();
+    const auto nCells = mesh.nCells();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto oldRows = rowLengths_.size();
+
+    // the touched rows, the appended cells are always touched
+    Vector<localIdx> touched(exec, nCells, 0);
+    Vector<localIdx> newLengths(exec, nCells, 1);
+    {
+        const auto [cells, faces, faceOwn, faceNei] =
+            views(changedCells, changedFaces, mesh.faceOwner(), mesh.faceNeighbour());
+        auto [touchedV, newLengthsV] = views(touched, newLengths);
+        parallelFor(
+            exec,
+            {0, cells.size()},
+            KOKKOS_LAMBDA(const localIdx i) { Kokkos::atomic_assign(&touchedV[cells[i]], 1); },
+            "touchChangedCells"
+        );
+        parallelFor(
+            exec,
+            {0, faces.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                const auto facei = faces[i];
+                if (facei < nInternalFaces)
+                {
+                    Kokkos::atomic_assign(&touchedV[faceOwn[facei]], 1);
+                    Kokkos::atomic_assign(&touchedV[faceNei[facei]], 1);
+                }
+            },
+            "touchChangedFaces"
+        );
+        parallelFor(
+            exec,
+            {std::min(oldRows, nCells), nCells},
+            KOKKOS_LAMBDA(const localIdx celli) { touchedV[celli] = 1; },
+            "touchAppendedCells"
+        );
+        parallelFor(
+            exec,
+            {0, nInternalFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const localIdx own = faceOwn[facei];
+                const localIdx nei = faceNei[facei];
+                if (touchedV[own] != 0)
+                {
+                    Kokkos::atomic_increment(&newLengthsV[own]);
+                }
+                if (touchedV[nei] != 0)
+                {
+                    Kokkos::atomic_increment(&newLengthsV[nei]);
+                }
+            },
+            "countTouchedSparsityRows"
+        );
+    }
+
+    // the rows of removed cells are dropped, the appended rows get their capacity
+    rowLengths_.resize(nCells);
+    rowStarts_.resize(nCells + 1);
+    if (nCells > oldRows)
+    {
+        appendRows(oldRows, newLengths);
+    }
+
+    localIdx nTouched = 0;
+    localIdx nExceeded = 0;
+    localIdx nChanged = 0;
+    {
+        const auto [touchedV, newLengthsV, starts, lengths] =
+            views(touched, newLengths, rowStarts_, rowLengths_);
+        parallelReduce(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(
+                const localIdx celli, localIdx& touchedSum, localIdx& exceeded, localIdx& changed
+            ) {
+                if (touchedV[celli] != 0)
+                {
+                    touchedSum += 1;
+                    exceeded += newLengthsV[celli] > starts[celli + 1] - starts[celli] ? 1 : 0;
+                    changed += celli >= oldRows || newLengthsV[celli] != lengths[celli] ? 1 : 0;
+                }
+            },
+            nTouched,
+            nExceeded,
+            nChanged,
+            "checkTouchedSparsityRows"
+        );
+    }
+    if (nExceeded > 0)
+    {
+        rebuild(mesh);
+        return {nCells, true, true, topologyCaches(true)};
+    }
+    const bool rowOffsChanged = nChanged > 0 || nCells != oldRows;
+
+    auto& sp = *pattern_;
+    sp.ownerOffset().resize(nInternalFaces);
+    sp.neighbourOffset().resize(nInternalFaces);
+    sp.diagOffset().resize(nCells);
+    {
+        const auto [touchedV, starts, faceOwn, faceNei] =
+            views(touched, rowStarts_, mesh.faceOwner(), mesh.faceNeighbour());
+        auto [lengths, cols, faces] = views(rowLengths_, paddedCols_, paddedFaces_);
+        parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                if (touchedV[celli] != 0)
+                {
+                    lengths[celli] = 1;
+                    cols[starts[celli]] = celli;
+                    faces[starts[celli]] = -1;
+                }
+            },
+            "insertTouchedSparsityDiagonal"
+        );
+        parallelFor(
+            exec,
+            {0, nInternalFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const localIdx own = faceOwn[facei];
+                const localIdx nei = faceNei[facei];
+                if (touchedV[nei] != 0)
+                {
+                    auto idx = starts[nei] + Kokkos::atomic_fetch_add(&lengths[nei], 1);
+                    cols[idx] = own;
+                    faces[idx] = facei;
+                }
+                if (touchedV[own] != 0)
+                {
+                    auto idx = starts[own] + Kokkos::atomic_fetch_add(&lengths[own], 1);
+                    cols[idx] = nei;
+                    faces[idx] = facei;
+                }
+            },
+            "scatterTouchedSparsityEntries"
+        );
+    }
+    sortPaddedRows(mesh, rowStarts_, rowLengths_, touched, paddedCols_, paddedFaces_, sp);
+
+    if (rowOffsChanged)
+    {
+        sp.rowOffs().resize(nCells + 1);
+        sp.colIdxs().resize(segmentsFromIntervals(std::as_const(rowLengths_), sp.rowOffs()));
+    }
+    copyPaddedRows(exec, rowStarts_, rowLengths_, paddedCols_, touched, rowOffsChanged, sp);
+
+    return {
+        nTouched,
+        rowOffsChanged,
+        false,
+        nTouched > 0 ? topologyCaches(rowOffsChanged) : std::vector<std::string> {}
+    };
+}
+
+std::vector<std::string> IncrementalSparsityPattern::topologyCaches(bool rowOffsChanged)
+{
+    std::vector<std::string> caches {
+        "SparsityPattern",
+        "CellToFaceStencil",
+        "CellToFaceStencilUniformSegmentSize",
+        "CellToCellStencil",
+        "ExtendedCellToCellStencil",
+        "CompressedConnectivity",
+        "FaceColoring",
+        "FaceBlocking",
+        "FaceDirection",
+        "FaceAgglomeration",
+        "MatrixColoring",
+        "LeastSquaresMatrices"
+    };
+    if (rowOffsChanged)
+    {
+        // the values of the systems and the structures of the solvers follow the row offsets
+        caches.emplace_back("LinearSystem");
+        caches.emplace_back("SolverCache");
+    }
+    return caches;
+}
+
 const NeoN::Array<uint8_t>& SparsityPattern::ownerOffset() const { return ownerOffset_; }
 
 const NeoN::Array<uint8_t>& SparsityPattern::neighbourOffset() const { return neighbourOffset_; }
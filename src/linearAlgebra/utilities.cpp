@@ -2,7 +2,10 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <cmath>
+
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/segmentedVector.hpp"
 #include "NeoN/linearAlgebra/utilities.hpp"
 
 
@@ -18,20 +21,292 @@ void computeResidual(
 {
     auto [res, b, x] = views(resV, bV, xV);
     const auto [coeffs, colIdxs, rowOffs] = mtx.view();
+    // the rows are the segments of the values, their entries are reduced by the vector lanes
+    const SegmentedVectorView<const scalar, const localIdx> rows {coeffs, rowOffs};
+
+    NeoN::parallelReduce<scalar>(
+        resV.exec(),
+        rows,
+        KOKKOS_LAMBDA(const localIdx, const localIdx coli, scalar& sum) {
+            sum += coeffs[coli] * x[colIdxs[coli]];
+        },
+        KOKKOS_LAMBDA(const localIdx rowi, const scalar sum) { res[rowi] = sum - b[rowi]; },
+        "computeResidual"
+    );
+}
+
+void computeResidual(
+    const SlicedEllMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& bV,
+    const Vector<scalar>& xV,
+    Vector<scalar>& resV
+)
+{
+    auto [res, b, x] = views(resV, bV, xV);
+    const auto mtxView = mtx.view();
 
     NeoN::parallelFor(
         resV.exec(),
         {0, resV.size()},
         KOKKOS_LAMBDA(const localIdx rowi) {
-            auto rowStart = rowOffs[rowi];
-            auto rowEnd = rowOffs[rowi + 1];
+            const auto rowLength = mtxView.rowLength(rowi);
+            scalar sum = 0.0;
+            for (localIdx j = 0; j < rowLength; j++)
+            {
+                const auto offset = mtxView.offset(rowi, j);
+                sum += mtxView.values[offset] * x[mtxView.colIdxs[offset]];
+            }
+            res[rowi] = sum - b[rowi];
+        },
+        "computeResidualSlicedEll"
+    );
+}
+
+/* @brief adds the face coefficients of an LDU matrix times x to the rows of y */
+void addLduFaces(
+    const LduMatrix<scalar, localIdx>& mtx, const Vector<scalar>& xV, Vector<scalar>& yV
+)
+{
+    auto [y, x] = views(yV, xV);
+    const auto mtxView = mtx.view();
+
+    NeoN::parallelFor(
+        yV.exec(),
+        {0, static_cast<localIdx>(mtx.nFaces())},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            const auto own = mtxView.owner[facei];
+            const auto nei = mtxView.neighbour[facei];
+            Kokkos::atomic_add(&y[own], mtxView.upper[facei] * x[nei]);
+            Kokkos::atomic_add(&y[nei], mtxView.lower[facei] * x[own]);
+        },
+        "addLduFaces"
+    );
+}
+
+void computeResidual(
+    const LduMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& bV,
+    const Vector<scalar>& xV,
+    Vector<scalar>& resV
+)
+{
+    auto [res, b, x] = views(resV, bV, xV);
+    const auto diag = mtx.diag().view();
+
+    NeoN::parallelFor(
+        resV.exec(),
+        {0, resV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) { res[rowi] = diag[rowi] * x[rowi] - b[rowi]; },
+        "computeResidualLduDiagonal"
+    );
+    addLduFaces(mtx, xV, resV);
+}
+
+void computeResidual(
+    const LinearOperator<scalar>& op,
+    const Vector<scalar>& bV,
+    const Vector<scalar>& xV,
+    Vector<scalar>& resV
+)
+{
+    op.apply(xV, resV);
+    auto [res, b] = views(resV, bV);
+    NeoN::parallelFor(
+        resV.exec(),
+        {0, resV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) { res[rowi] -= b[rowi]; },
+        "computeResidualLinearOperator"
+    );
+}
+
+ResidualNorms computeNorms(const Vector<scalar>& resV)
+{
+    const auto res = resV.view();
+    ResidualNorms norms {0.0, 0.0, 0.0};
+    scalar squaredSum = 0.0;
+    Kokkos::Max<scalar> maxReducer(norms.linf);
+    parallelReduce(
+        resV.exec(),
+        {0, resV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi, scalar& l1, scalar& l2, scalar& linf) {
+            const scalar absRes = Kokkos::abs(res[rowi]);
+            l1 += absRes;
+            l2 += absRes * absRes;
+            linf = absRes > linf ? absRes : linf;
+        },
+        norms.l1,
+        squaredSum,
+        maxReducer,
+        "computeNorms"
+    );
+    norms.l2 = std::sqrt(squaredSum);
+    return norms;
+}
+
+ResidualNorms computeResidualNorms(
+    const CSRMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& bV,
+    const Vector<scalar>& xV,
+    Vector<scalar>& resV
+)
+{
+    auto [res, b, x] = views(resV, bV, xV);
+    const auto [coeffs, colIdxs, rowOffs] = mtx.view();
+    ResidualNorms norms {0.0, 0.0, 0.0};
+    scalar squaredSum = 0.0;
+    Kokkos::Max<scalar> maxReducer(norms.linf);
+
+    parallelReduce(
+        resV.exec(),
+        {0, resV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi, scalar& l1, scalar& l2, scalar& linf) {
             scalar sum = 0.0;
-            for (localIdx coli = rowStart; coli < rowEnd; coli++)
+            for (localIdx coli = rowOffs[rowi]; coli < rowOffs[rowi + 1]; coli++)
             {
                 sum += coeffs[coli] * x[colIdxs[coli]];
             }
             res[rowi] = sum - b[rowi];
-        }
+            const scalar absRes = Kokkos::abs(res[rowi]);
+            l1 += absRes;
+            l2 += absRes * absRes;
+            linf = absRes > linf ? absRes : linf;
+        },
+        norms.l1,
+        squaredSum,
+        maxReducer,
+        "computeResidualNorms::csr"
+    );
+    norms.l2 = std::sqrt(squaredSum);
+    return norms;
+}
+
+ResidualNorms computeResidualNorms(
+    const SlicedEllMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& bV,
+    const Vector<scalar>& xV,
+    Vector<scalar>& resV
+)
+{
+    auto [res, b, x] = views(resV, bV, xV);
+    const auto mtxView = mtx.view();
+    ResidualNorms norms {0.0, 0.0, 0.0};
+    scalar squaredSum = 0.0;
+    Kokkos::Max<scalar> maxReducer(norms.linf);
+
+    parallelReduce(
+        resV.exec(),
+        {0, resV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi, scalar& l1, scalar& l2, scalar& linf) {
+            const auto rowLength = mtxView.rowLength(rowi);
+            scalar sum = 0.0;
+            for (localIdx j = 0; j < rowLength; j++)
+            {
+                const auto offset = mtxView.offset(rowi, j);
+                sum += mtxView.values[offset] * x[mtxView.colIdxs[offset]];
+            }
+            res[rowi] = sum - b[rowi];
+            const scalar absRes = Kokkos::abs(res[rowi]);
+            l1 += absRes;
+            l2 += absRes * absRes;
+            linf = absRes > linf ? absRes : linf;
+        },
+        norms.l1,
+        squaredSum,
+        maxReducer,
+        "computeResidualNorms::slicedEll"
+    );
+    norms.l2 = std::sqrt(squaredSum);
+    return norms;
+}
+
+ResidualNorms computeResidualNorms(
+    const LduMatrix<scalar, localIdx>& mtx,
+    const Vector<scalar>& bV,
+    const Vector<scalar>& xV,
+    Vector<scalar>& resV
+)
+{
+    computeResidual(mtx, bV, xV, resV);
+    return computeNorms(resV);
+}
+
+void spmv(const CSRMatrix<scalar, localIdx>& mtx, const Vector<scalar>& xV, Vector<scalar>& yV)
+{
+    auto [y, x] = views(yV, xV);
+    const auto [coeffs, colIdxs, rowOffs] = mtx.view();
+    const SegmentedVectorView<const scalar, const localIdx> rows {coeffs, rowOffs};
+
+    NeoN::parallelReduce<scalar>(
+        yV.exec(),
+        rows,
+        KOKKOS_LAMBDA(const localIdx, const localIdx coli, scalar& sum) {
+            sum += coeffs[coli] * x[colIdxs[coli]];
+        },
+        KOKKOS_LAMBDA(const localIdx rowi, const scalar sum) { y[rowi] = sum; },
+        "spmv"
+    );
+}
+
+void spmv(
+    const SlicedEllMatrix<scalar, localIdx>& mtx, const Vector<scalar>& xV, Vector<scalar>& yV
+)
+{
+    auto [y, x] = views(yV, xV);
+    const auto mtxView = mtx.view();
+
+    NeoN::parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            const auto rowLength = mtxView.rowLength(rowi);
+            scalar sum = 0.0;
+            for (localIdx j = 0; j < rowLength; j++)
+            {
+                const auto offset = mtxView.offset(rowi, j);
+                sum += mtxView.values[offset] * x[mtxView.colIdxs[offset]];
+            }
+            y[rowi] = sum;
+        },
+        "spmvSlicedEll"
+    );
+}
+
+void spmv(const LduMatrix<scalar, localIdx>& mtx, const Vector<scalar>& xV, Vector<scalar>& yV)
+{
+    auto [y, x] = views(yV, xV);
+    const auto diag = mtx.diag().view();
+
+    NeoN::parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) { y[rowi] = diag[rowi] * x[rowi]; },
+        "spmvLduDiagonal"
+    );
+    addLduFaces(mtx, xV, yV);
+}
+
+scalar dot(const Vector<scalar>& aV, const Vector<scalar>& bV)
+{
+    const auto [a, b] = views(aV, bV);
+    scalar result = 0.0;
+    parallelReduce(
+        aV.exec(),
+        {0, aV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& sum) { sum += a[i] * b[i]; },
+        result,
+        "la::dot"
+    );
+    return result;
+}
+
+void axpby(scalar alpha, const Vector<scalar>& xV, scalar beta, Vector<scalar>& yV)
+{
+    auto [y, x] = views(yV, xV);
+    parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { y[i] = alpha * x[i] + beta * y[i]; },
+        "axpby"
     );
 }
 
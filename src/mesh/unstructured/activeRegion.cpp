@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/mesh/unstructured/activeRegion.hpp"
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN
+{
+
+/* @brief writes the indices of the nonzero flags in ascending order to compacted */
+static void compact(const Vector<localIdx>& flags, Vector<localIdx>& compacted)
+{
+    const auto exec = flags.exec();
+    Vector<localIdx> offsets(exec, flags.size());
+    const auto n = exclusiveScan(exec, flags.view(), offsets.view());
+    compacted.resize(n);
+    const auto [flagsV, offsetsV] = views(flags, offsets);
+    auto compactedV = compacted.view();
+    parallelFor(
+        exec,
+        {0, flagsV.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            if (flagsV[i] != 0)
+            {
+                compactedV[offsetsV[i]] = i;
+            }
+        },
+        "compactActiveRegion"
+    );
+}
+
+ActiveRegion::ActiveRegion(const UnstructuredMesh& mesh, const Vector<localIdx>& cellMask)
+    : cellMask_(mesh.exec(), 0), activeCells_(mesh.exec(), 0), inactiveCells_(mesh.exec(), 0),
+      activeFaces_(mesh.exec(), 0), version_(0)
+{
+    update(mesh, cellMask);
+}
+
+void ActiveRegion::update(const UnstructuredMesh& mesh, const Vector<localIdx>& cellMask)
+{
+    NF_ASSERT_EQUAL(cellMask.size(), mesh.nCells());
+    NF_ASSERT(cellMask.exec() == mesh.exec(), "The cell mask is not on the executor of the mesh.");
+    const auto exec = mesh.exec();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    cellMask_.resize(mesh.nCells());
+    Vector<localIdx> inactive(exec, mesh.nCells());
+    Vector<localIdx> faceMask(exec, nInternalFaces + mesh.nBoundaryFaces());
+
+    const auto [maskIn, owner, neighbour, faceCells] =
+        views(cellMask, mesh.faceOwner(), mesh.faceNeighbour(), mesh.boundaryMesh().faceCells());
+    auto [mask, inactiveV, faceMaskV] = views(cellMask_, inactive, faceMask);
+    parallelFor(
+        exec,
+        {0, mask.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            mask[celli] = maskIn[celli] != 0 ? 1 : 0;
+            inactiveV[celli] = 1 - mask[celli];
+        },
+        "activeRegionCells"
+    );
+    parallelFor(
+        exec,
+        {0, faceMaskV.size()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            if (facei < nInternalFaces)
+            {
+                faceMaskV[facei] = mask[owner[facei]] | mask[neighbour[facei]];
+            }
+            else
+            {
+                faceMaskV[facei] = mask[faceCells[facei - nInternalFaces]];
+            }
+        },
+        "activeRegionFaces"
+    );
+
+    compact(cellMask_, activeCells_);
+    compact(inactive, inactiveCells_);
+    compact(faceMask, activeFaces_);
+    version_++;
+}
+
+} // namespace NeoN
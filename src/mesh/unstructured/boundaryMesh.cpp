@@ -2,11 +2,32 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <utility>
+
 #include "NeoN/mesh/unstructured/boundaryMesh.hpp"
 
 namespace NeoN
 {
 
+namespace
+{
+
+/* @brief the patch index of every boundary face given the offsets of the patches */
+std::vector<localIdx> facePatchOf(const std::vector<localIdx>& offset)
+{
+    std::vector<localIdx> facePatch(offset.empty() ? 0 : static_cast<std::size_t>(offset.back()));
+    for (std::size_t patchi = 0; patchi + 1 < offset.size(); patchi++)
+    {
+        for (auto facei = offset[patchi]; facei < offset[patchi + 1]; facei++)
+        {
+            facePatch[static_cast<std::size_t>(facei)] = static_cast<localIdx>(patchi);
+        }
+    }
+    return facePatch;
+}
+
+}
+
 BoundaryMesh::BoundaryMesh(
     const Executor& exec,
     labelVector faceCells,
@@ -20,8 +41,25 @@ BoundaryMesh::BoundaryMesh(
     scalarVector deltaCoeffs,
     std::vector<localIdx> offset
 )
-    : exec_(exec), faceCells_(faceCells), Cf_(cf), Cn_(cn), Sf_(sf), magSf_(magSf), nf_(nf),
-      delta_(delta), weights_(weights), deltaCoeffs_(deltaCoeffs), offset_(offset) {};
+    : exec_(exec), faceCells_(std::move(faceCells)), Cf_(std::move(cf)), Cn_(std::move(cn)),
+      Sf_(std::move(sf)), magSf_(std::move(magSf)), nf_(std::move(nf)), delta_(std::move(delta)),
+      weights_(std::move(weights)), deltaCoeffs_(std::move(deltaCoeffs)),
+      offset_(std::move(offset)), patchOffsets_(exec, offset_),
+      facePatch_(exec, facePatchOf(offset_)) {};
+
+void BoundaryMesh::updateGeometry(const BoundaryMesh& other)
+{
+    NF_ASSERT(other.offset_ == offset_, "The boundary faces of the moved mesh differ.");
+    NF_ASSERT_EQUAL(other.faceCells_.size(), faceCells_.size());
+    Cf_ = other.Cf_;
+    Cn_ = other.Cn_;
+    Sf_ = other.Sf_;
+    magSf_ = other.magSf_;
+    nf_ = other.nf_;
+    delta_ = other.delta_;
+    weights_ = other.weights_;
+    deltaCoeffs_ = other.deltaCoeffs_;
+}
 
 // Accessor methods
 const labelVector& BoundaryMesh::faceCells() const { return faceCells_; }
@@ -100,5 +138,27 @@ View<const scalar> BoundaryMesh::deltaCoeffs(const localIdx i) const
 
 const std::vector<localIdx>& BoundaryMesh::offset() const { return offset_; }
 
+const localIdxVector& BoundaryMesh::patchOffsets() const { return patchOffsets_; }
+
+const localIdxVector& BoundaryMesh::facePatch() const { return facePatch_; }
+
+void BoundaryMesh::reportMemory(MemoryReport& report) const
+{
+    const std::string geometry = "mesh geometry";
+    report.add(geometry, "boundary face centres", Cf_.memoryBytes());
+    report.add(geometry, "boundary cell centres", Cn_.memoryBytes());
+    report.add(geometry, "boundary face areas", Sf_.memoryBytes() + magSf_.memoryBytes());
+    report.add(geometry, "boundary face normals", nf_.memoryBytes());
+    report.add(geometry, "boundary deltas", delta_.memoryBytes());
+    report.add(geometry, "boundary weights", weights_.memoryBytes() + deltaCoeffs_.memoryBytes());
+    const std::string connectivity = "mesh connectivity";
+    report.add(connectivity, "boundary face cells", faceCells_.memoryBytes());
+    report.add(
+        connectivity,
+        "boundary offsets",
+        memoryBytes(offset_) + patchOffsets_.memoryBytes() + facePatch_.memoryBytes()
+    );
+}
+
 
 } // namespace NeoN
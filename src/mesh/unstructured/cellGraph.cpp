@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <numeric>
+
+#include "NeoN/mesh/unstructured/cellGraph.hpp"
+
+namespace NeoN
+{
+
+CellGraph createCellGraph(const UnstructuredMesh& mesh)
+{
+    const auto nCells = mesh.nCells();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto [owner, neighbour] = views(mesh.hostFaceOwner(), mesh.hostFaceNeighbour());
+
+    CellGraph graph {std::vector<localIdx>(nCells + 1, 0), {}};
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        graph.offsets[static_cast<localIdx>(owner[facei]) + 1]++;
+        graph.offsets[static_cast<localIdx>(neighbour[facei]) + 1]++;
+    }
+    std::partial_sum(graph.offsets.begin(), graph.offsets.end(), graph.offsets.begin());
+
+    graph.adjacency.resize(graph.offsets[nCells]);
+    std::vector<localIdx> pos(graph.offsets.begin(), graph.offsets.end() - 1);
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        const auto own = static_cast<localIdx>(owner[facei]);
+        const auto nei = static_cast<localIdx>(neighbour[facei]);
+        graph.adjacency[pos[own]++] = nei;
+        graph.adjacency[pos[nei]++] = own;
+    }
+    return graph;
+}
+
+} // namespace NeoN
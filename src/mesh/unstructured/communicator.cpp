@@ -2,18 +2,169 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+#include <iterator>
+
 #include "NeoN/mesh/unstructured/communicator.hpp"
 
 namespace NeoN
 {
 
+FlatCommMap flatten(const CommMap& commMap)
+{
+    FlatCommMap flat;
+    flat.rankOffsets.reserve(commMap.size() + 1);
+    flat.rankOffsets.push_back(0);
+    for (const auto& rankMap : commMap)
+    {
+        for (const auto& node : rankMap)
+        {
+            flat.indices.push_back(static_cast<localIdx>(node.local_idx));
+        }
+        flat.rankOffsets.push_back(static_cast<localIdx>(flat.indices.size()));
+    }
+    return flat;
+}
+
 bool Communicator::isComplete(std::string commName)
 {
+    ScopedTimer timer("Communicator::isComplete");
+    ScopedTimer commTimer(commName);
     NF_DEBUG_ASSERT(
         CommBuffer_.find(commName) != CommBuffer_.end(),
         "No communication buffer associated with key: " << commName
     );
-    return CommBuffer_[commName]->isComplete();
+    const bool complete = CommBuffer_[commName]->isComplete();
+    if (!complete)
+    {
+        statistics_[commName].incompleteTests++;
+        TimerRegistry::instance().count("incomplete", 1.0);
+    }
+    return complete;
+}
+
+const CommStatistics& Communicator::statistics(const std::string& commName) const
+{
+    auto stats = statistics_.find(commName);
+    NF_ASSERT(stats != statistics_.end(), "No statistics associated with key: " << commName);
+    return stats->second;
+}
+
+void Communicator::setPrecision(const std::string& commName, CommPrecision precision)
+{
+    NF_DEBUG_ASSERT(
+        CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
+        "There is an ongoing communication for key " << commName << "."
+    );
+    precisions_[commName] = precision;
+}
+
+void Communicator::releaseComm(const std::string& commName)
+{
+    NF_DEBUG_ASSERT(
+        CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
+        "There is an ongoing communication for key " << commName << "."
+    );
+    CommBuffer_.erase(commName);
+    reservedBuffers_.erase(commName);
+    aggregatedComms_.erase(commName);
+    precisions_.erase(commName);
+}
+
+CommPrecision Communicator::precision(const std::string& commName) const
+{
+    auto precision = precisions_.find(commName);
+    return precision == precisions_.end() ? defaultPrecision_ : precision->second;
+}
+
+void Communicator::recordStart(CommStatistics& stats, const bufferType& buffer)
+{
+    const auto& send = buffer.sendBuffer().neighbours();
+    const auto& receive = buffer.receiveBuffer().neighbours();
+    std::vector<std::size_t> ranks;
+    std::set_union(
+        send.begin(), send.end(), receive.begin(), receive.end(), std::back_inserter(ranks)
+    );
+    const auto bytes = buffer.sendBuffer().rankOffsets().back();
+    stats.exchanges++;
+    stats.bytesSent += bytes;
+    stats.messagesSent += send.size();
+    stats.neighbours = ranks.size();
+    auto& timers = TimerRegistry::instance();
+    timers.count("bytesSent", static_cast<double>(bytes));
+    timers.count("messagesSent", static_cast<double>(send.size()));
+}
+
+void Communicator::recordFinalise(CommStatistics& stats, const bufferType& buffer)
+{
+    const auto bytes = buffer.receiveBuffer().rankOffsets().back();
+    const auto messages = buffer.receiveBuffer().neighbours().size();
+    stats.bytesReceived += bytes;
+    stats.messagesReceived += messages;
+    auto& timers = TimerRegistry::instance();
+    timers.count("bytesReceived", static_cast<double>(bytes));
+    timers.count("messagesReceived", static_cast<double>(messages));
+}
+
+void Communicator::setNeighbourhoodCollectives(bool enable)
+{
+    if (!enable)
+    {
+        topology_.reset();
+        return;
+    }
+    if (!topology_)
+    {
+        topology_ = std::make_unique<mpi::NeighbourhoodTopology>(
+            mpiEnviron_, rankSizes(send_), rankSizes(receive_)
+        );
+    }
+}
+
+void Communicator::setSharedMemoryExchange(bool enable, std::size_t maxEntryBytes)
+{
+    if (!enable)
+    {
+        sharedMemory_.reset();
+        return;
+    }
+    sharedEntryBytes_ = maxEntryBytes;
+    if (!sharedMemory_)
+    {
+        sharedMemory_ = std::make_unique<mpi::SharedMemoryNode>(mpiEnviron_);
+    }
+}
+
+#ifdef NF_WITH_NCCL
+void Communicator::setNcclExchange(bool enable)
+{
+    if (!enable)
+    {
+        nccl_.reset();
+        return;
+    }
+    if (!nccl_)
+    {
+        nccl_ = std::make_unique<mpi::NcclCommunicator>(mpiEnviron_);
+    }
+}
+#endif
+
+void Communicator::setProgressThread(bool enable, std::chrono::microseconds interval)
+{
+    progressThread_.reset();
+    if (enable)
+    {
+        progressThread_ = std::make_unique<mpi::ProgressThread>(mpiEnviron_, interval);
+    }
+}
+
+void Communicator::progress()
+{
+    for (auto& [commName, buffer] : CommBuffer_)
+    {
+        if (buffer) buffer->isComplete();
+    }
 }
 
 Communicator::bufferType* Communicator::findDuplexBuffer()
@@ -25,15 +176,105 @@ Communicator::bufferType* Communicator::findDuplexBuffer()
 
 Communicator::bufferType* Communicator::createNewDuplexBuffer()
 {
-    // determine buffer size.
-    std::vector<std::size_t> rankSendSize(mpiEnviron_.sizeRank());
-    std::vector<std::size_t> rankReceiveSize(mpiEnviron_.sizeRank());
-    for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
+    buffers.emplace_back(mpiEnviron_, rankSizes(send_), rankSizes(receive_));
+    return &buffers.back();
+}
+
+std::vector<std::size_t> Communicator::rankSizes(const FlatCommMap& commMap)
+{
+    const auto& offsets = commMap.rankOffsets;
+    std::vector<std::size_t> rankSize(offsets.size() - 1);
+    for (size_t rank = 0; rank < rankSize.size(); ++rank)
     {
-        rankSendSize[rank] = sendMap_[rank].size();
-        rankReceiveSize[rank] = receiveMap_[rank].size();
+        rankSize[rank] = static_cast<std::size_t>(offsets[rank + 1] - offsets[rank]);
     }
-    buffers.emplace_back(mpi::FullDuplexCommBuffer(mpiEnviron_, rankSendSize, rankReceiveSize));
-    return &buffers.back();
+    return rankSize;
+}
+
+Communicator::AggregatedComm& Communicator::aggregatedComm(
+    const std::string& commName, const std::vector<std::size_t>& typeSizes, const Executor& exec
+)
+{
+    auto& aggregated = aggregatedComms_[commName];
+    if (aggregated.typeSizes == typeSizes && !aggregated.sendOffsets.empty()
+        && aggregated.sendOffsets.front().exec() == exec
+        && aggregated.buffer.exec() == bufferExecutor(exec))
+    {
+        return aggregated;
+    }
+    NF_DEBUG_ASSERT(!aggregated.buffer.isCommInit(), "Aggregated communication is ongoing.");
+    std::vector<std::size_t> sendBytes;
+    std::vector<std::size_t> receiveBytes;
+    aggregated.typeSizes = typeSizes;
+    aggregated.sendOffsets = aggregatedOffsets(send_, typeSizes, exec, sendBytes);
+    aggregated.receiveOffsets = aggregatedOffsets(receive_, typeSizes, exec, receiveBytes);
+    aggregated.buffer.setMPIEnvironment(mpiEnviron_);
+    aggregated.buffer.setExecutor(bufferExecutor(exec));
+    aggregated.buffer.setCommRankSize<char>(sendBytes, receiveBytes);
+    return aggregated;
+}
+
+std::vector<Vector<localIdx>> Communicator::aggregatedOffsets(
+    const FlatCommMap& commMap,
+    const std::vector<std::size_t>& typeSizes,
+    const Executor& exec,
+    std::vector<std::size_t>& rankBytes
+)
+{
+    const auto nRanks = commMap.rankOffsets.size() - 1;
+    const auto nodes = rankSizes(commMap);
+    std::vector<std::vector<localIdx>> offsets(typeSizes.size(), std::vector<localIdx>(nRanks));
+    rankBytes.assign(nRanks, 0);
+    std::size_t rankOffset = 0; // the byte offset of the rank data in the buffer
+    std::size_t rankStart = 0;  // the first flattened index of the rank
+    for (size_t rank = 0; rank < nRanks; ++rank)
+    {
+        const auto nNodes = nodes[rank];
+        std::size_t bytes = 0;
+        for (size_t fieldi = 0; fieldi < typeSizes.size(); ++fieldi)
+        {
+            // shifted by the first flattened index, such that the flattened index i is stored
+            // at offset + i * typeSize
+            offsets[fieldi][rank] = static_cast<localIdx>(rankOffset + bytes)
+                                  - static_cast<localIdx>(rankStart * typeSizes[fieldi]);
+            const auto segment = nNodes * typeSizes[fieldi];
+            bytes += (segment + aggregateAlignment - 1) / aggregateAlignment * aggregateAlignment;
+        }
+        rankBytes[rank] = bytes;
+        rankOffset += bytes;
+        rankStart += nNodes;
+    }
+
+    std::vector<Vector<localIdx>> execOffsets;
+    for (const auto& fieldOffsets : offsets)
+    {
+        execOffsets.emplace_back(exec, fieldOffsets);
+    }
+    return execOffsets;
+}
+
+std::vector<localIdx> Communicator::flattenRanks(const FlatCommMap& commMap)
+{
+    const auto& offsets = commMap.rankOffsets;
+    std::vector<localIdx> ranks(commMap.indices.size());
+    for (size_t rank = 0; rank + 1 < offsets.size(); ++rank)
+    {
+        const auto first = ranks.begin() + offsets[rank];
+        std::fill(first, ranks.begin() + offsets[rank + 1], static_cast<localIdx>(rank));
+    }
+    return ranks;
+}
+
+const Vector<localIdx>& Communicator::indices(
+    const std::vector<localIdx>& hostIdx,
+    std::unique_ptr<Vector<localIdx>>& execIdx,
+    const Executor& exec
+)
+{
+    if (!execIdx || execIdx->exec() != exec)
+    {
+        execIdx = std::make_unique<Vector<localIdx>>(exec, hostIdx);
+    }
+    return *execIdx;
 }
 };
@@ -0,0 +1,460 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <tuple>
+
+#include "NeoN/mesh/unstructured/decomposition.hpp"
+#include "NeoN/mesh/unstructured/cellGraph.hpp"
+
+#include "NeoN/core/primitives/vec3.hpp" // for Vec3
+
+namespace NeoN
+{
+
+namespace
+{
+
+/* @brief appends the component of start, restricted to the cells marked with subsetStamp, in
+ * breadth first order
+ */
+void appendComponent(
+    const CellGraph& graph,
+    localIdx start,
+    const std::vector<localIdx>& subset,
+    localIdx subsetStamp,
+    std::vector<localIdx>& visited,
+    localIdx visitStamp,
+    std::vector<localIdx>& order
+)
+{
+    auto head = order.size();
+    visited[start] = visitStamp;
+    order.push_back(start);
+    for (; head < order.size(); head++)
+    {
+        const auto celli = order[head];
+        for (auto i = graph.offsets[celli]; i < graph.offsets[celli + 1]; i++)
+        {
+            const auto cellj = graph.adjacency[i];
+            if (subset[cellj] == subsetStamp && visited[cellj] != visitStamp)
+            {
+                visited[cellj] = visitStamp;
+                order.push_back(cellj);
+            }
+        }
+    }
+}
+
+/* @brief recursively bisects cells into the parts [firstPart, firstPart + nParts) */
+void bisect(
+    const CellGraph& graph,
+    const std::vector<scalar>& weights,
+    std::vector<localIdx> cells,
+    label firstPart,
+    localIdx nParts,
+    std::vector<localIdx>& subset,
+    std::vector<localIdx>& visited,
+    localIdx& stamp,
+    std::vector<label>& cellToPart
+)
+{
+    if (nParts == 1 || cells.size() <= 1)
+    {
+        for (auto celli : cells)
+        {
+            cellToPart[celli] = firstPart;
+        }
+        return;
+    }
+
+    const auto subsetStamp = ++stamp;
+    for (auto celli : cells)
+    {
+        subset[celli] = subsetStamp;
+    }
+
+    // every component is started from the last cell of a search from its first cell, which is
+    // a peripheral cell of the component
+    const auto orderStamp = ++stamp;
+    std::vector<localIdx> order;
+    order.reserve(cells.size());
+    std::vector<localIdx> probe;
+    for (auto celli : cells)
+    {
+        if (visited[celli] == orderStamp) continue;
+        probe.clear();
+        appendComponent(graph, celli, subset, subsetStamp, visited, ++stamp, probe);
+        appendComponent(graph, probe.back(), subset, subsetStamp, visited, orderStamp, order);
+    }
+
+    const auto nLeft = nParts / 2;
+    scalar total = 0.0;
+    for (auto celli : order)
+    {
+        total += weights[celli];
+    }
+    const auto target = total * static_cast<scalar>(nLeft) / static_cast<scalar>(nParts);
+    std::size_t split = 0;
+    scalar sum = 0.0;
+    while (split < order.size() - 1 && sum + 0.5 * weights[order[split]] < target)
+    {
+        sum += weights[order[split]];
+        split++;
+    }
+    split = std::max<std::size_t>(split, 1);
+
+    std::vector<localIdx> right(order.begin() + static_cast<std::ptrdiff_t>(split), order.end());
+    order.resize(split);
+    bisect(graph, weights, std::move(order), firstPart, nLeft, subset, visited, stamp, cellToPart);
+    bisect(
+        graph,
+        weights,
+        std::move(right),
+        firstPart + static_cast<label>(nLeft),
+        nParts - nLeft,
+        subset,
+        visited,
+        stamp,
+        cellToPart
+    );
+}
+
+/* @brief a face shared with another part */
+struct ProcessorFace
+{
+    label neighbourPart; /* the part of the remote cell */
+    localIdx facei;      /* the original face */
+    localIdx localCell;  /* the original index of the local cell */
+    localIdx remoteCell; /* the original index of the remote cell */
+    bool flip;           /* whether the local cell is the neighbour of the original face */
+};
+
+}
+
+std::vector<label> partitionCells(
+    const UnstructuredMesh& mesh, localIdx nParts, const std::vector<scalar>& cellWeights
+)
+{
+    const auto nCells = mesh.nCells();
+    NF_ASSERT(nParts > 0, "The number of parts needs to be positive.");
+    NF_ASSERT(
+        cellWeights.empty() || static_cast<localIdx>(cellWeights.size()) == nCells,
+        "The number of cell weights does not match the number of cells."
+    );
+    const auto weights = cellWeights.empty() ? std::vector<scalar>(nCells, 1.0) : cellWeights;
+    const auto graph = createCellGraph(mesh);
+
+    std::vector<localIdx> cells(nCells);
+    std::iota(cells.begin(), cells.end(), 0);
+    std::vector<localIdx> subset(nCells, 0);
+    std::vector<localIdx> visited(nCells, 0);
+    localIdx stamp = 0;
+    std::vector<label> cellToPart(nCells, 0);
+    bisect(graph, weights, std::move(cells), 0, nParts, subset, visited, stamp, cellToPart);
+    return cellToPart;
+}
+
+DecomposedMesh decomposeMesh(
+    const UnstructuredMesh& mesh,
+    const std::vector<label>& cellToPart,
+    label part,
+    HaloLayout layout
+)
+{
+    const auto exec = mesh.exec();
+    const auto nCells = mesh.nCells();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    NF_ASSERT_EQUAL(static_cast<localIdx>(cellToPart.size()), nCells);
+    const auto nParts =
+        static_cast<std::size_t>(*std::max_element(cellToPart.begin(), cellToPart.end())) + 1;
+
+    const auto [owner, neighbour, cellVolumes, cellCentres, faceAreas, faceCentres, magFaceAreas] =
+        views(
+            mesh.hostFaceOwner(),
+            mesh.hostFaceNeighbour(),
+            mesh.hostCellVolumes(),
+            mesh.hostCellCentres(),
+            mesh.hostFaceAreas(),
+            mesh.hostFaceCentres(),
+            mesh.hostMagFaceAreas()
+        );
+
+    const auto& bMesh = mesh.boundaryMesh();
+    const auto& faceCellsHost = mesh.hostFaceCells();
+    const auto cfHost = bMesh.cf().copyToHost();
+    const auto cnHost = bMesh.cn().copyToHost();
+    const auto sfHost = bMesh.sf().copyToHost();
+    const auto magSfHost = bMesh.magSf().copyToHost();
+    const auto nfHost = bMesh.nf().copyToHost();
+    const auto deltaHost = bMesh.delta().copyToHost();
+    const auto weightsHost = bMesh.weights().copyToHost();
+    const auto deltaCoeffsHost = bMesh.deltaCoeffs().copyToHost();
+    const auto [faceCells, cf, cn, sf, magSf, nf, delta, weights, deltaCoeffs] = views(
+        faceCellsHost,
+        cfHost,
+        cnHost,
+        sfHost,
+        magSfHost,
+        nfHost,
+        deltaHost,
+        weightsHost,
+        deltaCoeffsHost
+    );
+
+    // local cells keep their original order
+    std::vector<label> cellMap;
+    std::vector<label> localCell(nCells, -1);
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        if (cellToPart[celli] != part) continue;
+        localCell[celli] = static_cast<label>(cellMap.size());
+        cellMap.push_back(static_cast<label>(celli));
+    }
+    const auto nLocalCells = static_cast<localIdx>(cellMap.size());
+
+    std::vector<label> faceMap;
+    std::vector<label> localOwner;
+    std::vector<label> localNeighbour;
+    std::vector<Vec3> localFaceAreas;
+    std::vector<Vec3> localFaceCentres;
+    std::vector<scalar> localMagFaceAreas;
+    const auto addFace = [&](localIdx facei, label local, const Vec3& area)
+    {
+        faceMap.push_back(static_cast<label>(facei));
+        localOwner.push_back(local);
+        localFaceAreas.push_back(area);
+        localFaceCentres.push_back(faceCentres[facei]);
+        localMagFaceAreas.push_back(magFaceAreas[facei]);
+    };
+
+    std::vector<ProcessorFace> processorFaces;
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        const auto own = static_cast<localIdx>(owner[facei]);
+        const auto nei = static_cast<localIdx>(neighbour[facei]);
+        const bool ownLocal = cellToPart[own] == part;
+        const bool neiLocal = cellToPart[nei] == part;
+        if (ownLocal && neiLocal)
+        {
+            addFace(facei, localCell[own], faceAreas[facei]);
+            localNeighbour.push_back(localCell[nei]);
+        }
+        else if (ownLocal)
+        {
+            processorFaces.push_back({cellToPart[nei], facei, own, nei, false});
+        }
+        else if (neiLocal)
+        {
+            processorFaces.push_back({cellToPart[own], facei, nei, own, true});
+        }
+    }
+    std::stable_sort(
+        processorFaces.begin(),
+        processorFaces.end(),
+        [](const ProcessorFace& a, const ProcessorFace& b)
+        { return std::tie(a.neighbourPart, a.facei) < std::tie(b.neighbourPart, b.facei); }
+    );
+    const auto nProcessorFaces = static_cast<localIdx>(processorFaces.size());
+
+    // the remote cell of processor face i is the halo cell nLocalCells + i
+    std::vector<std::vector<label>> sendCells(nParts);
+    std::vector<std::vector<label>> receiveCells(nParts);
+    auto halo = static_cast<label>(nLocalCells);
+    for (const auto& pFace : processorFaces)
+    {
+        sendCells[static_cast<std::size_t>(pFace.neighbourPart)].push_back(
+            localCell[pFace.localCell]
+        );
+        receiveCells[static_cast<std::size_t>(pFace.neighbourPart)].push_back(halo++);
+    }
+
+    const bool ghostCells = layout == HaloLayout::GhostCells;
+    if (ghostCells)
+    {
+        auto ghost = static_cast<label>(nLocalCells);
+        for (const auto& pFace : processorFaces)
+        {
+            const auto facei = pFace.facei;
+            const Vec3 area = pFace.flip ? -1.0 * faceAreas[facei] : faceAreas[facei];
+            addFace(facei, localCell[pFace.localCell], area);
+            localNeighbour.push_back(ghost++);
+        }
+    }
+    const auto nLocalInternalFaces = static_cast<localIdx>(faceMap.size());
+
+    // the boundary data of the original patches and the processor patch
+    std::vector<label> bFaceCells;
+    std::vector<Vec3> bCf, bCn, bSf, bNf, bDelta;
+    std::vector<scalar> bMagSf, bWeights, bDeltaCoeffs;
+    std::vector<localIdx> offset {0};
+    const auto& patchOffset = bMesh.offset();
+    for (std::size_t patchi = 0; patchi + 1 < patchOffset.size(); patchi++)
+    {
+        for (auto bfacei = patchOffset[patchi]; bfacei < patchOffset[patchi + 1]; bfacei++)
+        {
+            const auto celli = static_cast<localIdx>(faceCells[bfacei]);
+            if (cellToPart[celli] != part) continue;
+            const auto facei = nInternalFaces + bfacei;
+            addFace(facei, localCell[celli], faceAreas[facei]);
+            bFaceCells.push_back(localCell[celli]);
+            bCf.push_back(cf[bfacei]);
+            bCn.push_back(cn[bfacei]);
+            bSf.push_back(sf[bfacei]);
+            bMagSf.push_back(magSf[bfacei]);
+            bNf.push_back(nf[bfacei]);
+            bDelta.push_back(delta[bfacei]);
+            bWeights.push_back(weights[bfacei]);
+            bDeltaCoeffs.push_back(deltaCoeffs[bfacei]);
+        }
+        offset.push_back(static_cast<localIdx>(bFaceCells.size()));
+    }
+
+    std::vector<std::vector<label>> sendFaces(nParts);
+    std::vector<std::vector<label>> receiveFaces(nParts);
+    // with ghost cells there is no processor patch
+    const std::vector<ProcessorFace> noFaces;
+    for (const auto& pFace : ghostCells ? noFaces : processorFaces)
+    {
+        const auto facei = pFace.facei;
+        const auto local = localCell[pFace.localCell];
+        const Vec3 area = pFace.flip ? -1.0 * faceAreas[facei] : faceAreas[facei];
+        const Vec3 c = cellCentres[pFace.localCell];
+        const Vec3 cRemote = cellCentres[pFace.remoteCell];
+        const scalar sfdOwn = std::abs(area & (faceCentres[facei] - c));
+        const scalar sfdNei = std::abs(area & (cRemote - faceCentres[facei]));
+
+        // the face order agrees on both parts, the part of lower index owns the face value
+        auto& faces = part < pFace.neighbourPart ? sendFaces : receiveFaces;
+        faces[static_cast<std::size_t>(pFace.neighbourPart)].push_back(
+            static_cast<label>(bFaceCells.size())
+        );
+        addFace(facei, local, area);
+        bFaceCells.push_back(local);
+        bCf.push_back(faceCentres[facei]);
+        bCn.push_back(cRemote);
+        bSf.push_back(area);
+        bMagSf.push_back(magFaceAreas[facei]);
+        bNf.push_back((1.0 / magFaceAreas[facei]) * area);
+        bDelta.push_back(cRemote - c);
+        bWeights.push_back(sfdOwn + sfdNei > ROOTVSMALL ? sfdNei / (sfdOwn + sfdNei) : 0.5);
+        bDeltaCoeffs.push_back(1.0 / mag(cRemote - c));
+    }
+    if (!ghostCells)
+    {
+        offset.push_back(static_cast<localIdx>(bFaceCells.size()));
+    }
+
+    const auto nLocalFaces = static_cast<localIdx>(faceMap.size());
+    std::vector<scalar> localVolumes;
+    std::vector<Vec3> localCentres;
+    for (const auto celli : cellMap)
+    {
+        localVolumes.push_back(cellVolumes[static_cast<localIdx>(celli)]);
+        localCentres.push_back(cellCentres[static_cast<localIdx>(celli)]);
+    }
+    // the ghost cells hold the geometry of the remote cells
+    for (const auto& pFace : ghostCells ? processorFaces : noFaces)
+    {
+        localVolumes.push_back(cellVolumes[pFace.remoteCell]);
+        localCentres.push_back(cellCentres[pFace.remoteCell]);
+    }
+    BoundaryMesh boundaryMesh(
+        exec,
+        labelVector(exec, bFaceCells),
+        vectorVector(exec, bCf),
+        vectorVector(exec, bCn),
+        vectorVector(exec, bSf),
+        scalarVector(exec, bMagSf),
+        vectorVector(exec, bNf),
+        vectorVector(exec, bDelta),
+        scalarVector(exec, bWeights),
+        scalarVector(exec, bDeltaCoeffs),
+        offset
+    );
+
+    UnstructuredMesh localMesh(
+        mesh.points(),
+        scalarVector(exec, localVolumes),
+        vectorVector(exec, localCentres),
+        vectorVector(exec, localFaceAreas),
+        vectorVector(exec, localFaceCentres),
+        scalarVector(exec, localMagFaceAreas),
+        labelVector(exec, localOwner),
+        labelVector(exec, localNeighbour),
+        nLocalCells,
+        nLocalInternalFaces,
+        nLocalFaces - nLocalInternalFaces,
+        static_cast<localIdx>(offset.size()) - 1,
+        nLocalFaces,
+        boundaryMesh
+    );
+    if (ghostCells)
+    {
+        localMesh.setGhostCells(nProcessorFaces);
+    }
+
+    return {
+        std::move(localMesh),
+        labelVector(exec, cellMap),
+        labelVector(exec, faceMap),
+        std::move(sendCells),
+        std::move(receiveCells),
+        std::move(sendFaces),
+        std::move(receiveFaces)
+    };
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+namespace
+{
+
+/* @brief the communicator sending the local indices send and receiving into receive, per part */
+Communicator mapCommunicator(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const std::vector<std::vector<label>>& send,
+    const std::vector<std::vector<label>>& receive
+)
+{
+    const auto nRanks = mpiEnviron.sizeRank();
+    NF_ASSERT(send.size() <= nRanks, "More parts than MPI ranks.");
+    FlatCommMap sendMap {.rankOffsets = {0}, .indices = {}};
+    FlatCommMap receiveMap {.rankOffsets = {0}, .indices = {}};
+    for (std::size_t rank = 0; rank < nRanks; rank++)
+    {
+        if (rank < send.size())
+        {
+            for (auto idx : send[rank])
+            {
+                sendMap.indices.push_back(static_cast<localIdx>(idx));
+            }
+            for (auto idx : receive[rank])
+            {
+                receiveMap.indices.push_back(static_cast<localIdx>(idx));
+            }
+        }
+        sendMap.rankOffsets.push_back(static_cast<localIdx>(sendMap.indices.size()));
+        receiveMap.rankOffsets.push_back(static_cast<localIdx>(receiveMap.indices.size()));
+    }
+    return Communicator(mpiEnviron, std::move(sendMap), std::move(receiveMap));
+}
+
+}
+
+Communicator
+createCommunicator(const mpi::MPIEnvironment& mpiEnviron, const DecomposedMesh& decomposed)
+{
+    return mapCommunicator(mpiEnviron, decomposed.sendCells, decomposed.receiveCells);
+}
+
+Communicator
+createFaceCommunicator(const mpi::MPIEnvironment& mpiEnviron, const DecomposedMesh& decomposed)
+{
+    return mapCommunicator(mpiEnviron, decomposed.sendFaces, decomposed.receiveFaces);
+}
+#endif
+
+} // namespace NeoN
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <numeric>
+
+#include "NeoN/mesh/unstructured/loadBalancing.hpp"
+#include "NeoN/core/primitives/vec3.hpp" // for Vec3
+#include "NeoN/core/timer.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/operators.hpp"
+#include "NeoN/core/mpi/reductionBatch.hpp"
+#endif
+
+namespace NeoN
+{
+
+Redistribution createRedistribution(
+    const std::vector<label>& oldCellToPart, const std::vector<label>& newCellToPart, label part
+)
+{
+    NF_ASSERT_EQUAL(oldCellToPart.size(), newCellToPart.size());
+    label nParts = part + 1;
+    for (std::size_t celli = 0; celli < oldCellToPart.size(); celli++)
+    {
+        nParts = std::max({nParts, oldCellToPart[celli] + 1, newCellToPart[celli] + 1});
+    }
+    const auto n = static_cast<std::size_t>(nParts);
+    Redistribution result {
+        std::vector<std::vector<label>>(n), std::vector<std::vector<label>>(n), 0
+    };
+
+    // the local cells of a part are its cells in their original order
+    std::vector<label> oldLocal(n, 0);
+    std::vector<label> newLocal(n, 0);
+    for (std::size_t celli = 0; celli < oldCellToPart.size(); celli++)
+    {
+        const auto oldPart = static_cast<std::size_t>(oldCellToPart[celli]);
+        const auto newPart = static_cast<std::size_t>(newCellToPart[celli]);
+        if (oldCellToPart[celli] == part)
+        {
+            result.sendCells[newPart].push_back(oldLocal[oldPart]);
+        }
+        if (newCellToPart[celli] == part)
+        {
+            result.receiveCells[oldPart].push_back(newLocal[newPart]);
+        }
+        oldLocal[oldPart]++;
+        newLocal[newPart]++;
+    }
+    result.nCells = static_cast<localIdx>(newLocal[static_cast<std::size_t>(part)]);
+    return result;
+}
+
+scalar timerCost(const std::string& name)
+{
+    scalar cost = 0.0;
+    for (const auto& timer : TimerRegistry::instance().stats())
+    {
+        const auto pos = timer.path.rfind('/');
+        const auto timerName = pos == std::string::npos ? timer.path : timer.path.substr(pos + 1);
+        if (timerName == name)
+        {
+            cost += timer.total;
+        }
+    }
+    return cost;
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+scalar loadImbalance(const mpi::MPIEnvironment& mpiEnviron, scalar localCost)
+{
+    mpi::ReductionBatch batch(mpiEnviron.comm());
+    const auto maxIdx = batch.add(localCost, mpi::ReduceOp::Max);
+    const auto sumIdx = batch.add(localCost, mpi::ReduceOp::Sum);
+    batch.reduce();
+    const auto maxCost = batch.value(maxIdx);
+    const auto sumCost = batch.value(sumIdx);
+    const auto avgCost = sumCost / static_cast<scalar>(mpiEnviron.sizeRank());
+    return avgCost > 0.0 ? maxCost / avgCost - 1.0 : 0.0;
+}
+
+std::vector<scalar> gatherCellCosts(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const DecomposedMesh& decomposed,
+    localIdx nGlobalCells,
+    scalar localCost,
+    const std::vector<scalar>& localCellWeights
+)
+{
+    const auto nCells = decomposed.mesh.nCells();
+    NF_ASSERT(
+        localCellWeights.empty() || static_cast<localIdx>(localCellWeights.size()) == nCells,
+        "Expected " << nCells << " cell weights, got " << localCellWeights.size() << "."
+    );
+    const auto sumWeights = localCellWeights.empty()
+                              ? static_cast<scalar>(nCells)
+                              : std::accumulate(
+                                  localCellWeights.begin(), localCellWeights.end(), scalar(0.0)
+                              );
+
+    std::vector<scalar> costs(static_cast<std::size_t>(nGlobalCells), 0.0);
+    auto cellMap = decomposed.cellMap.copyToHost();
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        const auto weight =
+            localCellWeights.empty() ? 1.0 : localCellWeights[static_cast<std::size_t>(celli)];
+        const auto globalCelli = static_cast<std::size_t>(cellMap.view()[celli]);
+        costs[globalCelli] = sumWeights > 0.0 ? localCost * weight / sumWeights : 0.0;
+    }
+    MPI_Allreduce(
+        MPI_IN_PLACE,
+        costs.data(),
+        static_cast<int>(costs.size()),
+        mpi::getType<scalar>(),
+        MPI_SUM,
+        mpiEnviron.comm()
+    );
+    return costs;
+}
+
+std::vector<label> repartitionCells(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const UnstructuredMesh& mesh,
+    const DecomposedMesh& decomposed,
+    scalar localCost,
+    const std::vector<scalar>& localCellWeights
+)
+{
+    ScopedTimer timer("repartitionCells");
+    auto costs =
+        gatherCellCosts(mpiEnviron, decomposed, mesh.nCells(), localCost, localCellWeights);
+    // without any measured cost the cells are balanced by their number
+    if (std::all_of(costs.begin(), costs.end(), [](scalar cost) { return cost <= 0.0; }))
+    {
+        costs.clear();
+    }
+    return partitionCells(mesh, static_cast<localIdx>(mpiEnviron.sizeRank()), costs);
+}
+
+template<typename ValueType>
+Vector<ValueType> redistribute(
+    const mpi::MPIEnvironment& mpiEnviron,
+    const Redistribution& redistribution,
+    const Vector<ValueType>& values
+)
+{
+    ScopedTimer timer("redistribute");
+    const auto nParts = redistribution.sendCells.size();
+    const auto rank = mpiEnviron.rank();
+    NF_ASSERT(nParts <= mpiEnviron.sizeRank(), "More parts than MPI ranks.");
+    NF_ASSERT_EQUAL(redistribution.receiveCells.size(), nParts);
+
+    auto hostValues = values.copyToHost();
+    const auto oldValues = hostValues.view();
+    std::vector<ValueType> newValues(static_cast<std::size_t>(redistribution.nCells));
+    std::vector<std::vector<ValueType>> sendBuffers(nParts);
+    std::vector<std::vector<ValueType>> receiveBuffers(nParts);
+    // the requests are referenced by MPI until completion, hence they must not be reallocated
+    std::vector<MPI_Request> requests;
+    requests.reserve(2 * nParts);
+    const int tag = 7211;
+    for (std::size_t part = 0; part < nParts; part++)
+    {
+        const auto& sendCells = redistribution.sendCells[part];
+        const auto& receiveCells = redistribution.receiveCells[part];
+        if (part == rank)
+        {
+            for (std::size_t i = 0; i < sendCells.size(); i++)
+            {
+                newValues[static_cast<std::size_t>(receiveCells[i])] =
+                    oldValues[static_cast<localIdx>(sendCells[i])];
+            }
+            continue;
+        }
+        if (!receiveCells.empty())
+        {
+            receiveBuffers[part].resize(receiveCells.size());
+            requests.emplace_back();
+            mpi::irecv(
+                reinterpret_cast<char*>(receiveBuffers[part].data()),
+                static_cast<int>(receiveCells.size() * sizeof(ValueType)),
+                static_cast<int>(part),
+                tag,
+                mpiEnviron.comm(),
+                &requests.back()
+            );
+        }
+        if (!sendCells.empty())
+        {
+            auto& buffer = sendBuffers[part];
+            buffer.reserve(sendCells.size());
+            for (const auto celli : sendCells)
+            {
+                buffer.push_back(oldValues[static_cast<localIdx>(celli)]);
+            }
+            requests.emplace_back();
+            mpi::isend(
+                reinterpret_cast<const char*>(buffer.data()),
+                static_cast<int>(buffer.size() * sizeof(ValueType)),
+                static_cast<int>(part),
+                tag,
+                mpiEnviron.comm(),
+                &requests.back()
+            );
+        }
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+
+    std::size_t nBytes = 0;
+    for (std::size_t part = 0; part < nParts; part++)
+    {
+        const auto& receiveCells = redistribution.receiveCells[part];
+        for (std::size_t i = 0; part != rank && i < receiveCells.size(); i++)
+        {
+            newValues[static_cast<std::size_t>(receiveCells[i])] = receiveBuffers[part][i];
+        }
+        nBytes += sendBuffers[part].size() * sizeof(ValueType);
+    }
+    TimerRegistry::instance().count("sent bytes", static_cast<double>(nBytes));
+    return Vector<ValueType>(values.exec(), newValues);
+}
+
+#define NF_DECLARE_REDISTRIBUTE(TYPENAME)                                                          \
+    template Vector<TYPENAME> redistribute<TYPENAME>(                                              \
+        const mpi::MPIEnvironment&, const Redistribution&, const Vector<TYPENAME>&                 \
+    )
+
+NF_DECLARE_REDISTRIBUTE(scalar);
+NF_DECLARE_REDISTRIBUTE(Vec3);
+NF_DECLARE_REDISTRIBUTE(label);
+#endif
+
+} // namespace NeoN
@@ -0,0 +1,431 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <utility>
+
+#include "NeoN/mesh/unstructured/meshGeometry.hpp"
+#include "NeoN/core/atomic.hpp"
+#include "NeoN/core/timer.hpp"
+
+namespace NeoN
+{
+
+namespace
+{
+
+/* @brief the average of the points of a face */
+KOKKOS_INLINE_FUNCTION Vec3
+averagePoint(View<const Vec3> points, View<const label> facePoints, localIdx start, localIdx n)
+{
+    Vec3 centre(0.0, 0.0, 0.0);
+    for (localIdx i = 0; i < n; i++)
+    {
+        centre += points[static_cast<localIdx>(facePoints[start + i])];
+    }
+    return (1.0 / static_cast<scalar>(n)) * centre;
+}
+
+/* @brief computes the centre and the area of a face from a triangle decomposition of the face
+ * around its average point
+ */
+KOKKOS_INLINE_FUNCTION void faceGeometry(
+    View<const Vec3> points,
+    View<const label> facePoints,
+    localIdx start,
+    localIdx nPoints,
+    Vec3& cf,
+    Vec3& sf
+)
+{
+    const auto point = [&](localIdx i)
+    { return points[static_cast<localIdx>(facePoints[start + i])]; };
+    if (nPoints == 3)
+    {
+        cf = (1.0 / 3.0) * (point(0) + point(1) + point(2));
+        sf = 0.5 * cross(point(1) - point(0), point(2) - point(0));
+        return;
+    }
+    const auto centreEst = averagePoint(points, facePoints, start, nPoints);
+    Vec3 sumN(0.0, 0.0, 0.0);
+    scalar sumA = 0.0;
+    Vec3 sumAc(0.0, 0.0, 0.0);
+    for (localIdx i = 0; i < nPoints; i++)
+    {
+        const auto p = point(i);
+        const auto next = point((i + 1) % nPoints);
+        const auto n = cross(next - p, centreEst - p);
+        const auto a = mag(n);
+        sumN += n;
+        sumA += a;
+        sumAc += a * (p + next + centreEst);
+    }
+    cf = sumA < ROOTVSMALL ? centreEst : (1.0 / (3.0 * sumA)) * sumAc;
+    sf = 0.5 * sumN;
+}
+
+/* @brief the volume swept by the triangle a0, b0, c0 moving linearly to a1, b1, c1, positive if
+ * it moves along its normal
+ */
+KOKKOS_INLINE_FUNCTION scalar
+sweptVolume(Vec3 a0, Vec3 b0, Vec3 c0, Vec3 a1, Vec3 b1, Vec3 c1)
+{
+    return (1.0 / 12.0)
+         * (((a1 - a0) & cross(b0 - a0, c0 - a0)) + ((b1 - b0) & cross(c0 - b0, a1 - b0))
+            + ((c0 - c1) & cross(b1 - c1, a1 - c1)) + ((a1 - a0) & cross(b0 - a0, c0 - a0))
+            + ((b0 - b1) & cross(a1 - b1, c1 - b1)) + ((c0 - c1) & cross(b0 - c1, a1 - c1)));
+}
+
+/* @brief the volume swept by a face moving from the old to the new points, the same triangle
+ * decomposition around the average point as in faceGeometry is used
+ */
+KOKKOS_INLINE_FUNCTION scalar sweptVolume(
+    View<const Vec3> oldPoints,
+    View<const Vec3> points,
+    View<const label> facePoints,
+    localIdx start,
+    localIdx nPoints
+)
+{
+    const auto oldPoint = [&](localIdx i)
+    { return oldPoints[static_cast<localIdx>(facePoints[start + i])]; };
+    const auto point = [&](localIdx i)
+    { return points[static_cast<localIdx>(facePoints[start + i])]; };
+    if (nPoints == 3)
+    {
+        return sweptVolume(oldPoint(0), oldPoint(1), oldPoint(2), point(0), point(1), point(2));
+    }
+    const auto oldCentre = averagePoint(oldPoints, facePoints, start, nPoints);
+    const auto centre = averagePoint(points, facePoints, start, nPoints);
+    scalar volume = 0.0;
+    for (localIdx i = 0; i < nPoints; i++)
+    {
+        const auto next = (i + 1) % nPoints;
+        volume +=
+            sweptVolume(oldCentre, oldPoint(i), oldPoint(next), centre, point(i), point(next));
+    }
+    return volume;
+}
+
+/* @brief computes the centres and volumes of the cells from the face geometry
+ *
+ * The cells are decomposed into pyramids from the average of their face centres to their faces.
+ * If cellMask is not empty only the cells with a non zero mask are updated.
+ */
+void computeCellGeometry(
+    MeshGeometry& geometry,
+    const labelVector& faceOwner,
+    const labelVector& faceNeighbour,
+    const labelVector& cellMask
+)
+{
+    const auto exec = faceOwner.exec();
+    const auto nFaces = faceOwner.size();
+    const auto nInternalFaces = faceNeighbour.size();
+    const auto nCells = geometry.cellVolumes.size();
+
+    vectorVector centreEst(exec, nCells, Vec3(0.0, 0.0, 0.0));
+    scalarVector nCellFaces(exec, nCells, 0.0);
+    scalarVector cellVolumes(exec, nCells, 0.0);
+    vectorVector cellCentres(exec, nCells, Vec3(0.0, 0.0, 0.0));
+    auto [est, nCellFacesV, cf, owner, neighbour, mask] =
+        views(centreEst, nCellFaces, geometry.faceCentres, faceOwner, faceNeighbour, cellMask);
+    const bool allCells = mask.empty();
+    parallelFor(
+        exec,
+        {0, nFaces},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            const auto own = static_cast<localIdx>(owner[facei]);
+            if (allCells || mask[own] != 0)
+            {
+                atomicAdd(&est[own], cf[facei]);
+                Kokkos::atomic_add(&nCellFacesV[own], scalar(1.0));
+            }
+            if (facei < nInternalFaces)
+            {
+                const auto nei = static_cast<localIdx>(neighbour[facei]);
+                if (allCells || mask[nei] != 0)
+                {
+                    atomicAdd(&est[nei], cf[facei]);
+                    Kokkos::atomic_add(&nCellFacesV[nei], scalar(1.0));
+                }
+            }
+        },
+        "cellCentreEstimate"
+    );
+    parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            if (nCellFacesV[celli] > 0.0)
+            {
+                est[celli] = (1.0 / nCellFacesV[celli]) * est[celli];
+            }
+        },
+        "cellCentreEstimateAverage"
+    );
+
+    auto [vol, centres, sf] = views(cellVolumes, cellCentres, geometry.faceAreas);
+    parallelFor(
+        exec,
+        {0, nFaces},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            // three times the volume of the pyramids and their centroids
+            const auto own = static_cast<localIdx>(owner[facei]);
+            if (allCells || mask[own] != 0)
+            {
+                const auto ownVol = sf[facei] & (cf[facei] - est[own]);
+                Kokkos::atomic_add(&vol[own], ownVol);
+                atomicAdd(&centres[own], ownVol * (0.75 * cf[facei] + 0.25 * est[own]));
+            }
+            if (facei < nInternalFaces)
+            {
+                const auto nei = static_cast<localIdx>(neighbour[facei]);
+                if (allCells || mask[nei] != 0)
+                {
+                    const auto neiVol = sf[facei] & (est[nei] - cf[facei]);
+                    Kokkos::atomic_add(&vol[nei], neiVol);
+                    atomicAdd(&centres[nei], neiVol * (0.75 * cf[facei] + 0.25 * est[nei]));
+                }
+            }
+        },
+        "cellPyramids"
+    );
+
+    auto [cellVol, cellCentre] = views(geometry.cellVolumes, geometry.cellCentres);
+    parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            if (allCells || mask[celli] != 0)
+            {
+                cellCentre[celli] = Kokkos::abs(vol[celli]) > ROOTVSMALL
+                                      ? (1.0 / vol[celli]) * centres[celli]
+                                      : est[celli];
+                cellVol[celli] = (1.0 / 3.0) * vol[celli];
+            }
+        },
+        "cellGeometry"
+    );
+}
+
+}
+
+MeshGeometry computeMeshGeometry(
+    const vectorVector& points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    const labelVector& faceOwner,
+    const labelVector& faceNeighbour,
+    localIdx nCells
+)
+{
+    ScopedTimer timer("computeMeshGeometry", points.exec());
+    const auto exec = points.exec();
+    const auto nFaces = faceOwner.size();
+    NF_ASSERT_EQUAL(faceOffsets.size(), nFaces + 1);
+
+    MeshGeometry geometry {
+        vectorVector(exec, nFaces),
+        vectorVector(exec, nFaces),
+        scalarVector(exec, nFaces),
+        scalarVector(exec, nCells),
+        vectorVector(exec, nCells)
+    };
+    {
+        auto [sf, cf, magSf, pointsV, offs, facePointsV] = views(
+            geometry.faceAreas,
+            geometry.faceCentres,
+            geometry.magFaceAreas,
+            points,
+            faceOffsets,
+            facePoints
+        );
+        parallelFor(
+            exec,
+            {0, nFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto start = offs[facei];
+                const auto nPoints = offs[facei + 1] - start;
+                faceGeometry(pointsV, facePointsV, start, nPoints, cf[facei], sf[facei]);
+                magSf[facei] = mag(sf[facei]);
+            },
+            "faceGeometry"
+        );
+    }
+    computeCellGeometry(geometry, faceOwner, faceNeighbour, labelVector(exec, 0));
+    return geometry;
+}
+
+scalarVector updateMeshGeometry(
+    MeshGeometry& geometry,
+    const vectorVector& oldPoints,
+    const vectorVector& points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    const labelVector& faceOwner,
+    const labelVector& faceNeighbour
+)
+{
+    ScopedTimer timer("updateMeshGeometry", points.exec());
+    const auto exec = points.exec();
+    const auto nFaces = faceOwner.size();
+    const auto nInternalFaces = faceNeighbour.size();
+    NF_ASSERT_EQUAL(faceOffsets.size(), nFaces + 1);
+    NF_ASSERT_EQUAL(oldPoints.size(), points.size());
+    NF_ASSERT_EQUAL(geometry.faceAreas.size(), nFaces);
+
+    scalarVector sweptVolumes(exec, nFaces, 0.0);
+    labelVector cellMoved(exec, geometry.cellVolumes.size(), 0);
+    {
+        auto [sf, cf, magSf, swept, moved] = views(
+            geometry.faceAreas, geometry.faceCentres, geometry.magFaceAreas, sweptVolumes, cellMoved
+        );
+        auto [oldPointsV, pointsV, offs, facePointsV, owner, neighbour] =
+            views(oldPoints, points, faceOffsets, facePoints, faceOwner, faceNeighbour);
+        parallelFor(
+            exec,
+            {0, nFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto start = offs[facei];
+                const auto nPoints = offs[facei + 1] - start;
+                bool faceMoved = false;
+                for (localIdx i = 0; i < nPoints && !faceMoved; i++)
+                {
+                    const auto pointi = static_cast<localIdx>(facePointsV[start + i]);
+                    faceMoved = mag(pointsV[pointi] - oldPointsV[pointi]) > 0.0;
+                }
+                if (!faceMoved)
+                {
+                    return;
+                }
+                faceGeometry(pointsV, facePointsV, start, nPoints, cf[facei], sf[facei]);
+                magSf[facei] = mag(sf[facei]);
+                swept[facei] = sweptVolume(oldPointsV, pointsV, facePointsV, start, nPoints);
+                Kokkos::atomic_max(&moved[static_cast<localIdx>(owner[facei])], label(1));
+                if (facei < nInternalFaces)
+                {
+                    Kokkos::atomic_max(&moved[static_cast<localIdx>(neighbour[facei])], label(1));
+                }
+            },
+            "movedFaceGeometry"
+        );
+    }
+    computeCellGeometry(geometry, faceOwner, faceNeighbour, cellMoved);
+    return sweptVolumes;
+}
+
+BoundaryMesh computeBoundaryMesh(
+    const MeshGeometry& geometry,
+    const labelVector& faceOwner,
+    localIdx nInternalFaces,
+    std::vector<localIdx> boundaryOffsets
+)
+{
+    const auto exec = faceOwner.exec();
+    const auto nBoundaryFaces = faceOwner.size() - nInternalFaces;
+    NF_ASSERT(
+        !boundaryOffsets.empty() && boundaryOffsets.front() == 0
+            && boundaryOffsets.back() == nBoundaryFaces,
+        "The patches do not cover the boundary faces."
+    );
+
+    labelVector faceCells(exec, nBoundaryFaces);
+    vectorVector bCf(exec, nBoundaryFaces);
+    vectorVector bCn(exec, nBoundaryFaces);
+    vectorVector bSf(exec, nBoundaryFaces);
+    scalarVector bMagSf(exec, nBoundaryFaces);
+    vectorVector bNf(exec, nBoundaryFaces);
+    vectorVector bDelta(exec, nBoundaryFaces);
+    scalarVector bWeights(exec, nBoundaryFaces, 1.0);
+    scalarVector bDeltaCoeffs(exec, nBoundaryFaces);
+    {
+        auto [sf, cf, magSf, owner, centres] = views(
+            geometry.faceAreas,
+            geometry.faceCentres,
+            geometry.magFaceAreas,
+            faceOwner,
+            geometry.cellCentres
+        );
+        auto [bFaceCells, bCfV, bCnV, bSfV, bMagSfV, bNfV, bDeltaV, bDeltaCoeffsV] =
+            views(faceCells, bCf, bCn, bSf, bMagSf, bNf, bDelta, bDeltaCoeffs);
+        parallelFor(
+            exec,
+            {0, nBoundaryFaces},
+            KOKKOS_LAMBDA(const localIdx bFacei) {
+                const auto facei = nInternalFaces + bFacei;
+                const auto celli = owner[facei];
+                const auto centre = centres[static_cast<localIdx>(celli)];
+                const auto delta = cf[facei] - centre;
+                bFaceCells[bFacei] = celli;
+                bCfV[bFacei] = cf[facei];
+                bCnV[bFacei] = centre;
+                bSfV[bFacei] = sf[facei];
+                bMagSfV[bFacei] = magSf[facei];
+                bNfV[bFacei] = (1.0 / magSf[facei]) * sf[facei];
+                bDeltaV[bFacei] = delta;
+                bDeltaCoeffsV[bFacei] = 1.0 / mag(delta);
+            },
+            "boundaryGeometry"
+        );
+    }
+
+    return BoundaryMesh(
+        exec,
+        std::move(faceCells),
+        std::move(bCf),
+        std::move(bCn),
+        std::move(bSf),
+        std::move(bMagSf),
+        std::move(bNf),
+        std::move(bDelta),
+        std::move(bWeights),
+        std::move(bDeltaCoeffs),
+        std::move(boundaryOffsets)
+    );
+}
+
+void movePoints(
+    UnstructuredMesh& mesh,
+    vectorVector points,
+    const Vector<localIdx>& faceOffsets,
+    const labelVector& facePoints,
+    scalar dt
+)
+{
+    NF_ASSERT_EQUAL(points.size(), mesh.points().size());
+    NF_ASSERT(dt > 0.0, "Mesh motion requires a positive time step, got " << dt << ".");
+    MeshGeometry geometry {
+        mesh.faceAreas(),
+        mesh.faceCentres(),
+        mesh.magFaceAreas(),
+        mesh.cellVolumes(),
+        mesh.cellCentres()
+    };
+    auto meshPhi = updateMeshGeometry(
+        geometry,
+        mesh.points(),
+        points,
+        faceOffsets,
+        facePoints,
+        mesh.faceOwner(),
+        mesh.faceNeighbour()
+    );
+    meshPhi *= 1.0 / dt;
+    const auto boundaryMesh = computeBoundaryMesh(
+        geometry, mesh.faceOwner(), mesh.nInternalFaces(), mesh.boundaryMesh().offset()
+    );
+    scalarVector oldCellVolumes = mesh.cellVolumes();
+    mesh.updateGeometry(
+        std::move(points),
+        std::move(geometry.cellVolumes),
+        std::move(geometry.cellCentres),
+        std::move(geometry.faceAreas),
+        std::move(geometry.faceCentres),
+        std::move(geometry.magFaceAreas),
+        boundaryMesh
+    );
+    mesh.updateMotion(std::move(oldCellVolumes), std::move(meshPhi));
+}
+
+} // namespace NeoN
@@ -0,0 +1,363 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+#include "NeoN/mesh/unstructured/renumbering.hpp"
+#include "NeoN/mesh/unstructured/cellGraph.hpp"
+
+#include "NeoN/core/primitives/vec3.hpp" // for Vec3
+
+namespace NeoN
+{
+
+namespace
+{
+
+/* @brief breadth first search from start, returns the cells of the last level
+ *
+ * Cells are marked with the given stamp so that the marker can be reused across searches
+ * without being reset.
+ */
+std::vector<localIdx> lastLevel(
+    const CellGraph& graph,
+    localIdx start,
+    std::vector<localIdx>& marker,
+    localIdx stamp,
+    localIdx& depth
+)
+{
+    std::vector<localIdx> level {start};
+    marker[start] = stamp;
+    depth = 0;
+    while (true)
+    {
+        std::vector<localIdx> next;
+        for (auto celli : level)
+        {
+            for (auto i = graph.offsets[celli]; i < graph.offsets[celli + 1]; i++)
+            {
+                const auto cellj = graph.adjacency[i];
+                if (marker[cellj] != stamp)
+                {
+                    marker[cellj] = stamp;
+                    next.push_back(cellj);
+                }
+            }
+        }
+        if (next.empty()) return level;
+        level = std::move(next);
+        depth++;
+    }
+}
+
+/* @brief finds a pseudo peripheral cell of the component of seed, see George and Liu (1979) */
+localIdx pseudoPeripheralCell(
+    const CellGraph& graph, localIdx seed, std::vector<localIdx>& marker, localIdx& stamp
+)
+{
+    localIdx start = seed;
+    localIdx depth = 0;
+    auto level = lastLevel(graph, start, marker, ++stamp, depth);
+    while (true)
+    {
+        const auto candidate = *std::min_element(
+            level.begin(),
+            level.end(),
+            [&](localIdx a, localIdx b) { return graph.degree(a) < graph.degree(b); }
+        );
+        localIdx candidateDepth = 0;
+        auto candidateLevel = lastLevel(graph, candidate, marker, ++stamp, candidateDepth);
+        if (candidateDepth <= depth) return start;
+        start = candidate;
+        depth = candidateDepth;
+        level = std::move(candidateLevel);
+    }
+}
+
+std::vector<localIdx> reverseCuthillMcKee(const CellGraph& graph)
+{
+    const auto nCells = static_cast<localIdx>(graph.offsets.size() - 1);
+    const auto byDegree = [&](localIdx a, localIdx b) { return graph.degree(a) < graph.degree(b); };
+
+    // components are seeded from their cell of lowest degree
+    std::vector<localIdx> seeds(nCells);
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::stable_sort(seeds.begin(), seeds.end(), byDegree);
+
+    std::vector<localIdx> marker(nCells, 0);
+    localIdx stamp = 0;
+    std::vector<bool> visited(nCells, false);
+    std::vector<localIdx> order;
+    order.reserve(nCells);
+    std::vector<localIdx> neighbours;
+    for (auto seed : seeds)
+    {
+        if (visited[seed]) continue;
+        const auto start = pseudoPeripheralCell(graph, seed, marker, stamp);
+        visited[start] = true;
+        order.push_back(start);
+        for (auto head = order.size() - 1; head < order.size(); head++)
+        {
+            const auto celli = order[head];
+            neighbours.clear();
+            for (auto i = graph.offsets[celli]; i < graph.offsets[celli + 1]; i++)
+            {
+                const auto cellj = graph.adjacency[i];
+                if (!visited[cellj])
+                {
+                    visited[cellj] = true;
+                    neighbours.push_back(cellj);
+                }
+            }
+            std::stable_sort(neighbours.begin(), neighbours.end(), byDegree);
+            order.insert(order.end(), neighbours.begin(), neighbours.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+constexpr std::uint32_t curveBits = 21;
+
+/* @brief spreads the lower 21 bits of x such that two zero bits separate consecutive bits */
+std::uint64_t spreadBits(std::uint64_t x)
+{
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+std::uint64_t mortonKey(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    return spreadBits(x) << 2 | spreadBits(y) << 1 | spreadBits(z);
+}
+
+/* @brief index along the Hilbert curve, see Skilling, AIP Conf. Proc. 707 (2004) */
+std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    std::uint32_t axes[3] = {x, y, z};
+    const std::uint32_t m = 1u << (curveBits - 1);
+
+    // inverse undo excess work
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+        const std::uint32_t p = q - 1;
+        for (auto& axis : axes)
+        {
+            if (axis & q)
+            {
+                axes[0] ^= p;
+            }
+            else
+            {
+                const std::uint32_t t = (axes[0] ^ axis) & p;
+                axes[0] ^= t;
+                axis ^= t;
+            }
+        }
+    }
+
+    // gray encode
+    axes[1] ^= axes[0];
+    axes[2] ^= axes[1];
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+        if (axes[2] & q) t ^= q - 1;
+    }
+    for (auto& axis : axes)
+    {
+        axis ^= t;
+    }
+
+    // interleave the transposed index
+    std::uint64_t key = 0;
+    for (std::uint32_t bit = curveBits; bit-- > 0;)
+    {
+        for (auto axis : axes)
+        {
+            key = key << 1 | ((axis >> bit) & 1u);
+        }
+    }
+    return key;
+}
+
+std::vector<localIdx> spaceFillingCurve(const UnstructuredMesh& mesh, bool hilbert)
+{
+    const auto nCells = mesh.nCells();
+    const auto centres = mesh.hostCellCentres().view();
+
+    Vec3 lower(std::numeric_limits<scalar>::max());
+    Vec3 upper(std::numeric_limits<scalar>::lowest());
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        for (int d = 0; d < 3; d++)
+        {
+            lower[d] = std::min(lower[d], centres[celli][d]);
+            upper[d] = std::max(upper[d], centres[celli][d]);
+        }
+    }
+
+    const scalar maxCoord = static_cast<scalar>((1u << curveBits) - 1);
+    std::vector<std::uint64_t> keys(nCells);
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        std::uint32_t coords[3];
+        for (int d = 0; d < 3; d++)
+        {
+            const scalar extent = upper[d] - lower[d];
+            const scalar rel = extent > 0 ? (centres[celli][d] - lower[d]) / extent : 0.0;
+            coords[d] = static_cast<std::uint32_t>(rel * maxCoord);
+        }
+        keys[celli] = hilbert ? hilbertKey(coords[0], coords[1], coords[2])
+                              : mortonKey(coords[0], coords[1], coords[2]);
+    }
+
+    std::vector<localIdx> order(nCells);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(), order.end(), [&](localIdx a, localIdx b) { return keys[a] < keys[b]; }
+    );
+    return order;
+}
+
+}
+
+std::vector<localIdx> computeCellOrdering(const UnstructuredMesh& mesh, CellOrdering ordering)
+{
+    switch (ordering)
+    {
+    case CellOrdering::Morton:
+        return spaceFillingCurve(mesh, false);
+    case CellOrdering::Hilbert:
+        return spaceFillingCurve(mesh, true);
+    default:
+        return reverseCuthillMcKee(createCellGraph(mesh));
+    }
+}
+
+RenumberedMesh renumberMesh(const UnstructuredMesh& mesh, CellOrdering ordering)
+{
+    const auto exec = mesh.exec();
+    const auto nCells = mesh.nCells();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nFaces = mesh.nFaces();
+
+    const auto cellNewToOld = computeCellOrdering(mesh, ordering);
+    std::vector<label> cellOldToNew(nCells);
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        cellOldToNew[cellNewToOld[celli]] = static_cast<label>(celli);
+    }
+
+    const auto [owner, neighbour, faceCells] =
+        views(mesh.hostFaceOwner(), mesh.hostFaceNeighbour(), mesh.hostFaceCells());
+
+    // renumber the cells of the internal faces and keep the owner below the neighbour
+    std::vector<label> ownerOfOld(nInternalFaces);
+    std::vector<label> neighbourOfOld(nInternalFaces);
+    std::vector<scalar> signOfOld(nInternalFaces, 1.0);
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        ownerOfOld[facei] = cellOldToNew[static_cast<localIdx>(owner[facei])];
+        neighbourOfOld[facei] = cellOldToNew[static_cast<localIdx>(neighbour[facei])];
+        if (ownerOfOld[facei] > neighbourOfOld[facei])
+        {
+            std::swap(ownerOfOld[facei], neighbourOfOld[facei]);
+            signOfOld[facei] = -1.0;
+        }
+    }
+
+    // sort the internal faces by owner and neighbour, boundary faces keep their index
+    std::vector<label> faceNewToOld(nFaces);
+    std::iota(faceNewToOld.begin(), faceNewToOld.end(), 0);
+    std::stable_sort(
+        faceNewToOld.begin(),
+        faceNewToOld.begin() + nInternalFaces,
+        [&](label a, label b)
+        {
+            return std::tie(ownerOfOld[a], neighbourOfOld[a])
+                 < std::tie(ownerOfOld[b], neighbourOfOld[b]);
+        }
+    );
+
+    std::vector<label> newOwner(nFaces);
+    std::vector<label> newNeighbour(nInternalFaces);
+    std::vector<scalar> faceSign(nFaces, 1.0);
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        const auto oldFacei = static_cast<localIdx>(faceNewToOld[facei]);
+        newOwner[facei] = ownerOfOld[oldFacei];
+        newNeighbour[facei] = neighbourOfOld[oldFacei];
+        faceSign[facei] = signOfOld[oldFacei];
+    }
+    for (localIdx facei = nInternalFaces; facei < nFaces; facei++)
+    {
+        newOwner[facei] = cellOldToNew[static_cast<localIdx>(owner[facei])];
+    }
+
+    std::vector<label> newFaceCells(faceCells.size());
+    for (localIdx bfacei = 0; bfacei < faceCells.size(); bfacei++)
+    {
+        newFaceCells[bfacei] = cellOldToNew[static_cast<localIdx>(faceCells[bfacei])];
+    }
+
+    labelVector cellMap(exec, std::vector<label>(cellNewToOld.begin(), cellNewToOld.end()));
+    labelVector faceMap(exec, faceNewToOld);
+    scalarVector faceSignVector(exec, faceSign);
+
+    auto faceAreas = permute(mesh.faceAreas(), faceMap);
+    const auto [faceAreasV, faceSignV] = views(faceAreas, faceSignVector);
+    parallelFor(
+        exec,
+        {0, nFaces},
+        KOKKOS_LAMBDA(const localIdx facei) { faceAreasV[facei] *= faceSignV[facei]; },
+        "orientFaceAreas"
+    );
+
+    const auto& bMesh = mesh.boundaryMesh();
+    BoundaryMesh boundaryMesh(
+        exec,
+        labelVector(exec, newFaceCells),
+        bMesh.cf(),
+        bMesh.cn(),
+        bMesh.sf(),
+        bMesh.magSf(),
+        bMesh.nf(),
+        bMesh.delta(),
+        bMesh.weights(),
+        bMesh.deltaCoeffs(),
+        bMesh.offset()
+    );
+
+    UnstructuredMesh renumbered(
+        mesh.points(),
+        permute(mesh.cellVolumes(), cellMap),
+        permute(mesh.cellCentres(), cellMap),
+        faceAreas,
+        permute(mesh.faceCentres(), faceMap),
+        permute(mesh.magFaceAreas(), faceMap),
+        labelVector(exec, newOwner),
+        labelVector(exec, newNeighbour),
+        nCells,
+        nInternalFaces,
+        mesh.nBoundaryFaces(),
+        mesh.nBoundaries(),
+        nFaces,
+        boundaryMesh
+    );
+
+    return {std::move(renumbered), std::move(cellMap), std::move(faceMap), faceSignVector};
+}
+
+} // namespace NeoN
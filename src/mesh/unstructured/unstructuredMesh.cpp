@@ -2,9 +2,15 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <limits>
+#include <utility>
+
+#include <Kokkos_Random.hpp>
+
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 
 #include "NeoN/core/primitives/vec3.hpp" // for Vec3
+#include "NeoN/core/segmentedVector.hpp"
 
 
 namespace NeoN
@@ -26,18 +32,42 @@ UnstructuredMesh::UnstructuredMesh(
     localIdx nFaces,
     BoundaryMesh boundaryMesh
 )
-    : exec_(points.exec()), points_(points), cellVolumes_(cellVolumes), cellCentres_(cellCentres),
-      faceAreas_(faceAreas), faceCentres_(faceCentres), magFaceAreas_(magFaceAreas),
-      faceOwner_(faceOwner), faceNeighbour_(faceNeighbour), nCells_(nCells),
+    : exec_(points.exec()), points_(std::move(points)), cellVolumes_(std::move(cellVolumes)),
+      invCellVolumes_(cellVolumes_.exec(), cellVolumes_.size()),
+      cellCentres_(std::move(cellCentres)), faceAreas_(std::move(faceAreas)),
+      faceCentres_(std::move(faceCentres)), magFaceAreas_(std::move(magFaceAreas)),
+      faceOwner_(std::move(faceOwner)), faceNeighbour_(std::move(faceNeighbour)), nCells_(nCells),
       nInternalFaces_(nInternalFaces), nBoundaryFaces_(nBoundaryFaces), nBoundaries_(nBoundaries),
-      nFaces_(nFaces), boundaryMesh_(boundaryMesh), stencilDataBase_()
-{}
+      nFaces_(nFaces), boundaryMesh_(std::move(boundaryMesh)), stencilDataBase_(),
+      geometryVersion_(0), hostMirrors_(), nGhostCells_(0), structured_(), activeRegion_(),
+      moving_(false), oldCellVolumes_(exec_, 0), meshPhi_(exec_, 0)
+{
+    // the connectivity stores cell indices as label, which can be narrower than localIdx
+    NF_ASSERT(
+        static_cast<globalIdx>(nCells) <= static_cast<globalIdx>(std::numeric_limits<label>::max()),
+        "The number of cells exceeds the range of label."
+    );
+    computeInvCellVolumes();
+}
+
+void UnstructuredMesh::computeInvCellVolumes()
+{
+    const auto [invVol, vol] = views(invCellVolumes_, cellVolumes_);
+    parallelFor(
+        cellVolumes_.exec(),
+        {0, invVol.size()},
+        KOKKOS_LAMBDA(const localIdx celli) { invVol[celli] = 1.0 / vol[celli]; },
+        "invCellVolumes"
+    );
+}
 
 
 const vectorVector& UnstructuredMesh::points() const { return points_; }
 
 const scalarVector& UnstructuredMesh::cellVolumes() const { return cellVolumes_; }
 
+const scalarVector& UnstructuredMesh::invCellVolumes() const { return invCellVolumes_; }
+
 const vectorVector& UnstructuredMesh::cellCentres() const { return cellCentres_; }
 
 const vectorVector& UnstructuredMesh::faceCentres() const { return faceCentres_; }
@@ -50,6 +80,71 @@ const labelVector& UnstructuredMesh::faceOwner() const { return faceOwner_; }
 
 const labelVector& UnstructuredMesh::faceNeighbour() const { return faceNeighbour_; }
 
+UnstructuredMesh::HostMirrors& UnstructuredMesh::hostMirrors() const
+{
+    if (hostMirrors_.geometryVersion != geometryVersion_)
+    {
+        // the vectors of the moved mesh may reuse the memory and version of the old ones
+        hostMirrors_.invalidateGeometry();
+        hostMirrors_.geometryVersion = geometryVersion_;
+    }
+    return hostMirrors_;
+}
+
+/* @brief synchronizes the mirror with the vector and returns it */
+template<typename ValueType>
+static const HostMirror<ValueType>&
+synced(HostMirror<ValueType>& mirror, const Vector<ValueType>& vec)
+{
+    mirror.syncToHost(vec);
+    return mirror;
+}
+
+const HostMirror<Vec3>& UnstructuredMesh::hostPoints() const
+{
+    return synced(hostMirrors().points, points_);
+}
+
+const HostMirror<scalar>& UnstructuredMesh::hostCellVolumes() const
+{
+    return synced(hostMirrors().cellVolumes, cellVolumes_);
+}
+
+const HostMirror<Vec3>& UnstructuredMesh::hostCellCentres() const
+{
+    return synced(hostMirrors().cellCentres, cellCentres_);
+}
+
+const HostMirror<Vec3>& UnstructuredMesh::hostFaceCentres() const
+{
+    return synced(hostMirrors().faceCentres, faceCentres_);
+}
+
+const HostMirror<Vec3>& UnstructuredMesh::hostFaceAreas() const
+{
+    return synced(hostMirrors().faceAreas, faceAreas_);
+}
+
+const HostMirror<scalar>& UnstructuredMesh::hostMagFaceAreas() const
+{
+    return synced(hostMirrors().magFaceAreas, magFaceAreas_);
+}
+
+const HostMirror<label>& UnstructuredMesh::hostFaceOwner() const
+{
+    return synced(hostMirrors().faceOwner, faceOwner_);
+}
+
+const HostMirror<label>& UnstructuredMesh::hostFaceNeighbour() const
+{
+    return synced(hostMirrors().faceNeighbour, faceNeighbour_);
+}
+
+const HostMirror<label>& UnstructuredMesh::hostFaceCells() const
+{
+    return synced(hostMirrors().faceCells, boundaryMesh_.faceCells());
+}
+
 localIdx UnstructuredMesh::nCells() const { return nCells_; }
 
 localIdx UnstructuredMesh::nInternalFaces() const { return nInternalFaces_; }
@@ -64,8 +159,166 @@ const BoundaryMesh& UnstructuredMesh::boundaryMesh() const { return boundaryMesh
 
 StencilDataBase& UnstructuredMesh::stencilDB() const { return stencilDataBase_; }
 
+void UnstructuredMesh::reportMemory(MemoryReport& report) const
+{
+    const std::string geometry = "mesh geometry";
+    report.add(geometry, "points", points_.memoryBytes());
+    report.add(
+        geometry, "cell volumes", cellVolumes_.memoryBytes() + invCellVolumes_.memoryBytes()
+    );
+    report.add(geometry, "cell centres", cellCentres_.memoryBytes());
+    report.add(geometry, "face areas", faceAreas_.memoryBytes() + magFaceAreas_.memoryBytes());
+    report.add(geometry, "face centres", faceCentres_.memoryBytes());
+    if (moving_)
+    {
+        report.add(geometry, "old cell volumes", oldCellVolumes_.memoryBytes());
+        report.add(geometry, "mesh fluxes", meshPhi_.memoryBytes());
+    }
+    const std::string connectivity = "mesh connectivity";
+    report.add(connectivity, "face owner", faceOwner_.memoryBytes());
+    report.add(connectivity, "face neighbour", faceNeighbour_.memoryBytes());
+    boundaryMesh_.reportMemory(report);
+    stencilDataBase_.reportMemory(report, "stencils");
+}
+
 const Executor& UnstructuredMesh::exec() const { return exec_; }
 
+std::size_t UnstructuredMesh::geometryVersion() const { return geometryVersion_; }
+
+const std::optional<StructuredBlock>& UnstructuredMesh::structured() const { return structured_; }
+
+void UnstructuredMesh::setStructured(StructuredBlock block)
+{
+    NF_ASSERT_EQUAL(block.nCells(), nCells_);
+    NF_ASSERT_EQUAL(block.nInternalFaces(), nInternalFaces_);
+    NF_ASSERT_EQUAL(
+        2 * (block.nx * block.ny + block.ny * block.nz + block.nx * block.nz), nBoundaryFaces_
+    );
+    structured_ = block;
+}
+
+localIdx UnstructuredMesh::nGhostCells() const { return nGhostCells_; }
+
+void UnstructuredMesh::setGhostCells(localIdx nGhostCells)
+{
+    NF_ASSERT(nGhostCells >= 0, "The number of ghost cells needs to be non-negative.");
+    NF_ASSERT_EQUAL(cellVolumes_.size(), nCells_ + nGhostCells);
+    NF_ASSERT_EQUAL(cellCentres_.size(), nCells_ + nGhostCells);
+    nGhostCells_ = nGhostCells;
+}
+
+const ActiveRegion* UnstructuredMesh::activeRegion() const { return activeRegion_.get(); }
+
+void UnstructuredMesh::setActiveRegion(std::shared_ptr<const ActiveRegion> region)
+{
+    NF_ASSERT(
+        !region || region->cellMask().size() == nCells_,
+        "The active region does not match the cells of the mesh."
+    );
+    activeRegion_ = std::move(region);
+}
+
+bool UnstructuredMesh::moving() const { return moving_; }
+
+const scalarVector& UnstructuredMesh::oldCellVolumes() const
+{
+    return moving_ ? oldCellVolumes_ : cellVolumes_;
+}
+
+const scalarVector& UnstructuredMesh::meshPhi() const
+{
+    NF_ASSERT(moving_, "The mesh fluxes are only available for a moving mesh.");
+    return meshPhi_;
+}
+
+void UnstructuredMesh::updateMotion(scalarVector oldCellVolumes, scalarVector meshPhi)
+{
+    NF_ASSERT_EQUAL(oldCellVolumes.size(), nCells_);
+    NF_ASSERT_EQUAL(meshPhi.size(), nFaces_);
+    oldCellVolumes_ = oldCellVolumes;
+    meshPhi_ = meshPhi;
+    moving_ = true;
+}
+
+void UnstructuredMesh::updateGeometry(
+    vectorVector points,
+    scalarVector cellVolumes,
+    vectorVector cellCentres,
+    vectorVector faceAreas,
+    vectorVector faceCentres,
+    scalarVector magFaceAreas
+)
+{
+    NF_ASSERT_EQUAL(points.size(), points_.size());
+    NF_ASSERT_EQUAL(cellVolumes.size(), cellVolumes_.size());
+    NF_ASSERT_EQUAL(cellCentres.size(), cellCentres_.size());
+    NF_ASSERT_EQUAL(faceAreas.size(), faceAreas_.size());
+    NF_ASSERT_EQUAL(faceCentres.size(), faceCentres_.size());
+    NF_ASSERT_EQUAL(magFaceAreas.size(), magFaceAreas_.size());
+    points_ = points;
+    cellVolumes_ = cellVolumes;
+    cellCentres_ = cellCentres;
+    faceAreas_ = faceAreas;
+    faceCentres_ = faceCentres;
+    magFaceAreas_ = magFaceAreas;
+    computeInvCellVolumes();
+    geometryVersion_++;
+}
+
+void UnstructuredMesh::updateGeometry(
+    vectorVector points,
+    scalarVector cellVolumes,
+    vectorVector cellCentres,
+    vectorVector faceAreas,
+    vectorVector faceCentres,
+    scalarVector magFaceAreas,
+    const BoundaryMesh& boundaryMesh
+)
+{
+    boundaryMesh_.updateGeometry(boundaryMesh);
+    updateGeometry(
+        std::move(points),
+        std::move(cellVolumes),
+        std::move(cellCentres),
+        std::move(faceAreas),
+        std::move(faceCentres),
+        std::move(magFaceAreas)
+    );
+}
+
+namespace
+{
+
+/* @brief sorts the keys on the execution space of the executor */
+template<typename ExecType>
+void sortKeys(const ExecType& exec, Vector<uint64_t>& keys)
+{
+    Kokkos::sort(
+        exec.underlyingExec(), exec.createKokkosView(keys.data(), static_cast<size_t>(keys.size()))
+    );
+}
+
+/* @brief creates the sort keys of a random permutation, the low 32 bits hold the index */
+template<typename ExecType>
+void randomKeys(const ExecType& exec, Vector<uint64_t>& keys, const uint64_t seed)
+{
+    Kokkos::Random_XorShift64_Pool<typename ExecType::exec> pool(seed);
+    auto keysView = keys.view();
+    parallelFor(
+        exec,
+        {0, keys.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            auto generator = pool.get_state();
+            const auto key = static_cast<uint64_t>(generator.urand());
+            pool.free_state(generator);
+            keysView[i] = (key << 32) | static_cast<uint64_t>(i);
+        },
+        "randomKeys"
+    );
+}
+
+}
+
 UnstructuredMesh createSingleCellMesh(const Executor exec)
 {
     // a 2D mesh in 3D space with left, right, top, bottom boundary faces
@@ -130,7 +383,8 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells)
         {0, nCells - 1},
         KOKKOS_LAMBDA(const localIdx i) {
             meshPointsView[i][0] = leftBoundaryX + static_cast<scalar>(i + 1) * meshSpacing;
-        }
+        },
+        "create1DUniformMesh::points"
     );
 
     scalarVector cellVolumes(exec, nCells, meshSpacing);
@@ -142,7 +396,8 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells)
         {0, nCells},
         KOKKOS_LAMBDA(const localIdx i) {
             cellCentersView[i][0] = 0.5 * meshSpacing + meshSpacing * static_cast<scalar>(i);
-        }
+        },
+        "create1DUniformMesh::cellCentres"
     );
 
 
@@ -170,7 +425,8 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells)
         KOKKOS_LAMBDA(const localIdx i) {
             faceOwnerView[i] = i;
             faceNeighborView[i] = i + 1;
-        }
+        },
+        "create1DUniformMesh::faces"
     );
 
     vectorVector deltaHost(hostExec, 2);
@@ -218,4 +474,319 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells)
         boundaryMesh
     );
 }
+
+UnstructuredMesh create3DUniformMesh(
+    const Executor exec,
+    const localIdx nx,
+    const localIdx ny,
+    const localIdx nz,
+    const bool randomCellOrder,
+    const uint64_t seed
+)
+{
+    NF_ASSERT(nx > 0 && ny > 0 && nz > 0, "The number of cells needs to be positive.");
+    const localIdx nCells = nx * ny * nz;
+    // the face sort keys store two cell indices with 32 bit each
+    NF_ASSERT(
+        static_cast<uint64_t>(nCells) < (uint64_t(1) << 32), "The mesh has too many cells."
+    );
+    const scalar dx = 1.0 / static_cast<scalar>(nx);
+    const scalar dy = 1.0 / static_cast<scalar>(ny);
+    const scalar dz = 1.0 / static_cast<scalar>(nz);
+
+    // the old cell of every new cell and vice versa
+    labelVector cellMap(exec, nCells);
+    labelVector cellOldToNew(exec, nCells);
+    {
+        auto [mapV, oldToNewV] = views(cellMap, cellOldToNew);
+        if (randomCellOrder)
+        {
+            Vector<uint64_t> keys(exec, nCells);
+            std::visit([&](const auto& e) { randomKeys(e, keys, seed); }, exec);
+            std::visit([&](const auto& e) { sortKeys(e, keys); }, exec);
+            auto keysView = keys.view();
+            parallelFor(
+                exec,
+                {0, nCells},
+                KOKKOS_LAMBDA(const localIdx celli) {
+                    mapV[celli] = static_cast<label>(keysView[celli] & 0xffffffff);
+                },
+                "cellMap"
+            );
+        }
+        else
+        {
+            parallelFor(
+                exec,
+                {0, nCells},
+                KOKKOS_LAMBDA(const localIdx celli) { mapV[celli] = static_cast<label>(celli); },
+                "cellMap"
+            );
+        }
+        parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                oldToNewV[static_cast<localIdx>(mapV[celli])] = static_cast<label>(celli);
+            },
+            "cellOldToNew"
+        );
+    }
+
+    vectorVector points(exec, (nx + 1) * (ny + 1) * (nz + 1));
+    auto pointsView = points.view();
+    parallelFor(
+        exec,
+        {0, points.size()},
+        KOKKOS_LAMBDA(const localIdx pointi) {
+            const auto i = pointi % (nx + 1);
+            const auto j = (pointi / (nx + 1)) % (ny + 1);
+            const auto k = pointi / ((nx + 1) * (ny + 1));
+            pointsView[pointi] = Vec3(
+                static_cast<scalar>(i) * dx,
+                static_cast<scalar>(j) * dy,
+                static_cast<scalar>(k) * dz
+            );
+        },
+        "points"
+    );
+
+    scalarVector cellVolumes(exec, nCells, dx * dy * dz);
+    vectorVector cellCentres(exec, nCells);
+    {
+        auto [centresView, mapV] = views(cellCentres, cellMap);
+        parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const auto oldCelli = static_cast<localIdx>(mapV[celli]);
+                const auto i = oldCelli % nx;
+                const auto j = (oldCelli / nx) % ny;
+                const auto k = oldCelli / (nx * ny);
+                centresView[celli] = Vec3(
+                    (static_cast<scalar>(i) + 0.5) * dx,
+                    (static_cast<scalar>(j) + 0.5) * dy,
+                    (static_cast<scalar>(k) + 0.5) * dz
+                );
+            },
+            "cellCentres"
+        );
+    }
+
+    // every cell owns the internal faces to its neighbours in positive x, y and z direction
+    Vector<localIdx> nOwnedFaces(exec, nCells);
+    Vector<localIdx> ownedFaceOffsets(exec, nCells + 1, 0);
+    {
+        auto nOwnedView = nOwnedFaces.view();
+        parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const auto i = celli % nx;
+                const auto j = (celli / nx) % ny;
+                const auto k = celli / (nx * ny);
+                nOwnedView[celli] =
+                    static_cast<localIdx>((i + 1 < nx) + (j + 1 < ny) + (k + 1 < nz));
+            },
+            "nOwnedFaces"
+        );
+    }
+    const localIdx nInternalFaces = segmentsFromIntervals(nOwnedFaces, ownedFaceOffsets);
+    const localIdx nBoundaryFaces = 2 * (ny * nz + nx * nz + nx * ny);
+    const localIdx nFaces = nInternalFaces + nBoundaryFaces;
+
+    labelVector faceOwner(exec, nFaces);
+    labelVector faceNeighbour(exec, nInternalFaces);
+    {
+        auto [owner, neighbour, offsets, oldToNewV] =
+            views(faceOwner, faceNeighbour, ownedFaceOffsets, cellOldToNew);
+        parallelFor(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const localIdx idx[3] = {celli % nx, (celli / nx) % ny, celli / (nx * ny)};
+                const localIdx n[3] = {nx, ny, nz};
+                const localIdx stride[3] = {1, nx, nx * ny};
+                auto facei = offsets[celli];
+                for (size_t d = 0; d < 3; d++)
+                {
+                    if (idx[d] + 1 < n[d])
+                    {
+                        // keep the owner below the neighbour in the new numbering
+                        const auto newOwner = oldToNewV[celli];
+                        const auto newNeighbour = oldToNewV[celli + stride[d]];
+                        owner[facei] = newOwner < newNeighbour ? newOwner : newNeighbour;
+                        neighbour[facei] = newOwner < newNeighbour ? newNeighbour : newOwner;
+                        facei++;
+                    }
+                }
+            },
+            "internalFaces"
+        );
+    }
+
+    if (randomCellOrder)
+    {
+        // sort the internal faces by owner and neighbour
+        Vector<uint64_t> keys(exec, nInternalFaces);
+        auto [keysView, owner, neighbour] = views(keys, faceOwner, faceNeighbour);
+        parallelFor(
+            exec,
+            {0, nInternalFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                keysView[facei] = (static_cast<uint64_t>(owner[facei]) << 32)
+                                | static_cast<uint64_t>(neighbour[facei]);
+            },
+            "faceKeys"
+        );
+        std::visit([&](const auto& e) { sortKeys(e, keys); }, exec);
+        parallelFor(
+            exec,
+            {0, nInternalFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                owner[facei] = static_cast<label>(keysView[facei] >> 32);
+                neighbour[facei] = static_cast<label>(keysView[facei] & 0xffffffff);
+            },
+            "sortedFaces"
+        );
+    }
+
+    vectorVector faceAreas(exec, nFaces);
+    vectorVector faceCentres(exec, nFaces);
+    scalarVector magFaceAreas(exec, nFaces);
+    {
+        // the internal faces are axis aligned, thus the direction follows from the cell centres
+        auto [sf, cf, magSf, owner, neighbour, centres] =
+            views(faceAreas, faceCentres, magFaceAreas, faceOwner, faceNeighbour, cellCentres);
+        parallelFor(
+            exec,
+            {0, nInternalFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                const auto ownCentre = centres[static_cast<localIdx>(owner[facei])];
+                const auto neiCentre = centres[static_cast<localIdx>(neighbour[facei])];
+                const auto delta = neiCentre - ownCentre;
+                const scalar area[3] = {dy * dz, dx * dz, dx * dy};
+                size_t d = 0;
+                for (size_t cmpt = 1; cmpt < 3; cmpt++)
+                {
+                    if (Kokkos::abs(delta[cmpt]) > Kokkos::abs(delta[d]))
+                    {
+                        d = cmpt;
+                    }
+                }
+                magSf[facei] = area[d];
+                sf[facei] = (area[d] / mag(delta)) * delta;
+                cf[facei] = 0.5 * (ownCentre + neiCentre);
+            },
+            "internalFaceGeometry"
+        );
+    }
+
+    labelVector faceCells(exec, nBoundaryFaces);
+    vectorVector bCf(exec, nBoundaryFaces);
+    vectorVector bCn(exec, nBoundaryFaces);
+    vectorVector bSf(exec, nBoundaryFaces);
+    scalarVector bMagSf(exec, nBoundaryFaces);
+    vectorVector bNf(exec, nBoundaryFaces);
+    vectorVector bDelta(exec, nBoundaryFaces);
+    scalarVector bWeights(exec, nBoundaryFaces, 1.0);
+    scalarVector bDeltaCoeffs(exec, nBoundaryFaces);
+    std::vector<localIdx> offset {0};
+    {
+        auto [sf, cf, magSf, owner, centres, oldToNewV] =
+            views(faceAreas, faceCentres, magFaceAreas, faceOwner, cellCentres, cellOldToNew);
+        auto [bFaceCells, bCfV, bCnV, bSfV, bMagSfV, bNfV, bDeltaV, bDeltaCoeffsV] =
+            views(faceCells, bCf, bCn, bSf, bMagSf, bNf, bDelta, bDeltaCoeffs);
+        const localIdx n[3] = {nx, ny, nz};
+        const scalar area[3] = {dy * dz, dx * dz, dx * dy};
+        for (size_t patchi = 0; patchi < 6; patchi++)
+        {
+            // the patch normal points in direction d, the faces are indexed by the cells along
+            // the other two directions d1 and d2
+            const size_t d = patchi / 2;
+            const bool upper = patchi % 2 == 1;
+            const size_t d1 = d == 0 ? 1 : 0;
+            const size_t d2 = d == 2 ? 1 : 2;
+            const localIdx n1 = n[d1];
+            const localIdx nPatchFaces = n1 * n[d2];
+            const localIdx start = offset.back();
+            const localIdx nd = n[d];
+            const scalar patchArea = area[d];
+            parallelFor(
+                exec,
+                {0, nPatchFaces},
+                KOKKOS_LAMBDA(const localIdx patchFacei) {
+                    localIdx idx[3] = {0, 0, 0};
+                    idx[d] = upper ? nd - 1 : 0;
+                    idx[d1] = patchFacei % n1;
+                    idx[d2] = patchFacei / n1;
+                    const auto oldCelli = idx[0] + nx * (idx[1] + ny * idx[2]);
+                    const auto celli = oldToNewV[oldCelli];
+                    const auto bFacei = start + patchFacei;
+                    const auto facei = nInternalFaces + bFacei;
+
+                    Vec3 normal(0.0, 0.0, 0.0);
+                    normal[d] = upper ? 1.0 : -1.0;
+                    const auto centre = centres[static_cast<localIdx>(celli)];
+                    auto faceCentre = centre;
+                    faceCentre[d] = upper ? 1.0 : 0.0;
+                    const auto delta = faceCentre - centre;
+
+                    owner[facei] = celli;
+                    sf[facei] = patchArea * normal;
+                    cf[facei] = faceCentre;
+                    magSf[facei] = patchArea;
+
+                    bFaceCells[bFacei] = celli;
+                    bCfV[bFacei] = faceCentre;
+                    bCnV[bFacei] = centre;
+                    bSfV[bFacei] = patchArea * normal;
+                    bMagSfV[bFacei] = patchArea;
+                    bNfV[bFacei] = normal;
+                    bDeltaV[bFacei] = delta;
+                    bDeltaCoeffsV[bFacei] = 1.0 / mag(delta);
+                },
+                "boundaryFaces"
+            );
+            offset.push_back(start + nPatchFaces);
+        }
+    }
+
+    BoundaryMesh boundaryMesh(
+        exec,
+        faceCells,
+        bCf,
+        bCn,
+        bSf,
+        bMagSf,
+        bNf,
+        bDelta,
+        bWeights,
+        bDeltaCoeffs,
+        offset
+    );
+
+    UnstructuredMesh mesh(
+        points,
+        cellVolumes,
+        cellCentres,
+        faceAreas,
+        faceCentres,
+        magFaceAreas,
+        faceOwner,
+        faceNeighbour,
+        nCells,
+        nInternalFaces,
+        nBoundaryFaces,
+        6,
+        nFaces,
+        boundaryMesh
+    );
+    if (!randomCellOrder)
+    {
+        mesh.setStructured(StructuredBlock {nx, ny, nz});
+    }
+    return mesh;
+}
+
 } // namespace NeoN
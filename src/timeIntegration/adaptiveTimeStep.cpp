@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/coNum.hpp"
+#include "NeoN/timeIntegration/adaptiveTimeStep.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+static scalar readOption(const Dictionary& dict, const std::string& key, scalar defaultValue)
+{
+    return dict.contains(key) ? dict.get<scalar>(key) : defaultValue;
+}
+
+AdaptiveTimeStep::AdaptiveTimeStep(const Dictionary& dict)
+    : maxCo_(readOption(dict, "maxCo", 1.0)),
+      maxDeltaT_(readOption(dict, "maxDeltaT", std::numeric_limits<scalar>::max())),
+      minDeltaT_(readOption(dict, "minDeltaT", 0.0)),
+      maxGrowth_(readOption(dict, "maxGrowth", 1.2)),
+      minShrink_(readOption(dict, "minShrink", 0.2)), safety_(readOption(dict, "safety", 0.9))
+{
+    NF_ASSERT(maxCo_ > 0.0, "maxCo has to be positive.");
+    NF_ASSERT(maxGrowth_ >= 1.0, "maxGrowth has to be at least one.");
+    NF_ASSERT(minShrink_ > 0.0 && minShrink_ <= 1.0, "minShrink has to be in (0, 1].");
+    NF_ASSERT(minDeltaT_ <= maxDeltaT_, "minDeltaT has to be smaller than maxDeltaT.");
+}
+
+scalar AdaptiveTimeStep::next(scalar dt, scalar coNum) const
+{
+    // damp the growth for small courant numbers, shrink at once if maxCo is exceeded
+    const scalar maxFactor = maxCo_ / (coNum + ROOTVSMALL);
+    const scalar factor = std::min({maxFactor, 1 + scalar(0.1) * maxFactor, maxGrowth_});
+    return limit(factor * dt);
+}
+
+scalar AdaptiveTimeStep::next(scalar dt, scalar coNum, scalar errorNorm, int order) const
+{
+    NF_ASSERT(order > 0, "The order of the error estimate has to be positive.");
+    scalar factor = maxGrowth_;
+    if (errorNorm > 0.0)
+    {
+        const scalar exponent = -scalar(1.0) / static_cast<scalar>(order + 1);
+        factor = std::clamp(safety_ * std::pow(errorNorm, exponent), minShrink_, maxGrowth_);
+    }
+    return std::min(next(dt, coNum), limit(factor * dt));
+}
+
+scalar AdaptiveTimeStep::next(
+    const finiteVolume::cellCentred::SurfaceField<scalar>& faceFlux, scalar dt
+) const
+{
+    return next(dt, finiteVolume::cellCentred::computeCourantNumber(faceFlux, dt).max);
+}
+
+scalar AdaptiveTimeStep::limit(scalar dt) const { return std::clamp(dt, minDeltaT_, maxDeltaT_); }
+
+} // namespace NeoN::timeIntegration
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/batchedOde.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+static scalar readOption(const Dictionary& dict, const std::string& key, scalar defaultValue)
+{
+    return dict.contains(key) ? dict.get<scalar>(key) : defaultValue;
+}
+
+BatchedOdeSettings::BatchedOdeSettings(const Dictionary& dict)
+    : relTol(readOption(dict, "relTol", 1e-6)), absTol(readOption(dict, "absTol", 1e-10)),
+      maxSubSteps(dict.contains("maxSubSteps") ? dict.get<int>("maxSubSteps") : 10000),
+      maxGrowth(readOption(dict, "maxGrowth", 5.0)), minShrink(readOption(dict, "minShrink", 0.2)),
+      safety(readOption(dict, "safety", 0.9)), pivotTol(readOption(dict, "pivotTol", 1e-14))
+{
+    NF_ASSERT(relTol > 0.0 || absTol > 0.0, "relTol or absTol has to be positive.");
+    NF_ASSERT(maxSubSteps > 0, "maxSubSteps has to be positive.");
+    NF_ASSERT(maxGrowth >= 1.0, "maxGrowth has to be at least one.");
+    NF_ASSERT(minShrink > 0.0 && minShrink < 1.0, "minShrink has to be in (0, 1).");
+}
+
+BatchedStiffOde::BatchedStiffOde(
+    const Executor& exec, localIdx nSystems, localIdx size, const Dictionary& dict
+)
+    : size_(size), settings_(dict), subStepSizes_(exec, nSystems, 0.0),
+      nSubSteps_(exec, nSystems, 0), order_(exec, nSystems)
+{
+    NF_ASSERT(size_ > 0, "The systems need at least one unknown.");
+    auto order = order_.view();
+    parallelFor(
+        exec, {0, nSystems}, KOKKOS_LAMBDA(const localIdx i) { order[i] = i; }, "BatchedOdeOrder"
+    );
+}
+
+void BatchedStiffOde::orderByWork()
+{
+    // descending work, the sort is stable, hence the order is deterministic
+    Vector<localIdx> keys(exec(), nSystems());
+    auto [work, nSteps, order] = views(keys, nSubSteps_, order_);
+    parallelFor(
+        exec(),
+        {0, nSystems()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            work[i] = -nSteps[i];
+            order[i] = i;
+        },
+        "BatchedOdeWork"
+    );
+    parallelSort(exec(), work, order);
+}
+
+}
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/coupledRungeKutta.hpp"
+
+#if NN_WITH_SUNDIALS
+
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+namespace
+{
+
+/* @brief copies the segment of the concatenated vector starting at offset into a vector */
+template<typename ValueType>
+void extractSegment(const Vector<ValueType>& concatenated, localIdx offset, Vector<ValueType>& x)
+{
+    const auto [concatenatedV, xV] = views(concatenated, x);
+    parallelFor(
+        x.exec(),
+        x.range(),
+        KOKKOS_LAMBDA(const localIdx i) { xV[i] = concatenatedV[offset + i]; },
+        "CoupledRungeKutta::extractSegment"
+    );
+}
+
+/* @brief copies a vector into the segment of the concatenated vector starting at offset */
+template<typename ValueType>
+void insertSegment(const Vector<ValueType>& x, localIdx offset, Vector<ValueType>& concatenated)
+{
+    const auto [concatenatedV, xV] = views(concatenated, x);
+    parallelFor(
+        x.exec(),
+        x.range(),
+        KOKKOS_LAMBDA(const localIdx i) { concatenatedV[offset + i] = xV[i]; },
+        "CoupledRungeKutta::insertSegment"
+    );
+}
+
+/* @brief the negated explicit sources per unit volume of all equations */
+template<typename SolutionVectorType>
+int coupledRhs([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
+{
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    auto& data = *static_cast<typename CoupledRungeKutta<SolutionVectorType>::UserData*>(userData);
+    const auto& stage = sundials::vector(y);
+    auto& rhs = sundials::vector(ydot);
+
+    // all fields are loaded first, since an expression may depend on the other fields
+    for (std::size_t i = 0; i < data.solutions.size(); i++)
+    {
+        auto& solution = *data.solutions[i];
+        extractSegment(stage, data.offsets[i], solution.internalVector());
+        solution.correctBoundaryConditions();
+    }
+    for (std::size_t i = 0; i < data.expressions.size(); i++)
+    {
+        auto& source = data.sources[i];
+        fill(source, zero<ValueType>());
+        data.expressions[i]->explicitOperation(source);
+        source *= scalar(-1.0);
+        insertSegment(source, data.offsets[i], rhs);
+    }
+    completeStep(rhs.exec());
+    return 0;
+}
+
+}
+
+template<typename SolutionVectorType>
+void CoupledRungeKutta<SolutionVectorType>::solve(
+    const std::vector<dsl::Expression<ValueType>*>& exps,
+    const std::vector<SolutionVectorType*>& solutions,
+    scalar t,
+    const scalar dt
+)
+{
+    NF_ASSERT_EQUAL(exps.size(), solutions.size());
+    NF_ASSERT(!solutions.empty(), "The coupled system has no equations.");
+
+    std::vector<localIdx> offsets(solutions.size() + 1, 0);
+    for (std::size_t i = 0; i < solutions.size(); i++)
+    {
+        offsets[i + 1] = offsets[i] + solutions[i]->internalVector().size();
+    }
+    const bool resized = offsets != data_->offsets;
+    data_->expressions = exps;
+    data_->solutions = solutions;
+    data_->offsets = offsets;
+    if (resized)
+    {
+        const auto& exec = solutions[0]->exec();
+        data_->sources.clear();
+        for (const auto* solution : solutions)
+        {
+            data_->sources.emplace_back(exec, solution->internalVector().size());
+        }
+        ODEMemory_.reset();
+    }
+
+    if (!ODEMemory_)
+    {
+        initERKStep(t);
+    }
+    // the solutions may have been modified since the last step, eg. by a correction
+    for (std::size_t i = 0; i < solutions.size(); i++)
+    {
+        insertSegment(solutions[i]->internalVector(), offsets[i], state_.vector());
+    }
+    void* ark = reinterpret_cast<void*>(ODEMemory_.get());
+    ARKodeReset(ark, t, state_.sunNVector());
+    ARKodeSetFixedStep(ark, dt);
+    NeoN::scalar timeOut;
+    auto stepReturn = ARKodeEvolve(ark, t + dt, state_.sunNVector(), &timeOut, ARK_ONE_STEP);
+
+    // Post step checks
+    NF_ASSERT_EQUAL(stepReturn, 0);
+    NF_ASSERT_EQUAL(t + dt, timeOut);
+
+    for (std::size_t i = 0; i < solutions.size(); i++)
+    {
+        extractSegment(state_.vector(), offsets[i], solutions[i]->internalVector());
+        solutions[i]->correctBoundaryConditions();
+    }
+    completeStep(state_.vector().exec());
+}
+
+template<typename SolutionVectorType>
+void CoupledRungeKutta<SolutionVectorType>::initERKStep(const scalar t)
+{
+    if (!context_)
+    {
+        context_ = sundials::sharedContext();
+    }
+    const auto& exec = data_->solutions[0]->exec();
+    state_.initNVector(exec, static_cast<size_t>(data_->offsets.back()), context_);
+
+    void* ark = ERKStepCreate(coupledRhs<SolutionVectorType>, t, state_.sunNVector(), *context_);
+    NF_ASSERT(ark != nullptr, "ERKStepCreate failed");
+    ODEMemory_.reset(reinterpret_cast<char*>(ark));
+    if (schemeDict_.contains("Runge-Kutta-Method"))
+    {
+        ERKStepSetTableNum(
+            ark, sundials::stringToERKTable(schemeDict_.get<std::string>("Runge-Kutta-Method"))
+        );
+    }
+    ARKodeSetUserData(ark, data_.get());
+    ARKodeSStolerances(ark, 1.0, 1.0);
+}
+
+template class CoupledRungeKutta<finiteVolume::cellCentred::VolumeField<scalar>>;
+}
+
+#endif
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/imexRungeKutta.hpp"
+
+#if NN_WITH_SUNDIALS
+
+#include "NeoN/core/database/solverStatsCollection.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+namespace
+{
+
+/* @brief copies the stage values into the solution field the operators are evaluated on */
+template<typename SolutionVectorType>
+void loadStage(N_Vector y, SolutionVectorType& solution)
+{
+    auto& stage = sundials::vector(y);
+    if (stage.data() != solution.internalVector().data())
+    {
+        solution.internalVector() = stage;
+    }
+    solution.correctBoundaryConditions();
+}
+
+/* @brief assembles the implicit spatial operators into the linear system of the equation */
+template<typename SolutionVectorType>
+la::LinearSystem<scalar, localIdx>&
+assembleImplicit(typename ImexRungeKutta<SolutionVectorType>::UserData& data)
+{
+    auto& ls = la::readOrCreateLinearSystem<scalar, localIdx>(
+        data.solution->mesh(), data.solution->name
+    );
+    data.expression->implicitOperation(ls);
+    return ls;
+}
+
+/* @brief the explicit part of the rhs, the negated explicit source per unit volume */
+template<typename SolutionVectorType>
+int explicitRhs([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
+{
+    auto& data = *static_cast<typename ImexRungeKutta<SolutionVectorType>::UserData*>(userData);
+    // the operators share the entries of the mesh with concurrent solves, see
+    // StencilDataBase::lock
+    auto lock = data.solution->mesh().stencilDB().lock();
+    loadStage(y, *data.solution);
+
+    auto& source = sundials::vector(ydot);
+    fill(source, scalar(0.0));
+    data.expression->explicitOperation(source);
+    source *= scalar(-1.0);
+    completeStep(data.expression->exec());
+    return 0;
+}
+
+/* @brief the implicit part of the rhs, -(A y - b) / V of the assembled implicit operators */
+template<typename SolutionVectorType>
+int implicitRhs([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
+{
+    auto& data = *static_cast<typename ImexRungeKutta<SolutionVectorType>::UserData*>(userData);
+    // the operators share the entries of the mesh with concurrent solves, see
+    // StencilDataBase::lock
+    auto lock = data.solution->mesh().stencilDB().lock();
+    loadStage(y, *data.solution);
+    auto& ls = assembleImplicit<SolutionVectorType>(data);
+
+    auto& rhs = sundials::vector(ydot);
+    la::computeResidual(ls.matrix(), ls.rhs(), sundials::vector(y), rhs);
+    const auto [rhsV, invVol] = views(rhs, data.solution->mesh().invCellVolumes());
+    parallelFor(
+        rhs.exec(),
+        rhs.range(),
+        KOKKOS_LAMBDA(const localIdx celli) { rhsV[celli] *= -invVol[celli]; },
+        "ImexRungeKutta::implicitRhs"
+    );
+    completeStep(data.expression->exec());
+    return 0;
+}
+
+SUNLinearSolver_Type linearSolverType(SUNLinearSolver) { return SUNLINEARSOLVER_MATRIX_EMBEDDED; }
+
+/* @brief solves the Newton system (I - gamma J) x = b as (V + gamma A) x = V b, where the
+ * Jacobian of the implicit rhs is J = -A / V
+ */
+template<typename SolutionVectorType>
+int linearSolve(SUNLinearSolver solver, SUNMatrix, N_Vector x, N_Vector b, sunrealtype)
+{
+    auto& data = *static_cast<typename ImexRungeKutta<SolutionVectorType>::UserData*>(
+        solver->content
+    );
+    sunrealtype gamma;
+    ARKodeGetCurrentGamma(data.arkMemory, &gamma);
+
+    const auto& mesh = data.solution->mesh();
+    auto lock = mesh.stencilDB().lock();
+    auto& ls = assembleImplicit<SolutionVectorType>(data);
+    const auto [diagOffs, vol, bV] = views(
+        la::SparsityPattern::readOrCreate(mesh).diagOffset(),
+        mesh.cellVolumes(),
+        sundials::vector(b)
+    );
+    auto [matrix, rhs] = ls.view();
+    parallelFor(
+        ls.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            for (auto j = matrix.rowOffs[celli]; j < matrix.rowOffs[celli + 1]; j++)
+            {
+                matrix.values[j] *= gamma;
+            }
+            matrix.values[matrix.rowOffs[celli] + diagOffs[celli]] += vol[celli];
+            rhs[celli] = vol[celli] * bV[celli];
+        },
+        "ImexRungeKutta::newtonSystem"
+    );
+
+    auto& xV = sundials::vector(x);
+    fill(xV, scalar(0.0));
+    // the linear system is owned by the equation
+    lock.unlock();
+    auto stats = data.solver->solve(ls, xV);
+    lock.lock();
+    la::recordSolverStats(*data.solution, stats);
+    completeStep(data.expression->exec());
+    return SUN_SUCCESS;
+}
+
+/* @brief frees a linear solver created by initARKStep, the user data is not owned */
+void freeLinearSolver(SUNLinearSolver solver)
+{
+    if (solver != nullptr)
+    {
+        solver->content = nullptr;
+        SUNLinSolFreeEmpty(solver);
+    }
+}
+
+}
+
+template<typename SolutionVectorType>
+void ImexRungeKutta<SolutionVectorType>::solve(
+    dsl::Expression<ValueType>& exp, SolutionVectorType& solutionVector, scalar t, const scalar dt
+)
+{
+    if (!ODEMemory_)
+    {
+        initARKStep(solutionVector, t);
+    }
+    void* ark = reinterpret_cast<void*>(ODEMemory_.get());
+    data_->expression = &exp;
+    data_->solution = &solutionVector;
+    if (!data_->solver)
+    {
+        // the integrator is recreated by dsl::solve, hence the solver is taken from the cache
+        // of the mesh
+        data_->solver = la::solverCache(solutionVector.mesh())
+                            .get(solutionVector.name, solutionVector.exec(), this->solutionDict_);
+    }
+
+    // the solution may have been modified since the last step, eg. by a coupled equation
+    state_.vector() = solutionVector.internalVector();
+    ARKodeReset(ark, t, state_.sunNVector());
+    ARKodeSetFixedStep(ark, dt);
+    NeoN::scalar timeOut;
+    auto stepReturn = ARKodeEvolve(ark, t + dt, state_.sunNVector(), &timeOut, ARK_ONE_STEP);
+
+    // Post step checks
+    NF_ASSERT_EQUAL(stepReturn, 0);
+    NF_ASSERT_EQUAL(t + dt, timeOut);
+
+    solutionVector.internalVector() = state_.vector();
+    solutionVector.correctBoundaryConditions();
+}
+
+template<typename SolutionVectorType>
+std::unique_ptr<TimeIntegratorBase<SolutionVectorType>>
+ImexRungeKutta<SolutionVectorType>::clone() const
+{
+    return std::make_unique<ImexRungeKutta>(*this);
+}
+
+template<typename SolutionVectorType>
+void ImexRungeKutta<SolutionVectorType>::initARKStep(
+    SolutionVectorType& solutionVector, const scalar t
+)
+{
+    if (!context_)
+    {
+        context_ = sundials::sharedContext();
+    }
+    const auto& internal = solutionVector.internalVector();
+    state_.initNVector(internal.exec(), static_cast<size_t>(internal.size()), context_);
+    state_.vector() = internal;
+
+    void* ark = ARKStepCreate(
+        explicitRhs<SolutionVectorType>,
+        implicitRhs<SolutionVectorType>,
+        t,
+        state_.sunNVector(),
+        *context_
+    );
+    NF_ASSERT(ark != nullptr, "ARKStepCreate failed");
+    ODEMemory_.reset(reinterpret_cast<char*>(ark));
+    data_->arkMemory = ark;
+
+    const auto method = this->schemeDict_.contains("IMEX-Method")
+                          ? this->schemeDict_.template get<std::string>("IMEX-Method")
+                          : std::string("ARK-3");
+    const auto [implicitTable, explicitTable] = sundials::stringToARKTables(method);
+    ARKStepSetTableNum(ark, implicitTable, explicitTable);
+    ARKodeSetUserData(ark, data_.get());
+
+    SUNLinearSolver solver = SUNLinSolNewEmpty(*context_);
+    NF_ASSERT(solver != nullptr, "SUNLinSolNewEmpty failed");
+    solver->ops->gettype = linearSolverType;
+    solver->ops->solve = linearSolve<SolutionVectorType>;
+    solver->content = data_.get();
+    linearSolver_ = decltype(linearSolver_)(solver, freeLinearSolver);
+    ARKodeSetLinearSolver(ark, solver, nullptr);
+
+    // the implicit operators are linear in the solution and do not depend on time, thus a single
+    // Newton iteration with one linear solve per stage is exact
+    ARKodeSetLinear(ark, 0);
+    ARKodeSStolerances(ark, 1.0, 1.0);
+}
+
+template class ImexRungeKutta<finiteVolume::cellCentred::VolumeField<scalar>>;
+}
+
+#endif
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/timeIntegration/lowStorageRungeKutta.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace NeoN::timeIntegration
+{
+
+LowStorageTableau lowStorageTableau(const std::string& method)
+{
+    using Form = LowStorageTableau::Form;
+    if (method == "Williamson-RK3")
+    {
+        return {
+            Form::Williamson2N,
+            {0.0, -5.0 / 9.0, -153.0 / 128.0},
+            {1.0 / 3.0, 15.0 / 16.0, 8.0 / 15.0},
+            {},
+            {},
+            {}
+        };
+    }
+    if (method == "Carpenter-Kennedy-RK4")
+    {
+        return {
+            Form::Williamson2N,
+            {0.0,
+             -567301805773.0 / 1357537059087.0,
+             -2404267990393.0 / 2016746695238.0,
+             -3550918686646.0 / 2091501179385.0,
+             -1275806237668.0 / 842570457699.0},
+            {1432997174477.0 / 9575080441755.0,
+             5161836677717.0 / 13612068292357.0,
+             1720146321549.0 / 2090206949498.0,
+             3134564353537.0 / 4481467310338.0,
+             2277821191437.0 / 14882151754819.0},
+            {},
+            {},
+            {}
+        };
+    }
+    if (method == "SSP-RK3")
+    {
+        return {
+            Form::Ketcheson2SStar,
+            {},
+            {},
+            {1.0, 1.0 / 4.0, 2.0 / 3.0},
+            {0.0, 3.0 / 4.0, 1.0 / 3.0},
+            {1.0, 1.0 / 4.0, 2.0 / 3.0}
+        };
+    }
+    NF_ERROR_EXIT(
+        "Unsupported low storage Runge-Kutta method " << method << ".\n"
+                                                      << "Supported methods are: Williamson-RK3, "
+                                                         "Carpenter-Kennedy-RK4, SSP-RK3."
+    );
+    return {};
+}
+
+template class LowStorageRungeKutta<fvcc::VolumeField<scalar>>;
+
+template class LowStorageRungeKutta<fvcc::VolumeField<Vec3>>;
+
+}
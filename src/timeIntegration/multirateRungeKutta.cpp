@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/multirateRungeKutta.hpp"
+
+#if NN_WITH_SUNDIALS
+
+#include "NeoN/finiteVolume/cellCentred/operators/sourceTerm.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+namespace
+{
+
+/* @brief copies the stage values into the solution field the operators are evaluated on */
+template<typename SolutionVectorType>
+void loadStage(N_Vector y, SolutionVectorType& solution)
+{
+    auto& stage = sundials::vector(y);
+    if (stage.data() != solution.internalVector().data())
+    {
+        solution.internalVector() = stage;
+    }
+    solution.correctBoundaryConditions();
+}
+
+/* @brief the negated explicit source per unit volume of a partition */
+template<typename SolutionVectorType>
+int partitionRhs(
+    dsl::Expression<typename SolutionVectorType::VectorValueType>& partition,
+    N_Vector y,
+    N_Vector ydot,
+    void* userData
+)
+{
+    auto& data =
+        *static_cast<typename MultirateRungeKutta<SolutionVectorType>::UserData*>(userData);
+    auto& source = sundials::vector(ydot);
+    fill(source, scalar(0.0));
+    if (partition.size() > 0)
+    {
+        loadStage(y, *data.solution);
+        partition.explicitOperation(source);
+        source *= scalar(-1.0);
+    }
+    NeoN::fence(partition.exec());
+    return 0;
+}
+
+/* @brief the rhs of the slow partition, the transport operators */
+template<typename SolutionVectorType>
+int slowRhs([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
+{
+    auto& data =
+        *static_cast<typename MultirateRungeKutta<SolutionVectorType>::UserData*>(userData);
+    return partitionRhs<SolutionVectorType>(*data.slow, y, ydot, userData);
+}
+
+/* @brief the rhs of the fast partition, the source terms */
+template<typename SolutionVectorType>
+int fastRhs([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
+{
+    auto& data =
+        *static_cast<typename MultirateRungeKutta<SolutionVectorType>::UserData*>(userData);
+    return partitionRhs<SolutionVectorType>(*data.fast, y, ydot, userData);
+}
+
+void freeInnerStepper(MRIStepInnerStepper stepper)
+{
+    if (stepper != nullptr)
+    {
+        MRIStepInnerStepper_Free(&stepper);
+    }
+}
+
+}
+
+template<typename SolutionVectorType>
+void MultirateRungeKutta<SolutionVectorType>::solve(
+    dsl::Expression<ValueType>& exp, SolutionVectorType& solutionVector, scalar t, const scalar dt
+)
+{
+    // the expression may change between steps, the partitions share the operators
+    data_->slow = std::make_unique<dsl::Expression<ValueType>>(exp.exec());
+    data_->fast = std::make_unique<dsl::Expression<ValueType>>(exp.exec());
+    for (const auto& op : exp.spatialOperators())
+    {
+        if (op.getType() == dsl::Operator::Type::Implicit)
+        {
+            NF_ERROR_EXIT("The multirate integrator does not support implicit operators.");
+        }
+        if (op.template as<finiteVolume::cellCentred::SourceTerm<ValueType>>())
+        {
+            data_->fast->addOperator(op);
+        }
+        else
+        {
+            data_->slow->addOperator(op);
+        }
+    }
+    data_->solution = &solutionVector;
+
+    if (!ODEMemory_)
+    {
+        initMRIStep(solutionVector, t);
+    }
+    void* mri = reinterpret_cast<void*>(ODEMemory_.get());
+    const auto subSteps = this->schemeDict_.contains("fastSubSteps")
+                            ? this->schemeDict_.template get<int>("fastSubSteps")
+                            : 10;
+    NF_ASSERT(subSteps > 0, "fastSubSteps has to be positive.");
+
+    // the solution may have been modified since the last step, eg. by a coupled equation
+    state_.vector() = solutionVector.internalVector();
+    ARKodeReset(mri, t, state_.sunNVector());
+    ARKodeSetFixedStep(fastMemory_.get(), dt / static_cast<scalar>(subSteps));
+    ARKodeSetFixedStep(mri, dt);
+    NeoN::scalar timeOut;
+    auto stepReturn = ARKodeEvolve(mri, t + dt, state_.sunNVector(), &timeOut, ARK_ONE_STEP);
+
+    // Post step checks
+    NF_ASSERT_EQUAL(stepReturn, 0);
+    NF_ASSERT_EQUAL(t + dt, timeOut);
+
+    solutionVector.internalVector() = state_.vector();
+    solutionVector.correctBoundaryConditions();
+}
+
+template<typename SolutionVectorType>
+std::unique_ptr<TimeIntegratorBase<SolutionVectorType>>
+MultirateRungeKutta<SolutionVectorType>::clone() const
+{
+    return std::make_unique<MultirateRungeKutta>(*this);
+}
+
+template<typename SolutionVectorType>
+void MultirateRungeKutta<SolutionVectorType>::initMRIStep(
+    SolutionVectorType& solutionVector, const scalar t
+)
+{
+    if (!context_)
+    {
+        context_ = sundials::sharedContext();
+    }
+    const auto& internal = solutionVector.internalVector();
+    state_.initNVector(internal.exec(), static_cast<size_t>(internal.size()), context_);
+    state_.vector() = internal;
+
+    void* fast =
+        ARKStepCreate(fastRhs<SolutionVectorType>, nullptr, t, state_.sunNVector(), *context_);
+    NF_ASSERT(fast != nullptr, "ARKStepCreate failed");
+    fastMemory_.reset(reinterpret_cast<char*>(fast));
+    if (this->schemeDict_.contains("Runge-Kutta-Method"))
+    {
+        ARKStepSetTableNum(
+            fast,
+            ARKODE_DIRK_NONE,
+            sundials::stringToERKTable(
+                this->schemeDict_.template get<std::string>("Runge-Kutta-Method")
+            )
+        );
+    }
+    ARKodeSetUserData(fast, data_.get());
+    ARKodeSStolerances(fast, 1.0, 1.0);
+
+    MRIStepInnerStepper stepper = nullptr;
+    int flag = ARKodeCreateMRIStepInnerStepper(fast, &stepper);
+    NF_ASSERT(flag == ARK_SUCCESS, "ARKodeCreateMRIStepInnerStepper failed");
+    innerStepper_ = decltype(innerStepper_)(stepper, freeInnerStepper);
+
+    void* mri = MRIStepCreate(
+        slowRhs<SolutionVectorType>, nullptr, t, state_.sunNVector(), stepper, *context_
+    );
+    NF_ASSERT(mri != nullptr, "MRIStepCreate failed");
+    ODEMemory_.reset(reinterpret_cast<char*>(mri));
+    ARKodeSetUserData(mri, data_.get());
+    ARKodeSStolerances(mri, 1.0, 1.0);
+}
+
+template class MultirateRungeKutta<finiteVolume::cellCentred::VolumeField<scalar>>;
+}
+
+#endif
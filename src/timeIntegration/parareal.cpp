@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/timeIntegration/parareal.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace NeoN::timeIntegration
+{
+
+template<typename ValueType>
+scalar maxDifference(const Vector<ValueType>& a, const Vector<ValueType>& b)
+{
+    NF_ASSERT_EQUAL(a.size(), b.size());
+    const auto [aView, bView] = views(a, b);
+    scalar result = 0.0;
+    parallelReduce(
+        a.exec(),
+        a.range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmax) {
+            lmax = Kokkos::max(lmax, mag(aView[i] - bView[i]));
+        },
+        Kokkos::Max<scalar>(result),
+        "Parareal::maxDifference"
+    );
+    return result;
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+SpaceTimeCommunicators splitSpaceTime(MPI_Comm comm, int nSlices)
+{
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    NF_ASSERT(
+        nSlices > 0 && size % nSlices == 0,
+        "The number of ranks needs to be a multiple of the number of time slices."
+    );
+    const int ranksPerSlice = size / nSlices;
+    const int slicei = rank / ranksPerSlice;
+    const int spaceRank = rank % ranksPerSlice;
+
+    SpaceTimeCommunicators result {MPI_COMM_NULL, MPI_COMM_NULL};
+    int err = MPI_Comm_split(comm, slicei, spaceRank, &result.space);
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Comm_split of the space communicator failed.");
+    err = MPI_Comm_split(comm, spaceRank, slicei, &result.time);
+    NF_ASSERT(err == MPI_SUCCESS, "MPI_Comm_split of the time communicator failed.");
+    return result;
+}
+
+#endif
+
+template scalar maxDifference<scalar>(const Vector<scalar>&, const Vector<scalar>&);
+
+template scalar maxDifference<Vec3>(const Vector<Vec3>&, const Vector<Vec3>&);
+
+template class Parareal<fvcc::VolumeField<scalar>>;
+
+template class Parareal<fvcc::VolumeField<Vec3>>;
+
+}
@@ -28,7 +28,8 @@ template<typename SolutionVectorType>
 RungeKutta<SolutionVectorType>::RungeKutta(RungeKutta<SolutionVectorType>&& other)
     : Base(std::move(other)), solution_(std::move(other.solution_)),
       initialConditions_(std::move(other.initialConditions_)), context_(std::move(other.context_)),
-      ODEMemory_(std::move(other.ODEMemory_)), pdeExpr_(std::move(other.pdeExpr_))
+      ODEMemory_(std::move(other.ODEMemory_)), pdeExpr_(std::move(other.pdeExpr_)),
+      rhsData_(std::move(other.rhsData_))
 {}
 
 template<typename SolutionVectorType>
@@ -40,7 +41,11 @@ void RungeKutta<SolutionVectorType>::solve(
     SolutionVectorType& oldSolutionVector =
         NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
     if (pdeExpr_ == nullptr) initSUNERKSolver(exp, oldSolutionVector, t);
-    NeoN::sundials::fieldToSunNVector(oldSolutionVector.internalVector(), solution_.sunNVector());
+    // ARKode writes the solution directly into the memory of the solution field
+    solution_.wrap(solutionVector.internalVector(), context_);
+    // the stages are bound to the fields read by the operators, see sundials::explicitRKSolve
+    rhsData_->solution = &solutionVector;
+    rhsData_->oldSolution = &oldSolutionVector;
     void* ark = reinterpret_cast<void*>(ODEMemory_.get());
 
     // Perform time integration
@@ -52,9 +57,10 @@ void RungeKutta<SolutionVectorType>::solve(
     NF_ASSERT_EQUAL(stepReturn, 0);
     NF_ASSERT_EQUAL(t + dt, timeOut);
 
-    // Copy solution out. (Fence is in sundails free)
-    NeoN::sundials::sunNVectorToVector(solution_.sunNVector(), solutionVector.internalVector());
     oldSolutionVector.internalVector() = solutionVector.internalVector();
+    // the boundaries hold the values of the last stage
+    solutionVector.correctBoundaryConditions();
+    oldSolutionVector.correctBoundaryConditions();
 }
 
 template<typename SolutionVectorType>
@@ -84,20 +90,12 @@ void RungeKutta<SolutionVectorType>::initExpression(const dsl::Expression<ValueT
     pdeExpr_ = std::make_unique<dsl::Expression<ValueType>>(exp);
 }
 
-// NOTE: This function triggers an error with the leak checkers/asan
-// i dont see it to actually leak memory since we use SUN_CONTEXT_DELETER
-// for the time being the we ignore this function by adding it to scripts/san_ignores
-// if you figure out whether it actually leaks memory or how to satisfy asan remove this note
-// and the function from san_ignores.txt
 template<typename SolutionVectorType>
 void RungeKutta<SolutionVectorType>::initSUNContext()
 {
     if (!context_)
     {
-        std::shared_ptr<SUNContext> context(new SUNContext(), sundials::SUN_CONTEXT_DELETER);
-        int flag = SUNContext_Create(SUN_COMM_NULL, context.get());
-        NF_ASSERT(flag == 0, "SUNContext_Create failed");
-        context_.swap(context);
+        context_ = sundials::sharedContext();
     }
 }
 
@@ -105,10 +103,7 @@ template<typename SolutionVectorType>
 void RungeKutta<SolutionVectorType>::initSUNVector(const Executor& exec, size_t size)
 {
     NF_DEBUG_ASSERT(context_, "SUNContext is a nullptr.");
-    solution_.setExecutor(exec);
-    solution_.initNVector(size, context_);
-    initialConditions_.setExecutor(exec);
-    initialConditions_.initNVector(size, context_);
+    initialConditions_.initNVector(exec, size, context_);
 }
 
 template<typename SolutionVectorType>
@@ -116,10 +111,7 @@ void RungeKutta<SolutionVectorType>::initSUNInitialConditions(
     const SolutionVectorType& solutionVector
 )
 {
-
-    NeoN::sundials::fieldToSunNVector(
-        solutionVector.internalVector(), initialConditions_.sunNVector()
-    );
+    initialConditions_.vector() = solutionVector.internalVector();
 }
 
 template<typename SolutionVectorType>
@@ -143,7 +135,8 @@ void RungeKutta<SolutionVectorType>::initODEMemory(const scalar t)
             this->schemeDict_.template get<std::string>("Runge-Kutta-Method")
         )
     );
-    ARKodeSetUserData(ark, pdeExpr_.get());
+    rhsData_->expression = pdeExpr_.get();
+    ARKodeSetUserData(ark, rhsData_.get());
     ARKodeSStolerances(ODEMemory_.get(), 1.0, 1.0); // If we want ARK we will revisit.
 }
 
@@ -0,0 +1,505 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#if NN_WITH_SUNDIALS
+
+#include <cmath>
+#include <type_traits>
+
+#include "NeoN/core/backendRegistry.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+
+namespace NeoN::sundials
+{
+
+static_assert(
+    std::is_same_v<sunrealtype, scalar>, "The NeoN N_Vector requires sunrealtype to be scalar."
+);
+
+namespace
+{
+
+/* @brief the content of a NeoN N_Vector, owned is set for vectors created by N_VClone */
+struct VectorContent
+{
+    NeoN::Vector<scalar>* vector;
+    std::unique_ptr<NeoN::Vector<scalar>> owned;
+};
+
+VectorContent& content(N_Vector v) { return *static_cast<VectorContent*>(v->content); }
+
+NeoN::Vector<scalar>& vec(N_Vector v) { return *content(v).vector; }
+
+N_Vector_ID getVectorID(N_Vector) { return SUNDIALS_NVEC_CUSTOM; }
+
+void destroy(N_Vector v)
+{
+    if (v == nullptr)
+    {
+        return;
+    }
+    delete static_cast<VectorContent*>(v->content);
+    v->content = nullptr;
+    N_VFreeEmpty(v);
+}
+
+N_Vector cloneEmpty(N_Vector w)
+{
+    N_Vector v = N_VNewEmpty(w->sunctx);
+    if (v == nullptr)
+    {
+        return nullptr;
+    }
+    if (N_VCopyOps(w, v) != 0)
+    {
+        N_VFreeEmpty(v);
+        return nullptr;
+    }
+    v->content = new VectorContent {nullptr, nullptr};
+    return v;
+}
+
+N_Vector clone(N_Vector w)
+{
+    N_Vector v = cloneEmpty(w);
+    if (v == nullptr)
+    {
+        return nullptr;
+    }
+    const auto& wVec = vec(w);
+    auto& c = content(v);
+    c.owned = std::make_unique<NeoN::Vector<scalar>>(wVec.exec(), wVec.size());
+    c.vector = c.owned.get();
+    return v;
+}
+
+void space(N_Vector v, sunindextype* lrw, sunindextype* liw)
+{
+    *lrw = static_cast<sunindextype>(vec(v).size());
+    *liw = 0;
+}
+
+sunrealtype* getArrayPointer(N_Vector v) { return vec(v).data(); }
+
+sunindextype getLength(N_Vector v) { return static_cast<sunindextype>(vec(v).size()); }
+
+void linearSum(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y, N_Vector z)
+{
+    waxpby(vec(z), a, vec(x), b, vec(y));
+}
+
+/* @brief computes z = sum_i c_i X_i with two vectors per pass, X[0] may be z
+ *
+ * The explicit Runge-Kutta methods combine the stages with this operation, which otherwise
+ * falls back to one linear sum per stage.
+ */
+int linearCombination(int nvec, sunrealtype* c, N_Vector* X, N_Vector z)
+{
+    auto& zs = vec(z);
+    if (nvec == 1)
+    {
+        waxpby(zs, c[0], vec(X[0]), 0.0, vec(X[0]));
+        return 0;
+    }
+    int i = 2;
+    if (X[0] != z)
+    {
+        waxpby(zs, c[0], vec(X[0]), c[1], vec(X[1]));
+    }
+    else if (nvec == 2)
+    {
+        axpby(c[1], vec(X[1]), c[0], zs);
+    }
+    else
+    {
+        axpbypcz(c[1], vec(X[1]), c[2], vec(X[2]), c[0], zs);
+        i = 3;
+    }
+    for (; i + 1 < nvec; i += 2)
+    {
+        axpbypcz(c[i], vec(X[i]), c[i + 1], vec(X[i + 1]), 1.0, zs);
+    }
+    if (i < nvec)
+    {
+        axpby(c[i], vec(X[i]), 1.0, zs);
+    }
+    return 0;
+}
+
+void constant(sunrealtype c, N_Vector z) { fill(vec(z), c); }
+
+void prod(N_Vector x, N_Vector y, N_Vector z)
+{
+    const auto [zs, xs, ys] = views(vec(z), vec(x), vec(y));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) { zs[i] = xs[i] * ys[i]; },
+        "sundials::prod"
+    );
+}
+
+void divide(N_Vector x, N_Vector y, N_Vector z)
+{
+    const auto [zs, xs, ys] = views(vec(z), vec(x), vec(y));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) { zs[i] = xs[i] / ys[i]; },
+        "sundials::divide"
+    );
+}
+
+void scale(sunrealtype c, N_Vector x, N_Vector z)
+{
+    const auto [zs, xs] = views(vec(z), vec(x));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) { zs[i] = c * xs[i]; },
+        "sundials::scale"
+    );
+}
+
+void absolute(N_Vector x, N_Vector z)
+{
+    const auto [zs, xs] = views(vec(z), vec(x));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) { zs[i] = Kokkos::abs(xs[i]); },
+        "sundials::absolute"
+    );
+}
+
+void inverse(N_Vector x, N_Vector z)
+{
+    const auto [zs, xs] = views(vec(z), vec(x));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) { zs[i] = scalar(1.0) / xs[i]; },
+        "sundials::inverse"
+    );
+}
+
+void addConst(N_Vector x, sunrealtype b, N_Vector z)
+{
+    const auto [zs, xs] = views(vec(z), vec(x));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) { zs[i] = xs[i] + b; },
+        "sundials::addConst"
+    );
+}
+
+void compare(sunrealtype c, N_Vector x, N_Vector z)
+{
+    const auto [zs, xs] = views(vec(z), vec(x));
+    parallelFor(
+        vec(z).exec(),
+        vec(z).range(),
+        KOKKOS_LAMBDA(const localIdx i) {
+            zs[i] = Kokkos::abs(xs[i]) >= c ? scalar(1.0) : scalar(0.0);
+        },
+        "sundials::compare"
+    );
+}
+
+sunrealtype dotProd(N_Vector x, N_Vector y) { return dot(vec(x), vec(y)); }
+
+sunrealtype maxNorm(N_Vector x)
+{
+    const auto xs = vec(x).view();
+    scalar max = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        vec(x).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmax) {
+            lmax = Kokkos::max(lmax, Kokkos::abs(xs[i]));
+        },
+        Kokkos::Max<scalar>(max),
+        "sundials::maxNorm"
+    );
+    return max;
+}
+
+/* @brief returns the sum of (x w)^2 over all elements with a positive id, or all if id is null */
+scalar weightedSquareSum(N_Vector x, N_Vector w, N_Vector id)
+{
+    const auto [xs, ws] = views(vec(x), vec(w));
+    scalar sum = 0.0;
+    if (id == nullptr)
+    {
+        parallelReduce(
+            vec(x).exec(),
+            vec(x).range(),
+            KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+                lsum += (xs[i] * ws[i]) * (xs[i] * ws[i]);
+            },
+            sum,
+            "sundials::weightedSquareSum"
+        );
+        return sum;
+    }
+    const auto ids = vec(id).view();
+    parallelReduce(
+        vec(x).exec(),
+        vec(x).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            lsum += ids[i] > 0.0 ? (xs[i] * ws[i]) * (xs[i] * ws[i]) : scalar(0.0);
+        },
+        sum,
+        "sundials::weightedSquareSumMasked"
+    );
+    return sum;
+}
+
+sunrealtype wrmsNorm(N_Vector x, N_Vector w)
+{
+    return std::sqrt(weightedSquareSum(x, w, nullptr) / static_cast<scalar>(vec(x).size()));
+}
+
+sunrealtype wrmsNormMask(N_Vector x, N_Vector w, N_Vector id)
+{
+    return std::sqrt(weightedSquareSum(x, w, id) / static_cast<scalar>(vec(x).size()));
+}
+
+sunrealtype wl2Norm(N_Vector x, N_Vector w) { return std::sqrt(weightedSquareSum(x, w, nullptr)); }
+
+sunrealtype minimum(N_Vector x)
+{
+    const auto xs = vec(x).view();
+    scalar min = SUN_BIG_REAL;
+    parallelReduce(
+        vec(x).exec(),
+        vec(x).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmin) { lmin = Kokkos::min(lmin, xs[i]); },
+        Kokkos::Min<scalar>(min),
+        "sundials::minimum"
+    );
+    return min;
+}
+
+sunrealtype l1Norm(N_Vector x)
+{
+    const auto xs = vec(x).view();
+    scalar sum = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        vec(x).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) { lsum += Kokkos::abs(xs[i]); },
+        sum,
+        "sundials::l1Norm"
+    );
+    return sum;
+}
+
+sunbooleantype invTest(N_Vector x, N_Vector z)
+{
+    const auto [zs, xs] = views(vec(z), vec(x));
+    scalar nZeros = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        vec(x).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            if (xs[i] == 0.0)
+            {
+                lsum += scalar(1.0);
+            }
+            else
+            {
+                zs[i] = scalar(1.0) / xs[i];
+            }
+        },
+        nZeros,
+        "sundials::invTest"
+    );
+    return nZeros == 0.0 ? SUNTRUE : SUNFALSE;
+}
+
+sunbooleantype constrMask(N_Vector c, N_Vector x, N_Vector m)
+{
+    const auto [ms, cs, xs] = views(vec(m), vec(c), vec(x));
+    scalar nFailed = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        vec(x).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            // |c| = 2 requires x c > 0 and |c| = 1 requires x c >= 0
+            const scalar absC = Kokkos::abs(cs[i]);
+            const bool failed =
+                (absC > 1.5 && xs[i] * cs[i] <= 0.0) || (absC > 0.5 && xs[i] * cs[i] < 0.0);
+            ms[i] = failed ? scalar(1.0) : scalar(0.0);
+            lsum += ms[i];
+        },
+        nFailed,
+        "sundials::constrMask"
+    );
+    return nFailed == 0.0 ? SUNTRUE : SUNFALSE;
+}
+
+sunrealtype minQuotient(N_Vector num, N_Vector denom)
+{
+    const auto [ns, ds] = views(vec(num), vec(denom));
+    scalar min = SUN_BIG_REAL;
+    parallelReduce(
+        vec(num).exec(),
+        vec(num).range(),
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmin) {
+            if (ds[i] != 0.0)
+            {
+                lmin = Kokkos::min(lmin, ns[i] / ds[i]);
+            }
+        },
+        Kokkos::Min<scalar>(min),
+        "sundials::minQuotient"
+    );
+    return min;
+}
+
+void setOps(N_Vector v)
+{
+    v->ops->nvgetvectorid = getVectorID;
+    v->ops->nvclone = clone;
+    v->ops->nvcloneempty = cloneEmpty;
+    v->ops->nvdestroy = destroy;
+    v->ops->nvspace = space;
+    v->ops->nvgetarraypointer = getArrayPointer;
+    v->ops->nvgetdevicearraypointer = getArrayPointer;
+    v->ops->nvgetlength = getLength;
+    v->ops->nvgetlocallength = getLength;
+    v->ops->nvlinearsum = linearSum;
+    v->ops->nvlinearcombination = linearCombination;
+    v->ops->nvconst = constant;
+    v->ops->nvprod = prod;
+    v->ops->nvdiv = divide;
+    v->ops->nvscale = scale;
+    v->ops->nvabs = absolute;
+    v->ops->nvinv = inverse;
+    v->ops->nvaddconst = addConst;
+    v->ops->nvdotprod = dotProd;
+    v->ops->nvmaxnorm = maxNorm;
+    v->ops->nvwrmsnorm = wrmsNorm;
+    v->ops->nvwrmsnormmask = wrmsNormMask;
+    v->ops->nvmin = minimum;
+    v->ops->nvwl2norm = wl2Norm;
+    v->ops->nvl1norm = l1Norm;
+    v->ops->nvcompare = compare;
+    v->ops->nvinvtest = invTest;
+    v->ops->nvconstrmask = constrMask;
+    v->ops->nvminquotient = minQuotient;
+}
+
+}
+
+N_Vector wrapVector(NeoN::Vector<scalar>& vector, SUNContext context)
+{
+    N_Vector v = N_VNewEmpty(context);
+    NF_ASSERT(v != nullptr, "N_VNewEmpty failed.");
+    setOps(v);
+    v->content = new VectorContent {&vector, nullptr};
+    return v;
+}
+
+NeoN::Vector<scalar>& vector(N_Vector nvector)
+{
+    NF_DEBUG_ASSERT(nvector->ops->nvclone == clone, "N_Vector is not a NeoN vector.");
+    return vec(nvector);
+}
+
+void rewrapVector(N_Vector nvector, NeoN::Vector<scalar>& vector)
+{
+    NF_DEBUG_ASSERT(nvector->ops->nvclone == clone, "N_Vector is not a NeoN vector.");
+    auto& c = content(nvector);
+    NF_ASSERT(c.owned == nullptr, "Cannot rewrap an N_Vector owning its data.");
+    c.vector = &vector;
+}
+
+NVector::~NVector()
+{
+    if (svector_ != nullptr)
+    {
+        N_VDestroy(svector_);
+    }
+}
+
+NVector::NVector(const NVector& other) : context_(other.context_)
+{
+    if (other.svector_ == nullptr)
+    {
+        return;
+    }
+    if (other.owned_)
+    {
+        owned_ = std::make_unique<NeoN::Vector<scalar>>(*other.owned_);
+        svector_ = wrapVector(*owned_, *context_);
+        return;
+    }
+    svector_ = wrapVector(vec(other.svector_), *context_);
+}
+
+NVector::NVector(NVector&& other) noexcept
+    : owned_(std::move(other.owned_)), context_(std::move(other.context_)),
+      svector_(other.svector_)
+{
+    other.svector_ = nullptr;
+}
+
+void NVector::initNVector(const Executor& exec, size_t size, std::shared_ptr<SUNContext> context)
+{
+    if (svector_ != nullptr)
+    {
+        N_VDestroy(svector_);
+    }
+    context_ = context;
+    owned_ = std::make_unique<NeoN::Vector<scalar>>(exec, static_cast<localIdx>(size));
+    svector_ = wrapVector(*owned_, *context_);
+}
+
+void NVector::wrap(NeoN::Vector<scalar>& vector, std::shared_ptr<SUNContext> context)
+{
+    if (svector_ != nullptr && !owned_ && context_ == context)
+    {
+        rewrapVector(svector_, vector);
+        return;
+    }
+    if (svector_ != nullptr)
+    {
+        N_VDestroy(svector_);
+    }
+    owned_.reset();
+    context_ = context;
+    svector_ = wrapVector(vector, *context_);
+}
+
+NeoN::Vector<scalar>& NVector::vector()
+{
+    NF_ASSERT(svector_ != nullptr, "The N_Vector is not initialized.");
+    return vec(svector_);
+}
+
+// NOTE: This function triggers an error with the leak checkers/asan
+// i dont see it to actually leak memory since we use SUN_CONTEXT_DELETER
+// for the time being the we ignore this function by adding it to scripts/san_ignores
+// if you figure out whether it actually leaks memory or how to satisfy asan remove this note
+// and the function from san_ignores.txt
+std::shared_ptr<SUNContext> sharedContext()
+{
+    return BackendRegistry::instance().shared<SUNContext>(
+        "SUNDIALS",
+        []()
+        {
+            std::shared_ptr<SUNContext> context(new SUNContext(), SUN_CONTEXT_DELETER);
+            int flag = SUNContext_Create(SUN_COMM_NULL, context.get());
+            NF_ASSERT(flag == 0, "SUNContext_Create failed");
+            return context;
+        }
+    );
+}
+
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 #include "NeoN/timeIntegration/forwardEuler.hpp"
 #include "NeoN/timeIntegration/backwardEuler.hpp"
+#include "NeoN/timeIntegration/bdf2.hpp"
+#include "NeoN/timeIntegration/crankNicolson.hpp"
 
 namespace fvcc = NeoN::finiteVolume::cellCentred;
 
@@ -15,4 +17,8 @@ template class ForwardEuler<fvcc::VolumeField<scalar>>;
 
 template class BackwardEuler<fvcc::VolumeField<scalar>>;
 
+template class BDF2<fvcc::VolumeField<scalar>>;
+
+template class CrankNicolson<fvcc::VolumeField<scalar>>;
+
 } // namespace NeoN::dsl
@@ -87,6 +87,24 @@ TEST_CASE("Array Container Operations")
         REQUIRE(arrayB.range().second == size);
     };
 
+    SECTION("capacity" + execName)
+    {
+        NeoN::Array<NeoN::label> arrayA(exec, {1, 2, 3});
+        REQUIRE(arrayA.capacity() == 3);
+
+        arrayA.resize(1);
+        REQUIRE(arrayA.size() == 1);
+        REQUIRE(arrayA.capacity() == 3);
+
+        arrayA.reserve(8);
+        REQUIRE(arrayA.capacity() == 8);
+        REQUIRE(arrayA.copyToHost().view()[0] == 1);
+
+        arrayA.shrinkToFit();
+        REQUIRE(arrayA.capacity() == 1);
+        REQUIRE(arrayA.copyToHost().view()[0] == 1);
+    }
+
     SECTION("view" + execName)
     {
         NeoN::Array<NeoN::label> a(exec, {1, 2, 3});
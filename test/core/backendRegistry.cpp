@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <sstream>
+#include <string>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("BackendRegistry")
+{
+    auto& registry = NeoN::BackendRegistry::instance();
+
+    SECTION("A backend is initialized once")
+    {
+        int nInits = 0;
+        REQUIRE(!registry.initialized("onceBackend"));
+        registry.initializeOnce("onceBackend", [&]() { nInits++; });
+        registry.initializeOnce("onceBackend", [&]() { nInits++; });
+        REQUIRE(nInits == 1);
+        REQUIRE(registry.initialized("onceBackend"));
+    }
+
+    SECTION("The shared object is created on first use")
+    {
+        int nCreates = 0;
+        const auto create = [&]()
+        {
+            nCreates++;
+            return std::make_shared<int>(42);
+        };
+        auto first = registry.shared<int>("sharedBackend", create);
+        auto second = registry.shared<int>("sharedBackend", create);
+        REQUIRE(nCreates == 1);
+        REQUIRE(first.get() == second.get());
+        REQUIRE(*second == 42);
+
+        // released objects are recreated, the users keep theirs
+        registry.release();
+        auto third = registry.shared<int>("sharedBackend", create);
+        REQUIRE(nCreates == 2);
+        REQUIRE(third.get() != first.get());
+        REQUIRE(*first == 42);
+    }
+
+    SECTION("The initializations are timed and reported")
+    {
+        const auto value = registry.timed("timedBackend", []() { return 3; });
+        registry.timed("timedBackend", []() { return 4; });
+        REQUIRE(value == 3);
+
+        bool found = false;
+        for (const auto& backend : registry.stats())
+        {
+            if (backend.name == "timedBackend")
+            {
+                found = true;
+                REQUIRE(backend.calls == 2);
+                REQUIRE(backend.total >= 0.0);
+                REQUIRE(backend.total <= registry.total());
+            }
+        }
+        REQUIRE(found);
+
+        std::stringstream report;
+        registry.report(report);
+        REQUIRE(report.str().find("timedBackend") != std::string::npos);
+    }
+
+#if NN_WITH_SUNDIALS
+    SECTION("The SUNDIALS context is shared")
+    {
+        auto first = NeoN::sundials::sharedContext();
+        auto second = NeoN::sundials::sharedContext();
+        REQUIRE(first.get() == second.get());
+        REQUIRE(registry.initialized("SUNDIALS"));
+    }
+#endif
+}
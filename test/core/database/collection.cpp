@@ -35,6 +35,34 @@ TEST_CASE("CustomCollection")
 
         REQUIRE(db.size() == 2);
     }
+
+    SECTION("secondary index")
+    {
+        CustomDocument a(std::string("a"), 1.0);
+        CustomDocument b(std::string("b"), 2.0);
+        CustomDocument b2(std::string("b"), 3.0);
+        customCollection.insert(a);
+        customCollection.insert(b);
+
+        // without an index all documents are searched
+        REQUIRE(!customCollection.hasIndex("name"));
+        REQUIRE(customCollection.findBy("name", std::string("b")) == std::vector {b.id()});
+
+        customCollection.createIndex("name");
+        customCollection.insert(b2);
+        REQUIRE(customCollection.hasIndex("name"));
+        REQUIRE(customCollection.findBy("name", std::string("a")) == std::vector {a.id()});
+        REQUIRE(customCollection.findBy("name", std::string("b")).size() == 2);
+        REQUIRE(collection.findBy("name", std::string("c")).empty());
+
+        REQUIRE(customCollection.erase(b.id()));
+        REQUIRE(customCollection.findBy("name", std::string("b")) == std::vector {b2.id()});
+
+        customCollection.doc(b2.id()).get<std::string>("name") = "c";
+        customCollection.reindex(b2.id());
+        REQUIRE(customCollection.findBy("name", std::string("b")).empty());
+        REQUIRE(customCollection.findBy("name", std::string("c")) == std::vector {b2.id()});
+    }
 }
 
 TEST_CASE("CustomDocument")
@@ -65,8 +65,7 @@ public:
         {
             return false;
         }
-        docs_.emplace(id, cc);
-        return true;
+        return emplaceDoc(id, cc);
     }
 
     static CustomCollection& instance(NeoN::Database& db, std::string name)
@@ -258,5 +258,28 @@ TEST_CASE("VectorCollection")
             REQUIRE(docT.iterationIndex() == docT3.iterationIndex());
             REQUIRE(docT.subCycleIndex() == docT3.subCycleIndex());
         }
+
+        SECTION("offload to host memory")
+        {
+            using VolumeField = fvcc::VolumeField<NeoN::scalar>;
+            fvcc::VectorDocument& doc = fieldCollection1.fieldDoc(t.key);
+            REQUIRE(!doc.offloadable());
+            REQUIRE(doc.resident());
+            REQUIRE(fieldCollection1.offloadAll<VolumeField>() == 0);
+
+            NeoN::fill(t.internalVector(), 3.0);
+            doc.setOffloadable(true);
+            REQUIRE(fieldCollection1.offloadAll<VolumeField>() == 1);
+            const bool hostAccessible = NeoN::detail::hostAccessible(exec);
+            // memory accessible from the host is kept
+            REQUIRE(t.internalVector().capacity() == (hostAccessible ? mesh.nCells() : 0));
+            REQUIRE(doc.resident() == hostAccessible);
+
+            REQUIRE(fieldCollection1.prefetchAll<VolumeField>() == (hostAccessible ? 0 : 1));
+            REQUIRE(doc.resident());
+            REQUIRE(t.internalVector().size() == mesh.nCells());
+            auto tHostAfter = t.internalVector().copyToHost();
+            REQUIRE(tHostAfter.view()[0] == 3.0);
+        }
     }
 }
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <string>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+struct CreateVector
+{
+    std::string name;
+    const NeoN::UnstructuredMesh& mesh;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        const auto& offsets = mesh.boundaryMesh().offset();
+        std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs {};
+        for (NeoN::localIdx patchi = 0; patchi + 1 < NeoN::localIdx(offsets.size()); patchi++)
+        {
+            NeoN::Dictionary dict;
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", 2.0);
+            bcs.push_back(fvcc::VolumeBoundary<NeoN::scalar>(mesh, dict, patchi));
+        }
+        NeoN::Field<NeoN::scalar> domainVector(
+            mesh.exec(),
+            NeoN::Vector<NeoN::scalar>(mesh.exec(), mesh.nCells(), 1.0),
+            offsets
+        );
+        fvcc::VolumeField<NeoN::scalar> vf(mesh.exec(), name, mesh, domainVector, bcs, db, "", "");
+        return NeoN::Document(
+            {{"name", vf.name},
+             {"timeIndex", std::int64_t(1)},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", vf}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+TEST_CASE("gradientCollection")
+{
+    NeoN::Database db;
+
+    NeoN::Executor exec = GENERATE(
+        NeoN::Executor(NeoN::SerialExecutor {}),
+        NeoN::Executor(NeoN::CPUExecutor {}),
+        NeoN::Executor(NeoN::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    NeoN::UnstructuredMesh mesh = NeoN::createSingleCellMesh(exec);
+
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "testVectorCollection");
+    fvcc::VolumeField<NeoN::scalar>& t =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "T", .mesh = mesh}
+        );
+
+    // a stand-in for a gradient scheme which counts its evaluations
+    int nEvaluations = 0;
+    auto compute = [&](const fvcc::VolumeField<NeoN::scalar>& field)
+    {
+        nEvaluations++;
+        return NeoN::Vector<NeoN::scalar>(field.internalVector());
+    };
+
+    SECTION("The gradient is computed once per iteration " + execName)
+    {
+        auto& first = fvcc::cachedGradient(t, compute);
+        auto& second = fvcc::cachedGradient(t, compute);
+        REQUIRE(nEvaluations == 1);
+        REQUIRE(&first == &second);
+
+        auto& gradientCollection = fvcc::GradientCollection::instance(fieldCollection);
+        REQUIRE(gradientCollection.name() == "testVectorCollection_gradient");
+        REQUIRE(gradientCollection.size() == 1);
+        REQUIRE(gradientCollection.findGradient(t.key) != "");
+
+        fieldCollection.fieldDoc(t.key).iterationIndex()++;
+        fvcc::cachedGradient(t, compute);
+        REQUIRE(nEvaluations == 2);
+        REQUIRE(gradientCollection.size() == 1);
+
+        fieldCollection.fieldDoc(t.key).timeIndex()++;
+        fvcc::cachedGradient(t, compute);
+        fvcc::cachedGradient(t, compute);
+        REQUIRE(nEvaluations == 3);
+    }
+
+    SECTION("A modification of the field invalidates the gradient " + execName)
+    {
+        fvcc::cachedGradient(t, compute);
+        NeoN::fill(t.internalVector(), 3.0);
+        auto& gradient = fvcc::cachedGradient(t, compute);
+        REQUIRE(nEvaluations == 2);
+        REQUIRE(gradient.copyToHost().view()[0] == 3.0);
+    }
+
+    SECTION("A modification of the boundary values invalidates the gradient " + execName)
+    {
+        fvcc::cachedGradient(t, compute);
+        NeoN::fill(t.boundaryData().value(), 3.0);
+        fvcc::cachedGradient(t, compute);
+        REQUIRE(nEvaluations == 2);
+        fvcc::cachedGradient(t, compute);
+        REQUIRE(nEvaluations == 2);
+    }
+
+    SECTION("A motion of the mesh invalidates the gradient " + execName)
+    {
+        // a unit cube with the x faces and the remaining faces as patches
+        std::vector<NeoN::Vec3> points;
+        for (int k = 0; k < 2; k++)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                for (int i = 0; i < 2; i++)
+                {
+                    points.emplace_back(double(i), double(j), double(k));
+                }
+            }
+        }
+        const auto p = [](int i, int j, int k) { return NeoN::label(i + 2 * (j + 2 * k)); };
+        const NeoN::labelVector faceVertices(
+            exec,
+            std::vector<NeoN::label> {
+                p(0, 0, 0), p(0, 0, 1), p(0, 1, 1), p(0, 1, 0), // x = 0
+                p(1, 0, 0), p(1, 1, 0), p(1, 1, 1), p(1, 0, 1), // x = 1
+                p(0, 0, 0), p(1, 0, 0), p(1, 0, 1), p(0, 0, 1), // y = 0
+                p(0, 1, 0), p(0, 1, 1), p(1, 1, 1), p(1, 1, 0), // y = 1
+                p(0, 0, 0), p(0, 1, 0), p(1, 1, 0), p(1, 0, 0), // z = 0
+                p(0, 0, 1), p(1, 0, 1), p(1, 1, 1), p(0, 1, 1)  // z = 1
+            }
+        );
+        const NeoN::Vector<NeoN::localIdx> faceOffsets(
+            exec, std::vector<NeoN::localIdx> {0, 4, 8, 12, 16, 20, 24}
+        );
+        auto cube = NeoN::createMeshFromFaces(
+            NeoN::vectorVector(exec, points),
+            faceOffsets,
+            faceVertices,
+            NeoN::labelVector(exec, std::vector<NeoN::label>(6, 0)),
+            NeoN::labelVector(exec, 0),
+            1,
+            {0, 2, 6}
+        );
+
+        // the database is destroyed before the mesh its field refers to
+        NeoN::Database cubeDb;
+        fvcc::VectorCollection& cubeCollection =
+            fvcc::VectorCollection::instance(cubeDb, "cubeVectorCollection");
+        fvcc::VolumeField<NeoN::scalar>& u =
+            cubeCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+                CreateVector {.name = "U", .mesh = cube}
+            );
+
+        fvcc::cachedGradient(u, compute);
+        fvcc::cachedGradient(u, compute);
+        REQUIRE(nEvaluations == 1);
+
+        std::vector<NeoN::Vec3> moved;
+        for (const auto& point : points)
+        {
+            moved.push_back(2.0 * point);
+        }
+        NeoN::movePoints(cube, NeoN::vectorVector(exec, moved), faceOffsets, faceVertices, 1.0);
+        fvcc::cachedGradient(u, compute);
+        REQUIRE(nEvaluations == 2);
+    }
+}
@@ -191,5 +191,50 @@ TEST_CASE("oldTimeCollection")
             // check if the same field is returned
             REQUIRE(&tOld2 == &sametOld2);
         }
+
+        SECTION("handle")
+        {
+            fvcc::OldTimeHandle<fvcc::VolumeField<NeoN::scalar>> handle;
+            auto& tOld = handle.get(t);
+            REQUIRE(tOld.name == "T_0");
+            REQUIRE(&handle.get(t) == &tOld);
+            REQUIRE(&fvcc::oldTime(t) == &tOld);
+
+            // a different field is resolved again
+            auto& tOld2 = handle.get(tOld);
+            REQUIRE(tOld2.name == "T_0_0");
+            REQUIRE(&fvcc::oldTime(tOld) == &tOld2);
+            REQUIRE(fvcc::OldTimeCollection::instance(fieldCollection).size() == 2);
+        }
+
+        SECTION("rotate")
+        {
+            auto& tOld = fvcc::oldTime(t);
+            auto& tOld2 = fvcc::oldTime(tOld);
+            NeoN::fill(t.internalVector(), 3.0);
+            NeoN::fill(tOld.internalVector(), 2.0);
+            NeoN::fill(tOld2.internalVector(), 1.0);
+            const auto* tData = t.internalVector().data();
+            const auto* tOldData = tOld.internalVector().data();
+
+            fvcc::rotateOldTimes(t, false);
+            // the buffers are passed on without copies
+            REQUIRE(tOld.internalVector().data() == tData);
+            REQUIRE(tOld2.internalVector().data() == tOldData);
+            REQUIRE(tOld.internalVector().copyToHost().view()[0] == 3.0);
+            REQUIRE(tOld2.internalVector().copyToHost().view()[0] == 2.0);
+            REQUIRE(t.internalVector().copyToHost().view()[0] == 1.0);
+            REQUIRE(tOld.name == "T_0");
+            REQUIRE(fieldCollection.fieldDoc(t.key).timeIndex() == 2);
+            REQUIRE(fieldCollection.fieldDoc(tOld.key).timeIndex() == 1);
+            REQUIRE(fieldCollection.fieldDoc(tOld2.key).timeIndex() == 0);
+
+            NeoN::fill(t.internalVector(), 4.0);
+            fvcc::rotateOldTimes(t);
+            REQUIRE(t.internalVector().copyToHost().view()[0] == 4.0);
+            REQUIRE(tOld.internalVector().copyToHost().view()[0] == 4.0);
+            REQUIRE(tOld2.internalVector().copyToHost().view()[0] == 3.0);
+            REQUIRE(&fvcc::oldTime(t) == &tOld);
+        }
     }
 }
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <sstream>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("solverStatsCollection")
+{
+    NeoN::Database db;
+    auto& collection = NeoN::la::SolverStatsCollection::instance(db);
+
+    REQUIRE(db.contains("solverStats"));
+    REQUIRE(&collection == &NeoN::la::SolverStatsCollection::instance(db));
+
+    NeoN::la::SolverStats first {3, 1.0, 1e-3, 2.0, {0.5, 0.25, 1.0, 0.125}};
+    NeoN::la::SolverStats second {5, 2.0, 1e-4, 4.0, {0.0, 0.0, 4.0, 0.0}};
+    collection.record("U", 1, 0, first);
+    collection.record("p", 1, 0, second);
+    collection.record("U", 2, 0, second);
+    collection.record("U", 2, 1, first);
+
+    SECTION("The solves are queried per equation in their order")
+    {
+        auto history = collection.history("U");
+        REQUIRE(history.size() == 3);
+        REQUIRE(history[0].timeIndex() == 1);
+        REQUIRE(history[1].timeIndex() == 2);
+        REQUIRE(history[2].iterationIndex() == 1);
+        REQUIRE(history[0].solveIndex() < history[1].solveIndex());
+
+        auto stats = history[0].stats();
+        REQUIRE(stats.numIter == 3);
+        REQUIRE(stats.finalResNorm == Catch::Approx(1e-3));
+        REQUIRE(stats.timings.preconditionerTime == Catch::Approx(0.25));
+        REQUIRE(stats.timings.transferTime == Catch::Approx(0.125));
+
+        REQUIRE(collection.history("p").size() == 1);
+        REQUIRE(collection.history("T").empty());
+    }
+
+    SECTION("The solves are queried per equation and time step")
+    {
+        auto history = collection.history("U", 2);
+        REQUIRE(history.size() == 2);
+        REQUIRE(history[0].stats().numIter == 5);
+        REQUIRE(history[1].stats().numIter == 3);
+    }
+
+    SECTION("All solves are written as a table")
+    {
+        std::stringstream ss;
+        collection.write(ss);
+        std::string line;
+        int nLines = 0;
+        while (std::getline(ss, line))
+        {
+            nLines++;
+        }
+        REQUIRE(nLines == 5);
+        REQUIRE(ss.str().rfind("equation,timeIndex,iterationIndex,numIter", 0) == 0);
+    }
+}
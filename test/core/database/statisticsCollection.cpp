@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <cmath>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "NeoN/NeoN.hpp"
+#include "NeoN/core/database/statisticsCollection.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+struct CreateVector
+{
+    std::string name;
+    const NeoN::UnstructuredMesh& mesh;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs {};
+        for (auto patchi : std::vector<NeoN::localIdx> {0, 1, 2, 3})
+        {
+            NeoN::Dictionary dict;
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", 2.0);
+            bcs.push_back(fvcc::VolumeBoundary<NeoN::scalar>(mesh, dict, patchi));
+        }
+        NeoN::Field<NeoN::scalar> domainVector(
+            mesh.exec(),
+            NeoN::Vector<NeoN::scalar>(mesh.exec(), mesh.nCells(), 1.0),
+            {0, 10, 20, 30}
+        );
+        fvcc::VolumeField<NeoN::scalar> vf(mesh.exec(), name, mesh, domainVector, bcs, db, "", "");
+        return NeoN::Document(
+            {{"name", vf.name},
+             {"timeIndex", std::int64_t(1)},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", vf}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+TEST_CASE("statisticsCollection")
+{
+    NeoN::Database db;
+
+    NeoN::Executor exec = GENERATE(
+        NeoN::Executor(NeoN::SerialExecutor {}),
+        NeoN::Executor(NeoN::CPUExecutor {}),
+        NeoN::Executor(NeoN::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    NeoN::UnstructuredMesh mesh = NeoN::createSingleCellMesh(exec);
+
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "testVectorCollection");
+    fvcc::VolumeField<NeoN::scalar>& t =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "T", .mesh = mesh}
+        );
+
+    SECTION("The statistics match the sample statistics " + execName)
+    {
+        const std::vector<NeoN::scalar> samples {1.0, 4.0, -2.0, 5.0};
+        for (auto sample : samples)
+        {
+            NeoN::fill(t.internalVector(), sample);
+            REQUIRE(fvcc::accumulateStatistics(t));
+            // further iterations of the time step are not sampled
+            fieldCollection.fieldDoc(t.key).iterationIndex()++;
+            REQUIRE(!fvcc::accumulateStatistics(t));
+            fieldCollection.fieldDoc(t.key).timeIndex()++;
+        }
+
+        auto& collection = fvcc::StatisticsCollection::instance(fieldCollection);
+        REQUIRE(collection.name() == "testVectorCollection_statistics");
+        REQUIRE(collection.size() == 1);
+        auto& statistics =
+            collection.statisticsDoc(collection.findStatistics(t.key)).statistics<NeoN::scalar>();
+        REQUIRE(statistics.nSamples() == 4);
+        REQUIRE(statistics.mean().copyToHost().view()[0] == Catch::Approx(2.0));
+        // the population variance of the samples is 7.5
+        REQUIRE(statistics.m2().copyToHost().view()[0] == Catch::Approx(30.0));
+        REQUIRE(statistics.rms().copyToHost().view()[0] == Catch::Approx(std::sqrt(7.5)));
+        REQUIRE(statistics.min().copyToHost().view()[0] == -2.0);
+        REQUIRE(statistics.max().copyToHost().view()[0] == 5.0);
+    }
+
+    SECTION("The statistics are decimated in time " + execName)
+    {
+        auto& collection = fvcc::statisticsCollection(t);
+        collection.registerStatistics(t, 3);
+        NeoN::localIdx nSampled = 0;
+        for (int step = 0; step < 7; step++)
+        {
+            NeoN::fill(t.internalVector(), NeoN::scalar(step));
+            nSampled += collection.accumulate(t) ? 1 : 0;
+            fieldCollection.fieldDoc(t.key).timeIndex()++;
+        }
+        // the steps 0, 3 and 6 are sampled
+        REQUIRE(nSampled == 3);
+        auto& statistics =
+            collection.statisticsDoc(collection.findStatistics(t.key)).statistics<NeoN::scalar>();
+        REQUIRE(statistics.mean().copyToHost().view()[0] == Catch::Approx(3.0));
+        REQUIRE(statistics.min().copyToHost().view()[0] == 0.0);
+        REQUIRE(statistics.max().copyToHost().view()[0] == 6.0);
+    }
+}
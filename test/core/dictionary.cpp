@@ -5,6 +5,7 @@
 #include "catch2_common.hpp"
 
 #include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/dictionaryBinding.hpp"
 
 TEST_CASE("Dictionary operations", "[dictionary]")
 {
@@ -81,3 +82,71 @@ TEST_CASE("Dictionary operations", "[dictionary]")
         REQUIRE(dictInit.get<std::string>("key2") == "Hello");
     }
 }
+
+TEST_CASE("Dictionary version", "[dictionary]")
+{
+    NeoN::Dictionary dict {{"key1", 42}, {"subDict", NeoN::Dictionary({{"key2", 1.0}})}};
+    const auto version = dict.version();
+    REQUIRE(version != 0);
+
+    SECTION("const access keeps the version")
+    {
+        const auto& cdict = dict;
+        REQUIRE(cdict.get<int>("key1") == 42);
+        REQUIRE(cdict.subDict("subDict").get<double>("key2") == 1.0);
+        REQUIRE(dict.version() == version);
+    }
+
+    SECTION("copies share the version")
+    {
+        NeoN::Dictionary copy(dict);
+        REQUIRE(copy.version() == version);
+        copy.insert("key3", 3);
+        REQUIRE(copy.version() != version);
+        REQUIRE(dict.version() == version);
+
+        NeoN::Dictionary moved(std::move(copy));
+        REQUIRE(moved.version() != version);
+        REQUIRE(copy.version() != moved.version());
+    }
+
+    SECTION("modifications change the version")
+    {
+        dict.insert("key1", 43);
+        const auto inserted = dict.version();
+        REQUIRE(inserted != version);
+        dict.subDict("subDict").insert("key2", 2.0);
+        REQUIRE(dict.version() != inserted);
+        const auto nested = dict.version();
+        dict.remove("key1");
+        REQUIRE(dict.version() != nested);
+    }
+}
+
+TEST_CASE("DictionaryBinding", "[dictionary]")
+{
+    NeoN::Dictionary dict {{"key1", 42}};
+    NeoN::DictionaryBinding<int> binding;
+    int nParsed = 0;
+    auto parse = [&](const NeoN::Dictionary& d)
+    {
+        nParsed++;
+        return d.get<int>("key1");
+    };
+
+    REQUIRE_FALSE(binding.bound(dict));
+    REQUIRE(binding.bind(dict, parse) == 42);
+    REQUIRE(binding.bind(dict, parse) == 42);
+    REQUIRE(binding.bind(NeoN::Dictionary(dict), parse) == 42);
+    REQUIRE(nParsed == 1);
+
+    dict.insert("key1", 7);
+    REQUIRE_FALSE(binding.bound(dict));
+    REQUIRE(binding.bind(dict, parse) == 7);
+    REQUIRE(binding.value() == 7);
+    REQUIRE(nParsed == 2);
+
+    binding.reset();
+    REQUIRE(binding.bind(dict, parse) == 7);
+    REQUIRE(nParsed == 3);
+}
@@ -8,7 +8,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_adapters.hpp>
 
+#include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/executor/executor.hpp"
+#include "NeoN/core/vector/vector.hpp"
 
 TEST_CASE("Executor Equality")
 {
@@ -32,3 +34,42 @@ TEST_CASE("Executor Equality")
     REQUIRE(gpuExec0 != ompExec1);
     REQUIRE(gpuExec0 == gpuExec1);
 }
+
+TEST_CASE("Executor Partition")
+{
+    NeoN::Executor cpuExec(NeoN::SerialExecutor {});
+    NeoN::Executor ompExec(NeoN::CPUExecutor {});
+    NeoN::Executor gpuExec(NeoN::GPUExecutor {});
+
+    for (const auto& exec : {cpuExec, ompExec, gpuExec})
+    {
+        auto execs = NeoN::partition(exec, 2);
+
+        REQUIRE(execs.size() == 2);
+        for (const auto& instanceExec : execs)
+        {
+            // instances share the memory space, hence they are compatible with exec
+            REQUIRE(instanceExec == exec);
+            NeoN::fence(instanceExec);
+        }
+    }
+}
+
+TEST_CASE("Executor First Touch")
+{
+    NeoN::CPUExecutor exec {};
+    const bool wasEnabled = NeoN::CPUExecutor::firstTouch();
+
+    for (const bool enabled : {true, false})
+    {
+        NeoN::CPUExecutor::setFirstTouch(enabled);
+        REQUIRE(NeoN::CPUExecutor::firstTouch() == enabled);
+
+        // the touched allocation is usable as usual
+        NeoN::Vector<NeoN::scalar> vec(exec, 10000);
+        NeoN::fill(vec, 1.0);
+        REQUIRE(NeoN::equal(vec, 1.0));
+    }
+
+    NeoN::CPUExecutor::setFirstTouch(wasEnabled);
+}
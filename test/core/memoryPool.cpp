@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("MemoryPool")
+{
+    NeoN::SerialExecutor exec {};
+    auto& pool = NeoN::memoryPool(exec);
+    const bool wasEnabled = pool.enabled();
+    pool.setEnabled(true);
+    pool.resetStatistics();
+    const auto inUse = pool.statistics().bytesInUse;
+
+    SECTION("Reuse freed blocks")
+    {
+        void* first = exec.alloc(1000);
+        REQUIRE(pool.statistics().misses == 1);
+        REQUIRE(pool.statistics().bytesInUse == inUse + 1024);
+        exec.free(first);
+        REQUIRE(pool.statistics().bytesCached >= 1024);
+
+        // same size class, served from the free list
+        void* second = exec.alloc(900);
+        REQUIRE(second == first);
+        REQUIRE(pool.statistics().hits == 1);
+        exec.free(second);
+    }
+
+    SECTION("Vectors preserve content on resize")
+    {
+        NeoN::Vector<NeoN::scalar> vec(exec, 10, 2.0);
+        vec.resize(20);
+        auto vecView = vec.view();
+        for (NeoN::localIdx i = 0; i < 10; i++)
+        {
+            REQUIRE(vecView[i] == 2.0);
+        }
+    }
+
+    SECTION("Host executors share the pool of the host memory space")
+    {
+        NeoN::CPUExecutor cpuExec {};
+        REQUIRE(&NeoN::memoryPool(cpuExec) == &pool);
+
+        void* first = exec.alloc(1000);
+        exec.free(first);
+        void* second = cpuExec.alloc(1000);
+        REQUIRE(second == first);
+        cpuExec.free(second);
+    }
+
+    SECTION("Disabled pools allocate without caching")
+    {
+        pool.setEnabled(false);
+        void* ptr = exec.alloc(1000);
+        REQUIRE(pool.statistics().bytesInUse == inUse);
+        exec.free(ptr);
+        REQUIRE(pool.statistics().bytesCached == 0);
+        pool.setEnabled(true);
+    }
+
+    SECTION("Peak usage")
+    {
+        void* a = exec.alloc(256);
+        void* b = exec.alloc(256);
+        exec.free(a);
+        exec.free(b);
+        REQUIRE(pool.statistics().peakBytesInUse >= inUse + 512);
+        REQUIRE(pool.statistics().bytesInUse == inUse);
+    }
+
+    SECTION("Pinned host memory")
+    {
+        const bool wasPinned = pool.pinned();
+        NeoN::setPinnedHostMemory(true);
+        REQUIRE(pool.pinned() == pool.supportsPinned());
+
+        NeoN::Vector<NeoN::scalar> vec(exec, 10, 2.0);
+        vec.resize(300);
+        // blocks allocated with the other setting are freed correctly
+        pool.setPinned(!pool.pinned());
+        vec.resize(600);
+        auto vecView = vec.view();
+        for (NeoN::localIdx i = 0; i < 10; i++)
+        {
+            REQUIRE(vecView[i] == 2.0);
+        }
+        NeoN::setPinnedHostMemory(wasPinned);
+    }
+
+    SECTION("Managed device memory")
+    {
+        NeoN::GPUExecutor gpuExec {};
+        auto& gpuPool = NeoN::memoryPool(gpuExec);
+        const bool wasManaged = gpuPool.managed();
+        NeoN::setManagedDeviceMemory(true);
+        REQUIRE(gpuPool.managed() == gpuPool.supportsManaged());
+
+        NeoN::Vector<NeoN::scalar> vec(gpuExec, 10, 2.0);
+        NeoN::adviseReadMostly(vec);
+        vec.resize(300);
+        NeoN::prefetch(vec);
+        // blocks allocated with the other setting are freed correctly
+        gpuPool.setManaged(!gpuPool.managed());
+        vec.resize(600);
+        auto vecHost = vec.copyToHost();
+        auto vecView = vecHost.view();
+        for (NeoN::localIdx i = 0; i < 10; i++)
+        {
+            REQUIRE(vecView[i] == 2.0);
+        }
+        NeoN::setManagedDeviceMemory(wasManaged);
+    }
+
+    pool.setEnabled(wasEnabled);
+}
+
+TEST_CASE("MemoryUsage")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto enabled = GENERATE(true, false);
+    const auto setEnabled = [&](bool on)
+    {
+        return std::visit(
+            [on](const auto& e)
+            {
+                auto& pool = NeoN::memoryPool(e);
+                const bool was = pool.enabled();
+                pool.setEnabled(on);
+                pool.resetStatistics();
+                return was;
+            },
+            exec
+        );
+    };
+    const bool wasEnabled = setEnabled(enabled);
+    const auto before = NeoN::memoryUsage(exec);
+
+    SECTION("Current and peak bytes " + execName)
+    {
+        {
+            NeoN::Vector<NeoN::scalar> a(exec, 100, 1.0);
+            REQUIRE(NeoN::memoryUsage(exec).bytes == before.bytes + 100 * sizeof(NeoN::scalar));
+            REQUIRE(NeoN::memoryUsage(exec).allocations == before.allocations + 1);
+            a.resize(200);
+            REQUIRE(NeoN::memoryUsage(exec).bytes == before.bytes + 200 * sizeof(NeoN::scalar));
+        }
+        const auto after = NeoN::memoryUsage(exec);
+        REQUIRE(after.bytes == before.bytes);
+        REQUIRE(after.allocations == before.allocations);
+        REQUIRE(after.peakBytes >= before.bytes + 200 * sizeof(NeoN::scalar));
+    }
+
+    SECTION("Usage per label " + execName)
+    {
+        NeoN::setTrackAllocationLabels(true);
+        {
+            NeoN::AllocationLabel label("memoryUsageTest");
+            NeoN::Vector<NeoN::scalar> a(exec, 10, 1.0);
+            const auto labels = std::visit(
+                [](const auto& e) { return NeoN::memoryPool(e).usageByLabel(); }, exec
+            );
+            auto it = std::find_if(
+                labels.begin(),
+                labels.end(),
+                [](const auto& l) { return l.first == "memoryUsageTest"; }
+            );
+            REQUIRE(it != labels.end());
+            REQUIRE(it->second.bytes == 10 * sizeof(NeoN::scalar));
+            REQUIRE(it->second.allocations == 1);
+        }
+        REQUIRE(NeoN::detail::allocationLabel == "Vector");
+        NeoN::setTrackAllocationLabels(false);
+
+        std::stringstream report;
+        NeoN::reportMemoryUsage(report);
+        REQUIRE(report.str().find("memoryUsageTest") != std::string::npos);
+    }
+
+    setEnabled(wasEnabled);
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <sstream>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "NeoN/core/mpi/deviceSelection.hpp"
+
+using namespace NeoN;
+using namespace NeoN::mpi;
+
+TEST_CASE("deviceId")
+{
+    SECTION("no devices")
+    {
+        REQUIRE(deviceId(0, 4, 0, DeviceMapping::roundRobin) == -1);
+        REQUIRE(deviceId(3, 4, 0, DeviceMapping::block) == -1);
+    }
+
+    SECTION("round robin")
+    {
+        REQUIRE(deviceId(0, 8, 4, DeviceMapping::roundRobin) == 0);
+        REQUIRE(deviceId(3, 8, 4, DeviceMapping::roundRobin) == 3);
+        REQUIRE(deviceId(4, 8, 4, DeviceMapping::roundRobin) == 0);
+        REQUIRE(deviceId(7, 8, 4, DeviceMapping::roundRobin) == 3);
+    }
+
+    SECTION("block")
+    {
+        REQUIRE(deviceId(0, 8, 4, DeviceMapping::block) == 0);
+        REQUIRE(deviceId(1, 8, 4, DeviceMapping::block) == 0);
+        REQUIRE(deviceId(2, 8, 4, DeviceMapping::block) == 1);
+        REQUIRE(deviceId(7, 8, 4, DeviceMapping::block) == 3);
+        // more devices than ranks
+        REQUIRE(deviceId(1, 2, 4, DeviceMapping::block) == 2);
+    }
+}
+
+TEST_CASE("selectDevice")
+{
+    MPIEnvironment mpiEnviron;
+    const auto assignment = selectDevice(mpiEnviron);
+
+    REQUIRE(assignment.nodeRank >= 0);
+    REQUIRE(assignment.nodeRank < assignment.nodeSize);
+    REQUIRE(assignment.nodeSize <= static_cast<int>(mpiEnviron.sizeRank()));
+    REQUIRE(assignment.nDevices == nVisibleDevices());
+    if (assignment.nDevices == 0)
+    {
+        REQUIRE(assignment.deviceId == -1);
+    }
+    else
+    {
+        REQUIRE(assignment.deviceId >= 0);
+        REQUIRE(assignment.deviceId < assignment.nDevices);
+    }
+
+    std::ostringstream out;
+    reportDevices(mpiEnviron, assignment, out);
+    if (mpiEnviron.rank() == 0)
+    {
+        REQUIRE(out.str().find("rank host") == 0);
+    }
+    else
+    {
+        REQUIRE(out.str().empty());
+    }
+}
@@ -82,4 +82,40 @@ TEST_CASE("halfDuplexBuffer")
         send.finaliseComm();
         receive.finaliseComm();
     }
+
+    SECTION("Persistent Send and Receive")
+    {
+        HalfDuplexCommBuffer send(mpiEnviron, rankCommSize);
+        HalfDuplexCommBuffer receive(mpiEnviron, rankCommSize);
+        send.setPersistent(true);
+        receive.setPersistent(true);
+        REQUIRE(send.isPersistent());
+
+        // the requests are created on the first exchange and restarted on the second
+        for (int iter = 0; iter < 2; ++iter)
+        {
+            send.initComm<int>("Persistent Send and Receive");
+            receive.initComm<int>("Persistent Send and Receive");
+            for (size_t rank = 0; rank < mpiEnviron.sizeRank(); ++rank)
+            {
+                auto data = send.get<int>(rank);
+                data[0] = static_cast<int>(rank) + iter;
+            }
+
+            send.send();
+            receive.receive();
+
+            send.waitComplete();
+            receive.waitComplete();
+
+            for (size_t rank = 0; rank < mpiEnviron.sizeRank(); ++rank)
+            {
+                auto data = receive.get<int>(rank);
+                REQUIRE(data[0] == static_cast<int>(mpiEnviron.rank()) + iter);
+            }
+
+            send.finaliseComm();
+            receive.finaliseComm();
+        }
+    }
 }
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "NeoN/core/mpi/environment.hpp"
+#include "NeoN/core/mpi/reductionBatch.hpp"
+
+using namespace NeoN;
+using namespace NeoN::mpi;
+
+TEST_CASE("ReductionBatch")
+{
+    MPIEnvironment mpiEnviron;
+    const auto rank = static_cast<scalar>(mpiEnviron.rank());
+    const auto nRanks = static_cast<scalar>(mpiEnviron.sizeRank());
+
+    SECTION("Values of different operations are reduced in a single all-reduce")
+    {
+        ReductionBatch batch(mpiEnviron.comm());
+        const auto maxIdx = batch.add(rank, ReduceOp::Max);
+        const auto minIdx = batch.add(rank, ReduceOp::Min);
+        const auto sumIdx = batch.add(1.0, ReduceOp::Sum);
+        const auto prodIdx = batch.add(2.0, ReduceOp::Prod);
+        const auto vecIdx = batch.add(Vec3(rank, 1.0, -rank), ReduceOp::Sum);
+        REQUIRE(batch.size() == 7);
+
+        batch.reduce();
+        REQUIRE(batch.nReductions() == 1);
+        REQUIRE(batch.value(maxIdx) == nRanks - 1.0);
+        REQUIRE(batch.value(minIdx) == 0.0);
+        REQUIRE(batch.value(sumIdx) == nRanks);
+        REQUIRE(batch.value(prodIdx) == std::pow(2.0, nRanks));
+        const scalar rankSum = 0.5 * nRanks * (nRanks - 1.0);
+        REQUIRE(batch.vec3(vecIdx) == Vec3(rankSum, nRanks, -rankSum));
+
+        // a batch of the same operations is reduced again
+        batch.clear();
+        batch.add(rank, ReduceOp::Max);
+        batch.add(rank, ReduceOp::Min);
+        batch.add(1.0, ReduceOp::Sum);
+        batch.add(2.0, ReduceOp::Prod);
+        batch.add(Vec3(rank, 1.0, -rank), ReduceOp::Sum);
+        batch.reduce();
+        REQUIRE(batch.nReductions() == 2);
+        REQUIRE(batch.value(maxIdx) == nRanks - 1.0);
+        REQUIRE(batch.vec3(vecIdx) == Vec3(rankSum, nRanks, -rankSum));
+    }
+
+    SECTION("Values of a single operation are reduced")
+    {
+        ReductionBatch batch(mpiEnviron.comm());
+        const auto first = batch.add(rank, ReduceOp::Sum);
+        const auto second = batch.add(2.0, ReduceOp::Sum);
+        batch.reduce();
+        REQUIRE(batch.value(first) == 0.5 * nRanks * (nRanks - 1.0));
+        REQUIRE(batch.value(second) == 2.0 * nRanks);
+    }
+
+    SECTION("The reduction overlaps with local work")
+    {
+        ReductionBatch batch(mpiEnviron.comm());
+        const auto maxIdx = batch.add(rank, ReduceOp::Max);
+        const auto sumIdx = batch.add(rank, ReduceOp::Sum);
+        batch.start();
+        REQUIRE(batch.pending());
+        batch.wait();
+        REQUIRE(!batch.pending());
+        REQUIRE(batch.value(maxIdx) == nRanks - 1.0);
+        REQUIRE(batch.value(sumIdx) == 0.5 * nRanks * (nRanks - 1.0));
+    }
+
+    SECTION("Results of a fused parallelReduce are added with their operation")
+    {
+        scalar maxValue = rank;
+        scalar minValue = rank;
+        Kokkos::Max<scalar> maxReducer(maxValue);
+        Kokkos::Min<scalar> minReducer(minValue);
+        const scalar sum = 1.0;
+
+        ReductionBatch batch(mpiEnviron.comm());
+        const auto [maxIdx, minIdx, sumIdx] = addReductions(batch, maxReducer, minReducer, sum);
+        batch.reduce();
+        REQUIRE(batch.nReductions() == 1);
+        REQUIRE(batch.value(maxIdx) == nRanks - 1.0);
+        REQUIRE(batch.value(minIdx) == 0.0);
+        REQUIRE(batch.value(sumIdx) == nRanks);
+    }
+}
@@ -10,7 +10,10 @@
 
 #include "NeoN/NeoN.hpp"
 
+#include <algorithm>
 #include <limits>
+#include <string>
+#include <vector>
 
 TEST_CASE("parallelFor")
 {
@@ -157,6 +160,70 @@ TEST_CASE("parallelReduce")
 
         REQUIRE(max == 1.0);
     }
+
+    SECTION("parallelReduce_Multiple" + execName)
+    {
+        NeoN::Vector<NeoN::scalar> fieldA(exec, {1.0, 5.0, 2.0, -3.0, 4.0});
+        auto viewA = fieldA.view();
+        auto max = std::numeric_limits<NeoN::scalar>::lowest();
+        auto min = std::numeric_limits<NeoN::scalar>::max();
+        NeoN::scalar sum = 0.0;
+        Kokkos::Max<NeoN::scalar> maxReducer(max);
+        Kokkos::Min<NeoN::scalar> minReducer(min);
+        NeoN::parallelReduce(
+            exec,
+            {0, 5},
+            KOKKOS_LAMBDA(
+                const NeoN::localIdx i, NeoN::scalar& lmax, NeoN::scalar& lmin, NeoN::scalar& lsum
+            ) {
+                if (lmax < viewA[i]) lmax = viewA[i];
+                if (lmin > viewA[i]) lmin = viewA[i];
+                lsum += viewA[i];
+            },
+            maxReducer,
+            minReducer,
+            sum
+        );
+
+        REQUIRE(max == 5.0);
+        REQUIRE(min == -3.0);
+        REQUIRE(sum == 9.0);
+    }
+
+    SECTION("parallelReduce_Named" + execName)
+    {
+        NeoN::Vector<NeoN::scalar> fieldA(exec, {1.0, 5.0, 2.0, -3.0, 4.0});
+        auto viewA = fieldA.view();
+        NeoN::scalar sum = 0.0;
+        NeoN::parallelReduce(
+            exec,
+            {0, 5},
+            KOKKOS_LAMBDA(const NeoN::localIdx i, NeoN::scalar& lsum) { lsum += viewA[i]; },
+            sum,
+            "test::sum"
+        );
+        REQUIRE(sum == 9.0);
+
+        auto max = std::numeric_limits<NeoN::scalar>::lowest();
+        Kokkos::Max<NeoN::scalar> maxReducer(max);
+        sum = 0.0;
+        {
+            NeoN::ProfilingRegion region("test::region");
+            NeoN::parallelReduce(
+                exec,
+                {0, 5},
+                KOKKOS_LAMBDA(const NeoN::localIdx i, NeoN::scalar& lmax, NeoN::scalar& lsum) {
+                    if (lmax < viewA[i]) lmax = viewA[i];
+                    lsum += viewA[i];
+                },
+                maxReducer,
+                sum,
+                std::string("test::maxSum")
+            );
+        }
+        REQUIRE(max == 5.0);
+        REQUIRE(sum == 9.0);
+    }
 };
 
 TEST_CASE("parallelScan")
@@ -242,3 +309,131 @@ TEST_CASE("parallelScan")
         REQUIRE(hostIntervals.view()[4] == 5);
     }
 };
+
+TEST_CASE("KernelGraph")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("capture and replay " + execName)
+    {
+        // a device graph needs an executor with its own stream
+        auto graphExec = NeoN::partition(exec, 1)[0];
+        NeoN::Vector<NeoN::scalar> field(graphExec, 5, 0.0);
+        auto fieldView = field.view();
+        NeoN::fence(graphExec);
+
+        NeoN::KernelGraph graph(graphExec);
+        graph.capture(
+            [&]()
+            {
+                // the temporary is retained by the graph for the replays
+                NeoN::Vector<NeoN::scalar> increment(graphExec, 5, 1.0);
+                auto incrementView = increment.view();
+                NeoN::parallelFor(
+                    graphExec,
+                    {0, 5},
+                    KOKKOS_LAMBDA(const NeoN::localIdx i) { fieldView[i] += incrementView[i]; }
+                );
+            }
+        );
+        REQUIRE(graph.captured());
+        graph.replay();
+        graph.replay();
+        NeoN::fence(graphExec);
+
+        auto fieldHost = field.copyToHost();
+        for (auto value : fieldHost.view())
+        {
+            REQUIRE(value == 3.0);
+        }
+
+        graph.reset();
+        REQUIRE(!graph.captured());
+    }
+}
+
+TEST_CASE("parallelPrimitives")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("exclusive and inclusive scan " + execName)
+    {
+        NeoN::Vector<NeoN::localIdx> in(exec, {1, 2, 3, 4, 5});
+        NeoN::Vector<NeoN::localIdx> out(exec, 5, 0);
+
+        REQUIRE(NeoN::exclusiveScan(exec, in.view(), out.view()) == 15);
+        auto outHost = out.copyToHost();
+        std::vector<NeoN::localIdx> exclusive {0, 1, 3, 6, 10};
+        for (NeoN::localIdx i = 0; i < 5; i++)
+        {
+            REQUIRE(outHost.view()[i] == exclusive[static_cast<std::size_t>(i)]);
+        }
+
+        // in place
+        REQUIRE(NeoN::inclusiveScan(exec, in.view(), in.view()) == 15);
+        auto inHost = in.copyToHost();
+        std::vector<NeoN::localIdx> inclusive {1, 3, 6, 10, 15};
+        for (NeoN::localIdx i = 0; i < 5; i++)
+        {
+            REQUIRE(inHost.view()[i] == inclusive[static_cast<std::size_t>(i)]);
+        }
+    }
+
+    SECTION("sort keys and key value pairs " + execName)
+    {
+        NeoN::Vector<NeoN::localIdx> keys(exec, {4, 1, 3, 1, 0, 4, 2});
+        NeoN::parallelSort(exec, keys.view());
+        auto keysHost = keys.copyToHost();
+        REQUIRE(std::is_sorted(keysHost.view().begin(), keysHost.view().end()));
+
+        NeoN::Vector<NeoN::localIdx> pairKeys(exec, {4, 1, 3, 1, 0, 4, 2});
+        NeoN::Vector<NeoN::scalar> values(exec, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+        NeoN::parallelSort(exec, pairKeys.view(), values.view());
+        auto [pairKeysHost, valuesHost] = NeoN::copyToHosts(pairKeys, values);
+        std::vector<NeoN::localIdx> expectedKeys {0, 1, 1, 2, 3, 4, 4};
+        // the sort is stable
+        std::vector<NeoN::scalar> expectedValues {4.0, 1.0, 3.0, 6.0, 2.0, 0.0, 5.0};
+        for (NeoN::localIdx i = 0; i < 7; i++)
+        {
+            REQUIRE(pairKeysHost.view()[i] == expectedKeys[static_cast<std::size_t>(i)]);
+            REQUIRE(valuesHost.view()[i] == expectedValues[static_cast<std::size_t>(i)]);
+        }
+    }
+
+    SECTION("unique and histogram " + execName)
+    {
+        NeoN::Vector<NeoN::localIdx> sorted(exec, {0, 1, 1, 2, 4, 4, 4});
+        NeoN::Vector<NeoN::localIdx> out(exec, 7, 0);
+        REQUIRE(NeoN::unique(exec, sorted.view(), out.view()) == 4);
+        auto outHost = out.copyToHost();
+        std::vector<NeoN::localIdx> expected {0, 1, 2, 4};
+        for (NeoN::localIdx i = 0; i < 4; i++)
+        {
+            REQUIRE(outHost.view()[i] == expected[static_cast<std::size_t>(i)]);
+        }
+
+        NeoN::Vector<NeoN::localIdx> counts(exec, 5, 7);
+        NeoN::histogram(exec, sorted.view(), counts.view());
+        auto countsHost = counts.copyToHost();
+        std::vector<NeoN::localIdx> expectedCounts {1, 2, 1, 0, 3};
+        for (NeoN::localIdx i = 0; i < 5; i++)
+        {
+            REQUIRE(countsHost.view()[i] == expectedCounts[static_cast<std::size_t>(i)]);
+        }
+    }
+
+    SECTION("segmented reduce " + execName)
+    {
+        NeoN::Vector<NeoN::scalar> values(exec, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+        NeoN::Vector<NeoN::localIdx> segments(exec, {0, 2, 2, 6});
+        NeoN::Vector<NeoN::scalar> sums(exec, 3, -1.0);
+        NeoN::SegmentedVectorView<const NeoN::scalar, const NeoN::localIdx> view {
+            values.view(), segments.view()
+        };
+        NeoN::segmentedReduce(exec, view, sums.view());
+        auto sumsHost = sums.copyToHost();
+        REQUIRE(sumsHost.view()[0] == 3.0);
+        REQUIRE(sumsHost.view()[1] == 0.0);
+        REQUIRE(sumsHost.view()[2] == 18.0);
+    }
+}
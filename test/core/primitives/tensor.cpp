@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "NeoN/NeoN.hpp"
+#include "NeoN/core/primitives/tensor.hpp"
+
+TEST_CASE("Tensor")
+{
+    NeoN::Vec3 a(1.0, 2.0, 3.0);
+    NeoN::Vec3 b(4.0, 5.0, 6.0);
+
+    SECTION("Outer product")
+    {
+        auto t = NeoN::outer(a, b);
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            for (std::size_t j = 0; j < 3; j++)
+            {
+                REQUIRE(t(i, j) == a[i] * b[j]);
+            }
+        }
+        // (a b^T) c = a (b & c)
+        NeoN::Vec3 c(1.0, 0.0, -1.0);
+        REQUIRE((t & c) == (b & c) * a);
+    }
+
+    SECTION("Arithmetic")
+    {
+        auto t = NeoN::outer(a, b);
+        REQUIRE((t + t) == 2.0 * t);
+        REQUIRE((t - t) == NeoN::zero<NeoN::Tensor>());
+        t += t;
+        REQUIRE(t(0, 0) == 8.0);
+        REQUIRE((NeoN::one<NeoN::Tensor>() & a) == a);
+    }
+}
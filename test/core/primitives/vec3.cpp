@@ -9,6 +9,7 @@
 #include <catch2/generators/catch_generators_all.hpp>
 
 #include "NeoN/NeoN.hpp"
+#include "test/catch2/executorGenerator.hpp"
 
 TEST_CASE("Primitives")
 {
@@ -51,6 +52,33 @@ TEST_CASE("Primitives")
         }
     }
 
+    SECTION("Products")
+    {
+        NeoN::Vec3 a(1.0, 2.0, 3.0);
+        NeoN::Vec3 b(4.0, 5.0, 6.0);
+
+        REQUIRE((a & b) == 32.0);
+        REQUIRE(NeoN::cross(a, b) == NeoN::Vec3(-3.0, 6.0, -3.0));
+        REQUIRE((NeoN::cross(a, b) & a) == 0.0);
+        REQUIRE(NeoN::cmptMultiply(a, b) == NeoN::Vec3(4.0, 10.0, 18.0));
+        REQUIRE(NeoN::mag(NeoN::Vec3(3.0, 4.0, 0.0)) == 5.0);
+    }
+
+    SECTION("Layout")
+    {
+        REQUIRE(sizeof(NeoN::Vec3) == NeoN::vec3Lanes * sizeof(NeoN::scalar));
+        REQUIRE(alignof(NeoN::Vec3) == NeoN::vec3Alignment);
+
+        // the padding lane stays zero, so the packed dot product equals the compact one
+        NeoN::Vec3 a(1.0, 2.0, 3.0);
+        auto b = 2.0 * (a + a) - a;
+        for (std::size_t i = 3; i < NeoN::vec3Lanes; i++)
+        {
+            REQUIRE(b.data()[i] == 0.0);
+        }
+        REQUIRE((b & b) == 3.0 * 3.0 * 14.0);
+    }
+
     SECTION("Vec3", "[Traits]")
     {
 
@@ -67,3 +95,39 @@ TEST_CASE("Primitives")
         REQUIRE(zero(2) == 0.0);
     }
 }
+
+TEST_CASE("atomicAdd")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("Vec3 " + execName)
+    {
+        NeoN::Vector<NeoN::Vec3> sum(exec, 1, NeoN::zero<NeoN::Vec3>());
+        auto sumV = sum.view();
+        NeoN::parallelFor(
+            exec,
+            {0, 100},
+            KOKKOS_LAMBDA(const NeoN::localIdx) {
+                NeoN::atomicAdd(&sumV[0], NeoN::Vec3(1.0, 2.0, 3.0));
+            }
+        );
+        auto sumHost = sum.copyToHost();
+        REQUIRE(sumHost.view()[0] == NeoN::Vec3(100.0, 200.0, 300.0));
+    }
+
+    SECTION("Tensor " + execName)
+    {
+        NeoN::Vector<NeoN::Tensor> sum(exec, 1, NeoN::zero<NeoN::Tensor>());
+        auto sumV = sum.view();
+        NeoN::parallelFor(
+            exec,
+            {0, 100},
+            KOKKOS_LAMBDA(const NeoN::localIdx) {
+                NeoN::atomicAdd(&sumV[0], NeoN::one<NeoN::Tensor>());
+            }
+        );
+        auto sumHost = sum.copyToHost();
+        REQUIRE(sumHost.view()[0].row(0) == NeoN::Vec3(100.0, 0.0, 0.0));
+        REQUIRE(sumHost.view()[0].row(2) == NeoN::Vec3(0.0, 0.0, 100.0));
+    }
+}
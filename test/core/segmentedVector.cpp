@@ -8,6 +8,8 @@
 
 #include "NeoN/NeoN.hpp"
 
+#include <array>
+
 #include <Kokkos_Core.hpp>
 
 TEST_CASE("segmentedVector")
@@ -150,4 +152,86 @@ TEST_CASE("segmentedVector")
             REQUIRE(hostResult.view()[4] == 4 * 5);
         }
     }
+
+    SECTION("Hierarchical parallelFor and parallelReduce " + execName)
+    {
+        NeoN::Vector<NeoN::localIdx> intervals(exec, {1, 2, 3, 0, 5});
+        NeoN::SegmentedVector<NeoN::label, NeoN::localIdx> segVector(intervals);
+        auto segView = segVector.view();
+
+        NeoN::parallelFor(
+            exec,
+            segView,
+            KOKKOS_LAMBDA(const NeoN::localIdx segI, const NeoN::localIdx j) {
+                segView.values[j] = static_cast<NeoN::label>(segI + j);
+            }
+        );
+
+        auto hostValues = segVector.values().copyToHost();
+        REQUIRE(hostValues.view()[0] == 0);
+        REQUIRE(hostValues.view()[2] == 3);
+        REQUIRE(hostValues.view()[5] == 7);
+        REQUIRE(hostValues.view()[10] == 14);
+
+        NeoN::Vector<NeoN::label> result(exec, 5, -1);
+        auto resultView = result.view();
+        NeoN::parallelReduce<NeoN::label>(
+            exec,
+            segView,
+            KOKKOS_LAMBDA(const NeoN::localIdx, const NeoN::localIdx j, NeoN::label& sum) {
+                sum += segView.values[j];
+            },
+            KOKKOS_LAMBDA(const NeoN::localIdx segI, const NeoN::label sum) {
+                resultView[segI] = sum;
+            }
+        );
+
+        auto hostResult = result.copyToHost();
+        REQUIRE(hostResult.view()[0] == 0);
+        REQUIRE(hostResult.view()[1] == 2 + 3);
+        REQUIRE(hostResult.view()[2] == 5 + 6 + 7);
+        REQUIRE(hostResult.view()[3] == 0);
+        REQUIRE(hostResult.view()[4] == 10 + 11 + 12 + 13 + 14);
+    }
+    SECTION("Build from entries and rebuild in place " + execName)
+    {
+        // entry p belongs to segment (7 * p) % 4, the value is p, segment 4 stays empty
+        const NeoN::localIdx nSegments = 5;
+        auto segmentOf = KOKKOS_LAMBDA(const NeoN::localIdx p) { return (7 * p) % 4; };
+        auto valueOf = KOKKOS_LAMBDA(const NeoN::localIdx p) { return NeoN::label(p); };
+
+        NeoN::SegmentedVectorBuilder<NeoN::label, NeoN::localIdx> builder(exec);
+        NeoN::SegmentedVector<NeoN::label, NeoN::localIdx> segVector(exec, 0, 0);
+        builder.build(segVector, nSegments, 10, segmentOf, valueOf, true);
+
+        REQUIRE(segVector.numSegments() == nSegments);
+        REQUIRE(segVector.size() == 10);
+        auto hostSegVector = segVector.copyToHost();
+        auto [values, segments] = hostSegVector.views();
+        REQUIRE(segments[0] == 0);
+        REQUIRE(segments[4] == 10);
+        REQUIRE(segments[5] == 10);
+        const std::array<NeoN::localIdx, 4> counts {3, 2, 2, 3};
+        for (NeoN::localIdx segI = 0; segI < 4; segI++)
+        {
+            REQUIRE(segments[segI + 1] - segments[segI] == counts[static_cast<std::size_t>(segI)]);
+            for (auto j = segments[segI]; j < segments[segI + 1]; j++)
+            {
+                REQUIRE((7 * values[j]) % 4 == segI);
+                if (j > segments[segI])
+                {
+                    REQUIRE(values[j - 1] < values[j]);
+                }
+            }
+        }
+
+        // fewer entries reuse the memory of the vector
+        const auto* data = segVector.values().data();
+        builder.build(segVector, nSegments, 4, segmentOf, valueOf, true);
+        REQUIRE(segVector.size() == 4);
+        REQUIRE(segVector.values().data() == data);
+        auto rebuilt = segVector.copyToHost();
+        REQUIRE(rebuilt.segments().view()[5] == 4);
+        REQUIRE(rebuilt.values().view()[0] == 0);
+    }
 }
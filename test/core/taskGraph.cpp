@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <vector>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using Ids = std::vector<NeoN::TaskGraph::TaskId>;
+
+TEST_CASE("TaskGraph")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("dependencies " + execName)
+    {
+        NeoN::TaskGraph graph(exec, 2);
+        int a = 0;
+        int b = 0;
+        int c = 0;
+        auto noop = [](const NeoN::Executor&) {};
+        const auto writeA = graph.submit("writeA", {{}, NeoN::resources(a)}, noop);
+        const auto writeB = graph.submit("writeB", {{}, NeoN::resources(b)}, noop);
+        const auto readAB =
+            graph.submit("readAB", {NeoN::resources(a, b), NeoN::resources(c)}, noop);
+        const auto readA = graph.submit("readA", {NeoN::resources(a), {}}, noop);
+        const auto writeA2 = graph.submit("writeA2", {{}, NeoN::resources(a)}, noop);
+
+        REQUIRE(graph.nTasks() == 5);
+        REQUIRE(graph.dependencies(writeA).empty());
+        REQUIRE(graph.dependencies(writeB).empty());
+        REQUIRE(graph.dependencies(readAB) == Ids {writeA, writeB});
+        REQUIRE(graph.dependencies(readA) == Ids {writeA});
+        // a write waits for the previous readers
+        REQUIRE(graph.dependencies(writeA2) == Ids {writeA, readAB, readA});
+        REQUIRE(graph.level(writeA) == 0);
+        REQUIRE(graph.level(writeB) == 0);
+        REQUIRE(graph.level(readAB) == 1);
+        REQUIRE(graph.level(readA) == 1);
+        REQUIRE(graph.level(writeA2) == 2);
+
+        graph.clear();
+        REQUIRE(graph.nTasks() == 0);
+    }
+
+    SECTION("run " + execName)
+    {
+        NeoN::TaskGraph graph(exec, 2);
+        NeoN::Vector<NeoN::scalar> a(graph.instance(0), 100, 0.0);
+        NeoN::Vector<NeoN::scalar> b(graph.instance(1), 100, 0.0);
+        NeoN::Vector<NeoN::scalar> c(graph.instance(0), 100, 0.0);
+
+        auto fillA = [&](const NeoN::Executor&) { NeoN::fill(a, 1.0); };
+        auto fillB = [&](const NeoN::Executor&) { NeoN::fill(b, 2.0); };
+        graph.submit("fillA", {{}, NeoN::resources(a)}, 0, fillA);
+        graph.submit("fillB", {{}, NeoN::resources(b)}, 1, fillB);
+        graph.submit(
+            "sum",
+            {NeoN::resources(a, b), NeoN::resources(c)},
+            [&](const NeoN::Executor&)
+            {
+                c = a;
+                c += b;
+            }
+        );
+        graph.run();
+
+        REQUIRE(graph.nTasks() == 0);
+        auto cHost = c.copyToHost();
+        for (NeoN::localIdx i = 0; i < cHost.size(); i++)
+        {
+            REQUIRE(cHost.view()[i] == 3.0);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <sstream>
+#include <string>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("TimerRegistry")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto& timers = NeoN::TimerRegistry::instance();
+    timers.reset();
+
+    SECTION("nested timers " + execName)
+    {
+        for (int step = 0; step < 3; step++)
+        {
+            NeoN::ScopedTimer stepTimer("timeStep", exec);
+            {
+                NeoN::ScopedTimer solveTimer("solve", exec);
+                NeoN::Vector<NeoN::scalar> a(exec, 10, 1.0);
+            }
+            NeoN::ScopedTimer assembleTimer("assemble");
+        }
+
+        const auto stats = timers.stats();
+        REQUIRE(stats.size() == 3);
+        REQUIRE(stats[0].path == "timeStep");
+        REQUIRE(stats[0].depth == 0);
+        REQUIRE(stats[0].calls == 3);
+        REQUIRE(stats[0].fraction == 1.0);
+        REQUIRE(stats[1].path == "timeStep/solve");
+        REQUIRE(stats[1].depth == 1);
+        REQUIRE(stats[1].calls == 3);
+        REQUIRE(stats[2].path == "timeStep/assemble");
+        for (const auto& timer : stats)
+        {
+            REQUIRE(timer.max <= timer.total);
+        }
+        REQUIRE(stats[1].total <= stats[0].total);
+        REQUIRE(stats[1].fraction <= 1.0);
+
+        std::stringstream report;
+        timers.report(report);
+        REQUIRE(report.str().find("  solve") != std::string::npos);
+    }
+
+    SECTION("counters " + execName)
+    {
+        for (int step = 0; step < 2; step++)
+        {
+            NeoN::ScopedTimer timer("exchange", exec);
+            timers.count("bytes", 8.0);
+            timers.count("messages", 1.0);
+        }
+
+        const auto stats = timers.stats();
+        REQUIRE(stats.size() == 1);
+        REQUIRE(stats[0].counters.size() == 2);
+        REQUIRE(stats[0].counters[0].first == "bytes");
+        REQUIRE(stats[0].counters[0].second == 16.0);
+        REQUIRE(stats[0].counters[1].first == "messages");
+        REQUIRE(stats[0].counters[1].second == 2.0);
+
+        std::stringstream report;
+        timers.report(report);
+        REQUIRE(report.str().find("  [bytes]") != std::string::npos);
+    }
+
+    SECTION("disabled timers " + execName)
+    {
+        timers.setEnabled(false);
+        {
+            NeoN::ScopedTimer timer("disabled", exec);
+        }
+        timers.setEnabled(true);
+        REQUIRE(timers.stats().empty());
+    }
+
+    timers.reset();
+}
@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("TraceRecorder")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto& recorder = NeoN::TraceRecorder::instance();
+    recorder.clear();
+
+    SECTION("timers and kernels " + execName)
+    {
+        recorder.enable(true, "");
+        {
+            NeoN::ScopedTimer timer("Trace::scope", exec);
+            NeoN::Vector<NeoN::scalar> a(exec, 10, 1.0);
+            NeoN::fill(a, 2.0);
+        }
+        recorder.disable();
+
+        const auto events = recorder.events();
+        auto scope = std::find_if(
+            events.begin(), events.end(), [](const auto& e) { return e.name == "Trace::scope"; }
+        );
+        REQUIRE(scope != events.end());
+        REQUIRE(scope->category == "Trace");
+        REQUIRE(scope->duration >= 0.0);
+        if (!std::holds_alternative<NeoN::SerialExecutor>(exec))
+        {
+            auto kernel = std::find_if(
+                events.begin(), events.end(), [](const auto& e) { return e.category == "kernel"; }
+            );
+            REQUIRE(kernel != events.end());
+            REQUIRE(kernel->begin >= scope->begin);
+        }
+
+        std::stringstream trace;
+        recorder.write(trace);
+        REQUIRE(trace.str().rfind("{\"traceEvents\":[", 0) == 0);
+        REQUIRE(trace.str().find("\"name\":\"Trace::scope\"") != std::string::npos);
+    }
+
+    SECTION("disabled recorder " + execName)
+    {
+        {
+            NeoN::ScopedTimer timer("Trace::disabled", exec);
+        }
+        REQUIRE(recorder.events().empty());
+    }
+
+    recorder.clear();
+}
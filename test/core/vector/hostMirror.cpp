@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <utility>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+
+TEST_CASE("HostMirror")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Vector<scalar> a(exec, {1.0, 2.0, 3.0});
+
+    SECTION("syncToHost " + execName)
+    {
+        NeoN::HostMirror<scalar> mirror;
+        REQUIRE(mirror.size() == 0);
+        mirror.syncToHost(a);
+        REQUIRE(mirror.size() == 3);
+        REQUIRE(!mirror.modified());
+        REQUIRE(std::as_const(mirror).view()[2] == 3.0);
+        REQUIRE(mirror.aliased() == NeoN::detail::hostAccessible(exec));
+
+        // the host memory is reused by later transfers
+        const auto* data = mirror.data();
+        NeoN::fill(a, 4.0);
+        mirror.syncToHostAsync(a);
+        REQUIRE(mirror.data() == data);
+        REQUIRE(std::as_const(mirror).view()[0] == 4.0);
+    }
+
+    SECTION("syncToDevice " + execName)
+    {
+        NeoN::HostMirror<scalar> mirror(a);
+        const auto version = a.version();
+
+        // unmodified data is not transferred
+        mirror.syncToDevice(a);
+        REQUIRE(a.version() == version);
+
+        auto hostView = mirror.view();
+        REQUIRE(mirror.modified());
+        hostView[1] = 5.0;
+        mirror.syncToDevice(a);
+        REQUIRE(!mirror.modified());
+        REQUIRE(a.version() != version);
+        REQUIRE(a.copyToHost().view()[1] == 5.0);
+
+        // the data of the mirror is transferred to other vectors
+        NeoN::Vector<scalar> b(exec, 1, 0.0);
+        mirror.syncToDevice(b);
+        REQUIRE(b.size() == 3);
+        auto bHost = b.copyToHost();
+        REQUIRE(bHost.view()[0] == 1.0);
+        REQUIRE(bHost.view()[1] == 5.0);
+        REQUIRE(bHost.view()[2] == 3.0);
+    }
+}
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("Mixed precision storage")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Vector<NeoN::scalar> values(exec, {0.5, 1.25, 3.0});
+
+    SECTION("Float storage round trip " + execName)
+    {
+        auto floatValues = NeoN::withPrecision<float>(values);
+        REQUIRE(floatValues.size() == 3);
+
+        NeoN::Vector<NeoN::scalar> restored(exec, 3);
+        NeoN::convertPrecision(floatValues, restored);
+        auto restoredHost = restored.copyToHost();
+        REQUIRE(restoredHost.view()[0] == 0.5);
+        REQUIRE(restoredHost.view()[1] == 1.25);
+        REQUIRE(restoredHost.view()[2] == 3.0);
+    }
+
+    SECTION("Accumulation in compute precision " + execName)
+    {
+        STATIC_REQUIRE(std::is_same_v<NeoN::computeType_t<NeoN::scalar>, NeoN::scalar>);
+        using Compute = NeoN::computeType_t<float>;
+
+        // with double precision scalars 1 + 1e-8 - 1 is evaluated in double and not lost
+        NeoN::Vector<float> stored(exec, 2, 1.0f);
+        const auto storedView = stored.view();
+        Compute sum = 0.0;
+        NeoN::parallelReduce(
+            exec,
+            {0, stored.size()},
+            KOKKOS_LAMBDA(const NeoN::localIdx i, Compute& lsum) {
+                lsum += (NeoN::load(storedView[i]) + Compute(1e-8)) - Compute(1.0);
+            },
+            sum
+        );
+        if constexpr (sizeof(Compute) > sizeof(float))
+        {
+            REQUIRE(sum == Catch::Approx(2e-8));
+        }
+    }
+}
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::Vec3;
+
+TEST_CASE("Vec3SoAVector")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Vector<Vec3> aos(exec, {Vec3(1.0, 2.0, 3.0), Vec3(4.0, 5.0, 6.0), Vec3(7.0, 8.0, 9.0)});
+
+    SECTION("Conversion from and to the AoS layout " + execName)
+    {
+        NeoN::Vec3SoAVector soa(aos);
+        REQUIRE(soa.size() == 3);
+
+        auto yHost = soa.component(1).copyToHost();
+        REQUIRE(yHost.view()[0] == 2.0);
+        REQUIRE(yHost.view()[1] == 5.0);
+        REQUIRE(yHost.view()[2] == 8.0);
+
+        auto aosHost = soa.toAoS().copyToHost();
+        REQUIRE(aosHost.view()[0] == Vec3(1.0, 2.0, 3.0));
+        REQUIRE(aosHost.view()[2] == Vec3(7.0, 8.0, 9.0));
+    }
+
+    SECTION("View accessors " + execName)
+    {
+        NeoN::Vec3SoAVector soa(exec, 3);
+        auto soaView = soa.view();
+        const auto aosView = aos.view();
+        NeoN::parallelFor(
+            exec,
+            {0, soaView.size()},
+            KOKKOS_LAMBDA(const NeoN::localIdx i) { soaView.set(i, 2.0 * aosView[i]); }
+        );
+
+        const NeoN::Vec3SoAView<const NeoN::scalar> constView = soaView;
+        NeoN::Vector<Vec3> sum(exec, 3);
+        auto sumView = sum.view();
+        NeoN::parallelFor(
+            exec,
+            {0, constView.size()},
+            KOKKOS_LAMBDA(const NeoN::localIdx i) { sumView[i] = constView[i] + aosView[i]; }
+        );
+
+        auto sumHost = sum.copyToHost();
+        REQUIRE(sumHost.view()[1] == Vec3(12.0, 15.0, 18.0));
+    }
+}
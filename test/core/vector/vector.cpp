@@ -150,6 +150,48 @@ TEST_CASE("Vector Operator Overloads")
             REQUIRE(value[2] == 30.0);
         }
     }
+
+    SECTION("Vector Expression" + execName)
+    {
+        NeoN::localIdx size = 10;
+        NeoN::Vector<NeoN::scalar> a(exec, size, 5.0);
+        NeoN::Vector<NeoN::scalar> b(exec, size, 10.0);
+        NeoN::Vector<NeoN::scalar> c(exec, size, 2.0);
+
+        NeoN::Vector<NeoN::scalar> d = a + b * c - 0.5 * a;
+        REQUIRE(d.size() == size);
+        for (auto value : d.copyToHost().view())
+        {
+            REQUIRE(value == 22.5);
+        }
+
+        NeoN::Vector<NeoN::scalar> e(exec, 1);
+        e = (a - b) * (b + c);
+        REQUIRE(e.size() == size);
+        for (auto value : e.copyToHost().view())
+        {
+            REQUIRE(value == -60.0);
+        }
+
+        NeoN::Vector<NeoN::Vec3> u(exec, size, NeoN::Vec3 {1.0, 2.0, 3.0});
+        NeoN::Vector<NeoN::Vec3> v(exec, size, NeoN::Vec3 {1.0, 1.0, 1.0});
+        u = u + v * 2.0;
+        for (auto value : u.copyToHost().view())
+        {
+            REQUIRE(value == NeoN::Vec3 {3.0, 4.0, 5.0});
+        }
+
+        // temporary operands are kept alive by the expression until it is evaluated
+        auto f = a + NeoN::Vector<NeoN::scalar>(exec, size, 1.0) * c;
+        auto g = 2.0 * NeoN::Vector<NeoN::scalar>(exec, size, 3.0) - f;
+        REQUIRE(f.operands().size() == 1);
+        REQUIRE(g.operands().size() == 2);
+        NeoN::Vector<NeoN::scalar> h = g;
+        for (auto value : h.copyToHost().view())
+        {
+            REQUIRE(value == -1.0);
+        }
+    }
 }
 
 TEST_CASE("Vector Container Operations")
@@ -171,6 +213,36 @@ TEST_CASE("Vector Container Operations")
         REQUIRE(b.range().second == size);
     };
 
+    SECTION("capacity" + execName)
+    {
+        NeoN::Vector<NeoN::scalar> a(exec, 10, 2.0);
+        REQUIRE(a.capacity() == 10);
+
+        // shrinking keeps the allocation and growing within it does not reallocate
+        a.resize(1);
+        REQUIRE(a.size() == 1);
+        REQUIRE(a.capacity() == 10);
+        const auto* data = a.data();
+        a.resize(10);
+        REQUIRE(a.data() == data);
+        REQUIRE(a.memoryBytes() == 10 * sizeof(NeoN::scalar));
+
+        a.reserve(20);
+        REQUIRE(a.size() == 10);
+        REQUIRE(a.capacity() == 20);
+        REQUIRE(equal(a, 2.0));
+
+        a.resize(5);
+        a.shrinkToFit();
+        REQUIRE(a.capacity() == 5);
+        REQUIRE(equal(a, 2.0));
+
+        a.resize(0);
+        a.shrinkToFit();
+        REQUIRE(a.capacity() == 0);
+        REQUIRE(a.empty());
+    };
+
     SECTION("view" + execName)
     {
         NeoN::Vector<NeoN::label> a(exec, {1, 2, 3});
@@ -212,6 +284,64 @@ TEST_CASE("Vector Container Operations")
         REQUIRE(&(hostA.data()[0]) != &(hostB.data()[0]));
         REQUIRE(hostA.data()[1] == hostB.data()[1]);
     }
+
+    SECTION("copyToHostAsync " + execName)
+    {
+        NeoN::Vector<NeoN::label> a(exec, {1, 2, 3});
+
+        auto [hostA, token] = a.copyToHostAsync();
+        token.wait();
+        REQUIRE(!token.pending());
+        REQUIRE(hostA.size() == 3);
+        REQUIRE(hostA.view()[2] == 3);
+
+        auto [copyA, copyToken] = hostA.copyToExecutorAsync(exec);
+        copyToken.wait();
+        REQUIRE(NeoN::equal(copyA, a));
+    }
+
+    SECTION("version " + execName)
+    {
+        NeoN::Vector<NeoN::scalar> a(exec, 3, 1.0);
+        NeoN::Vector<NeoN::scalar> b(a);
+        REQUIRE(a.version() != b.version());
+
+        const auto version = a.version();
+        const auto& constA = a;
+        [[maybe_unused]] auto constView = constA.view();
+        REQUIRE(a.version() == version);
+
+        NeoN::fill(a, 2.0);
+        REQUIRE(a.version() != version);
+    }
+
+    SECTION("wrap " + execName)
+    {
+        // stands in for the memory of a coupled application
+        NeoN::Vector<NeoN::scalar> external(exec, 3, 1.0);
+        {
+            auto wrapped = NeoN::Vector<NeoN::scalar>::wrap(exec, external.data(), 3);
+            REQUIRE(!wrapped.ownsData());
+            REQUIRE(wrapped.memoryBytes() == 0);
+            NeoN::fill(wrapped, 4.0);
+            REQUIRE(equal(external, 4.0));
+
+            NeoN::Vector<NeoN::scalar> copy(wrapped);
+            REQUIRE(copy.ownsData());
+            REQUIRE(copy.data() != external.data());
+
+            // the owned vector refers to the external memory after the swap
+            NeoN::Vector<NeoN::scalar> owned(exec, 3, 2.0);
+            owned.swap(wrapped);
+            REQUIRE(!owned.ownsData());
+            REQUIRE(wrapped.ownsData());
+            owned += copy;
+            REQUIRE(equal(external, 8.0));
+            REQUIRE(equal(wrapped, 2.0));
+        }
+        // the external memory is not freed with the wrapping vectors
+        REQUIRE(equal(external, 8.0));
+    }
 }
 
 TEST_CASE("Vector Operations")
@@ -255,6 +385,54 @@ TEST_CASE("Vector Operations")
     }
 }
 
+TEST_CASE("Vector Fused Operations")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    NeoN::localIdx size = 10;
+
+    SECTION("scalar " + execName)
+    {
+        NeoN::Vector<NeoN::scalar> x(exec, size, 1.0);
+        NeoN::Vector<NeoN::scalar> y(exec, size, 2.0);
+        NeoN::Vector<NeoN::scalar> z(exec, size, 3.0);
+        NeoN::Vector<NeoN::scalar> w(exec, size, 0.0);
+
+        NeoN::axpby(2.0, x, 0.5, y);
+        REQUIRE(equal(y, 3.0));
+
+        NeoN::waxpby(w, 1.0, x, -1.0, y);
+        REQUIRE(equal(w, -2.0));
+
+        NeoN::axpbypcz(1.0, x, 2.0, y, -1.0, z);
+        REQUIRE(equal(z, 4.0));
+
+        REQUIRE(NeoN::dot(x, z) == Catch::Approx(4.0 * size));
+        REQUIRE(NeoN::norm2(w) == Catch::Approx(std::sqrt(4.0 * size)));
+
+        // with z being y the product is the squared norm of the updated y
+        REQUIRE(NeoN::axpbyDot(1.0, x, 1.0, y, y) == Catch::Approx(16.0 * size));
+        REQUIRE(equal(y, 4.0));
+        REQUIRE(NeoN::axpbyDot(-1.0, x, 1.0, y, x) == Catch::Approx(3.0 * size));
+        REQUIRE(equal(y, 3.0));
+    }
+
+    SECTION("Vec3 " + execName)
+    {
+        NeoN::Vector<NeoN::Vec3> x(exec, size, NeoN::Vec3(1.0, 0.0, 2.0));
+        NeoN::Vector<NeoN::Vec3> y(exec, size, NeoN::Vec3(0.0, 1.0, 0.0));
+        NeoN::Vector<NeoN::Vec3> z(exec, size, NeoN::Vec3(1.0, 1.0, 1.0));
+
+        NeoN::axpby(1.0, x, 2.0, y);
+        REQUIRE(equal(y, NeoN::Vec3(1.0, 2.0, 2.0)));
+
+        NeoN::axpbypcz(1.0, x, -1.0, y, 1.0, z);
+        REQUIRE(equal(z, NeoN::Vec3(1.0, -1.0, 1.0)));
+
+        REQUIRE(NeoN::dot(x, y) == Catch::Approx(5.0 * size));
+        REQUIRE(NeoN::norm2(y) == Catch::Approx(std::sqrt(9.0 * size)));
+    }
+}
+
 TEST_CASE("getViews")
 {
     auto [execName, exec] = GENERATE(allAvailableExecutor());
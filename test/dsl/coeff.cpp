@@ -47,6 +47,14 @@ TEST_CASE("Coeff")
         REQUIRE(hostResF.data()[0] == 12.0);
         REQUIRE(hostResF.data()[1] == 12.0);
         REQUIRE(hostResF.data()[2] == 12.0);
+
+        // equal coefficients have the same value and refer to the same values
+        Vector fB(exec, 3, 2.0);
+        REQUIRE(Coeff {3.0, fA} == d);
+        REQUIRE(!(Coeff {3.0, fB} == d));
+        REQUIRE(!(Coeff {3.0} == d));
+        REQUIRE(!(e == d));
+        REQUIRE(Coeff {2.0} == b);
     }
 
     SECTION("evaluation in parallelFor" + execName)
@@ -100,5 +108,18 @@ TEST_CASE("Coeff")
             REQUIRE(hostVectorA.view()[1] == -3.0);
             REQUIRE(hostVectorA.view()[2] == -3.0);
         }
+
+        SECTION("static coefficient types")
+        {
+            auto isUniform = [](const auto coeff)
+            { return std::is_same_v<std::decay_t<decltype(coeff)>, dsl::UniformCoeff>; };
+
+            Coeff uniform {2.0};
+            Coeff field {-5.0, fieldB};
+            REQUIRE(uniform.visit(isUniform));
+            REQUIRE(!field.visit(isUniform));
+            REQUIRE(uniform.visit([](const auto coeff) { return coeff[1]; }) == 2.0);
+            REQUIRE(field.visit([](const auto coeff) { return coeff.coeff; }) == -5.0);
+        }
     }
 }
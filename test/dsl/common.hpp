@@ -172,7 +172,7 @@ public:
     la::LinearSystem<ValueType, NeoN::localIdx> createEmptyLinearSystem() const
     {
         NeoN::Vector<ValueType> values(this->exec(), 1, NeoN::zero<ValueType>());
-        NeoN::Vector<NeoN::localIdx> colIdx(this->exec(), 1, 0.0);
+        NeoN::Vector<NeoN::columnIdx> colIdx(this->exec(), 1, 0);
         NeoN::Vector<NeoN::localIdx> rowOffs(this->exec(), {0, 1});
         NeoN::la::CSRMatrix<ValueType, NeoN::localIdx> csrMatrix(values, colIdx, rowOffs);
 
@@ -11,6 +11,23 @@
 
 namespace dsl = NeoN::dsl;
 
+/* A dummy operator counting how often it is read */
+template<typename ValueType>
+class ReadCounter : public Dummy<ValueType>
+{
+
+public:
+
+    ReadCounter(fvcc::VolumeField<ValueType>& field, std::shared_ptr<int> nReads)
+        : Dummy<ValueType>(field), nReads_(nReads)
+    {}
+
+    void read(const NeoN::Input&) { (*nReads_)++; }
+
+private:
+
+    std::shared_ptr<int> nReads_;
+};
 
 // TEST_CASE("Expression")
 TEMPLATE_TEST_CASE("Expression", "[template]", NeoN::scalar, NeoN::Vec3)
@@ -89,33 +106,60 @@ TEMPLATE_TEST_CASE("Expression", "[template]", NeoN::scalar, NeoN::Vec3)
         REQUIRE(getRhs(ls) == 4 * NeoN::one<TestType>());
 
         // 4*2 + 2*2 = 12
-        ls.reset();
+        ls.resetValues();
         eqnB.implicitOperation(ls);
         REQUIRE(getDiag(ls) == 12 * NeoN::one<TestType>());
         REQUIRE(getRhs(ls) == 12 * NeoN::one<TestType>());
 
         // 2*2 - 2 = 2
-        ls.reset();
+        ls.resetValues();
         eqnC.implicitOperation(ls);
         REQUIRE(getDiag(ls) == 2 * NeoN::one<TestType>());
         REQUIRE(getRhs(ls) == 2 * NeoN::one<TestType>());
 
         // 3*(2*2 - 2) = 6
-        ls.reset();
+        ls.resetValues();
         eqnD.implicitOperation(ls);
         REQUIRE(getDiag(ls) == 6 * NeoN::one<TestType>());
         REQUIRE(getRhs(ls) == 6 * NeoN::one<TestType>());
 
         // 2*2 - 2 + 2*2 - 2 = 4
-        ls.reset();
+        ls.resetValues();
         eqnE.implicitOperation(ls);
         REQUIRE(getDiag(ls) == 4 * NeoN::one<TestType>());
         REQUIRE(getRhs(ls) == 4 * NeoN::one<TestType>());
 
         // // 2*2 - 2 - 2*2 + 2 = 0
-        ls.reset();
+        ls.resetValues();
         eqnF.implicitOperation(ls);
         REQUIRE(getDiag(ls) == 0 * NeoN::one<TestType>());
         REQUIRE(getRhs(ls) == 0 * NeoN::one<TestType>());
     }
+
+    SECTION("Read operators only once per dictionary version on " + execName)
+    {
+        auto nReads = std::make_shared<int>(0);
+        dsl::SpatialOperator<TestType> a = ReadCounter<TestType>(vf, nReads);
+        dsl::SpatialOperator<TestType> b = ReadCounter<TestType>(vf, nReads);
+        auto eqn = a + b;
+
+        NeoN::Dictionary fvSchemes {{"divSchemes", NeoN::Dictionary()}};
+        eqn.read(fvSchemes);
+        REQUIRE(*nReads == 2);
+
+        // neither the same nor a copied dictionary is parsed again
+        eqn.read(fvSchemes);
+        const auto copy = fvSchemes;
+        eqn.read(copy);
+        REQUIRE(*nReads == 2);
+
+        fvSchemes.insert("laplacianSchemes", NeoN::Dictionary());
+        eqn.read(fvSchemes);
+        REQUIRE(*nReads == 4);
+
+        // added operators require a new read
+        auto eqnC = eqn + dsl::SpatialOperator<TestType>(ReadCounter<TestType>(vf, nReads));
+        eqnC.read(fvSchemes);
+        REQUIRE(*nReads == 7);
+    }
 }
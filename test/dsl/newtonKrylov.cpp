@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "catch2_common.hpp"
+
+#include "common.hpp"
+
+#if NF_WITH_GINKGO
+TEST_CASE("NewtonKrylov")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary newtonDict {
+        {{"tolerance", 1e-10},
+         {"maxIter", 20},
+         {"preconditioner",
+          NeoN::Dictionary {
+              {{"solver", std::string {"Ginkgo"}},
+               {"type", "solver::Cg"},
+               {"criteria",
+                NeoN::Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-12}}}}}
+          }}}
+    };
+
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+    fvcc::VolumeField<NeoN::scalar>& sp =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "sp", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+    fvcc::VolumeField<NeoN::scalar>& coeff =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "coeff", .mesh = mesh, .value = -4.0, .timeIndex = 1}
+        );
+    fvcc::VolumeField<NeoN::scalar>& ones =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "ones", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+
+    SECTION("Solve a nonlinear source on " + execName)
+    {
+        // u u - 4 = 0, the coefficient of the implicit source depends on the solution, thus a
+        // Picard iteration oscillates between 1 and 4 while Newton converges to 2
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::source(sp, vf));
+        eqn.addOperator(NeoN::dsl::exp::source(coeff, ones));
+        auto update = [&](fvcc::VolumeField<NeoN::scalar>& solution)
+        { sp.internalVector() = solution.internalVector(); };
+
+        auto stats = NeoN::dsl::solveNewtonKrylov<fvcc::VolumeField<NeoN::scalar>>(
+            eqn, vf, 0.0, 1.0, fvSchemes, newtonDict, update
+        );
+        REQUIRE(getVector(vf.internalVector()) == Catch::Approx(2.0).margin(1e-8));
+        REQUIRE(getVector(sp.internalVector()) == Catch::Approx(2.0).margin(1e-8));
+        REQUIRE(stats.numNonlinearIter > 0);
+        REQUIRE(stats.numNonlinearIter <= 10);
+        REQUIRE(stats.numResidualEvals >= stats.numNonlinearIter);
+        REQUIRE(stats.finalResNorm < 1e-8);
+    }
+}
+#endif
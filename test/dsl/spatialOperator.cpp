@@ -5,6 +5,8 @@
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
 
+#include <utility>
+
 #include "catch2_common.hpp"
 
 #include "common.hpp"
@@ -33,6 +35,21 @@ TEMPLATE_TEST_CASE("SpatialOperator", "[template]", NeoN::scalar, NeoN::Vec3)
         REQUIRE(b.getType() == Operator::Type::Explicit);
     }
 
+    SECTION("Copies share the operator until modified on " + execName)
+    {
+        auto vf = fvcc::VolumeField<TestType>(exec, "vf", mesh, fA, bf, bcs);
+        const dsl::SpatialOperator<TestType> b = Dummy<TestType>(vf);
+        dsl::SpatialOperator<TestType> c = b;
+
+        const auto* shared = b.template as<Dummy<TestType>>();
+        REQUIRE(std::as_const(c).template as<Dummy<TestType>>() == shared);
+
+        c.getCoefficient() *= 2.0;
+        REQUIRE(std::as_const(c).template as<Dummy<TestType>>() != shared);
+        REQUIRE(std::as_const(c).getCoefficient()[0] == 2.0);
+        REQUIRE(b.getCoefficient()[0] == 1.0);
+    }
+
     SECTION("Supports Coefficients Explicit " + execName)
     {
         auto vf = fvcc::VolumeField<TestType>(exec, "vf", mesh, fA, bf, bcs);
@@ -100,14 +117,14 @@ TEMPLATE_TEST_CASE("SpatialOperator", "[template]", NeoN::scalar, NeoN::Vec3)
         REQUIRE(hostLsC.matrix().values().view()[0] == 4.0 * NeoN::one<TestType>());
 
         // d= 2 * 2
-        ls.reset();
+        ls.resetValues();
         d.implicitOperation(ls);
         auto [hostRhsD, hostLsD] = copyToHosts(ls.rhs(), ls);
         REQUIRE(hostRhsD.view()[0] == 4.0 * NeoN::one<TestType>());
         REQUIRE(hostLsD.matrix().values().view()[0] == 4.0 * NeoN::one<TestType>());
 
         // e = - -3 * 2 * 2 = -12
-        ls.reset();
+        ls.resetValues();
         e.implicitOperation(ls);
         auto [hostRhsE, hostLsE] = copyToHosts(ls.rhs(), ls);
         REQUIRE(hostRhsE.view()[0] == -12.0 * NeoN::one<TestType>());
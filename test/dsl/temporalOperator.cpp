@@ -119,7 +119,7 @@ TEMPLATE_TEST_CASE("TemporalOperator", "[template]", NeoN::scalar, NeoN::Vec3)
 
 
         // // d= 2 * 2
-        ls.reset();
+        ls.resetValues();
         d.implicitOperation(ls, t, dt);
         auto hostRhsD = ls.rhs().copyToHost();
         REQUIRE(hostRhsD.view()[0] == 4.0 * NeoN::one<TestType>());
@@ -128,7 +128,7 @@ TEMPLATE_TEST_CASE("TemporalOperator", "[template]", NeoN::scalar, NeoN::Vec3)
 
 
         // e = - -3 * 2 * 2 = -12
-        ls.reset();
+        ls.resetValues();
         e.implicitOperation(ls, t, dt);
         auto hostRhsE = ls.rhs().copyToHost();
         REQUIRE(hostRhsE.view()[0] == -12.0 * NeoN::one<TestType>());
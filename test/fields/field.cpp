@@ -38,4 +38,18 @@ TEST_CASE("Boundaries")
         NeoN::fill(bCs.valueFraction(), 2.0);
         REQUIRE(equal(bCs.valueFraction(), 2.0));
     }
+
+    SECTION("lazy boundaryVectors_" + execName)
+    {
+        // the reference components are zero initialized on their first access
+        NeoN::BoundaryData<double> bCs(exec, {0, 10, 20, 30});
+        const auto& constBCs = bCs;
+        REQUIRE(constBCs.refValue().size() == 30);
+        REQUIRE(equal(bCs.refValue(), 0.0));
+        REQUIRE(equal(bCs.refGrad(), 0.0));
+        REQUIRE(equal(bCs.valueFraction(), 0.0));
+
+        const NeoN::BoundaryData<double> copy(bCs);
+        REQUIRE(copy.refGrad().size() == 30);
+    }
 }
@@ -37,4 +37,49 @@ TEST_CASE("Courant Number")
 
         REQUIRE(coNum == 0.04);
     }
+
+    SECTION("can determine local time steps of flux field on 1D uniform mesh: " + execName)
+    {
+        NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, 4);
+        std::vector<fvcc::SurfaceBoundary<NeoN::scalar>> bcs {};
+        for (auto patchi : I<NeoN::localIdx> {0, 1})
+        {
+            NeoN::Dictionary dict;
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", 1.0);
+            bcs.push_back(fvcc::SurfaceBoundary<NeoN::scalar>(mesh, dict, patchi));
+        }
+
+        fvcc::SurfaceField<NeoN::scalar> sf(exec, "sf", mesh, bcs);
+        NeoN::fill(sf.internalVector(), 1.0);
+        sf.correctBoundaryConditions();
+        fvcc::SurfaceField<NeoN::scalar> gamma(exec, "gamma", mesh, bcs);
+        NeoN::fill(gamma.internalVector(), 0.0);
+
+        // Co = 0.5 * 2 / 0.25 * dt = 4 dt, hence a courant number of 0.5 gives dt = 0.125
+        NeoN::Vector<NeoN::scalar> localDt(exec, mesh.nCells());
+        fvcc::computeLocalTimeStep(sf, {0.5, 0.5, 1.0}, localDt);
+        auto hostDt = localDt.copyToHost();
+        for (auto dt : hostDt.view())
+        {
+            REQUIRE(dt == Catch::Approx(0.125));
+        }
+
+        // without diffusion both variants agree
+        fvcc::computeLocalTimeStep(sf, gamma, {0.5, 0.5, 1.0}, localDt);
+        hostDt = localDt.copyToHost();
+        for (auto dt : hostDt.view())
+        {
+            REQUIRE(dt == Catch::Approx(0.125));
+        }
+
+        // cells without convection are bounded by the maximum time step
+        NeoN::fill(sf.internalVector(), 0.0);
+        fvcc::computeLocalTimeStep(sf, {0.5, 0.5, 1.0}, localDt);
+        hostDt = localDt.copyToHost();
+        for (auto dt : hostDt.view())
+        {
+            REQUIRE(dt == 1.0);
+        }
+    }
 }
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include <sstream>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::localIdx;
+using NeoN::scalar;
+
+struct CreateVector
+{
+    std::string name;
+    const NeoN::UnstructuredMesh& mesh;
+    std::int64_t timeIndex = 0;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        std::vector<fvcc::VolumeBoundary<scalar>> bcs {};
+        NeoN::Field<scalar> domainVector(
+            mesh.exec(),
+            NeoN::Vector<scalar>(mesh.exec(), mesh.nCells(), 1.0),
+            mesh.boundaryMesh().offset()
+        );
+        fvcc::VolumeField<scalar> vf(mesh.exec(), name, mesh, domainVector, bcs, db, "", "");
+        return NeoN::Document(
+            {{"name", vf.name},
+             {"timeIndex", timeIndex},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", vf}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+std::size_t entryBytes(
+    const NeoN::MemoryReport& report, const std::string& category, const std::string& name
+)
+{
+    for (const auto& entry : report.entries())
+    {
+        if (entry.category == category && entry.name == name)
+        {
+            return entry.bytes;
+        }
+    }
+    return 0;
+}
+
+TEST_CASE("MemoryReport")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 4, 4, 4);
+    const auto nCells = static_cast<std::size_t>(mesh.nCells());
+
+    SECTION("Accumulate and print " + execName)
+    {
+        NeoN::MemoryReport report(mesh.nCells());
+        report.add("a", "x", 10);
+        report.add("b", "y", 20);
+        report.add("a", "x", 5);
+        REQUIRE(report.entries().size() == 2);
+        REQUIRE(report.categories() == std::vector<std::string> {"a", "b"});
+        REQUIRE(report.bytes("a") == 15);
+        REQUIRE(report.bytes() == 35);
+
+        std::ostringstream os;
+        report.print(os, true);
+        REQUIRE(os.str().find("total") != std::string::npos);
+        REQUIRE(os.str().find("  x") != std::string::npos);
+    }
+
+    SECTION("Report mesh, stencils and fields " + execName)
+    {
+        NeoN::Database db;
+        auto& fieldCollection = fvcc::VectorCollection::instance(db, "fieldCollection");
+        auto& vf = fieldCollection.registerVector<fvcc::VolumeField<scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+        fvcc::oldTime(vf);
+        const auto& sparsity = NeoN::la::SparsityPattern::readOrCreate(mesh);
+
+        auto report = fvcc::memoryReport(mesh, db);
+        REQUIRE(report.nCells() == mesh.nCells());
+        REQUIRE(entryBytes(report, "mesh geometry", "cell centres") == nCells * sizeof(NeoN::Vec3));
+        REQUIRE(
+            entryBytes(report, "mesh connectivity", "face owner")
+            == static_cast<std::size_t>(mesh.nFaces()) * sizeof(NeoN::label)
+        );
+        REQUIRE(entryBytes(report, "stencils", "SparsityPattern") == sparsity.memoryBytes());
+        REQUIRE(sparsity.memoryBytes() > 0);
+
+        // the old time level is a copy of the field
+        REQUIRE(entryBytes(report, "fields", "vf") == vf.memoryBytes());
+        REQUIRE(entryBytes(report, "old-time fields", "vf_0") == vf.memoryBytes());
+        REQUIRE(vf.memoryBytes() >= nCells * sizeof(scalar));
+
+        REQUIRE(
+            report.bytes()
+            == report.bytes("mesh geometry") + report.bytes("mesh connectivity")
+                   + report.bytes("stencils") + report.bytes("fields")
+                   + report.bytes("old-time fields")
+        );
+    }
+}
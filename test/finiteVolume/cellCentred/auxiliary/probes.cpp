@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("Probes")
+{
+    namespace fvcc = NeoN::finiteVolume::cellCentred;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, 10);
+    const std::vector<NeoN::Vec3> points {{0.25, 0.0, 0.0}, {0.95, 0.0, 0.0}, {0.27, 0.0, 0.0}};
+
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, {});
+    fvcc::VolumeField<NeoN::scalar> psi(exec, "psi", mesh, {});
+    auto [phiV, psiV] = NeoN::views(phi.internalVector(), psi.internalVector());
+
+    SECTION("locates the points on: " + execName)
+    {
+        fvcc::ProbeLocations locations(mesh, points);
+        REQUIRE(locations.cells() == std::vector<NeoN::localIdx> {2, 9, 2});
+
+        const auto offsets = locations.offsets().copyToHost();
+        const auto weights = locations.weights().copyToHost();
+        REQUIRE(offsets.view()[1] - offsets.view()[0] == 1);
+        NeoN::scalar sum = 0;
+        for (auto i = offsets.view()[2]; i < offsets.view()[3]; i++)
+        {
+            sum += weights.view()[i];
+        }
+        REQUIRE(sum == Catch::Approx(1.0));
+    }
+
+    SECTION("buffers and writes the samples on: " + execName)
+    {
+        std::vector<std::vector<NeoN::scalar>> written;
+        std::vector<NeoN::scalar> times;
+        {
+            fvcc::Probes<NeoN::scalar> probes(
+                mesh,
+                points,
+                2,
+                2,
+                [&](const fvcc::ProbeSamples<NeoN::scalar>& samples)
+                {
+                    for (std::size_t step = 0; step < samples.times.size(); step++)
+                    {
+                        const auto stepi = static_cast<NeoN::localIdx>(step);
+                        times.push_back(samples.times[step]);
+                        written.push_back({samples(stepi, 0, 0), samples(stepi, 1, 1)});
+                    }
+                }
+            );
+            for (int step = 0; step < 3; step++)
+            {
+                const NeoN::scalar value = step;
+                NeoN::parallelFor(
+                    exec,
+                    {0, mesh.nCells()},
+                    KOKKOS_LAMBDA(const NeoN::localIdx celli) {
+                        phiV[celli] = NeoN::scalar(celli) + value;
+                        psiV[celli] = -value;
+                    }
+                );
+                probes.sample({&phi, &psi}, 0.1 * value);
+            }
+            // the first buffer is written by the next flush, hence the samples are buffered
+            REQUIRE(written.empty());
+        }
+        REQUIRE(times.size() == 3);
+        for (std::size_t step = 0; step < 3; step++)
+        {
+            REQUIRE(times[step] == Catch::Approx(0.1 * static_cast<NeoN::scalar>(step)));
+            REQUIRE(written[step][0] == Catch::Approx(2.0 + static_cast<NeoN::scalar>(step)));
+            REQUIRE(written[step][1] == Catch::Approx(-static_cast<NeoN::scalar>(step)));
+        }
+    }
+}
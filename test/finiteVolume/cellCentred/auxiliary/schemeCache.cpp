@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using Operator = NeoN::dsl::Operator;
+
+namespace NeoN
+{
+
+TEST_CASE("SchemeCache")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = create1DUniformMesh(exec, 10);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+    fvcc::SurfaceField<scalar> faceFlux(exec, "phi", mesh, surfaceBCs);
+    fill(faceFlux.internalVector(), 1.0);
+
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+    fvcc::VolumeField<scalar> phi(exec, "T", mesh, volumeBCs);
+    fill(phi.internalVector(), 1.0);
+    fill(phi.boundaryData().value(), 1.0);
+
+    SECTION("Key of the remaining tokens " + execName)
+    {
+        TokenList tokens({std::string("Gauss"), std::string("linear"), 2});
+        auto key = fvcc::schemeCacheKey(tokens);
+        REQUIRE(key);
+        tokens.next<std::string>();
+        REQUIRE(fvcc::schemeCacheKey(tokens) != key);
+        // a token of another type cannot be part of a key
+        TokenList unknown;
+        unknown.insert(std::vector<int> {1});
+        REQUIRE_FALSE(fvcc::schemeCacheKey(unknown));
+    }
+
+    SECTION("Rebuilt operators reuse the schemes " + execName)
+    {
+        using DivFactory = fvcc::DivOperatorFactory<scalar>;
+        using InterpolationFactory = fvcc::SurfaceInterpolationFactory<scalar>;
+        const auto& divCache = fvcc::schemeCache<DivFactory>(mesh);
+        const auto& interpolationCache = fvcc::schemeCache<InterpolationFactory>(mesh);
+        const auto nDiv = divCache.size();
+        const auto nInterpolation = interpolationCache.size();
+
+        // schemes read from a dictionary are not cached
+        Input dict = Dictionary(
+            {{std::string("DivOperator"), std::string("Gauss")},
+             {std::string("surfaceInterpolation"), std::string("linear")}}
+        );
+        auto expected = Vector<scalar>(exec, phi.size(), 0.0);
+        fvcc::DivOperator<scalar>(Operator::Type::Explicit, faceFlux, phi, dict).div(expected);
+        REQUIRE(divCache.size() == nDiv);
+        auto expectedHost = expected.copyToHost();
+
+        for (int step = 0; step < 3; step++)
+        {
+            Input tokens = TokenList({std::string("Gauss"), std::string("linear")});
+            auto scheme = DivFactory::create(exec, mesh, tokens);
+            // a cached scheme consumes the tokens like a constructed one
+            REQUIRE(std::get<TokenList>(tokens).nextIndex() == 2);
+
+            auto result = Vector<scalar>(exec, phi.size(), 0.0);
+            fvcc::DivOperator<scalar>(Operator::Type::Explicit, faceFlux, phi, std::move(scheme))
+                .div(result);
+            auto resultHost = result.copyToHost();
+            for (localIdx celli = 0; celli < phi.size(); celli++)
+            {
+                REQUIRE(resultHost.view()[celli] == Catch::Approx(expectedHost.view()[celli]));
+            }
+        }
+        REQUIRE(divCache.size() == nDiv + 1);
+        REQUIRE(interpolationCache.size() == nInterpolation + 1);
+
+        Input upwind = TokenList({std::string("Gauss"), std::string("upwind")});
+        fvcc::DivOperator<scalar>(Operator::Type::Explicit, faceFlux, phi, upwind);
+        REQUIRE(divCache.size() == nDiv + 2);
+        REQUIRE(interpolationCache.size() == nInterpolation + 2);
+    }
+}
+
+}
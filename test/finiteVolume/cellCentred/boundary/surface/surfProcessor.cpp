@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::label;
+using NeoN::localIdx;
+using NeoN::scalar;
+
+TEST_CASE("processor faces")
+{
+    NeoN::mpi::MPIEnvironment mpiEnviron;
+    NeoN::SerialExecutor exec {};
+
+    auto mesh = NeoN::create1DUniformMesh(exec, 10);
+    const auto cellToPart =
+        NeoN::partitionCells(mesh, static_cast<localIdx>(mpiEnviron.sizeRank()));
+    const auto part = static_cast<label>(mpiEnviron.rank());
+    auto decomposed = NeoN::decomposeMesh(mesh, cellToPart, part);
+    const auto& local = decomposed.mesh;
+    auto comm = NeoN::createFaceCommunicator(mpiEnviron, decomposed);
+
+    std::vector<fvcc::SurfaceBoundary<scalar>> bcs;
+    for (localIdx patchi = 0; patchi + 1 < local.nBoundaries(); patchi++)
+    {
+        bcs.emplace_back(local, NeoN::Dictionary({{"type", std::string("calculated")}}), patchi);
+    }
+    const auto procPatch = local.nBoundaries() - 1;
+    bcs.emplace_back(local, NeoN::Dictionary({{"type", std::string("processor")}}), procPatch);
+
+    // only the part of lower index knows the processor face values, the original face indices
+    fvcc::SurfaceField<scalar> phi(exec, "phi", local, bcs);
+    const auto faceMap = decomposed.faceMap.view();
+    const auto nInternalFaces = local.nInternalFaces();
+    const auto [start, end] = phi.boundaryData().range(procPatch);
+    REQUIRE(end > start);
+    auto value = phi.boundaryData().value().view();
+    auto internal = phi.internalVector().view();
+    for (auto bfacei = start; bfacei < end; bfacei++)
+    {
+        const auto original = static_cast<scalar>(faceMap[nInternalFaces + bfacei]);
+        value[bfacei] = part == 0 ? original : -1.0;
+        internal[nInternalFaces + bfacei] = value[bfacei];
+    }
+
+    const bool oriented = GENERATE(false, true);
+    fvcc::startComm(comm, phi, "phi");
+    fvcc::finaliseComm(comm, phi, "phi", oriented);
+
+    for (auto bfacei = start; bfacei < end; bfacei++)
+    {
+        const auto original = static_cast<scalar>(faceMap[nInternalFaces + bfacei]);
+        const auto expected = part != 0 && oriented ? -original : original;
+        REQUIRE(value[bfacei] == expected);
+        REQUIRE(internal[nInternalFaces + bfacei] == expected);
+    }
+}
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("batchedVolumeBoundary")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("Batched and per patch correction agree " + execName)
+    {
+        // the six patches of the cube are corrected by different conditions
+        auto mesh = NeoN::create3DUniformMesh(exec, 2, 3, 4);
+        const std::vector<NeoN::Dictionary> dicts {
+            NeoN::Dictionary({{"type", std::string("fixedValue")}, {"fixedValue", 1.0}}),
+            NeoN::Dictionary({{"type", std::string("fixedGradient")}, {"fixedGradient", 2.0}}),
+            NeoN::Dictionary({{"type", std::string("extrapolated")}}),
+            NeoN::Dictionary({{"type", std::string("calculated")}}),
+            NeoN::Dictionary({{"type", std::string("fixedValue")}, {"fixedValue", -3.0}}),
+            NeoN::Dictionary({{"type", std::string("fixedGradient")}, {"fixedGradient", 4.0}})
+        };
+        std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs;
+        for (NeoN::localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            bcs.emplace_back(mesh, dicts[static_cast<std::size_t>(patchi)], patchi);
+        }
+
+        fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, bcs);
+        NeoN::parallelFor(
+            phi.internalVector(), KOKKOS_LAMBDA(const NeoN::localIdx i) { return NeoN::scalar(i); }
+        );
+        NeoN::fill(phi.boundaryData().value(), -1.0);
+        NeoN::fill(phi.boundaryData().refValue(), -1.0);
+        NeoN::fill(phi.boundaryData().refGrad(), -1.0);
+        NeoN::fill(phi.boundaryData().valueFraction(), -1.0);
+
+        NeoN::Field<NeoN::scalar> expected(exec, phi.internalVector(), phi.boundaryData());
+        for (auto& bc : bcs)
+        {
+            bc.correctBoundaryCondition(expected);
+        }
+        phi.correctBoundaryConditions();
+
+        auto [value, expectedValue, refValue, expectedRefValue] = NeoN::copyToHosts(
+            phi.boundaryData().value(),
+            expected.boundaryData().value(),
+            phi.boundaryData().refValue(),
+            expected.boundaryData().refValue()
+        );
+        for (NeoN::localIdx facei = 0; facei < mesh.nBoundaryFaces(); facei++)
+        {
+            REQUIRE(value.view()[facei] == expectedValue.view()[facei]);
+            REQUIRE(refValue.view()[facei] == expectedRefValue.view()[facei]);
+        }
+    }
+
+    SECTION("Copies share the stateless conditions " + execName)
+    {
+        auto mesh = NeoN::create3DUniformMesh(exec, 2, 3, 4);
+        auto calculated = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+        auto pooled = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+        REQUIRE(pooled.size() == calculated.size());
+        REQUIRE(pooled.size() == static_cast<std::size_t>(mesh.nBoundaries()));
+
+        // the fields correct their own data with the shared conditions
+        auto bcs = fvcc::createExtrapolatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+        fvcc::VolumeField<NeoN::scalar> phiA(exec, "phiA", mesh, bcs);
+        fvcc::VolumeField<NeoN::scalar> phiB(exec, "phiB", mesh, bcs);
+        NeoN::parallelFor(
+            phiA.internalVector(), KOKKOS_LAMBDA(const NeoN::localIdx i) { return NeoN::scalar(i); }
+        );
+        NeoN::parallelFor(
+            phiB.internalVector(),
+            KOKKOS_LAMBDA(const NeoN::localIdx i) { return NeoN::scalar(2 * i); }
+        );
+        phiA.correctBoundaryConditions();
+        phiB.correctBoundaryConditions();
+
+        auto [valueA, valueB] =
+            NeoN::copyToHosts(phiA.boundaryData().value(), phiB.boundaryData().value());
+        for (NeoN::localIdx facei = 0; facei < mesh.nBoundaryFaces(); facei++)
+        {
+            REQUIRE(valueB.view()[facei] == Catch::Approx(2 * valueA.view()[facei]));
+        }
+    }
+}
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::label;
+using NeoN::localIdx;
+using Operator = NeoN::dsl::Operator;
+
+TEST_CASE("processor")
+{
+    NeoN::mpi::MPIEnvironment mpiEnviron;
+    NeoN::SerialExecutor exec {};
+
+    auto mesh = NeoN::create1DUniformMesh(exec, 10);
+    const auto cellToPart =
+        NeoN::partitionCells(mesh, static_cast<localIdx>(mpiEnviron.sizeRank()));
+    const auto part = static_cast<label>(mpiEnviron.rank());
+    auto decomposed = NeoN::decomposeMesh(mesh, cellToPart, part);
+    const auto& local = decomposed.mesh;
+    auto comm = NeoN::createCommunicator(mpiEnviron, decomposed);
+    fvcc::setProcessorCommunicator(local, comm);
+
+    std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs;
+    for (localIdx patchi = 0; patchi + 1 < local.nBoundaries(); patchi++)
+    {
+        bcs.emplace_back(local, NeoN::Dictionary({{"type", std::string("calculated")}}), patchi);
+    }
+    const auto procPatch = local.nBoundaries() - 1;
+    bcs.emplace_back(local, NeoN::Dictionary({{"type", std::string("processor")}}), procPatch);
+
+    // the internal values are the original cell indices
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", local, bcs);
+    const auto cellMap = decomposed.cellMap.view();
+    auto phiV = phi.internalVector().view();
+    for (localIdx celli = 0; celli < local.nCells(); celli++)
+    {
+        phiV[celli] = static_cast<NeoN::scalar>(cellMap[celli]);
+    }
+
+    SECTION("The reference value is the value of the remote cell")
+    {
+        // the exchange is started and completed lazily by the access of the boundary values
+        phi.correctBoundaryConditions();
+        const auto refValue = phi.boundaryData().refValue().view();
+        const auto valueFraction = phi.boundaryData().valueFraction().view();
+
+        const auto [owner, neighbour, faceMap] =
+            NeoN::views(mesh.faceOwner(), mesh.faceNeighbour(), decomposed.faceMap);
+        const auto [start, end] = phi.boundaryData().range(procPatch);
+        REQUIRE(end > start);
+        for (auto bfacei = start; bfacei < end; bfacei++)
+        {
+            const auto facei = static_cast<localIdx>(faceMap[local.nInternalFaces() + bfacei]);
+            const auto own = owner[facei];
+            const bool ownLocal = cellToPart[static_cast<size_t>(own)] == part;
+            const auto remote = ownLocal ? neighbour[facei] : own;
+            REQUIRE(refValue[bfacei] == static_cast<NeoN::scalar>(remote));
+            REQUIRE(valueFraction[bfacei] == 1.0);
+        }
+    }
+
+    SECTION("Copies of the field reuse the communication names")
+    {
+        std::size_t nNames = 0;
+        for (int copyi = 0; copyi < 3; copyi++)
+        {
+            auto copy = phi;
+            copy.correctBoundaryConditions();
+            copy.boundaryData().completeUpdates();
+            if (copyi == 0)
+            {
+                nNames = comm.statistics().size();
+            }
+            REQUIRE(comm.statistics().size() == nNames);
+        }
+    }
+
+    SECTION("The interpolation finalises the exchange before the boundary faces")
+    {
+        // the exchange is in flight while the internal faces are interpolated
+        phi.correctBoundaryConditions();
+        fvcc::SurfaceField<NeoN::scalar> phif(
+            exec,
+            "phif",
+            local,
+            fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(local)
+        );
+        fvcc::SurfaceInterpolation<NeoN::scalar>(
+            exec, local, NeoN::TokenList({std::string("linear")})
+        )
+            .interpolate(phi, phif);
+
+        const auto [phifV, value, refValue] = NeoN::views(
+            phif.internalVector(), phi.boundaryData().value(), phi.boundaryData().refValue()
+        );
+        const auto [start, end] = phi.boundaryData().range(procPatch);
+        for (auto bfacei = start; bfacei < end; bfacei++)
+        {
+            REQUIRE(phifV[local.nInternalFaces() + bfacei] == value[bfacei]);
+            REQUIRE(value[bfacei] != 0.0);
+            REQUIRE(refValue[bfacei] != value[bfacei]);
+        }
+    }
+
+    SECTION("The divergence and the laplacian finalise the exchange after the internal faces")
+    {
+        fvcc::SurfaceField<NeoN::scalar> faceFlux(
+            exec,
+            "faceFlux",
+            local,
+            fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(local)
+        );
+        NeoN::fill(faceFlux.internalVector(), 0.5);
+        const NeoN::Input lapInput = NeoN::TokenList(
+            {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+        );
+        const auto explicitOperation = [&](const auto& op)
+        {
+            NeoN::Vector<NeoN::scalar> source(exec, local.nCells(), 0.0);
+            op.explicitOperation(source);
+            return source;
+        };
+
+        for (const auto* scheme : {"linear", "upwind"})
+        {
+            const fvcc::DivOperator<NeoN::scalar> div(
+                Operator::Type::Explicit,
+                faceFlux,
+                phi,
+                NeoN::TokenList({std::string("Gauss"), std::string(scheme)})
+            );
+            const fvcc::LaplacianOperator<NeoN::scalar> lap(
+                Operator::Type::Explicit, faceFlux, phi, lapInput
+            );
+
+            // the operators of a completed exchange
+            phi.correctBoundaryConditions();
+            phi.boundaryData().completeUpdates();
+            const auto expectedDiv = explicitOperation(div);
+            const auto expectedLap = explicitOperation(lap);
+
+            // the exchange is in flight while the internal faces are reduced
+            phi.correctBoundaryConditions();
+            REQUIRE(phi.boundaryData().hasPendingUpdates());
+            const auto divPhi = explicitOperation(div);
+            REQUIRE(!phi.boundaryData().hasPendingUpdates());
+            phi.correctBoundaryConditions();
+            REQUIRE(phi.boundaryData().hasPendingUpdates());
+            const auto lapPhi = explicitOperation(lap);
+            REQUIRE(!phi.boundaryData().hasPendingUpdates());
+
+            for (localIdx celli = 0; celli < local.nCells(); celli++)
+            {
+                REQUIRE(divPhi.view()[celli] == Catch::Approx(expectedDiv.view()[celli]));
+                REQUIRE(lapPhi.view()[celli] == Catch::Approx(expectedLap.view()[celli]));
+            }
+        }
+    }
+
+    SECTION("The interface couples the face cells to the global rows of the remote cells")
+    {
+        NeoN::la::GlobalRowNumbering numbering(mpiEnviron, local.nCells());
+        auto [rows, cols] = fvcc::processorInterface(local, procPatch, numbering);
+        const auto [start, end] = phi.boundaryData().range(procPatch);
+        REQUIRE(rows.size() == end - start);
+        REQUIRE(cols.size() == end - start);
+        const auto colsV = cols.view();
+        for (localIdx i = 0; i < cols.size(); i++)
+        {
+            REQUIRE(colsV[i] >= 0);
+            REQUIRE(colsV[i] < numbering.nGlobalRows());
+        }
+    }
+}
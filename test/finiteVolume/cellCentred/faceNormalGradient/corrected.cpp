@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace NeoN
+{
+
+TEST_CASE("corrected")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = create3DUniformMesh(exec, 3, 4, 5, true);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+
+    fvcc::VolumeField<scalar> phi(exec, "phi", mesh, volumeBCs);
+    const auto [phiV, centres] = views(phi.internalVector(), mesh.cellCentres());
+    parallelFor(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            phiV[celli] = centres[celli][0] + 2.0 * centres[celli][2];
+        }
+    );
+    auto [phiB, faceCentres] = views(phi.boundaryData().value(), mesh.boundaryMesh().cf());
+    parallelFor(
+        exec,
+        {0, mesh.nBoundaryFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            phiB[facei] = faceCentres[facei][0] + 2.0 * faceCentres[facei][2];
+        }
+    );
+
+    SECTION("The correction vectors vanish on an orthogonal mesh " + execName)
+    {
+        const auto geometryScheme = fvcc::GeometryScheme::readOrCreate(mesh);
+        const auto& correction = geometryScheme->nonOrthCorrectionVec3s();
+        auto correctionHost = correction.internalVector().copyToHost();
+        for (localIdx facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            REQUIRE(mag(correctionHost.view()[facei]) == Catch::Approx(0.0).margin(1e-10));
+        }
+    }
+
+    SECTION("Corrected and uncorrected agree on an orthogonal mesh " + execName)
+    {
+        fvcc::FaceNormalGradient<scalar> corrected(
+            exec, mesh, TokenList({std::string("corrected")})
+        );
+        fvcc::FaceNormalGradient<scalar> uncorrected(
+            exec, mesh, TokenList({std::string("uncorrected")})
+        );
+        fvcc::SurfaceField<scalar> correctedPhif(exec, "correctedPhif", mesh, surfaceBCs);
+        fvcc::SurfaceField<scalar> uncorrectedPhif(exec, "uncorrectedPhif", mesh, surfaceBCs);
+        corrected.faceNormalGrad(phi, correctedPhif);
+        uncorrected.faceNormalGrad(phi, uncorrectedPhif);
+
+        REQUIRE(!corrected.inlineFaceNormalGrad());
+        auto correctedHost = correctedPhif.internalVector().copyToHost();
+        auto uncorrectedHost = uncorrectedPhif.internalVector().copyToHost();
+        for (localIdx facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            REQUIRE(
+                correctedHost.view()[facei]
+                == Catch::Approx(uncorrectedHost.view()[facei]).margin(1e-10)
+            );
+        }
+    }
+}
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+template<typename T>
+using I = std::initializer_list<T>;
+
+TEST_CASE("volumeFieldBlock")
+{
+    namespace fvcc = NeoN::finiteVolume::cellCentred;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, 10);
+    std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs {};
+    for (auto patchi : I<NeoN::localIdx> {0, 1})
+    {
+        NeoN::Dictionary dict;
+        dict.insert("type", std::string("fixedValue"));
+        dict.insert("fixedValue", 2.0);
+        bcs.push_back(fvcc::VolumeBoundary<NeoN::scalar>(mesh, dict, patchi));
+    }
+
+    fvcc::VolumeField<NeoN::scalar> a(exec, "a", mesh, bcs);
+    fvcc::VolumeField<NeoN::scalar> b(exec, "b", mesh, bcs);
+    NeoN::fill(a.internalVector(), 1.0);
+    NeoN::fill(b.internalVector(), 3.0);
+    const auto nCells = mesh.nCells();
+
+    SECTION("stores the components contiguously on: " + execName)
+    {
+        fvcc::VolumeFieldBlock<NeoN::scalar> block("Y", {&a, &b});
+
+        REQUIRE(block.nComponents() == 2);
+        REQUIRE(block.nCells() == nCells);
+        REQUIRE(block.componentName(1) == "b");
+        REQUIRE(block.internalVector().size() == 2 * nCells);
+
+        auto values = block.internalVector().copyToHost();
+        for (NeoN::localIdx i = 0; i < nCells; ++i)
+        {
+            REQUIRE(values.view()[i] == 1.0);
+            REQUIRE(values.view()[nCells + i] == 3.0);
+        }
+    }
+
+    SECTION("converts from and to volume fields on: " + execName)
+    {
+        fvcc::VolumeFieldBlock<NeoN::scalar> block(exec, "Y", mesh, {"a", "b"}, bcs);
+        block.assign(0, a);
+        block.assign(1, b);
+        NeoN::mul(block.internalVector(), 2.0);
+        block.correctBoundaryConditions();
+
+        auto b2 = block.component(1);
+        REQUIRE(b2.name == "b");
+        auto values = b2.internalVector().copyToHost();
+        for (NeoN::localIdx i = 0; i < nCells; ++i)
+        {
+            REQUIRE(values.view()[i] == 6.0);
+        }
+        auto boundaryValues = block.boundaryData(1).value().copyToHost();
+        for (NeoN::localIdx i = 0; i < boundaryValues.size(); ++i)
+        {
+            REQUIRE(boundaryValues.view()[i] == 2.0);
+        }
+    }
+}
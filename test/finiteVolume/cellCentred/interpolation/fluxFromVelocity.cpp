@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::finiteVolume::cellCentred::SurfaceInterpolation;
+using NeoN::finiteVolume::cellCentred::VolumeField;
+using NeoN::finiteVolume::cellCentred::SurfaceField;
+
+namespace NeoN
+{
+
+template<typename T>
+using I = std::initializer_list<T>;
+
+TEST_CASE("fluxFromVelocity")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const std::string scheme = GENERATE(std::string("linear"), std::string("upwind"));
+
+    auto mesh = create1DUniformMesh(exec, 10);
+    Input input = TokenList({scheme});
+    auto interpolation = SurfaceInterpolation<Vec3>(exec, mesh, input);
+    std::vector<fvcc::VolumeBoundary<Vec3>> bcs {};
+    for (auto patchi : I<NeoN::localIdx> {0, 1})
+    {
+        Dictionary dict;
+        dict.insert("type", std::string("fixedValue"));
+        dict.insert("fixedValue", Vec3(-1.0, 0.0, 0.0));
+        bcs.push_back(fvcc::VolumeBoundary<Vec3>(mesh, dict, patchi));
+    }
+
+    auto u = VolumeField<Vec3>(exec, "u", mesh, bcs);
+    fill(u.internalVector(), Vec3(2.0, 1.0, 0.0));
+    u.correctBoundaryConditions();
+    auto phi = SurfaceField<scalar>(exec, "phi", mesh, {});
+
+    SECTION("matches the interpolated velocity times the face areas for " + scheme + execName)
+    {
+        fvcc::fluxFromVelocity(interpolation, u, phi);
+
+        auto uf = interpolation.interpolate(u);
+        auto [phiHost, ufHost, sfHost] =
+            copyToHosts(phi.internalVector(), uf.internalVector(), mesh.faceAreas());
+        for (NeoN::localIdx facei = 0; facei < phiHost.size(); facei++)
+        {
+            const auto expected = ufHost.view()[facei] & sfHost.view()[facei];
+            REQUIRE(phiHost.view()[facei] == Catch::Approx(expected).margin(1e-14));
+        }
+    }
+}
+}
@@ -58,4 +58,74 @@ TEMPLATE_TEST_CASE("linear", "", NeoN::scalar, NeoN::Vec3)
         REQUIRE(outHost.view()[i] == one<TestType>());
     }
 }
+
+TEST_CASE("linearFloatWeights")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = create1DUniformMesh(exec, 10);
+    auto linear = SurfaceInterpolation<scalar>(exec, mesh, TokenList({std::string("linear")}));
+    auto linearFloat = SurfaceInterpolation<scalar>(
+        exec, mesh, TokenList({std::string("linearFloatWeights")})
+    );
+    std::vector<fvcc::VolumeBoundary<scalar>> vbcs {};
+    std::vector<fvcc::SurfaceBoundary<scalar>> sbcs {};
+    for (auto patchi : I<NeoN::localIdx> {0, 1})
+    {
+        Dictionary dict;
+        dict.insert("type", std::string("fixedValue"));
+        dict.insert("fixedValue", scalar(1.0 / 3.0));
+        sbcs.push_back(fvcc::SurfaceBoundary<scalar>(mesh, dict, patchi));
+        vbcs.push_back(fvcc::VolumeBoundary<scalar>(mesh, dict, patchi));
+    }
+
+    // values which are not representable in float
+    auto in = VolumeField<scalar>(exec, "in", mesh, vbcs);
+    auto inView = in.internalVector().view();
+    parallelFor(
+        exec,
+        {0, in.internalVector().size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            inView[celli] = scalar(1.0) / scalar(celli + 3) + scalar(1.0e-9);
+        }
+    );
+    in.correctBoundaryConditions();
+
+    auto out = SurfaceField<scalar>(exec, "out", mesh, sbcs);
+    auto outFloat = SurfaceField<scalar>(exec, "outFloat", mesh, sbcs);
+    linear.interpolate(in, out);
+    linearFloat.interpolate(in, outFloat);
+
+    SECTION("Agrees with the linear interpolation on " + execName)
+    {
+        auto outHost = out.internalVector().copyToHost();
+        auto outFloatHost = outFloat.internalVector().copyToHost();
+        for (localIdx facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            // only the weights are rounded, the sums are computed in scalar precision
+            REQUIRE(
+                outFloatHost.view()[facei]
+                == Catch::Approx(outHost.view()[facei]).epsilon(1e-6)
+            );
+        }
+    }
+
+    SECTION("Stores the weights in single precision on " + execName)
+    {
+        const auto geometry = fvcc::GeometryScheme::readOrCreate(mesh);
+        const auto& floatWeights = geometry->floatWeights();
+        REQUIRE(floatWeights.size() == mesh.nFaces());
+        REQUIRE(floatWeights.memoryBytes() == sizeof(float) * std::size_t(mesh.nFaces()));
+
+        // the weights reported by the scheme are the promoted float weights
+        auto weight = SurfaceField<scalar>(exec, "weight", mesh, sbcs);
+        linearFloat.weight(in, weight);
+        auto weightHost = weight.internalVector().copyToHost();
+        auto floatWeightsHost = floatWeights.copyToHost();
+        for (localIdx facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            REQUIRE(weightHost.view()[facei] == scalar(floatWeightsHost.view()[facei]));
+        }
+    }
+}
 }
@@ -4,6 +4,9 @@
 
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
+#include <string>
+#include <vector>
+
 #include "catch2_common.hpp"
 
 #include "NeoN/NeoN.hpp"
@@ -33,3 +36,80 @@ TEST_CASE("SurfaceInterpolation")
         fvcc::SurfaceInterpolation<NeoN::scalar> surfInterpolation(exec, mesh, input);
     }
 }
+
+/* @brief a field whose internal and boundary values are scaled by k */
+template<typename ValueType>
+fvcc::VolumeField<ValueType> createScaledField(
+    const NeoN::Executor& exec,
+    const NeoN::UnstructuredMesh& mesh,
+    const std::string& name,
+    NeoN::localIdx k
+)
+{
+    using NeoN::localIdx;
+    using NeoN::scalar;
+    fvcc::VolumeField<ValueType> src(exec, name, mesh, {});
+    auto srcV = src.internalVector().view();
+    NeoN::parallelFor(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            srcV[celli] = scalar(celli * k) * NeoN::one<ValueType>();
+        }
+    );
+    NeoN::fill(src.boundaryData().value(), scalar(k + 1) * NeoN::one<ValueType>());
+    return src;
+}
+
+/* @brief checks that the batched interpolation of two fields matches interpolating each field */
+template<typename ValueType>
+void requireBatchedMatchesSingle(
+    const NeoN::Executor& exec,
+    const NeoN::UnstructuredMesh& mesh,
+    const std::string& interpolation,
+    const fvcc::SurfaceField<NeoN::scalar>& flux
+)
+{
+    NeoN::Input input = NeoN::TokenList({interpolation});
+    fvcc::SurfaceInterpolation<ValueType> surfInterpolation(exec, mesh, input);
+    REQUIRE(surfInterpolation.inlineInterpolation() != fvcc::InlineInterpolation::None);
+
+    const auto src0 = createScaledField<ValueType>(exec, mesh, "src0", 1);
+    const auto src1 = createScaledField<ValueType>(exec, mesh, "src1", 2);
+    fvcc::SurfaceField<ValueType> batched0(exec, "batched0", mesh, {});
+    fvcc::SurfaceField<ValueType> batched1(exec, "batched1", mesh, {});
+    const std::vector<const fvcc::VolumeField<ValueType>*> srcs {&src0, &src1};
+    const std::vector<fvcc::SurfaceField<ValueType>*> dsts {&batched0, &batched1};
+    surfInterpolation.interpolate(flux, srcs, dsts);
+
+    fvcc::SurfaceField<ValueType> single0(exec, "single0", mesh, {});
+    fvcc::SurfaceField<ValueType> single1(exec, "single1", mesh, {});
+    surfInterpolation.interpolate(flux, src0, single0);
+    surfInterpolation.interpolate(flux, src1, single1);
+
+    REQUIRE(NeoN::equal(batched0.internalVector(), single0.internalVector()));
+    REQUIRE(NeoN::equal(batched1.internalVector(), single1.internalVector()));
+}
+
+TEST_CASE("SurfaceInterpolation - batched")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::string interpolation = GENERATE(std::string("linear"), std::string("upwind"));
+
+    auto mesh = NeoN::create1DUniformMesh(exec, 10);
+    auto flux = fvcc::SurfaceField<NeoN::scalar>(exec, "flux", mesh, {});
+    auto fluxV = flux.internalVector().view();
+    // alternating flux directions
+    NeoN::parallelFor(
+        exec,
+        {0, mesh.nFaces()},
+        KOKKOS_LAMBDA(const NeoN::localIdx facei) { fluxV[facei] = facei % 2 == 0 ? 1.0 : -1.0; }
+    );
+
+    SECTION("Batched " + interpolation + " matches single fields on " + execName)
+    {
+        requireBatchedMatchesSingle<NeoN::scalar>(exec, mesh, interpolation, flux);
+        requireBatchedMatchesSingle<NeoN::Vec3>(exec, mesh, interpolation, flux);
+    }
+}
@@ -59,4 +59,98 @@ TEMPLATE_TEST_CASE("upwind", "", NeoN::scalar, NeoN::Vec3)
     }
 }
 
+TEMPLATE_TEST_CASE("upwind weightAndInterpolate", "", NeoN::scalar, NeoN::Vec3)
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = create1DUniformMesh(exec, 10);
+    Input input = TokenList({std::string("upwind")});
+    auto upwind = SurfaceInterpolation<TestType>(exec, mesh, input);
+
+    auto in = VolumeField<TestType>(exec, "in", mesh, {});
+    auto flux = SurfaceField<scalar>(exec, "flux", mesh, {});
+    auto [inV, fluxV] = views(in.internalVector(), flux.internalVector());
+    parallelFor(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) { inV[celli] = scalar(celli) * one<TestType>(); }
+    );
+    // alternating flux directions
+    parallelFor(
+        exec,
+        {0, mesh.nFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) { fluxV[facei] = facei % 2 == 0 ? 1.0 : -1.0; }
+    );
+    fill(in.boundaryData().value(), 2.0 * one<TestType>());
+
+    auto separateWeights = SurfaceField<scalar>(exec, "separateWeights", mesh, {});
+    auto separateOut = SurfaceField<TestType>(exec, "separateOut", mesh, {});
+    upwind.weight(flux, in, separateWeights);
+    upwind.interpolate(flux, in, separateOut);
+
+    auto fusedWeights = SurfaceField<scalar>(exec, "fusedWeights", mesh, {});
+    auto fusedOut = SurfaceField<TestType>(exec, "fusedOut", mesh, {});
+    upwind.weightAndInterpolate(flux, in, fusedWeights, fusedOut);
+
+    SECTION("fused and separate kernels agree on " + execName)
+    {
+        auto separateWeightsHost = separateWeights.internalVector().copyToHost();
+        auto separateOutHost = separateOut.internalVector().copyToHost();
+        auto fusedWeightsHost = fusedWeights.internalVector().copyToHost();
+        auto fusedOutHost = fusedOut.internalVector().copyToHost();
+        for (NeoN::localIdx i = 0; i < mesh.nFaces(); i++)
+        {
+            REQUIRE(fusedWeightsHost.view()[i] == separateWeightsHost.view()[i]);
+            REQUIRE(fusedOutHost.view()[i] == separateOutHost.view()[i]);
+        }
+        auto separateBoundaryHost = separateWeights.boundaryData().value().copyToHost();
+        auto fusedBoundaryHost = fusedWeights.boundaryData().value().copyToHost();
+        for (NeoN::localIdx i = 0; i < mesh.nBoundaryFaces(); i++)
+        {
+            REQUIRE(fusedBoundaryHost.view()[i] == separateBoundaryHost.view()[i]);
+        }
+    }
+}
+
+TEST_CASE("upwind face direction")
+{
+    namespace fvcc = NeoN::finiteVolume::cellCentred;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = create1DUniformMesh(exec, 70);
+    auto flux = SurfaceField<scalar>(exec, "flux", mesh, {});
+    auto fluxV = flux.internalVector().view();
+    parallelFor(
+        exec,
+        {0, mesh.nFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) { fluxV[facei] = facei % 3 == 0 ? -1.0 : 1.0; }
+    );
+
+    const auto& direction = fvcc::FaceDirection::readOrCreate(flux);
+    REQUIRE(direction.upToDate(flux));
+    REQUIRE(&fvcc::FaceDirection::readOrCreate(flux) == &direction);
+
+    SECTION("packs the flux signs on " + execName)
+    {
+        const auto directionsHost = direction.directions().copyToHost();
+        REQUIRE(directionsHost.size() == (mesh.nInternalFaces() + 31) / 32);
+        for (localIdx facei = 0; facei < mesh.nInternalFaces(); facei++)
+        {
+            REQUIRE(fvcc::ownerUpwind(directionsHost.view(), facei) == (facei % 3 != 0));
+        }
+    }
+
+    SECTION("is recomputed after a flux update on " + execName)
+    {
+        fill(flux.internalVector(), -1.0);
+        REQUIRE_FALSE(direction.upToDate(flux));
+        const auto directionsHost =
+            fvcc::FaceDirection::readOrCreate(flux).directions().copyToHost();
+        for (localIdx facei = 0; facei < mesh.nInternalFaces(); facei++)
+        {
+            REQUIRE_FALSE(fvcc::ownerUpwind(directionsHost.view(), facei));
+        }
+    }
+}
+
 }
@@ -105,6 +105,32 @@ TEMPLATE_TEST_CASE("DdtOperator", "[template]", NeoN::scalar, NeoN::Vec3)
             REQUIRE(rhsV[ii] == -2.0 * volV[0] * one<TestType>());
         }
     }
+
+    SECTION("DdtOperator with local time step " + execName)
+    {
+        // the global time step is ignored, every cell uses its own time step of .25
+        auto localDt = Vector<NeoN::scalar>(exec, mesh.nCells(), 0.25);
+        auto ddtExp = dsl::exp::ddt(phi, localDt);
+        auto source = Vector<TestType>(exec, phi.size(), zero<TestType>());
+        ddtExp.explicitOperation(source, 1.0, 0.5);
+
+        auto ls = NeoN::la::createEmptyLinearSystem<TestType, NeoN::localIdx>(mesh, sp);
+        auto ddtImp = dsl::imp::ddt(phi, localDt);
+        ddtImp.implicitOperation(ls, 1.0, 0.5);
+
+        const auto [lsHost, vol, hostSource] = copyToHosts(ls, mesh.cellVolumes(), source);
+        const auto [mtxValsV, volV, rhsV, vals] =
+            views(lsHost.matrix().values(), vol, lsHost.rhs(), hostSource);
+
+        for (auto ii = 0; ii < vals.size(); ++ii)
+        {
+            // => (10 -- 1)/.25*V = 44V
+            REQUIRE(vals[ii] == volV[0] * TestType(44.0));
+            // => 1/.25*V = 4V and -1/.25*V = -4V
+            REQUIRE(mtxValsV[ii] == 4.0 * volV[0] * one<TestType>());
+            REQUIRE(rhsV[ii] == -4.0 * volV[0] * one<TestType>());
+        }
+    }
 }
 
 }
@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using Operator = NeoN::dsl::Operator;
+
+namespace NeoN
+{
+
+TEST_CASE("FusedExpression")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const std::string scheme = GENERATE(std::string("linear"), std::string("upwind"));
+
+    const localIdx nCells = 10;
+    auto mesh = create1DUniformMesh(exec, nCells);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+
+    fvcc::SurfaceField<scalar> faceFlux(exec, "phi", mesh, surfaceBCs);
+    fill(faceFlux.internalVector(), 0.5);
+    fvcc::SurfaceField<scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    fill(gamma.internalVector(), 2.0);
+
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+    fvcc::VolumeField<scalar> T(exec, "T", mesh, volumeBCs);
+    parallelFor(
+        T.internalVector(), KOKKOS_LAMBDA(const localIdx i) { return scalar(i * i); }
+    );
+    fill(T.boundaryData().value(), 3.0);
+
+    Input divInput = TokenList({std::string("Gauss"), std::string(scheme)});
+    Input lapInput =
+        TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+
+    // div(phi,T) - laplacian(gamma,T) + kappa * laplacian(gamma,T)
+    Vector<scalar> kappa(exec, nCells, 0.25);
+    auto eqn = dsl::Expression<scalar>(exec);
+    eqn.addOperator(fvcc::DivOperator<scalar>(Operator::Type::Explicit, faceFlux, T, divInput));
+    eqn.addOperator(
+        dsl::Coeff(-1.0)
+        * dsl::SpatialOperator<scalar>(
+            fvcc::LaplacianOperator<scalar>(Operator::Type::Explicit, gamma, T, lapInput)
+        )
+    );
+    eqn.addOperator(
+        kappa
+        * dsl::SpatialOperator<scalar>(
+            fvcc::LaplacianOperator<scalar>(Operator::Type::Explicit, gamma, T, lapInput)
+        )
+    );
+
+    SECTION("Fuse the terms with a uniform coefficient with " + scheme + " on " + execName)
+    {
+        const fvcc::FusedExpression<scalar> fused(eqn);
+        REQUIRE(fused.fusedTerms().size() == 2);
+        REQUIRE(fused.fusedTerms()[1].kind == fvcc::FusedTermKind::Laplacian);
+        REQUIRE(fused.fusedTerms()[1].coeff[0] == -1.0);
+    }
+
+    SECTION("Evaluate fused terms as the single terms with " + scheme + " on " + execName)
+    {
+        Vector<scalar> expected(exec, nCells, 1.0);
+        eqn.explicitOperation(expected);
+
+        // the source is accumulated, the evaluation is repeated to check the reuse of the
+        // workspace
+        const fvcc::FusedExpression<scalar> fused(eqn);
+        Vector<scalar> source(exec, nCells, 1.0);
+        fused.explicitOperation(source);
+        fused.explicitOperation(source);
+        fill(source, 1.0);
+        fused.explicitOperation(source);
+
+        auto expectedHost = expected.copyToHost();
+        auto sourceHost = source.copyToHost();
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(
+                sourceHost.view()[celli] == Catch::Approx(expectedHost.view()[celli]).margin(1e-10)
+            );
+        }
+    }
+
+    SECTION("Fused explicit euler update with " + scheme + " on " + execName)
+    {
+        // only fused terms, the update is applied by the face sweep
+        auto fusedEqn = dsl::Expression<scalar>(exec);
+        fusedEqn.addOperator(
+            fvcc::DivOperator<scalar>(Operator::Type::Explicit, faceFlux, T, divInput)
+        );
+        fusedEqn.addOperator(
+            fvcc::LaplacianOperator<scalar>(Operator::Type::Explicit, gamma, T, lapInput)
+        );
+        const scalar dt = 0.1;
+        Vector<scalar> oldT(exec, nCells, 2.0);
+
+        for (auto* expr : {&eqn, &fusedEqn})
+        {
+            Vector<scalar> source(exec, nCells, 0.0);
+            expr->explicitOperation(source);
+            Vector<scalar> expected = oldT - source * dt;
+
+            const fvcc::FusedExpression<scalar> fused(*expr);
+            Vector<scalar> x(exec, nCells, 0.0);
+            fused.explicitEulerUpdate(x, oldT, dt);
+
+            // the updated vector is read by the terms
+            const Vector<scalar> initialT = T.internalVector();
+            fused.explicitEulerUpdate(T.internalVector(), oldT, dt);
+            Vector<scalar> updatedT = T.internalVector();
+            T.internalVector() = initialT;
+
+            Vector<scalar> localDt(exec, nCells, dt);
+            Vector<scalar> xLocal(exec, nCells, 0.0);
+            fused.explicitEulerUpdate(xLocal, oldT, 1.0, &localDt);
+
+            auto expectedHost = expected.copyToHost();
+            auto xHost = x.copyToHost();
+            auto updatedHost = updatedT.copyToHost();
+            auto localHost = xLocal.copyToHost();
+            for (localIdx celli = 0; celli < nCells; celli++)
+            {
+                const auto value = Catch::Approx(expectedHost.view()[celli]).margin(1e-10);
+                REQUIRE(xHost.view()[celli] == value);
+                REQUIRE(updatedHost.view()[celli] == value);
+                REQUIRE(localHost.view()[celli] == value);
+            }
+        }
+    }
+}
+
+TEST_CASE("FusedExpression implicit")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const std::string scheme = GENERATE(std::string("linear"), std::string("upwind"));
+
+    const localIdx nCells = 10;
+    auto mesh = create1DUniformMesh(exec, nCells);
+    const auto& sparsity = la::SparsityPattern::readOrCreate(mesh);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+
+    fvcc::SurfaceField<scalar> faceFlux(exec, "phi", mesh, surfaceBCs);
+    fill(faceFlux.internalVector(), -0.5);
+    fvcc::SurfaceField<scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    fill(gamma.internalVector(), 2.0);
+
+    std::vector<fvcc::VolumeBoundary<scalar>> bcs;
+    bcs.push_back(fvcc::VolumeBoundary<scalar>(
+        mesh, Dictionary({{"type", std::string("fixedValue")}, {"fixedValue", 1.0}}), 0
+    ));
+    bcs.push_back(fvcc::VolumeBoundary<scalar>(
+        mesh, Dictionary({{"type", std::string("fixedGradient")}, {"fixedGradient", 2.0}}), 1
+    ));
+    fvcc::VolumeField<scalar> T(exec, "T", mesh, bcs);
+    fill(T.internalVector(), 1.0);
+    T.correctBoundaryConditions();
+
+    auto coeffBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+    fvcc::VolumeField<scalar> sp(exec, "sp", mesh, coeffBCs);
+    fill(sp.internalVector(), 3.0);
+
+    Input divInput = TokenList({std::string("Gauss"), std::string(scheme)});
+    Input lapInput =
+        TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+
+    // div(phi,T) - kappa * laplacian(gamma,T) + Sp(sp,T)
+    Vector<scalar> kappa(exec, nCells, 0.25);
+    auto eqn = dsl::Expression<scalar>(exec);
+    eqn.addOperator(fvcc::DivOperator<scalar>(Operator::Type::Implicit, faceFlux, T, divInput));
+    eqn.addOperator(
+        dsl::Coeff(-1.0) * kappa
+        * dsl::SpatialOperator<scalar>(
+            fvcc::LaplacianOperator<scalar>(Operator::Type::Implicit, gamma, T, lapInput)
+        )
+    );
+    eqn.addOperator(fvcc::SourceTerm<scalar>(Operator::Type::Implicit, sp, T));
+
+    SECTION("Assemble fused terms as the single terms with " + scheme + " on " + execName)
+    {
+        fvcc::FusedExpression<scalar> fused(eqn);
+        REQUIRE(fused.fusedImplicitTerms().size() == 2);
+
+        auto expected = la::createEmptyLinearSystem<scalar, localIdx>(mesh, sparsity);
+        eqn.implicitOperation(expected);
+        auto ls = la::createEmptyLinearSystem<scalar, localIdx>(mesh, sparsity);
+        fused.implicitOperation(ls);
+
+        auto expectedHost = expected.copyToHost();
+        auto lsHost = ls.copyToHost();
+        auto [expectedMatrix, expectedRhs] = expectedHost.view();
+        auto [matrix, rhs] = lsHost.view();
+        for (localIdx i = 0; i < matrix.values.size(); i++)
+        {
+            REQUIRE(matrix.values[i] == Catch::Approx(expectedMatrix.values[i]).margin(1e-10));
+        }
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(rhs[celli] == Catch::Approx(expectedRhs[celli]).margin(1e-10));
+        }
+    }
+}
+
+} // namespace NeoN
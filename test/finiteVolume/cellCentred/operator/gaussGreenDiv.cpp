@@ -4,6 +4,9 @@
 
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
+#include <memory>
+#include <vector>
+
 #include "catch2_common.hpp"
 
 #include "NeoN/NeoN.hpp"
@@ -67,6 +70,149 @@ TEMPLATE_TEST_CASE("DivOperator", "[template]", NeoN::scalar, NeoN::Vec3)
             REQUIRE(outHostView[i] == zero<TestType>());
         }
     }
+
+    SECTION("Fused upwind interpolation" + execName)
+    {
+        Input input = TokenList({std::string("Gauss"), std::string("upwind")});
+        auto op = fvcc::DivOperator(Operator::Type::Explicit, faceFlux, phi, input);
+        op.div(result);
+
+        auto outHost = result.copyToHost();
+        auto outHostView = outHost.view();
+        for (int i = 0; i < result.size(); i++)
+        {
+            REQUIRE(outHostView[i] == zero<TestType>());
+        }
+    }
+
+    SECTION("Batched divergence" + execName)
+    {
+        auto scheme = GENERATE(std::string("linear"), std::string("upwind"));
+        Input input = TokenList({std::string("Gauss"), scheme});
+        auto divOp = fvcc::DivOperatorFactory<TestType>::create(exec, mesh, input);
+
+        fvcc::VolumeField<TestType> psi(exec, "psi", mesh, volumeBCs);
+        auto psiV = psi.internalVector().view();
+        parallelFor(
+            exec,
+            {0, psi.size()},
+            KOKKOS_LAMBDA(const localIdx i) { psiV[i] = scalar(i * i) * one<TestType>(); }
+        );
+        fill(psi.boundaryData().value(), one<TestType>());
+
+        auto expected = Vector<TestType>(exec, psi.size(), zero<TestType>());
+        divOp->div(expected, faceFlux, psi, dsl::Coeff(1.0));
+
+        auto resultPsi = Vector<TestType>(exec, psi.size(), zero<TestType>());
+        divOp->div({&result, &resultPsi}, faceFlux, {&phi, &psi}, dsl::Coeff(1.0));
+
+        auto resultHost = result.copyToHost();
+        auto resultPsiHost = resultPsi.copyToHost();
+        auto expectedHost = expected.copyToHost();
+        for (int i = 0; i < result.size(); i++)
+        {
+            REQUIRE(resultHost.view()[i] == zero<TestType>());
+            auto diff = resultPsiHost.view()[i] - expectedHost.view()[i];
+            REQUIRE(mag(diff) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+
+    SECTION("Batched divergence on the local and active cells" + execName)
+    {
+        auto scheme = GENERATE(std::string("linear"), std::string("upwind"));
+        const bool ghostCells = GENERATE(false, true);
+        Input input = TokenList({std::string("Gauss"), scheme});
+
+        // the first part of a decomposition with ghost cells or the mesh with an active region,
+        // the batch must only write the cells of the single divergence
+        auto decomposed =
+            decomposeMesh(mesh, partitionCells(mesh, 2), 0, HaloLayout::GhostCells);
+        const auto& testMesh = ghostCells ? decomposed.mesh : mesh;
+        if (!ghostCells)
+        {
+            const Vector<localIdx> mask(exec, std::vector<localIdx> {1, 1, 1, 1, 1, 0, 0, 0, 0, 0});
+            mesh.setActiveRegion(std::make_shared<ActiveRegion>(mesh, mask));
+        }
+        auto divOp = fvcc::DivOperatorFactory<TestType>::create(exec, testMesh, input);
+
+        fvcc::SurfaceField<scalar> testFlux(
+            exec,
+            "testFlux",
+            testMesh,
+            fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(testMesh)
+        );
+        fill(testFlux.internalVector(), 1.0);
+        auto testBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<TestType>>(testMesh);
+        fvcc::VolumeField<TestType> phi0(exec, "phi0", testMesh, testBCs);
+        fvcc::VolumeField<TestType> phi1(exec, "phi1", testMesh, testBCs);
+        auto [phi0V, phi1V] = views(phi0.internalVector(), phi1.internalVector());
+        parallelFor(
+            exec,
+            {0, phi0.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                phi0V[i] = scalar(i) * one<TestType>();
+                phi1V[i] = scalar(i * i) * one<TestType>();
+            }
+        );
+        fill(phi0.boundaryData().value(), one<TestType>());
+        fill(phi1.boundaryData().value(), one<TestType>());
+
+        const TestType unset = -1.0 * one<TestType>();
+        std::vector<Vector<TestType>> expected;
+        std::vector<Vector<TestType>> batched;
+        for (const auto* field : {&phi0, &phi1})
+        {
+            expected.emplace_back(exec, field->size(), unset);
+            divOp->div(expected.back(), testFlux, *field, dsl::Coeff(1.0));
+            batched.emplace_back(exec, field->size(), unset);
+        }
+        divOp->div({&batched[0], &batched[1]}, testFlux, {&phi0, &phi1}, dsl::Coeff(1.0));
+
+        for (std::size_t k = 0; k < 2; k++)
+        {
+            auto batchedHost = batched[k].copyToHost();
+            auto expectedHost = expected[k].copyToHost();
+            for (localIdx i = 0; i < batchedHost.size(); i++)
+            {
+                auto diff = batchedHost.view()[i] - expectedHost.view()[i];
+                REQUIRE(mag(diff) == Catch::Approx(0.0).margin(1e-12));
+            }
+            // the inactive and the ghost cells keep their value
+            REQUIRE(batchedHost.view()[batchedHost.size() - 1] == unset);
+        }
+        mesh.setActiveRegion(nullptr);
+    }
+
+    SECTION("Block divergence" + execName)
+    {
+        auto scheme = GENERATE(std::string("linear"), std::string("upwind"));
+        fvcc::SurfaceInterpolation<TestType> interp(exec, mesh, TokenList({scheme}));
+
+        fvcc::VolumeField<TestType> psi(exec, "psi", mesh, volumeBCs);
+        auto psiV = psi.internalVector().view();
+        parallelFor(
+            exec,
+            {0, psi.size()},
+            KOKKOS_LAMBDA(const localIdx i) { psiV[i] = scalar(i * i) * one<TestType>(); }
+        );
+        fill(psi.boundaryData().value(), one<TestType>());
+
+        auto expected = Vector<TestType>(exec, psi.size(), zero<TestType>());
+        fvcc::computeDivExp(faceFlux, psi, interp, expected, dsl::Coeff(1.0));
+
+        fvcc::VolumeFieldBlock<TestType> block("block", {&phi, &psi});
+        auto blockResult = Vector<TestType>(exec, block.internalVector().size(), zero<TestType>());
+        fvcc::computeBlockDivExp(faceFlux, block, interp, blockResult, dsl::Coeff(1.0));
+
+        auto blockResultHost = blockResult.copyToHost();
+        auto expectedHost = expected.copyToHost();
+        for (localIdx i = 0; i < psi.size(); i++)
+        {
+            REQUIRE(blockResultHost.view()[i] == zero<TestType>());
+            auto diff = blockResultHost.view()[psi.size() + i] - expectedHost.view()[i];
+            REQUIRE(mag(diff) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
 }
 
 }
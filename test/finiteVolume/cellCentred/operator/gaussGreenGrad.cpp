@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("GaussGreenGrad")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 3, 4, 5, true);
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, volumeBCs);
+    const auto [phiV, centres] = NeoN::views(phi.internalVector(), mesh.cellCentres());
+    NeoN::parallelFor(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const NeoN::localIdx celli) {
+            phiV[celli] = centres[celli][0] + 2.0 * centres[celli][2];
+        }
+    );
+    NeoN::fill(phi.boundaryData().value(), 0.0);
+
+    SECTION("AoS and SoA layout give the same gradient " + execName)
+    {
+        fvcc::GaussGreenGrad aosGrad(exec, mesh, NeoN::VectorLayout::AoS);
+        fvcc::GaussGreenGrad soaGrad(exec, mesh, NeoN::VectorLayout::SoA);
+
+        auto aosHost = aosGrad.grad(phi).internalVector().copyToHost();
+        auto soaHost = soaGrad.grad(phi).internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(soaHost.view()[celli] == aosHost.view()[celli]);
+        }
+    }
+
+    SECTION("The gradient is only recomputed after a modification of phi " + execName)
+    {
+        fvcc::GaussGreenGrad gaussGreenGrad(exec, mesh);
+        auto first = gaussGreenGrad.grad(phi).internalVector().copyToHost();
+        auto cached = gaussGreenGrad.grad(phi).internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(cached.view()[celli] == first.view()[celli]);
+        }
+
+        phi.internalVector() *= 2.0;
+        auto scaled = gaussGreenGrad.grad(phi).internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(scaled.view()[celli] == 2.0 * first.view()[celli]);
+        }
+    }
+
+    SECTION("The gradient of a vector field holds the gradients of its components " + execName)
+    {
+        auto vectorBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::Vec3>>(mesh);
+        fvcc::VolumeField<NeoN::Vec3> u(exec, "u", mesh, vectorBCs);
+        fvcc::VolumeField<NeoN::scalar> uy(exec, "uy", mesh, volumeBCs);
+        auto [uV, uyV] = NeoN::views(u.internalVector(), uy.internalVector());
+        NeoN::parallelFor(
+            exec,
+            {0, mesh.nCells()},
+            KOKKOS_LAMBDA(const NeoN::localIdx celli) {
+                uyV[celli] = 3.0 * centres[celli][1];
+                uV[celli] = NeoN::Vec3(phiV[celli], uyV[celli], 0.0);
+            }
+        );
+        NeoN::fill(u.boundaryData().value(), NeoN::zero<NeoN::Vec3>());
+        NeoN::fill(uy.boundaryData().value(), 0.0);
+
+        fvcc::GaussGreenGrad gaussGreenGrad(exec, mesh);
+        auto gradXHost = gaussGreenGrad.grad(phi).internalVector().copyToHost();
+        auto gradYHost = gaussGreenGrad.grad(uy).internalVector().copyToHost();
+        auto gradUHost = gaussGreenGrad.grad(u).copyToHost();
+        REQUIRE(gradUHost.size() == mesh.nCells());
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            const auto& gradU = gradUHost.view()[celli];
+            for (size_t i = 0; i < 3; i++)
+            {
+                const auto x = Catch::Approx(gradXHost.view()[celli][i]).margin(1e-12);
+                const auto y = Catch::Approx(gradYHost.view()[celli][i]).margin(1e-12);
+                REQUIRE(gradU(i, 0) == x);
+                REQUIRE(gradU(i, 1) == y);
+                REQUIRE(gradU(i, 2) == Catch::Approx(0.0).margin(1e-12));
+            }
+        }
+
+        // the tensor gradient is cached as well
+        auto cachedHost = gaussGreenGrad.grad(u).copyToHost();
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(cachedHost.view()[celli] == gradUHost.view()[celli]);
+        }
+    }
+}
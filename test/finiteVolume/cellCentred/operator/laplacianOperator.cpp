@@ -115,7 +115,7 @@ TEMPLATE_TEST_CASE("laplacianOperator fixedValue", "[template]", scalar, Vec3)
         {
             if constexpr (std::is_same_v<TestType, scalar>)
             {
-                ls.reset();
+                ls.resetValues();
                 dsl::SpatialOperator lapOp = dsl::imp::laplacian(gamma, phi);
                 lapOp.read(input);
                 lapOp = dsl::Coeff(-0.5) * lapOp;
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("LeastSquaresGrad")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 3, 4, 5, true);
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, volumeBCs);
+    const auto [phiV, centres] = NeoN::views(phi.internalVector(), mesh.cellCentres());
+    NeoN::parallelFor(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const NeoN::localIdx celli) {
+            phiV[celli] = centres[celli][0] + 2.0 * centres[celli][2];
+        }
+    );
+    auto [phiB, faceCentres] =
+        NeoN::views(phi.boundaryData().value(), mesh.boundaryMesh().cf());
+    NeoN::parallelFor(
+        exec,
+        {0, mesh.nBoundaryFaces()},
+        KOKKOS_LAMBDA(const NeoN::localIdx facei) {
+            phiB[facei] = faceCentres[facei][0] + 2.0 * faceCentres[facei][2];
+        }
+    );
+
+    SECTION("The gradient of a linear field is exact " + execName)
+    {
+        fvcc::LeastSquaresGrad leastSquaresGrad(exec, mesh);
+        auto gradHost = leastSquaresGrad.grad(phi).internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            const auto grad = gradHost.view()[celli];
+            REQUIRE(grad[0] == Catch::Approx(1.0));
+            REQUIRE(grad[1] == Catch::Approx(0.0).margin(1e-10));
+            REQUIRE(grad[2] == Catch::Approx(2.0));
+        }
+    }
+
+    SECTION("The inverse matrices are stored once per mesh " + execName)
+    {
+        const auto& first = fvcc::LeastSquaresMatrices::readOrCreate(mesh);
+        const auto& second = fvcc::LeastSquaresMatrices::readOrCreate(mesh);
+        REQUIRE(&first == &second);
+        REQUIRE(first.invMatrices.size() == fvcc::nPackedSymmEntries * mesh.nCells());
+    }
+}
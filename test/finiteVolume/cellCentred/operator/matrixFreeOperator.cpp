@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using Operator = NeoN::dsl::Operator;
+
+namespace NeoN
+{
+
+TEST_CASE("MatrixFreeOperator")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const std::string scheme = GENERATE(std::string("linear"), std::string("upwind"));
+
+    const localIdx nCells = 10;
+    auto mesh = create1DUniformMesh(exec, nCells);
+    const auto& sparsity = la::SparsityPattern::readOrCreate(mesh);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+
+    fvcc::SurfaceField<scalar> faceFlux(exec, "phi", mesh, surfaceBCs);
+    fill(faceFlux.internalVector(), 0.5);
+    fvcc::SurfaceField<scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    fill(gamma.internalVector(), 2.0);
+
+    std::vector<fvcc::VolumeBoundary<scalar>> bcs;
+    bcs.push_back(fvcc::VolumeBoundary<scalar>(
+        mesh, Dictionary({{"type", std::string("fixedValue")}, {"fixedValue", 1.0}}), 0
+    ));
+    bcs.push_back(fvcc::VolumeBoundary<scalar>(
+        mesh, Dictionary({{"type", std::string("fixedGradient")}, {"fixedGradient", 2.0}}), 1
+    ));
+    fvcc::VolumeField<scalar> T(exec, "T", mesh, bcs);
+    fill(T.internalVector(), 1.0);
+    T.correctBoundaryConditions();
+
+    auto coeffBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<scalar>>(mesh);
+    fvcc::VolumeField<scalar> sp(exec, "sp", mesh, coeffBCs);
+    fill(sp.internalVector(), 3.0);
+
+    Input divInput = TokenList({std::string("Gauss"), std::string(scheme)});
+    Input lapInput =
+        TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+
+    // div(phi,T) - laplacian(gamma,T) + Sp(sp,T)
+    auto eqn = dsl::Expression<scalar>(exec);
+    eqn.addOperator(fvcc::DivOperator<scalar>(Operator::Type::Implicit, faceFlux, T, divInput));
+    eqn.addOperator(
+        dsl::Coeff(-1.0)
+        * dsl::SpatialOperator<scalar>(
+            fvcc::LaplacianOperator<scalar>(Operator::Type::Implicit, gamma, T, lapInput)
+        )
+    );
+    eqn.addOperator(fvcc::SourceTerm<scalar>(Operator::Type::Implicit, sp, T));
+
+    auto ls = la::createEmptyLinearSystem<scalar, localIdx>(mesh, sparsity);
+    fvcc::FusedExpression<scalar>(eqn).implicitOperation(ls);
+    const fvcc::MatrixFreeOperator<scalar> op(eqn, 0.0);
+    REQUIRE(op.nRows() == nCells);
+
+    Vector<scalar> x(exec, nCells);
+    parallelFor(
+        x, KOKKOS_LAMBDA(const localIdx i) { return scalar(i * i); }
+    );
+
+    SECTION("Apply as the assembled matrix with " + scheme + " on " + execName)
+    {
+        Vector<scalar> expected(exec, nCells, 0.0);
+        la::spmv(ls.matrix(), x, expected);
+        Vector<scalar> y(exec, nCells, 0.0);
+        op.apply(x, y);
+
+        auto expectedHost = expected.copyToHost();
+        auto yHost = y.copyToHost();
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(yHost.view()[celli] == Catch::Approx(expectedHost.view()[celli]).margin(1e-10));
+        }
+    }
+
+    SECTION("Compute the rhs and residual of the assembled system with " + scheme + " on "
+            + execName)
+    {
+        Vector<scalar> b(exec, nCells, 0.0);
+        op.rhs(b);
+        Vector<scalar> expected(exec, nCells, 0.0);
+        la::computeResidual(ls.matrix(), ls.rhs(), x, expected);
+        Vector<scalar> res(exec, nCells, 0.0);
+        la::computeResidual(op, b, x, res);
+
+        auto bHost = b.copyToHost();
+        auto rhsHost = ls.rhs().copyToHost();
+        auto expectedHost = expected.copyToHost();
+        auto resHost = res.copyToHost();
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(bHost.view()[celli] == Catch::Approx(rhsHost.view()[celli]).margin(1e-10));
+            REQUIRE(
+                resHost.view()[celli] == Catch::Approx(expectedHost.view()[celli]).margin(1e-10)
+            );
+        }
+    }
+}
+
+} // namespace NeoN
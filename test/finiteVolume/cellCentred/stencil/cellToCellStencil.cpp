@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("CellToCellStencil")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+
+    SECTION("Face neighbours on a 1D mesh " + execName)
+    {
+        const auto& stencil = fvcc::CellToCellStencil::readOrCreate(mesh);
+        auto stencilHost = stencil.copyToHost();
+        auto [values, segments] = stencilHost.views();
+
+        REQUIRE(stencil.numSegments() == nCells);
+        REQUIRE(stencil.size() == 2 * (nCells - 1));
+        REQUIRE(values[segments[0]] == 1);
+        for (NeoN::localIdx celli = 1; celli < nCells - 1; celli++)
+        {
+            REQUIRE(segments[celli + 1] - segments[celli] == 2);
+            REQUIRE(values[segments[celli]] == celli - 1);
+            REQUIRE(values[segments[celli] + 1] == celli + 1);
+        }
+        REQUIRE(mesh.stencilDB().contains("CellToCellStencil"));
+    }
+
+    SECTION("Second ring on a 1D mesh " + execName)
+    {
+        const auto& stencil = fvcc::CellToCellStencil::readOrCreateExtended(mesh);
+        auto stencilHost = stencil.copyToHost();
+        auto [values, segments] = stencilHost.views();
+
+        REQUIRE(stencil.numSegments() == nCells);
+        for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+        {
+            // the neighbours within a distance of two cells in ascending order
+            std::vector<NeoN::localIdx> expected;
+            for (auto nei = std::max<NeoN::localIdx>(celli, 2) - 2;
+                 nei <= std::min<NeoN::localIdx>(celli + 2, nCells - 1);
+                 nei++)
+            {
+                if (nei != celli)
+                {
+                    expected.push_back(nei);
+                }
+            }
+            REQUIRE(segments[celli + 1] - segments[celli] == NeoN::localIdx(expected.size()));
+            for (std::size_t i = 0; i < expected.size(); i++)
+            {
+                REQUIRE(values[segments[celli] + NeoN::localIdx(i)] == expected[i]);
+            }
+        }
+    }
+
+    SECTION("Second ring on a 3D mesh " + execName)
+    {
+        auto mesh3D = NeoN::create3DUniformMesh(exec, 3, 3, 3, true);
+        const auto& stencil = fvcc::CellToCellStencil::readOrCreateExtended(mesh3D);
+        auto stencilHost = stencil.copyToHost();
+        auto [values, segments] = stencilHost.views();
+
+        // the centre cell reaches all other cells except the eight corners
+        NeoN::localIdx maxSize = 0;
+        for (NeoN::localIdx celli = 0; celli < mesh3D.nCells(); celli++)
+        {
+            maxSize = std::max(maxSize, segments[celli + 1] - segments[celli]);
+            for (auto i = segments[celli] + 1; i < segments[celli + 1]; i++)
+            {
+                REQUIRE(values[i - 1] < values[i]);
+            }
+        }
+        REQUIRE(maxSize == 27 - 1 - 8);
+    }
+}
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::localIdx;
+
+TEST_CASE("CompressedConnectivity")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // the randomly ordered cells are connected by differences of up to the full cell range
+    auto mesh = NeoN::create3DUniformMesh(exec, 3, 4, 5, true);
+    REQUIRE(fvcc::CompressedConnectivity::compressible(mesh));
+    const auto& conn = fvcc::CompressedConnectivity::readOrCreate(mesh);
+    const auto nInternalFaces = mesh.nInternalFaces();
+
+    SECTION("Decompress the owner and neighbour " + execName)
+    {
+        REQUIRE(conn.width() == fvcc::DeltaWidth::Bits16);
+        REQUIRE(conn.nCells() == mesh.nCells());
+        REQUIRE(
+            conn.memoryBytes() < mesh.faceOwner().memoryBytes() + mesh.faceNeighbour().memoryBytes()
+        );
+
+        NeoN::Vector<localIdx> owners(exec, 0);
+        NeoN::Vector<localIdx> neighbours(exec, 0);
+        conn.decompress(owners, neighbours);
+
+        auto [ownerHost, neighbourHost, ownersHost, neighboursHost] =
+            NeoN::copyToHosts(mesh.faceOwner(), mesh.faceNeighbour(), owners, neighbours);
+        REQUIRE(ownersHost.size() == nInternalFaces);
+        for (localIdx facei = 0; facei < nInternalFaces; facei++)
+        {
+            REQUIRE(ownersHost.view()[facei] == static_cast<localIdx>(ownerHost.view()[facei]));
+            REQUIRE(
+                neighboursHost.view()[facei] == static_cast<localIdx>(neighbourHost.view()[facei])
+            );
+        }
+    }
+
+    SECTION("Decode the owner of a face in a face loop " + execName)
+    {
+        const auto view = conn.view<fvcc::DeltaWidth::Bits16>();
+        NeoN::Vector<localIdx> owners(exec, nInternalFaces);
+        NeoN::Vector<localIdx> neighbours(exec, nInternalFaces);
+        auto [ownersV, neighboursV] = NeoN::views(owners, neighbours);
+        NeoN::parallelFor(
+            exec,
+            {0, nInternalFaces},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                ownersV[facei] = view.owner(facei);
+                neighboursV[facei] = view.neighbour(facei, ownersV[facei]);
+            }
+        );
+
+        auto [ownerHost, neighbourHost, ownersHost, neighboursHost] =
+            NeoN::copyToHosts(mesh.faceOwner(), mesh.faceNeighbour(), owners, neighbours);
+        for (localIdx facei = 0; facei < nInternalFaces; facei++)
+        {
+            REQUIRE(ownersHost.view()[facei] == static_cast<localIdx>(ownerHost.view()[facei]));
+            REQUIRE(
+                neighboursHost.view()[facei] == static_cast<localIdx>(neighbourHost.view()[facei])
+            );
+        }
+    }
+
+    SECTION("Count the internal faces of every cell " + execName)
+    {
+        NeoN::Vector<localIdx> count(exec, mesh.nCells(), 0);
+        auto countV = count.view();
+        fvcc::compressedParallelFor(
+            exec,
+            conn,
+            KOKKOS_LAMBDA(const localIdx, const localIdx own, const localIdx nei) {
+                Kokkos::atomic_add(&countV[own], localIdx(1));
+                Kokkos::atomic_add(&countV[nei], localIdx(1));
+            }
+        );
+
+        // the boundary faces complete every cell of the hexahedral mesh to six faces
+        auto [countHost, faceCellsHost] =
+            NeoN::copyToHosts(count, mesh.boundaryMesh().faceCells());
+        std::vector<localIdx> faces(static_cast<size_t>(mesh.nCells()), 0);
+        for (localIdx bfacei = 0; bfacei < mesh.nBoundaryFaces(); bfacei++)
+        {
+            faces[static_cast<size_t>(faceCellsHost.view()[bfacei])]++;
+        }
+        for (localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(countHost.view()[celli] + faces[static_cast<size_t>(celli)] == 6);
+        }
+    }
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::localIdx;
+
+TEST_CASE("FaceRanges")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nFaces = nInternalFaces + mesh.nBoundaryFaces();
+
+    SECTION("Internal and boundary faces are visited once " + execName)
+    {
+        NeoN::Vector<localIdx> visits(exec, nFaces, 0);
+        NeoN::Vector<localIdx> boundaryFaces(exec, mesh.nBoundaryFaces(), -1);
+        auto [visitsV, boundaryV] = NeoN::views(visits, boundaryFaces);
+        fvcc::parallelForFaces(
+            exec,
+            mesh,
+            KOKKOS_LAMBDA(const localIdx facei) { visitsV[facei] += 1; },
+            KOKKOS_LAMBDA(const localIdx facei, const localIdx bfacei) {
+                visitsV[facei] += 10;
+                boundaryV[bfacei] = facei;
+            }
+        );
+
+        auto [visitsHost, boundaryHost] = NeoN::copyToHosts(visits, boundaryFaces);
+        for (localIdx facei = 0; facei < nFaces; facei++)
+        {
+            REQUIRE(visitsHost.view()[facei] == (facei < nInternalFaces ? 1 : 10));
+        }
+        for (localIdx bfacei = 0; bfacei < mesh.nBoundaryFaces(); bfacei++)
+        {
+            REQUIRE(boundaryHost.view()[bfacei] == nInternalFaces + bfacei);
+        }
+    }
+
+    SECTION("Patch ranges follow the boundary offsets " + execName)
+    {
+        const auto& offset = mesh.boundaryMesh().offset();
+        NeoN::Vector<localIdx> patch(exec, mesh.nBoundaryFaces(), -1);
+        auto patchV = patch.view();
+        for (localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            fvcc::parallelForPatchFaces(
+                exec,
+                mesh,
+                patchi,
+                KOKKOS_LAMBDA(const localIdx, const localIdx bfacei) { patchV[bfacei] = patchi; }
+            );
+        }
+
+        auto patchHost = patch.copyToHost();
+        for (localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            const auto pi = static_cast<size_t>(patchi);
+            for (localIdx bfacei = offset[pi]; bfacei < offset[pi + 1]; bfacei++)
+            {
+                REQUIRE(patchHost.view()[bfacei] == patchi);
+            }
+        }
+    }
+}
@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <filesystem>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("FaceReduction")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+
+    SECTION("Face coloring has no shared cells " + execName)
+    {
+        const auto& coloring = fvcc::FaceColoring::readOrCreate(mesh);
+
+        // on a 1D mesh even and odd internal faces form the two colors
+        const auto& internal = coloring.internalFaces();
+        REQUIRE(internal.nColors() == 2);
+        REQUIRE(internal.offsets == std::vector<NeoN::localIdx> {0, 5, 9});
+        auto internalFacesH = internal.faces.copyToHost();
+        auto internalFaces = internalFacesH.view();
+        for (NeoN::localIdx i = 0; i < 5; i++)
+        {
+            REQUIRE(internalFaces[i] == 2 * i);
+        }
+        for (NeoN::localIdx i = 5; i < 9; i++)
+        {
+            REQUIRE(internalFaces[i] == 2 * (i - 5) + 1);
+        }
+
+        // both boundary faces belong to different cells
+        const auto& boundary = coloring.boundaryFaces();
+        REQUIRE(boundary.nColors() == 1);
+        REQUIRE(boundary.offsets == std::vector<NeoN::localIdx> {0, 2});
+
+        REQUIRE(mesh.stencilDB().contains("FaceColoring"));
+    }
+
+    SECTION("Face blocking keeps the faces of a block together " + execName)
+    {
+        // the blocks hold the cells 0-3, 4-7 and 8-9
+        const fvcc::FaceBlocking blocking(mesh, 4);
+        REQUIRE(blocking.nBlocks() == 3);
+        REQUIRE(blocking.nBlockFaces() == 9);
+        REQUIRE(blocking.faces().size() == 11);
+
+        // internal face i joins cell i and i + 1, the boundary faces 9 and 10 belong to the
+        // cells 0 and 9, the faces 3 and 7 join two blocks
+        auto facesH = blocking.faces().copyToHost();
+        auto offsetsH = blocking.blockOffsets().copyToHost();
+        REQUIRE(
+            std::vector<NeoN::localIdx>(facesH.view().begin(), facesH.view().end())
+            == std::vector<NeoN::localIdx> {0, 1, 2, 9, 4, 5, 6, 8, 10, 3, 7}
+        );
+        REQUIRE(
+            std::vector<NeoN::localIdx>(offsetsH.view().begin(), offsetsH.view().end())
+            == std::vector<NeoN::localIdx> {0, 4, 7, 9}
+        );
+    }
+
+    SECTION("Reduction strategies agree " + execName)
+    {
+        auto faceValue = KOKKOS_LAMBDA(const NeoN::localIdx) { return 1.0; };
+
+        NeoN::Vector<NeoN::scalar> atomicRes(exec, nCells, 0.0);
+        NeoN::Vector<NeoN::scalar> gatherRes(exec, nCells, 0.0);
+        NeoN::Vector<NeoN::scalar> coloredRes(exec, nCells, 0.0);
+        NeoN::Vector<NeoN::scalar> blockedRes(exec, nCells, 0.0);
+        NeoN::Vector<NeoN::scalar> reducedRes(exec, nCells, 0.0);
+
+        fvcc::atomicFaceValues(mesh, atomicRes.view(), faceValue, true);
+        fvcc::gatherFaceValues(mesh, gatherRes.view(), faceValue, true);
+        fvcc::coloredFaceValues(mesh, coloredRes.view(), faceValue, true);
+        fvcc::blockedFaceValues(mesh, blockedRes.view(), faceValue, true);
+        fvcc::reduceFaceValues(mesh, reducedRes.view(), faceValue, true);
+
+        // owner and boundary faces add, neighbour faces subtract
+        NeoN::Vector<NeoN::scalar> expected(
+            exec, std::vector<NeoN::scalar> {2.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}
+        );
+        REQUIRE(equal(atomicRes, expected));
+        REQUIRE(equal(gatherRes, expected));
+        REQUIRE(equal(coloredRes, expected));
+        REQUIRE(equal(blockedRes, expected));
+        REQUIRE(equal(reducedRes, expected));
+
+        NeoN::Vector<NeoN::scalar> symRes(exec, nCells, 0.0);
+        fvcc::reduceFaceValues(mesh, symRes.view(), faceValue, false);
+        // every cell has two faces
+        REQUIRE(equal(symRes, 2.0));
+    }
+
+    SECTION("Hex meshes use the uniform gather " + execName)
+    {
+        REQUIRE(fvcc::CellToFaceStencil::uniformSegmentSize(mesh) == 2);
+
+        auto hex = NeoN::create3DUniformMesh(exec, 3, 4, 2, true);
+        REQUIRE(fvcc::CellToFaceStencil::uniformSegmentSize(hex) == 6);
+        REQUIRE(hex.stencilDB().contains("CellToFaceStencilUniformSegmentSize"));
+        const auto n = hex.nCells();
+        auto faceValue = KOKKOS_LAMBDA(const NeoN::localIdx facei)
+        {
+            return static_cast<NeoN::scalar>(facei % 5) - 2.0;
+        };
+
+        for (const bool antisymmetric : {true, false})
+        {
+            NeoN::Vector<NeoN::scalar> atomicRes(exec, n, 1.0);
+            NeoN::Vector<NeoN::scalar> gatherRes(exec, n, 1.0);
+            fvcc::atomicFaceValues(hex, atomicRes.view(), faceValue, antisymmetric);
+            fvcc::gatherFaceValues(hex, gatherRes.view(), faceValue, antisymmetric);
+            REQUIRE(equal(gatherRes, atomicRes));
+        }
+    }
+
+    SECTION("Structured reduction agrees with the gather " + execName)
+    {
+        auto structured = NeoN::create3DUniformMesh(exec, 3, 4, 2);
+        REQUIRE(structured.structured());
+        const auto n = structured.nCells();
+        auto faceValue = KOKKOS_LAMBDA(const NeoN::localIdx facei)
+        {
+            return static_cast<NeoN::scalar>(facei % 7) - 3.0;
+        };
+
+        for (const bool antisymmetric : {true, false})
+        {
+            NeoN::Vector<NeoN::scalar> gatherRes(exec, n, 1.0);
+            NeoN::Vector<NeoN::scalar> structuredRes(exec, n, 1.0);
+            fvcc::gatherFaceValues(structured, gatherRes.view(), faceValue, antisymmetric);
+            fvcc::structuredFaceValues(
+                structured, structuredRes.view(), faceValue, antisymmetric, fvcc::UnitCellScale {}
+            );
+            REQUIRE(equal(structuredRes, gatherRes));
+        }
+
+        // the random cell order removes the block structure
+        auto unstructured = NeoN::create3DUniformMesh(exec, 3, 4, 2, true);
+        REQUIRE(!unstructured.structured());
+        REQUIRE(fvcc::faceReduction(unstructured) == fvcc::faceReduction(exec));
+    }
+
+    SECTION("Tuner selects a strategy and caches it " + execName)
+    {
+        auto& tuner = fvcc::FaceReductionTuner::instance();
+        const std::string cacheFile = "faceReductionTuner_" + execName + ".txt";
+        std::filesystem::remove(cacheFile);
+        tuner.clear();
+        tuner.enable(2, cacheFile);
+        auto faceValue = KOKKOS_LAMBDA(const NeoN::localIdx) { return 1.0; };
+
+        // two trials of each candidate, the blocked loop is no candidate on a device
+        const auto candidates = fvcc::faceReductionCandidates(mesh);
+        const bool device = std::holds_alternative<NeoN::GPUExecutor>(exec);
+        REQUIRE(candidates.size() == (device ? 3 : 4));
+        for (std::size_t call = 0; call < 2 * candidates.size(); call++)
+        {
+            REQUIRE(!tuner.selected(mesh, "reduce", typeid(NeoN::scalar)));
+            NeoN::Vector<NeoN::scalar> res(exec, nCells, 0.0);
+            {
+                fvcc::FaceReductionTuning tuning(mesh, "reduce", typeid(NeoN::scalar));
+                REQUIRE(fvcc::faceReduction(mesh) == candidates[call / 2]);
+                fvcc::reduceFaceValues(mesh, res.view(), faceValue, false);
+            }
+            REQUIRE(!tuner.active());
+            REQUIRE(equal(res, 2.0));
+        }
+        const auto selected = tuner.selected(mesh, "reduce", typeid(NeoN::scalar));
+        REQUIRE(selected);
+
+        // a later run reads the choice from the cache file
+        tuner.clear();
+        tuner.enable(2, cacheFile);
+        REQUIRE(tuner.selected(mesh, "reduce", typeid(NeoN::scalar)) == selected);
+        {
+            fvcc::FaceReductionTuning tuning(mesh, "reduce", typeid(NeoN::scalar));
+            REQUIRE(fvcc::faceReduction(mesh) == *selected);
+        }
+
+        tuner.disable();
+        tuner.clear();
+        REQUIRE(fvcc::faceReduction(mesh) == fvcc::faceReduction(exec));
+        std::filesystem::remove(cacheFile);
+    }
+}
+
+/* a single cell with nFaces boundary faces in a single patch, eg. a polyhedron */
+NeoN::UnstructuredMesh createPolyhedralCellMesh(const NeoN::Executor& exec, NeoN::localIdx nFaces)
+{
+    using NeoN::localIdx;
+    NeoN::vectorVector faceVectors(exec, nFaces, NeoN::Vec3 {1.0, 0.0, 0.0});
+    NeoN::scalarVector magFaceAreas(exec, nFaces, 1.0);
+    NeoN::BoundaryMesh boundaryMesh(
+        exec,
+        {exec, nFaces, NeoN::label(0)},   // faceCells
+        faceVectors,                      // cf
+        faceVectors,                      // cn
+        faceVectors,                      // sf
+        magFaceAreas,                     // magSf
+        faceVectors,                      // nf
+        faceVectors,                      // delta
+        {exec, nFaces, 1.0},              // weights
+        {exec, nFaces, 1.0},              // deltaCoeffs
+        std::vector<localIdx> {0, nFaces} // offset
+    );
+    return NeoN::UnstructuredMesh(
+        {exec, {{0, 0, 0}}},            // points
+        {exec, 1, 1.0},                 // cellVolumes
+        {exec, {{0.0, 0.0, 0.0}}},      // cellCentres
+        faceVectors,                    // faceAreas
+        faceVectors,                    // faceCentres
+        magFaceAreas,                   // magFaceAreas
+        {exec, nFaces, NeoN::label(0)}, // faceOwner
+        {exec, {}},                     // faceNeighbour
+        1,                              // nCells
+        0,                              // nInternalFaces
+        nFaces,                         // nBoundaryFaces
+        1,                              // nBoundaries
+        nFaces,                         // nFaces
+        boundaryMesh
+    );
+}
+
+TEST_CASE("FaceReduction - cells with many faces")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // all faces share the cell, hence every face needs its own color
+    const NeoN::localIdx nFaces = 2 * fvcc::ColoredFaces::maxColors + 3;
+    auto mesh = createPolyhedralCellMesh(exec, nFaces);
+
+    SECTION("The coloring grows beyond the colors of a word " + execName)
+    {
+        const auto& coloring = fvcc::FaceColoring::readOrCreate(mesh);
+        const auto& boundary = coloring.boundaryFaces();
+        REQUIRE(boundary.nColors() == nFaces);
+        REQUIRE(!boundary.efficient());
+        REQUIRE(!coloring.efficient());
+        REQUIRE(!fvcc::coloredFaceLoops(mesh));
+        REQUIRE(fvcc::faceReduction(mesh) != fvcc::FaceReduction::Coloring);
+    }
+
+    SECTION("The reduction falls back to the scatter " + execName)
+    {
+        auto faceValue = KOKKOS_LAMBDA(const NeoN::localIdx) { return 1.0; };
+        NeoN::Vector<NeoN::scalar> reducedRes(exec, 1, 0.0);
+        NeoN::Vector<NeoN::scalar> coloredRes(exec, 1, 0.0);
+        fvcc::reduceFaceValues(mesh, reducedRes.view(), faceValue, true);
+        fvcc::coloredFaceValues(mesh, coloredRes.view(), faceValue, true);
+        REQUIRE(equal(reducedRes, NeoN::scalar(nFaces)));
+        REQUIRE(equal(coloredRes, NeoN::scalar(nFaces)));
+    }
+}
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("GeometryScheme")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx nCells = 4;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+
+    SECTION("Weights are cached and recomputed after mesh motion " + execName)
+    {
+        auto scheme = fvcc::GeometryScheme::readOrCreate(mesh);
+        REQUIRE(fvcc::GeometryScheme::readOrCreate(mesh) == scheme);
+        REQUIRE_FALSE(scheme->upToDate());
+
+        auto weightsHost = scheme->weights().internalVector().copyToHost();
+        REQUIRE(scheme->upToDate());
+        REQUIRE(weightsHost.view()[0] == Catch::Approx(0.5));
+
+        // move the centre of the first cell towards its right face
+        auto cellCentresHost = mesh.cellCentres().copyToHost();
+        cellCentresHost.view()[0] = NeoN::Vec3(0.2, 0.0, 0.0);
+        mesh.updateGeometry(
+            mesh.points(),
+            mesh.cellVolumes(),
+            NeoN::vectorVector(exec, cellCentresHost),
+            mesh.faceAreas(),
+            mesh.faceCentres(),
+            mesh.magFaceAreas()
+        );
+        REQUIRE(mesh.geometryVersion() == 1);
+        REQUIRE_FALSE(scheme->upToDate());
+
+        // the shared scheme sees the new geometry, the first face is at x = 0.25
+        weightsHost = scheme->weights().internalVector().copyToHost();
+        REQUIRE(scheme->upToDate());
+        REQUIRE(weightsHost.view()[0] == Catch::Approx(0.125 / 0.175));
+        REQUIRE(weightsHost.view()[1] == Catch::Approx(0.5));
+    }
+}
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("StencilDataBase")
+{
+    NeoN::StencilDataBase stencilDb;
+
+    SECTION("getOrCreate builds the value only once")
+    {
+        static const NeoN::StencilKey<int> key("answer");
+        int nCalls = 0;
+        auto builder = [&]()
+        {
+            nCalls++;
+            return 42;
+        };
+        int& value = stencilDb.getOrCreate(key, builder);
+        REQUIRE(value == 42);
+        REQUIRE(stencilDb.contains("answer"));
+        REQUIRE(stencilDb.get<int>("answer") == 42);
+
+        value = 7;
+        REQUIRE(&stencilDb.getOrCreate(key, builder) == &value);
+        REQUIRE(stencilDb.getOrCreate(key, builder) == 7);
+        REQUIRE(nCalls == 1);
+    }
+
+    SECTION("getOrCreate finds values inserted by name")
+    {
+        static const NeoN::StencilKey<std::string> key("name");
+        stencilDb.insert(std::string("name"), std::string("inserted"));
+        REQUIRE(stencilDb.getOrCreate(key, []() { return std::string("built"); }) == "inserted");
+    }
+
+    SECTION("copies do not share cached entries")
+    {
+        static const NeoN::StencilKey<int> key("copied");
+        stencilDb.getOrCreate(key, []() { return 1; });
+        NeoN::StencilDataBase copy(stencilDb);
+        copy.getOrCreate(key, []() { return 2; }) = 3;
+        REQUIRE(stencilDb.getOrCreate(key, []() { return 2; }) == 1);
+        REQUIRE(copy.get<int>("copied") == 3);
+    }
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <filesystem>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::Vec3;
+using NeoN::Vector;
+
+TEST_CASE("Adios2")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const std::string fileName = "adios2_" + execName + ".bp";
+    auto mesh = NeoN::create1DUniformMesh(exec, 10);
+    Vector<scalar> p(exec, 10, 2.0);
+    Vector<Vec3> u(exec, 10, Vec3(1.0, 2.0, 3.0));
+
+    SECTION("Write and read " + execName)
+    {
+        {
+#ifdef NF_WITH_MPI_SUPPORT
+            NeoN::io::Adios2Writer writer(fileName, NeoN::mpi::MPIEnvironment());
+#else
+            NeoN::io::Adios2Writer writer(fileName);
+#endif
+            writer.beginStep();
+            writer.put(mesh);
+            writer.put("p", p);
+            writer.put("U", u);
+            writer.endStep();
+
+            NeoN::fill(p, 3.0);
+            writer.beginStep();
+            writer.put("p", p);
+            writer.endStep();
+        }
+
+#ifdef NF_WITH_MPI_SUPPORT
+        NeoN::io::Adios2Reader reader(fileName, NeoN::mpi::MPIEnvironment());
+#else
+        NeoN::io::Adios2Reader reader(fileName);
+#endif
+        REQUIRE(reader.beginStep());
+        auto readMesh = reader.getMesh(exec);
+        Vector<scalar> readP(exec, 0);
+        Vector<Vec3> readU(exec, 0);
+        reader.get("p", readP);
+        reader.get("U", readU);
+        reader.endStep();
+
+        REQUIRE(readMesh.nCells() == mesh.nCells());
+        REQUIRE(readMesh.nFaces() == mesh.nFaces());
+        REQUIRE(readMesh.boundaryMesh().offset() == mesh.boundaryMesh().offset());
+        auto centres = mesh.cellCentres().copyToHost();
+        auto readCentres = readMesh.cellCentres().copyToHost();
+        auto readPHost = readP.copyToHost();
+        auto readUHost = readU.copyToHost();
+        REQUIRE(readP.size() == 10);
+        for (localIdx celli = 0; celli < 10; celli++)
+        {
+            REQUIRE(readCentres.view()[celli] == centres.view()[celli]);
+            REQUIRE(readPHost.view()[celli] == 2.0);
+            REQUIRE(readUHost.view()[celli] == Vec3(1.0, 2.0, 3.0));
+        }
+
+        REQUIRE(reader.beginStep());
+        reader.get("p", readP);
+        reader.endStep();
+        REQUIRE(readP.copyToHost().view()[0] == 3.0);
+        REQUIRE(!reader.beginStep());
+    }
+
+    SECTION("Write through a burst buffer " + execName)
+    {
+        const std::string stagingPath = "adios2_staging_" + execName;
+        std::filesystem::create_directories(stagingPath);
+        NeoN::io::Adios2Options options {.burstBufferPath = stagingPath};
+        {
+#ifdef NF_WITH_MPI_SUPPORT
+            NeoN::io::Adios2Writer writer(fileName, NeoN::mpi::MPIEnvironment(), options);
+#else
+            NeoN::io::Adios2Writer writer(fileName, options);
+#endif
+            writer.beginStep();
+            writer.put("p", p);
+            writer.endStep();
+        }
+
+        // the staged file is drained to the final path on close
+#ifdef NF_WITH_MPI_SUPPORT
+        NeoN::io::Adios2Reader reader(fileName, NeoN::mpi::MPIEnvironment());
+#else
+        NeoN::io::Adios2Reader reader(fileName);
+#endif
+        REQUIRE(reader.beginStep());
+        Vector<scalar> readP(exec, 0);
+        reader.get("p", readP);
+        reader.endStep();
+        REQUIRE(readP.copyToHost().view()[0] == 2.0);
+    }
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::localIdx;
+
+template<typename ValueType>
+void requireEqual(const NeoN::Vector<ValueType>& a, const NeoN::Vector<ValueType>& b)
+{
+    REQUIRE(a.size() == b.size());
+    auto aHost = a.copyToHost();
+    auto bHost = b.copyToHost();
+    for (localIdx i = 0; i < a.size(); i++)
+    {
+        REQUIRE(aHost.view()[i] == bHost.view()[i]);
+    }
+}
+
+TEST_CASE("BinaryMesh")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 3, 2, 2, true);
+
+    SECTION("Write and read " + execName)
+    {
+        const auto fileName = NeoN::io::binaryMeshFileName("binaryMesh_" + execName, 0);
+        NeoN::io::writeBinaryMesh(fileName, mesh);
+        auto readMesh = NeoN::io::readBinaryMesh(exec, fileName);
+
+        REQUIRE(readMesh.nCells() == mesh.nCells());
+        REQUIRE(readMesh.nInternalFaces() == mesh.nInternalFaces());
+        REQUIRE(readMesh.nBoundaryFaces() == mesh.nBoundaryFaces());
+        REQUIRE(readMesh.nBoundaries() == mesh.nBoundaries());
+        REQUIRE(readMesh.nFaces() == mesh.nFaces());
+        requireEqual(readMesh.points(), mesh.points());
+        requireEqual(readMesh.cellVolumes(), mesh.cellVolumes());
+        requireEqual(readMesh.cellCentres(), mesh.cellCentres());
+        requireEqual(readMesh.faceAreas(), mesh.faceAreas());
+        requireEqual(readMesh.faceCentres(), mesh.faceCentres());
+        requireEqual(readMesh.magFaceAreas(), mesh.magFaceAreas());
+        requireEqual(readMesh.faceOwner(), mesh.faceOwner());
+        requireEqual(readMesh.faceNeighbour(), mesh.faceNeighbour());
+
+        const auto& bMesh = mesh.boundaryMesh();
+        const auto& readBMesh = readMesh.boundaryMesh();
+        REQUIRE(readBMesh.offset() == bMesh.offset());
+        requireEqual(readBMesh.faceCells(), bMesh.faceCells());
+        requireEqual(readBMesh.cf(), bMesh.cf());
+        requireEqual(readBMesh.cn(), bMesh.cn());
+        requireEqual(readBMesh.sf(), bMesh.sf());
+        requireEqual(readBMesh.magSf(), bMesh.magSf());
+        requireEqual(readBMesh.nf(), bMesh.nf());
+        requireEqual(readBMesh.delta(), bMesh.delta());
+        requireEqual(readBMesh.weights(), bMesh.weights());
+        requireEqual(readBMesh.deltaCoeffs(), bMesh.deltaCoeffs());
+    }
+
+    SECTION("Decomposed mesh " + execName)
+    {
+        const localIdx nParts = 2;
+        auto cellToPart = NeoN::partitionCells(mesh, nParts);
+        for (localIdx part = 0; part < nParts; part++)
+        {
+            auto decomposed = NeoN::decomposeMesh(mesh, cellToPart, static_cast<NeoN::label>(part));
+            const auto fileName = NeoN::io::binaryMeshFileName(
+                "binaryMeshDecomposed_" + execName, static_cast<std::size_t>(part)
+            );
+            NeoN::io::writeBinaryMesh(fileName, decomposed.mesh);
+            auto readMesh = NeoN::io::readBinaryMesh(exec, fileName);
+            REQUIRE(readMesh.nCells() == decomposed.mesh.nCells());
+            REQUIRE(readMesh.boundaryMesh().offset() == decomposed.mesh.boundaryMesh().offset());
+            requireEqual(readMesh.cellCentres(), decomposed.mesh.cellCentres());
+            requireEqual(readMesh.faceOwner(), decomposed.mesh.faceOwner());
+        }
+    }
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "../dsl/common.hpp"
+
+#include "NeoN/NeoN.hpp"
+#include "NeoN/io/checkpoint.hpp"
+
+using NeoN::scalar;
+
+scalar cellValue(const VolumeField& field) { return field.internalVector().copyToHost().view()[0]; }
+
+TEST_CASE("Checkpoint")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const std::string prefix = "checkpoint_" + execName;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    // compression requires ADIOS2 with Blosc2, which is optional
+    NeoN::io::CheckpointOptions options {.io = {.compression = ""}, .nOldTimeLevels = 1};
+
+    SECTION("Restore the latest checkpoint " + execName)
+    {
+        {
+            NeoN::Database db;
+            auto& fieldCollection = fvcc::VectorCollection::instance(db, "fieldCollection");
+            auto& t = fieldCollection.registerVector<VolumeField>(
+                CreateVector {.name = "T", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+            );
+            auto& t0 = fvcc::oldTime(t);
+            auto& t00 = fvcc::oldTime(t0);
+            NeoN::fill(t00.internalVector(), 5.0);
+
+#ifdef NF_WITH_MPI_SUPPORT
+            NeoN::io::CheckpointWriter writer(prefix, mesh, NeoN::mpi::MPIEnvironment(), options);
+#else
+            NeoN::io::CheckpointWriter writer(prefix, mesh, options);
+#endif
+            writer.write(fieldCollection, 0.1);
+            NeoN::fill(t.internalVector(), 3.0);
+            NeoN::fill(t0.internalVector(), 2.0);
+            fieldCollection.fieldDoc(t.key).timeIndex() = 2;
+            writer.write(fieldCollection, 0.2);
+            REQUIRE(writer.nCheckpoints() == 2);
+        }
+
+        NeoN::Database db;
+        auto& fieldCollection = fvcc::VectorCollection::instance(db, "fieldCollection");
+        auto& t = fieldCollection.registerVector<VolumeField>(
+            CreateVector {.name = "T", .mesh = mesh, .value = 0.0}
+        );
+        auto& t0 = fvcc::oldTime(t);
+        auto& t00 = fvcc::oldTime(t0);
+
+#ifdef NF_WITH_MPI_SUPPORT
+        NeoN::io::CheckpointReader reader(prefix, NeoN::mpi::MPIEnvironment());
+#else
+        NeoN::io::CheckpointReader reader(prefix);
+#endif
+        REQUIRE(reader.time() == 0.2);
+        REQUIRE(reader.readMesh(exec).nCells() == mesh.nCells());
+        // the second old time level is not required, hence it is not stored
+        REQUIRE(reader.restore(fieldCollection) == 2);
+        REQUIRE(cellValue(t) == 3.0);
+        REQUIRE(cellValue(t0) == 2.0);
+        REQUIRE(cellValue(t00) == 0.0);
+        REQUIRE(fieldCollection.fieldDoc(t.key).timeIndex() == 2);
+    }
+}
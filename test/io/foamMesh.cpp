@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::localIdx;
+using NeoN::scalar;
+using NeoN::Vec3;
+
+namespace
+{
+
+void writeHeader(std::ofstream& file, bool binary, const std::string& cls, const std::string& obj)
+{
+    file << "/*--------------------------------*- C++ -*----------------------------------*\\\n"
+         << "\\*---------------------------------------------------------------------------*/\n"
+         << "FoamFile\n{\n    version     2.0;\n    format      " << (binary ? "binary" : "ascii")
+         << ";\n    arch        \"LSB;label=32;scalar=64\";\n    class       " << cls
+         << ";\n    location    \"constant/polyMesh\";\n    object      " << obj << ";\n}\n"
+         << "// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //\n\n";
+}
+
+template<typename ValueType>
+void writeBinary(std::ofstream& file, const std::vector<ValueType>& values, std::size_t nCmpts = 1)
+{
+    file << values.size() / nCmpts << "\n(";
+    file.write(
+        reinterpret_cast<const char*>(values.data()),
+        static_cast<std::streamsize>(values.size() * sizeof(ValueType))
+    );
+    file << ")\n";
+}
+
+/* @brief writes two unit cubes next to each other in x direction */
+void writePolyMesh(const std::filesystem::path& dir, bool binary)
+{
+    std::filesystem::create_directories(dir);
+
+    std::vector<double> points;
+    for (int k = 0; k < 2; k++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                points.insert(points.end(), {double(i), double(j), double(k)});
+            }
+        }
+    }
+    const auto p = [](int i, int j, int k) { return std::int32_t(i + 3 * (j + 2 * k)); };
+    std::vector<std::vector<std::int32_t>> faces {
+        {p(1, 0, 0), p(1, 1, 0), p(1, 1, 1), p(1, 0, 1)}, // internal
+        {p(0, 0, 0), p(0, 0, 1), p(0, 1, 1), p(0, 1, 0)}, // inlet
+        {p(2, 0, 0), p(2, 1, 0), p(2, 1, 1), p(2, 0, 1)}  // walls
+    };
+    std::vector<std::int32_t> owner {0, 0, 1};
+    for (int c = 0; c < 2; c++)
+    {
+        faces.push_back({p(c, 0, 0), p(c + 1, 0, 0), p(c + 1, 0, 1), p(c, 0, 1)});
+        faces.push_back({p(c, 1, 0), p(c, 1, 1), p(c + 1, 1, 1), p(c + 1, 1, 0)});
+        faces.push_back({p(c, 0, 0), p(c, 1, 0), p(c + 1, 1, 0), p(c + 1, 0, 0)});
+        faces.push_back({p(c, 0, 1), p(c + 1, 0, 1), p(c + 1, 1, 1), p(c, 1, 1)});
+        owner.insert(owner.end(), {c, c, c, c});
+    }
+    const std::vector<std::int32_t> neighbour {1};
+
+    std::ofstream pointsFile(dir / "points", std::ios::binary);
+    writeHeader(pointsFile, binary, "vectorField", "points");
+    std::ofstream facesFile(dir / "faces", std::ios::binary);
+    std::ofstream ownerFile(dir / "owner", std::ios::binary);
+    writeHeader(ownerFile, binary, "labelList", "owner");
+    std::ofstream neighbourFile(dir / "neighbour", std::ios::binary);
+    writeHeader(neighbourFile, binary, "labelList", "neighbour");
+    if (binary)
+    {
+        writeBinary(pointsFile, points, 3);
+        writeHeader(facesFile, binary, "faceCompactList", "faces");
+        std::vector<std::int32_t> offsets {0};
+        std::vector<std::int32_t> facePoints;
+        for (const auto& face : faces)
+        {
+            facePoints.insert(facePoints.end(), face.begin(), face.end());
+            offsets.push_back(static_cast<std::int32_t>(facePoints.size()));
+        }
+        writeBinary(facesFile, offsets);
+        writeBinary(facesFile, facePoints);
+        writeBinary(ownerFile, owner);
+        writeBinary(neighbourFile, neighbour);
+    }
+    else
+    {
+        pointsFile << points.size() / 3 << "\n(\n";
+        for (std::size_t i = 0; i < points.size(); i += 3)
+        {
+            pointsFile << "(" << points[i] << " " << points[i + 1] << " " << points[i + 2] << ")\n";
+        }
+        pointsFile << ")\n";
+        writeHeader(facesFile, binary, "faceList", "faces");
+        facesFile << faces.size() << "\n(\n";
+        for (const auto& face : faces)
+        {
+            facesFile << "4(" << face[0] << " " << face[1] << " " << face[2] << " " << face[3]
+                      << ")\n";
+        }
+        facesFile << ")\n";
+        ownerFile << owner.size() << "\n(\n";
+        for (auto celli : owner)
+        {
+            ownerFile << celli << "\n";
+        }
+        ownerFile << ")\n";
+        neighbourFile << "1(1)\n";
+    }
+
+    std::ofstream boundaryFile(dir / "boundary");
+    writeHeader(boundaryFile, false, "polyBoundaryMesh", "boundary");
+    boundaryFile << "2\n(\n    inlet\n    {\n        type            patch;\n"
+                 << "        nFaces          1;\n        startFace       1;\n    }\n"
+                 << "    walls\n    {\n        type            wall;\n"
+                 << "        inGroups        List<word> 1(wall);\n"
+                 << "        nFaces          9;\n        startFace       2;\n    }\n)\n";
+}
+
+}
+
+TEST_CASE("FoamMesh")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const bool binary = GENERATE(false, true);
+    const std::string format = binary ? "binary" : "ascii";
+
+    SECTION("Read " + format + " polyMesh " + execName)
+    {
+        const std::filesystem::path caseDir("foamMesh_" + format + "_" + execName);
+#ifdef NF_WITH_MPI_SUPPORT
+        // the undecomposed case is only read by a single rank
+        NeoN::mpi::MPIEnvironment mpiEnviron;
+        if (mpiEnviron.sizeRank() > 1)
+        {
+            return;
+        }
+        writePolyMesh(caseDir / "constant" / "polyMesh", binary);
+        auto foamMesh = NeoN::io::readFoamCase(exec, caseDir.string(), mpiEnviron);
+#else
+        writePolyMesh(caseDir / "constant" / "polyMesh", binary);
+        auto foamMesh = NeoN::io::readFoamCase(exec, caseDir.string());
+#endif
+        const auto& mesh = foamMesh.mesh;
+
+        REQUIRE(foamMesh.patches.size() == 2);
+        REQUIRE(foamMesh.patches[0].name == "inlet");
+        REQUIRE(foamMesh.patches[1].type == "wall");
+        REQUIRE(foamMesh.patches[1].neighbProcNo == -1);
+        REQUIRE(mesh.nCells() == 2);
+        REQUIRE(mesh.nInternalFaces() == 1);
+        REQUIRE(mesh.nBoundaryFaces() == 10);
+        REQUIRE(mesh.nBoundaries() == 2);
+        REQUIRE(mesh.boundaryMesh().offset() == std::vector<localIdx> {0, 1, 10});
+
+        auto volumes = mesh.cellVolumes().copyToHost();
+        auto centres = mesh.cellCentres().copyToHost();
+        for (localIdx celli = 0; celli < 2; celli++)
+        {
+            REQUIRE(volumes.view()[celli] == Catch::Approx(1.0));
+            const auto expected = Vec3(0.5 + static_cast<scalar>(celli), 0.5, 0.5);
+            REQUIRE(NeoN::mag(centres.view()[celli] - expected) < 1e-6);
+        }
+
+        auto faceAreas = mesh.faceAreas().copyToHost();
+        auto faceCentres = mesh.faceCentres().copyToHost();
+        REQUIRE(NeoN::mag(faceAreas.view()[0] - Vec3(1.0, 0.0, 0.0)) < 1e-6);
+        REQUIRE(NeoN::mag(faceCentres.view()[0] - Vec3(1.0, 0.5, 0.5)) < 1e-6);
+        REQUIRE(NeoN::mag(faceAreas.view()[1] - Vec3(-1.0, 0.0, 0.0)) < 1e-6);
+
+        auto faceCells = mesh.boundaryMesh().faceCells().copyToHost();
+        auto deltaCoeffs = mesh.boundaryMesh().deltaCoeffs().copyToHost();
+        auto nf = mesh.boundaryMesh().nf().copyToHost();
+        REQUIRE(faceCells.view()[0] == 0);
+        REQUIRE(faceCells.view()[1] == 1);
+        for (localIdx bFacei = 0; bFacei < 10; bFacei++)
+        {
+            REQUIRE(deltaCoeffs.view()[bFacei] == Catch::Approx(2.0));
+            REQUIRE(NeoN::mag(nf.view()[bFacei]) == Catch::Approx(1.0));
+        }
+    }
+}
@@ -17,7 +17,7 @@ TEST_CASE("CSRMatrix")
 
     // sparse matrix
     NeoN::Vector<NeoN::scalar> valuesSparse(exec, {1.0, 5.0, 6.0, 8.0});
-    NeoN::Vector<NeoN::localIdx> colIdxSparse(exec, {0, 1, 2, 1});
+    NeoN::Vector<NeoN::columnIdx> colIdxSparse(exec, {0, 1, 2, 1});
     NeoN::Vector<NeoN::localIdx> rowOffsSparse(exec, {0, 1, 3, 4});
     NeoN::la::CSRMatrix<NeoN::scalar, NeoN::localIdx> sparseMatrix(
         valuesSparse, colIdxSparse, rowOffsSparse
@@ -28,7 +28,7 @@ TEST_CASE("CSRMatrix")
 
     // dense matrix
     NeoN::Vector<NeoN::scalar> valuesDense(exec, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
-    NeoN::Vector<NeoN::localIdx> colIdxDense(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
+    NeoN::Vector<NeoN::columnIdx> colIdxDense(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
     NeoN::Vector<NeoN::localIdx> rowOffsDense(exec, {0, 3, 6, 9});
     NeoN::la::CSRMatrix<NeoN::scalar, NeoN::localIdx> denseMatrix(
         valuesDense, colIdxDense, rowOffsDense
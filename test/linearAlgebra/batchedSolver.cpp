@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::Vector;
+using NeoN::la::BatchedDenseSystems;
+
+TEST_CASE("BatchedSolver")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("Solve systems of equal size " + execName)
+    {
+        const localIdx nSystems = 100;
+        const localIdx size = 5;
+        BatchedDenseSystems systems(exec, nSystems, size);
+        REQUIRE(systems.nSystems() == nSystems);
+        REQUIRE(systems.matrices().values().size() == nSystems * size * size);
+
+        // a zero diagonal with dominant entries on the cyclically shifted diagonal requires
+        // pivoting in every column, the solution is x_j = j + 1 + sysi
+        auto matrices = systems.matrices().view();
+        auto rhs = systems.rhs().view();
+        NeoN::parallelFor(
+            exec,
+            {0, nSystems},
+            KOKKOS_LAMBDA(const localIdx sysi) {
+                const auto aStart = matrices.segments[sysi];
+                const auto bStart = rhs.segments[sysi];
+                for (localIdx row = 0; row < size; row++)
+                {
+                    scalar sum = 0.0;
+                    for (localIdx col = 0; col < size; col++)
+                    {
+                        scalar value = 0.0;
+                        if (col == (row + 1) % size)
+                        {
+                            value = 10.0;
+                        }
+                        else if (col != row)
+                        {
+                            value = 1.0 / scalar(row + col + 2);
+                        }
+                        matrices.values[aStart + row * size + col] = value;
+                        sum += value * scalar(col + 1 + sysi);
+                    }
+                    rhs.values[bStart + row] = sum;
+                }
+            }
+        );
+
+        auto x = systems.createSolution();
+        REQUIRE(NeoN::la::solveBatchedLU(systems, x) == 0);
+
+        auto xHost = x.values().copyToHost();
+        for (localIdx sysi = 0; sysi < nSystems; sysi++)
+        {
+            for (localIdx j = 0; j < size; j++)
+            {
+                const scalar expected = scalar(j + 1 + sysi);
+                REQUIRE(xHost.view()[sysi * size + j] == Catch::Approx(expected));
+            }
+        }
+    }
+
+    SECTION("Solve systems of different sizes and detect singular systems " + execName)
+    {
+        Vector<localIdx> sizes(exec, {1, 3, 2});
+        BatchedDenseSystems systems(sizes);
+
+        // [2] x = [4], [1 2 0; 0 1 0; 0 0 4] x = [3 1 8] and the singular [1 1; 1 1]
+        Vector<scalar> values(
+            exec, {2.0, 1.0, 2.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 4.0, 1.0, 1.0, 1.0, 1.0}
+        );
+        Vector<scalar> rhs(exec, {4.0, 3.0, 1.0, 8.0, 1.0, 2.0});
+        systems.matrices().values() = values;
+        systems.rhs().values() = rhs;
+
+        auto x = systems.createSolution();
+        REQUIRE(NeoN::la::solveBatchedLU(systems, x) == 1);
+
+        auto xHost = x.values().copyToHost();
+        REQUIRE(xHost.view()[0] == Catch::Approx(2.0));
+        REQUIRE(xHost.view()[1] == Catch::Approx(1.0));
+        REQUIRE(xHost.view()[2] == Catch::Approx(1.0));
+        REQUIRE(xHost.view()[3] == Catch::Approx(2.0));
+        REQUIRE(xHost.view()[4] == 0.0);
+        REQUIRE(xHost.view()[5] == 0.0);
+    }
+    SECTION("Factorise once and solve several right hand sides in a kernel " + execName)
+    {
+        // every row is swapped, the solutions of the right hand sides are x = e_j
+        Vector<scalar> result(exec, 9, -1.0);
+        Vector<localIdx> regular(exec, 1, 0);
+        auto [x, ok] = NeoN::views(result, regular);
+        NeoN::parallelFor(
+            exec,
+            {0, 1},
+            KOKKOS_LAMBDA(const localIdx) {
+                scalar a[9] = {0.0, 1.0, 2.0, 3.0, 0.0, 1.0, 1.0, 4.0, 0.0};
+                const scalar copy[9] = {0.0, 1.0, 2.0, 3.0, 0.0, 1.0, 1.0, 4.0, 0.0};
+                localIdx perm[3];
+                ok[0] = NeoN::la::factorizeDenseLU(3, a, perm, 1e-14) ? 1 : 0;
+                for (localIdx j = 0; j < 3; j++)
+                {
+                    // the right hand side of x = e_j is column j of the matrix
+                    scalar b[3] = {copy[j], copy[3 + j], copy[6 + j]};
+                    NeoN::la::solveDenseLU(3, a, perm, b);
+                    for (localIdx i = 0; i < 3; i++)
+                    {
+                        x[3 * j + i] = b[i];
+                    }
+                }
+            }
+        );
+
+        auto [resultHost, regularHost] = NeoN::copyToHosts(result, regular);
+        REQUIRE(regularHost.view()[0] == 1);
+        for (localIdx j = 0; j < 3; j++)
+        {
+            for (localIdx i = 0; i < 3; i++)
+            {
+                const scalar expected = i == j ? 1.0 : 0.0;
+                REQUIRE(resultHost.view()[3 * j + i] == Catch::Approx(expected).margin(1e-12));
+            }
+        }
+    }
+}
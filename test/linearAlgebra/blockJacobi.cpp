@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <string>
+#include <vector>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+#include "testSystems.hpp"
+
+using NeoN::Dictionary;
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::Vector;
+
+TEST_CASE("BlockJacobi")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 4, 4, 4);
+
+    auto ls = NeoN::la::createDiagonallyDominantLaplacian(mesh);
+    auto hostColIdxs = ls.matrix().colIdxs().copyToHost();
+    auto hostRowOffs = ls.matrix().rowOffs().copyToHost();
+    const auto [colIdxs, rowOffs] = NeoN::views(hostColIdxs, hostRowOffs);
+
+    SECTION("Blocks of consecutive rows " + execName)
+    {
+        auto offsets = NeoN::la::uniformBlockOffsets(exec, 10, 4).copyToHost();
+        REQUIRE(offsets.size() == 4);
+        REQUIRE(offsets.view()[1] == 4);
+        REQUIRE(offsets.view()[2] == 8);
+        REQUIRE(offsets.view()[3] == 10);
+    }
+
+    SECTION("Blocks of one row are the Jacobi preconditioner " + execName)
+    {
+        NeoN::la::BlockJacobiPreconditioner precond(exec, mesh.nCells(), 1);
+        precond.factorize(ls.matrix());
+        REQUIRE(precond.nBlocks() == mesh.nCells());
+
+        const Vector<scalar> ones(exec, mesh.nCells(), 1.0);
+        Vector<scalar> y(exec, mesh.nCells());
+        precond.apply(ones, y);
+        auto hostY = y.copyToHost();
+        for (localIdx rowi = 0; rowi < mesh.nCells(); rowi++)
+        {
+            const auto nEntries = scalar(rowOffs[rowi + 1] - rowOffs[rowi]);
+            REQUIRE(hostY.view()[rowi] == Catch::Approx(1.0 / nEntries));
+        }
+    }
+
+    SECTION("A single block is the inverse of the matrix " + execName)
+    {
+        // the ten rows of a small mesh fit into a single block
+        auto smallMesh = NeoN::create1DUniformMesh(exec, 10);
+        auto small = NeoN::la::createEmptyLinearSystem<scalar, localIdx>(
+            smallMesh, NeoN::la::SparsityPattern::readOrCreate(smallMesh)
+        );
+        auto hostSmallColIdxs = small.matrix().colIdxs().copyToHost();
+        auto hostSmallRowOffs = small.matrix().rowOffs().copyToHost();
+        const auto [smallColIdxs, smallRowOffs] = NeoN::views(hostSmallColIdxs, hostSmallRowOffs);
+        std::vector<scalar> smallValues(smallColIdxs.size());
+        for (localIdx rowi = 0; rowi < 10; rowi++)
+        {
+            for (auto k = smallRowOffs[rowi]; k < smallRowOffs[rowi + 1]; k++)
+            {
+                // a non-symmetric matrix, which requires pivoting in the first row
+                const auto col = smallColIdxs[k];
+                smallValues[static_cast<std::size_t>(k)] =
+                    col == rowi ? (rowi == 0 ? 0.0 : 4.0) : (col > rowi ? -1.0 : -2.0);
+            }
+        }
+        small.matrix().values() = Vector<scalar>(exec, smallValues);
+
+        std::vector<scalar> expected(10);
+        for (std::size_t i = 0; i < expected.size(); i++)
+        {
+            expected[i] = scalar(i) + 1.0;
+        }
+        const Vector<scalar> x(exec, expected);
+        Vector<scalar> b(exec, 10);
+        NeoN::la::spmv(small.matrix(), x, b);
+
+        NeoN::la::BlockJacobiPreconditioner precond(exec, 10, 16);
+        precond.factorize(small.matrix());
+        REQUIRE(precond.nBlocks() == 1);
+        Vector<scalar> y(exec, 10);
+        precond.apply(b, y);
+        auto hostY = y.copyToHost();
+        for (localIdx i = 0; i < 10; i++)
+        {
+            REQUIRE(hostY.view()[i] == Catch::Approx(expected[static_cast<std::size_t>(i)]));
+        }
+    }
+
+    SECTION("Solve with blocks and as preconditioner " + execName)
+    {
+        auto krylov = GENERATE(std::string {"cg"}, std::string {"none"});
+        std::vector<int> iterations;
+        for (int blockSize : {1, 16})
+        {
+            Dictionary solverDict {
+                {{"solver", std::string {"BlockJacobi"}},
+                 {"blockSize", blockSize},
+                 {"krylov", krylov},
+                 {"maxIters", 1000},
+                 {"relTol", 1e-8}}
+            };
+            NeoN::la::BlockJacobi solver(exec, solverDict);
+
+            Vector<scalar> x(exec, mesh.nCells(), 0.0);
+            auto stats = solver.solve(ls, x);
+            REQUIRE(stats.numIter < 1000);
+            REQUIRE(stats.finalResNorm <= 1e-8 * stats.initResNorm);
+            REQUIRE(solver.preconditioner()->blockSize() == blockSize);
+
+            Vector<scalar> res(exec, mesh.nCells());
+            const auto norms = NeoN::la::computeResidualNorms(ls.matrix(), ls.rhs(), x, res);
+            REQUIRE(norms.linf == Catch::Approx(0.0).margin(1e-6));
+            iterations.push_back(stats.numIter);
+        }
+
+        // the blocks resolve the coupling within a block, which reduces the iterations
+        REQUIRE(iterations[1] <= iterations[0]);
+    }
+}
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::columnIdx;
+using NeoN::Vec3;
+using NeoN::Vector;
+using NeoN::la::CSRMatrix;
+using NeoN::la::LinearSystem;
+
+TEST_CASE("BlockLinearSystem")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // [ a b ]
+    // [ 0 c ] with diagonal 3x3 blocks
+    Vector<Vec3> values(exec, {Vec3(1.0, 2.0, 3.0), Vec3(4.0, 5.0, 6.0), Vec3(7.0, 8.0, 9.0)});
+    Vector<columnIdx> colIdxs(exec, {0, 1, 1});
+    Vector<localIdx> rowOffs(exec, {0, 2, 3});
+    Vector<Vec3> rhs(exec, {Vec3(10.0, 20.0, 30.0), Vec3(40.0, 50.0, 60.0)});
+    LinearSystem<Vec3, localIdx> ls(CSRMatrix<Vec3, localIdx>(values, colIdxs, rowOffs), rhs);
+
+    SECTION("Extract component " + execName)
+    {
+        auto cmptLs = NeoN::la::createComponentSystem(ls);
+        NeoN::la::extractComponent(ls, 1, cmptLs);
+
+        auto cmptHost = cmptLs.copyToHost();
+        REQUIRE(cmptHost.matrix().nRows() == 2);
+        REQUIRE(cmptHost.matrix().values().view()[0] == 2.0);
+        REQUIRE(cmptHost.matrix().values().view()[1] == 5.0);
+        REQUIRE(cmptHost.matrix().values().view()[2] == 8.0);
+        REQUIRE(cmptHost.matrix().colIdxs().view()[1] == 1);
+        REQUIRE(cmptHost.rhs().view()[0] == 20.0);
+        REQUIRE(cmptHost.rhs().view()[1] == 50.0);
+
+        Vector<Vec3> x(exec, {Vec3(1.0, 2.0, 3.0), Vec3(4.0, 5.0, 6.0)});
+        Vector<scalar> cmptX(exec, 2);
+        NeoN::la::extractComponent(x, 2, cmptX);
+        NeoN::fill(cmptX, -1.0);
+        NeoN::la::insertComponent(cmptX, 0, x);
+
+        auto xHost = x.copyToHost();
+        REQUIRE(xHost.view()[0] == Vec3(-1.0, 2.0, 3.0));
+        REQUIRE(xHost.view()[1] == Vec3(-1.0, 5.0, 6.0));
+    }
+
+    SECTION("Create coupled system " + execName)
+    {
+        auto coupledLs = NeoN::la::createCoupledSystem(ls);
+        auto coupledHost = coupledLs.copyToHost();
+
+        REQUIRE(coupledHost.matrix().nRows() == 6);
+        REQUIRE(coupledHost.matrix().values().size() == 9);
+
+        auto rowOffsHost = coupledHost.matrix().rowOffs().view();
+        REQUIRE(rowOffsHost[0] == 0);
+        REQUIRE(rowOffsHost[1] == 2);
+        REQUIRE(rowOffsHost[2] == 4);
+        REQUIRE(rowOffsHost[3] == 6);
+        REQUIRE(rowOffsHost[4] == 7);
+        REQUIRE(rowOffsHost[5] == 8);
+        REQUIRE(rowOffsHost[6] == 9);
+
+        // row 1 holds the y component of the first cell
+        auto valuesHost = coupledHost.matrix().values().view();
+        auto colIdxsHost = coupledHost.matrix().colIdxs().view();
+        REQUIRE(valuesHost[2] == 2.0);
+        REQUIRE(colIdxsHost[2] == 1);
+        REQUIRE(valuesHost[3] == 5.0);
+        REQUIRE(colIdxsHost[3] == 4);
+        REQUIRE(valuesHost[8] == 9.0);
+        REQUIRE(colIdxsHost[8] == 5);
+        REQUIRE(coupledHost.rhs().view()[4] == 50.0);
+
+        Vector<Vec3> x(exec, {Vec3(1.0, 2.0, 3.0), Vec3(4.0, 5.0, 6.0)});
+        Vector<scalar> coupledX(exec, 6);
+        NeoN::la::interleave(x, coupledX);
+        auto coupledXHost = coupledX.copyToHost();
+        for (localIdx i = 0; i < 6; i++)
+        {
+            REQUIRE(coupledXHost.view()[i] == static_cast<scalar>(i + 1));
+        }
+
+        Vector<Vec3> y(exec, 2);
+        NeoN::la::deinterleave(coupledX, y);
+        auto yHost = y.copyToHost();
+        REQUIRE(yHost.view()[1] == Vec3(4.0, 5.0, 6.0));
+    }
+}
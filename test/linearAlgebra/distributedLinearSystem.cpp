@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using namespace NeoN;
+
+TEST_CASE("DistributedLinearSystem")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = mpiEnviron.rank();
+
+    // rank r owns r + 2 rows
+    const auto nLocal = static_cast<localIdx>(rank + 2);
+    la::GlobalRowNumbering numbering(mpiEnviron, nLocal);
+
+    SECTION("Global row numbering " + execName)
+    {
+        globalIdx offset = 0;
+        for (size_t r = 0; r < rank; r++)
+        {
+            offset += static_cast<globalIdx>(r + 2);
+        }
+        REQUIRE(numbering.rowOffset() == offset);
+        REQUIRE(numbering.nLocalRows() == nLocal);
+        REQUIRE(numbering.rankOffsets().size() == nRanks + 1);
+        REQUIRE(numbering.nGlobalRows() == numbering.rankOffsets().back());
+    }
+
+    SECTION("Interface coefficients " + execName)
+    {
+        // every rank sends its first row to all ranks, the halo of rank r is stored after the
+        // local rows at nLocal + r
+        CommMap rankSendMap(nRanks);
+        CommMap rankReceiveMap(nRanks);
+        std::vector<localIdx> haloIdxsHost;
+        for (size_t r = 0; r < nRanks; r++)
+        {
+            rankSendMap[r].emplace_back(NodeCommMap {.local_idx = 0});
+            rankReceiveMap[r].emplace_back(
+                NodeCommMap {.local_idx = static_cast<label>(nLocal + static_cast<localIdx>(r))}
+            );
+            haloIdxsHost.push_back(nLocal + static_cast<localIdx>(r));
+        }
+        Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+        Vector<localIdx> haloIdxs(exec, haloIdxsHost);
+
+        auto haloGlobalIdxs = la::exchangeGlobalIdxs(
+            comm, numbering, haloIdxs, nLocal + static_cast<localIdx>(nRanks)
+        );
+        auto haloGlobalIdxsHost = haloGlobalIdxs.copyToHost();
+        for (size_t r = 0; r < nRanks; r++)
+        {
+            REQUIRE(haloGlobalIdxsHost.view()[r] == numbering.rankOffsets()[r]);
+        }
+
+        // a diagonal local system, the last row couples to the halo
+        Vector<scalar> values(exec, static_cast<localIdx>(nLocal), 2.0);
+        std::vector<columnIdx> colIdxsHost(static_cast<size_t>(nLocal));
+        std::vector<localIdx> rowOffsHost(static_cast<size_t>(nLocal) + 1);
+        for (localIdx i = 0; i < nLocal; i++)
+        {
+            colIdxsHost[static_cast<size_t>(i)] = static_cast<columnIdx>(i);
+            rowOffsHost[static_cast<size_t>(i) + 1] = i + 1;
+        }
+        la::CSRMatrix<scalar, localIdx> csrMatrix(
+            values, Vector<columnIdx>(exec, colIdxsHost), Vector<localIdx>(exec, rowOffsHost)
+        );
+        la::LinearSystem<scalar, localIdx> localSystem(
+            csrMatrix, Vector<scalar>(exec, nLocal, 1.0)
+        );
+        Vector<localIdx> interfaceRows(exec, static_cast<localIdx>(nRanks), nLocal - 1);
+        la::DistributedLinearSystem<scalar, localIdx> ls(
+            localSystem, numbering, interfaceRows, haloGlobalIdxs, mpiEnviron
+        );
+        fill(ls.interfaceValues(), -1.0);
+
+        REQUIRE(ls.nCOOEntries() == nLocal + static_cast<localIdx>(nRanks));
+
+        Vector<globalIdx> cooRows(exec, 0);
+        Vector<globalIdx> cooCols(exec, 0);
+        Vector<scalar> cooValues(exec, 0);
+        ls.globalCOOIdxs(cooRows, cooCols);
+        ls.cooValues(cooValues);
+
+        auto cooRowsHost = cooRows.copyToHost();
+        auto cooColsHost = cooCols.copyToHost();
+        auto cooValuesHost = cooValues.copyToHost();
+        const auto offset = numbering.rowOffset();
+        for (localIdx i = 0; i < nLocal; i++)
+        {
+            REQUIRE(cooRowsHost.view()[i] == offset + i);
+            REQUIRE(cooColsHost.view()[i] == offset + i);
+            REQUIRE(cooValuesHost.view()[i] == 2.0);
+        }
+        for (size_t r = 0; r < nRanks; r++)
+        {
+            const auto j = nLocal + static_cast<localIdx>(r);
+            REQUIRE(cooRowsHost.view()[j] == offset + nLocal - 1);
+            REQUIRE(cooColsHost.view()[j] == numbering.rankOffsets()[r]);
+            REQUIRE(cooValuesHost.view()[j] == -1.0);
+        }
+
+        ls.resetValues();
+        auto interfaceValuesHost = ls.interfaceValues().copyToHost();
+        REQUIRE(interfaceValuesHost.view()[0] == 0.0);
+    }
+
+    SECTION("Native Krylov solvers " + execName)
+    {
+        // a tridiagonal matrix over the global rows, the neighbouring rows of other ranks are
+        // interface coefficients, the rhs is chosen for the solution one
+        const auto offset = numbering.rowOffset();
+        const auto nGlobal = numbering.nGlobalRows();
+        std::vector<scalar> valuesHost;
+        std::vector<columnIdx> colIdxsHost;
+        std::vector<localIdx> rowOffsHost {0};
+        std::vector<scalar> rhsHost;
+        std::vector<localIdx> interfaceRowsHost;
+        std::vector<globalIdx> interfaceColsHost;
+        for (localIdx i = 0; i < nLocal; i++)
+        {
+            const auto globalRow = offset + static_cast<globalIdx>(i);
+            scalar rowSum = 2.5;
+            if (i > 0)
+            {
+                valuesHost.push_back(-1.0);
+                colIdxsHost.push_back(static_cast<columnIdx>(i - 1));
+            }
+            valuesHost.push_back(2.5);
+            colIdxsHost.push_back(static_cast<columnIdx>(i));
+            if (i + 1 < nLocal)
+            {
+                valuesHost.push_back(-1.0);
+                colIdxsHost.push_back(static_cast<columnIdx>(i + 1));
+            }
+            rowOffsHost.push_back(static_cast<localIdx>(valuesHost.size()));
+            if (i == 0 && globalRow > 0)
+            {
+                interfaceRowsHost.push_back(i);
+                interfaceColsHost.push_back(globalRow - 1);
+            }
+            if (i + 1 == nLocal && globalRow + 1 < nGlobal)
+            {
+                interfaceRowsHost.push_back(i);
+                interfaceColsHost.push_back(globalRow + 1);
+            }
+            rowSum -= globalRow > 0 ? 1.0 : 0.0;
+            rowSum -= globalRow + 1 < nGlobal ? 1.0 : 0.0;
+            rhsHost.push_back(rowSum);
+        }
+        la::CSRMatrix<scalar, localIdx> csrMatrix(
+            Vector<scalar>(exec, valuesHost),
+            Vector<columnIdx>(exec, colIdxsHost),
+            Vector<localIdx>(exec, rowOffsHost)
+        );
+        la::LinearSystem<scalar, localIdx> localSystem(csrMatrix, Vector<scalar>(exec, rhsHost));
+        la::DistributedLinearSystem<scalar, localIdx> ls(
+            localSystem,
+            numbering,
+            Vector<localIdx>(exec, interfaceRowsHost),
+            Vector<globalIdx>(exec, interfaceColsHost),
+            mpiEnviron
+        );
+        fill(ls.interfaceValues(), -1.0);
+
+        auto method = GENERATE(
+            std::string {"cg"},
+            std::string {"biCGStab"},
+            std::string {"gmres"},
+            std::string {"pipelinedCG"},
+            std::string {"pipelinedBiCGStab"}
+        );
+        Dictionary solverDict {
+            {{"solver", std::string {"Krylov"}}, {"method", method}, {"relTol", 1e-10}}
+        };
+        la::Solver solver(exec, solverDict);
+        Vector<scalar> x(exec, nLocal, 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        auto xHost = x.copyToHost();
+        for (auto value : xHost.view())
+        {
+            REQUIRE(value == Catch::Approx(1.0).margin(1e-8));
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+#include "testSystems.hpp"
+
+using NeoN::Dictionary;
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::Vector;
+
+TEST_CASE("GaussSeidel")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 4, 4, 4);
+
+    auto ls = NeoN::la::createDiagonallyDominantLaplacian(mesh);
+    auto hostColIdxs = ls.matrix().colIdxs().copyToHost();
+    auto hostRowOffs = ls.matrix().rowOffs().copyToHost();
+    const auto [colIdxs, rowOffs] = NeoN::views(hostColIdxs, hostRowOffs);
+
+    SECTION("Coloring of the sparsity pattern " + execName)
+    {
+        const auto& coloring = NeoN::la::MatrixColoring::readOrCreate(mesh);
+        REQUIRE(&coloring == &NeoN::la::MatrixColoring::readOrCreate(mesh));
+        // a structured hexahedral mesh is colored red and black
+        REQUIRE(coloring.nColors() == 2);
+        REQUIRE(coloring.offsets.back() == mesh.nCells());
+
+        // no two coupled rows share a color
+        auto hostRows = coloring.rows.copyToHost();
+        std::vector<localIdx> rowColor(static_cast<std::size_t>(mesh.nCells()));
+        for (localIdx color = 0; color < coloring.nColors(); color++)
+        {
+            const auto c = static_cast<std::size_t>(color);
+            for (auto i = coloring.offsets[c]; i < coloring.offsets[c + 1]; i++)
+            {
+                rowColor[static_cast<std::size_t>(hostRows.view()[i])] = color;
+            }
+        }
+        for (localIdx rowi = 0; rowi < mesh.nCells(); rowi++)
+        {
+            for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+            {
+                if (colIdxs[k] != rowi)
+                {
+                    REQUIRE(
+                        rowColor[static_cast<std::size_t>(rowi)]
+                        != rowColor[static_cast<std::size_t>(colIdxs[k])]
+                    );
+                }
+            }
+        }
+
+        auto diagIdxs = NeoN::la::diagonalIndices(ls.matrix()).copyToHost();
+        for (localIdx rowi = 0; rowi < mesh.nCells(); rowi++)
+        {
+            REQUIRE(colIdxs[diagIdxs.view()[rowi]] == rowi);
+        }
+    }
+
+    SECTION("Solve with sweeps and as preconditioner " + execName)
+    {
+        auto [sweep, relaxation, krylov] = GENERATE(
+            std::make_tuple(std::string {"forward"}, 1.0, std::string {"none"}),
+            std::make_tuple(std::string {"backward"}, 1.0, std::string {"none"}),
+            std::make_tuple(std::string {"symmetric"}, 1.0, std::string {"none"}),
+            std::make_tuple(std::string {"forward"}, 1.2, std::string {"none"}),
+            std::make_tuple(std::string {"symmetric"}, 1.0, std::string {"cg"})
+        );
+
+        Dictionary solverDict {
+            {{"solver", std::string {"GaussSeidel"}},
+             {"sweep", sweep},
+             {"relaxation", relaxation},
+             {"krylov", krylov},
+             {"maxIters", 500},
+             {"relTol", 1e-8}}
+        };
+        NeoN::la::GaussSeidel solver(exec, solverDict);
+
+        Vector<scalar> x(exec, mesh.nCells(), 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter < 500);
+        REQUIRE(stats.finalResNorm <= 1e-8 * stats.initResNorm);
+        // the coloring of the mesh is reused
+        REQUIRE(solver.coloring()->nColors() == 2);
+
+        Vector<scalar> res(exec, mesh.nCells());
+        const auto norms = NeoN::la::computeResidualNorms(ls.matrix(), ls.rhs(), x, res);
+        REQUIRE(norms.linf == Catch::Approx(0.0).margin(1e-6));
+
+        // the conjugate gradient method needs fewer iterations than the sweeps
+        if (krylov == "cg")
+        {
+            REQUIRE(stats.numIter < 20);
+        }
+    }
+}
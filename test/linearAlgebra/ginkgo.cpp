@@ -13,6 +13,7 @@ using NeoN::Executor;
 using NeoN::Dictionary;
 using NeoN::scalar;
 using NeoN::localIdx;
+using NeoN::columnIdx;
 using NeoN::Vector;
 using NeoN::la::LinearSystem;
 using NeoN::la::CSRMatrix;
@@ -85,6 +86,39 @@ TEST_CASE("Dictionary Parsing - Ginkgo")
     }
 }
 
+/* @brief a linear operator which applies a CSR matrix, used to test the matrix free solve */
+class SpmvOperator : public NeoN::la::LinearOperator<scalar>
+{
+public:
+
+    SpmvOperator(const CSRMatrix<scalar, localIdx>& mtx) : mtx_(mtx) {}
+
+    Executor exec() const override { return mtx_.exec(); }
+
+    localIdx nRows() const override { return mtx_.nRows(); }
+
+    void apply(NeoN::View<const scalar> x, NeoN::View<scalar> y) const override
+    {
+        const auto [values, colIdxs, rowOffs] = mtx_.view();
+        NeoN::parallelFor(
+            exec(),
+            {0, nRows()},
+            KOKKOS_LAMBDA(const localIdx rowi) {
+                scalar sum = 0.0;
+                for (auto j = rowOffs[rowi]; j < rowOffs[rowi + 1]; j++)
+                {
+                    sum += values[j] * x[colIdxs[j]];
+                }
+                y[rowi] = sum;
+            }
+        );
+    }
+
+private:
+
+    const CSRMatrix<scalar, localIdx>& mtx_;
+};
+
 TEST_CASE("MatrixAssembly - Ginkgo")
 {
     auto [execName, exec] = GENERATE(allAvailableExecutor());
@@ -95,7 +129,7 @@ TEST_CASE("MatrixAssembly - Ginkgo")
     {
 
         Vector<scalar> values(exec, {1.0, -0.1, -0.1, 1.0, -0.1, -0.1, 1.0});
-        Vector<localIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
         Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
         CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
 
@@ -113,7 +147,8 @@ TEST_CASE("MatrixAssembly - Ginkgo")
         auto solver = NeoN::la::Solver(exec, solverDict);
 
         // Solve system
-        auto [numIter, initResNorm, finalResNorm, solveTime] = solver.solve(linearSystem, x);
+        auto [numIter, initResNorm, finalResNorm, solveTime, timings] =
+            solver.solve(linearSystem, x);
 
         auto hostX = x.copyToHost();
         auto hostXS = hostX.view();
@@ -123,6 +158,269 @@ TEST_CASE("MatrixAssembly - Ginkgo")
         REQUIRE(numIter == 3);
         REQUIRE(initResNorm == Catch::Approx(3.741657386).margin(1e-8));
         REQUIRE(finalResNorm < 1.0e-04);
+        const auto phases = timings.setupTime + timings.preconditionerTime + timings.applyTime
+                          + timings.transferTime;
+        REQUIRE(phases <= solveTime + 1e-3);
+    }
+
+    SECTION("Reuse generated solver " + execName)
+    {
+        Vector<scalar> values(exec, {1.0, -0.1, -0.1, 1.0, -0.1, -0.1, 1.0});
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
+        CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
+
+        Vector<scalar> rhs(exec, {1.0, 2.0, 3.0});
+        LinearSystem<scalar, localIdx> linearSystem(csrMatrix, rhs);
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Cg"},
+             {"rebuildPreconditionerEvery", 2},
+             {"computeInitialResidual", false},
+             {"criteria", Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+        };
+
+        auto solver = NeoN::la::Solver(exec, solverDict);
+        auto clonedSolver = solver;
+
+        // repeated solves and the cloned solver need to give identical results
+        for (auto* s : {&solver, &solver, &solver, &clonedSolver})
+        {
+            Vector<scalar> x(exec, {0.0, 0.0, 0.0});
+            auto [numIter, initResNorm, finalResNorm, solveTime, timings] =
+                s->solve(linearSystem, x);
+
+            auto hostX = x.copyToHost();
+            auto hostXS = hostX.view();
+            REQUIRE((hostXS[0]) == Catch::Approx(1.24489796).margin(1e-8));
+            REQUIRE((hostXS[1]) == Catch::Approx(2.44897959).margin(1e-8));
+            REQUIRE((hostXS[2]) == Catch::Approx(3.24489796).margin(1e-8));
+            REQUIRE(numIter == 3);
+            REQUIRE(initResNorm == 0.0);
+        }
+    }
+
+    SECTION("Solve with a matrix free linear operator " + execName)
+    {
+        Vector<scalar> values(exec, {1.0, -0.1, -0.1, 1.0, -0.1, -0.1, 1.0});
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
+        CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
+        auto op = std::make_shared<SpmvOperator>(csrMatrix);
+
+        Vector<scalar> rhs(exec, {1.0, 2.0, 3.0});
+        Vector<scalar> x(exec, {0.0, 0.0, 0.0});
+
+        Dictionary solverDict {
+            {{"type", "solver::Cg"},
+             {"criteria", Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+        };
+        NeoN::la::ginkgo::GinkgoSolver solver(exec, solverDict);
+        auto [numIter, initResNorm, finalResNorm, solveTime, timings] = solver.solve(op, rhs, x);
+
+        auto hostX = x.copyToHost();
+        auto hostXS = hostX.view();
+        REQUIRE((hostXS[0]) == Catch::Approx(1.24489796).margin(1e-8));
+        REQUIRE((hostXS[1]) == Catch::Approx(2.44897959).margin(1e-8));
+        REQUIRE((hostXS[2]) == Catch::Approx(3.24489796).margin(1e-8));
+        REQUIRE(numIter == 3);
+        REQUIRE(initResNorm == Catch::Approx(3.741657386).margin(1e-8));
+
+        // the rhs is wrapped without a copy, the initial residual must not overwrite it
+        auto hostRhs = rhs.copyToHost();
+        REQUIRE(hostRhs.view()[0] == 1.0);
+        REQUIRE(hostRhs.view()[1] == 2.0);
+        REQUIRE(hostRhs.view()[2] == 3.0);
+    }
+
+    SECTION("Solve multiple right hand sides " + execName)
+    {
+        Vector<scalar> values(exec, {1.0, -0.1, -0.1, 1.0, -0.1, -0.1, 1.0});
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
+        CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
+
+        Vector<scalar> rhs(exec, {0.0, 0.0, 0.0});
+        LinearSystem<scalar, localIdx> linearSystem(csrMatrix, rhs);
+
+        // the second column is twice the first column
+        NeoN::la::DenseBlock b(exec, 3, 2);
+        b.setColumn(0, Vector<scalar>(exec, {1.0, 2.0, 3.0}));
+        b.setColumn(1, Vector<scalar>(exec, {2.0, 4.0, 6.0}));
+        NeoN::la::DenseBlock x(exec, 3, 2);
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Cg"},
+             {"criteria", Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+        };
+        auto solver = NeoN::la::Solver(exec, solverDict);
+        auto [numIter, initResNorm, finalResNorm, solveTime, timings] =
+            solver.solve(linearSystem, b, x);
+
+        Vector<scalar> column(exec, 0);
+        for (localIdx j = 0; j < 2; j++)
+        {
+            x.getColumn(j, column);
+            auto hostX = column.copyToHost();
+            auto hostXS = hostX.view();
+            const auto factor = static_cast<scalar>(j + 1);
+            REQUIRE((hostXS[0]) == Catch::Approx(factor * 1.24489796).margin(1e-8));
+            REQUIRE((hostXS[1]) == Catch::Approx(factor * 2.44897959).margin(1e-8));
+            REQUIRE((hostXS[2]) == Catch::Approx(factor * 3.24489796).margin(1e-8));
+        }
+        REQUIRE(numIter == 3);
+        // the norm of both columns, sqrt(1 + 4) times the norm of the first column
+        REQUIRE(initResNorm == Catch::Approx(std::sqrt(5.0) * 3.741657386).margin(1e-8));
+
+        // the rhs of the system is not used
+        auto hostRhs = rhs.copyToHost();
+        REQUIRE(hostRhs.view()[0] == 0.0);
+    }
+
+    SECTION("Solve Vec3 system " + execName)
+    {
+        auto vectorSolve = GENERATE(std::string("segregated"), std::string("coupled"));
+
+        Vector<NeoN::Vec3> values(
+            exec,
+            {NeoN::Vec3(1.0),
+             NeoN::Vec3(-0.1),
+             NeoN::Vec3(-0.1),
+             NeoN::Vec3(1.0),
+             NeoN::Vec3(-0.1),
+             NeoN::Vec3(-0.1),
+             NeoN::Vec3(1.0)}
+        );
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
+        CSRMatrix<NeoN::Vec3, localIdx> csrMatrix(values, colIdx, rowOffs);
+
+        Vector<NeoN::Vec3> rhs(exec, {NeoN::Vec3(1.0), NeoN::Vec3(2.0), NeoN::Vec3(3.0)});
+        LinearSystem<NeoN::Vec3, localIdx> linearSystem(csrMatrix, rhs);
+        Vector<NeoN::Vec3> x(exec, 3, NeoN::Vec3(0.0));
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Cg"},
+             {"vectorSolve", vectorSolve},
+             {"criteria", Dictionary {{{"iteration", 10}, {"relative_residual_norm", 1e-10}}}}}
+        };
+
+        auto solver = NeoN::la::Solver(exec, solverDict);
+        auto [numIter, initResNorm, finalResNorm, solveTime, timings] =
+            solver.solve(linearSystem, x);
+
+        // all components have the solution of the scalar system
+        auto hostX = x.copyToHost();
+        auto hostXS = hostX.view();
+        for (localIdx d = 0; d < 3; d++)
+        {
+            REQUIRE((hostXS[0][d]) == Catch::Approx(1.24489796).margin(1e-8));
+            REQUIRE((hostXS[1][d]) == Catch::Approx(2.44897959).margin(1e-8));
+            REQUIRE((hostXS[2][d]) == Catch::Approx(3.24489796).margin(1e-8));
+        }
+        // the norm over all components
+        REQUIRE(initResNorm == Catch::Approx(std::sqrt(3.0) * 3.741657386).margin(1e-8));
+        REQUIRE(finalResNorm < 1.0e-8);
+    }
+
+    SECTION("Mixed precision solve " + execName)
+    {
+        Vector<scalar> values(exec, {1.0, -0.1, -0.1, 1.0, -0.1, -0.1, 1.0});
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
+        CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
+
+        Vector<scalar> rhs(exec, {1.0, 2.0, 3.0});
+        LinearSystem<scalar, localIdx> linearSystem(csrMatrix, rhs);
+        Vector<scalar> x(exec, {0.0, 0.0, 0.0});
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Cg"},
+             {"mixedPrecision", true},
+             {"refinementTolerance", 1e-12},
+             {"criteria", Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+        };
+
+        auto solver = NeoN::la::Solver(exec, solverDict);
+        auto [numIter, initResNorm, finalResNorm, solveTime, timings] =
+            solver.solve(linearSystem, x);
+
+        // the double precision refinement recovers the accuracy lost in the inner solves
+        auto hostX = x.copyToHost();
+        auto hostXS = hostX.view();
+        REQUIRE((hostXS[0]) == Catch::Approx(1.24489796).margin(1e-8));
+        REQUIRE((hostXS[1]) == Catch::Approx(2.44897959).margin(1e-8));
+        REQUIRE((hostXS[2]) == Catch::Approx(3.24489796).margin(1e-8));
+        REQUIRE(numIter >= 3);
+        REQUIRE(initResNorm == Catch::Approx(3.741657386).margin(1e-8));
+        REQUIRE(finalResNorm < 1.0e-10);
+    }
+
+    SECTION("Block Jacobi preconditioner " + execName)
+    {
+        Vector<scalar> values(exec, {1.0, -0.1, -0.1, 1.0, -0.1, -0.1, 1.0});
+        Vector<columnIdx> colIdx(exec, {0, 1, 0, 1, 2, 1, 2});
+        Vector<localIdx> rowOffs(exec, {0, 2, 5, 7});
+        CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
+
+        Vector<scalar> rhs(exec, {1.0, 2.0, 3.0});
+        LinearSystem<scalar, localIdx> linearSystem(csrMatrix, rhs);
+        Vector<scalar> x(exec, {0.0, 0.0, 0.0});
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Cg"},
+             {"blockJacobi", 3},
+             {"criteria", Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+        };
+
+        // a single block holds the whole matrix, hence its inverse is exact
+        auto solver = NeoN::la::Solver(exec, solverDict);
+        auto [numIter, initResNorm, finalResNorm, solveTime, timings] =
+            solver.solve(linearSystem, x);
+
+        auto hostX = x.copyToHost();
+        auto hostXS = hostX.view();
+        REQUIRE((hostXS[0]) == Catch::Approx(1.24489796).margin(1e-8));
+        REQUIRE((hostXS[1]) == Catch::Approx(2.44897959).margin(1e-8));
+        REQUIRE((hostXS[2]) == Catch::Approx(3.24489796).margin(1e-8));
+        REQUIRE(numIter == 1);
+    }
+
+    SECTION("Share Ginkgo executor " + execName)
+    {
+        auto gkoExec = NeoN::la::ginkgo::getGkoExecutor(exec);
+        REQUIRE(NeoN::la::ginkgo::getGkoExecutor(exec) == gkoExec);
+    }
+
+    SECTION("Cache solvers " + execName)
+    {
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Cg"},
+             {"criteria", Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+        };
+        NeoN::la::SolverCache cache;
+
+        auto solver = cache.get("T", exec, solverDict);
+        REQUIRE(cache.get("T", exec, solverDict) == solver);
+        REQUIRE(cache.get("U", exec, solverDict) != solver);
+        REQUIRE(cache.size() == 2);
+
+        // an equal dictionary with another version returns the cached solver as well
+        Dictionary equalDict = solverDict;
+        equalDict.insert("solver", std::string {"Ginkgo"});
+        REQUIRE(cache.get("T", exec, equalDict) == solver);
+        REQUIRE(cache.size() == 2);
+
+        // a modified dictionary creates a new solver
+        solverDict.subDict("criteria").insert("iteration", 5);
+        REQUIRE(cache.get("T", exec, solverDict) != solver);
+        REQUIRE(cache.size() == 3);
     }
 }
 #endif
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <vector>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::Dictionary;
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::columnIdx;
+using NeoN::Vector;
+using NeoN::la::LinearSystem;
+using NeoN::la::CSRMatrix;
+
+/* @brief a tridiagonal matrix with the entries lower diag upper and the rhs of the solution one
+ */
+LinearSystem<scalar, localIdx>
+createTridiagonalSystem(const NeoN::Executor& exec, localIdx nRows, scalar lower, scalar upper)
+{
+    const scalar diag = 2.5;
+    std::vector<scalar> values;
+    std::vector<columnIdx> colIdxs;
+    std::vector<localIdx> rowOffs {0};
+    std::vector<scalar> rhs;
+    for (localIdx rowi = 0; rowi < nRows; rowi++)
+    {
+        scalar rowSum = diag;
+        if (rowi > 0)
+        {
+            values.push_back(lower);
+            colIdxs.push_back(static_cast<columnIdx>(rowi - 1));
+            rowSum += lower;
+        }
+        values.push_back(diag);
+        colIdxs.push_back(static_cast<columnIdx>(rowi));
+        if (rowi + 1 < nRows)
+        {
+            values.push_back(upper);
+            colIdxs.push_back(static_cast<columnIdx>(rowi + 1));
+            rowSum += upper;
+        }
+        rowOffs.push_back(static_cast<localIdx>(values.size()));
+        rhs.push_back(rowSum);
+    }
+    CSRMatrix<scalar, localIdx> mtx(
+        Vector<scalar>(exec, values),
+        Vector<columnIdx>(exec, colIdxs),
+        Vector<localIdx>(exec, rowOffs)
+    );
+    return LinearSystem<scalar, localIdx>(mtx, Vector<scalar>(exec, rhs));
+}
+
+TEST_CASE("Krylov")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nRows = 100;
+
+    SECTION("Pipelined CG " + execName)
+    {
+        auto preconditioner = GENERATE(std::string {"jacobi"}, std::string {"none"});
+        auto ls = createTridiagonalSystem(exec, nRows, -1.0, -1.0);
+        Dictionary solverDict {
+            {{"solver", std::string {"Krylov"}},
+             {"method", std::string {"pipelinedCG"}},
+             {"preconditioner", preconditioner},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Solver solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.numIter < 1000);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        auto hostX = x.copyToHost();
+        for (auto value : hostX.view())
+        {
+            REQUIRE(value == Catch::Approx(1.0).margin(1e-7));
+        }
+    }
+
+    SECTION("Pipelined BiCGStab " + execName)
+    {
+        auto preconditioner = GENERATE(std::string {"jacobi"}, std::string {"none"});
+        auto ls = createTridiagonalSystem(exec, nRows, -1.5, -0.5);
+        Dictionary solverDict {
+            {{"solver", std::string {"Krylov"}},
+             {"method", std::string {"pipelinedBiCGStab"}},
+             {"preconditioner", preconditioner},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Solver solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.numIter < 1000);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        Vector<scalar> res(exec, nRows);
+        NeoN::la::computeResidual(ls.matrix(), ls.rhs(), x, res);
+        auto hostRes = res.copyToHost();
+        for (auto value : hostRes.view())
+        {
+            REQUIRE(value == Catch::Approx(0.0).margin(1e-7));
+        }
+    }
+
+    SECTION("Asynchronous CG " + execName)
+    {
+        auto ls = createTridiagonalSystem(exec, nRows, -1.0, -1.0);
+        Dictionary solverDict {
+            {{"solver", std::string {"Krylov"}},
+             {"method", std::string {"cg"}},
+             {"preconditioner", std::string {"jacobi"}},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Solver solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto pending = solver.solveAsync(ls, x);
+        // independent work of the caller overlaps with the solve
+        Vector<scalar> y(exec, nRows, 2.0);
+        auto stats = pending.get();
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        auto hostX = x.copyToHost();
+        for (auto value : hostX.view())
+        {
+            REQUIRE(value == Catch::Approx(1.0).margin(1e-7));
+        }
+    }
+
+    SECTION("CG " + execName)
+    {
+        auto preconditioner = GENERATE(std::string {"jacobi"}, std::string {"none"});
+        auto ls = createTridiagonalSystem(exec, nRows, -1.0, -1.0);
+        Dictionary solverDict {
+            {{"solver", std::string {"Krylov"}},
+             {"method", std::string {"cg"}},
+             {"preconditioner", preconditioner},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Solver solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        auto hostX = x.copyToHost();
+        for (auto value : hostX.view())
+        {
+            REQUIRE(value == Catch::Approx(1.0).margin(1e-7));
+        }
+    }
+
+    SECTION("BiCGStab and restarted GMRES " + execName)
+    {
+        auto method = GENERATE(std::string {"biCGStab"}, std::string {"gmres"});
+        auto preconditioner = GENERATE(std::string {"jacobi"}, std::string {"none"});
+        auto ls = createTridiagonalSystem(exec, nRows, -1.5, -0.5);
+        Dictionary solverDict {
+            {{"solver", std::string {"Krylov"}},
+             {"method", method},
+             {"preconditioner", preconditioner},
+             {"restart", 10},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Solver solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.numIter < 1000);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        Vector<scalar> res(exec, nRows);
+        NeoN::la::computeResidual(ls.matrix(), ls.rhs(), x, res);
+        auto hostRes = res.copyToHost();
+        for (auto value : hostRes.view())
+        {
+            REQUIRE(value == Catch::Approx(0.0).margin(1e-7));
+        }
+    }
+
+    SECTION("An exact initial guess needs no iterations " + execName)
+    {
+        auto ls = createTridiagonalSystem(exec, nRows, -1.0, -1.0);
+        Dictionary solverDict {{{"solver", std::string {"Krylov"}}}};
+        NeoN::la::Krylov solver(exec, solverDict);
+        REQUIRE(solver.method() == NeoN::la::KrylovMethod::PipelinedCG);
+
+        Vector<scalar> x(exec, nRows, 1.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter == 0);
+        REQUIRE(stats.finalResNorm == Catch::Approx(0.0).margin(1e-12));
+    }
+}
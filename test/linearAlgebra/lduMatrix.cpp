@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::Vector;
+using NeoN::la::CSRMatrix;
+using NeoN::la::LduMatrix;
+
+TEST_CASE("LduMatrix")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    const auto& sparsity = NeoN::la::SparsityPattern::readOrCreate(mesh);
+
+    SECTION("Create from mesh " + execName)
+    {
+        LduMatrix<scalar, localIdx> mtx(mesh);
+        REQUIRE(mtx.nRows() == nCells);
+        REQUIRE(mtx.nFaces() == mesh.nInternalFaces());
+        REQUIRE(mtx.nNonZeros() == sparsity.nnz());
+        REQUIRE(!mtx.symmetric());
+
+        LduMatrix<scalar, localIdx> symMtx(mesh, true);
+        REQUIRE(symMtx.symmetric());
+        REQUIRE(&symMtx.lower() == &symMtx.upper());
+    }
+
+    SECTION("Residual and spmv agree with the CSRMatrix " + execName)
+    {
+        auto symmetric = GENERATE(false, true);
+        LduMatrix<scalar, localIdx> mtx(mesh, symmetric);
+        NeoN::fill(mtx.diag(), 2.5);
+        NeoN::fill(mtx.upper(), -1.0);
+        if (!symmetric)
+        {
+            NeoN::fill(mtx.lower(), -0.5);
+        }
+        auto csr = mtx.toCSR(sparsity);
+        REQUIRE(csr.nNonZeros() == mtx.nNonZeros());
+
+        std::vector<scalar> xHost;
+        for (localIdx i = 0; i < nCells; i++)
+        {
+            xHost.push_back(1.0 + static_cast<scalar>(i));
+        }
+        Vector<scalar> x(exec, xHost);
+        Vector<scalar> b(exec, nCells, 1.0);
+        Vector<scalar> yLdu(exec, nCells, 0.0);
+        Vector<scalar> yCSR(exec, nCells, 0.0);
+
+        NeoN::la::spmv(mtx, x, yLdu);
+        NeoN::la::spmv(csr, x, yCSR);
+        auto [yLduHost, yCSRHost] = NeoN::copyToHosts(yLdu, yCSR);
+        // the interior rows are 2.5 x_i - x_{i+1} - lower x_{i-1}
+        const scalar lower = symmetric ? -1.0 : -0.5;
+        REQUIRE(yLduHost.view()[1] == Catch::Approx(2.5 * 2.0 - 3.0 + lower));
+        for (localIdx i = 0; i < nCells; i++)
+        {
+            REQUIRE(yLduHost.view()[i] == Catch::Approx(yCSRHost.view()[i]));
+        }
+
+        NeoN::la::computeResidual(mtx, b, x, yLdu);
+        NeoN::la::computeResidual(csr, b, x, yCSR);
+        auto [resLduHost, resCSRHost] = NeoN::copyToHosts(yLdu, yCSR);
+        for (localIdx i = 0; i < nCells; i++)
+        {
+            REQUIRE(resLduHost.view()[i] == Catch::Approx(resCSRHost.view()[i]));
+        }
+        auto lduNorms = NeoN::la::computeResidualNorms(mtx, b, x, yLdu);
+        auto csrNorms = NeoN::la::computeResidualNorms(csr, b, x, yCSR);
+        REQUIRE(lduNorms.l1 == Catch::Approx(csrNorms.l1));
+        REQUIRE(lduNorms.l2 == Catch::Approx(csrNorms.l2));
+        REQUIRE(lduNorms.linf == Catch::Approx(csrNorms.linf));
+
+        // extracting the coefficients of the CSRMatrix recovers the LduMatrix
+        LduMatrix<scalar, localIdx> extracted(csr, sparsity, mesh, symmetric);
+        auto [upperHost, lowerHost, diagHost] =
+            NeoN::copyToHosts(extracted.upper(), extracted.lower(), extracted.diag());
+        for (localIdx facei = 0; facei < extracted.nFaces(); facei++)
+        {
+            REQUIRE(upperHost.view()[facei] == -1.0);
+            REQUIRE(lowerHost.view()[facei] == lower);
+        }
+        for (localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(diagHost.view()[celli] == 2.5);
+        }
+    }
+}
@@ -12,6 +12,7 @@
 
 using NeoN::scalar;
 using NeoN::localIdx;
+using NeoN::columnIdx;
 using NeoN::Vector;
 using NeoN::la::LinearSystem;
 using NeoN::la::CSRMatrix;
@@ -21,7 +22,7 @@ TEST_CASE("LinearSystem")
     auto [execName, exec] = GENERATE(allAvailableExecutor());
 
     Vector<scalar> values(exec, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
-    Vector<localIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
+    Vector<columnIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
     Vector<localIdx> rowOffs(exec, {0, 3, 6, 9});
     CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
 
@@ -54,6 +55,47 @@ TEST_CASE("LinearSystem")
         REQUIRE(linearSystem.matrix().rowOffs().size() == nCells + 1);
         REQUIRE(linearSystem.matrix().nRows() == nCells);
         REQUIRE(linearSystem.rhs().size() == nCells);
+        REQUIRE(linearSystem.hasBoundaryCoefficients());
+        REQUIRE(linearSystem.boundaryCoefficients().matrixIdxs.size() == 2);
+    }
+
+    SECTION("reset values " + execName)
+    {
+        auto nCells = 10;
+        auto mesh = create1DUniformMesh(exec, nCells);
+
+        auto& ls = NeoN::la::readOrCreateLinearSystem<scalar, localIdx>(mesh);
+        NeoN::fill(ls.matrix().values(), 1.0);
+        NeoN::fill(ls.rhs(), 2.0);
+        NeoN::fill(ls.boundaryCoefficients().matrixValues, 3.0);
+        const auto* valuesPtr = ls.matrix().values().data();
+
+        // the second call returns the same linear system with zeroed values
+        auto& ls2 = NeoN::la::readOrCreateLinearSystem<scalar, localIdx>(mesh);
+        REQUIRE(&ls2 == &ls);
+
+        // every equation owns its linear system
+        auto& lsT = NeoN::la::readOrCreateLinearSystem<scalar, localIdx>(mesh, "T");
+        REQUIRE(&lsT != &ls);
+        REQUIRE(&NeoN::la::readOrCreateLinearSystem<scalar, localIdx>(mesh, "T") == &lsT);
+        REQUIRE(&NeoN::la::readOrCreateLinearSystem<scalar, localIdx>(mesh, "U") != &lsT);
+        REQUIRE(ls2.matrix().values().data() == valuesPtr);
+
+        auto valuesHost = ls2.matrix().values().copyToHost();
+        auto rhsHost = ls2.rhs().copyToHost();
+        auto bcCoeffsHost = ls2.boundaryCoefficients().copyToHost();
+        for (auto value : valuesHost.view())
+        {
+            REQUIRE(value == 0.0);
+        }
+        for (auto value : rhsHost.view())
+        {
+            REQUIRE(value == 0.0);
+        }
+        REQUIRE(bcCoeffsHost.matrixValues.view()[0] == 0.0);
+        // the first and last cell carry the boundary faces
+        REQUIRE(bcCoeffsHost.rhsIdxs.view()[0] == 0);
+        REQUIRE(bcCoeffsHost.rhsIdxs.view()[1] == nCells - 1);
     }
 
     SECTION("view read/write " + execName)
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <algorithm>
+#include <vector>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+#include "testSystems.hpp"
+
+using NeoN::Dictionary;
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::columnIdx;
+using NeoN::Vector;
+using NeoN::la::LinearSystem;
+using NeoN::la::CSRMatrix;
+
+/* @brief the matrix of a one dimensional Laplacian with tridiagonal entries -1 2 -1 */
+CSRMatrix<scalar, localIdx> createLaplacian(const NeoN::Executor& exec, localIdx nRows)
+{
+    std::vector<scalar> values;
+    std::vector<columnIdx> colIdxs;
+    std::vector<localIdx> rowOffs {0};
+    for (localIdx rowi = 0; rowi < nRows; rowi++)
+    {
+        if (rowi > 0)
+        {
+            values.push_back(-1.0);
+            colIdxs.push_back(static_cast<columnIdx>(rowi - 1));
+        }
+        values.push_back(2.0);
+        colIdxs.push_back(static_cast<columnIdx>(rowi));
+        if (rowi + 1 < nRows)
+        {
+            values.push_back(-1.0);
+            colIdxs.push_back(static_cast<columnIdx>(rowi + 1));
+        }
+        rowOffs.push_back(static_cast<localIdx>(values.size()));
+    }
+    return CSRMatrix<scalar, localIdx>(
+        Vector<scalar>(exec, values),
+        Vector<columnIdx>(exec, colIdxs),
+        Vector<localIdx>(exec, rowOffs)
+    );
+}
+
+TEST_CASE("Multigrid")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nRows = 64;
+    auto mtx = createLaplacian(exec, nRows);
+
+    SECTION("Pairwise aggregation builds Galerkin coarse operators " + execName)
+    {
+        NeoN::la::MultigridHierarchy hierarchy(mtx, NeoN::la::MultigridSettings {});
+
+        // 64 -> 32 -> 16 rows, the pairs of a tridiagonal matrix keep the stencil -1 2 -1
+        REQUIRE(hierarchy.nLevels() == 3);
+        const auto& coarse = hierarchy.level(1).matrix;
+        REQUIRE(coarse.nRows() == 32);
+        auto hostCoarse = coarse.copyToHost();
+        const auto [values, colIdxs, rowOffs] = hostCoarse.view();
+        REQUIRE(rowOffs[2] - rowOffs[1] == 3);
+        REQUIRE(values[rowOffs[1]] == -1.0);
+        REQUIRE(values[rowOffs[1] + 1] == 2.0);
+        REQUIRE(values[rowOffs[1] + 2] == -1.0);
+
+        // the hierarchy is kept, only the coarse values follow the new matrix values
+        NeoN::scalarMul(mtx.values(), 2.0);
+        hierarchy.refresh(mtx);
+        REQUIRE(hierarchy.level(1).matrix.values().copyToHost().view()[rowOffs[1] + 1] == 4.0);
+    }
+
+    SECTION("Solve and reuse the hierarchy " + execName)
+    {
+        Vector<scalar> rhs(exec, nRows, 1.0);
+        LinearSystem<scalar, localIdx> linearSystem(mtx, rhs);
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Multigrid"}}, {"maxIters", 50}, {"relTol", 1e-10}}
+        };
+        NeoN::la::Multigrid solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto stats = solver.solve(linearSystem, x);
+        REQUIRE(stats.numIter < 50);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+        const auto* hierarchy = solver.hierarchy();
+
+        // a new matrix with the same sparsity pattern refreshes the existing hierarchy
+        NeoN::scalarMul(linearSystem.matrix().values(), 2.0);
+        NeoN::fill(x, 0.0);
+        stats = solver.solve(linearSystem, x);
+        REQUIRE(solver.hierarchy() == hierarchy);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+
+        Vector<scalar> res(exec, nRows);
+        NeoN::la::computeResidual(linearSystem.matrix(), rhs, x, res);
+        auto hostRes = res.copyToHost();
+        for (auto value : hostRes.view())
+        {
+            REQUIRE(value == Catch::Approx(0.0).margin(1e-8));
+        }
+    }
+
+    SECTION("Rebuild the hierarchy for a new sparsity pattern " + execName)
+    {
+        Vector<scalar> rhs(exec, nRows, 1.0);
+        Dictionary solverDict {
+            {{"solver", std::string {"Multigrid"}}, {"maxIters", 50}, {"relTol", 1e-10}}
+        };
+        NeoN::la::Multigrid solver(exec, solverDict);
+        Vector<scalar> x(exec, nRows, 0.0);
+        solver.solve(LinearSystem<scalar, localIdx>(mtx, rhs), x);
+        const auto* hierarchy = solver.hierarchy();
+
+        // a copy of the pattern has new versions but the same entries
+        auto copy = createLaplacian(exec, nRows);
+        NeoN::fill(x, 0.0);
+        solver.solve(LinearSystem<scalar, localIdx>(copy, rhs), x);
+        REQUIRE(solver.hierarchy() == hierarchy);
+
+        // coupling the first and the last row keeps the number of rows and entries
+        auto periodic = createLaplacian(exec, nRows);
+        auto hostColIdxs = periodic.colIdxs().copyToHost();
+        hostColIdxs.view()[1] = static_cast<columnIdx>(nRows - 1);
+        hostColIdxs.view()[hostColIdxs.size() - 2] = 0;
+        periodic.colIdxs() = hostColIdxs.copyToExecutor(exec);
+        NeoN::fill(x, 0.0);
+        auto stats = solver.solve(LinearSystem<scalar, localIdx>(periodic, rhs), x);
+        REQUIRE(solver.hierarchy() != hierarchy);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+    }
+
+    SECTION("Gauss-Seidel smoothers " + execName)
+    {
+        auto smoother = GENERATE(std::string {"gaussSeidel"}, std::string {"symmetricGaussSeidel"});
+        Vector<scalar> rhs(exec, nRows, 1.0);
+        LinearSystem<scalar, localIdx> linearSystem(mtx, rhs);
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Multigrid"}},
+             {"smoother", smoother},
+             {"maxIters", 50},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Multigrid solver(exec, solverDict);
+
+        Vector<scalar> x(exec, nRows, 0.0);
+        auto stats = solver.solve(linearSystem, x);
+        REQUIRE(stats.numIter < 50);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+        // the tridiagonal matrix is colored red and black
+        REQUIRE(solver.hierarchy()->level(0).coloring.nColors() == 2);
+    }
+
+    SECTION("Agglomerate the cells across their largest faces " + execName)
+    {
+        // the faces normal to y are the largest, hence the cells are paired in y direction
+        auto mesh = NeoN::create3DUniformMesh(exec, 4, 8, 4);
+        const auto& agglomeration = NeoN::la::FaceAgglomeration::readOrCreate(mesh);
+        REQUIRE(&agglomeration == &NeoN::la::FaceAgglomeration::readOrCreate(mesh));
+        REQUIRE(agglomeration.nLevels() > 1);
+        const auto& aggregates = agglomeration.aggregates(0);
+        REQUIRE(aggregates.size() == static_cast<std::size_t>(mesh.nCells()));
+        REQUIRE(aggregates[0] == aggregates[4]);
+        REQUIRE(aggregates[0] != aggregates[1]);
+        REQUIRE(*std::max_element(aggregates.begin(), aggregates.end()) + 1 == mesh.nCells() / 2);
+
+        auto ls = NeoN::la::createDiagonallyDominantLaplacian(mesh);
+
+        Dictionary solverDict {
+            {{"solver", std::string {"Multigrid"}},
+             {"agglomeration", std::string {"faceArea"}},
+             {"smoother", std::string {"gaussSeidel"}},
+             {"relTol", 1e-10}}
+        };
+        NeoN::la::Multigrid solver(exec, solverDict);
+        Vector<scalar> x(exec, mesh.nCells(), 0.0);
+        auto stats = solver.solve(ls, x);
+        REQUIRE(stats.numIter < 100);
+        REQUIRE(stats.finalResNorm <= 1e-10 * stats.initResNorm);
+        REQUIRE(solver.hierarchy()->level(1).matrix.nRows() == mesh.nCells() / 2);
+    }
+}
@@ -20,6 +20,7 @@ using NeoN::Executor;
 using NeoN::Dictionary;
 using NeoN::scalar;
 using NeoN::localIdx;
+using NeoN::columnIdx;
 using NeoN::Vector;
 using NeoN::la::LinearSystem;
 using NeoN::la::CSRMatrix;
@@ -45,7 +46,7 @@ TEST_CASE("MatrixAssembly - Petsc")
 
         Vector<NeoN::scalar> values(exec, {10.0, 4.0, 7.0, 2.0, 10.0, 8.0, 3.0, 6.0, 10.0});
         // TODO work on support for unsingned types
-        Vector<localIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
+        Vector<columnIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
         Vector<localIdx> rowOffs(exec, {0, 3, 6, 9});
         CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
 
@@ -65,10 +66,47 @@ TEST_CASE("MatrixAssembly - Petsc")
 
         auto hostX = x.copyToHost();
         auto hostXS = hostX.view();
-        REQUIRE((hostXS[0]) == Catch::Approx(3. / 205.).margin(1e-8));
-        REQUIRE((hostXS[1]) == Catch::Approx(8. / 205.).margin(1e-8));
-        REQUIRE((hostXS[2]) == Catch::Approx(53. / 205.).margin(1e-8));
+        REQUIRE((hostXS[0]) == Catch::Approx(-29. / 205.).margin(1e-8));
+        REQUIRE((hostXS[1]) == Catch::Approx(-18. / 205.).margin(1e-8));
+        REQUIRE((hostXS[2]) == Catch::Approx(81. / 205.).margin(1e-8));
 
+        SECTION("Reuse preallocation " + execName)
+        {
+            // only the values change, the solver sets them on the existing PETSc matrix
+            linearSystem.matrix().values() = values * 2.0;
+            linearSystem.rhs() = rhs;
+
+            solver.solve(linearSystem, x);
+
+            auto hostX2 = x.copyToHost();
+            auto hostX2S = hostX2.view();
+            REQUIRE((hostX2S[0]) == Catch::Approx(-14.5 / 205.).margin(1e-8));
+            REQUIRE((hostX2S[1]) == Catch::Approx(-9. / 205.).margin(1e-8));
+            REQUIRE((hostX2S[2]) == Catch::Approx(40.5 / 205.).margin(1e-8));
+        }
+
+        SECTION("Reuse preconditioner " + execName)
+        {
+            NeoN::Dictionary reuseDict {{
+                {"solver", std::string {"Petsc"}},
+                {"reusePreconditioner", 2},
+                {"initialGuessNonzero", true},
+            }};
+            NeoN::la::petsc::petscSolver reuseSolver(exec, reuseDict);
+            REQUIRE(reuseSolver.nPreconditionerSetups() == 0);
+
+            // the preconditioner of the first solve is reused by the second, the third sets up
+            // a new one, the solution of the previous solve is the initial guess
+            for (int i = 0; i < 3; i++)
+            {
+                reuseSolver.solve(linearSystem, x);
+                auto hostXR = x.copyToHost();
+                auto hostXRS = hostXR.view();
+                REQUIRE((hostXRS[0]) == Catch::Approx(-29. / 205.).margin(1e-8));
+                REQUIRE((hostXRS[2]) == Catch::Approx(81. / 205.).margin(1e-8));
+            }
+            REQUIRE(reuseSolver.nPreconditionerSetups() == 2);
+        }
 
         SECTION("Solve linear system second time " + execName)
         {
@@ -77,7 +115,7 @@ TEST_CASE("MatrixAssembly - Petsc")
                 exec, {10.0, 2.0, 3.0, 5.0, 20.0, 2.0, 4.0, 4.0, 30.0}
             );
 
-            Vector<localIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
+            Vector<columnIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
             Vector<localIdx> rowOffs(exec, {0, 3, 6, 9});
             CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
 
@@ -97,9 +135,9 @@ TEST_CASE("MatrixAssembly - Petsc")
 
             auto hostX = x.copyToHost();
             auto hostXS = hostX.view();
-            REQUIRE((hostXS[0]) == Catch::Approx(8. / 341.).margin(1e-8));
-            REQUIRE((hostXS[1]) == Catch::Approx(27. / 341.).margin(1e-8));
-            REQUIRE((hostXS[2]) == Catch::Approx(63. / 682.).margin(1e-8));
+            REQUIRE((hostXS[0]) == Catch::Approx(41. / 682.).margin(1e-8));
+            REQUIRE((hostXS[1]) == Catch::Approx(419. / 5456.).margin(1e-8));
+            REQUIRE((hostXS[2]) == Catch::Approx(223. / 2728.).margin(1e-8));
         }
     }
 }
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::columnIdx;
+using NeoN::Vector;
+using NeoN::la::CSRMatrix;
+using NeoN::la::SlicedEllMatrix;
+
+TEST_CASE("SlicedEllMatrix")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // [ 1 0 2 ]
+    // [ 0 3 0 ]
+    // [ 4 5 6 ]
+    Vector<scalar> values(exec, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    Vector<columnIdx> colIdxs(exec, {0, 2, 1, 0, 1, 2});
+    Vector<localIdx> rowOffs(exec, {0, 2, 3, 6});
+    CSRMatrix<scalar, localIdx> csrMatrix(values, colIdxs, rowOffs);
+
+    SECTION("Convert from CSRMatrix " + execName)
+    {
+        SlicedEllMatrix<scalar, localIdx> ellMatrix(csrMatrix, 2);
+
+        REQUIRE(ellMatrix.nRows() == 3);
+        REQUIRE(ellMatrix.nSlices() == 2);
+        // the first slice stores two entries per row, the second slice three
+        REQUIRE(ellMatrix.nStored() == 2 * 2 + 3 * 2);
+
+        auto sliceSetsHost = ellMatrix.sliceSets().copyToHost();
+        REQUIRE(sliceSetsHost.view()[0] == 0);
+        REQUIRE(sliceSetsHost.view()[1] == 2);
+        REQUIRE(sliceSetsHost.view()[2] == 5);
+
+        // column major within the first slice, padding in column zero
+        auto valuesHost = ellMatrix.values().copyToHost();
+        auto colIdxsHost = ellMatrix.colIdxs().copyToHost();
+        REQUIRE(valuesHost.view()[0] == 1.0);
+        REQUIRE(valuesHost.view()[1] == 3.0);
+        REQUIRE(valuesHost.view()[2] == 2.0);
+        REQUIRE(valuesHost.view()[3] == 0.0);
+        REQUIRE(colIdxsHost.view()[2] == 2);
+        REQUIRE(colIdxsHost.view()[3] == 0);
+        // the padded row of the second slice remains zero
+        REQUIRE(valuesHost.view()[4] == 4.0);
+        REQUIRE(valuesHost.view()[5] == 0.0);
+    }
+
+    SECTION("Compute residual and spmv " + execName)
+    {
+        auto sliceSize = GENERATE(localIdx(1), localIdx(2), localIdx(64));
+        SlicedEllMatrix<scalar, localIdx> ellMatrix(csrMatrix, sliceSize);
+
+        Vector<scalar> rhs(exec, 3, 2.0);
+        Vector<scalar> x(exec, {1.0, 2.0, 3.0});
+        Vector<scalar> resCSR(exec, 3, 0.0);
+        Vector<scalar> resEll(exec, 3, 0.0);
+
+        NeoN::la::computeResidual(csrMatrix, rhs, x, resCSR);
+        NeoN::la::computeResidual(ellMatrix, rhs, x, resEll);
+
+        auto resCSRHost = resCSR.copyToHost();
+        auto resEllHost = resEll.copyToHost();
+        REQUIRE(resEllHost.view()[0] == 5.0);
+        REQUIRE(resEllHost.view()[1] == 4.0);
+        REQUIRE(resEllHost.view()[2] == 30.0);
+        for (localIdx i = 0; i < 3; i++)
+        {
+            REQUIRE(resEllHost.view()[i] == resCSRHost.view()[i]);
+        }
+
+        Vector<scalar> yCSR(exec, 3, 0.0);
+        Vector<scalar> yEll(exec, 3, 0.0);
+        NeoN::la::spmv(csrMatrix, x, yCSR);
+        NeoN::la::spmv(ellMatrix, x, yEll);
+
+        auto yCSRHost = yCSR.copyToHost();
+        auto yEllHost = yEll.copyToHost();
+        REQUIRE(yEllHost.view()[0] == 7.0);
+        REQUIRE(yEllHost.view()[1] == 6.0);
+        REQUIRE(yEllHost.view()[2] == 32.0);
+        for (localIdx i = 0; i < 3; i++)
+        {
+            REQUIRE(yEllHost.view()[i] == yCSRHost.view()[i]);
+        }
+    }
+}
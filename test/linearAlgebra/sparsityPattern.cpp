@@ -4,6 +4,8 @@
 
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
+#include <type_traits>
+#include <vector>
 
 #include "catch2_common.hpp"
 
@@ -91,6 +93,88 @@ TEST_CASE("SparsityPattern")
         REQUIRE(colIdxHS[9] == 3);
         REQUIRE(colIdxHS[10] == 4);
     }
+
+    SECTION("Parallel and serial construction agree " + execName)
+    {
+        auto spSerial = SparsityPattern(exec, nCells, nCells + 2 * nFaces);
+        auto spParallel = SparsityPattern(exec, nCells, nCells + 2 * nFaces);
+        NeoN::la::updateSparsityPatternSerial(mesh, spSerial);
+        NeoN::la::updateSparsityPatternParallel(mesh, spParallel);
+
+        REQUIRE(equal(spSerial.rowOffs(), spParallel.rowOffs()));
+        REQUIRE(equal(spSerial.colIdxs(), spParallel.colIdxs()));
+
+        REQUIRE(equal(spSerial.ownerOffset(), spParallel.ownerOffset()));
+        REQUIRE(equal(spSerial.neighbourOffset(), spParallel.neighbourOffset()));
+        REQUIRE(equal(spSerial.diagOffset(), spParallel.diagOffset()));
+    }
+
+    SECTION("Incremental updates agree with the pattern of the changed mesh " + execName)
+    {
+        NeoN::la::IncrementalSparsityPattern incremental(mesh);
+        REQUIRE(equal(incremental.pattern().colIdxs(), sp.colIdxs()));
+        REQUIRE(incremental.capacity() == nCells + 2 * nFaces + 2 * nCells);
+
+        const Vector<localIdx> none(exec, 0);
+        auto unchanged = incremental.update(mesh, none, none);
+        REQUIRE(unchanged.nTouchedRows == 0);
+        REQUIRE(!unchanged.rowOffsChanged);
+        REQUIRE(unchanged.invalidated.empty());
+
+        // two cells are appended to the right, the faces of the old mesh keep their index
+        auto extended = create1DUniformMesh(exec, nCells + 2);
+        const Vector<localIdx> changedFaces(exec, std::vector<localIdx> {9, 10});
+        auto result = incremental.update(extended, none, changedFaces);
+        REQUIRE(result.nTouchedRows == 3);
+        REQUIRE(result.rowOffsChanged);
+        REQUIRE(!result.rebuilt);
+
+        auto expected = NeoN::la::createSparsity(extended);
+        const auto& patched = incremental.pattern();
+        REQUIRE(equal(patched.rowOffs(), expected.rowOffs()));
+        REQUIRE(equal(patched.colIdxs(), expected.colIdxs()));
+        REQUIRE(equal(patched.ownerOffset(), expected.ownerOffset()));
+        REQUIRE(equal(patched.neighbourOffset(), expected.neighbourOffset()));
+        REQUIRE(equal(patched.diagOffset(), expected.diagOffset()));
+
+        // without slack the grown row exceeds its capacity
+        NeoN::la::IncrementalSparsityPattern tight(mesh, 0);
+        REQUIRE(tight.update(extended, none, changedFaces).rebuilt);
+        REQUIRE(equal(tight.pattern().colIdxs(), expected.colIdxs()));
+    }
+}
+
+#ifdef NeoN_DP_LOCAL_IDX
+TEST_CASE("SparsityPattern - 32 bit column indices")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto nCells = 10;
+    auto mesh = create1DUniformMesh(exec, nCells);
+
+    SECTION("The matrix of the linear system stores 32 bit column indices " + execName)
+    {
+        STATIC_REQUIRE(sizeof(columnIdx) == 4);
+        STATIC_REQUIRE(sizeof(localIdx) == 8);
+
+        const auto& sp = NeoN::la::SparsityPattern::readOrCreate(mesh);
+        auto& ls = NeoN::la::readOrCreateLinearSystem<scalar, localIdx>(mesh);
+        using ColumnIdxType = std::remove_cvref_t<decltype(ls.matrix())>::ColumnIdxType;
+        STATIC_REQUIRE(std::is_same_v<ColumnIdxType, columnIdx>);
+        REQUIRE(equal(ls.matrix().colIdxs(), sp.colIdxs()));
+
+        // the row sums of the 1D stencil [1 2 1] applied to a constant vector
+        ls.matrix().values() = 1.0;
+        Vector<scalar> rhs(exec, nCells, 0.0);
+        Vector<scalar> x(exec, nCells, 1.0);
+        Vector<scalar> res(exec, nCells, 0.0);
+        NeoN::la::computeResidual(ls.matrix(), rhs, x, res);
+        auto resHost = res.copyToHost();
+        REQUIRE(resHost.view()[0] == 2.0);
+        REQUIRE(resHost.view()[1] == 3.0);
+        REQUIRE(resHost.view()[nCells - 1] == 2.0);
+    }
 }
+#endif
 
 }
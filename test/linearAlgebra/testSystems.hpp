@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+
+namespace NeoN::la
+{
+
+/* @brief a diagonally dominant Laplacian on the sparsity pattern of the mesh
+ *
+ * The off diagonal entries are -1, the diagonal entry is the number of entries of the row and
+ * the right hand side is one.
+ */
+inline LinearSystem<scalar, localIdx>
+createDiagonallyDominantLaplacian(const UnstructuredMesh& mesh)
+{
+    auto ls = createEmptyLinearSystem<scalar, localIdx>(mesh, SparsityPattern::readOrCreate(mesh));
+    auto hostColIdxs = ls.matrix().colIdxs().copyToHost();
+    auto hostRowOffs = ls.matrix().rowOffs().copyToHost();
+    const auto [colIdxs, rowOffs] = views(hostColIdxs, hostRowOffs);
+    std::vector<scalar> values(colIdxs.size());
+    for (localIdx rowi = 0; rowi < mesh.nCells(); rowi++)
+    {
+        for (auto k = rowOffs[rowi]; k < rowOffs[rowi + 1]; k++)
+        {
+            const auto nEntries = scalar(rowOffs[rowi + 1] - rowOffs[rowi]);
+            values[static_cast<std::size_t>(k)] = colIdxs[k] == rowi ? nEntries : -1.0;
+        }
+    }
+    ls.matrix().values() = Vector<scalar>(mesh.exec(), values);
+    fill(ls.rhs(), 1.0);
+    return ls;
+}
+
+}
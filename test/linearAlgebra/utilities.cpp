@@ -4,6 +4,7 @@
 
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
+#include <cmath>
 #include <string>
 
 #include "catch2_common.hpp"
@@ -12,6 +13,7 @@
 
 using NeoN::scalar;
 using NeoN::localIdx;
+using NeoN::columnIdx;
 using NeoN::Vector;
 using NeoN::la::LinearSystem;
 using NeoN::la::CSRMatrix;
@@ -24,7 +26,7 @@ TEST_CASE("Utilities")
     // [ 4 5 6 ] x [1] - [2] = [15]  - [2]
     // [ 7 8 9 ]   [1]   [2]   [24]    [2]
     Vector<scalar> values(exec, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
-    Vector<localIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
+    Vector<columnIdx> colIdx(exec, {0, 1, 2, 0, 1, 2, 0, 1, 2});
     Vector<localIdx> rowOffs(exec, {0, 3, 6, 9});
     CSRMatrix<scalar, localIdx> csrMatrix(values, colIdx, rowOffs);
 
@@ -43,4 +45,29 @@ TEST_CASE("Utilities")
         REQUIRE(resHost.view()[1] == 13.0);
         REQUIRE(resHost.view()[2] == 22.0);
     }
+
+    SECTION("Can compute residual and norms in a single pass on " + execName)
+    {
+        Vector<scalar> rhs(exec, 3, 2.0);
+        Vector<scalar> x(exec, 3, 1.0);
+        Vector<scalar> res(exec, 3, 0.0);
+
+        auto checkNorms = [&](const NeoN::la::ResidualNorms& norms)
+        {
+            REQUIRE(norms.l1 == Catch::Approx(39.0));
+            REQUIRE(norms.l2 == Catch::Approx(std::sqrt(669.0)));
+            REQUIRE(norms.linf == Catch::Approx(22.0));
+            auto resHost = res.copyToHost();
+            REQUIRE(resHost.view()[0] == 4.0);
+            REQUIRE(resHost.view()[1] == 13.0);
+            REQUIRE(resHost.view()[2] == 22.0);
+        };
+
+        checkNorms(NeoN::la::computeResidualNorms(csrMatrix, rhs, x, res));
+        checkNorms(NeoN::la::computeNorms(res));
+
+        NeoN::fill(res, 0.0);
+        NeoN::la::SlicedEllMatrix<scalar, localIdx> ellMatrix(csrMatrix, 2);
+        checkNorms(NeoN::la::computeResidualNorms(ellMatrix, rhs, x, res));
+    }
 }
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <memory>
+#include <vector>
+
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+using NeoN::localIdx;
+using NeoN::scalar;
+
+TEST_CASE("ActiveRegion")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // the left half of ten cells is active
+    auto mesh = NeoN::create1DUniformMesh(exec, 10);
+    const NeoN::Vector<localIdx> mask(exec, std::vector<localIdx> {1, 1, 1, 1, 1, 0, 0, 0, 0, 0});
+    auto region = std::make_shared<NeoN::ActiveRegion>(mesh, mask);
+
+    SECTION("The index lists are compacted " + execName)
+    {
+        REQUIRE(region->nActiveCells() == 5);
+        REQUIRE(region->version() == 1);
+        auto activeCells = region->activeCells().copyToHost();
+        auto inactiveCells = region->inactiveCells().copyToHost();
+        for (localIdx i = 0; i < 5; i++)
+        {
+            REQUIRE(activeCells.view()[i] == i);
+            REQUIRE(inactiveCells.view()[i] == i + 5);
+        }
+
+        // the internal faces up to the one between cell 4 and 5 and the left boundary face
+        auto activeFaces = region->activeFaces().copyToHost();
+        REQUIRE(activeFaces.size() == 6);
+        REQUIRE(activeFaces.view()[4] == 4);
+        REQUIRE(activeFaces.view()[5] == mesh.nInternalFaces());
+
+        const NeoN::Vector<localIdx> allActive(exec, 10, 1);
+        region->update(mesh, allActive);
+        REQUIRE(region->nActiveCells() == 10);
+        REQUIRE(region->inactiveCells().size() == 0);
+        REQUIRE(region->activeFaces().size() == mesh.nFaces());
+        REQUIRE(region->version() == 2);
+    }
+
+    SECTION("The face reductions skip the inactive cells " + execName)
+    {
+        mesh.setActiveRegion(region);
+        REQUIRE(mesh.activeRegion() == region.get());
+        REQUIRE(fvcc::faceReduction(mesh) == fvcc::FaceReduction::Gather);
+
+        NeoN::Vector<scalar> res(exec, 10, -1.0);
+        fvcc::reduceFaceValues(
+            mesh, res.view(), KOKKOS_LAMBDA(const localIdx) { return 1.0; }, false
+        );
+        auto hostRes = res.copyToHost();
+        for (localIdx celli = 0; celli < 10; celli++)
+        {
+            // every cell of the 1D mesh has two faces, the inactive cells keep their value
+            REQUIRE(hostRes.view()[celli] == (celli < 5 ? 1.0 : -1.0));
+        }
+
+        mesh.setActiveRegion(nullptr);
+        REQUIRE(mesh.activeRegion() == nullptr);
+    }
+
+    SECTION("The rows of the inactive cells are frozen " + execName)
+    {
+        auto ls = NeoN::la::createEmptyLinearSystem<scalar, localIdx>(
+            mesh, NeoN::la::SparsityPattern::readOrCreate(mesh)
+        );
+        NeoN::fill(ls.matrix().values(), 2.0);
+        NeoN::fill(ls.rhs(), 3.0);
+        const NeoN::Vector<scalar> values(exec, 10, 7.0);
+
+        // without an active region the system is unchanged
+        NeoN::la::freezeInactiveRows(ls, mesh, values);
+        REQUIRE(ls.rhs().copyToHost().view()[7] == 3.0);
+
+        mesh.setActiveRegion(region);
+        NeoN::la::freezeInactiveRows(ls, mesh, values);
+        auto hostValues = ls.matrix().values().copyToHost();
+        auto hostColIdxs = ls.matrix().colIdxs().copyToHost();
+        auto hostRowOffs = ls.matrix().rowOffs().copyToHost();
+        auto hostRhs = ls.rhs().copyToHost();
+        for (localIdx rowi = 0; rowi < 10; rowi++)
+        {
+            const bool frozen = rowi >= 5;
+            for (auto j = hostRowOffs.view()[rowi]; j < hostRowOffs.view()[rowi + 1]; j++)
+            {
+                const bool diag = hostColIdxs.view()[j] == rowi;
+                REQUIRE(hostValues.view()[j] == (frozen ? (diag ? 1.0 : 0.0) : 2.0));
+            }
+            REQUIRE(hostRhs.view()[rowi] == (frozen ? 7.0 : 3.0));
+        }
+    }
+}
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 // #include <source_location>
+#include <sstream>
 
 #include "catch2_common.hpp"
 
@@ -61,3 +62,468 @@ TEST_CASE("Communicator Vector Synchronization")
         REQUIRE(field(rank + 2 * mpiEnviron.sizeRank()) == static_cast<int>(mpiEnviron.rank()));
     }
 }
+
+TEST_CASE("Communicator flattened maps")
+{
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        rankSendMap[rank].emplace_back(NodeCommMap {.local_idx = static_cast<label>(rank)});
+        NodeCommMap newNode({.local_idx = static_cast<label>(2 * nRanks + rank)});
+        rankReceiveMap[rank].push_back(newNode);
+    }
+
+    SECTION("flatten")
+    {
+        const auto flat = flatten(rankReceiveMap);
+        REQUIRE(flat.rankOffsets.size() == nRanks + 1);
+        REQUIRE(flat.indices.size() == nRanks);
+        for (size_t rank = 0; rank < nRanks; rank++)
+        {
+            REQUIRE(flat.rankOffsets[rank] == static_cast<localIdx>(rank));
+            REQUIRE(flat.indices[rank] == static_cast<localIdx>(2 * nRanks + rank));
+        }
+        REQUIRE(flat.rankOffsets.back() == static_cast<localIdx>(nRanks));
+    }
+
+    SECTION("Communicator")
+    {
+        Vector<int> field(SerialExecutor(), 3 * nRanks, 0);
+        for (size_t rank = 0; rank < nRanks; rank++)
+        {
+            field(rank) = static_cast<int>(rank);
+        }
+        Communicator comm(mpiEnviron, flatten(rankSendMap), flatten(rankReceiveMap));
+        comm.startComm(field, "flat");
+        comm.finaliseComm(field, "flat");
+        for (size_t rank = 0; rank < nRanks; rank++)
+        {
+            REQUIRE(field(rank + 2 * nRanks) == static_cast<int>(mpiEnviron.rank()));
+        }
+    }
+}
+
+TEST_CASE("Communicator Vector Synchronization on Executor")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+
+    // same layout as above: send block, untouched block, receive block
+    std::vector<int> hostField(3 * nRanks, 0);
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        hostField[rank] = static_cast<int>(rank);
+        hostField[rank + nRanks] = static_cast<int>(nRanks + rank);
+        rankSendMap[rank].emplace_back(NodeCommMap {.local_idx = static_cast<label>(rank)});
+        rankReceiveMap[rank].emplace_back(
+            NodeCommMap {.local_idx = static_cast<label>(2 * nRanks + rank)}
+        );
+    }
+    Vector<int> field(exec, hostField);
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    // communicate twice to exercise the buffer and index reuse
+    for (int i = 0; i < 2; i++)
+    {
+        std::string loc = "bar";
+        comm.startComm(field, loc);
+        comm.finaliseComm(field, loc);
+    }
+
+    auto fieldHost = field.copyToHost();
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        REQUIRE(fieldHost(rank) == static_cast<int>(rank));
+        REQUIRE(fieldHost(rank + nRanks) == static_cast<int>(nRanks + rank));
+        REQUIRE(fieldHost(rank + 2 * nRanks) == static_cast<int>(mpiEnviron.rank()));
+    }
+}
+
+TEST_CASE("Communicator split-phase exchange")
+{
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+
+    Vector<int> field(SerialExecutor(), 2 * nRanks, 0);
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        field(rank) = static_cast<int>(mpiEnviron.rank());
+        rankSendMap[rank].emplace_back(NodeCommMap {.local_idx = static_cast<label>(rank)});
+        rankReceiveMap[rank].emplace_back(
+            NodeCommMap {.local_idx = static_cast<label>(nRanks + rank)}
+        );
+    }
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    int interiorSum = 0;
+    int haloSum = 0;
+    splitPhaseComm(
+        comm,
+        field,
+        "split",
+        [&]()
+        {
+            for (size_t rank = 0; rank < nRanks; rank++)
+                interiorSum += field(rank);
+        },
+        [&]()
+        {
+            for (size_t rank = 0; rank < nRanks; rank++)
+                haloSum += field(nRanks + rank);
+        }
+    );
+
+    REQUIRE(interiorSum == static_cast<int>(nRanks * mpiEnviron.rank()));
+    REQUIRE(haloSum == static_cast<int>(nRanks * (nRanks - 1) / 2));
+}
+
+TEST_CASE("Communicator reserved buffer")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+
+    std::vector<scalar> hostField(2 * nRanks, 0.0);
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        hostField[rank] = static_cast<scalar>(mpiEnviron.rank());
+        rankSendMap[rank].emplace_back(NodeCommMap {.local_idx = static_cast<label>(rank)});
+        rankReceiveMap[rank].emplace_back(
+            NodeCommMap {.local_idx = static_cast<label>(nRanks + rank)}
+        );
+    }
+    Vector<scalar> field(exec, hostField);
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    comm.reserveComm<scalar>("reserved", exec);
+    for (int i = 0; i < 3; i++)
+    {
+        comm.startComm(field, "reserved");
+        comm.finaliseComm(field, "reserved");
+    }
+
+    auto fieldHost = field.copyToHost();
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        REQUIRE(fieldHost(nRanks + rank) == static_cast<scalar>(rank));
+    }
+}
+
+TEST_CASE("Communicator statistics")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t rank = 0; rank < nRanks; rank++)
+    {
+        rankSendMap[rank].emplace_back(NodeCommMap {.local_idx = static_cast<label>(rank)});
+        rankReceiveMap[rank].emplace_back(
+            NodeCommMap {.local_idx = static_cast<label>(nRanks + rank)}
+        );
+    }
+    Vector<scalar> field(exec, static_cast<localIdx>(2 * nRanks), 1.0);
+
+    auto& timers = TimerRegistry::instance();
+    timers.reset();
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    for (int i = 0; i < 2; i++)
+    {
+        comm.startComm(field, "stats");
+        comm.isComplete("stats");
+        comm.finaliseComm(field, "stats");
+    }
+
+    const auto& stats = comm.statistics("stats");
+    REQUIRE(stats.exchanges == 2);
+    REQUIRE(stats.bytesSent == 2 * nRanks * sizeof(scalar));
+    REQUIRE(stats.bytesReceived == 2 * nRanks * sizeof(scalar));
+    REQUIRE(stats.messagesSent == 2 * nRanks);
+    REQUIRE(stats.messagesReceived == 2 * nRanks);
+    REQUIRE(stats.neighbours == nRanks);
+    REQUIRE(stats.incompleteTests <= 2);
+    REQUIRE(comm.statistics().size() == 1);
+
+    std::stringstream report;
+    timers.report(report);
+    REQUIRE(report.str().find("[bytesSent]") != std::string::npos);
+    REQUIRE(report.str().find("unpack") != std::string::npos);
+    timers.reset();
+}
+
+TEST_CASE("Communicator single precision exchange")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = static_cast<scalar>(mpiEnviron.rank());
+
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t i = 0; i < nRanks; i++)
+    {
+        rankSendMap[i].emplace_back(NodeCommMap {.local_idx = static_cast<label>(i)});
+        rankReceiveMap[i].emplace_back(NodeCommMap {.local_idx = static_cast<label>(nRanks + i)});
+    }
+    // a value which is not exactly representable in single precision
+    const scalar value = 1.0 / 3.0;
+    Vector<scalar> field(exec, static_cast<localIdx>(2 * nRanks), value + rank);
+    Vector<Vec3> vecField(exec, static_cast<localIdx>(2 * nRanks), Vec3(value + rank, rank, 1.0));
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    comm.setPrecision("single", CommPrecision::Single);
+    REQUIRE(comm.precision("single") == CommPrecision::Single);
+    REQUIRE(comm.precision("other") == CommPrecision::Full);
+    for (int i = 0; i < 2; i++)
+    {
+        comm.startComm(field, "single");
+        comm.finaliseComm(field, "single");
+        comm.startComm(vecField, "single");
+        comm.finaliseComm(vecField, "single");
+    }
+
+    const auto& stats = comm.statistics("single");
+    const auto scalarBytes = 2 * nRanks * sizeof(detail::SinglePrecision<scalar>::type);
+    const auto vecBytes = 2 * nRanks * sizeof(detail::SinglePrecision<Vec3>::type);
+    REQUIRE(stats.bytesSent == scalarBytes + vecBytes);
+    REQUIRE(sizeof(detail::SinglePrecision<Vec3>::type) == 3 * sizeof(float));
+
+    auto fieldHost = field.copyToHost();
+    auto vecFieldHost = vecField.copyToHost();
+    for (size_t i = 0; i < nRanks; i++)
+    {
+        const auto expected = value + static_cast<scalar>(i);
+        REQUIRE(fieldHost(nRanks + i) == Catch::Approx(expected).epsilon(1e-6));
+        REQUIRE(vecFieldHost(nRanks + i)[0] == Catch::Approx(expected).epsilon(1e-6));
+        REQUIRE(vecFieldHost(nRanks + i)[1] == static_cast<scalar>(i));
+        REQUIRE(vecFieldHost(nRanks + i)[2] == 1.0);
+    }
+}
+
+TEST_CASE("Communicator neighbourhood collectives")
+{
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = mpiEnviron.rank();
+
+    // a ring, every rank only sends to the next and receives from the previous rank
+    const auto next = (rank + 1) % nRanks;
+    const auto previous = (rank + nRanks - 1) % nRanks;
+    Vector<int> field(SerialExecutor(), 2, -1);
+    field(0) = static_cast<int>(rank);
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    rankSendMap[next].emplace_back(NodeCommMap {.local_idx = 0});
+    rankReceiveMap[previous].emplace_back(NodeCommMap {.local_idx = 1});
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    comm.setNeighbourhoodCollectives(true);
+    for (int i = 0; i < 2; i++)
+    {
+        comm.startComm(field, "ring");
+        comm.finaliseComm(field, "ring");
+    }
+
+    REQUIRE(field(1) == static_cast<int>(previous));
+}
+
+TEST_CASE("Communicator shared memory exchange")
+{
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = mpiEnviron.rank();
+
+    // all ranks exchange with each other, the ranks of a node through shared memory
+    std::vector<scalar> hostScalar(2 * nRanks, -1.0);
+    std::vector<Vec3> hostVec3(2 * nRanks, Vec3(-1.0, -1.0, -1.0));
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        hostScalar[r] = static_cast<scalar>(rank);
+        hostVec3[r] = Vec3(static_cast<scalar>(rank), static_cast<scalar>(r), 1.0);
+        rankSendMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(r)});
+        rankReceiveMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(nRanks + r)});
+    }
+    Vector<scalar> scalarField(SerialExecutor(), hostScalar);
+    Vector<Vec3> vec3Field(SerialExecutor(), hostVec3);
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    comm.setSharedMemoryExchange(true);
+    for (int i = 0; i < 3; i++)
+    {
+        comm.startComm(scalarField, "shared");
+        comm.finaliseComm(scalarField, "shared");
+        // a larger value type in the buffer of the scalar exchange
+        comm.startComm(vec3Field, "shared");
+        comm.finaliseComm(vec3Field, "shared");
+    }
+
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        REQUIRE(scalarField(nRanks + r) == static_cast<scalar>(r));
+        REQUIRE(vec3Field(nRanks + r)[0] == static_cast<scalar>(r));
+        REQUIRE(vec3Field(nRanks + r)[1] == static_cast<scalar>(rank));
+        REQUIRE(vec3Field(nRanks + r)[2] == 1.0);
+    }
+
+    SECTION("Disabled")
+    {
+        comm.setSharedMemoryExchange(false);
+        scalarField(nRanks) = -1.0;
+        comm.startComm(scalarField, "shared");
+        comm.finaliseComm(scalarField, "shared");
+        REQUIRE(scalarField(nRanks) == 0.0);
+    }
+}
+
+#ifdef NF_WITH_NCCL
+TEST_CASE("Communicator NCCL exchange")
+{
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = mpiEnviron.rank();
+
+    std::vector<scalar> hostScalar(2 * nRanks, -1.0);
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        hostScalar[r] = static_cast<scalar>(rank);
+        rankSendMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(r)});
+        rankReceiveMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(nRanks + r)});
+    }
+    Vector<scalar> field(GPUExecutor(), hostScalar);
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    comm.setNcclExchange(true);
+    for (int i = 0; i < 2; i++)
+    {
+        comm.startComm(field, "nccl");
+        comm.finaliseComm(field, "nccl");
+    }
+
+    auto fieldHost = field.copyToHost();
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        REQUIRE(fieldHost(nRanks + r) == static_cast<scalar>(r));
+    }
+}
+#endif
+
+TEST_CASE("Communicator progress")
+{
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = mpiEnviron.rank();
+
+    // a large message to every rank, which is not sent eagerly
+    const size_t nNodes = 1 << 16;
+    Vector<scalar> field(SerialExecutor(), 2 * nRanks * nNodes, -1.0);
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        for (size_t i = 0; i < nNodes; i++)
+        {
+            const auto sendIdx = r * nNodes + i;
+            field(sendIdx) = static_cast<scalar>(rank);
+            rankSendMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(sendIdx)});
+            rankReceiveMap[r].emplace_back(
+                NodeCommMap {.local_idx = static_cast<label>(nRanks * nNodes + sendIdx)}
+            );
+        }
+    }
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+
+    SECTION("Tests")
+    {
+        comm.startComm(field, "progress");
+        for (int i = 0; i < 10; i++)
+        {
+            comm.progress();
+        }
+        comm.finaliseComm(field, "progress");
+    }
+
+#ifdef NF_REQUIRE_MPI_THREAD_SUPPORT
+    SECTION("Thread")
+    {
+        comm.setProgressThread(true, std::chrono::microseconds(10));
+        comm.startComm(field, "progress");
+        comm.finaliseComm(field, "progress");
+        comm.setProgressThread(false);
+    }
+#endif
+
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        REQUIRE(field(nRanks * nNodes + r * nNodes) == static_cast<scalar>(r));
+        REQUIRE(field(nRanks * nNodes + (r + 1) * nNodes - 1) == static_cast<scalar>(r));
+    }
+}
+
+TEST_CASE("Communicator aggregated exchange")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    mpi::MPIEnvironment mpiEnviron;
+    const auto nRanks = mpiEnviron.sizeRank();
+    const auto rank = mpiEnviron.rank();
+
+    // a send block followed by a receive block, for fields of different value types
+    std::vector<int> hostInt(2 * nRanks, -1);
+    std::vector<scalar> hostScalar(2 * nRanks, -1.0);
+    std::vector<Vec3> hostVec3(2 * nRanks, Vec3(-1.0, -1.0, -1.0));
+    CommMap rankSendMap(nRanks);
+    CommMap rankReceiveMap(nRanks);
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        hostInt[r] = static_cast<int>(rank);
+        hostScalar[r] = 0.5 * static_cast<scalar>(rank);
+        hostVec3[r] = Vec3(static_cast<scalar>(rank), static_cast<scalar>(r), 1.0);
+        rankSendMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(r)});
+        rankReceiveMap[r].emplace_back(NodeCommMap {.local_idx = static_cast<label>(nRanks + r)});
+    }
+    Vector<int> intField(exec, hostInt);
+    Vector<scalar> scalarField(exec, hostScalar);
+    Vector<Vec3> vec3Field(exec, hostVec3);
+
+    Communicator comm(mpiEnviron, rankSendMap, rankReceiveMap);
+    for (int i = 0; i < 2; i++)
+    {
+        comm.startAggregatedComm("aggregated", intField, scalarField, vec3Field);
+        comm.finaliseAggregatedComm("aggregated", intField, scalarField, vec3Field);
+    }
+
+    auto intHost = intField.copyToHost();
+    auto scalarHost = scalarField.copyToHost();
+    auto vec3Host = vec3Field.copyToHost();
+    for (size_t r = 0; r < nRanks; r++)
+    {
+        REQUIRE(intHost(nRanks + r) == static_cast<int>(r));
+        REQUIRE(scalarHost(nRanks + r) == 0.5 * static_cast<scalar>(r));
+        REQUIRE(
+            vec3Host(nRanks + r)
+            == Vec3(static_cast<scalar>(r), static_cast<scalar>(rank), 1.0)
+        );
+    }
+}
@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::label;
+using NeoN::localIdx;
+
+/* @brief sets phi = x + 2 z in all cells, including the ghost cells, and zero on the boundary */
+void fillLinearPhi(NeoN::finiteVolume::cellCentred::VolumeField<NeoN::scalar>& phi)
+{
+    const auto [phiV, centres] = NeoN::views(phi.internalVector(), phi.mesh().cellCentres());
+    NeoN::parallelFor(
+        phi.exec(),
+        {0, phiV.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            phiV[celli] = centres[celli][0] + 2.0 * centres[celli][2];
+        }
+    );
+    NeoN::fill(phi.boundaryData().value(), 0.0);
+}
+
+TEST_CASE("Decomposition")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, 4, 4, 4, true);
+    const localIdx nParts = 4;
+
+    SECTION("Partition cells " + execName)
+    {
+        auto cellToPart = NeoN::partitionCells(mesh, nParts);
+        std::vector<localIdx> partSize(nParts, 0);
+        for (auto part : cellToPart)
+        {
+            REQUIRE(part >= 0);
+            REQUIRE(part < nParts);
+            partSize[part]++;
+        }
+        for (auto size : partSize)
+        {
+            REQUIRE(size == 16);
+        }
+
+        // a cell of weight two counts as two cells, the parts balance up to one cell
+        std::vector<NeoN::scalar> weights(mesh.nCells(), 1.0);
+        for (localIdx celli = 0; celli < mesh.nCells() / 2; celli++)
+        {
+            weights[celli] = 2.0;
+        }
+        auto weightedToPart = NeoN::partitionCells(mesh, 2, weights);
+        NeoN::scalar partWeight = 0.0;
+        for (localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            if (weightedToPart[celli] == 0) partWeight += weights[celli];
+        }
+        REQUIRE(std::abs(partWeight - 48.0) <= 2.0);
+    }
+
+    SECTION("Decompose mesh " + execName)
+    {
+        auto cellToPart = NeoN::partitionCells(mesh, nParts);
+        std::vector<NeoN::DecomposedMesh> parts;
+        localIdx nCells = 0;
+        localIdx nInternalFaces = 0;
+        for (label part = 0; part < nParts; part++)
+        {
+            parts.push_back(NeoN::decomposeMesh(mesh, cellToPart, part));
+            const auto& local = parts.back().mesh;
+            REQUIRE(local.nBoundaries() == mesh.nBoundaries() + 1);
+            REQUIRE(local.nFaces() == local.nInternalFaces() + local.nBoundaryFaces());
+            nCells += local.nCells();
+            nInternalFaces += local.nInternalFaces();
+        }
+        REQUIRE(nCells == mesh.nCells());
+
+        // every shared face is a processor face of both parts, with matching order
+        localIdx nProcessorFaces = 0;
+        for (label p = 0; p < nParts; p++)
+        {
+            const auto& offset = parts[p].mesh.boundaryMesh().offset();
+            const auto nPatchFaces = offset[offset.size() - 1] - offset[offset.size() - 2];
+            nProcessorFaces += nPatchFaces;
+            localIdx nReceive = 0;
+            for (label q = 0; q < nParts; q++)
+            {
+                REQUIRE(parts[p].sendCells[q].size() == parts[q].receiveCells[p].size());
+                nReceive += static_cast<localIdx>(parts[p].receiveCells[q].size());
+            }
+            REQUIRE(nReceive == nPatchFaces);
+            for (label q = p + 1; q < nParts; q++)
+            {
+                // the original faces of the halo exchanged between p and q
+                auto faceMapP = parts[p].faceMap.copyToHost();
+                auto faceMapQ = parts[q].faceMap.copyToHost();
+                const auto patchStartP = parts[p].mesh.nFaces() - nPatchFaces;
+                const auto haloStartQ = parts[q].mesh.nCells();
+                const auto& offsetQ = parts[q].mesh.boundaryMesh().offset();
+                const auto patchStartQ =
+                    parts[q].mesh.nFaces() - (offsetQ.back() - offsetQ[offsetQ.size() - 2]);
+                for (size_t i = 0; i < parts[q].receiveCells[p].size(); i++)
+                {
+                    // the halo of q from p is in the order of the faces of p shared with q
+                    const auto haloFaceQ = parts[q].receiveCells[p][i] - haloStartQ;
+                    const auto faceQ = faceMapQ.view()[patchStartQ + haloFaceQ];
+                    bool found = false;
+                    for (localIdx j = 0; j < nPatchFaces; j++)
+                    {
+                        if (faceMapP.view()[patchStartP + j] == faceQ) found = true;
+                    }
+                    REQUIRE(found);
+                }
+            }
+        }
+        REQUIRE(nInternalFaces + nProcessorFaces / 2 == mesh.nInternalFaces());
+
+        // the local cells map to the original cells
+        auto centres = mesh.cellCentres().copyToHost();
+        auto cellMap = parts[1].cellMap.copyToHost();
+        auto localCentres = parts[1].mesh.cellCentres().copyToHost();
+        for (localIdx celli = 0; celli < parts[1].mesh.nCells(); celli++)
+        {
+            REQUIRE(localCentres.view()[celli] == centres.view()[cellMap.view()[celli]]);
+        }
+    }
+    SECTION("Decompose mesh with ghost cells " + execName)
+    {
+        namespace fvcc = NeoN::finiteVolume::cellCentred;
+        auto cellToPart = NeoN::partitionCells(mesh, nParts);
+
+        // the gradient of phi is computed on the full mesh and on every part
+        auto scalarBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+        fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, scalarBCs);
+        fillLinearPhi(phi);
+        auto gradHost = fvcc::GaussGreenGrad(exec, mesh).grad(phi).internalVector().copyToHost();
+
+        localIdx nInternalFaces = 0;
+        localIdx nGhostCellsTotal = 0;
+        for (label part = 0; part < nParts; part++)
+        {
+            auto patchPart = NeoN::decomposeMesh(mesh, cellToPart, part);
+            auto ghostPart =
+                NeoN::decomposeMesh(mesh, cellToPart, part, NeoN::HaloLayout::GhostCells);
+            const auto& local = ghostPart.mesh;
+            const auto nGhostCells = local.nGhostCells();
+
+            // the processor patch turns into internal faces with ghost neighbours
+            REQUIRE(patchPart.mesh.nGhostCells() == 0);
+            REQUIRE(local.nBoundaries() == mesh.nBoundaries());
+            REQUIRE(local.nCells() == patchPart.mesh.nCells());
+            REQUIRE(nGhostCells == patchPart.mesh.nBoundaryFaces() - local.nBoundaryFaces());
+            REQUIRE(local.nInternalFaces() == patchPart.mesh.nInternalFaces() + nGhostCells);
+            REQUIRE(local.nFaces() == patchPart.mesh.nFaces());
+            REQUIRE(local.cellVolumes().size() == local.nCells() + nGhostCells);
+            REQUIRE(ghostPart.receiveCells == patchPart.receiveCells);
+            REQUIRE(ghostPart.sendCells == patchPart.sendCells);
+            for (label q = 0; q < nParts; q++)
+            {
+                REQUIRE(ghostPart.sendFaces[q].empty());
+                REQUIRE(ghostPart.receiveFaces[q].empty());
+            }
+            auto neighbour = local.faceNeighbour().copyToHost();
+            const auto firstProcessorFace = local.nInternalFaces() - nGhostCells;
+            for (localIdx i = 0; i < nGhostCells; i++)
+            {
+                REQUIRE(neighbour.view()[firstProcessorFace + i] == local.nCells() + i);
+            }
+            nInternalFaces += local.nInternalFaces();
+            nGhostCellsTotal += nGhostCells;
+
+            // with the ghosts filled, eg. by the communicator, the unchanged face loops yield
+            // the gradient of the full mesh
+            auto localBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(local);
+            fvcc::VolumeField<NeoN::scalar> localPhi(exec, "phi", local, localBCs);
+            REQUIRE(localPhi.internalVector().size() == local.nCells() + nGhostCells);
+            fillLinearPhi(localPhi);
+            auto localGrad =
+                fvcc::GaussGreenGrad(exec, local).grad(localPhi).internalVector().copyToHost();
+            auto cellMap = ghostPart.cellMap.copyToHost();
+            for (localIdx celli = 0; celli < local.nCells(); celli++)
+            {
+                const auto expected = gradHost.view()[cellMap.view()[celli]];
+                for (size_t d = 0; d < 3; d++)
+                {
+                    REQUIRE(
+                        localGrad.view()[celli][d] == Catch::Approx(expected[d]).margin(1e-12)
+                    );
+                }
+            }
+        }
+        // every shared face is an internal face of both parts
+        REQUIRE(nInternalFaces - nGhostCellsTotal / 2 == mesh.nInternalFaces());
+    }
+
+    SECTION("Redistribute cells " + execName)
+    {
+        auto oldCellToPart = NeoN::partitionCells(mesh, nParts);
+        std::vector<NeoN::scalar> weights(mesh.nCells(), 1.0);
+        for (localIdx celli = 0; celli < mesh.nCells() / 4; celli++)
+        {
+            weights[celli] = 4.0;
+        }
+        auto newCellToPart = NeoN::partitionCells(mesh, nParts, weights);
+
+        std::vector<NeoN::Redistribution> redistributions;
+        for (label part = 0; part < nParts; part++)
+        {
+            redistributions.push_back(
+                NeoN::createRedistribution(oldCellToPart, newCellToPart, part)
+            );
+            auto newPart = NeoN::decomposeMesh(mesh, newCellToPart, part);
+            REQUIRE(redistributions.back().nCells == newPart.mesh.nCells());
+        }
+
+        // moving the original cell index of every cell gives the cell map of the new parts
+        for (label p = 0; p < nParts; p++)
+        {
+            auto oldCellMap = NeoN::decomposeMesh(mesh, oldCellToPart, p).cellMap.copyToHost();
+            for (label q = 0; q < nParts; q++)
+            {
+                const auto& sendCells = redistributions[p].sendCells[q];
+                const auto& receiveCells = redistributions[q].receiveCells[p];
+                REQUIRE(sendCells.size() == receiveCells.size());
+                auto newCellMap =
+                    NeoN::decomposeMesh(mesh, newCellToPart, q).cellMap.copyToHost();
+                for (size_t i = 0; i < sendCells.size(); i++)
+                {
+                    REQUIRE(
+                        oldCellMap.view()[sendCells[i]] == newCellMap.view()[receiveCells[i]]
+                    );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::localIdx;
+using NeoN::Vec3;
+
+TEST_CASE("Mesh geometry")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // a unit cube with the x faces and the remaining faces as patches
+    std::vector<Vec3> points;
+    for (int k = 0; k < 2; k++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                points.emplace_back(double(i), double(j), double(k));
+            }
+        }
+    }
+    const auto p = [](int i, int j, int k) { return NeoN::label(i + 2 * (j + 2 * k)); };
+    const std::vector<NeoN::label> facePoints {
+        p(0, 0, 0), p(0, 0, 1), p(0, 1, 1), p(0, 1, 0), // x = 0
+        p(1, 0, 0), p(1, 1, 0), p(1, 1, 1), p(1, 0, 1), // x = 1
+        p(0, 0, 0), p(1, 0, 0), p(1, 0, 1), p(0, 0, 1), // y = 0
+        p(0, 1, 0), p(0, 1, 1), p(1, 1, 1), p(1, 1, 0), // y = 1
+        p(0, 0, 0), p(0, 1, 0), p(1, 1, 0), p(1, 0, 0), // z = 0
+        p(0, 0, 1), p(1, 0, 1), p(1, 1, 1), p(0, 1, 1)  // z = 1
+    };
+    const NeoN::Vector<localIdx> faceOffsets(exec, std::vector<localIdx> {0, 4, 8, 12, 16, 20, 24});
+    const NeoN::labelVector faceVertices(exec, facePoints);
+    const NeoN::labelVector owner(exec, std::vector<NeoN::label>(6, 0));
+    const NeoN::labelVector neighbour(exec, 0);
+
+    SECTION("Compute the geometry of a cube " + execName)
+    {
+        const auto geometry = NeoN::computeMeshGeometry(
+            NeoN::vectorVector(exec, points), faceOffsets, faceVertices, owner, neighbour, 1
+        );
+
+        auto volumes = geometry.cellVolumes.copyToHost();
+        auto centres = geometry.cellCentres.copyToHost();
+        REQUIRE(volumes.view()[0] == Catch::Approx(1.0));
+        REQUIRE(
+            NeoN::mag(centres.view()[0] - Vec3(0.5, 0.5, 0.5)) == Catch::Approx(0.0).margin(1e-14)
+        );
+
+        auto areas = geometry.faceAreas.copyToHost();
+        auto magAreas = geometry.magFaceAreas.copyToHost();
+        REQUIRE(
+            NeoN::mag(areas.view()[0] - Vec3(-1.0, 0.0, 0.0)) == Catch::Approx(0.0).margin(1e-14)
+        );
+        REQUIRE(
+            NeoN::mag(areas.view()[5] - Vec3(0.0, 0.0, 1.0)) == Catch::Approx(0.0).margin(1e-14)
+        );
+        for (localIdx facei = 0; facei < 6; facei++)
+        {
+            REQUIRE(magAreas.view()[facei] == Catch::Approx(1.0));
+        }
+
+        const auto boundaryMesh = NeoN::computeBoundaryMesh(geometry, owner, 0, {0, 2, 6});
+        REQUIRE(boundaryMesh.offset() == std::vector<localIdx> {0, 2, 6});
+        auto deltaCoeffs = boundaryMesh.deltaCoeffs().copyToHost();
+        REQUIRE(deltaCoeffs.view()[1] == Catch::Approx(2.0));
+    }
+
+    SECTION("Move the points of a cube " + execName)
+    {
+        auto mesh = NeoN::createMeshFromFaces(
+            NeoN::vectorVector(exec, points),
+            faceOffsets,
+            faceVertices,
+            owner,
+            neighbour,
+            1,
+            {0, 2, 6}
+        );
+        const auto version = mesh.geometryVersion();
+
+        std::vector<Vec3> moved;
+        for (const auto& point : points)
+        {
+            moved.push_back(2.0 * point);
+        }
+        REQUIRE(!mesh.moving());
+        NeoN::movePoints(mesh, NeoN::vectorVector(exec, moved), faceOffsets, faceVertices, 0.5);
+
+        REQUIRE(mesh.moving());
+        REQUIRE(mesh.geometryVersion() > version);
+        auto volumes = mesh.cellVolumes().copyToHost();
+        REQUIRE(volumes.view()[0] == Catch::Approx(8.0));
+        auto oldVolumes = mesh.oldCellVolumes().copyToHost();
+        REQUIRE(oldVolumes.view()[0] == Catch::Approx(1.0));
+        auto magSf = mesh.boundaryMesh().magSf().copyToHost();
+        REQUIRE(magSf.view()[3] == Catch::Approx(4.0));
+        auto deltaCoeffs = mesh.boundaryMesh().deltaCoeffs().copyToHost();
+        REQUIRE(deltaCoeffs.view()[0] == Catch::Approx(1.0));
+
+        // the swept volumes close the volume change of the cell
+        auto meshPhi = mesh.meshPhi().copyToHost();
+        NeoN::scalar sweptVolume = 0.0;
+        for (localIdx facei = 0; facei < 6; facei++)
+        {
+            sweptVolume += 0.5 * meshPhi.view()[facei];
+        }
+        REQUIRE(sweptVolume == Catch::Approx(7.0));
+    }
+
+    SECTION("Move one face of a cube " + execName)
+    {
+        auto mesh = NeoN::createMeshFromFaces(
+            NeoN::vectorVector(exec, points),
+            faceOffsets,
+            faceVertices,
+            owner,
+            neighbour,
+            1,
+            {0, 2, 6}
+        );
+
+        std::vector<Vec3> moved(points);
+        for (auto& point : moved)
+        {
+            point[0] *= 2.0;
+        }
+        NeoN::movePoints(mesh, NeoN::vectorVector(exec, moved), faceOffsets, faceVertices, 1.0);
+
+        auto volumes = mesh.cellVolumes().copyToHost();
+        auto centres = mesh.cellCentres().copyToHost();
+        REQUIRE(volumes.view()[0] == Catch::Approx(2.0));
+        REQUIRE(centres.view()[0][0] == Catch::Approx(1.0));
+
+        // only the x = 1 face sweeps a volume, the y and z faces move within their plane
+        auto meshPhi = mesh.meshPhi().copyToHost();
+        REQUIRE(meshPhi.view()[0] == Catch::Approx(0.0).margin(1e-14));
+        REQUIRE(meshPhi.view()[1] == Catch::Approx(1.0));
+        for (localIdx facei = 2; facei < 6; facei++)
+        {
+            REQUIRE(meshPhi.view()[facei] == Catch::Approx(0.0).margin(1e-14));
+        }
+    }
+}
@@ -78,4 +78,204 @@ TEST_CASE("Unstructured Mesh")
         REQUIRE(hostBoundaryDelta.view()[0][0] == -0.125);
         REQUIRE(hostBoundaryDelta.view()[1][0] == 0.125);
     }
+
+    SECTION("Can create a 3D uniform mesh " + execName)
+    {
+        auto randomCellOrder = GENERATE(false, true);
+        NeoN::UnstructuredMesh mesh = NeoN::create3DUniformMesh(exec, 2, 3, 4, randomCellOrder);
+
+        REQUIRE(mesh.nCells() == 24);
+        REQUIRE(mesh.nInternalFaces() == 1 * 3 * 4 + 2 * 2 * 4 + 2 * 3 * 3);
+        REQUIRE(mesh.nBoundaryFaces() == 2 * (3 * 4 + 2 * 4 + 2 * 3));
+        REQUIRE(mesh.nBoundaries() == 6);
+        REQUIRE(mesh.nFaces() == mesh.nInternalFaces() + mesh.nBoundaryFaces());
+        REQUIRE(mesh.boundaryMesh().offset()[1] == 3 * 4);
+
+        // the offsets and the patch of every face are available on the executor
+        const auto& offset = mesh.boundaryMesh().offset();
+        auto patchOffsets = mesh.boundaryMesh().patchOffsets().copyToHost();
+        auto facePatch = mesh.boundaryMesh().facePatch().copyToHost();
+        REQUIRE(patchOffsets.size() == static_cast<NeoN::localIdx>(offset.size()));
+        REQUIRE(facePatch.size() == mesh.nBoundaryFaces());
+        for (NeoN::localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            const auto start = offset[static_cast<size_t>(patchi)];
+            const auto end = offset[static_cast<size_t>(patchi) + 1];
+            REQUIRE(patchOffsets.view()[patchi] == start);
+            for (auto facei = start; facei < end; facei++)
+            {
+                REQUIRE(facePatch.view()[facei] == patchi);
+            }
+        }
+
+        // internal faces are sorted by owner and keep the owner below the neighbour
+        auto owner = mesh.faceOwner().copyToHost();
+        auto neighbour = mesh.faceNeighbour().copyToHost();
+        for (NeoN::localIdx facei = 0; facei < mesh.nInternalFaces(); facei++)
+        {
+            REQUIRE(owner.view()[facei] < neighbour.view()[facei]);
+            if (facei > 0) REQUIRE(owner.view()[facei - 1] <= owner.view()[facei]);
+        }
+
+        // every cell is closed, ie. the outward face areas sum up to zero
+        auto faceAreas = mesh.faceAreas().copyToHost();
+        std::vector<NeoN::Vec3> sumSf(24, NeoN::Vec3(0.0, 0.0, 0.0));
+        std::vector<int> nCellFaces(24, 0);
+        for (NeoN::localIdx facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            auto own = static_cast<size_t>(owner.view()[facei]);
+            sumSf[own] += faceAreas.view()[facei];
+            nCellFaces[own]++;
+            if (facei < mesh.nInternalFaces())
+            {
+                auto nei = static_cast<size_t>(neighbour.view()[facei]);
+                sumSf[nei] -= faceAreas.view()[facei];
+                nCellFaces[nei]++;
+            }
+        }
+        for (size_t celli = 0; celli < 24; celli++)
+        {
+            REQUIRE(nCellFaces[celli] == 6);
+            REQUIRE(NeoN::mag(sumSf[celli]) < 1e-12);
+        }
+
+        // the faces of the structured addressing agree with the connectivity
+        REQUIRE(mesh.structured().has_value() == !randomCellOrder);
+        if (!randomCellOrder)
+        {
+            const auto block = *mesh.structured();
+            for (NeoN::localIdx celli = 0; celli < 24; celli++)
+            {
+                for (NeoN::localIdx d = 0; d < 3; d++)
+                {
+                    for (const bool upper : {false, true})
+                    {
+                        const auto face = block.face(celli, d, upper);
+                        REQUIRE(face.facei < mesh.nFaces());
+                        const auto& cells = face.owner ? owner : neighbour;
+                        REQUIRE(cells.view()[face.facei] == celli);
+                        REQUIRE(std::abs(faceAreas.view()[face.facei][static_cast<size_t>(d)]) > 0);
+                    }
+                }
+            }
+        }
+
+        auto volumes = mesh.cellVolumes().copyToHost();
+        NeoN::scalar totalVolume = 0.0;
+        for (auto volume : volumes.view())
+        {
+            totalVolume += volume;
+        }
+        REQUIRE(totalVolume == Catch::Approx(1.0));
+
+        auto invVolumes = mesh.invCellVolumes().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(invVolumes.view()[celli] * volumes.view()[celli] == Catch::Approx(1.0));
+        }
+    }
+
+    SECTION("Renumber a 1D uniform mesh " + execName)
+    {
+        NeoN::localIdx nCells = 10;
+        NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, nCells);
+
+        auto ordering = GENERATE(
+            NeoN::CellOrdering::ReverseCuthillMcKee,
+            NeoN::CellOrdering::Morton,
+            NeoN::CellOrdering::Hilbert
+        );
+        auto [renumbered, cellMap, faceMap, faceSign] = NeoN::renumberMesh(mesh, ordering);
+
+        REQUIRE(renumbered.nCells() == nCells);
+        REQUIRE(renumbered.nInternalFaces() == mesh.nInternalFaces());
+        REQUIRE(renumbered.nFaces() == mesh.nFaces());
+
+        auto cellMapHost = cellMap.copyToHost();
+        auto oldCentres = mesh.cellCentres().copyToHost();
+        auto newCentres = renumbered.cellCentres().copyToHost();
+        std::vector<bool> found(nCells, false);
+        for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+        {
+            auto oldCelli = static_cast<NeoN::localIdx>(cellMapHost.view()[celli]);
+            REQUIRE(!found[oldCelli]);
+            found[oldCelli] = true;
+            REQUIRE(newCentres.view()[celli] == oldCentres.view()[oldCelli]);
+        }
+
+        // internal faces are sorted by owner and keep the owner below the neighbour
+        auto owner = renumbered.faceOwner().copyToHost();
+        auto neighbour = renumbered.faceNeighbour().copyToHost();
+        auto faceAreas = renumbered.faceAreas().copyToHost();
+        for (NeoN::localIdx facei = 0; facei < renumbered.nInternalFaces(); facei++)
+        {
+            auto own = static_cast<NeoN::localIdx>(owner.view()[facei]);
+            auto nei = static_cast<NeoN::localIdx>(neighbour.view()[facei]);
+            REQUIRE(own < nei);
+            if (facei > 0) REQUIRE(owner.view()[facei - 1] <= owner.view()[facei]);
+            // the face area points from owner to neighbour
+            auto dx = newCentres.view()[nei][0] - newCentres.view()[own][0];
+            REQUIRE(dx * faceAreas.view()[facei][0] > 0);
+        }
+
+        // the boundary faces keep their order and point to the renumbered cells
+        auto oldFaceCells = mesh.boundaryMesh().faceCells().copyToHost();
+        auto newFaceCells = renumbered.boundaryMesh().faceCells().copyToHost();
+        for (NeoN::localIdx bfacei = 0; bfacei < mesh.nBoundaryFaces(); bfacei++)
+        {
+            auto oldCelli = static_cast<NeoN::localIdx>(oldFaceCells.view()[bfacei]);
+            auto newCelli = static_cast<NeoN::localIdx>(newFaceCells.view()[bfacei]);
+            REQUIRE(newCentres.view()[newCelli] == oldCentres.view()[oldCelli]);
+        }
+
+        // fields are transferred with the cell map
+        auto permutedCentres = NeoN::permute(mesh.cellCentres(), cellMap).copyToHost();
+        for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(permutedCentres.view()[celli] == newCentres.view()[celli]);
+        }
+    }
+
+    SECTION("Host mirrors of a mesh " + execName)
+    {
+        NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, 4);
+
+        auto owner = mesh.faceOwner().copyToHost();
+        auto faceCells = mesh.boundaryMesh().faceCells().copyToHost();
+        const auto& hostOwner = mesh.hostFaceOwner();
+        REQUIRE(hostOwner.size() == mesh.nInternalFaces());
+        REQUIRE(mesh.hostFaceCells().size() == mesh.nBoundaryFaces());
+        for (NeoN::localIdx facei = 0; facei < mesh.nInternalFaces(); facei++)
+        {
+            REQUIRE(hostOwner.view()[facei] == owner.view()[facei]);
+        }
+        for (NeoN::localIdx bfacei = 0; bfacei < mesh.nBoundaryFaces(); bfacei++)
+        {
+            REQUIRE(mesh.hostFaceCells().view()[bfacei] == faceCells.view()[bfacei]);
+        }
+
+        // repeated accesses reuse the host copy
+        const auto* centres = mesh.hostCellCentres().data();
+        REQUIRE(mesh.hostCellCentres().data() == centres);
+        REQUIRE(&mesh.hostFaceOwner() == &hostOwner);
+
+        // the geometric mirrors follow the motion of the mesh
+        auto cellCentresHost = mesh.cellCentres().copyToHost();
+        cellCentresHost.view()[0] = NeoN::Vec3(0.2, 0.0, 0.0);
+        mesh.updateGeometry(
+            mesh.points(),
+            mesh.cellVolumes(),
+            NeoN::vectorVector(exec, cellCentresHost),
+            mesh.faceAreas(),
+            mesh.faceCentres(),
+            mesh.magFaceAreas()
+        );
+        REQUIRE(mesh.hostCellCentres().view()[0] == NeoN::Vec3(0.2, 0.0, 0.0));
+        REQUIRE(mesh.hostCellCentres().view()[1] == cellCentresHost.view()[1]);
+
+        // a copy of the mesh holds its own mirrors
+        const NeoN::UnstructuredMesh copy(mesh);
+        REQUIRE(&copy.hostFaceOwner() != &mesh.hostFaceOwner());
+        REQUIRE(copy.hostCellCentres().view()[0] == NeoN::Vec3(0.2, 0.0, 0.0));
+    }
 }
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using NeoN::scalar;
+using NeoN::localIdx;
+using NeoN::Vector;
+using NeoN::timeIntegration::BatchedStiffOde;
+
+/* @brief dy/dt = -k y, the rate of system i is 10^(i % 5) */
+struct Decay
+{
+    KOKKOS_FUNCTION static scalar rate(const localIdx sysi)
+    {
+        scalar k = 1.0;
+        for (localIdx i = 0; i < sysi % 5; i++)
+        {
+            k *= 10.0;
+        }
+        return k;
+    }
+
+    KOKKOS_FUNCTION void rhs(const localIdx sysi, scalar, const scalar* y, scalar* dydt) const
+    {
+        dydt[0] = -rate(sysi) * y[0];
+    }
+
+    KOKKOS_FUNCTION void jacobian(const localIdx sysi, scalar, const scalar*, scalar* jac) const
+    {
+        jac[0] = -rate(sysi);
+    }
+};
+
+/* @brief the stiff chemical kinetics of Robertson, the rates are scaled per system */
+struct Robertson
+{
+    KOKKOS_FUNCTION static scalar scale(const localIdx sysi) { return 1.0 + scalar(sysi % 3); }
+
+    KOKKOS_FUNCTION void rhs(const localIdx sysi, scalar, const scalar* y, scalar* dydt) const
+    {
+        const scalar s = scale(sysi);
+        const scalar r1 = 0.04 * y[0];
+        const scalar r2 = 1.0e4 * y[1] * y[2];
+        const scalar r3 = 3.0e7 * y[1] * y[1];
+        dydt[0] = s * (-r1 + r2);
+        dydt[1] = s * (r1 - r2 - r3);
+        dydt[2] = s * r3;
+    }
+
+    KOKKOS_FUNCTION void jacobian(const localIdx sysi, scalar, const scalar* y, scalar* jac) const
+    {
+        const scalar s = scale(sysi);
+        jac[0] = -s * 0.04;
+        jac[1] = s * 1.0e4 * y[2];
+        jac[2] = s * 1.0e4 * y[1];
+        jac[3] = s * 0.04;
+        jac[4] = -s * (1.0e4 * y[2] + 6.0e7 * y[1]);
+        jac[5] = -s * 1.0e4 * y[1];
+        jac[6] = 0.0;
+        jac[7] = s * 6.0e7 * y[1];
+        jac[8] = 0.0;
+    }
+};
+
+TEST_CASE("BatchedStiffOde")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const localIdx nSystems = 20;
+
+    SECTION("Integrate decays of different stiffness with sub steps of their own " + execName)
+    {
+        NeoN::Dictionary dict;
+        dict.insert("relTol", 1e-8);
+        dict.insert("absTol", 1e-12);
+        BatchedStiffOde ode(exec, nSystems, 1, dict);
+        Vector<scalar> y(exec, nSystems, 1.0);
+
+        const auto stats = ode.integrate<1>(Decay {}, y, 0.0, 1.0);
+        REQUIRE(stats.nFailed == 0);
+        REQUIRE(stats.maxSubSteps <= stats.nSubSteps);
+
+        auto [yHost, nSubStepsHost] = NeoN::copyToHosts(y, ode.nSubSteps());
+        for (localIdx sysi = 0; sysi < nSystems; sysi++)
+        {
+            const scalar expected = std::exp(-Decay::rate(sysi));
+            REQUIRE(yHost.view()[sysi] == Catch::Approx(expected).margin(1e-6));
+            REQUIRE(nSubStepsHost.view()[sysi] > 0);
+        }
+
+        // the sub step sizes of the first step are reused, the decayed systems take long steps
+        const auto next = ode.integrate<1>(Decay {}, y, 1.0, 1.0);
+        REQUIRE(next.nFailed == 0);
+        REQUIRE(next.nSubSteps < stats.nSubSteps);
+    }
+
+    SECTION("Integrate the Robertson kinetics " + execName)
+    {
+        BatchedStiffOde ode(exec, nSystems, 3, NeoN::Dictionary());
+        Vector<scalar> y(exec, 3 * nSystems, 0.0);
+        auto yView = y.view();
+        NeoN::parallelFor(
+            exec, {0, nSystems}, KOKKOS_LAMBDA(const localIdx sysi) { yView[3 * sysi] = 1.0; }
+        );
+
+        scalar t = 0.0;
+        for (const scalar dt : {1e-3, 1e-1, 1.0, 10.0})
+        {
+            const auto stats = ode.integrate<4>(Robertson {}, y, t, dt);
+            REQUIRE(stats.nFailed == 0);
+            t += dt;
+        }
+
+        // the method conserves the linear invariant, the fast intermediate species is small
+        auto yHost = y.copyToHost();
+        for (localIdx sysi = 0; sysi < nSystems; sysi++)
+        {
+            const scalar* state = &yHost.view()[3 * sysi];
+            REQUIRE(state[0] + state[1] + state[2] == Catch::Approx(1.0).margin(1e-10));
+            REQUIRE(state[0] > 0.0);
+            REQUIRE(state[0] < 1.0);
+            REQUIRE(std::abs(state[1]) < 1e-4);
+        }
+        // the state of the more reactive systems has advanced further
+        REQUIRE(yHost.view()[0] > yHost.view()[3]);
+        REQUIRE(yHost.view()[3] > yHost.view()[6]);
+    }
+
+    SECTION("Report systems which exceed the sub steps " + execName)
+    {
+        NeoN::Dictionary dict;
+        dict.insert("maxSubSteps", 2);
+        dict.insert("relTol", 1e-10);
+        dict.insert("absTol", 1e-14);
+        BatchedStiffOde ode(exec, nSystems, 1, dict);
+        Vector<scalar> y(exec, nSystems, 1.0);
+
+        const auto stats = ode.integrate<1>(Decay {}, y, 0.0, 1.0);
+        REQUIRE(stats.nFailed > 0);
+        REQUIRE(stats.maxSubSteps == 2);
+    }
+}
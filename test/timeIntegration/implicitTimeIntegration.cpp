@@ -52,3 +52,170 @@ TEST_CASE("TimeIntegration")
         REQUIRE(getVector(vf.internalVector()) == -2.0);
     }
 }
+
+#if NF_WITH_GINKGO
+TEST_CASE("BackwardEuler")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("backwardEuler"));
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution {
+        {{"solver", std::string {"Ginkgo"}},
+         {"type", "solver::Cg"},
+         {"criteria", NeoN::Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+    };
+
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .value = 2.0, .timeIndex = 1}
+        );
+
+    SECTION("Reuse linear system across time steps on " + execName)
+    {
+        NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(
+            fvSchemes.subDict("ddtSchemes"), fvSolution
+        );
+
+        // ddt(U) = 0 -> U^1 = U^0 for every step, values must not accumulate
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::ddt(vf));
+
+        double dt {2.0};
+        double time {1.0};
+        for (int step = 0; step < 3; step++)
+        {
+            timeIntegrator.solve(eqn, vf, time, dt);
+            REQUIRE(getVector(vf.internalVector()) == Catch::Approx(2.0).margin(1e-8));
+            time += dt;
+        }
+        // the system is diagonal, hence it is solved without a sparsity pattern
+        REQUIRE(!mesh.stencilDB().contains("SparsityPattern"));
+
+        // every solve is recorded in the solver statistics of the database
+        auto history = NeoN::la::SolverStatsCollection::instance(db).history("vf");
+        REQUIRE(history.size() == 3);
+        REQUIRE(history[0].stats().numIter == history[0].doc().get<int>("numIter"));
+    }
+
+    SECTION("Solve a diagonal system pointwise on " + execName)
+    {
+        fvcc::VolumeField<NeoN::scalar>& sp =
+            fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+                CreateVector {.name = "sp", .mesh = mesh, .value = 0.5, .timeIndex = 1}
+            );
+        NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(
+            fvSchemes.subDict("ddtSchemes"), fvSolution
+        );
+
+        // ddt(U) + 0.5 U = 0 -> U^1 = U^0 / (1 + 0.5 dt), where dt = 2, U^0 = 2 -> U^1 = 1
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::ddt(vf));
+        eqn.addOperator(NeoN::dsl::imp::source(sp, vf));
+        REQUIRE(fvcc::FusedExpression<NeoN::scalar>(eqn).implicitDiagonal());
+
+        timeIntegrator.solve(eqn, vf, 1.0, 2.0);
+        REQUIRE(getVector(vf.internalVector()) == Catch::Approx(1.0).margin(1e-12));
+        REQUIRE(!mesh.stencilDB().contains("SparsityPattern"));
+
+        // other implicit operators may have off diagonal entries and require the linear system
+        eqn.addOperator(Dummy(vf, Operator::Type::Implicit));
+        REQUIRE(!fvcc::FusedExpression<NeoN::scalar>(eqn).implicitDiagonal());
+    }
+
+    SECTION("Initial guess from old time levels on " + execName)
+    {
+        const std::string initialGuess =
+            GENERATE(std::string("extrapolate"), std::string("projection"));
+        auto solutionDict = fvSolution;
+        solutionDict.insert("initialGuess", initialGuess);
+        solutionDict.insert("initialGuessLevels", 3);
+        NeoN::timeIntegration::InitialGuess<VolumeField> guess(solutionDict);
+        REQUIRE(
+            guess.mode()
+            == (initialGuess == "extrapolate"
+                    ? NeoN::timeIntegration::InitialGuessMode::Extrapolation
+                    : NeoN::timeIntegration::InitialGuessMode::Projection)
+        );
+
+        NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(
+            fvSchemes.subDict("ddtSchemes"), solutionDict
+        );
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::ddt(vf));
+
+        double dt {2.0};
+        double time {1.0};
+        for (int step = 0; step < 3; step++)
+        {
+            timeIntegrator.solve(eqn, vf, time, dt);
+            REQUIRE(getVector(vf.internalVector()) == Catch::Approx(2.0).margin(1e-8));
+            fvcc::rotateOldTimes(vf);
+            time += dt;
+        }
+    }
+}
+
+TEST_CASE("BDF2 and CrankNicolson")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const std::string scheme = GENERATE(std::string("BDF2"), std::string("CrankNicolson"));
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", scheme);
+    NeoN::Dictionary fvSolution {
+        {{"solver", std::string {"Ginkgo"}},
+         {"type", "solver::Cg"},
+         {"criteria", NeoN::Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-7}}}}}
+    };
+
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .value = 2.0, .timeIndex = 1}
+        );
+    NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(ddtSchemes, fvSolution);
+
+    SECTION("Keep a constant solution with " + scheme + " on " + execName)
+    {
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::ddt(vf));
+
+        double dt {2.0};
+        double time {1.0};
+        for (int step = 0; step < 3; step++)
+        {
+            timeIntegrator.solve(eqn, vf, time, dt);
+            REQUIRE(getVector(vf.internalVector()) == Catch::Approx(2.0).margin(1e-8));
+            fvcc::rotateOldTimes(vf);
+            time += dt;
+        }
+    }
+
+    SECTION("Solve a single step with " + scheme + " on " + execName)
+    {
+        // ddt(U) + 2 U = 2 with U^0 = 2, the dummy assembles the current value of U
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::ddt(vf));
+        eqn.addOperator(Dummy(vf, Operator::Type::Implicit));
+
+        timeIntegrator.solve(eqn, vf, 1.0, 1.0);
+
+        // BDF2 starts with a backward Euler step, ie. U^1 - U^0 + 2 U^1 = 2
+        // CrankNicolson solves U^1 - U^0 + (2 U^1 - 2) / 2 + (2 U^0 - 2) / 2 = 0
+        const NeoN::scalar expected = scheme == "BDF2" ? 4.0 / 3.0 : 1.0;
+        REQUIRE(getVector(vf.internalVector()) == Catch::Approx(expected).margin(1e-8));
+    }
+}
+#endif
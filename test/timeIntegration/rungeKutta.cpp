@@ -118,3 +118,287 @@ TEST_CASE("TimeIntegration - Runge Kutta")
         REQUIRE(order > (1.0 - convergenceTolerance));
     }
 }
+
+TEST_CASE("TimeIntegration - multi-stage Runge Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto [method, expectedOrder] = GENERATE(
+        std::make_pair(std::string("Heun"), 2.0),
+        std::make_pair(std::string("Midpoint"), 2.0),
+        std::make_pair(std::string("Bogacki-Shampine"), 3.0),
+        std::make_pair(std::string("Zonneveld"), 4.0)
+    );
+    const bool readOldTime = GENERATE(true, false);
+
+    NeoN::Database db;
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("Runge-Kutta"));
+    ddtSchemes.insert("Runge-Kutta-Method", method);
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution;
+
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+
+    SECTION("Every stage is evaluated on its state with " + method + " on " + execName)
+    {
+        // du/dt = u^2, u(t) = 1 / (1 - t) for u(0) = 1
+        const NeoN::scalar maxTime = 0.2;
+        const std::array<int, 2> nSteps = {4, 8};
+        std::array<NeoN::scalar, 2> error;
+        for (std::size_t iTest = 0; iTest < nSteps.size(); iTest++)
+        {
+            auto& vfOld = fvcc::oldTime(vf);
+            vf.internalVector() = 1.0;
+            vfOld.internalVector() = 1.0;
+
+            auto& operatorField = readOldTime ? vfOld : vf;
+            TemporalOperator ddtOp = NeoN::dsl::imp::ddt(operatorField);
+            auto eqn = ddtOp + YSquared(operatorField);
+
+            const NeoN::scalar dt = maxTime / static_cast<NeoN::scalar>(nSteps[iTest]);
+            NeoN::scalar time = 0.0;
+            for (int step = 0; step < nSteps[iTest]; step++)
+            {
+                NeoN::dsl::solve(eqn, vf, time, dt, fvSchemes, fvSolution);
+                time += dt;
+            }
+
+            auto vfHost = vf.internalVector().copyToHost();
+            error[iTest] = std::abs(vfHost.view()[0] - 1.0 / (1.0 - maxTime));
+        }
+
+        const NeoN::scalar order = std::log(error[0] / error[1]) / std::log(2.0);
+        REQUIRE(order > expectedOrder - 0.3);
+    }
+}
+
+TEST_CASE("TimeIntegration - Sundials N_Vector")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SUNContext context;
+    REQUIRE(SUNContext_Create(SUN_COMM_NULL, &context) == 0);
+
+    SECTION("Operations share the memory of the vector on " + execName)
+    {
+        Vector x(exec, {1.0, -2.0, 3.0});
+        N_Vector nx = NeoN::sundials::wrapVector(x, context);
+        REQUIRE(N_VGetLength(nx) == 3);
+        REQUIRE(&NeoN::sundials::vector(nx) == &x);
+
+        N_Vector ny = N_VClone(nx);
+        N_VConst(2.0, ny);
+        N_VLinearSum(1.0, nx, 0.5, ny, nx);
+        auto xHost = x.copyToHost();
+        REQUIRE(xHost.view()[0] == Catch::Approx(2.0));
+        REQUIRE(xHost.view()[1] == Catch::Approx(-1.0));
+        REQUIRE(xHost.view()[2] == Catch::Approx(4.0));
+
+        REQUIRE(N_VMaxNorm(nx) == Catch::Approx(4.0));
+        REQUIRE(N_VMin(nx) == Catch::Approx(-1.0));
+        REQUIRE(N_VDotProd(nx, ny) == Catch::Approx(10.0));
+        REQUIRE(N_VWrmsNorm(nx, ny) == Catch::Approx(std::sqrt(28.0)));
+
+        N_VDestroy(ny);
+        N_VDestroy(nx);
+    }
+
+    SUNContext_Free(&context);
+}
+
+#if NF_WITH_GINKGO
+TEST_CASE("TimeIntegration - IMEX Runge Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    NeoN::Dictionary fvSolution {
+        {{"solver", std::string {"Ginkgo"}},
+         {"type", "solver::Cg"},
+         {"criteria", NeoN::Dictionary {{{"iteration", 3}, {"relative_residual_norm", 1e-12}}}}}
+    };
+
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+    fvcc::VolumeField<NeoN::scalar>& sp =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "sp", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+
+    SECTION("Converge with the order of the method on " + execName)
+    {
+        const auto [method, expectedOrder] = GENERATE(
+            std::pair<std::string, NeoN::scalar> {"ARK-2", 2.0},
+            std::pair<std::string, NeoN::scalar> {"ARK-3", 3.0}
+        );
+        NeoN::Dictionary ddtSchemes;
+        ddtSchemes.insert("type", std::string("IMEX-Runge-Kutta"));
+        ddtSchemes.insert("IMEX-Method", method);
+
+        // du/dt = -u + u^2 with the linear term implicit and the quadratic term explicit,
+        // u(t) = 1 / (1 + e^t) for u(0) = 0.5
+        const NeoN::scalar maxTime = 0.1;
+        std::array<NeoN::scalar, 2> deltaTime = {0.02, 0.01};
+        std::array<NeoN::scalar, 2> error;
+        for (std::size_t i = 0; i < deltaTime.size(); i++)
+        {
+            vf.internalVector() = 0.5;
+            auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+            eqn.addOperator(NeoN::dsl::imp::source(sp, vf));
+            eqn.addOperator(YSquared(vf));
+            NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(
+                ddtSchemes, fvSolution
+            );
+
+            NeoN::scalar time = 0.0;
+            const auto nSteps = static_cast<int>(std::round(maxTime / deltaTime[i]));
+            for (int step = 0; step < nSteps; step++)
+            {
+                timeIntegrator.solve(eqn, vf, time, deltaTime[i]);
+                time += deltaTime[i];
+            }
+            REQUIRE(time == Catch::Approx(maxTime));
+            auto vfHost = vf.internalVector().copyToHost();
+            error[i] = std::abs(vfHost.view()[0] - 1.0 / (1.0 + std::exp(maxTime)));
+        }
+        NeoN::scalar order = (std::log(error[0]) - std::log(error[1]))
+                           / (std::log(deltaTime[0]) - std::log(deltaTime[1]));
+        REQUIRE(order > expectedOrder - 0.2);
+    }
+
+    SECTION("Integrate a stiff implicit term beyond the explicit limit on " + execName)
+    {
+        NeoN::Dictionary ddtSchemes;
+        ddtSchemes.insert("type", std::string("IMEX-Runge-Kutta"));
+
+        // du/dt = -1000 u, an explicit step of dt = 0.01 would amplify the solution
+        sp.internalVector() = 1000.0;
+        vf.internalVector() = 1.0;
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::imp::source(sp, vf));
+        NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(
+            ddtSchemes, fvSolution
+        );
+
+        NeoN::scalar time = 0.0;
+        for (int step = 0; step < 10; step++)
+        {
+            timeIntegrator.solve(eqn, vf, time, 0.01);
+            time += 0.01;
+        }
+        auto vfHost = vf.internalVector().copyToHost();
+        REQUIRE(std::abs(vfHost.view()[0]) < 1e-3);
+    }
+}
+#endif
+
+TEST_CASE("TimeIntegration - Multirate Runge Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    NeoN::Dictionary fvSolution;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("Multirate-Runge-Kutta"));
+    ddtSchemes.insert("fastSubSteps", 20);
+
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+    fvcc::VolumeField<NeoN::scalar>& k =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "k", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+
+    // du/dt = -k u + u^2 with the source term as fast and the quadratic term as slow partition
+    auto integrate = [&](NeoN::scalar dt, int nSteps)
+    {
+        auto eqn = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqn.addOperator(NeoN::dsl::exp::source(k, vf));
+        eqn.addOperator(YSquared(vf));
+        NeoN::timeIntegration::TimeIntegration<VolumeField> timeIntegrator(
+            ddtSchemes, fvSolution
+        );
+        NeoN::scalar time = 0.0;
+        for (int step = 0; step < nSteps; step++)
+        {
+            timeIntegrator.solve(eqn, vf, time, dt);
+            time += dt;
+        }
+        return vf.internalVector().copyToHost().view()[0];
+    };
+
+    SECTION("Integrate both partitions accurately on " + execName)
+    {
+        // u(t) = 1 / (1 + e^t) for k = 1 and u(0) = 0.5
+        vf.internalVector() = 0.5;
+        const auto u = integrate(0.01, 10);
+        REQUIRE(u == Catch::Approx(1.0 / (1.0 + std::exp(0.1))).margin(1e-6));
+    }
+
+    SECTION("Subcycle a stiff source beyond the explicit limit of the slow step on " + execName)
+    {
+        // k dt = 10 is unstable for an explicit step, the fast steps have k dt / 20 = 0.5
+        k.internalVector() = 1000.0;
+        vf.internalVector() = 0.5;
+        const auto u = integrate(0.01, 10);
+        REQUIRE(std::abs(u) < 1e-3);
+    }
+}
+
+TEST_CASE("TimeIntegration - Coupled Runge Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    auto field = [&](const std::string& name, NeoN::scalar value) -> VolumeField&
+    {
+        return fieldCollection.registerVector<VolumeField>(
+            CreateVector {.name = name, .mesh = mesh, .value = value, .timeIndex = 1}
+        );
+    };
+    auto& u = field("u", 1.0);
+    auto& v = field("v", 0.0);
+    auto& one = field("one", 1.0);
+    auto& minusOne = field("minusOne", -1.0);
+
+    SECTION("Integrate two coupled equations in one solve on " + execName)
+    {
+        // du/dt = v, dv/dt = -u, u(t) = cos(t), v(t) = -sin(t) for u(0) = 1, v(0) = 0
+        auto eqnU = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqnU.addOperator(NeoN::dsl::exp::source(minusOne, v));
+        auto eqnV = NeoN::dsl::Expression<NeoN::scalar>(exec);
+        eqnV.addOperator(NeoN::dsl::exp::source(one, u));
+
+        NeoN::timeIntegration::CoupledRungeKutta<VolumeField> timeIntegrator {NeoN::Dictionary()};
+        NeoN::scalar time = 0.0;
+        for (int step = 0; step < 10; step++)
+        {
+            timeIntegrator.solve({&eqnU, &eqnV}, {&u, &v}, time, 0.01);
+            time += 0.01;
+        }
+        auto uHost = u.internalVector().copyToHost();
+        auto vHost = v.internalVector().copyToHost();
+        REQUIRE(uHost.view()[0] == Catch::Approx(std::cos(0.1)).margin(1e-8));
+        REQUIRE(vHost.view()[0] == Catch::Approx(-std::sin(0.1)).margin(1e-8));
+    }
+}
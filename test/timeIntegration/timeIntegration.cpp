@@ -6,6 +6,12 @@
                             // a custom main
 #include "catch2_common.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
 #include "../dsl/common.hpp"
 
 #include "NeoN/NeoN.hpp"
@@ -50,4 +56,485 @@ TEST_CASE("TimeIntegration")
         NeoN::dsl::solve(eqn, vf, time, dt, fvSchemes, fvSolution);
         REQUIRE(getVector(vf.internalVector()) == -2.0);
     }
+
+    SECTION("Replay the captured step of repeated solves on " + execName)
+    {
+        fvSchemes.subDict("ddtSchemes").insert("captureGraph", true);
+        auto dummy = Dummy(vf);
+        NeoN::dsl::TemporalOperator<NeoN::scalar> ddtOperator = NeoN::dsl::imp::ddt(vf);
+        NeoN::dsl::Expression<NeoN::scalar> eqn = ddtOperator + dummy;
+        double dt {2.0};
+        double time {1.0};
+        using CapturedStep = NeoN::timeIntegration::CapturedEulerStep<VolumeField>;
+
+        // every solve creates a new integrator, the captured step is kept in the mesh, the
+        // source is f = vf, hence vf is reset to U^0 = 2 before every further step
+        NeoN::dsl::solve(eqn, vf, time, dt, fvSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == -2.0);
+        REQUIRE(CapturedStep::find(vf) != nullptr);
+        REQUIRE(CapturedStep::find(vf)->captured());
+        REQUIRE(CapturedStep::find(vf)->replays() == 0);
+
+        NeoN::fill(vf.internalVector(), 2.0);
+        NeoN::dsl::solve(eqn, vf, time + dt, dt, fvSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == -2.0);
+        REQUIRE(CapturedStep::find(vf)->replays() == 1);
+
+        // a changed time step is captured again
+        NeoN::fill(vf.internalVector(), 2.0);
+        NeoN::dsl::solve(eqn, vf, time + 2 * dt, 1.0, fvSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == 0.0);
+        REQUIRE(CapturedStep::find(vf)->replays() == 0);
+
+        // a modified coefficient is captured again, U^1 = 2 - 2 * 2 * 1
+        eqn.spatialOperators()[0].getCoefficient() *= 2.0;
+        NeoN::fill(vf.internalVector(), 2.0);
+        NeoN::dsl::solve(eqn, vf, time + 3 * dt, 1.0, fvSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == -2.0);
+        REQUIRE(CapturedStep::find(vf)->replays() == 0);
+
+        NeoN::fill(vf.internalVector(), 2.0);
+        NeoN::dsl::solve(eqn, vf, time + 4 * dt, 1.0, fvSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == -2.0);
+        REQUIRE(CapturedStep::find(vf)->replays() == 1);
+
+        // so is a new expression with the previous coefficient
+        NeoN::dsl::Expression<NeoN::scalar> other = ddtOperator + Dummy(vf);
+        NeoN::fill(vf.internalVector(), 2.0);
+        NeoN::dsl::solve(other, vf, time + 5 * dt, 1.0, fvSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == 0.0);
+        REQUIRE(CapturedStep::find(vf)->replays() == 0);
+    }
+}
+
+/* @brief registers T = x^2 in the local and the ghost cells of the mesh, with a fixed value of one
+ * on the boundary
+ */
+struct CreateParabola
+{
+    std::string name;
+    const NeoN::UnstructuredMesh& mesh;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs {};
+        for (localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            NeoN::Dictionary dict;
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", NeoN::scalar(1.0));
+            bcs.push_back(fvcc::VolumeBoundary<NeoN::scalar>(mesh, dict, patchi));
+        }
+        NeoN::Field<NeoN::scalar> domainVector(
+            mesh.exec(), mesh.nCells() + mesh.nGhostCells(), mesh.boundaryMesh().offset()
+        );
+        fvcc::VolumeField<NeoN::scalar> vf(mesh.exec(), name, mesh, domainVector, bcs, db, "", "");
+        const auto centres = mesh.cellCentres().view();
+        NeoN::parallelFor(
+            vf.internalVector(),
+            KOKKOS_LAMBDA(const localIdx celli) { return centres[celli][0] * centres[celli][0]; }
+        );
+        vf.correctBoundaryConditions();
+        return NeoN::Document(
+            {{"name", vf.name},
+             {"timeIndex", std::int64_t(1)},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", vf}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+/* @brief one step of ddt(T) + div(phi, T) - laplacian(gamma, T) = 0 from T = x^2
+ *
+ * @param ghostValues, the values of the ghost cells, x^2 if empty
+ * @return the values of the local cells after the step
+ */
+std::vector<NeoN::scalar> stepParabola(
+    const NeoN::UnstructuredMesh& mesh,
+    const std::string& scheme,
+    const std::vector<NeoN::scalar>& ghostValues = {}
+)
+{
+    const auto exec = mesh.exec();
+    const auto type =
+        scheme == "forwardEuler" ? Operator::Type::Explicit : Operator::Type::Implicit;
+    NeoN::Database db;
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    auto& T =
+        fieldCollection.registerVector<VolumeField>(CreateParabola {.name = "T", .mesh = mesh});
+    if (!ghostValues.empty())
+    {
+        auto hostT = T.internalVector().copyToHost();
+        std::copy(ghostValues.begin(), ghostValues.end(), hostT.view().begin() + mesh.nCells());
+        T.internalVector() = hostT.copyToExecutor(exec);
+    }
+
+    // the flux of a uniform velocity follows the orientation of the faces
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    fvcc::SurfaceField<NeoN::scalar> faceFlux(exec, "phi", mesh, surfaceBCs);
+    const auto faceAreas = mesh.faceAreas().view();
+    NeoN::parallelFor(
+        faceFlux.internalVector(),
+        KOKKOS_LAMBDA(const localIdx facei) { return 0.5 * faceAreas[facei][0]; }
+    );
+    fvcc::SurfaceField<NeoN::scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gamma.internalVector(), 0.1);
+
+    NeoN::Input divInput = NeoN::TokenList({std::string("Gauss"), std::string("upwind")});
+    NeoN::Input lapInput =
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+    NeoN::dsl::Expression<NeoN::scalar> eqn(exec);
+    eqn.addOperator(NeoN::dsl::imp::ddt(T));
+    eqn.addOperator(fvcc::DivOperator<NeoN::scalar>(type, faceFlux, T, divInput));
+    eqn.addOperator(
+        Coeff(-1.0)
+        * NeoN::dsl::SpatialOperator<NeoN::scalar>(
+            fvcc::LaplacianOperator<NeoN::scalar>(type, gamma, T, lapInput)
+        )
+    );
+
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", scheme);
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution {
+        {{"solver", std::string {"Krylov"}},
+         {"method", std::string {"biCGStab"}},
+         {"relTol", NeoN::scalar(1e-14)}}
+    };
+    NeoN::dsl::solve(eqn, T, 0.0, 0.01, fvSchemes, fvSolution);
+
+    auto hostT = T.internalVector().copyToHost();
+    REQUIRE(hostT.size() == mesh.nCells() + mesh.nGhostCells());
+    return {hostT.view().begin(), hostT.view().begin() + mesh.nCells()};
+}
+
+TEST_CASE("TimeIntegration - ghost cells")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    const std::string scheme = GENERATE(std::string("forwardEuler"), std::string("backwardEuler"));
+
+    auto mesh = NeoN::create1DUniformMesh(exec, 12);
+    const auto expected = stepParabola(mesh, scheme);
+    const auto cellToPart = NeoN::partitionCells(mesh, 3);
+    const auto centres = mesh.cellCentres().copyToHost();
+
+    SECTION("Step the local cells of every part with " + scheme + " on " + execName)
+    {
+        for (NeoN::label part = 0; part < 3; part++)
+        {
+            auto decomposed =
+                NeoN::decomposeMesh(mesh, cellToPart, part, NeoN::HaloLayout::GhostCells);
+            const auto& local = decomposed.mesh;
+            REQUIRE(local.nGhostCells() > 0);
+
+            // the implicit step couples the ghost cells explicitly, hence the ghost cells hold the
+            // solution of the undecomposed mesh, as if exchanged after a converged step
+            std::vector<NeoN::scalar> ghostValues;
+            if (scheme == "backwardEuler")
+            {
+                const auto localCentres = local.cellCentres().copyToHost();
+                for (localIdx i = 0; i < local.nGhostCells(); i++)
+                {
+                    const auto centre = localCentres.view()[local.nCells() + i];
+                    for (localIdx celli = 0; celli < mesh.nCells(); celli++)
+                    {
+                        if (NeoN::mag(centres.view()[celli] - centre) < 1e-12)
+                        {
+                            ghostValues.push_back(expected[static_cast<std::size_t>(celli)]);
+                        }
+                    }
+                }
+                REQUIRE(ghostValues.size() == static_cast<std::size_t>(local.nGhostCells()));
+            }
+
+            const auto values = stepParabola(local, scheme, ghostValues);
+            auto cellMap = decomposed.cellMap.copyToHost();
+            for (localIdx celli = 0; celli < local.nCells(); celli++)
+            {
+                const auto globalCell = static_cast<std::size_t>(cellMap.view()[celli]);
+                REQUIRE(
+                    values[static_cast<std::size_t>(celli)]
+                    == Catch::Approx(expected[globalCell]).margin(1e-10)
+                );
+            }
+        }
+    }
+}
+
+TEST_CASE("TimeIntegration - concurrent solves")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create1DUniformMesh(exec, 20);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+    std::array<fvcc::SurfaceField<NeoN::scalar>, 2> gammas {
+        fvcc::SurfaceField<NeoN::scalar>(exec, "gamma0", mesh, surfaceBCs),
+        fvcc::SurfaceField<NeoN::scalar>(exec, "gamma1", mesh, surfaceBCs)
+    };
+    NeoN::fill(gammas[0].internalVector(), 0.1);
+    NeoN::fill(gammas[1].internalVector(), 0.2);
+    NeoN::Input lapInput =
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("backwardEuler"));
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution {
+        {{"solver", std::string {"Krylov"}},
+         {"method", std::string {"biCGStab"}},
+         {"relTol", NeoN::scalar(1e-14)}}
+    };
+
+    // ddt(T_i) - laplacian(gamma_i, T_i) = 0 of two fields on the mesh, solved one after the
+    // other or as concurrent tasks
+    const auto solveBoth = [&](bool concurrent)
+    {
+        NeoN::Database db;
+        fvcc::VectorCollection& fieldCollection =
+            fvcc::VectorCollection::instance(db, "fieldCollection");
+        std::array<VolumeField*, 2> fields {};
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            fields[i] = &fieldCollection.registerVector<VolumeField>(
+                CreateParabola {.name = "T" + std::to_string(i), .mesh = mesh}
+            );
+        }
+        std::array<NeoN::dsl::Expression<NeoN::scalar>, 2> eqns {
+            NeoN::dsl::Expression<NeoN::scalar>(exec), NeoN::dsl::Expression<NeoN::scalar>(exec)
+        };
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            eqns[i].addOperator(NeoN::dsl::imp::ddt(*fields[i]));
+            eqns[i].addOperator(
+                Coeff(-1.0)
+                * NeoN::dsl::SpatialOperator<NeoN::scalar>(fvcc::LaplacianOperator<NeoN::scalar>(
+                    Operator::Type::Implicit, gammas[i], *fields[i], lapInput
+                ))
+            );
+        }
+
+        NeoN::TaskGraph graph(exec, 2);
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            const auto solveField = [&, i](const NeoN::Executor&)
+            { NeoN::dsl::solve(eqns[i], *fields[i], 0.0, 0.01, fvSchemes, fvSolution); };
+            if (concurrent)
+            {
+                graph.submit(
+                    "solve" + fields[i]->name, {{}, NeoN::resources(*fields[i])}, i, solveField
+                );
+            }
+            else
+            {
+                solveField(exec);
+            }
+        }
+        graph.run();
+
+        std::array<std::vector<NeoN::scalar>, 2> values;
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            auto hostT = fields[i]->internalVector().copyToHost();
+            values[i] = std::vector<NeoN::scalar>(hostT.view().begin(), hostT.view().end());
+        }
+        return values;
+    };
+
+    SECTION("Solve the equations of two fields on one mesh concurrently on " + execName)
+    {
+        const auto expected = solveBoth(false);
+        const auto values = solveBoth(true);
+
+        // every equation owns its linear system, hence the concurrent assemblies do not mix
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            REQUIRE(values[i].size() == expected[i].size());
+            for (std::size_t celli = 0; celli < values[i].size(); celli++)
+            {
+                REQUIRE(values[i][celli] == Catch::Approx(expected[i][celli]).margin(1e-10));
+            }
+        }
+        REQUIRE(expected[0][0] != Catch::Approx(expected[1][0]).margin(1e-10));
+    }
+}
+
+TEST_CASE("TimeIntegration - low storage Runge-Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto [method, order] = GENERATE(
+        std::make_pair(std::string("Williamson-RK3"), 3.0),
+        std::make_pair(std::string("Carpenter-Kennedy-RK4"), 4.0),
+        std::make_pair(std::string("SSP-RK3"), 3.0)
+    );
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("lowStorageRungeKutta"));
+    ddtSchemes.insert("Runge-Kutta-Method", method);
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution;
+
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+
+    SECTION("Order of convergence of " + method + " on " + execName)
+    {
+        // ddt(U) + U = 0 with U(0) = 1, ie. U = exp(-t)
+        const NeoN::scalar maxTime = 1.0;
+        std::array<NeoN::scalar, 2> deltaTime = {0.2, 0.1};
+        std::array<NeoN::scalar, 2> error;
+        for (std::size_t iTest = 0; iTest < 2; iTest++)
+        {
+            auto& vfOld = fvcc::oldTime(vf);
+            vf.internalVector() = 1.0;
+            vfOld.internalVector() = 1.0;
+
+            auto dummy = Dummy(vf);
+            NeoN::dsl::TemporalOperator<NeoN::scalar> ddtOperator = NeoN::dsl::imp::ddt(vf);
+            NeoN::dsl::Expression<NeoN::scalar> eqn = ddtOperator + dummy;
+
+            const auto dt = deltaTime[iTest];
+            const auto nSteps = static_cast<int>(std::round(maxTime / dt));
+            for (int step = 0; step < nSteps; step++)
+            {
+                NeoN::dsl::solve(
+                    eqn, vf, static_cast<NeoN::scalar>(step) * dt, dt, fvSchemes, fvSolution
+                );
+                vfOld.internalVector() = vf.internalVector();
+            }
+            error[iTest] = std::abs(getVector(vf.internalVector()) - std::exp(-maxTime));
+        }
+
+        const auto measuredOrder = std::log(error[0] / error[1]) / std::log(2.0);
+        REQUIRE(measuredOrder > order - 0.2);
+    }
+}
+
+TEST_CASE("TimeIntegration - parareal")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+
+    NeoN::Dictionary fine;
+    fine.insert("type", std::string("lowStorageRungeKutta"));
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("parareal"));
+    ddtSchemes.insert("fine", fine);
+    ddtSchemes.insert("fineSteps", 5);
+    ddtSchemes.insert("nSlices", 4);
+    NeoN::Dictionary fvSolution;
+
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .value = 1.0, .timeIndex = 1}
+        );
+    auto& vfOld = fvcc::oldTime(vf);
+
+    // ddt(U) + U = 0 with U(0) = 1, the sequential fine solution has 20 steps of size 0.05
+    auto dummy = Dummy(vf);
+    NeoN::dsl::TemporalOperator<NeoN::scalar> ddtOperator = NeoN::dsl::imp::ddt(vf);
+    NeoN::dsl::Expression<NeoN::scalar> eqn = ddtOperator + dummy;
+    NeoN::Dictionary fvSchemes;
+    fvSchemes.insert("ddtSchemes", fine);
+    vf.internalVector() = 1.0;
+    for (int step = 0; step < 20; step++)
+    {
+        vfOld.internalVector() = vf.internalVector();
+        NeoN::dsl::solve(eqn, vf, NeoN::scalar(step) * 0.05, 0.05, fvSchemes, fvSolution);
+    }
+    const auto sequential = getVector(vf.internalVector());
+    vf.internalVector() = 1.0;
+
+    SECTION("Converges to the sequential fine solution on " + execName)
+    {
+        ddtSchemes.insert("tolerance", 0.0);
+        NeoN::timeIntegration::Parareal<fvcc::VolumeField<NeoN::scalar>> parareal(
+            ddtSchemes, fvSolution
+        );
+        parareal.solve(eqn, vf, 0.0, 1.0);
+
+        // after one correction per slice all slices agree with the fine solution
+        REQUIRE(parareal.nSlices() == 4);
+        REQUIRE(parareal.iterations() <= 4);
+        REQUIRE(getVector(vf.internalVector()) == Catch::Approx(sequential).margin(1e-12));
+        REQUIRE(getVector(vfOld.internalVector()) == 1.0);
+    }
+
+    SECTION("Stops at the tolerance on " + execName)
+    {
+        ddtSchemes.insert("tolerance", 1e-4);
+        NeoN::timeIntegration::Parareal<fvcc::VolumeField<NeoN::scalar>> parareal(
+            ddtSchemes, fvSolution
+        );
+        parareal.solve(eqn, vf, 0.0, 1.0);
+
+        REQUIRE(parareal.iterations() < 4);
+        REQUIRE(getVector(vf.internalVector()) == Catch::Approx(sequential).margin(1e-3));
+        REQUIRE(std::abs(getVector(vf.internalVector()) - std::exp(-1.0)) < 1e-3);
+    }
+
+    SECTION("Rejects multistep propagators on " + execName)
+    {
+        NeoN::Dictionary bdf2;
+        bdf2.insert("type", std::string("BDF2"));
+        ddtSchemes.insert("fine", bdf2);
+        REQUIRE_THROWS_AS(
+            NeoN::timeIntegration::Parareal<fvcc::VolumeField<NeoN::scalar>>(
+                ddtSchemes, fvSolution
+            ),
+            NeoN::NeoNException
+        );
+    }
+
+    SECTION("Selected by the scheme dictionary on " + execName)
+    {
+        NeoN::Dictionary pararealSchemes;
+        pararealSchemes.insert("ddtSchemes", ddtSchemes);
+        NeoN::dsl::solve(eqn, vf, 0.0, 1.0, pararealSchemes, fvSolution);
+        REQUIRE(getVector(vf.internalVector()) == Catch::Approx(sequential).margin(1e-12));
+    }
+}
+
+TEST_CASE("TimeIntegration - adaptive time step")
+{
+    NeoN::Dictionary dict;
+    dict.insert("maxCo", NeoN::scalar(0.5));
+    dict.insert("maxDeltaT", NeoN::scalar(1.0));
+    NeoN::timeIntegration::AdaptiveTimeStep controller(dict);
+
+    SECTION("Growth is limited")
+    {
+        REQUIRE(controller.next(0.1, 0.0) == Catch::Approx(0.12));
+        REQUIRE(controller.next(0.1, 0.25) == Catch::Approx(0.12));
+        REQUIRE(controller.next(0.9, 0.0) == Catch::Approx(1.0));
+    }
+
+    SECTION("Steps exceeding maxCo shrink at once")
+    {
+        REQUIRE(controller.next(0.1, 1.0) == Catch::Approx(0.05));
+    }
+
+    SECTION("Error estimate")
+    {
+        // err = 1 gives the safety factor, an exact step grows by maxGrowth
+        REQUIRE(controller.next(0.1, 0.1, 1.0, 2) == Catch::Approx(0.09));
+        REQUIRE(controller.next(0.1, 0.1, 0.0, 2) == Catch::Approx(0.12));
+        REQUIRE(controller.next(0.1, 0.1, 1.0e6, 2) == Catch::Approx(0.02));
+    }
 }